@@ -64,6 +64,7 @@ find_package(Gnuplot REQUIRED)
 find_package(MPFR)
 find_package(GMP)
 find_package(SQLITE3 REQUIRED)
+find_package(ZLIB REQUIRED)
 find_package(MPI REQUIRED)
 find_package(Arpack REQUIRED)
 find_package(ArpackPP REQUIRED)
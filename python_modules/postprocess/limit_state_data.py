@@ -26,6 +26,7 @@ from collections import defaultdict
 import csv
 from postprocess import control_vars as cv
 from postprocess.config import file_names as fn
+from postprocess import results_store as rs
 
 defaultSolutionProcedureType=  predefined_solutions.SimpleStaticLinear
 
@@ -122,6 +123,10 @@ class LimitStateData(object):
                                        both axial and bending internal
                                        forces otherwise, use it only for 
                                        bending moments.
+    :ivar writeResultsStore: if true, write also the internal forces,
+                             reactions and displacements in binary
+                             results store files (see results_store
+                             module).
     '''
     envConfig= None # configuration of XC environment variables.
     def __init__(self, limitStateLabel, outputDataBaseFileName, designSituations, woodArmerAlsoForAxialForces= True, cfg= None):
@@ -145,6 +150,7 @@ class LimitStateData(object):
         self.outputDataBaseFileName= outputDataBaseFileName
         self.designSituations= designSituations
         self.woodArmerAlsoForAxialForces= woodArmerAlsoForAxialForces
+        self.writeResultsStore= False
         LimitStateData.envConfig= cfg
 
     @staticmethod
@@ -177,6 +183,11 @@ class LimitStateData(object):
         '''Return the name of the file where internal forces are stored.'''
         return self.getInternalForcesResultsPath()+'intForce_'+ self.label +'.json'
     
+    def getInternalForcesStoreFileName(self):
+        '''Return the name of the binary file where internal forces are
+           stored (see results_store module).'''
+        return self.getInternalForcesResultsPath()+'intForce_'+ self.label +'.xcrs'
+    
     def getReactionsResultsPath(self):
         '''Return the directory where reactions are stored.'''
         return LimitStateData.getEnvConfig().projectDirTree.getReactionsResultsPath()
@@ -185,6 +196,11 @@ class LimitStateData(object):
         '''Return the name of the file where reactions are stored.'''
         return self.getReactionsResultsPath()+'reactions_'+ self.label +'.json'
         
+    def getReactionsStoreFileName(self):
+        '''Return the name of the binary file where reactions are stored
+           (see results_store module).'''
+        return self.getReactionsResultsPath()+'reactions_'+ self.label +'.xcrs'
+        
     def getBucklingAnalysisResultsFileName(self):
         '''Return the name of the file where results of the buckling analysis
            are stored.'''
@@ -248,11 +264,16 @@ class LimitStateData(object):
 
     def getInternalForcesSubset(self, elementsOfInterestTags):
         ''' Return a dictionary containing the internal forces for the given
-            elements.
+            elements. If the binary results store file is complete (its
+            writer was closed after analyzing all the combinations), the
+            values are read from it instead of parsing the JSON file.
 
         :param elementsOfInterestTags: identifiers of the elements of interest.
         '''
         fName= self.getInternalForcesFileName()
+        storeFileName= self.getInternalForcesStoreFileName()
+        if(rs.is_complete(storeFileName)):
+            return rs.read_results_subset(storeFileName, tags= elementsOfInterestTags, labelKey= 'type')
         with open(fName) as json_data:
             dct= json.load(json_data)
         retval= dict()
@@ -285,6 +306,11 @@ class LimitStateData(object):
         displacements (ux,uy,uz,rotX,rotY,rotZ).'''
         return self.getDisplacementsResultsPath()+'displ_'+ self.label +'.csv'
 
+    def getDisplacementsStoreFileName(self):
+        '''Return the name of the binary file where displacements are
+           stored (see results_store module).'''
+        return self.getDisplacementsResultsPath()+'displ_'+ self.label +'.xcrs'
+
     def getFullVerifPath(self):
         ''' Return the full path for the limit state checking files.'''
         return LimitStateData.getEnvConfig().projectDirTree.getFullVerifPath()
@@ -353,6 +379,8 @@ class LimitStateData(object):
         os.system("rm -f " + self.fNameReactions)
         os.system("rm -f " + self.fNameDispl)
         os.system("rm -f " + self.fNameBucklingAnalysisResults)
+        for fName in [self.getInternalForcesStoreFileName(), self.getReactionsStoreFileName(), self.getDisplacementsStoreFileName()]:
+            rs.remove_results_store(fName)
         fDisp= open(self.fNameDispl,"w")
         fDisp.write('Comb., Node, uX, uY, uZ, rotX, rotY , rotZ\n')
         fDisp.close()
@@ -371,7 +399,8 @@ class LimitStateData(object):
         fDisp.close()
 
     def writeInternalForces(self):
-        '''Write the internal forces results.
+        '''Write the internal forces results (the binary results store,
+           if any, is written as the combinations are analyzed).
         '''
         with open(self.fNameIntForc, 'w') as outfile:
             json.dump(self.internalForcesDict, outfile)
@@ -397,6 +426,11 @@ class LimitStateData(object):
         self.internalForcesDict= dict()
         self.reactionsDict= dict()
         self.displacementsDict= dict()
+        self.resultsStoreWriters= None
+        if(self.writeResultsStore):
+            self.resultsStoreWriters= {'internalForces': rs.DictResultsStoreWriter(self.getInternalForcesStoreFileName(), labelKey= 'type'),
+                                       'reactions': rs.DictResultsStoreWriter(self.getReactionsStoreFileName()),
+                                       'displacements': rs.DictResultsStoreWriter(self.getDisplacementsStoreFileName())}
 
     def updateResults(self, combName, calcSet, constrainedNodes= None):
         ''' Append the results of the current analysis to the results 
@@ -407,10 +441,19 @@ class LimitStateData(object):
                           going to be performed.
         :param constrainedNodes: constrained nodes (defaults to None)
         '''
-        self.internalForcesDict.update(self.getInternalForcesDict(combName,calcSet.elements))
+        internalForces= self.getInternalForcesDict(combName,calcSet.elements)
+        self.internalForcesDict.update(internalForces)
+        reactions= None
         if(constrainedNodes is not None):
-            self.reactionsDict.update(self.getReactionsDict(combName, constrainedNodes= constrainedNodes))
-        self.displacementsDict.update(self.getDisplacementsDict(combName, calcSet.nodes))
+            reactions= self.getReactionsDict(combName, constrainedNodes= constrainedNodes)
+            self.reactionsDict.update(reactions)
+        displacements= self.getDisplacementsDict(combName, calcSet.nodes)
+        self.displacementsDict.update(displacements)
+        if(getattr(self, 'resultsStoreWriters', None)): # append to the binary files.
+            self.resultsStoreWriters['internalForces'].append(internalForces)
+            if(reactions):
+                self.resultsStoreWriters['reactions'].append(reactions)
+            self.resultsStoreWriters['displacements'].append(displacements)
         
     def analyzeLoadCombinations(self, combContainer, setCalc, solutionProcedureType= defaultSolutionProcedureType, constrainedNodeSet= None, bucklingMembers= None):
         '''Analize the given load combinations and write internal forces, 
@@ -433,6 +476,10 @@ class LimitStateData(object):
         loadCombinations= preprocessor.getLoadHandler.getLoadCombinations
         #Putting combinations inside XC.
         loadCombinations= self.dumpCombinations(combContainer,loadCombinations)
+        # Linear superposition: solve each load pattern only once.
+        linearSuperposition= hasattr(solutionProcedure, 'computePrimaryResponses')
+        if(linearSuperposition):
+            solutionProcedure.computePrimaryResponses(loadCombinations)
         
         self.prepareResultsDictionaries()
         for key in loadCombinations.getKeys():
@@ -441,7 +488,10 @@ class LimitStateData(object):
             preprocessor.getDomain.revertToStart()
             comb.addToDomain() #Combination to analyze.
             #Solution
-            result= solutionProcedure.solve()
+            if(linearSuperposition):
+                result= solutionProcedure.solveCombination(comb)
+            else:
+                result= solutionProcedure.solve()
             if(result!=0):
                 className= type(self).__name__
                 methodName= sys._getframe(0).f_code.co_name
@@ -461,6 +511,9 @@ class LimitStateData(object):
         self.writeInternalForces()
         self.writeReactions()
         self.writeDisplacements()
+        if(getattr(self, 'resultsStoreWriters', None)):
+            for key in self.resultsStoreWriters:
+                self.resultsStoreWriters[key].close()
         
     def saveAll(self, combContainer, setCalc, solutionProcedureType= defaultSolutionProcedureType, constrainedNodeSet= None, bucklingMembers= None):
         '''Write internal forces, displacements, .., for each combination
@@ -0,0 +1,224 @@
+# -*- coding: utf-8 -*-
+''' Store the results of the load combinations (internal forces,
+    displacements, reactions,...) in binary files (see ResultsStoreWriter
+    and ResultsStoreReader) instead of JSON files, so the results for a
+    few elements can be read without parsing the whole file.
+
+    The results dictionaries have the structure used by LimitStateData:
+    {combName: {tag: {key: value,...}}} where the values can be numbers
+    or nested dictionaries. They are flattened to components named like
+    'internalForces.0.N'.
+'''
+
+from __future__ import print_function
+from __future__ import division
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import sys
+import math
+import numbers
+import xc
+from misc_utils import log_messages as lmsg
+
+def get_completion_stamp_file_name(fileName):
+    ''' Return the name of the file that marks the results store file
+        as complete (see DictResultsStoreWriter.close).
+
+    :param fileName: name of the results store file.
+    '''
+    return fileName+'.done'
+
+def is_complete(fileName):
+    ''' Return true if the results store file exists and the writer
+        that created it was closed (so it contains the results of all
+        the combinations).
+
+    :param fileName: name of the results store file.
+    '''
+    return os.path.exists(fileName) and os.path.exists(get_completion_stamp_file_name(fileName))
+
+def remove_results_store(fileName):
+    ''' Remove the results store file and its completion stamp.
+
+    :param fileName: name of the results store file.
+    '''
+    for fName in [fileName, get_completion_stamp_file_name(fileName)]:
+        if(os.path.exists(fName)):
+            os.remove(fName)
+
+def flatten_entity_dict(entityDict, labelKey= None, prefix= ''):
+    ''' Return a dictionary with the numeric values of the argument
+        using the path to each value as key (i.e.: 'internalForces.0.N').
+
+    :param entityDict: results for an entity (element, node,...).
+    :param labelKey: key of the label of the entity (ignored).
+    :param prefix: prefix of the keys.
+    '''
+    retval= dict()
+    for key in entityDict:
+        if(not prefix and (key==labelKey)):
+            continue
+        value= entityDict[key]
+        name= prefix+str(key)
+        if(isinstance(value, dict)):
+            retval.update(flatten_entity_dict(value, prefix= name+'.'))
+        elif(isinstance(value, numbers.Number) and not isinstance(value, bool)):
+            retval[name]= float(value)
+    return retval
+
+def unflatten_entity_values(componentNames, values):
+    ''' Return a nested dictionary (with string keys, as the ones read
+        from JSON files) from the flattened values (NaN values are
+        ignored).
+
+    :param componentNames: flattened keys.
+    :param values: values of the components.
+    '''
+    retval= dict()
+    for name, value in zip(componentNames, values):
+        if(math.isnan(value)):
+            continue
+        keys= name.split('.')
+        dct= retval
+        for key in keys[:-1]:
+            dct= dct.setdefault(key, dict())
+        dct[keys[-1]]= value
+    return retval
+
+class DictResultsStoreWriter(object):
+    ''' Append the results dictionaries of each combination to a
+        results store file.
+
+    :ivar fileName: name of the file.
+    :ivar labelKey: key of the entity label (i.e. 'type').
+    :ivar writer: results store writer.
+    :ivar tags: tags of the entities.
+    :ivar componentNames: names of the components.
+    '''
+    def __init__(self, fileName, labelKey= None):
+        ''' Constructor.
+
+        :param fileName: name of the file.
+        :param labelKey: key of the entity label (i.e. 'type').
+        '''
+        self.fileName= fileName
+        self.labelKey= labelKey
+        self.writer= xc.ResultsStoreWriter()
+        self.tags= None
+        self.componentNames= None
+
+    def open(self, entitiesDict):
+        ''' Create the file using the entities and components of the
+            argument.
+
+        :param entitiesDict: results of the first combination.
+        '''
+        stampFileName= get_completion_stamp_file_name(self.fileName)
+        if(os.path.exists(stampFileName)): # the file will be incomplete until closed.
+            os.remove(stampFileName)
+        self.tags= sorted([int(t) for t in entitiesDict])
+        self.componentNames= list()
+        knownNames= set()
+        labels= list()
+        for tag in self.tags:
+            entityDict= entitiesDict[tag] if tag in entitiesDict else entitiesDict[str(tag)]
+            for name in flatten_entity_dict(entityDict, labelKey= self.labelKey):
+                if(name not in knownNames):
+                    knownNames.add(name)
+                    self.componentNames.append(name)
+            label= ''
+            if(self.labelKey and (self.labelKey in entityDict)):
+                label= str(entityDict[self.labelKey])
+            labels.append(label)
+        if(not self.writer.open(self.fileName, xc.ID(self.tags), self.componentNames, labels)):
+            className= type(self).__name__
+            methodName= sys._getframe(0).f_code.co_name
+            lmsg.error(className+'.'+methodName+"; can't create file: '"+self.fileName+"'.")
+
+    def append(self, resultsDict):
+        ''' Append the results of the combinations in the argument.
+
+        :param resultsDict: dictionary {combName: {tag: {...}}}.
+        '''
+        for combName in resultsDict:
+            entitiesDict= resultsDict[combName]
+            if(self.tags is None):
+                self.open(entitiesDict)
+            rows= list()
+            for tag in self.tags:
+                entityDict= None
+                if(tag in entitiesDict):
+                    entityDict= entitiesDict[tag]
+                elif(str(tag) in entitiesDict):
+                    entityDict= entitiesDict[str(tag)]
+                flat= dict()
+                if(entityDict):
+                    flat= flatten_entity_dict(entityDict, labelKey= self.labelKey)
+                rows.append([flat.get(name, float('nan')) for name in self.componentNames])
+            if(rows):
+                values= xc.Matrix(rows)
+            else:
+                values= xc.Matrix(0, len(self.componentNames))
+            if(not self.writer.appendCombination(combName, values)):
+                className= type(self).__name__
+                methodName= sys._getframe(0).f_code.co_name
+                lmsg.error(className+'.'+methodName+"; can't write combination: '"+combName+"'.")
+
+    def close(self):
+        ''' Close the file and write the completion stamp (the file
+            contains the results of all the combinations).'''
+        self.writer.close()
+        if(self.tags is not None):
+            with open(get_completion_stamp_file_name(self.fileName), 'w') as stamp:
+                stamp.write(str(len(self.tags))+' entities.\n')
+
+def write_results_store(fileName, resultsDict, labelKey= None):
+    ''' Write the results dictionary in a results store file.
+
+    :param fileName: name of the file.
+    :param resultsDict: dictionary {combName: {tag: {...}}}.
+    :param labelKey: key of the entity label (i.e. 'type').
+    '''
+    writer= DictResultsStoreWriter(fileName= fileName, labelKey= labelKey)
+    writer.append(resultsDict)
+    writer.close()
+
+def read_results_subset(fileName, tags= None, labelKey= None):
+    ''' Return a dictionary {combName: {str(tag): {...}}} with the
+        results of the given entities, with the same structure of the
+        dictionaries read from the JSON results files.
+
+    :param fileName: name of the file.
+    :param tags: tags of the entities of interest (if None return all the
+                 entities in the file).
+    :param labelKey: key of the entity label (i.e. 'type').
+    '''
+    reader= xc.ResultsStoreReader()
+    retval= dict()
+    if(reader.open(fileName)):
+        if(tags is None):
+            tags= reader.getTags()
+        else:
+            tags= [t for t in tags if reader.getEntityIndex(t)>=0]
+        componentNames= reader.getComponentNames()
+        labels= reader.getLabels()
+        tagsId= xc.ID(tags)
+        for combIndex, combName in enumerate(reader.getCombinationNames()):
+            combDict= dict()
+            values= reader.getSubset(tagsId, combIndex).getList()
+            for tag, row in zip(tags, values):
+                entityDict= unflatten_entity_values(componentNames, row)
+                if(labelKey):
+                    label= labels[reader.getEntityIndex(tag)]
+                    if(label):
+                        entityDict[labelKey]= label
+                combDict[str(tag)]= entityDict
+            retval[combName]= combDict
+        reader.close()
+    return retval
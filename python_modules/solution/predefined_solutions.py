@@ -50,7 +50,7 @@ class SolutionProcedure(object):
     :ivar convergenceTestTol: convergence tolerance (defaults to 1e-9)
     :ivar printFlag: if not zero print convergence results on each step.
     :ivar numSteps: number of steps to use in the analysis (useful only when loads are variable in time).
-    :ivar numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+    :ivar numberingMethod: numbering method (plain, reverse Cuthill-McKee, alternative minimum degree or nested dissection).
     :ivar convTestType: convergence test type for non linear analysis (norm unbalance,...).
     :ivar integratorType: integrator type (see integratorSetup).
     :ivar soeType: type of the system of equations object.
@@ -73,7 +73,7 @@ class SolutionProcedure(object):
         :param convergenceTestTol: convergence tolerance (defaults to 1e-9)
         :param printFlag: if not zero print convergence results on each step.
         :param numSteps: number of steps to use in the analysis (useful only when loads are variable in time).
-        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+        :param numberingMethod: numbering method (plain, reverse Cuthill-McKee, alternative minimum degree or nested dissection).
         :param convTestType: convergence test type for non linear analysis (norm unbalance,...).
         :param soeType: type of the system of equations object.
         :param solverType: type of the solver.
@@ -408,6 +408,65 @@ def simple_static_linear_umf(prb):
     solProc.setup()
     return solProc.analysis
         
+class SimpleStaticLinearEigenSPD(PenaltyStaticLinearBase):
+    ''' Return a linear static solution algorithm
+        with a penalty constraint handler and a sparse
+        LDLT solver (Eigen library) for symmetric positive
+        definite systems.
+    '''
+    def __init__(self, prb, name= None, printFlag= 0, numSteps= 1, numberingMethod= 'simple', soeType= 'eigen_sparse_spd_lin_soe', solverType= 'eigen_sparse_spd_lin_solver', integratorType:str= 'load_control_integrator'):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param name: identifier for the solution procedure.
+        :param printFlag: if not zero print convergence results on each step.
+        :param numSteps: number of steps to use in the analysis (useful only when loads are variable in time).
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree). The solver computes its own fill-reducing ordering so the simple numbering is enough.
+        :param integratorType: integrator type (see integratorSetup).
+        '''
+        super(SimpleStaticLinearEigenSPD,self).__init__(name, printFlag= printFlag, numSteps= numSteps, numberingMethod= numberingMethod, soeType= soeType, solverType= solverType, integratorType= integratorType)
+        self.feProblem= prb
+        self.setPenaltyFactors()
+        
+### Convenience function.
+def simple_static_linear_eigen_spd(prb):
+    ''' Return a simple static linear solution procedure.'''
+    solProc= SimpleStaticLinearEigenSPD(prb)
+    solProc.setup()
+    return solProc.analysis
+        
+class SimpleStaticLinearPCG(PenaltyStaticLinearBase):
+    ''' Return a linear static solution algorithm
+        with a penalty constraint handler and an iterative
+        (Krylov subspace) solver for sparse symmetric systems.
+    '''
+    def __init__(self, prb, name= None, printFlag= 0, numSteps= 1, numberingMethod= 'rcm', soeType= 'csr_spd_lin_soe', solverType= 'pcg_lin_solver', preconditioner= 'incomplete_cholesky', relativeTolerance= 1e-10, integratorType:str= 'load_control_integrator'):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param name: identifier for the solution procedure.
+        :param printFlag: if not zero print convergence results on each step.
+        :param numSteps: number of steps to use in the analysis (useful only when loads are variable in time).
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree). The incomplete Cholesky preconditioner works better with the reverse Cuthill-McKee numbering.
+        :param solverType: type of the solver ('pcg_lin_solver' or 'minres_lin_solver').
+        :param preconditioner: preconditioner type ('jacobi', 'incomplete_cholesky', 'smoothed_aggregation_amg' or 'none').
+        :param relativeTolerance: tolerance for the norm of the residual relative to the norm of the right hand side.
+        :param integratorType: integrator type (see integratorSetup).
+        '''
+        super(SimpleStaticLinearPCG,self).__init__(name, printFlag= printFlag, numSteps= numSteps, numberingMethod= numberingMethod, soeType= soeType, solverType= solverType, integratorType= integratorType)
+        self.feProblem= prb
+        self.preconditioner= preconditioner
+        self.relativeTolerance= relativeTolerance
+        self.setPenaltyFactors()
+
+    def sysOfEqnSetup(self):
+        ''' Defines the solver to use for the resulting system of
+            equations and its preconditioner.
+        '''
+        super(SimpleStaticLinearPCG,self).sysOfEqnSetup()
+        self.solver.setPreconditioner(self.preconditioner)
+        self.solver.relativeTolerance= self.relativeTolerance
+        
 class SimpleStaticLinearMUMPS(PenaltyStaticLinearBase):
     ''' Return a linear static solution algorithm
         with a penalty constraint handler.
@@ -433,6 +492,80 @@ def simple_static_linear_mumps(prb):
     solProc.setup()
     return solProc.analysis
 
+class LinearCombinationsStaticLinear(PenaltyStaticLinearBase):
+    ''' Linear static solution of load combinations by superposition of
+        the responses to each load pattern (only one factorization of
+        the stiffness matrix is needed).
+    '''
+    def __init__(self, prb, name= None, printFlag= 0, numberingMethod= 'rcm', soeType= 'umfpack_gen_lin_soe', solverType= 'umfpack_gen_lin_solver'):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param name: identifier for the solution procedure.
+        :param printFlag: if not zero print convergence results on each step.
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+        :param soeType: type of the system of equations object.
+        :param solverType: type of the solver.
+        '''
+        super(LinearCombinationsStaticLinear,self).__init__(prb, name, printFlag= printFlag, numSteps= 1, numberingMethod= numberingMethod, soeType= soeType, solverType= solverType)
+        self.analysisType= 'linear_combination_analysis'
+
+    def computePrimaryResponses(self, combinations):
+        ''' Compute the response to each of the load patterns that
+            appear in the given combinations.
+
+        :param combinations: load combination container.
+        '''
+        if(not self.analysis):
+            self.setup()
+        result= self.analysis.computePrimaryResponses(combinations)
+        if(result!=0):
+            className= type(self).__name__
+            methodName= sys._getframe(0).f_code.co_name
+            lmsg.error(className+'.'+methodName+'; can\'t compute the responses to the load patterns.')
+        return result
+
+    def solveCombination(self, comb, calculateNodalReactions= False, includeInertia= False, reactionCheckTolerance= 1e-12):
+        ''' Update the model with the response to the given combination
+            (which must be already added to the domain).
+
+        :param comb: load combination.
+        :param calculateNodalReactions: if true calculate reactions at
+                                        nodes.
+        :param includeInertia: if true calculate reactions including inertia
+                               effects.
+        :param reactionCheckTolerance: tolerance when checking reaction values.
+        '''
+        result= self.analysis.solveComb(comb)
+        if(result!=0):
+            className= type(self).__name__
+            methodName= sys._getframe(0).f_code.co_name
+            lmsg.error(className+'.'+methodName+'; can\'t solve for combination: \''+comb.name+'\'.')
+        elif(calculateNodalReactions):
+            nodeHandler= self.feProblem.getPreprocessor.getNodeHandler
+            result= nodeHandler.calculateNodalReactions(includeInertia, reactionCheckTolerance)
+        return result
+
+    def solveComb(self, combName, calculateNodalReactions= False, includeInertia= False, reactionCheckTolerance= 1e-12):
+        ''' Obtains the solution for the combination argument.
+
+        :param combName: name of the combination to obtain the response for.
+        :param calculateNodalReactions: if true calculate reactions at
+                                        nodes.
+        :param includeInertia: if true calculate reactions including inertia
+                               effects.
+        :param reactionCheckTolerance: tolerance when checking reaction values.
+        '''
+        loadHandler= self.feProblem.getPreprocessor.getLoadHandler
+        combinations= loadHandler.getLoadCombinations
+        if((not self.analysis) or (self.analysis.numPrimaryResponses==0)):
+            self.computePrimaryResponses(combinations)
+        self.resetLoadCase() # Remove previous loads.
+        loadHandler.addToDomain(combName) # Add comb. loads.
+        analOk= self.solveCombination(combinations[combName], calculateNodalReactions, includeInertia, reactionCheckTolerance)
+        loadHandler.removeFromDomain(combName) # Remove comb.
+        return analOk
+
 class SimpleLagrangeStaticLinear(SolutionProcedure):
     ''' Linear static solution algorithm
         with a Lagrange constraint handler.
@@ -642,6 +775,25 @@ class PenaltyNewtonRaphsonUMF(PenaltyNewtonRaphsonBase):
         '''
         super(PenaltyNewtonRaphsonUMF,self).__init__(prb, name, maxNumIter, convergenceTestTol, printFlag, numSteps, numberingMethod, convTestType, soeType= 'umfpack_gen_lin_soe', solverType= 'umfpack_gen_lin_solver', integratorType= integratorType)
 
+class PenaltyNewtonRaphsonEigenSPD(PenaltyNewtonRaphsonBase):
+    ''' Static solution procedure with a Newton algorithm,
+        a penalty constraint handler and a sparse LDLT solver
+        (Eigen library) for symmetric positive definite systems.'''
+    def __init__(self, prb, name= None, maxNumIter= 150, convergenceTestTol= 1e-9, printFlag= 0, numSteps= 1, numberingMethod= 'simple', convTestType= 'norm_unbalance_conv_test', integratorType:str= 'load_control_integrator'):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param name: identifier for the solution procedure.
+        :param maxNumIter: maximum number of iterations (defauts to 10)
+        :param convergenceTestTol: convergence tolerance (defaults to 1e-9)
+        :param printFlag: if not zero print convergence results on each step.
+        :param numSteps: number of steps to use in the analysis (useful only when loads are variable in time).
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+        :param convTestType: convergence test for non linear analysis (norm unbalance,...).
+        :param integratorType: integrator type (see integratorSetup).
+        '''
+        super(PenaltyNewtonRaphsonEigenSPD,self).__init__(prb, name, maxNumIter, convergenceTestTol, printFlag, numSteps, numberingMethod, convTestType, soeType= 'eigen_sparse_spd_lin_soe', solverType= 'eigen_sparse_spd_lin_solver', integratorType= integratorType)
+
 class PenaltyNewtonRaphsonMUMPS(PenaltyNewtonRaphsonBase):
     ''' Static solution procedure with a Newton algorithm,
         a penalty constraint handler and a MUMPS
@@ -661,6 +813,43 @@ class PenaltyNewtonRaphsonMUMPS(PenaltyNewtonRaphsonBase):
         '''
         super(PenaltyNewtonRaphsonMUMPS,self).__init__(prb, name, maxNumIter, convergenceTestTol, printFlag, numSteps, numberingMethod, convTestType, soeType= 'mumps_soe', solverType= 'mumps_solver', integratorType= integratorType)
 
+class PenaltyNewtonRaphsonPCG(PenaltyNewtonRaphsonBase):
+    ''' Static solution procedure with a Newton algorithm,
+        a penalty constraint handler and an iterative
+        (Krylov subspace) solver for sparse symmetric systems.
+        Each Newton iteration starts the solver from the previous
+        increment (warm start).'''
+    def __init__(self, prb, name= None, maxNumIter= 10, convergenceTestTol= 1e-9, printFlag= 0, numSteps= 1, numberingMethod= 'rcm', convTestType= 'norm_unbalance_conv_test', solverType= 'pcg_lin_solver', preconditioner= 'incomplete_cholesky', relativeTolerance= 1e-10, warmStart= True, integratorType:str= 'load_control_integrator'):
+        ''' Constructor.
+
+        :param prb: XC finite element problem.
+        :param name: identifier for the solution procedure.
+        :param maxNumIter: maximum number of iterations (defauts to 10)
+        :param convergenceTestTol: convergence tolerance (defaults to 1e-9)
+        :param printFlag: if not zero print convergence results on each step.
+        :param numSteps: number of steps to use in the analysis (useful only when loads are variable in time).
+        :param numberingMethod: numbering method (plain or reverse Cuthill-McKee or alternative minimum degree).
+        :param convTestType: convergence test for non linear analysis (norm unbalance,...).
+        :param solverType: type of the solver ('pcg_lin_solver' or 'minres_lin_solver').
+        :param preconditioner: preconditioner type ('jacobi', 'incomplete_cholesky', 'smoothed_aggregation_amg' or 'none').
+        :param relativeTolerance: tolerance for the norm of the residual relative to the norm of the right hand side.
+        :param warmStart: if true start each solution from the previous one.
+        :param integratorType: integrator type (see integratorSetup).
+        '''
+        super(PenaltyNewtonRaphsonPCG,self).__init__(prb, name, maxNumIter, convergenceTestTol, printFlag, numSteps, numberingMethod, convTestType, soeType= 'csr_spd_lin_soe', solverType= solverType, integratorType= integratorType)
+        self.preconditioner= preconditioner
+        self.relativeTolerance= relativeTolerance
+        self.warmStart= warmStart
+
+    def sysOfEqnSetup(self):
+        ''' Defines the solver to use for the resulting system of
+            equations and its preconditioner.
+        '''
+        super(PenaltyNewtonRaphsonPCG,self).sysOfEqnSetup()
+        self.solver.setPreconditioner(self.preconditioner)
+        self.solver.relativeTolerance= self.relativeTolerance
+        self.solver.warmStart= self.warmStart
+
 class PlainStaticModifiedNewton(SolutionProcedure):
     ''' Static solution procedure with a modified Newton
         solution algorithm with a plain constraint handler.
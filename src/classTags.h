@@ -66,6 +66,7 @@
 #define matrixType 5
 
 #define ACTOR_TAGS_SUBDOMAIN 1
+#define ACTOR_TAGS_SUBSTRUCTURE 2
 
 #define DMG_TAG_HystereticEnergy 1
 #define DMG_TAG_ParkAng          2
@@ -427,6 +428,7 @@
 #define GraphNUMBERER_TAG_MyRCM   		3
 #define GraphNUMBERER_TAG_Metis   		4
 #define GraphNUMBERER_TAG_AMD   		5
+#define GraphNUMBERER_TAG_NestedDissection	6
 
 
 #define AnaMODEL_TAGS_AnalysisModel 	1
@@ -513,6 +515,8 @@
 #define LinSOE_TAGS_DistributedDiagonalSOE 22
 #define LinSOE_TAGS_MumpsSOE 23
 #define LinSOE_TAGS_MumpsParallelSOE 24
+#define LinSOE_TAGS_EigenSparseSPDLinSOE 25
+#define LinSOE_TAGS_CsrSPDLinSOE 26
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
 #define SOLVER_TAGS_BandGenLinLapackSolver  	2
@@ -538,6 +542,10 @@
 #define SOLVER_TAGS_DistributedDiagonalSolver 22
 #define SOLVER_TAGS_MumpsSolver			      	23
 #define SOLVER_TAGS_MumpsParallelSolver			24
+#define SOLVER_TAGS_EigenSparseSPDLinSolver		25
+#define SOLVER_TAGS_PCGLinSolver			26
+#define SOLVER_TAGS_MINRESLinSolver			27
+#define SOLVER_TAGS_FullGenLinSubstrThreadSolver	28
 
 
 #define RECORDER_TAGS_ElementRecorder		1
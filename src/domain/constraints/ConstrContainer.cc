@@ -42,8 +42,8 @@
 #include <domain/load/pattern/LoadPattern.h>
 #include <domain/load/pattern/NodeLocker.h>
 
-#include <utility/tagged/storage/MapOfTaggedObjects.h>
-#include <utility/tagged/storage/MapOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
 
 #include <domain/domain/single/SingleDomSFreedom_Iter.h>
 #include <domain/domain/single/SingleDomMFreedom_Iter.h>
@@ -91,9 +91,9 @@ void XC::ConstrContainer::free_mem(void)
 void XC::ConstrContainer::alloc_containers(void)
   {
     // init the arrays for storing the constraints components
-    theSPs= new MapOfTaggedObjects(this,"SPs");
-    theMPs= new MapOfTaggedObjects(this,"MPs");
-    theMRMPs= new MapOfTaggedObjects(this,"MRMPs");
+    theSPs= new VectorOfTaggedObjects(this,"SPs");
+    theMPs= new VectorOfTaggedObjects(this,"MPs");
+    theMRMPs= new VectorOfTaggedObjects(this,"MRMPs");
   }
 
 //! @brief Allocates memory for constraint iterators.
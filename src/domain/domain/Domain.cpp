@@ -152,7 +152,8 @@ bool XC::Domain::check_containers(void) const
 //! @param owr: object that contains this one.
 XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(),callbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0),
+   currentGeoTag(0), hasDomainChangedFlag(false),
+   currentTopologyTag(0), hasTopologyChangedFlag(false), commitTag(0),
    mesh(this), constraints(this), theRegions(),
    activeCombinations(), lastChannel(0), lastGeoSendTag(-1)
   {
@@ -174,7 +175,8 @@ XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh
 //! @param numNodeLockers: number of node lockers.
 XC::Domain::Domain(CommandEntity *owr,int numNodes, int numElements, int numSPs, int numMPs, int numLoadPatterns,int numNodeLockers,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(), callbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0), mesh(this),
+   currentGeoTag(0), hasDomainChangedFlag(false),
+   currentTopologyTag(0), hasTopologyChangedFlag(false), commitTag(0), mesh(this),
    constraints(this), theRegions(), activeCombinations(), lastChannel(0),
    lastGeoSendTag(-1)
   {
@@ -213,8 +215,10 @@ void XC::Domain::clearAll(void)
 
     // rest the flag to be as initial
     hasDomainChangedFlag = false;
+    hasTopologyChangedFlag= false;
 
     currentGeoTag = 0;
+    currentTopologyTag++; // analysis models built before are not valid anymore.
     lastGeoSendTag = -1;
     lastChannel = 0;
  }
@@ -264,7 +268,7 @@ bool XC::Domain::addSFreedom_Constraint(SFreedom_Constraint *spConstraint)
     if(result)
       {
         spConstraint->setDomain(this);
-        this->domainChange();
+        this->spConstraintsChange();
       }
     return true;
   }
@@ -318,7 +322,7 @@ bool XC::Domain::addSFreedom_Constraint(SFreedom_Constraint *spConstraint, int p
       }
 
     spConstraint->setDomain(this);
-    this->domainChange();
+    this->spConstraintsChange();
     return true;
   }
 
@@ -420,7 +424,7 @@ bool XC::Domain::removeSFreedom_Constraint(int theNode, int theDOF, int loadPatt
   {
     const bool retval= constraints.removeSFreedom_Constraint(theNode,theDOF,loadPatternTag);
     if(retval)
-      domainChange();
+      spConstraintsChange();
     return retval;
   }
 
@@ -432,7 +436,7 @@ bool XC::Domain::removeSFreedom_Constraint(int tag)
   {
     const bool retval= constraints.removeSFreedom_Constraint(tag);
     if(retval)
-      domainChange();
+      spConstraintsChange();
     return retval;
   }
 
@@ -514,7 +518,7 @@ bool XC::Domain::addLoadPattern(LoadPattern *lp)
 	// MH Scott 20221001 Remove call to domainChange if only adding/removing a nodal load
 	const int numSPs= lp->getNumSPs();
 	if(numSPs>0)
-          domainChange();
+          spConstraintsChange();
 	// End of modification.
       }
     else
@@ -542,7 +546,7 @@ bool XC::Domain::addNodeLocker(NodeLocker *nl)
     if(result)
       {
         nl->setDomain(this);
-        domainChange();
+        spConstraintsChange();
       }
     return result;
   }
@@ -634,7 +638,7 @@ bool XC::Domain::removeLoadPattern(int tag)
         // mark the domain has having changed if numSPs > 0
         // as the constraint handlers have to be redone
         if(numSPs>0)
-          domainChange();
+          spConstraintsChange();
       }
     // finally return the load pattern
     return result;
@@ -650,7 +654,7 @@ bool XC::Domain::removeNodeLocker(int tag)
         // mark the domain has having changed if numSPs > 0
         // as the constraint handlers have to be redone
         if(numSPs>0)
-          domainChange();
+          spConstraintsChange();
       }
     // finally return the node locker
     return result;
@@ -749,7 +753,7 @@ void XC::Domain::removeLPs(void)
     // mark the domain has having changed if numSPs > 0
     // as the constraint handlers have to be redone
     if(numSPs>0)
-      domainChange();
+      spConstraintsChange();
   }
 
 //! @brief Remove all node lockers from domain.
@@ -759,7 +763,7 @@ void XC::Domain::removeNLs(void)
     // mark the domain has having changed if numSPs > 0
     // as the constraint handlers have to be redone
     if(numSPs>0)
-      domainChange();
+      spConstraintsChange();
   }
 
 //! @brief Removes from domain the nodal load being passed as parameter.
@@ -782,7 +786,7 @@ bool XC::Domain::removeSFreedom_Constraint(int singleFreedomTag, int loadPattern
   {
     bool removed= constraints.removeSFreedom_Constraint(singleFreedomTag,loadPattern);
     if(removed)
-      this->domainChange();
+      this->spConstraintsChange();
     return removed;
   }
 
@@ -1041,6 +1045,16 @@ int XC::Domain::initialize(void)
 int XC::Domain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
   { return mesh.setRayleighDampingFactors(rF); }
 
+//! @brief Return the number of threads used to commit, update and
+//! revert the state of the mesh.
+int XC::Domain::getNumThreads(void) const
+  { return mesh.getNumThreads(); }
+
+//! @brief Set the number of threads used to commit, update and
+//! revert the state of the mesh (see Mesh::setNumThreads).
+void XC::Domain::setNumThreads(const int &n)
+  { mesh.setNumThreads(n); }
+
 //! @brief Commits domain state and triggers "record" method
 //! for all defined recorders.
 //!
@@ -1051,12 +1065,18 @@ int XC::Domain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 //! and elements to set there committed state as given by their current
 //! state. The domain will then set its committed time variable to be
 //! equal to the current time and lastly increments its commit tag by \f$1\f$.  
+//! Returns the value returned by the commit of the mesh (negative
+//! if any of its nodes or elements failed to commit its state).
 int XC::Domain::commit(void)
   {
     //
     // first invoke commit on all nodes and elements in the domain
     //
-    mesh.commit();
+    const int retval= mesh.commit();
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; the commit of the mesh failed."
+                << Color::def << std::endl;
 
     // set the new committed time in the domain
     setCommittedTime(timeTracker.getCurrentTime());
@@ -1065,7 +1085,7 @@ int XC::Domain::commit(void)
 
     // update the commitTag
     commitTag++;
-    return 0;
+    return retval;
   }
 
 //! @brief Return the domain to its last committed state.
@@ -1081,7 +1101,11 @@ int XC::Domain::revertToLastCommit(void)
     //
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     //
-    mesh.revertToLastCommit();
+    const int retval= mesh.revertToLastCommit();
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                << "; the mesh could not be reverted to its last committed state."
+                << Color::def << std::endl;
 
     // set the current time and load factor in the domain to last committed
     setCurrentTime(timeTracker.getCommittedTime());
@@ -1089,7 +1113,8 @@ int XC::Domain::revertToLastCommit(void)
     // apply load for the last committed time
     applyLoad(timeTracker.getCurrentTime());
 
-    return update();
+    const int ok= update();
+    return (retval<0 ? retval : ok);
   }
 
 //! @brief Return the domain to its initial state and
@@ -1286,7 +1311,25 @@ void XC::Domain::setDomainChangeStamp(int newStamp)
 //! invoked whenever a Node, Element or Constraint object is added to the
 //! domain.  
 void XC::Domain::domainChange(void)
-  { hasDomainChangedFlag= true; }
+  {
+    hasDomainChangedFlag= true;
+    hasTopologyChangedFlag= true;
+  }
+
+//! @brief Marks the domain as changed only in its single freedom
+//! constraints (added or removed SFreedom_Constraints, node lockers or
+//! load patterns with constraints).
+//!
+//! The stamp returned by hasDomainChanged() is incremented but
+//! the one returned by getCurrentTopologyTag() is not, so the
+//! analysis can reuse the DOF numbering when the constraint handler
+//! doesn't depend on the single freedom constraints to number them.
+void XC::Domain::spConstraintsChange(void)
+  {
+    const bool topologyChanged= hasTopologyChangedFlag;
+    domainChange();
+    hasTopologyChangedFlag= topologyChanged;
+  }
 
 //! @brief Returns true if the model has changed.
 //!
@@ -1305,6 +1348,11 @@ int XC::Domain::hasDomainChanged(void)
     if(result)
       {
         currentGeoTag++;
+        if(hasTopologyChangedFlag)
+          {
+            currentTopologyTag++;
+            hasTopologyChangedFlag= false;
+          }
         mesh.setGraphBuiltFlags(false);
       }
     // return the integer so user can determine if domain has changed
@@ -123,6 +123,8 @@ class Domain: public ObjWithRecorders, public DistributedBase
     int dbTag; //!< Tag for the database.
     int currentGeoTag; //!< an integer used to mark if domain has changed
     bool hasDomainChangedFlag; //!< a bool flag used to indicate if GeoTag needs to be ++
+    int currentTopologyTag; //!< an integer used to mark if nodes, elements or multi-freedom constraints have changed.
+    bool hasTopologyChangedFlag; //!< a bool flag used to indicate if currentTopologyTag needs to be ++
     int commitTag;
     Mesh mesh; //!< Nodes and element container.
     ConstrContainer constraints;//!< Constraint container.
@@ -252,6 +254,11 @@ class Domain: public ObjWithRecorders, public DistributedBase
     
     inline int getCurrentGeoTag(void) const
       { return currentGeoTag; }
+    //! @brief Return the stamp that changes only when the nodes, the
+    //! elements or the multi-freedom constraints of the domain change
+    //! (not when only the single freedom constraints do).
+    inline int getCurrentTopologyTag(void) const
+      { return currentTopologyTag; }
     virtual int getCommitTag(void) const;
     virtual int getNumElements(void) const;
     virtual int getNumNodes(void) const;
@@ -271,6 +278,8 @@ class Domain: public ObjWithRecorders, public DistributedBase
     virtual void setLoadConstant(void);
     virtual int initialize(void);
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
+    int getNumThreads(void) const;
+    void setNumThreads(const int &);
 
     virtual int commit(void);
     virtual int revertToLastCommit(void);
@@ -309,6 +318,7 @@ class Domain: public ObjWithRecorders, public DistributedBase
 
      // methods for other objects to determine if model has changed
     virtual void domainChange(void);
+    void spConstraintsChange(void);
     virtual int hasDomainChanged(void);
     virtual void setDomainChangeStamp(int newStamp);
 
@@ -43,6 +43,7 @@ class_<XC::Domain, bases<XC::ObjWithRecorders>, boost::noncopyable >("Domain", n
   .add_property("committedTime", &XC::Domain::getCommittedTime, &XC::Domain::setCommittedTime, "returns the committed value of the pseudo-time.")
   .add_property("currentCombinationName", &XC::Domain::getCurrentCombinationName,"returns current combination/load case name.")
   .def("setDeadSRF",XC::Domain::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation.")
+  .add_property("numThreads",&XC::Domain::getNumThreads,&XC::Domain::setNumThreads,"Get/set the number of threads used to commit, update and revert the state of the nodes and elements (1: serial).")
   .def("commit",&XC::Domain::commit)
   .def("revertToLastCommit",&XC::Domain::revertToLastCommit)
   .def("revertToStart",&XC::Domain::revertToStart)  
@@ -30,7 +30,7 @@
 #include <cstdlib>
 #include <utility/matrix/ID.h>
 #include "domain/domain/Domain.h"
-#include <utility/tagged/storage/ArrayOfTaggedObjects.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
 #include <domain/load/ElementalLoad.h>
 #include <domain/load/ElementalLoadIter.h>
 #include <domain/load/NodalLoadIter.h>
@@ -78,8 +78,8 @@ void XC::LoadContainer::free_iterators(void)
 void XC::LoadContainer::alloc_containers(void)
   {
     free_containers();
-    theNodalLoads = new ArrayOfTaggedObjects(this,32,"nodalLoad");
-    theElementalLoads = new ArrayOfTaggedObjects(this,32,"elementLoad");
+    theNodalLoads = new VectorOfTaggedObjects(this,"nodalLoad");
+    theElementalLoads = new VectorOfTaggedObjects(this,"elementLoad");
 
     if(!theNodalLoads || !theElementalLoads)
       {
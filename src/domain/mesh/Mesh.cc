@@ -40,8 +40,8 @@
 #include <domain/domain/single/SingleDomEleIter.h>
 #include <domain/domain/single/SingleDomNodIter.h>
 
-#include <utility/tagged/storage/MapOfTaggedObjects.h>
-#include <utility/tagged/storage/MapOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
 
 #include <solution/graph/graph/Vertex.h>
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
@@ -83,8 +83,8 @@ void XC::Mesh::free_mem(void)
 void XC::Mesh::alloc_containers(void)
   {
     // init the arrays for storing the mesh components
-    theNodes= new MapOfTaggedObjects(this,"node");
-    theElements= new MapOfTaggedObjects(this,"element");
+    theNodes= new VectorOfTaggedObjects(this,"node");
+    theElements= new VectorOfTaggedObjects(this,"element");
   }
 
 //! @brief Allocates memory for iterators.
@@ -117,7 +117,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), numThreads(1), concurrentStateBuilt(false)
   {
     alloc_containers();
     alloc_iters();
@@ -129,7 +129,8 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this),
+    numThreads(1), concurrentStateBuilt(false)
   {
     // init the iters
     alloc_iters();
@@ -149,7 +150,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), numThreads(1), concurrentStateBuilt(false)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -181,6 +182,7 @@ void XC::Mesh::clearAll(void)
     // FEProblem objects.
     // Node::getDefaultTag().setTag(0);
     lockers.clearAll();
+    nodalState.clear(); // no node uses it now.
 
     // set the bounds around the origin
     theBounds.Zero();
@@ -188,6 +190,7 @@ void XC::Mesh::clearAll(void)
     // rest the flag to be as initial
     nodeGraphBuiltFlag= false;
     eleGraphBuiltFlag= false;
+    concurrentStateBuilt= false;
   }
 
 //! @brief Destructor.
@@ -209,6 +212,7 @@ void XC::Mesh::add_element_to_domain(Element *element)
     // mark the domain as having been changed
     dom->domainChange();
     kdtreeElements.insert(*element);
+    concurrentStateBuilt= false;
   }
 
 //! @brief Must only to be called from recvSelf.
@@ -304,6 +308,8 @@ void XC::Mesh::add_node_to_domain(Node *node)
     dom->domainChange();
     update_bounds(node->getCrds());
     kdtreeNodes.insert(*node);
+    concurrentStateBuilt= false;
+    nodalState.invalidate();
   }
 
 //! @brief Must only to be called from recvSelf.
@@ -378,6 +384,7 @@ bool XC::Mesh::removeElement(int tag)
       }
     // remove the object from the container
     bool res= theElements->removeComponent(tag);
+    concurrentStateBuilt= false;
     return res;
   }
 
@@ -415,7 +422,8 @@ bool XC::Mesh::removeNode(int tag)
       }
     // remove the object from the container
     bool res= theNodes->removeComponent(tag);
-    
+    concurrentStateBuilt= false;
+    nodalState.invalidate();
     return res;
   }
 
@@ -885,21 +893,136 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
     return result;
   }
 
+//! @brief Return the number of threads used to commit, update and
+//! revert the state of the nodes and elements.
+int XC::Mesh::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Set the number of threads used to commit, update and revert
+//! the state of the nodes and elements.
+//!
+//! If the number of threads is greater than one, the nodes and the
+//! elements that allow it (see Element::allowsConcurrentStateDetermination)
+//! are processed concurrently; the remaining elements are processed
+//! afterwards by the calling thread.
+void XC::Mesh::setNumThreads(const int &n)
+  {
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING number of threads must be at least one."
+		  << " Using one thread." << std::endl;
+	numThreads= 1;
+      }
+    else
+      numThreads= n;
+  }
+
+//! @brief Collects the nodes and elements of the mesh, separating the
+//! elements whose state can be updated concurrently from the others.
+void XC::Mesh::setup_concurrent_state(void)
+  {
+    const size_t numNodes= theNodes->getNumComponents();
+    const size_t numElements= theElements->getNumComponents();
+    const bool upToDate= concurrentStateBuilt && (concurrentNodes.size()==numNodes) && (concurrentElements.size()+serialElements.size()==numElements);
+    if(!upToDate)
+      {
+	concurrentNodes.clear();
+	concurrentNodes.reserve(numNodes);
+	Node *nodePtr= nullptr;
+	NodeIter &theNodeIter= this->getNodes();
+	while((nodePtr= theNodeIter()) != nullptr)
+	  concurrentNodes.push_back(nodePtr);
+	concurrentElements.clear();
+	serialElements.clear();
+	Element *elePtr= nullptr;
+	ElementIter &theElemIter= this->getElements();
+	while((elePtr= theElemIter()) != nullptr)
+	  {
+	    if(elePtr->allowsConcurrentStateDetermination() && !elePtr->isSubdomain())
+	      concurrentElements.push_back(elePtr);
+	    else
+	      serialElements.push_back(elePtr);
+	  }
+	concurrentStateBuilt= true;
+      }
+  }
+
+//! @brief Return true if the state of all the elements of the mesh
+//! can be determined concurrently with the state of other elements
+//! (see Element::allowsConcurrentStateDetermination). The elements
+//! of the subdomains of the mesh, if any, are also checked.
+bool XC::Mesh::allowsConcurrentStateDetermination(void)
+  {
+    bool retval= true;
+    setup_concurrent_state();
+    for(std::vector<Element *>::iterator i= serialElements.begin();i!=serialElements.end();i++)
+      {
+	Domain *subdomain= nullptr;
+	if((*i)->isSubdomain())
+	  subdomain= dynamic_cast<Domain *>(*i);
+	if(!subdomain || !subdomain->getMesh().allowsConcurrentStateDetermination())
+	  {
+	    retval= false;
+	    break;
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Call the given methods on each node and element of the mesh
+//! using numThreads threads and return the sum of the values returned
+//! by those calls (0 if all of them succeed).
+//!
+//! @param nodeMethod: method to call on the nodes (if not null).
+//! @param elementMethod: method to call on the elements.
+int XC::Mesh::concurrent_state(int (Node::*nodeMethod)(void), int (Element::*elementMethod)(void))
+  {
+    int retval= 0;
+    if(numThreads>1)
+      {
+	setup_concurrent_state();
+	if(nodeMethod)
+	  {
+	    const long numNodes= concurrentNodes.size();
+#pragma omp parallel for schedule(static) num_threads(numThreads) reduction(+:retval)
+	    for(long i= 0;i<numNodes;i++)
+	      retval+= (concurrentNodes[i]->*nodeMethod)();
+	  }
+	const long numElements= concurrentElements.size();
+#pragma omp parallel for schedule(dynamic,16) num_threads(numThreads) reduction(+:retval)
+	for(long i= 0;i<numElements;i++)
+	  retval+= (concurrentElements[i]->*elementMethod)();
+	for(std::vector<Element *>::iterator i= serialElements.begin();i!=serialElements.end();i++)
+	  retval+= ((*i)->*elementMethod)();
+      }
+    else
+      {
+	if(nodeMethod)
+	  {
+	    Node *nodePtr= nullptr;
+	    NodeIter &theNodeIter= this->getNodes();
+	    while((nodePtr= theNodeIter()) != nullptr)
+	      retval+= (nodePtr->*nodeMethod)();
+	  }
+
+	Element *elePtr= nullptr;
+	ElementIter &theElemIter= this->getElements();
+	while((elePtr= theElemIter()) != nullptr)
+	  retval+= (elePtr->*elementMethod)();
+      }
+    return retval;
+  }
+
 //! @brief Commits mesh state.
 int XC::Mesh::commit(void)
   {
     // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
-
-    Element *elePtr= nullptr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->commitState(); }
-
-    return 0;
+    const int retval= concurrent_state(&Node::commitState, &Element::commitState);
+    // gather the nodal state if nodes have been added or removed.
+    if(nodalState.isEnabled() && !nodalState.isPacked())
+      packNodalState();
+    return retval;
   }
 
 //! @brief Returns the mesh to its last committed state.
@@ -908,18 +1031,8 @@ int XC::Mesh::revertToLastCommit(void)
     //
     // first invoke revertToLastCommit  on all nodes and elements in the mesh
     //
-
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToLastCommit();
-
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();
-    while((elePtr = theElemIter()) != 0)
-      { elePtr->revertToLastCommit(); }
-
-    return update();
+    const int ok= concurrent_state(&Node::revertToLastCommit, &Element::revertToLastCommit);
+    return ok+update();
   }
 
 //! @brief Return the mesh into its initial state.
@@ -929,33 +1042,18 @@ int XC::Mesh::revertToStart(void)
     // first invoke revertToStart  on all nodes and
     // elements in the mesh
     //
-
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      nodePtr->revertToStart();
-
-    Element *elePtr;
-    ElementIter &theElements = this->getElements();
-    while((elePtr = theElements()) != 0)
-      { elePtr->revertToStart(); }
-
-    return update();
+    const int ok= concurrent_state(&Node::revertToStart, &Element::revertToStart);
+    return ok+update();
   }
 
 //! @brief Update the element's state.
 //! 
 //! Called by the domain to update the state of the
-//! mesh. Iterates over all the elements and invokes {\em update()}. 
+//! mesh. Invokes {\em update()} on all the elements. 
 int XC::Mesh::update(void)
   {
-    int ok = 0;
-
     // invoke update on all the ele's
-    ElementIter &theEles = this->getElements();
-    Element *theEle;
-    while((theEle = theEles()) != 0)
-      { ok += theEle->update(); }
+    const int ok= concurrent_state(nullptr, &Element::update);
 
     if(ok != 0)
       std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
@@ -966,11 +1064,72 @@ int XC::Mesh::update(void)
 
 
 
+//! @brief Return true if the nodal displacements, velocities and
+//! accelerations are stored in contiguous arrays (see NodalStateArena).
+bool XC::Mesh::getNodalStateArena(void) const
+  { return nodalState.isEnabled(); }
+
+//! @brief Store the nodal displacements, velocities and accelerations in
+//! contiguous arrays (see NodalStateArena). The nodes added or removed
+//! afterwards are gathered again when the mesh state is committed.
+//!
+//! Disabling the arena doesn't move back the values of the nodes; it
+//! only stops the gathering on commit.
+void XC::Mesh::setNodalStateArena(const bool &b)
+  {
+    nodalState.setEnabled(b);
+    if(b)
+      packNodalState();
+  }
+
+//! @brief Move the displacements, velocities and accelerations of the
+//! nodes to contiguous arrays ordered by node tag. Return the number
+//! of nodes in the arena.
+int XC::Mesh::packNodalState(void)
+  {
+    std::vector<Node *> tmp;
+    tmp.reserve(theNodes->getNumComponents());
+    Node *nodePtr= nullptr;
+    NodeIter &theNodeIter= this->getNodes();
+    while((nodePtr= theNodeIter()) != nullptr)
+      tmp.push_back(nodePtr);
+    return nodalState.pack(tmp);
+  }
+
+//! @brief Return a copy of the displacements, velocities and
+//! accelerations (trial, committed and incremental values) of the
+//! nodes of the mesh.
+XC::Vector XC::Mesh::getNodalStateSnapshot(void) const
+  {
+    if(!nodalState.isPacked())
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; WARNING nodal state arena not packed;"
+	        << " the snapshot is not up to date." << std::endl;
+    return nodalState.getSnapshot();
+  }
+
+//! @brief Restore the displacements, velocities and accelerations
+//! of the nodes from a snapshot (see getNodalStateSnapshot).
+//! The mesh must not have changed since the snapshot was taken.
+int XC::Mesh::setNodalStateSnapshot(const Vector &v)
+  {
+    int retval= -1;
+    if(!nodalState.isPacked())
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; nodal state arena not packed;"
+	        << " can't restore the snapshot." << std::endl;
+    else
+      retval= nodalState.setSnapshot(v);
+    return retval;
+  }
+
 //! @brief Returns true if the modelo ha cambiado.
 void XC::Mesh::setGraphBuiltFlags(const bool &f)
   {
     nodeGraphBuiltFlag= f;
     eleGraphBuiltFlag= f;
+    if(!f)
+      concurrentStateBuilt= false;
   }
 
 //! @brief Imprime el domain.
@@ -35,6 +35,7 @@
 #include "NodeLockers.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
+#include "node/NodalStateArena.h"
 #include "element/utils/KDTreeElements.h"
 
 class Pos3d;
@@ -87,6 +88,13 @@ class Mesh: public MeshComponentContainer
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
 
+    int numThreads; //!< number of threads used to commit, update and revert the state of the mesh.
+    bool concurrentStateBuilt; //!< true if the following vectors are up to date.
+    std::vector<Node *> concurrentNodes; //!< nodes whose state is updated concurrently.
+    std::vector<Element *> concurrentElements; //!< elements whose state is updated concurrently.
+    std::vector<Element *> serialElements; //!< elements whose state is updated by the calling thread.
+    NodalStateArena nodalState; //!< contiguous storage of the nodal displacements, velocities and accelerations.
+
     void alloc_containers(void);
     void alloc_iters(void);
     bool check_containers(void) const;
@@ -96,6 +104,8 @@ class Mesh: public MeshComponentContainer
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    void setup_concurrent_state(void);
+    int concurrent_state(int (Node::*)(void), int (Element::*)(void));
 
     Mesh(const Mesh &other);
     Mesh &operator=(const Mesh &other);
@@ -185,11 +195,24 @@ class Mesh: public MeshComponentContainer
     virtual Graph &getElementGraph(void);
     virtual Graph &getNodeGraph(void);
 
+    int getNumThreads(void) const;
+    void setNumThreads(const int &);
+    bool allowsConcurrentStateDetermination(void);
     virtual int commit(void);
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
     int update(void);
 
+    bool getNodalStateArena(void) const;
+    //! @brief Return the contiguous storage of the nodal displacements,
+    //! velocities and accelerations.
+    inline NodalStateArena &getNodalState(void)
+      { return nodalState; }
+    void setNodalStateArena(const bool &);
+    int packNodalState(void);
+    Vector getNodalStateSnapshot(void) const;
+    int setNodalStateSnapshot(const Vector &);
+
     void freeze_dead_nodes(const std::string &nmbLocker);
     void melt_alive_nodes(const std::string &nmbLocker);
 
@@ -90,9 +90,9 @@
 #include "vtkCellType.h"
 #include "utility/utils/misc_utils/colormod.h"
 
-std::deque<XC::Matrix> XC::Element::theMatrices;
-std::deque<XC::Vector> XC::Element::theVectors1;
-std::deque<XC::Vector> XC::Element::theVectors2;
+thread_local std::deque<XC::Matrix> XC::Element::theMatrices;
+thread_local std::deque<XC::Vector> XC::Element::theVectors1;
+thread_local std::deque<XC::Vector> XC::Element::theVectors2;
 double XC::Element::dead_srf= 1e-6;//Stiffness reduction factor for dead (non active) elements.
 XC::DefaultTag XC::Element::defaultTag;
 
@@ -151,6 +151,22 @@ int XC::Element::revertToStart(void)
     return 0;
   }
 
+//! @brief Return the index of the work area (matrix and vectors) of the
+//! calling thread whose size matches the number of DOFs of the element,
+//! creating it if needed.
+size_t XC::Element::get_work_area_index(void) const
+  {
+    const int numDOF= this->getNumDOF();
+    const size_t numMatrices= theMatrices.size();
+    for(size_t i=0; i<numMatrices; i++)
+      if((theMatrices[i].noRows() == numDOF) && (theVectors1[i].Size() == numDOF))
+        return i;
+    theMatrices.push_back(Matrix(numDOF,numDOF));
+    theVectors1.push_back(Vector(numDOF));
+    theVectors2.push_back(Vector(numDOF));
+    return numMatrices;
+  }
+
 //! @brief Set Rayleigh damping factors.
 int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) const
   {
@@ -159,18 +175,7 @@ int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) con
     // check that memory has been allocated to store compute/return
     // damping matrix & residual force calculations
     if(index == -1)
-      {
-        int numDOF = this->getNumDOF();
-
-        setup_matrices(theMatrices,numDOF);
-        if(theVectors1.size()<theMatrices.size())
-          {
-            Vector theVector1(numDOF);
-            Vector theVector2(numDOF);
-            theVectors1.push_back(theVector1);
-            theVectors2.push_back(theVector2);
-         }
-      }
+      index= get_work_area_index();
     // if need storage for Kc go get it
     if(rayFactors.getBetaKc() != 0.0)
       Kc= Matrix(this->getTangentStiff());
@@ -399,7 +404,7 @@ const XC::Matrix &XC::Element::getDamp(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= theMatrices[get_work_area_index()];
     compute_damping_matrix(theMatrix);
     // return the computed matrix
     return theMatrix;
@@ -420,7 +425,7 @@ const XC::Matrix &XC::Element::getMass(void) const
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // zero the matrix & return it
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= theMatrices[get_work_area_index()];
     theMatrix.Zero();
     return theMatrix;
   }
@@ -489,9 +494,10 @@ const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Zeroes dumping factors.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const size_t wa= get_work_area_index();
+    Matrix &theMatrix= theMatrices[wa];
+    Vector &theVector= theVectors2[wa];
+    Vector &theVector2= theVectors1[wa];
 
     //
     // perform: R = P(U) - Pext(t);
@@ -571,7 +577,7 @@ XC::Matrix XC::Element::getNodeMatrixComponents(const Node *ptrNod,const Matrix
 //! node.
 const XC::Vector &XC::Element::getNodeResistingComponents(const size_t &iNod,const Vector &rf) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     const int ndof= getNodePtrs()[iNod]->getNumberDOF(); // number of DOFs in the node.
     retval.resize(ndof);
     for(int i=0;i<ndof;i++)
@@ -657,9 +663,10 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
     if(index == -1)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const size_t wa= get_work_area_index();
+    Matrix &theMatrix= theMatrices[wa];
+    Vector &theVector= theVectors2[wa];
+    Vector &theVector2= theVectors1[wa];
 
     //
     // perform: R = (rayFactors.getAlphaM() * M + rayFactors.getBetaK0() * K0 + rayFactors.getBetaK() * K) * v
@@ -690,6 +697,15 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
 bool XC::Element::isSubdomain(void)
   { return false; }
 
+//! @brief Return true if the tangent stiffness and the resisting force
+//! of this element can be computed at the same time that those of other
+//! elements (in other threads). To allow that, the element (and its
+//! materials) must not write on class-wide work areas while computing
+//! them. The default implementation returns false, so the element is
+//! processed by the calling thread.
+bool XC::Element::allowsConcurrentStateDetermination(void) const
+  { return false; }
+
 //! setResponse() is a method invoked to determine if the element
 //! will respond to a request for a certain of information. The
 //! information requested of the element is passed in the array of char
@@ -743,19 +759,19 @@ int XC::Element::activateParameter(int parameterID)
 
 const XC::Vector &XC::Element::getResistingForceSensitivity(int gradNumber)
   {
-    static XC::Vector dummy(1);
+    static thread_local XC::Vector dummy(1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getInitialStiffSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
 const XC::Matrix &XC::Element::getMassSensitivity(int gradNumber)
   {
-    static XC::Matrix dummy(1,1);
+    static thread_local XC::Matrix dummy(1,1);
     return dummy;
   }
 
@@ -774,7 +790,7 @@ const XC::Matrix &XC::Element::getDampSensitivity(int gradNumber)
       setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
 
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= theMatrices[get_work_area_index()];
     theMatrix.Zero();
     if(rayFactors.getAlphaM() != 0.0)
       theMatrix.addMatrix(0.0, this->getMassSensitivity(gradNumber), rayFactors.getAlphaM());
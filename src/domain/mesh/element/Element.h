@@ -120,10 +120,11 @@ class Element: public MeshComponent
   private:
     int nodeIndex;
 
-    static std::deque<Matrix> theMatrices;
-    static std::deque<Vector> theVectors1;
-    static std::deque<Vector> theVectors2;
+    static thread_local std::deque<Matrix> theMatrices;
+    static thread_local std::deque<Vector> theVectors1;
+    static thread_local std::deque<Vector> theVectors2;
 
+    size_t get_work_area_index(void) const;
     void compute_damping_matrix(Matrix &) const;
     static DefaultTag defaultTag; //<! default tag for next new element.
   protected:
@@ -191,6 +192,7 @@ class Element: public MeshComponent
     virtual int revertToStart(void);
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool allowsConcurrentStateDetermination(void) const;
 
     // methods to return the current linearized stiffness,
     // damping and mass matrices
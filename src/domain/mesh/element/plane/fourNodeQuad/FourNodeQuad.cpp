@@ -69,11 +69,11 @@
 #include "domain/load/plane/QuadRawLoad.h"
 
 
-double XC::FourNodeQuad::matrixData[64];
-XC::Matrix XC::FourNodeQuad::K(matrixData, 8, 8);
-XC::Matrix XC::FourNodeQuad::mass(8,8);
-XC::Vector XC::FourNodeQuad::P(8);
-double XC::FourNodeQuad::shp[3][4]; //Values of shape functions.
+thread_local double XC::FourNodeQuad::matrixData[64];
+thread_local XC::Matrix XC::FourNodeQuad::K(matrixData, 8, 8);
+thread_local XC::Matrix XC::FourNodeQuad::mass(8,8);
+thread_local XC::Vector XC::FourNodeQuad::P(8);
+thread_local double XC::FourNodeQuad::shp[3][4]; //Values of shape functions.
 
 //! @brief Constructor.
 XC::FourNodeQuad::FourNodeQuad(int tag,const NDMaterial *ptr_mat)
@@ -105,6 +105,11 @@ XC::FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 XC::Element* XC::FourNodeQuad::getCopy(void) const
   { return new FourNodeQuad(*this); }
 
+//! @brief Return true if the materials of the element allow
+//! concurrent state determination.
+bool XC::FourNodeQuad::allowsConcurrentStateDetermination(void) const
+  { return physicalProperties.allowsConcurrentStateDetermination(); }
+
 //! @brief Destructor.
 XC::FourNodeQuad::~FourNodeQuad(void)
   {}
@@ -161,7 +166,7 @@ int XC::FourNodeQuad::update(void)
     const Vector &disp3= theNodes[2]->getTrialDisp();
     const Vector &disp4= theNodes[3]->getTrialDisp();
 
-    static double u[2][4];
+    static thread_local double u[2][4];
 
     u[0][0] = disp1(0);
     u[1][0] = disp1(1);
@@ -415,7 +420,7 @@ int XC::FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
         return -1;
       }
 
-    static double ra[8];
+    static thread_local double ra[8];
 
     ra[0] = Raccel1(0);
     ra[1] = Raccel1(1);
@@ -510,7 +515,7 @@ const XC::Vector &XC::FourNodeQuad::getResistingForceIncInertia(void) const
     const Vector &accel3 = theNodes[2]->getTrialAccel();
     const Vector &accel4 = theNodes[3]->getTrialAccel();
 
-    static double a[8];
+    static thread_local double a[8];
 
     a[0] = accel1(0);
     a[1] = accel1(1);
@@ -544,7 +549,7 @@ void XC::FourNodeQuad::formInertiaTerms(int tangFlag) const
   {
     mass.Zero();
 
-    static Vector rhoi(4);
+    static thread_local Vector rhoi(4);
     const double sum= physicalProperties.getArealRho();
 
     if(sum != 0.0)
@@ -84,11 +84,11 @@ class FourNodeQuad: public SolidMech4N
     mutable std::vector<Vector> eps; //!< strains at gauss points.
     std::vector<Vector> persistentInitialDeformation; //!< Persistent initial strain at element level. Used to store the deformation during the inactive phase of the element (if any).
 
-    static double matrixData[64]; //!< array data for matrix
-    static Matrix K; //!< Element stiffness, and damping matrix.
-    static Matrix mass; //!< mass matrix.
-    static Vector P; //!< Element resisting force vector
-    static double shp[3][4]; //!< Stores shape functions and derivatives (overwritten)
+    static thread_local double matrixData[64]; //!< array data for matrix
+    static thread_local Matrix K; //!< Element stiffness, and damping matrix.
+    static thread_local Matrix mass; //!< mass matrix.
+    static thread_local Vector P; //!< Element resisting force vector
+    static thread_local double shp[3][4]; //!< Stores shape functions and derivatives (overwritten)
 
     // private member functions - only objects of this class can call these
     double shapeFunction(const GaussPoint &gp) const;
@@ -104,6 +104,7 @@ class FourNodeQuad: public SolidMech4N
     FourNodeQuad(int tag= 0,const NDMaterial *ptr_mat= nullptr);
     FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4, NDMaterial &m, const std::string &type, double t, double pressure = 0.0, const BodyForces2D &bForces= BodyForces2D());
     Element *getCopy(void) const;
+    bool allowsConcurrentStateDetermination(void) const;
     virtual ~FourNodeQuad(void);
 
     // Element birth and death stuff.
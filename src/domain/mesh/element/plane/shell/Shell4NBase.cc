@@ -80,9 +80,9 @@
 
 
 //static data
-XC::Matrix XC::Shell4NBase::stiff(24,24);
-XC::Vector XC::Shell4NBase::resid(24);
-XC::Matrix XC::Shell4NBase::mass(24,24);
+thread_local XC::Matrix XC::Shell4NBase::stiff(24,24);
+thread_local XC::Vector XC::Shell4NBase::resid(24);
+thread_local XC::Matrix XC::Shell4NBase::mass(24,24);
 
 //! @brief Releases memory.
 void XC::Shell4NBase::free_mem(void)
@@ -183,7 +183,7 @@ XC::ElementalLoad *XC::Shell4NBase::vector3dRawLoadLocal(const std::vector<Vecto
     if(preprocessor)
       {
         MapLoadPatterns &lPatterns= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= lPatterns.getCurrentElementLoadTag(); //Load identifier.
 
@@ -257,7 +257,7 @@ XC::ElementalLoad *XC::Shell4NBase::vector3dUniformLoadLocal(const Vector &v)
     if(preprocessor)
       {
         MapLoadPatterns &lPatterns= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= lPatterns.getCurrentElementLoadTag(); //Load identifier.
 
@@ -318,7 +318,7 @@ XC::ElementalLoad *XC::Shell4NBase::strainLoad(const Matrix &strains)
     if(preprocessor)
       {
         MapLoadPatterns &lPatterns= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        static thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= lPatterns.getCurrentElementLoadTag(); //Load identifier.
         LoadPattern *lp= lPatterns.getCurrentLoadPatternPtr();
@@ -518,7 +518,7 @@ const XC::Vector &XC::Shell4NBase::getResistingForce(void) const
 //! @brief get residual with inertia terms
 const XC::Vector &XC::Shell4NBase::getResistingForceIncInertia(void) const
   {
-    static Vector res(24);
+    static thread_local Vector res(24);
     res= getResistingForce();
 
     formInertiaTerms(0);
@@ -599,7 +599,7 @@ XC::Vector XC::Shell4NBase::getInterpolationFactors(const ParticlePos3d &pos) co
     static const int shpIndex= nShape-1;
 
     double xsj;  // determinant of the jacobian matrix
-    static double shp[nShape][numberOfNodes]; //storage for shape functions values.
+    static thread_local double shp[nShape][numberOfNodes]; //storage for shape functions values.
     Vector retval(numberOfNodes);
 
 
@@ -629,7 +629,7 @@ Pos3d XC::Shell4NBase::getCartesianCoordinates(const ParticlePos2d &p, bool init
     static const int nShape= 3;
     double xsj;  // determinant of the jacobian matrix
     double sx[2][2]; //inverse jacobian matrix.
-    static double shp[nShape][numberOfNodes];  //shape functions at point p
+    static thread_local double shp[nShape][numberOfNodes];  //shape functions at point p
     shape2d(p.r_coordinate(), p.s_coordinate(), xl, shp, xsj, sx);
     const double N1= shp[nShape-1][0];
     const double N2= shp[nShape-1][1];
@@ -726,8 +726,8 @@ void XC::Shell4NBase::formInertiaTerms( int tangFlag ) const
 
     double xsj;  // determinant of the jacobian matrix
     double dvol; //volume element
-    static double shp[nShape][numberOfNodes];  //shape functions at a gauss point
-    static Vector momentum(ndf);
+    static thread_local double shp[nShape][numberOfNodes];  //shape functions at a gauss point
+    static thread_local Vector momentum(ndf);
 
 
     double sx[2][2]; //inverse jacobian matrix.
@@ -814,7 +814,7 @@ void XC::Shell4NBase::shape2d(const double &ss, const double &tt,const double x[
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
 
-    static double xs[2][2]; // jacobian.
+    static thread_local double xs[2][2]; // jacobian.
 
     for(int i= 0; i < 4; i++ )
       {
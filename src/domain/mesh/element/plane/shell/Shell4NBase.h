@@ -65,10 +65,10 @@ class Shell4NBase: public QuadBase4N<SectionFDPhysicalProperties>
 
 
     //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
+    static thread_local Matrix damping;
 
     void formInertiaTerms(int tangFlag) const;
     virtual void formResidAndTangent(int tang_flag) const= 0;
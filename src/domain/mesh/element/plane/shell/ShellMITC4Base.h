@@ -46,7 +46,7 @@ class ShellMITC4Base: public Shell4NBase
     static const int nstress; //!< (8): three membrane, three moment, two shear
     mutable std::vector<Vector> strains; //!< strains at gauss points.
     std::vector<Vector> persistentInitialDeformation; //!< Persistent initial strain at element level. Used to store the deformation during the inactive phase of the element (if any).
-    static ShellBData BData; //!< B-bar data
+    static thread_local ShellBData BData; //!< B-bar data
 
 
     void formResidAndTangent(int tang_flag) const;
@@ -71,6 +71,7 @@ class ShellMITC4Base: public Shell4NBase
 
     int resetNodalCoordinates(void);
     void setDomain(Domain *theDomain);
+    bool allowsConcurrentStateDetermination(void) const;
   
     //return stiffness matrix 
     const Matrix &getInitialStiff(void) const;
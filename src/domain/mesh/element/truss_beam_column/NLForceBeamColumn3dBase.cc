@@ -36,9 +36,9 @@ const int XC::NLForceBeamColumn3dBase::NND= 6; //!< number of nodal dof's
 const size_t XC::NLForceBeamColumn3dBase::NEGD= 12; //!< number of element global dof's
 const size_t XC::NLForceBeamColumn3dBase::NEBD= 6; //!< number of element dof's in the basic system
 const double XC::NLForceBeamColumn3dBase::DefaultLoverGJ= 1.0e-10;
-XC::Matrix XC::NLForceBeamColumn3dBase::theMatrix(12,12);
-XC::Vector XC::NLForceBeamColumn3dBase::theVector(12);
-double XC::NLForceBeamColumn3dBase::workArea[200];
+thread_local XC::Matrix XC::NLForceBeamColumn3dBase::theMatrix(12,12);
+thread_local XC::Vector XC::NLForceBeamColumn3dBase::theVector(12);
+thread_local double XC::NLForceBeamColumn3dBase::workArea[200];
 
 //! @brief Allocate section flexibility matrices and section deformation vectors
 void XC::NLForceBeamColumn3dBase::resizeMatrices(const size_t &nSections)
@@ -100,7 +100,7 @@ const XC::Matrix &XC::NLForceBeamColumn3dBase::getTangentStiff(void) const
   {
     // Will remove once we clean up the corotational 3d transformation -- MHS
     theCoordTransf->update();
-    static Matrix K;
+    static thread_local Matrix K;
     K= theCoordTransf->getGlobalStiffMatrix(kv, Se);
     if(isDead())
       K*=dead_srf;
@@ -113,7 +113,7 @@ const XC::Vector &XC::NLForceBeamColumn3dBase::getResistingForce(void) const
     // Will remove once we clean up the corotational 3d transformation -- MHS
     theCoordTransf->update();
     Vector p0Vec= p0.getVector();
-    static Vector retval;
+    static thread_local Vector retval;
     retval= theCoordTransf->getGlobalResistingForce(Se, p0Vec);
     if(isDead())
       retval*=dead_srf;
@@ -235,7 +235,7 @@ double XC::ProtoBeam3d::getWeakAxisAngle(void) const
 //! @brief Compute the current strain.
 const XC::Vector &XC::ProtoBeam3d::computeCurrentStrain(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
 	      << "; not implemented yet."
               << Color::def << std::endl;
@@ -251,7 +251,7 @@ int XC::ProtoBeam3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Return the section generalized strain.
 const XC::Vector &XC::ProtoBeam3d::getSectionDeformation(void) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     retval= computeCurrentStrain();
     if(!persistentInitialDeformation.isEmpty()) // Have being inactive.
       retval-= persistentInitialDeformation;
@@ -70,9 +70,9 @@
 #include "utility/actor/actor/MovableVector.h"
 #include "domain/mesh/element/truss_beam_column/forceBeamColumn/beam_integration/BeamIntegration.h"
 
-XC::Matrix XC::DispBeamColumn3d::K(12,12);
-XC::Vector XC::DispBeamColumn3d::P(12);
-double XC::DispBeamColumn3d::workArea[200];
+thread_local XC::Matrix XC::DispBeamColumn3d::K(12,12);
+thread_local XC::Vector XC::DispBeamColumn3d::P(12);
+thread_local double XC::DispBeamColumn3d::workArea[200];
 
 void XC::DispBeamColumn3d::free_mem(void)
   {
@@ -148,6 +148,16 @@ XC::DispBeamColumn3d::~DispBeamColumn3d(void)
 XC::Element* XC::DispBeamColumn3d::getCopy(void) const
   { return new DispBeamColumn3d(*this); }
 
+//! @brief Return true if the coordinate transformation and the
+//! sections of the element allow concurrent state determination.
+bool XC::DispBeamColumn3d::allowsConcurrentStateDetermination(void) const
+  {
+    bool retval= false;
+    if(theCoordTransf)
+      retval= theCoordTransf->allowsConcurrentStateDetermination() && theSections.allowsConcurrentStateDetermination();
+    return retval;
+  }
+
 int XC::DispBeamColumn3d::getNumDOF(void) const
   { return 12; }
 
@@ -265,7 +275,7 @@ int XC::DispBeamColumn3d::update(void)
 
 const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
   {
-    static Matrix kb(6,6);
+    static thread_local Matrix kb(6,6);
 
     // Zero for integral
     kb.Zero();
@@ -398,7 +408,7 @@ const XC::Matrix &XC::DispBeamColumn3d::getTangentStiff(void) const
 
 const XC::Matrix &XC::DispBeamColumn3d::getInitialBasicStiff(void) const
   {
-    static XC::Matrix kb(6,6);
+    static thread_local XC::Matrix kb(6,6);
 
     // Zero for integral
     kb.Zero();
@@ -851,8 +861,8 @@ int XC::DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if(responseID == 4) {
-    static XC::Vector vp(6);
-    static XC::Vector ve(6);
+    static thread_local XC::Vector vp(6);
+    static thread_local XC::Vector ve(6);
     const XC::Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -1055,11 +1065,11 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 
     // Zero for integration
     q.Zero();
-    static XC::Vector qsens(3);
+    static thread_local XC::Vector qsens(3);
     qsens.Zero();
 
     // Some extra declarations
-    static XC::Matrix kbmine(3,3);
+    static thread_local XC::Matrix kbmine(3,3);
     kbmine.Zero();
 
     int j, k;
@@ -1067,7 +1077,7 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 
     // Check if a nodal coordinate is random
     bool randomNodeCoordinate = false;
-    static XC::ID nodeParameterID(2);
+    static thread_local XC::ID nodeParameterID(2);
     nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
     nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
     if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -1179,18 +1189,18 @@ const XC::Vector &XC::DispBeamColumn3d::getResistingForceSensitivity(int gradNum
 
     }
 
-    static XC::Vector dqdh(3);
+    static thread_local XC::Vector dqdh(3);
     const XC::Vector &dAdh_u = theCoordTransf->getBasicTrialDispShapeSensitivity();
     //dqdh = (1.0/L) * (kbmine * dAdh_u);
     dqdh.addMatrixVector(0.0, kbmine, dAdh_u, oneOverL);
 
-    static XC::Vector dkbdh_v(3);
+    static thread_local XC::Vector dkbdh_v(3);
     const XC::Vector &A_u = theCoordTransf->getBasicTrialDisp();
     //dkbdh_v = (d1oLdh) * (kbmine * A_u);
     dkbdh_v.addMatrixVector(0.0, kbmine, A_u, d1oLdh);
 
     // Transform forces
-    static XC::Vector dummy(3);                // No distributed loads
+    static thread_local XC::Vector dummy(3);                // No distributed loads
 
     // Term 5
     P = theCoordTransf->getGlobalResistingForce(qsens,dummy);
@@ -1217,7 +1227,7 @@ int XC::DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
     // Get basic deformation and sensitivities
         const Vector &v = theCoordTransf->getBasicTrialDisp();
 
-        static Vector vsens(3);
+        static thread_local Vector vsens(3);
         vsens = theCoordTransf->getBasicDisplSensitivity(gradNumber);
 
         double L = theCoordTransf->getInitialLength();
@@ -1230,7 +1240,7 @@ int XC::DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 
         // Check if a nodal coordinate is random
         bool randomNodeCoordinate = false;
-        static XC::ID nodeParameterID(2);
+        static thread_local XC::ID nodeParameterID(2);
         nodeParameterID(0) = theNodes[0]->getCrdsSensitivity();
         nodeParameterID(1) = theNodes[1]->getCrdsSensitivity();
         if(nodeParameterID(0) != 0 || nodeParameterID(1) != 0) {
@@ -90,11 +90,11 @@ class DispBeamColumn3d: public BeamColumnWithSectionFDTrf3d
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
     
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
 
-    static double workArea[];
+    static thread_local double workArea[];
 
   protected:
     int sendData(Communicator &comm);
@@ -108,6 +108,7 @@ class DispBeamColumn3d: public BeamColumnWithSectionFDTrf3d
     DispBeamColumn3d &operator=(const DispBeamColumn3d &);
     ~DispBeamColumn3d(void);
     Element *getCopy(void) const;
+    bool allowsConcurrentStateDetermination(void) const;
 
     int getNumDOF(void) const;
     void setDomain(Domain *theDomain);
@@ -74,9 +74,9 @@
 #include "material/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::ElasticBeam3d::K(12,12);
-XC::Vector XC::ElasticBeam3d::P(12);
-XC::Matrix XC::ElasticBeam3d::kb(6,6);
+thread_local XC::Matrix XC::ElasticBeam3d::K(12,12);
+thread_local XC::Vector XC::ElasticBeam3d::P(12);
+thread_local XC::Matrix XC::ElasticBeam3d::kb(6,6);
 
 //! @brief Default constructor.
 //! @param tag: element identifier.
@@ -147,11 +147,21 @@ XC::ElasticBeam3d::ElasticBeam3d(int tag, int Nd1, int Nd2, SectionForceDeformat
 XC::Element* XC::ElasticBeam3d::getCopy(void) const
   { return new ElasticBeam3d(*this); }
 
+//! @brief Return true if the coordinate transformation of the element
+//! allows concurrent state determination.
+bool XC::ElasticBeam3d::allowsConcurrentStateDetermination(void) const
+  {
+    bool retval= false;
+    if(theCoordTransf)
+      retval= theCoordTransf->allowsConcurrentStateDetermination();
+    return retval;
+  }
+
 
 //! @brief Compute the current strain.
 const XC::Vector &XC::ElasticBeam3d::computeCurrentStrain(void) const
   {
-    static Vector retval(5);
+    static thread_local Vector retval(5);
     theCoordTransf->update();
     const double L= theCoordTransf->getInitialLength();
     retval= theCoordTransf->getBasicTrialDisp()/L;
@@ -297,7 +307,7 @@ const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
     q.My1()+= q0[3];
     q.My2()+= q0[4];
 
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
@@ -364,7 +374,7 @@ const XC::Matrix &XC::ElasticBeam3d::getInitialStiff(void) const
         kb(3,3) = 3.0*Iy*EoverL;
       }   
     
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= theCoordTransf->getInitialGlobalStiffMatrix(kb);
     if(isDead())
       retval*=dead_srf;
@@ -699,9 +709,9 @@ void XC::ElasticBeam3d::Print(std::ostream &s, int flag) const
          }
        else if(flag == 2)
          {
-           static Vector xAxis(3);
-           static Vector yAxis(3);
-           static Vector zAxis(3);
+           static thread_local Vector xAxis(3);
+           static thread_local Vector yAxis(3);
+           static thread_local Vector zAxis(3);
 
            theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -85,10 +85,10 @@ class ElasticBeam3d: public ElasticBeam3dBase
     FVectorBeamColumn3d q0;  //!< Fixed end forces in basic system (no torsion)
     FVectorBeamColumn3d p0;  //!< Reactions in basic system (no torsion)
  
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     
-    static Matrix kb;
+    static thread_local Matrix kb;
 
   protected:
     DbTagData &getDbTagData(void) const;
@@ -101,6 +101,7 @@ class ElasticBeam3d: public ElasticBeam3dBase
 
     ElasticBeam3d(int tag, int Nd1, int Nd2, SectionForceDeformation *section, CrdTransf3d &theTransf, double rho = 0.0, int releasez= 0, int releasey= 0);
     Element *getCopy(void) const;
+    bool allowsConcurrentStateDetermination(void) const;
 
     const Vector &computeCurrentStrain(void) const;
     
@@ -227,7 +227,7 @@ const XC::Vector &XC::ElasticBeam3dBase::getVDirStrongAxisGlobalCoord(bool initi
         std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; coordinate transformation not defined."
                   << std::endl;
-	static Vector retval;
+	static thread_local Vector retval;
         return retval;
       }
   }
@@ -249,7 +249,7 @@ const XC::Vector &XC::ElasticBeam3dBase::getVDirWeakAxisGlobalCoord(bool initial
         std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; coordinate transformation not defined."
                   << std::endl;
-	static Vector retval;
+	static thread_local Vector retval;
         return retval;
       }
   }
@@ -148,6 +148,16 @@ XC::ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
 XC::Element* XC::ForceBeamColumn3d::getCopy(void) const
   { return new ForceBeamColumn3d(*this); }
 
+//! @brief Return true if the coordinate transformation and the
+//! sections of the element allow concurrent state determination.
+bool XC::ForceBeamColumn3d::allowsConcurrentStateDetermination(void) const
+  {
+    bool retval= false;
+    if(theCoordTransf)
+      retval= theCoordTransf->allowsConcurrentStateDetermination() && theSections.allowsConcurrentStateDetermination();
+    return retval;
+  }
+
 //! @brief Destructor.
 XC::ForceBeamColumn3d::~ForceBeamColumn3d(void)
   { free_mem(); }
@@ -175,7 +185,7 @@ const std::vector<XC::Vector> &XC::ForceBeamColumn3d::getPersistentInitialSectio
 //! (see for example ForceBeamColumn3d::alive()).
 void XC::ForceBeamColumn3d::incrementPersistentInitialDeformationWithCurrentDeformation(void)
   {
-    static Vector v(NEBD), dv(NEBD);
+    static thread_local Vector v(NEBD), dv(NEBD);
     this->getCurrentDisplacements(v, dv);
     if(persistentInitialDeformation.empty()) // Not yet initialized.
       {
@@ -327,17 +337,17 @@ const XC::Matrix &XC::ForceBeamColumn3d::getInitialStiff(void) const
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD,NEBD);   // element flexibility matrix
+        static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
         this->getInitialFlexibility(f);
 
-        static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+        static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
         I.Zero();
         for(size_t i=0; i<NEBD; i++)
           I(i,i) = 1.0;
 
         // calculate element stiffness matrix
         // invert3by3Matrix(f, kv);
-        static Matrix kvInit(NEBD, NEBD);
+        static thread_local Matrix kvInit(NEBD, NEBD);
         if(f.Solve(I, kvInit) < 0)
           std::cerr << getClassName() << "::" << __FUNCTION__
 		    << "; ERROR: could not invert flexibility\n";
@@ -373,7 +383,7 @@ int XC::ForceBeamColumn3d::update(void)
     if(initialFlag == 2)
       this->revertToLastCommit();
 
-    static Vector v(NEBD), dv(NEBD), vin(NEBD);
+    static thread_local Vector v(NEBD), dv(NEBD), vin(NEBD);
     this->getCurrentDisplacements(v, dv);
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp.isEmpty())
       {
@@ -394,10 +404,10 @@ int XC::ForceBeamColumn3d::update(void)
     double wt[SectionMatrices::maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                    // section strain energy (work) norm
 
     I.Zero();
@@ -406,16 +416,16 @@ int XC::ForceBeamColumn3d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static EsfBeamColumn3d SeTrial;
-    static Matrix kvTrial(NEBD, NEBD);
+    static thread_local Vector dSe(NEBD);
+    static thread_local Vector dvToDo(NEBD);
+    static thread_local Vector dvTrial(NEBD);
+    static thread_local EsfBeamColumn3d SeTrial;
+    static thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    static thread_local double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions= 10;
@@ -487,10 +497,10 @@ int XC::ForceBeamColumn3d::update(void)
                        const int order= theSections[i]->getOrder();
                        const ID &code= theSections[i]->getResponseType();
 
-                       static Vector Ss;
-                       static Vector dSs;
-                       static Vector dvs;
-                       static Matrix fb;
+                       static thread_local Vector Ss;
+                       static thread_local Vector dSs;
+                       static thread_local Vector dvs;
+                       static thread_local Matrix fb;
 
                        Ss.setData(workArea, order);
                        dSs.setData(&workArea[order], order);
@@ -1242,14 +1252,14 @@ int XC::ForceBeamColumn3d::getInitialFlexibility(Matrix &fe) const
 void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectionCoords,std::vector<Vector> &sectionDispls) const
   {
     // get basic displacements and increments
-    static Vector ub(NEBD);
+    static thread_local Vector ub(NEBD);
     ub = theCoordTransf->getBasicTrialDisp();
 
     const double L = theCoordTransf->getInitialLength();
 
     // get integration point positions and weights
     const size_t numSections= getNumSections();
-    static double pts[SectionMatrices::maxNumSections];
+    static thread_local double pts[SectionMatrices::maxNumSections];
     beamIntegr->getSectionLocations(numSections, L, pts);
 
     // setup Vandermode and CBDI influence matrices
@@ -1261,7 +1271,7 @@ void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectio
     // get section curvatures
     Vector kappa_y(numSections);  // curvature
     Vector kappa_z(numSections);  // curvature
-    static Vector vs; // section deformations
+    static thread_local Vector vs; // section deformations
 
     for(size_t i=0; i<numSections; i++)
       {
@@ -1297,8 +1307,8 @@ void XC::ForceBeamColumn3d::compSectionDisplacements(std::vector<Vector> &sectio
       }
 
     Vector v(numSections), w(numSections);
-    static Vector xl(NDM), uxb(NDM);
-    static Vector xg(NDM), uxg(NDM);
+    static thread_local Vector xl(NDM), uxb(NDM);
+    static thread_local Vector xg(NDM), uxg(NDM);
     // double theta;                             // angle of twist of the sections
 
     // v = ls * kappa_z;
@@ -1372,9 +1382,9 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag) const
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer
     else if(flag == 2)
       {
-        static XC::Vector xAxis(3);
-        static XC::Vector yAxis(3);
-        static XC::Vector zAxis(3);
+        static thread_local XC::Vector xAxis(3);
+        static thread_local XC::Vector yAxis(3);
+        static thread_local XC::Vector zAxis(3);
 
         theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1413,8 +1423,8 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag) const
           << T << ' ' << MY2 << ' '  <<  MZ2 << std::endl;
 
         // plastic hinge rotation
-        static XC::Vector vp(6);
-        static XC::Matrix fe(6,6);
+        static thread_local XC::Vector vp(6);
+        static thread_local XC::Matrix fe(6,6);
         this->getInitialFlexibility(fe);
         vp = theCoordTransf->getBasicTrialDisp();
         vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -1423,8 +1433,8 @@ void XC::ForceBeamColumn3d::Print(std::ostream &s, int flag) const
 
         // allocate array of vectors to store section coordinates and displacements
         const size_t numSections= getNumSections();
-	static std::vector<Vector> coords;
-	static std::vector<Vector> displs;
+	static thread_local std::vector<Vector> coords;
+	static thread_local std::vector<Vector> displs;
         coords.resize(numSections);
         displs.resize(numSections);
         for(size_t i= 0;i<numSections;i++)
@@ -1537,8 +1547,8 @@ XC::Response *XC::ForceBeamColumn3d::setResponse(const std::vector<std::string>
 
 int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
   {
-    static XC::Vector vp(6);
-    static XC::Matrix fe(6,6);
+    static thread_local XC::Vector vp(6);
+    static thread_local XC::Matrix fe(6,6);
 
     if(responseID == 1)
       return eleInfo.setVector(this->getResistingForce());
@@ -1593,7 +1603,7 @@ int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if(responseID == 5) {
-    static XC::Vector LI(2);
+    static thread_local XC::Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -1683,7 +1693,7 @@ int XC::ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static XC::Vector d(4);
+    static thread_local XC::Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -99,6 +99,7 @@ class ForceBeamColumn3d: public NLForceBeamColumn3dBase
 		    int maxNumIters = 10, double tolerance = 1.0e-12);
     ForceBeamColumn3d &operator=(const ForceBeamColumn3d &);
     Element *getCopy(void) const;
+    bool allowsConcurrentStateDetermination(void) const;
     virtual ~ForceBeamColumn3d(void);
   
   
@@ -83,7 +83,7 @@ void XC::BeamIntegration::getWeightsDeriv(int nIP, double L, double dLdh,double
 //! @brief Returns the weights (between 0 and 1).
 const XC::Vector &XC::BeamIntegration::getIntegrPointWeights(int numSections, double L) const
   {
-    static Vector retval;
+    static thread_local Vector retval;
     std::vector<double> wi(numSections);
     getSectionWeights(numSections,L,&wi[0]);
     retval= Vector(&wi[0],numSections);
@@ -115,7 +115,7 @@ boost::python::list XC::BeamIntegration::getSectionLocationsPy(int numSections,
 //! @brief Returns the normalized coordinates (entre 0 y 1).
 const XC::Matrix &XC::BeamIntegration::getIntegrPointCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     std::vector<double> xi(numSections);
     getSectionLocations(numSections,L,&xi[0]);
     retval= Matrix(&xi[0],numSections,1);
@@ -126,7 +126,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointCoords(int numSections, dou
 //! normalized ones.
 const XC::Matrix &XC::BeamIntegration::getIntegrPointNaturalCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getIntegrPointCoords(numSections,L); //normalized coordinates.
     for(int i = 0;i<numSections; i++)
       retval(i,1)= 2.0*retval(i,1) - 1.0;
@@ -137,7 +137,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointNaturalCoords(int numSectio
 //! normalized ones.
 const XC::Matrix &XC::BeamIntegration::getIntegrPointLocalCoords(int numSections, double L) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= getIntegrPointCoords(numSections,L); //normalized coordinates.
     for(int i = 0;i<numSections; i++)
       retval(i,1)*= L;
@@ -156,7 +156,7 @@ const XC::Matrix &XC::BeamIntegration::getIntegrPointNormalizedCoords(int nIP,co
 const XC::Matrix &XC::BeamIntegration::getIntegrPointLocalCoords(int nIP,const CrdTransf &trf) const
   {
     const Matrix tmp= getIntegrPointLocalCoords(nIP,trf.getInitialLength());
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval.resize(nIP,3);
     retval.Zero();
     for(int i= 0;i<nIP;i++)
@@ -113,6 +113,7 @@ class CrdTransf: public TaggedObject, public MovableObject
 
     virtual int initialize(Node *node1Pointer, Node *node2Pointer) = 0;
     virtual int update(void) = 0;
+    virtual bool allowsConcurrentStateDetermination(void) const;
     virtual double getInitialLength(void) const= 0;
     virtual double getDeformedLength(void) const= 0;
     double getLength(bool initialGeometry= true) const;
@@ -71,10 +71,10 @@
 #include "utility/actor/actor/MovableMatrix.h"
 #include "utility/matrices/giros.h"
 
-XC::Vector XC::CrdTransf3d::vectorI(3);
-XC::Vector XC::CrdTransf3d::vectorJ(3);
-XC::Vector XC::CrdTransf3d::vectorK(3);
-XC::Vector XC::CrdTransf3d::vectorCoo(3);
+thread_local XC::Vector XC::CrdTransf3d::vectorI(3);
+thread_local XC::Vector XC::CrdTransf3d::vectorJ(3);
+thread_local XC::Vector XC::CrdTransf3d::vectorK(3);
+thread_local XC::Vector XC::CrdTransf3d::vectorCoo(3);
 
 //! @brief Set the vector that defines the local XZ plane.
 void XC::CrdTransf3d::set_xz_vector(const XC::Vector &vecInLocXZPlane)
@@ -271,9 +271,9 @@ int XC::CrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     if((error = this->computeElemtLengthAndOrient()))
       return error;
 
-    static Vector XAxis(3);
-    static Vector YAxis(3);
-    static Vector ZAxis(3);
+    static thread_local Vector XAxis(3);
+    static thread_local Vector YAxis(3);
+    static thread_local Vector ZAxis(3);
 
     // get 3by3 rotation matrix
     if((error = this->getLocalAxes(XAxis, YAxis, ZAxis)))
@@ -375,7 +375,7 @@ XC::Vector XC::CrdTransf3d::getPointLocalCoordFromGlobal(const Vector &xg) const
 //! @brief Returns the point expresado en global coordinates.
 const XC::Vector &XC::CrdTransf3d::getPointGlobalCoordFromBasic(const double &xi) const
   {
-    static Vector local_coord(3),global_coord(3);
+    static thread_local Vector local_coord(3),global_coord(3);
     local_coord.Zero();
     local_coord[0]= xi*getDeformedLength();
     global_coord= getPointGlobalCoordFromLocal(local_coord);
@@ -385,7 +385,7 @@ const XC::Vector &XC::CrdTransf3d::getPointGlobalCoordFromBasic(const double &xi
 //! @brief Returns the points expressed in global coordinates.
 const XC::Matrix &XC::CrdTransf3d::getPointsGlobalCoordFromBasic(const Vector &basicCoords) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= basicCoords.Size(); //Number of points to transform.
     retval.resize(numPts,3);
     Vector xg(3);
@@ -415,7 +415,7 @@ const XC::Vector &XC::CrdTransf3d::getVectorGlobalCoordFromLocal(const Vector &l
 const XC::Matrix &XC::CrdTransf3d::getVectorGlobalCoordFromLocal(const Matrix &localCoords) const
   {
     computeLocalAxis(); //Actualiza la matrix R.
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of vectors to transform
     retval.resize(numPts,3);
     for(size_t i= 0;i<numPts;i++)
@@ -441,7 +441,7 @@ const XC::Vector &XC::CrdTransf3d::getVectorLocalCoordFromGlobal(const Vector &g
 //! @brief Returns the coordinates of the nodes.
 const XC::Matrix &XC::CrdTransf3d::getCooNodes(void) const
   {
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= Matrix(2,3);
 
     retval(0,0)= nodeIPtr->getCrds()[0];
@@ -461,7 +461,7 @@ const XC::Matrix &XC::CrdTransf3d::getCooPoints(const size_t &ndiv) const
     const Pos3d p0= nodeIPtr->getInitialPosition3d();
     const Pos3d p1= nodeJPtr->getInitialPosition3d();
     Pos3dArray linea(p0,p1,ndiv);
-    static Matrix retval;
+    static thread_local Matrix retval;
     retval= Matrix(ndiv+1,3);
     Pos3d tmp;
     for(size_t i= 0;i<ndiv+1;i++)
@@ -480,7 +480,7 @@ const XC::Vector &XC::CrdTransf3d::getCooPoint(const double &xrel) const
     const Pos3d p0= nodeIPtr->getInitialPosition3d();
     const Pos3d p1= nodeJPtr->getInitialPosition3d();
     const Vector3d v= p1-p0;
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     const Pos3d tmp= p0+xrel*v;
     retval(0)= tmp.x();
     retval(1)= tmp.y();
@@ -113,7 +113,7 @@ int XC::PDeltaCrdTransf3d::update(void)
     const XC::Vector &disp1 = nodeIPtr->getTrialDisp();
     const XC::Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    static thread_local double ug[12];
     inic_ug(disp1,disp2,ug);
     modif_ug_init_disp(ug);
 
@@ -126,7 +126,7 @@ int XC::PDeltaCrdTransf3d::update(void)
     ul7 = R(1,0)*ug[6] + R(1,1)*ug[7] + R(1,2)*ug[8];
     ul8 = R(2,0)*ug[6] + R(2,1)*ug[7] + R(2,2)*ug[8];
     
-    static double Wu[3];
+    static thread_local double Wu[3];
     
     Wu[0] =  nodeIOffset(2)*ug[4] - nodeIOffset(1)*ug[5];
     Wu[1] = -nodeIOffset(2)*ug[3] + nodeIOffset(0)*ug[5];
@@ -244,7 +244,7 @@ int XC::PDeltaCrdTransf3d::recvSelf(const Communicator &comm)
 
 const XC::Vector &XC::PDeltaCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl) const
   {
-    static Vector xg(3);
+    static thread_local Vector xg(3);
     
     //xg = nodeIPtr->getCrds() + nodeIOffset;
     xg= nodeIPtr->getCrds();
@@ -269,14 +269,14 @@ const XC::Vector &XC::PDeltaCrdTransf3d::getPointGlobalDisplFromBasic (double xi
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[12];
+    static thread_local double ug[12];
     inic_ug(disp1,disp2,ug);
     modif_ug_init_disp(ug);
 
     
     // transform global end displacements to local coordinates
     //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-    static double ul[12];
+    static thread_local double ul[12];
     
     ul[0]  = R(0,0)*ug[0] + R(0,1)*ug[1] + R(0,2)*ug[2];
     ul[1]  = R(1,0)*ug[0] + R(1,1)*ug[1] + R(1,2)*ug[2];
@@ -285,7 +285,7 @@ const XC::Vector &XC::PDeltaCrdTransf3d::getPointGlobalDisplFromBasic (double xi
     ul[7]  = R(1,0)*ug[6] + R(1,1)*ug[7] + R(1,2)*ug[8];
     ul[8]  = R(2,0)*ug[6] + R(2,1)*ug[7] + R(2,2)*ug[8];
     
-    static double Wu[3];
+    static thread_local double Wu[3];
     Wu[0] =  nodeIOffset(2)*ug[4] - nodeIOffset(1)*ug[5];
     Wu[1] = -nodeIOffset(2)*ug[3] + nodeIOffset(0)*ug[5];
     Wu[2] =  nodeIOffset(1)*ug[3] - nodeIOffset(0)*ug[4];
@@ -302,8 +302,8 @@ const XC::Vector &XC::PDeltaCrdTransf3d::getPointGlobalDisplFromBasic (double xi
     ul[8] += R(2,0)*Wu[0] + R(2,1)*Wu[1] + R(2,2)*Wu[2];
     
     // compute displacements at point xi, in local coordinates
-    static double uxl[3];
-    static XC::Vector uxg(3);
+    static thread_local double uxl[3];
+    static thread_local XC::Vector uxg(3);
     
     uxl[0] = uxb(0) +        ul[0];
     uxl[1] = uxb(1) + (1-xi)*ul[1] + xi*ul[7];
@@ -103,6 +103,12 @@ int XC::ShellCrdTransf3dBase::initialize(const NodePtrs &ptrs)
     return 0;
   }
 
+//! @brief Return true if the transformation can be updated and used
+//! at the same time that other transformations (in other threads), that
+//! is, if it doesn't write on class-wide work areas.
+bool XC::ShellCrdTransf3dBase::allowsConcurrentStateDetermination(void) const
+  { return false; }
+
 //! @brief Update local coordinates of the nodes.
 int XC::ShellCrdTransf3dBase::setup_nodal_local_coordinates(void) const
   {
@@ -258,7 +264,7 @@ XC::Vector XC::ShellCrdTransf3dBase::local_to_global(const Vector &pl) const
 //! @brief Returns the matrix in global coordinates.
 XC::Matrix XC::ShellCrdTransf3dBase::local_to_global(const Matrix &kl) const
   {
-    static Matrix tmp(24,24);
+    static thread_local Matrix tmp(24,24);
     const Matrix &R= getTrfMatrix();
 
     // Transform local matrix to global system
@@ -341,7 +347,7 @@ XC::Matrix XC::ShellCrdTransf3dBase::local_to_global(const Matrix &kl) const
 const XC::Vector &XC::ShellCrdTransf3dBase::local_to_global_resisting_force(const Vector &pl) const
   {
     // transform resisting forces  from local to global coordinates
-    static Vector pg(24);
+    static thread_local Vector pg(24);
     pg= local_to_global(pl);
     return pg;
   }
@@ -349,7 +355,7 @@ const XC::Vector &XC::ShellCrdTransf3dBase::local_to_global_resisting_force(cons
 //! @brief Returns the stiffness matrix in global coordinates.
 const XC::Matrix &XC::ShellCrdTransf3dBase::local_to_global_stiff_matrix(const Matrix &kl) const
   {
-    static Matrix kg(24,24);
+    static thread_local Matrix kg(24,24);
 
     kg= local_to_global(kl);
     return kg;
@@ -375,7 +381,7 @@ void XC::ShellCrdTransf3dBase::getGlobalResidAndTangent(Vector &resid,Matrix &st
 const XC::Vector &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const Vector &localCoords) const
   {
     const Matrix &R= getTrfMatrix();
-    static Vector retval(3);
+    static thread_local Vector retval(3);
     // retval = Rlj'*localCoords (Multiplica el vector por R traspuesta).
     retval(0)= R(0,0)*localCoords(0) + R(1,0)*localCoords(1) + R(2,0)*localCoords(2);
     retval(1)= R(0,1)*localCoords(0) + R(1,1)*localCoords(1) + R(2,1)*localCoords(2);
@@ -387,7 +393,7 @@ const XC::Vector &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const
 const XC::Matrix &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const Matrix &localCoords) const
   {
     const Matrix &R= getTrfMatrix();
-    static Matrix retval;
+    static thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of vectors to transform
     retval.resize(numPts,3);
     for(size_t i= 0;i<numPts;i++)
@@ -403,7 +409,7 @@ const XC::Matrix &XC::ShellCrdTransf3dBase::getVectorGlobalCoordFromLocal(const
 //! @brief Returns the vector expresado en local coordinates.
 const XC::Vector &XC::ShellCrdTransf3dBase::getVectorLocalCoordFromGlobal(const Vector &globalCoords) const
   {
-    static Vector vectorCoo(3);
+    static thread_local Vector vectorCoo(3);
     const Matrix &R= getTrfMatrix();
     vectorCoo[0]= R(0,0)*globalCoords[0] + R(0,1)*globalCoords[1] + R(0,2)*globalCoords[2];
     vectorCoo[1]= R(1,0)*globalCoords[0] + R(1,1)*globalCoords[1] + R(1,2)*globalCoords[2];
@@ -97,6 +97,7 @@ class ShellCrdTransf3dBase: public CommandEntity, public MovableObject
     virtual int initialize(const NodePtrs &)= 0;
     virtual int setup_nodal_local_coordinates(void) const;
     virtual int update(void)= 0;
+    virtual bool allowsConcurrentStateDetermination(void) const;
 
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
@@ -73,10 +73,10 @@ int XC::ShellLinearCrdTransf3d::initialize(const NodePtrs &ptrs)
     const Vector &coor2= (*theNodes)[2]->getCrds();
     const Vector &coor3= (*theNodes)[3]->getCrds();
 
-    static Vector temp(3);
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
+    static thread_local Vector temp(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
     
     v1.Zero( );
     //v1= 0.5 * ( coor2 + coor1 - coor3 - coor0 );
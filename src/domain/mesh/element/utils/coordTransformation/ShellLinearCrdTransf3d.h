@@ -49,6 +49,9 @@ class ShellLinearCrdTransf3d: public ShellCrdTransf3dBase
 
     virtual int initialize(const NodePtrs &);
     virtual int update(void);
+    //! @brief Work areas are per-thread.
+    bool allowsConcurrentStateDetermination(void) const
+      { return true; }
 
     virtual int commitState(void);
     virtual int revertToLastCommit(void);        
@@ -54,6 +54,9 @@ class SmallDispCrdTransf3d: public CrdTransf3d
 
     double getInitialLength(void) const;
     double getDeformedLength(void) const;
+    //! @brief Work areas are per-thread.
+    bool allowsConcurrentStateDetermination(void) const
+      { return true; }
 
     const Vector &getBasicTrialDisp(void) const;
     const Vector &getBasicIncrDisp(void) const;
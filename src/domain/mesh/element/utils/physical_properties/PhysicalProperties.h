@@ -73,6 +73,10 @@ class PhysicalProperties: public CommandEntity, public MovableObject
 
     inline size_t size(void) const
       { return theMaterial.size(); } 
+    //! @brief Return true if all the materials allow concurrent
+    //! state determination.
+    inline bool allowsConcurrentStateDetermination(void) const
+      { return theMaterial.allowsConcurrentStateDetermination(); }
     inline material_vector &getMaterialsVector(void)
       { return theMaterial; }
     inline const material_vector &getMaterialsVector(void) const
@@ -57,6 +57,7 @@
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 #include <domain/domain/Domain.h>
 #include <cstring>
 #include <domain/mesh/element/utils/Information.h>
@@ -97,21 +98,10 @@ namespace XC{
 } //namespace XC
 
 
-//! @brief Constructor
-XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
-                               int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
-                               int node_numb_5,  int node_numb_6,  int node_numb_7,  int node_numb_8,
-                               int node_numb_9,  int node_numb_10, int node_numb_11, int node_numb_12,
-                               int node_numb_13, int node_numb_14, int node_numb_15, int node_numb_16,
-                               int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
-                               NDMaterial *Globalmmodel, const BodyForces3D &bForces,
-                               double r, double p)
-
-  :ElementBase<20>(element_number, ELE_TAG_TwentyNodeBrick ),
-  Ki(0), bf(bForces), rho(r), pressure(p)
+//! @brief Create the material points (one copy of the material for each
+//! Gauss point).
+void XC::TwentyNodeBrick::set_material_points(const NDMaterial *Globalmmodel)
   {
-    load.reset(60);
-    //elem_numb = element_number;
     determinant_of_Jacobian = 0.0;
 
     //r_integration_order = r_int_order;
@@ -124,17 +114,11 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
     //Not needed. Right now we have one XC::NDMaterial for each material point
     //mmodel = Globalmmodel->getCopy( type ); // One global mat model
 
-    int total_number_of_Gauss_points = r_integration_order*s_integration_order*t_integration_order;
+    const int total_number_of_Gauss_points= r_integration_order*s_integration_order*t_integration_order;
 
 
     if( total_number_of_Gauss_points != 0 )
-      {
-        matpoint  = new MatPoint3D * [total_number_of_Gauss_points];
-      }
-    else
-      {
-        matpoint  = 0;
-      }
+      matpoint= std::vector<MatPoint3D>(total_number_of_Gauss_points);
     ////////////////////////////////////////////////////////////////////
     short where = 0;
 
@@ -173,7 +157,7 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
                 //DB                                                               // for XC::NDMaterial and
                 //DB                                                               // derived types!
 
-                matpoint[where] = new MatPoint3D(GP_c_r,
+                matpoint[where] = MatPoint3D(GP_c_r,
                                                  GP_c_s,
                                                  GP_c_t,
                                                  r, s, t,
@@ -187,18 +171,44 @@ XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
               }
           }
       }
+  }
+
+//! @brief Constructor
+XC::TwentyNodeBrick::TwentyNodeBrick(int element_number,
+                               int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
+                               int node_numb_5,  int node_numb_6,  int node_numb_7,  int node_numb_8,
+                               int node_numb_9,  int node_numb_10, int node_numb_11, int node_numb_12,
+                               int node_numb_13, int node_numb_14, int node_numb_15, int node_numb_16,
+                               int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
+                               NDMaterial *Globalmmodel, const BodyForces3D &bForces,
+                               double r, double p)
+
+  :ElementBase<20>(element_number, ELE_TAG_TwentyNodeBrick ),
+  Ki(0), bf(bForces), rho(r), pressure(p)
+  {
+    load.reset(60);
+    set_material_points(Globalmmodel);
 
       // Set connected external node IDs
     theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8,node_numb_9,node_numb_10,node_numb_11,node_numb_12,node_numb_13,node_numb_14,node_numb_15,node_numb_16,node_numb_17,node_numb_18,node_numb_19,node_numb_20);
 
   }
 
+//! @brief Constructor (the nodes are set afterwards), used by the
+//! element handler. The density is the one of the material.
+XC::TwentyNodeBrick::TwentyNodeBrick(int tag, const NDMaterial *ptr_mat)
+  :ElementBase<20>(tag, ELE_TAG_TwentyNodeBrick),
+  Ki(0), bf(3), rho(ptr_mat->getRho()), pressure(0.0), mmodel(nullptr)
+  {
+    load.reset(60);
+    set_material_points(ptr_mat);
+  }
+
 //====================================================================
 XC::TwentyNodeBrick::TwentyNodeBrick ():ElementBase<20>(0, ELE_TAG_TwentyNodeBrick ),
 Ki(0), bf(), rho(0.0), pressure(0.0), mmodel(0)
   {
     load.reset(60);
-    matpoint = 0;
   }
 
 
@@ -212,25 +222,10 @@ XC::Element* XC::TwentyNodeBrick::getCopy(void) const
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
 XC::TwentyNodeBrick::~TwentyNodeBrick ()
-{
-
-    int total_number_of_Gauss_points = r_integration_order*s_integration_order*t_integration_order;
-
-    for(int i = 0; i < total_number_of_Gauss_points; i++)
-    {
- // Delete the NDMaterials at each integration point
- if(matpoint[i])
-    delete matpoint[i];
-    }
-
-    // Delete the array of pointers to XC::NDMaterial pointer arrays
-    if(matpoint)
-     delete [] matpoint;
-
+  {
     if(Ki != 0)
       delete Ki;
-
-}
+  }
 
 /////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////
@@ -316,7 +311,7 @@ void XC::TwentyNodeBrick::incremental_Update()
                 // from the iterative data . . .
                 //(GPstress+where)->reportshortpqtheta("\n stress START GAUSS \n");
 
-  if( ! ( (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)) )
+  if( ! ( (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)) )
     std::cerr << "XC::TwentyNodeBrick::incremental_Update (tag: " << this->getTag() << "), not converged\n";
   //matpoint[where].setEPS( mmodel->getEPS() );
             }
@@ -509,9 +504,15 @@ void XC::TwentyNodeBrick::incremental_Update()
 
  XC::BJtensor XC::TwentyNodeBrick::dh_drst_at(double r1, double r2, double r3)
   {
+    FixedTensor<20,3> dh;
+    dh_drst_at(r1, r2, r3, dh);
+    return dh.getBJtensor();
+  }
 
-    const std::vector<int> dimensions({20,3});  // Changed from{20,3} to {8,3} Xiaoyan 07/12
-    BJtensor dh(dimensions, 0.0);
+//! @brief Compute the derivatives of the shape functions with respect
+//! to the natural coordinates at the point (r1, r2, r3).
+void XC::TwentyNodeBrick::dh_drst_at(double r1, double r2, double r3, FixedTensor<20,3> &dh)
+  {
 
 
     // influence of the node number 20
@@ -600,7 +601,6 @@ void XC::TwentyNodeBrick::incremental_Update()
     dh(1,2)= (1.0+r1)*(1.0+r3)*0.125 - (dh(12,2)+dh(17,2)+dh( 9,2))*0.50; ///2.0;
     dh(1,3)= (1.0+r1)*(1.0+r2)*0.125 - (dh(12,3)+dh(17,3)+dh( 9,3))*0.50; ///2.0;
 
-    return dh;
   }
 
 
@@ -628,199 +628,49 @@ void XC::TwentyNodeBrick::incremental_Update()
 ////#############################################################################
  XC::BJtensor XC::TwentyNodeBrick::getStiffnessTensor(void) const
   {
-    const std::vector<int> K_dim({20,3,3,20});
-    BJtensor Kk(K_dim,0.0);
-    BJtensor Kkt(K_dim,0.0);
-
-//debugging
-//    matrix Kmat;
-
-    double r  = 0.0;
-    double rw = 0.0;
-    double s  = 0.0;
-    double sw = 0.0;
-    double t  = 0.0;
-    double tw = 0.0;
-
-    short where = 0;
-    double weight = 0.0;
-
-    const std::vector<int> dh_dim({20,3});
-    BJtensor dh(dh_dim, 0.0);
-
-    //    BJtensor Constitutive( def_dim_4, 0.0);
-    BJtensor Constitutive;
-
-    double det_of_Jacobian = 0.0;
-
-    static const std::vector<int> disp_dim({20,3});
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    straintensor incremental_strain;
-//    straintensor total_strain_at_GP;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor JacobianINVtemp;
-    BJtensor dhGlobal;
+    FixedTensor<20,3,3,20> Kk;
+    compute_stiffness(Kk);
+    return Kk.getBJtensor();
+  }
 
+//! @brief Compute the stiffness tensor of the element.
+//!
+//! The Gauss point loop works with stack allocated tensors (see
+//! FixedTensor) to avoid the memory allocations and the parsing
+//! of the index strings of the BJtensor products.
+void XC::TwentyNodeBrick::compute_stiffness(FixedTensor<20,3,3,20> &Kk) const
+  {
+    Kk.Zero();
+    FixedTensor<20,3> N_C;
+    Nodal_Coordinates(N_C);
+    FixedTensor<20,3> dh;
+    FixedTensor<20,3> dhGlobal;
     for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
         for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
             for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                // position of the Gauss point in the matpoint array.
+                const short where =
                    ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordinates with respect to local coordinates
-                dh = dh_drst_at(r,s,t);
-  //dh.print("dh");
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //JacobianINVtemp = Jacobian.inverse();
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian  = Jacobian.determinant();
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                ////////!!!!!!! dhGlobal = dh("ij") * JacobianINV("jk");  //big bug found here Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-                //        ::fprintf(stdout," # %d \n\n\n\n\n\n\n\n", El_count);
-                //dhGlobal.print("dhGlobal");
-                //weight
-                weight = rw * sw * tw * det_of_Jacobian;
-                //::::
-                //printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where = %d \n", where);
-                //printf("  Stifness_Tensor \n");
-                //printf("                    GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d\n",
-                //                            GP_c_r,GP_c_s,GP_c_t);
-                //printf("WEIGHT = %f", weight);
-                //Jacobian.print("J");
-                //JacobianINV.print("JINV");
-                //JacobianINVtemp.print("JINVtemp");
-                //BJtensor I = JacobianINV("ij")*Jacobian("jk");
-                //I.print("I");
-
-                //printf("determinant of Jacobian = %.6e", det_of_Jacobian);
-                //matpoint[where].report("Gauss Point\n");
-
-                // incremental strains at this Gauss point
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor1\n");
-
-  //09-02-2001 Zhaohui
-  //              incremental_strain =
-                //     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-
-  //incremental_strain.null_indices();
-                //incremental_strain.report("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-                // incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor2\n");
-                // initialize total strain with the strain at this Gauss point before
-                // adding this increments strains!
-                //                total_strain_at_GP.Initialize(*(GPstrain+where));
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point BEFORE\n");
-                // this is the addition of incremental strains to the previous strain state at
-                // this Gauss point
-                //                total_strain_at_GP = total_strain_at_GP + incremental_strain;
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point AFTER\n");
-                //..   dakle ovde posalji strain_increment jer se stari stress cuva u okviru svake
-                //..   Gauss tacke a samo saljes strain_increment koji ce da se prenese
-                //..   u integracionu rutinu pa ce ta da vrati krajnji napon i onda moze da
-                //..   se pravi ConstitutiveStiffnessTensor.
-                // here comes the final_stress calculation
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point.
-
-                //final_stress_after_integration =
-                //    (matpoint)->operator[](where).FinalStress(*(GPstress+where),
-                //                                 incremental_strain,
-                //                                 (matpoint)->operator[](where),
-                //                                 number_of_subincrements,
-                //                                 this_one_PP);
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration in stiffness_tensor5\n");
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor3\n");
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration GAUSS \n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor4\n");
-
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point AND to set up the iterative_stress that is used in calculting
-                // internal forces during iterations!!
-
-                //GPiterative_stress[where].Initialize(final_stress_after_integration);
-                //GPiterative_stress[where].reportshortpqtheta("\n iterative_stress at GAUSS point in stiffness_tensor5\n");
-
-
-                // Stress state at Gauss point will be updated ( in the
-                // sense of updating stresses ( integrating them ) ) in function Update (...) ! ! ! ! !
-                // calculate the constitutive XC::BJtensor
-                //......         Constitutive =  GPtangent_E[where];
-
-  //Constitutive =  (matpoint)->operator[](where).ConstitutiveTensor(final_stress_after_integration,
-                //                                         *(GPstress+where),
-                //                                          incremental_strain,
-                //                                          (matpoint)->operator[](where),
-                //                                          this_one_PP);
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-         //EPState *tmp_eps = (matpoint[where]).getEPS();
-         //NDMaterial *tmp_ndm = (matpoint[where]).getNDMat();
-
-                Constitutive = (matpoint[where]->matmodel)->getTangentTensor();
-//                Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-  //    matpoint[where].setEPS( mmodel->getEPS() );
-  //}
-  //else if( tmp_ndm ) { //Elastic case
-  //    (matpoint[where].p_matmodel)->setTrialStrainIncr( incremental_strain );
-  //    Constitutive = (matpoint[where].p_matmodel)->getTangentTensor();
-  //}
-  //else {
-                //   std::cerr << "XC::TwentyNodeBrick::incremental_Update (tag: %d), could not getTangentTensor", this->getTag();
-  //   exit(1);
-  //}
-
-  //printf("Constitutive.trace = %12.6e\n", Constitutive.trace());
-                //Kmat = this->stiffness_matrix(Constitutive);
-                //printf("Constitutive XC::BJtensor max:= %10.3e\n", Kmat.mmax());
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor5\n");
-                // this is update of constitutive XC::BJtensor at this Gauss point
-                //GPtangent_E[where].Initialize(Constitutive);
-                //....GPtangent_E[where].print(" tangent E at GAUSS point");
-
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor6\n");
-
-                //K = K + temp2;
-
-                Kkt = dhGlobal("ib")*Constitutive("abcd");
-                Kk = Kk + Kkt("aicd")*dhGlobal("jd")*weight;
-
-  //Kk = Kk + dhGlobal("ib")*Constitutive("abcd")*dhGlobal("jd")*weight;
-                //....K.print("K","\n\n K XC::BJtensor \n");
-
-  //Kmat = this->stiffness_matrix(Kk);
-                //printf("K XC::BJtensor max= %10.3e\n", Kmat.mmax());
-
-                //convert constitutive and K to matrix and find min and max and print!
-
-
-
+                // derivatives of the shape functions with respect to the
+                // local and to the global coordinates.
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian= global_shape_derivatives(dh, N_C, dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                const FixedTensor4 Constitutive((matpoint[where].matmodel)->getTangentTensor());
+                // Kk_nklm+= dhGlobal_nb*C_kbld*dhGlobal_md*weight
+                add_stiffness_contribution(Kk, dhGlobal, Constitutive, weight);
               }
           }
       }
-//    Kk.print("K","\n\n K XC::BJtensor \n");
-    //K = Kk;
-    return Kk;
   }
 
 
@@ -898,7 +748,7 @@ void XC::TwentyNodeBrick::set_strain_stress_tensor(FILE *fp, double * u)
                 //Constitutive =  GPtangent_E[where];
                 //Constitutive =  (matpoint->getEPS() )->getEep();
                 // if set total displ, then it should be elstic material
-                Constitutive =  ( matpoint[where]->matmodel)->getTangentTensor();
+                Constitutive =  ( matpoint[where].matmodel)->getTangentTensor();
 
                 stress = Constitutive("ijkl") * strain("kl");
                 stress.null_indices();
@@ -1089,61 +939,22 @@ XC::BJtensor XC::TwentyNodeBrick::Jacobian_3Dinv(const BJtensor &dh) const
 ////#############################################################################
 XC::BJtensor XC::TwentyNodeBrick::Nodal_Coordinates(void) const
   {
-    const std::vector<int> dimensions({20,3});
-    BJtensor N_coord(dimensions, 0.0);
+    FixedTensor<20,3> N_coord;
+    Nodal_Coordinates(N_coord);
+    return N_coord.getBJtensor();
+  }
 
+//! @brief Return the coordinates of the nodes (one row per node).
+void XC::TwentyNodeBrick::Nodal_Coordinates(FixedTensor<20,3> &N_coord) const
+  {
     //Zhaohui using node pointers, which come from the XC::Domain
-    const Vector &nd1Crds = theNodes[0]->getCrds();
-    const Vector &nd2Crds = theNodes[1]->getCrds();
-    const Vector &nd3Crds = theNodes[2]->getCrds();
-    const Vector &nd4Crds = theNodes[3]->getCrds();
-    const Vector &nd5Crds = theNodes[4]->getCrds();
-    const Vector &nd6Crds = theNodes[5]->getCrds();
-    const Vector &nd7Crds = theNodes[6]->getCrds();
-    const Vector &nd8Crds = theNodes[7]->getCrds();
-
-    const Vector &nd9Crds  =  theNodes[8]->getCrds();
-    const Vector &nd10Crds = theNodes[9]->getCrds();
-    const Vector &nd11Crds = theNodes[10]->getCrds();
-    const Vector &nd12Crds = theNodes[11]->getCrds();
-
-    const Vector &nd13Crds = theNodes[12]->getCrds();
-    const Vector &nd14Crds = theNodes[13]->getCrds();
-    const Vector &nd15Crds = theNodes[14]->getCrds();
-    const Vector &nd16Crds = theNodes[15]->getCrds();
-
-
-    const Vector &nd17Crds = theNodes[16]->getCrds();
-    const Vector &nd18Crds = theNodes[17]->getCrds();
-    const Vector &nd19Crds = theNodes[18]->getCrds();
-    const Vector &nd20Crds = theNodes[19]->getCrds();
-
-    N_coord(1,1)=nd1Crds(0); N_coord(1,2)=nd1Crds(1); N_coord(1,3)=nd1Crds(2);
-    N_coord(2,1)=nd2Crds(0); N_coord(2,2)=nd2Crds(1); N_coord(2,3)=nd2Crds(2);
-    N_coord(3,1)=nd3Crds(0); N_coord(3,2)=nd3Crds(1); N_coord(3,3)=nd3Crds(2);
-    N_coord(4,1)=nd4Crds(0); N_coord(4,2)=nd4Crds(1); N_coord(4,3)=nd4Crds(2);
-    N_coord(5,1)=nd5Crds(0); N_coord(5,2)=nd5Crds(1); N_coord(5,3)=nd5Crds(2);
-    N_coord(6,1)=nd6Crds(0); N_coord(6,2)=nd6Crds(1); N_coord(6,3)=nd6Crds(2);
-    N_coord(7,1)=nd7Crds(0); N_coord(7,2)=nd7Crds(1); N_coord(7,3)=nd7Crds(2);
-    N_coord(8,1)=nd8Crds(0); N_coord(8,2)=nd8Crds(1); N_coord(8,3)=nd8Crds(2);
-
-    N_coord(9 ,1)=nd9Crds(0);  N_coord(9 ,2)=nd9Crds(1);  N_coord(9 ,3)=nd9Crds(2);
-    N_coord(10,1)=nd10Crds(0); N_coord(10,2)=nd10Crds(1); N_coord(10,3)=nd10Crds(2);
-    N_coord(11,1)=nd11Crds(0); N_coord(11,2)=nd11Crds(1); N_coord(11,3)=nd11Crds(2);
-    N_coord(12,1)=nd12Crds(0); N_coord(12,2)=nd12Crds(1); N_coord(12,3)=nd12Crds(2);
-
-    N_coord(13,1)=nd13Crds(0); N_coord(13,2)=nd13Crds(1); N_coord(13,3)=nd13Crds(2);
-    N_coord(14,1)=nd14Crds(0); N_coord(14,2)=nd14Crds(1); N_coord(14,3)=nd14Crds(2);
-    N_coord(15,1)=nd15Crds(0); N_coord(15,2)=nd15Crds(1); N_coord(15,3)=nd15Crds(2);
-    N_coord(16,1)=nd16Crds(0); N_coord(16,2)=nd16Crds(1); N_coord(16,3)=nd16Crds(2);
-
-    N_coord(17,1)=nd17Crds(0); N_coord(17,2)=nd17Crds(1); N_coord(17,3)=nd17Crds(2);
-    N_coord(18,1)=nd18Crds(0); N_coord(18,2)=nd18Crds(1); N_coord(18,3)=nd18Crds(2);
-    N_coord(19,1)=nd19Crds(0); N_coord(19,2)=nd19Crds(1); N_coord(19,3)=nd19Crds(2);
-    N_coord(20,1)=nd20Crds(0); N_coord(20,2)=nd20Crds(1); N_coord(20,3)=nd20Crds(2);
-
-    return N_coord;
-
+    for(int i= 0;i<20;i++)
+      {
+        const Vector &ndCrds= theNodes[i]->getCrds();
+        N_coord(i+1,1)= ndCrds(0);
+        N_coord(i+1,2)= ndCrds(1);
+        N_coord(i+1,3)= ndCrds(2);
+      }
   }
 
 ////#############################################################################
@@ -1405,199 +1216,44 @@ int  XC::TwentyNodeBrick::get_Brick_Number(void)
 // returns nodal forces for given stress field in an element
 XC::BJtensor XC::TwentyNodeBrick::nodal_forces(void) const
   {
-    std::vector<int> force_dim({20,3});  // Xiaoyan changed from {20,3 to {8,3} for 8 nodes
-
-    BJtensor nodal_forces(force_dim,0.0);
-
-    double r  = 0.0;
-    double rw = 0.0;
-    double s  = 0.0;
-    double sw = 0.0;
-    double t  = 0.0;
-    double tw = 0.0;
-
-    short where = 0;
-    double weight = 0.0;
-
-    std::vector<int> dh_dim({20,3});  // Xiaoyan changed from {20,3 to {8,3} for 8 nodes
-
-    BJtensor dh(dh_dim, 0.0);
-
-    stresstensor stress_at_GP(0.0);
-
-    double det_of_Jacobian = 0.0;
-
-    straintensor incremental_strain;
-
-    static std::vector<int> disp_dim({20,3});   // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    incremental_displacements= incr_disp();
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
+    FixedTensor<20,3> nodal_forces;
+    compute_nodal_forces(nodal_forces);
+    return nodal_forces.getBJtensor();
+  }
 
+//! @brief Compute the nodal forces that correspond to the stresses
+//! at the Gauss points.
+void XC::TwentyNodeBrick::compute_nodal_forces(FixedTensor<20,3> &nodal_forces) const
+  {
+    nodal_forces.Zero();
+    FixedTensor<20,3> N_C;
+    Nodal_Coordinates(N_C);
+    FixedTensor<20,3> dh;
+    FixedTensor<20,3> dhGlobal;
     for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
-
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
         for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
-
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
             for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
-                ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh = dh_drst_at(r,s,t);
-
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian  = Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                //dhGlobal = dh("ij") * JacobianINV("jk");// Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-
-                //weight
-                weight = rw * sw * tw * det_of_Jacobian;
-                //..::printf("\n\nIN THE nodal forces ----**************** where = %d \n", where);
-                //..::printf("                    GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d\n",
-                //..                           GP_c_r,GP_c_s,GP_c_t);
-                //..::printf("WEIGHT = %f", weight);
-                //..::printf("determinant of Jacobian = %f", det_of_Jacobian);
-                //..matpoint[where].report("Gauss Point\n");
-
-                //..    just determine this BJtensor E yet and for each gauss point different !!!!!!!!!!!!
-                //..    here should be based on incremental shifts somewhere
-                //..    find incremental deformation (strain_increment) and then with it:
-                //..
-                //// BJtensor of incremental displacements taken from node objects
-                //                incremental_displacements = incr_disp();
-                //
-                //// incremental strains at this Gauss point
-                //                incremental_strain =
-                //                  (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                //
-                //                incremental_strain.null_indices();
-                ////incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //
-                ////                integr_type = (matpoint)->operator[](where).integration_type();
-                ////                if( !strcmp(integr_type,"BakcwardEuler")
-
-                //.. so send stress_increment here because old stress is stored within each
-                //.. Gauss points and only send strain_increment to be transmitted
-                //.. into the integration routine so that it will return the final voltage and then
-                //.. it can that is, the ConstitutiveStiffnessTensor.
-                //..    
-                //.. Actually send everything you have (incremental_strain, start_stress,
-                //.. number_of_subincrements. . . into this Constitutive_tensor function
-                //.. so let it go, depending on the model used and let it go
-                //.. then there in each special model function return what it needs
-                //.. (say Elastic returns Eelastic immediately and let's say MRS_Lade first
-                //.. asks what method of integration to use and then depending on it
-                //.. call function which integrals for that algorithm (ForwardEuler, BakcwardEuler,
-                //.. SemiBackwardEuler ,. . . ) and then when the function returns voltage then
-                //.. one wonders again what type of integration was at stake so the right one
-                //.. ConstitutiveTensor and brings it back!
-
-                //                   stress_at_GP = (GPstress)->operator[](where);
-                //stress_at_GP = GPstress[where];
-
-         //EPState *tmp_eps = (matpoint[where]->matmodel)->getEPS();
-  //stress_at_GP = tmp_eps->getStress();
-  //std::cerr << "tmp_eps" << (*tmp_eps);
-
-         //NDMaterial *tmp_ndm = (matpoint[where]).getNDMat();
-
-  //if( tmp_eps ) {     //Elasto-plastic case
-
-  //stress_at_GP = (matpoint[where].matmodel->getEPS())->getStress();
-
-  //   EPState *tmp_eps = (matpoint[where]->matmodel)->getEPS();
-  //   stress_at_GP = tmp_eps->getStress();
-
-
-
-//out May 2004, Guanzhou  incremental_strain =
-//out May 2004, Guanzhou                     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-//out May 2004, Guanzhou//  if(where == 0)
-//out May 2004, Guanzhou//     //std::cerr << " In nodal_force delta_incremental_strain tag "<< getTag() <<"  " <<incremental_strain << std::endl;
-//out May 2004, Guanzhou////  std::cerr << " el tag = "<< getTag();
-//out May 2004, Guanzhou//
-//out May 2004, Guanzhou  int err = ( matpoint[where]->matmodel )->setTrialStrainIncr( incremental_strain);
-//out May 2004, Guanzhou  if( err) {
-//out May 2004, Guanzhou                   std::cerr << "XC::TwentyNodeBrick::nodal_forces (tag: " << this->getTag() << ", not converged\n";
-//out May 2004, Guanzhou     exit(-1);
-//out May 2004, Guanzhou  }
-
-  //char *test = matpoint[where]->matmodel->getType();
-  // fmk - changing if so if into else block must be Template3Dep
-//  if(strcmp(matpoint[where]->matmodel->getType(),"Template3Dep") != 0)
-     stress_at_GP = matpoint[where]->getStressTensor();
-
-//     stress_at_GP.report("PROBLEM");
-//     getchar();
-
-//  else
-//  {
-//            //Some thing funny happened when getting stress directly from matpoint[where], i have to do it this way!
-//     EPState *tmp_eps = ((Template3Dep *)(matpoint[where]->matmodel))->getEPS();
-//     stress_at_GP = tmp_eps->getStress();
-//     //delete tmp_eps;
-//         }
-
-            //double  p = stress_at_GP.p_hydrostatic();
-                //if( p < 0.0 )
-         //{
-         //  std::cerr << getTag();
-         //  std::cerr << " ***p  =    " << p << std::endl;
-         //}
-
-  //std::cerr << " nodal_force :: stress_at_GP " << stress_at_GP << std::endl;
-
-  //}
-  //else if( tmp_ndm ) { //Elastic case
-              //    stress_at_GP = (matpoint[where].getNDMat())->getStressTensor();
-  //}
-  //else {
-                //   std::cerr << "XC::TwentyNodeBrick::nodal_forces (tag: %d), could not getStress", this->getTag();
-  //   exit(1);
-  //}
-
-                //stress_at_GP.report("\n stress_at_GPtensor at GAUSS point for nodal forces \n");
-
-                // nodal forces See Zienkievicz part 1 XC::pp 108
-                nodal_forces =
-                     nodal_forces + dhGlobal("ib")*stress_at_GP("ab")*weight;
-                //nodal_forces.print("nf","\n\n Nodal Forces \n");
-
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                // position of the Gauss point in the matpoint array.
+                const short where =
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian= global_shape_derivatives(dh, N_C, dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                const FixedTensor2 stress_at_GP(matpoint[where].getStressTensor());
+                // nodal_forces_ia+= dhGlobal_ib*stress_ab*weight
+                nodal_forces.addTensor(mult_transposed(dhGlobal, stress_at_GP), weight);
               }
           }
       }
-
-    //std::cerr << "\n element no. " << getTag() << std::endl;
-    //nodal_forces.print("nf","\n Nodal Forces \n");
-    return nodal_forces;
-
   }
 
 ////#############################################################################
@@ -1680,7 +1336,7 @@ XC::BJtensor XC::TwentyNodeBrick::iterative_nodal_forces(void) const
                 //stress_at_GP = GPiterative_stress[where];
 
   //stress_at_GP = ( matpoint[where].getTrialEPS() )->getStress();
-                stress_at_GP = matpoint[where]->getStressTensor();
+                stress_at_GP = matpoint[where].getStressTensor();
                 stress_at_GP.reportshortpqtheta("\n iterative_stress at GAUSS point in iterative_nodal_force\n");
 
                 // nodal forces See Zienkievicz part 1 XC::pp 108
@@ -1892,10 +1548,10 @@ XC::BJtensor XC::TwentyNodeBrick::linearized_nodal_forces(void) const
 
   //if( tmp_eps ) {     //Elasto-plastic case
   //    mmodel->setEPS( *tmp_eps );
-  if( ! (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)  )
+  if( ! (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)  )
     std::cerr << "XC::TwentyNodeBrick::linearized_nodal_forces (tag: " << this->getTag() << "), not converged\n";
 
-  Constitutive = (matpoint[where]->matmodel)->getTangentTensor();
+  Constitutive = (matpoint[where].matmodel)->getTangentTensor();
         //    matpoint[where].setEPS( mmodel->getEPS() ); //Set the new EPState back
   //}
   //else if( tmp_ndm ) { //Elastic case
@@ -2133,7 +1789,7 @@ void XC::TwentyNodeBrick::report(const std::string & msg)
                 ::printf("\n\n----------------**************** where = %d \n", where);
                 ::printf("                    GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d\n",
                             GP_c_r,GP_c_s,GP_c_t);
-                matpoint[where]->report("Material Point\n");
+                matpoint[where].report("Material Point\n");
                 //GPstress[where].reportshort("stress at Gauss Point");
                 //GPstrain[where].reportshort("strain at Gauss Point");
                 //matpoint[where].report("Material model  at Gauss Point");
@@ -2192,7 +1848,7 @@ void XC::TwentyNodeBrick::reportPAK(const std::string & msg)
 void XC::TwentyNodeBrick::reportpqtheta(int GP_numb)
   {
     short where = GP_numb-1;
-    matpoint[where]->reportpqtheta("");
+    matpoint[where].reportpqtheta("");
   }
 
 //#############################################################################
@@ -2536,16 +2192,16 @@ int XC::TwentyNodeBrick::commitState(void)
       for(i = 0; i < count; i++)
       //for(i = 0; i < 27; i++)
       {
-         retVal += matpoint[i]->commitState();
-         //if(i == 4 && strcmp(matpoint[i]->matmodel->getType(),"Template3Dep") == 0)
+         retVal += matpoint[i].commitState();
+         //if(i == 4 && strcmp(matpoint[i].matmodel->getType(),"Template3Dep") == 0)
          stresstensor st;
   stresstensor prin;
          straintensor stn;
          straintensor stnprin;
 
-         st = matpoint[i]->getStressTensor();
+         st = matpoint[i].getStressTensor();
          prin = st.principal();
-         stn = matpoint[i]->getStrainTensor();
+         stn = matpoint[i].getStrainTensor();
          stnprin = stn.principal();
          /*
   std::cerr << "\nGauss Point: " << i << std::endl;
@@ -2582,14 +2238,14 @@ int XC::TwentyNodeBrick::commitState(void)
 
         //std::cerr << "     " << ev << std::endl;
 
-//out22Jan2001  if(strcmp(matpoint[i]->matmodel->getType(),"Template3Dep") == 0)
+//out22Jan2001  if(strcmp(matpoint[i].matmodel->getType(),"Template3Dep") == 0)
 //out22Jan2001          {
-//out22Jan2001          st = ( ((Template3Dep *)(matpoint[i]->matmodel))->getEPS())->getStress();
+//out22Jan2001          st = ( ((Template3Dep *)(matpoint[i].matmodel))->getEPS())->getStress();
 //out22Jan2001          prin = st.principal();
 //out22Jan2001   }
 //out22Jan2001   else
 //out22Jan2001   {
-//out22Jan2001           st = matpoint[i]->getStressTensor();
+//out22Jan2001           st = matpoint[i].getStressTensor();
 //out22Jan2001          prin = st.principal();
 //out22Jan2001
 //out22Jan2001   }
@@ -2655,7 +2311,7 @@ int XC::TwentyNodeBrick::revertToLastCommit(void)
      //retVal += (theMaterial[i][j][k]).revertToLastCommit();
 
     for(int i = 0; i < count; i++)
-       retVal += matpoint[i]->revertToLastCommit();
+       retVal += matpoint[i].revertToLastCommit();
 
 
     return retVal;
@@ -2677,7 +2333,7 @@ int XC::TwentyNodeBrick::revertToStart()
     int count  = r_integration_order* s_integration_order * t_integration_order;
 
     for(i = 0; i < count; i++)
-       retVal+= matpoint[i]->revertToStart();
+       retVal+= matpoint[i].revertToStart();
 
 
     return retVal;
@@ -2689,25 +2345,14 @@ int XC::TwentyNodeBrick::revertToStart()
 //=============================================================================
 const XC::Matrix &XC::TwentyNodeBrick::getTangentStiff(void) const
   {
-     BJtensor stifftensor = getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
+     FixedTensor<20,3,3,20> stifftensor;
+     compute_stiffness(stifftensor);
      static const int nodes_in_brick= getNumExternalNodes();
      for( int i=1 ; i<=nodes_in_brick ; i++ )
-     {
-        for( int j=1 ; j<=nodes_in_brick ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
-              {
-                 Ki = k+3*(i-1);
-                 Kj = l+3*(j-1);
-                 K( Ki-1 , Kj-1 ) = stifftensor(i,k,l,j);
-              }
-           }
-        }
-     }
+       for( int k=1 ; k<=3 ; k++ )
+         for( int l=1 ; l<=3 ; l++ )
+           for( int j=1 ; j<=nodes_in_brick ; j++ )
+             K( k+3*(i-1)-1 , l+3*(j-1)-1 ) = stifftensor(i,k,l,j);
 
      //std::cerr << " K " << K << std::endl;
      //K.Output(std::cerr);
@@ -3174,10 +2819,10 @@ const XC::Vector XC::TwentyNodeBrick::FormEquiBodyForce(void)
 //    int count  = r_integration_order* s_integration_order * t_integration_order;
 //
 //    //For elastic-isotropic material
-//    if(strcmp(matpoint[i]->matmodel->getType(),strTypeElasticIsotropic3D) == 0)
+//    if(strcmp(matpoint[i].matmodel->getType(),strTypeElasticIsotropic3D) == 0)
 //    {
 //       for(i = 0; i < count; i++)
-//           (matpoint[i]->matmodel)->setElasticStiffness( p_est );
+//           (matpoint[i].matmodel)->setElasticStiffness( p_est );
 //    }
 //
 //    //return ;
@@ -3187,12 +2832,10 @@ const XC::Vector XC::TwentyNodeBrick::FormEquiBodyForce(void)
 //=============================================================================
 const XC::Vector &XC::TwentyNodeBrick::getResistingForce(void) const
   {
-    std::vector<int> force_dim({20,3});
-    BJtensor nodalforces(force_dim,0.0);
-
-    nodalforces = nodal_forces();
+    FixedTensor<20,3> nodalforces;
+    compute_nodal_forces(nodalforces);
 
-    //converting nodalforce XC::BJtensor to vector
+    //converting nodalforce tensor to vector
     static const int nodes_in_brick= getNumExternalNodes();
     for(int i = 0; i< nodes_in_brick; i++)
       for(int j = 0; j < 3; j++)
@@ -3390,7 +3033,7 @@ void XC::TwentyNodeBrick::Print(std::ostream &s, int flag) const
 
            s << "\n where = " << where << std::endl;
            s << " GP_c_r= " << GP_c_r << "GP_c_s = " << GP_c_s << " GP_c_t = " << GP_c_t << std::endl;
-           matpoint[where]->report("Material Point\n");
+           matpoint[where].report("Material Point\n");
            //GPstress[where].reportshort("stress at Gauss Point");
            //GPstrain[where].reportshort("strain at Gauss Point");
            //matpoint[where].report("Material model  at Gauss Point");
@@ -3420,7 +3063,7 @@ void XC::TwentyNodeBrick::Print(std::ostream &s, int flag) const
        //int plastify = 0;
        //
        //for(int i = 0; i < count; i++) {
-       //  pl_stn = matpoint[i]->getPlasticStrainTensor();
+       //  pl_stn = matpoint[i].getPlasticStrainTensor();
        //  double  p_plastc = pl_stn.p_hydrostatic();
        //
        //  if(  fabs(p_plastc) > 0 ) {
@@ -3495,7 +3138,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
        InfoPt(i*4+1) = Gsc(i*3+1); //x
        InfoPt(i*4+2) = Gsc(i*3+2); //y
        InfoPt(i*4+3) = Gsc(i*3+3); //z
-                  pl_stn = matpoint[i]->getPlasticStrainTensor();
+                  pl_stn = matpoint[i].getPlasticStrainTensor();
                   //double  p_plastc = pl_stn.p_hydrostatic();
                   double  q_plastc = pl_stn.q_deviatoric();
 
@@ -3541,8 +3184,8 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
   //Info(109+6) = Gsc(9);
   //std::cerr << " Zz " << Gsc(3) << " " << Gsc(6) << " "<< Gsc(9) << std::endl;
 
-  const std::string &tp = matpoint[1]->getType();
-                int tag = matpoint[1]->getTag();
+  const std::string &tp = matpoint[1].getType();
+                int tag = matpoint[1].getTag();
   //std::cerr << "Material Tag:" << tag << std::endl;
   //tp = strTypeElasticIsotropic3D;
   float height = 1;
@@ -3607,7 +3250,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
                           i =
                              ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
 
-                          sts = matpoint[i]->getStressTensor();
+                          sts = matpoint[i].getStressTensor();
         Info(i*4+1) = Gsc(i*3+1); //x
         Info(i*4+2) = Gsc(i*3+2); //y
         Info(i*4+3) = Gsc(i*3+3); //z
@@ -3667,7 +3310,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
                           i =
                              ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
 
-                          sts = matpoint[i]->getStressTensor();
+                          sts = matpoint[i].getStressTensor();
         InfoSt(i*6+1) = sts(1,1); //sigma_xx
         InfoSt(i*6+2) = sts(2,2); //sigma_yy
         InfoSt(i*6+3) = sts(3,3); //sigma_zz
@@ -3685,7 +3328,7 @@ int XC::TwentyNodeBrick::getResponse (int responseID, Information &eleInfo)
                 int count = r_integration_order* s_integration_order * t_integration_order;
   count = count / 2;
                 stresstensor sts;
-                sts = matpoint[count]->getStressTensor();
+                sts = matpoint[count].getStressTensor();
   InfoSpq2(0) =sts.p_hydrostatic();
   InfoSpq2(1) =sts.q_deviatoric();
       return eleInfo.setVector( InfoSpq2 );
@@ -4526,7 +4169,7 @@ int XC::TwentyNodeBrick::update(void) //Added by Guanzhou, May 7 2004
                 // from the iterative data . . .
                 //(GPstress+where)->reportshortpqtheta("\n stress START GAUSS \n");
 
-  if( ( (matpoint[where]->matmodel)->setTrialStrainIncr( incremental_strain)) )
+  if( ( (matpoint[where].matmodel)->setTrialStrainIncr( incremental_strain)) )
     std::cerr << "XC::TwentyNodeBrick::update (tag: " << this->getTag() << "), update() failed\n";
             }
           }
@@ -63,6 +63,7 @@ class Node;
  class MatPoint3D;
  class BJtensor;
  class NDMaterial;
+template <size_t... Dims> class FixedTensor;
 
 //! @ingroup ElemVol
 //!
@@ -105,10 +106,14 @@ class TwentyNodeBrick: public ElementBase<20>
     // Now I want 3D array of Material points!
     // MatPoint3D[r_integration_order][s_integration_order][t_integration_order]
     // 3D array of Material points
-    MatPoint3D ** matpoint;  // pointer to array of Material Points
+    std::vector<MatPoint3D> matpoint;  //!< array of Material Points
     
     // this is LM array. This array holds DOFs for this element
     //int  LM[60]; // for 20noded x 3 = 60
+    void set_material_points(const NDMaterial *);
+  protected:
+    void compute_stiffness(FixedTensor<20,3,3,20> &) const;
+    void compute_nodal_forces(FixedTensor<20,3> &) const;
   public:
     
     void incremental_Update(void);
@@ -117,6 +122,7 @@ class TwentyNodeBrick: public ElementBase<20>
     static BJtensor H_3D(double r1, double r2, double r3);
     BJtensor interp_poli_at(double r, double s, double t);
     static BJtensor dh_drst_at(double r, double s, double t);
+    static void dh_drst_at(double r, double s, double t, FixedTensor<20,3> &);
 
 
     TwentyNodeBrick & operator[](int subscript);
@@ -129,6 +135,7 @@ class TwentyNodeBrick: public ElementBase<20>
     BJtensor Jacobian_3D(const BJtensor &dh) const;
     BJtensor Jacobian_3Dinv(const BJtensor &dh) const;
     BJtensor Nodal_Coordinates(void) const;
+    void Nodal_Coordinates(FixedTensor<20,3> &) const;
 
     BJtensor incr_disp(void) const;
     BJtensor total_disp(void) const;
@@ -185,6 +192,7 @@ class TwentyNodeBrick: public ElementBase<20>
                    int node_numb_13, int node_numb_14, int node_numb_15, int node_numb_16,
                    int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
 		    NDMaterial * Globalmmodel, const BodyForces3D &bForces, double r, double p);
+    TwentyNodeBrick(int tag, const NDMaterial *);
 
     TwentyNodeBrick(void);
     Element *getCopy(void) const;
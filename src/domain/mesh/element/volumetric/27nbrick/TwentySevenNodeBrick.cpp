@@ -71,6 +71,7 @@
 #include <utility/matrix/nDarray/stresst.h>
 #include <cstring>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 #include "utility/matrix/nDarray/BJtensor.h"
 #include "material/nD/NDMaterialType.h"
 
@@ -88,24 +89,10 @@ namespace XC{
  XC::Vector Info_pq2(2); //p and q of count/2
 } //namespace XC
 
-//! @brief Constructor
-XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
-                               int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
-                               int node_numb_5,  int node_numb_6,  int node_numb_7,  int node_numb_8,
-                               int node_numb_9,  int node_numb_10, int node_numb_11, int node_numb_12,
-                               int node_numb_13, int node_numb_14, int node_numb_15, int node_numb_16,
-                               int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
-                               int node_numb_21,  int node_numb_22,  int node_numb_23,  int node_numb_24,
-                               int node_numb_25,  int node_numb_26,  int node_numb_27,
-                               NDMaterial * Globalmmodel, const BodyForces3D &bForces,
-             double r, double p)
-
-  :ElementBase<27>(element_number, ELE_TAG_TwentySevenNodeBrick ),
-  Ki(0), bf(bForces), rho(r), pressure(p)
+//! @brief Create the material points (one copy of the material for each
+//! Gauss point).
+void XC::TwentySevenNodeBrick::set_material_points(const NDMaterial *Globalmmodel)
   {
-    load.reset(81);
-    //elem_numb = element_number;
-
     determinant_of_Jacobian = 0.0;
 
     //r_integration_order = r_int_order;
@@ -176,6 +163,25 @@ XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
               }
           }
       }
+  }
+
+//! @brief Constructor
+XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
+                               int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
+                               int node_numb_5,  int node_numb_6,  int node_numb_7,  int node_numb_8,
+                               int node_numb_9,  int node_numb_10, int node_numb_11, int node_numb_12,
+                               int node_numb_13, int node_numb_14, int node_numb_15, int node_numb_16,
+                               int node_numb_17, int node_numb_18, int node_numb_19, int node_numb_20,
+                               int node_numb_21,  int node_numb_22,  int node_numb_23,  int node_numb_24,
+                               int node_numb_25,  int node_numb_26,  int node_numb_27,
+                               NDMaterial * Globalmmodel, const BodyForces3D &bForces,
+             double r, double p)
+
+  :ElementBase<27>(element_number, ELE_TAG_TwentySevenNodeBrick ),
+  Ki(0), bf(bForces), rho(r), pressure(p)
+  {
+    load.reset(81);
+    set_material_points(Globalmmodel);
 
       // Set connected external node IDs
     theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8,node_numb_9,node_numb_10,node_numb_11,node_numb_12,node_numb_13,node_numb_14,node_numb_15,node_numb_16,node_numb_17,node_numb_18,node_numb_19,node_numb_20,node_numb_21,node_numb_22,node_numb_23,node_numb_24,node_numb_25,node_numb_26,node_numb_27);
@@ -183,6 +189,16 @@ XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int element_number,
 
 }
 
+//! @brief Constructor (the nodes are set afterwards), used by the
+//! element handler. The density is the one of the material.
+XC::TwentySevenNodeBrick::TwentySevenNodeBrick(int tag, const NDMaterial *ptr_mat)
+  :ElementBase<27>(tag, ELE_TAG_TwentySevenNodeBrick),
+  mmodel(nullptr), Ki(0), bf(3), rho(ptr_mat->getRho()), pressure(0.0)
+  {
+    load.reset(81);
+    set_material_points(ptr_mat);
+  }
+
 //! @brief Constructor
 XC::TwentySevenNodeBrick::TwentySevenNodeBrick ():ElementBase<27>(0, ELE_TAG_TwentySevenNodeBrick ),
   mmodel(nullptr), Ki(0), bf(3), rho(0.0), pressure(0.0)
@@ -636,9 +652,15 @@ XC::BJtensor XC::TwentySevenNodeBrick::H_3D(double r1, double r2, double r3)
 
 XC::BJtensor XC::TwentySevenNodeBrick::dh_drst_at(double r1, double r2, double r3)
   {
+    FixedTensor<27,3> dh;
+    dh_drst_at(r1, r2, r3, dh);
+    return dh.getBJtensor();
+  }
 
-    std::vector<int> dimensions({27,3});  // Changed from{20,3} to {27,3} Guanzhou Oct. 2003
-    BJtensor dh(dimensions, 0.0);
+//! @brief Compute the derivatives of the shape functions with respect
+//! to the natural coordinates at the point (r1, r2, r3).
+void XC::TwentySevenNodeBrick::dh_drst_at(double r1, double r2, double r3, FixedTensor<27,3> &dh)
+  {
 
 
     //Shape Functions of XC::Node 1 Along Three Coordinate Directions
@@ -884,7 +906,6 @@ XC::BJtensor XC::TwentySevenNodeBrick::dh_drst_at(double r1, double r2, double r
     dh(1,2)= (1.0+r1)*(1.0+r3)*0.125 - (dh(12,2)+dh(17,2)+dh( 9,2))*0.50; ///2.0;
     dh(1,3)= (1.0+r1)*(1.0+r2)*0.125 - (dh(12,3)+dh(17,3)+dh( 9,3))*0.50; ///2.0;*///Commented out by Guanzhou, Oct. 2003
 
-    return dh;
   }
 
 
@@ -908,199 +929,49 @@ XC::BJtensor XC::TwentySevenNodeBrick::dh_drst_at(double r1, double r2, double r
 //! @brief Returns the stiffness tensor.
 XC::BJtensor XC::TwentySevenNodeBrick::getStiffnessTensor(void) const
   {
-    std::vector<int> K_dim({27,3,3,27});
-    BJtensor Kk(K_dim,0.0);
-    BJtensor Kkt(K_dim,0.0);
-
-//debugging
-//    matrix Kmat;
-
-    double r  = 0.0;
-    double rw = 0.0;
-    double s  = 0.0;
-    double sw = 0.0;
-    double t  = 0.0;
-    double tw = 0.0;
-
-    short where = 0;
-    double weight = 0.0;
-
-    std::vector<int> dh_dim({27,3});
-    BJtensor dh(dh_dim, 0.0);
-
-    //    BJtensor Constitutive( def_dim_4, 0.0);
-    BJtensor Constitutive;
-
-    double det_of_Jacobian = 0.0;
-
-    static std::vector<int> disp_dim({27,3});
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    straintensor incremental_strain;
-//    straintensor total_strain_at_GP;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor JacobianINVtemp;
-    BJtensor dhGlobal;
+    FixedTensor<27,3,3,27> Kk;
+    compute_stiffness(Kk);
+    return Kk.getBJtensor();
+  }
 
+//! @brief Compute the stiffness tensor of the element.
+//!
+//! The Gauss point loop works with stack allocated tensors (see
+//! FixedTensor) to avoid the memory allocations and the parsing
+//! of the index strings of the BJtensor products.
+void XC::TwentySevenNodeBrick::compute_stiffness(FixedTensor<27,3,3,27> &Kk) const
+  {
+    Kk.Zero();
+    FixedTensor<27,3> N_C;
+    Nodal_Coordinates(N_C);
+    FixedTensor<27,3> dh;
+    FixedTensor<27,3> dhGlobal;
     for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
         for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
             for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                // position of the Gauss point in the matpoint array.
+                const short where =
                    ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordinates with respect to local coordinates
-                dh = dh_drst_at(r,s,t);
-    //dh.print("dh");
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //JacobianINVtemp = Jacobian.inverse();
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian  = Jacobian.determinant();
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                ////////!!!!!!! dhGlobal = dh("ij") * JacobianINV("jk");  //big bug found here Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-                //        ::fprintf(stdout," # %d \n\n\n\n\n\n\n\n", El_count);
-                  //dhGlobal.print("dhGlobal");
-                //weight
-                weight = rw * sw * tw * det_of_Jacobian;
-                //::::
-                //printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where = %d \n", where);
-                //printf("  Stifness_Tensor \n");
-                //printf("                    GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d\n",
-                //                            GP_c_r,GP_c_s,GP_c_t);
-                //printf("WEIGHT = %f", weight);
-                //Jacobian.print("J");
-                //JacobianINV.print("JINV");
-                //JacobianINVtemp.print("JINVtemp");
-                //BJtensor I = JacobianINV("ij")*Jacobian("jk");
-                //I.print("I");
-
-                //printf("determinant of Jacobian = %.6e", det_of_Jacobian);
-                //matpoint[where].report("Gauss Point\n");
-
-                // incremental strains at this Gauss point
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor1\n");
-
-    //09-02-2001 Zhaohui
-    //              incremental_strain =
-                //     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-
-    //incremental_strain.null_indices();
-                //incremental_strain.report("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-                  // incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor2\n");
-                // initialize total strain with the strain at this Gauss point before
-                // adding this increments strains!
-                //                total_strain_at_GP.Initialize(*(GPstrain+where));
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point BEFORE\n");
-                // this is the addition of incremental strains to the previous strain state at
-                // this Gauss point
-                //                total_strain_at_GP = total_strain_at_GP + incremental_strain;
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point AFTER\n");
-                //..   dakle ovde posalji strain_increment jer se stari stress cuva u okviru svake
-                //..   Gauss tacke a samo saljes strain_increment koji ce da se prenese
-                //..   u integracionu rutinu pa ce ta da vrati krajnji napon i onda moze da
-                //..   se pravi ConstitutiveStiffnessTensor.
-                // here comes the final_stress calculation
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point.
-
-                //final_stress_after_integration =
-                //    (matpoint)->operator[](where).FinalStress(*(GPstress+where),
-                //                                 incremental_strain,
-                //                                 (matpoint)->operator[](where),
-                //                                 number_of_subincrements,
-                //                                 this_one_PP);
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration in stiffness_tensor5\n");
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor3\n");
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration GAUSS \n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor4\n");
-
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point AND to set up the iterative_stress that is used in calculting
-                // internal forces during iterations!!
-
-                //GPiterative_stress[where].Initialize(final_stress_after_integration);
-                //GPiterative_stress[where].reportshortpqtheta("\n iterative_stress at GAUSS point in stiffness_tensor5\n");
-
-
-                // Stress state at Gauss point will be updated ( in the
-                // sense of updating stresses ( integrating them ) ) in function Update (...) ! ! ! ! !
-                // calculate the constitutive XC::BJtensor
-                //......         Constitutive =  GPtangent_E[where];
-
-    //Constitutive =  (matpoint)->operator[](where).ConstitutiveTensor(final_stress_after_integration,
-                //                                         *(GPstress+where),
-                //                                          incremental_strain,
-                //                                          (matpoint)->operator[](where),
-                //                                          this_one_PP);
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-          //EPState *tmp_eps = (matpoint[where]).getEPS();
-          //NDMaterial *tmp_ndm = (matpoint[where]).getNDMat();
-
-                  Constitutive = (matpoint[where].matmodel)->getTangentTensor();
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-    //    matpoint[where].setEPS( mmodel->getEPS() );
-    //}
-    //else if( tmp_ndm ) { //Elastic case
-    //    (matpoint[where].p_matmodel)->setTrialStrainIncr( incremental_strain );
-    //    Constitutive = (matpoint[where].p_matmodel)->getTangentTensor();
-    //}
-    //else {
-                 //   std::cerr << "XC::TwentySevenNodeBrick::incremental_Update (tag: %d), could not getTangentTensor", this->getTag();
-    //   exit(1);
-    //}
-
-    //printf("Constitutive.trace = %12.6e\n", Constitutive.trace());
-                //Kmat = this->stiffness_matrix(Constitutive);
-                //printf("Constitutive XC::BJtensor max:= %10.3e\n", Kmat.mmax());
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor5\n");
-                // this is update of constitutive XC::BJtensor at this Gauss point
-                //GPtangent_E[where].Initialize(Constitutive);
-                //....GPtangent_E[where].print(" tangent E at GAUSS point");
-
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor6\n");
-
-                //K = K + temp2;
-
-                  Kkt = dhGlobal("ib")*Constitutive("abcd");
-                  Kk = Kk + Kkt("aicd")*dhGlobal("jd")*weight;
-
-    //Kk = Kk + dhGlobal("ib")*Constitutive("abcd")*dhGlobal("jd")*weight;
-                //....K.print("K","\n\n K XC::BJtensor \n");
-
-    //Kmat = this->stiffness_matrix(Kk);
-                //printf("K XC::BJtensor max= %10.3e\n", Kmat.mmax());
-
-                //convert constitutive and K to matrix and find min and max and print!
-
-
-
+                // derivatives of the shape functions with respect to the
+                // local and to the global coordinates.
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian = global_shape_derivatives(dh, N_C, dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                const FixedTensor4 Constitutive((matpoint[where].matmodel)->getTangentTensor());
+                // Kk_nklm+= dhGlobal_nb*C_kbld*dhGlobal_md*weight
+                add_stiffness_contribution(Kk, dhGlobal, Constitutive, weight);
               }
           }
       }
-    //Kk.print("K","\n\n K XC::BJtensor \n");
-    //K = Kk;
-    return Kk;
   }
 
 
@@ -1361,80 +1232,22 @@ XC::BJtensor XC::TwentySevenNodeBrick::Jacobian_3D(const BJtensor &dh) const
 //! @brief Returns the coordinates of the nodes.
 XC::BJtensor XC::TwentySevenNodeBrick::Nodal_Coordinates(void) const
   {
-    const std::vector<int> dimensions({27,3});
-    BJtensor N_coord(dimensions, 0.0);
+    FixedTensor<27,3> N_coord;
+    Nodal_Coordinates(N_coord);
+    return N_coord.getBJtensor();
+  }
 
+//! @brief Return the coordinates of the nodes (one row per node).
+void XC::TwentySevenNodeBrick::Nodal_Coordinates(FixedTensor<27,3> &N_coord) const
+  {
     //Zhaohui using node pointers, which come from the XC::Domain
-    const XC::Vector &nd1Crds = theNodes[0]->getCrds();
-    const XC::Vector &nd2Crds = theNodes[1]->getCrds();
-    const XC::Vector &nd3Crds = theNodes[2]->getCrds();
-    const XC::Vector &nd4Crds = theNodes[3]->getCrds();
-    const XC::Vector &nd5Crds = theNodes[4]->getCrds();
-    const XC::Vector &nd6Crds = theNodes[5]->getCrds();
-    const XC::Vector &nd7Crds = theNodes[6]->getCrds();
-    const XC::Vector &nd8Crds = theNodes[7]->getCrds();
-
-    const XC::Vector &nd9Crds  =  theNodes[8]->getCrds();
-    const XC::Vector &nd10Crds = theNodes[9]->getCrds();
-    const XC::Vector &nd11Crds = theNodes[10]->getCrds();
-    const XC::Vector &nd12Crds = theNodes[11]->getCrds();
-
-    const XC::Vector &nd13Crds = theNodes[12]->getCrds();
-    const XC::Vector &nd14Crds = theNodes[13]->getCrds();
-    const XC::Vector &nd15Crds = theNodes[14]->getCrds();
-    const XC::Vector &nd16Crds = theNodes[15]->getCrds();
-
-
-    const XC::Vector &nd17Crds = theNodes[16]->getCrds();
-    const XC::Vector &nd18Crds = theNodes[17]->getCrds();
-    const XC::Vector &nd19Crds = theNodes[18]->getCrds();
-    const XC::Vector &nd20Crds = theNodes[19]->getCrds();
-
-    const XC::Vector &nd21Crds = theNodes[20]->getCrds();
-    const XC::Vector &nd22Crds = theNodes[21]->getCrds();
-    const XC::Vector &nd23Crds = theNodes[22]->getCrds();
-    const XC::Vector &nd24Crds = theNodes[23]->getCrds();
-    const XC::Vector &nd25Crds = theNodes[24]->getCrds();
-    const XC::Vector &nd26Crds = theNodes[25]->getCrds();
-    const XC::Vector &nd27Crds = theNodes[26]->getCrds();
-
-
-
-    N_coord(1,1)=nd1Crds(0); N_coord(1,2)=nd1Crds(1); N_coord(1,3)=nd1Crds(2);
-    N_coord(2,1)=nd2Crds(0); N_coord(2,2)=nd2Crds(1); N_coord(2,3)=nd2Crds(2);
-    N_coord(3,1)=nd3Crds(0); N_coord(3,2)=nd3Crds(1); N_coord(3,3)=nd3Crds(2);
-    N_coord(4,1)=nd4Crds(0); N_coord(4,2)=nd4Crds(1); N_coord(4,3)=nd4Crds(2);
-    N_coord(5,1)=nd5Crds(0); N_coord(5,2)=nd5Crds(1); N_coord(5,3)=nd5Crds(2);
-    N_coord(6,1)=nd6Crds(0); N_coord(6,2)=nd6Crds(1); N_coord(6,3)=nd6Crds(2);
-    N_coord(7,1)=nd7Crds(0); N_coord(7,2)=nd7Crds(1); N_coord(7,3)=nd7Crds(2);
-    N_coord(8,1)=nd8Crds(0); N_coord(8,2)=nd8Crds(1); N_coord(8,3)=nd8Crds(2);
-
-    N_coord(9 ,1)=nd9Crds(0);  N_coord(9 ,2)=nd9Crds(1);  N_coord(9 ,3)=nd9Crds(2);
-    N_coord(10,1)=nd10Crds(0); N_coord(10,2)=nd10Crds(1); N_coord(10,3)=nd10Crds(2);
-    N_coord(11,1)=nd11Crds(0); N_coord(11,2)=nd11Crds(1); N_coord(11,3)=nd11Crds(2);
-    N_coord(12,1)=nd12Crds(0); N_coord(12,2)=nd12Crds(1); N_coord(12,3)=nd12Crds(2);
-
-    N_coord(13,1)=nd13Crds(0); N_coord(13,2)=nd13Crds(1); N_coord(13,3)=nd13Crds(2);
-    N_coord(14,1)=nd14Crds(0); N_coord(14,2)=nd14Crds(1); N_coord(14,3)=nd14Crds(2);
-    N_coord(15,1)=nd15Crds(0); N_coord(15,2)=nd15Crds(1); N_coord(15,3)=nd15Crds(2);
-    N_coord(16,1)=nd16Crds(0); N_coord(16,2)=nd16Crds(1); N_coord(16,3)=nd16Crds(2);
-
-    N_coord(17,1)=nd17Crds(0); N_coord(17,2)=nd17Crds(1); N_coord(17,3)=nd17Crds(2);
-    N_coord(18,1)=nd18Crds(0); N_coord(18,2)=nd18Crds(1); N_coord(18,3)=nd18Crds(2);
-    N_coord(19,1)=nd19Crds(0); N_coord(19,2)=nd19Crds(1); N_coord(19,3)=nd19Crds(2);
-    N_coord(20,1)=nd20Crds(0); N_coord(20,2)=nd20Crds(1); N_coord(20,3)=nd20Crds(2);
-
-    N_coord(21,1)=nd21Crds(0); N_coord(21,2)=nd21Crds(1); N_coord(21,3)=nd21Crds(2);
-    N_coord(22,1)=nd22Crds(0); N_coord(22,2)=nd22Crds(1); N_coord(22,3)=nd22Crds(2);
-    N_coord(23,1)=nd23Crds(0); N_coord(23,2)=nd23Crds(1); N_coord(23,3)=nd23Crds(2);
-    N_coord(24,1)=nd24Crds(0); N_coord(24,2)=nd24Crds(1); N_coord(24,3)=nd24Crds(2);
-    N_coord(25,1)=nd25Crds(0); N_coord(25,2)=nd25Crds(1); N_coord(25,3)=nd25Crds(2);
-    N_coord(26,1)=nd26Crds(0); N_coord(26,2)=nd26Crds(1); N_coord(26,3)=nd26Crds(2);
-    N_coord(27,1)=nd27Crds(0); N_coord(27,2)=nd27Crds(1); N_coord(27,3)=nd27Crds(2);
-
-
-    return N_coord;
-
+    for(int i= 0;i<27;i++)
+      {
+        const Vector &ndCrds= theNodes[i]->getCrds();
+        N_coord(i+1,1)= ndCrds(0);
+        N_coord(i+1,2)= ndCrds(1);
+        N_coord(i+1,3)= ndCrds(2);
+      }
   }
 
 ////#############################################################################
@@ -1738,199 +1551,44 @@ int  XC::TwentySevenNodeBrick::get_Brick_Number(void)
 // returns nodal forces for given stress field in an element
 XC::BJtensor XC::TwentySevenNodeBrick::nodal_forces(void) const
   {
-    std::vector<int> force_dim({27,3});  // Guanzhou changed for {20,3} to {27,3} for 27 nodes
-
-    BJtensor nodal_forces(force_dim,0.0);
-
-    double r  = 0.0;
-    double rw = 0.0;
-    double s  = 0.0;
-    double sw = 0.0;
-    double t  = 0.0;
-    double tw = 0.0;
-
-    short where = 0;
-    double weight = 0.0;
-
-    std::vector<int> dh_dim({27,3});
-
-    BJtensor dh(dh_dim, 0.0);
-
-    stresstensor stress_at_GP(0.0);
-
-    double det_of_Jacobian = 0.0;
-
-    straintensor incremental_strain;
-
-    static std::vector<int> disp_dim({27,3});
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    incremental_displacements = incr_disp();
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
+    FixedTensor<27,3> nodal_forces;
+    compute_nodal_forces(nodal_forces);
+    return nodal_forces.getBJtensor();
+  }
 
+//! @brief Compute the nodal forces that correspond to the stresses
+//! at the Gauss points.
+void XC::TwentySevenNodeBrick::compute_nodal_forces(FixedTensor<27,3> &nodal_forces) const
+  {
+    nodal_forces.Zero();
+    FixedTensor<27,3> N_C;
+    Nodal_Coordinates(N_C);
+    FixedTensor<27,3> dh;
+    FixedTensor<27,3> dhGlobal;
     for( short GP_c_r = 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r = get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw = get_Gauss_p_w( r_integration_order, GP_c_r );
-
+        const double r = get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw = get_Gauss_p_w( r_integration_order, GP_c_r );
         for( short GP_c_s = 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s = get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw = get_Gauss_p_w( s_integration_order, GP_c_s );
-
+            const double s = get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw = get_Gauss_p_w( s_integration_order, GP_c_s );
             for( short GP_c_t = 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t = get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw = get_Gauss_p_w( t_integration_order, GP_c_t );
-
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
-                ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh = dh_drst_at(r,s,t);
-
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian = Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV = Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian  = Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                //dhGlobal = dh("ij") * JacobianINV("jk");// Zhaohui 09-02-2001
-                dhGlobal = dh("ij") * JacobianINV("kj");
-
-                //weight
-                weight = rw * sw * tw * det_of_Jacobian;
-                //..::printf("\n\nIN THE nodal forces ----**************** where = %d \n", where);
-                //..::printf("                    GP_c_r = %d,  GP_c_s = %d,  GP_c_t = %d\n",
-                //..                           GP_c_r,GP_c_s,GP_c_t);
-                //..::printf("WEIGHT = %f", weight);
-                //..::printf("determinant of Jacobian = %f", det_of_Jacobian);
-                //..matpoint[where].report("Gauss Point\n");
-
-                //..    just determine this BJtensor E yet and for each gauss point different !!!!!!!!!!!!
-                //..    here should be based on incremental shifts somewhere
-                //..    find incremental deformation (strain_increment) and then with it:
-                //..
-                //// BJtensor of incremental displacements taken from node objects
-                //                incremental_displacements = incr_disp();
-                //
-                //// incremental strains at this Gauss point
-                //                incremental_strain =
-                //                  (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                //
-                //                incremental_strain.null_indices();
-                ////incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //
-                ////                integr_type = (matpoint)->operator[](where).integration_type();
-                ////                if( !strcmp(integr_type,"BakcwardEuler")
-
-                //.. so send stress_increment here because old stress is stored within each
-                //.. Gauss points and only send strain_increment to be transmitted
-                //.. into the integration routine so that it will return the final voltage and then
-                //.. it can that is, the ConstitutiveStiffnessTensor.
-                //..    
-                //.. Actually send everything you have (incremental_strain, start_stress,
-                //.. number_of_subincrements. . . into this Constitutive_tensor function
-                //.. so let it go, depending on the model used and let it go
-                //.. then there in each special model function return what it needs
-                //.. (say Elastic returns Eelastic immediately and let's say MRS_Lade first
-                //.. asks what method of integration to use and then depending on it
-                //.. call function which integrals for that algorithm (ForwardEuler, BakcwardEuler,
-                //.. SemiBackwardEuler ,. . . ) and then when the function returns voltage then
-                //.. one wonders again what type of integration was at stake so the right one
-                //.. ConstitutiveTensor and brings it back!
-
-                //                   stress_at_GP = (GPstress)->operator[](where);
-                //stress_at_GP = GPstress[where];
-
-          //EPState *tmp_eps = (matpoint[where].matmodel)->getEPS();
-    //stress_at_GP = tmp_eps->getStress();
-    //std::cerr << "tmp_eps" << (*tmp_eps);
-
-          //NDMaterial *tmp_ndm = (matpoint[where]).getNDMat();
-
-    //if( tmp_eps ) {     //Elasto-plastic case
-
-    //stress_at_GP = (matpoint[where].matmodel->getEPS())->getStress();
-
-    //   EPState *tmp_eps = (matpoint[where].matmodel)->getEPS();
-    //   stress_at_GP = tmp_eps->getStress();
-
-
-
-//out May 5 2004, Guanzhou    incremental_strain =
-//out May 5 2004, Guanzhou                     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-//out May 5 2004, Guanzhou//    if(where == 0)
-//out May 5 2004, Guanzhou//       //std::cerr << " In nodal_force delta_incremental_strain tag "<< getTag() <<"  " <<incremental_strain << std::endl;
-//out May 5 2004, Guanzhou////    std::cerr << " el tag = "<< getTag();
-//out May 5 2004, Guanzhou//
-//out May 5 2004, Guanzhou    int err = ( matpoint[where].matmodel )->setTrialStrainIncr( incremental_strain);
-//out May 5 2004, Guanzhou    if( err) {
-//out May 5 2004, Guanzhou                    std::cerr << "XC::TwentySevenNodeBrick::nodal_forces (tag: " << this->getTag() << ", not converged\n";
-//out May 5 2004, Guanzhou       exit(-1);
-//out May 5 2004, Guanzhou    }
-
-    //char *test = matpoint[where].matmodel->getType();
-    // fmk - changing if so if into else block must be Template3Dep
-//    if(strcmp(matpoint[where].matmodel->getType(),"Template3Dep") != 0)
-       stress_at_GP = matpoint[where].getStressTensor();
-
-//         stress_at_GP.report("PROBLEM");
-//         getchar();
-
-//    else
-//    {
-//             //Some thing funny happened when getting stress directly from matpoint[where], i have to do it this way!
-//       EPState *tmp_eps = ((Template3Dep *)(matpoint[where].matmodel))->getEPS();
-//       stress_at_GP = tmp_eps->getStress();
-//       //delete tmp_eps;
-//           }
-
-             //double  p = stress_at_GP.p_hydrostatic();
-                //if( p < 0.0 )
-          //{
-          //  std::cerr << getTag();
-          //  std::cerr << " ***p  =    " << p << std::endl;
-          //}
-
-    //std::cerr << " nodal_force :: stress_at_GP " << stress_at_GP << std::endl;
-
-    //}
-    //else if( tmp_ndm ) { //Elastic case
-               //    stress_at_GP = (matpoint[where].getNDMat())->getStressTensor();
-    //}
-    //else {
-                 //   std::cerr << "XC::TwentySevenNodeBrick::nodal_forces (tag: %d), could not getStress", this->getTag();
-    //   exit(1);
-    //}
-
-                //stress_at_GP.report("\n stress_at_GPtensor at GAUSS point for nodal forces \n");
-
-                // nodal forces See Zienkievicz part 1 XC::pp 108
-                nodal_forces =
-                     nodal_forces + dhGlobal("ib")*stress_at_GP("ab")*weight;
-                //nodal_forces.print("nf","\n\n Nodal Forces \n");
-
+                const double t = get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw = get_Gauss_p_w( t_integration_order, GP_c_t );
+                // position of the Gauss point in the matpoint array.
+                const short where =
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian = global_shape_derivatives(dh, N_C, dhGlobal);
+                const double weight = rw * sw * tw * det_of_Jacobian;
+                const FixedTensor2 stress_at_GP(matpoint[where].getStressTensor());
+                // nodal_forces_ia+= dhGlobal_ib*stress_ab*weight
+                nodal_forces.addTensor(mult_transposed(dhGlobal, stress_at_GP), weight);
               }
           }
       }
-
-    //std::cerr << "\n element no. " << getTag() << std::endl;
-    //nodal_forces.print("nf","\n Nodal Forces \n");
-    return nodal_forces;
-
   }
 
 ////#############################################################################
@@ -3066,25 +2724,13 @@ int XC::TwentySevenNodeBrick::revertToStart(void)
 //=============================================================================
 const XC::Matrix &XC::TwentySevenNodeBrick::getTangentStiff(void) const
 {
-     BJtensor stifftensor = getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-     const int nodes_in_brick= getNumExternalNodes();
-     for( int i=1 ; i<=nodes_in_brick ; i++ )
-     {
-        for( int j=1 ; j<=nodes_in_brick ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
-              {
-                 Ki = k+3*(i-1);
-                 Kj = l+3*(j-1);
-                 K( Ki-1 , Kj-1 ) = stifftensor(i,k,l,j);
-              }
-           }
-        }
-     }
+     FixedTensor<27,3,3,27> stifftensor;
+     compute_stiffness(stifftensor);
+     for( int i=1 ; i<=27 ; i++ )
+       for( int k=1 ; k<=3 ; k++ )
+         for( int l=1 ; l<=3 ; l++ )
+           for( int j=1 ; j<=27 ; j++ )
+             K( k+3*(i-1)-1 , l+3*(j-1)-1 ) = stifftensor(i,k,l,j);
 
      //std::cerr << " K " << K << std::endl;
      //K.Output(std::cerr);
@@ -3642,12 +3288,10 @@ const XC::Vector XC::TwentySevenNodeBrick::FormEquiBodyForce(void)
 //=============================================================================
 const XC::Vector &XC::TwentySevenNodeBrick::getResistingForce(void) const
 {
-    std::vector<int> force_dim({27,3});
-    BJtensor nodalforces(force_dim,0.0);
-
-    nodalforces = nodal_forces();
+    FixedTensor<27,3> nodalforces;
+    compute_nodal_forces(nodalforces);
 
-    //converting nodalforce XC::BJtensor to vector
+    //converting nodalforce tensor to vector
     const int nodes_in_brick= getNumExternalNodes();
     for(int i = 0; i< nodes_in_brick; i++)
       for(int j = 0; j < 3; j++)
@@ -63,6 +63,7 @@ class Node;
 class MatPoint3D;
 class BJtensor;
 class stresstensor;
+template <size_t... Dims> class FixedTensor;
 
 //! @ingroup ElemVol
 //!
@@ -102,6 +103,10 @@ class TwentySevenNodeBrick: public ElementBase<27>
     //Matrix J; //!< Jacobian of transformation
     //Matrix L; //!< Inverse of J
     //Matrix B; //!< Strain interpolation matrix
+    void set_material_points(const NDMaterial *);
+  protected:
+    void compute_stiffness(FixedTensor<27,3,3,27> &) const;
+    void compute_nodal_forces(FixedTensor<27,3> &) const;
   public:
     TwentySevenNodeBrick(int element_number,
                    int node_numb_1,  int node_numb_2,  int node_numb_3,  int node_numb_4,
@@ -113,6 +118,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
                    int node_numb_25,  int node_numb_26,  int node_numb_27,
                    NDMaterial * Globalmmodel,  const BodyForces3D &,
        double r, double p);
+    TwentySevenNodeBrick(int tag, const NDMaterial *);
     TwentySevenNodeBrick(void);
     Element *getCopy(void) const;
     ~TwentySevenNodeBrick();
@@ -163,6 +169,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
     static BJtensor H_3D(double r1, double r2, double r3);
     BJtensor interp_poli_at(double r, double s, double t);
     static BJtensor dh_drst_at(double r, double s, double t);
+    static void dh_drst_at(double r, double s, double t, FixedTensor<27,3> &);
 
 
     TwentySevenNodeBrick & operator[](int subscript);
@@ -175,6 +182,7 @@ class TwentySevenNodeBrick: public ElementBase<27>
     BJtensor Jacobian_3D(const BJtensor &dh) const;
     BJtensor Jacobian_3Dinv(const BJtensor &dh) const;
     BJtensor Nodal_Coordinates(void) const;
+    void Nodal_Coordinates(FixedTensor<27,3> &) const;
 
     BJtensor incr_disp(void) const;
     BJtensor total_disp(void) const;
@@ -78,6 +78,7 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/recorder/response/ElementResponse.h>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 
 
 #define FixedOrder 2
@@ -93,55 +94,21 @@
  XC::Vector InfoSpq_all(2*FixedOrder*FixedOrder*FixedOrder+4); //p and q of all GS points + Sig11-33 +Strain_plastic_vv +psi
  XC::Vector Gsc8(FixedOrder*FixedOrder*FixedOrder*3+1); //Gauss point coordinates
 
-//====================================================================
-//Reorganized constructor ____ Zhaohui 02-10-2000
-//====================================================================
-
-XC::EightNodeBrick::EightNodeBrick(int element_number,
-                               int node_numb_1, int node_numb_2, int node_numb_3, int node_numb_4,
-                               int node_numb_5, int node_numb_6, int node_numb_7, int node_numb_8,
-                               NDMaterial * Globalmmodel, const BodyForces3D &bForces,
-             double r, double p)
-
-  :ElementBase<8>(element_number, ELE_TAG_EightNodeBrick ), Ki(0), bf(bForces),
-  rho(r), pressure(p)
+//! @brief Create the material points (one copy of the material for each
+//! Gauss point).
+void XC::EightNodeBrick::set_material_points(const NDMaterial *Globalmmodel)
   {
-    load.reset(24);
-    //BJ//BJ
-    //BJ    std::cerr << "\n\n\n\n Print in XC::EightNodeBrick::EightNodeBrick" <<std::endl; this->Print(std::cerr);
-    //BJ//BJ
-    //elem_numb= element_number;
-
     determinant_of_Jacobian= 0.0;
 
-    //r_integration_order= r_int_order;
-    //s_integration_order= s_int_order;
-    //t_integration_order= t_int_order;
     r_integration_order= FixedOrder; // Gauss-Legendre integration order in r direction
     s_integration_order= FixedOrder; // Gauss-Legendre integration order in s direction
     t_integration_order= FixedOrder; // Gauss-Legendre integration order in t direction
-    //Not needed. Right now we have one XC::NDMaterial for each material point
-    //mmodel= Globalmmodel->getCopy( type ); // One global mat model
-
-    int total_number_of_Gauss_points= r_integration_order*s_integration_order*t_integration_order;
 
+    const int total_number_of_Gauss_points= r_integration_order*s_integration_order*t_integration_order;
 
     if(total_number_of_Gauss_points != 0)
       { matpoint= std::vector<MatPoint3D>(total_number_of_Gauss_points); }
 
-    ////////////////////////////////////////////////////////////////////
-    //dakle posto:
-    //// according to ARM pp.61 default constructor will be called!!
-    //onda oni vec postoje u memoriji i samo im treba dodeliti prave
-    //vrednosti iz onog modela koji je prenesen unutra. Znaci onInitializxe funkcija
-    //sa modelom kao argumentom Initialize(taj_Model).
-    //za stresstensor i straintensor isto to napravi
-    //tu Initialize funkciju pa da uzima argument i da samo
-    //koristi njegove vrednosti pa stavi u vec postojece mesto
-    //u memoriji ove vrednsoti. Takodje unutar brick3d napravi ih
-    //( te stresstensor , straintensor i mmodel ) static da ostanu tu
-    //da se ne pozove destructor . . .
-
     short where= 0;
 
     for(short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
@@ -162,49 +129,41 @@ XC::EightNodeBrick::EightNodeBrick(int element_number,
                 // Gauss point from 3D array of short's
                 where= ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
 
-                //XC::DB::printf("\n\nBefore Initialization **************** where= %d \n",where);
-                //XC::DB::printf("GP_c_r= %d,  GP_c_s= %d,  GP_c_t= %d\n",
-                //DB            GP_c_r,GP_c_s,GP_c_t);
-                //DB
-                //DBGPstress[where].reportshort("stress within before Initialization");
-                //DBGPstrain[where].reportshort("strain within before Initialization");
-                //DB
-                //DB// I suspect that [] should be overloaded so that compiler knows which
-                //DB// material model is returning a pointer and for the purpose
-                //DB//matpoint[where].report("mmodel within before Initialization");
-                //DB//matpoint[where].report("mmodel within before Initialization"); // operator[] overloaded
-                //DB(matpoint)->operator[](where).report("mmodel within before Initialization"); // operator[] overloaded
-                //DB                                                               // for XC::NDMaterial and
-                //DB                                                               // derived types!
-
-                // Zhaohui  09-30-2000
-                //GPtangent_E[where].Initialize_all(*IN_tangent_E);
-                //GPstress[where].Initialize(*INstress);
-                //GPiterative_stress[where].Initialize(*INiterative_stress);
-                //GPq_ast_iterative[where]= IN_q_ast_iterative[where];
-                //GPstrain[where].Initialize(*INstrain);
-
-                // Already assigned the copy of Globalmmodel to each element of matpoint
-                //(matpoint)->operator[](where).Initialize(*Globalmmodel);
-
-                //NDMaterial *NMD= Globalmmodel->getCopy();
-                //if(strcmp( Globalmmodel->getType(), "Template3Dep" ) == 0)
-                //   NMD= 0;
-
-                //std::cerr << "where= " << where << std::std::endl;
-                matpoint[where]= MatPoint3D(GP_c_r,GP_c_s,GP_c_t,r, s, t,rw, sw, tw,
-                                         //InitEPS,
-                   Globalmmodel);
-                //NMD);
-                //&( GPstress[where] ), //&( GPiterative_stress[where] ), //IN_q_ast_iterative[where] ,//&( GPstrain[where] ),  //&( GPtangent_E[where] ),
-                                         //&( (matpoint)->operator[](where) )
-                                         // ugly syntax but it works! Still don't know what's wrong   // with the old style matpoint[where]
+                // Each material point stores its own copy of Globalmmodel.
+                matpoint[where]= MatPoint3D(GP_c_r,GP_c_s,GP_c_t,r, s, t,rw, sw, tw, Globalmmodel);
               }
           }
       }
+  }
 
-      // Set connected external node IDs
-      theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
+//====================================================================
+//Reorganized constructor ____ Zhaohui 02-10-2000
+//====================================================================
+
+XC::EightNodeBrick::EightNodeBrick(int element_number,
+                               int node_numb_1, int node_numb_2, int node_numb_3, int node_numb_4,
+                               int node_numb_5, int node_numb_6, int node_numb_7, int node_numb_8,
+                               NDMaterial * Globalmmodel, const BodyForces3D &bForces,
+             double r, double p)
+
+  :ElementBase<8>(element_number, ELE_TAG_EightNodeBrick ), Ki(0), bf(bForces),
+  rho(r), pressure(p), mmodel(nullptr)
+  {
+    load.reset(24);
+    set_material_points(Globalmmodel);
+
+    // Set connected external node IDs
+    theNodes.set_id_nodes(node_numb_1,node_numb_2,node_numb_3,node_numb_4,node_numb_5,node_numb_6,node_numb_7,node_numb_8);
+  }
+
+//! @brief Constructor (the nodes are set afterwards), used by the
+//! element handler. The density is the one of the material.
+XC::EightNodeBrick::EightNodeBrick(int tag, const NDMaterial *ptr_mat)
+  :ElementBase<8>(tag, ELE_TAG_EightNodeBrick), Ki(0), bf(3),
+   rho(ptr_mat->getRho()), pressure(0.0), mmodel(nullptr)
+  {
+    load.reset(24);
+    set_material_points(ptr_mat);
   }
 
 //====================================================================
@@ -689,9 +648,15 @@ XC::BJtensor XC::EightNodeBrick::H_3D(double r1, double r2, double r3) const
 
  XC::BJtensor XC::EightNodeBrick::dh_drst_at(double r1, double r2, double r3) const
   {
+    FixedTensor<8,3> dh;
+    dh_drst_at(r1, r2, r3, dh);
+    return dh.getBJtensor();
+  }
 
-    std::vector<int> dimensions({8,3});  // Changed from{20,3} to {8,3} Xiaoyan 07/12
-    BJtensor dh(dimensions, 0.0);
+//! @brief Compute the derivatives of the shape functions with respect
+//! to the natural coordinates at the point (r1, r2, r3).
+void XC::EightNodeBrick::dh_drst_at(double r1, double r2, double r3, FixedTensor<8,3> &dh) const
+  {
 
 
     // influence of the node number 8
@@ -728,7 +693,6 @@ XC::BJtensor XC::EightNodeBrick::H_3D(double r1, double r2, double r3) const
     dh(1,2)= (1.0+r1)*(1.0+r3)*0.125; ///8.0;// - (dh(12,2)+dh(17,2)+dh(9,2))/2.0;
     dh(1,3)= (1.0+r1)*(1.0+r2)*0.125; ///8.0;//- (dh(12,3)+dh(17,3)+dh(9,3))/2.0;
                // Commented by Xiaoyan
-    return dh;
   }
 
 ////#############################################################################
@@ -751,232 +715,49 @@ XC::BJtensor XC::EightNodeBrick::H_3D(double r1, double r2, double r3) const
 ////#############################################################################
  XC::BJtensor XC::EightNodeBrick::getStiffnessTensor(void) const
   {
+    FixedTensor<8,3,3,8> Kk;
+    compute_stiffness(Kk);
+    return Kk.getBJtensor();
+  }
 
-
-//BJ//BJ
-//BJ    std::cerr << "\n\n\n\n Print in XC::BJtensor XC::EightNodeBrick::getStiffnessTensor(void) " <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-    std::vector<int> K_dim({8,3,3,8});  // Xiaoyan changed from {20,3,3,20} to {8,3,3,8}
-            // for 8 nodes      07/12
-    BJtensor Kk(K_dim,0.0);
-    BJtensor Kkt(K_dim,0.0);
-
-    //debugging
-    matrix Kmat;
-
-    double r= 0.0;
-    double rw= 0.0;
-    double s= 0.0;
-    double sw= 0.0;
-    double t= 0.0;
-    double tw= 0.0;
-
-    short where= 0;
-    double weight= 0.0;
-
-    std::vector<int> dh_dim({8,3});  // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor dh(dh_dim, 0.0);
-
-    //    BJtensor Constitutive( def_dim_4, 0.0);
-    BJtensor Constitutive;
-
-    double det_of_Jacobian= 0.0;
-
-    static std::vector<int> disp_dim({8,3});   // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    straintensor incremental_strain;
-//    straintensor total_strain_at_GP;
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor JacobianINVtemp;
-    BJtensor dhGlobal;
-
-    //double tmp= 0;
-
-
-    // BJtensor of incremental displacements taken from node objects
-    //incremental_displacements= incr_disp();
-    //std::cerr << "\n=======" << getTag() << "===========\n";
-    //incremental_displacements.print("incr_disp");
-
+//! @brief Compute the stiffness tensor of the element.
+//!
+//! The Gauss point loop works with stack allocated tensors (see
+//! FixedTensor) to avoid the memory allocations and the parsing
+//! of the index strings of the BJtensor products.
+void XC::EightNodeBrick::compute_stiffness(FixedTensor<8,3,3,8> &Kk) const
+  {
+    Kk.Zero();
+    FixedTensor<8,3> N_C;
+    Nodal_Coordinates(N_C);
+    FixedTensor<8,3> dh;
+    FixedTensor<8,3> dhGlobal;
     for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r= get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw= get_Gauss_p_w( r_integration_order, GP_c_r );
+        const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw= get_Gauss_p_w( r_integration_order, GP_c_r );
         for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s= get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw= get_Gauss_p_w( s_integration_order, GP_c_s );
+            const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw= get_Gauss_p_w( s_integration_order, GP_c_s );
             for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t= get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw= get_Gauss_p_w( t_integration_order, GP_c_t );
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
+                const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw= get_Gauss_p_w( t_integration_order, GP_c_t );
+                // position of the Gauss point in the matpoint array.
+                const short where=
                    ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-                // derivatives of local coordinates with respect to local coordinates
-                dh= dh_drst_at(r,s,t);
-    //dh.print("dh");
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian= Jacobian_3D(dh);
-                //Jacobian.print("J");
-
-    // Inverse of Jacobian XC::BJtensor ( matrix )
-                //JacobianINV= Jacobian_3Dinv(dh);
-                JacobianINV= Jacobian.inverse();
-    //JacobianINVtemp= JacobianINVtemp - JacobianINV;
-    //JacobianINV.print();
-       //JacobianINVtemp.print();
-
-                //JacobianINV= Jacobian.inverse(); //Zhaohui 08-31-2001
-
-
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian= Jacobian.determinant();
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                dhGlobal= dh("ij") * JacobianINV("kj");
-                //        ::fprintf(stdout," # %d \n\n\n\n\n\n\n\n", El_count);
-    //dhGlobal.print("dhGlobal");
-                //weight
-                weight= rw * sw * tw * det_of_Jacobian;
-                //::::
-                //printf("\n\nIN THE STIFFNESS TENSOR INTEGRATOR ----**************** where= %d \n", where);
-                //printf("  Stifness_Tensor \n");
-                //printf("                    GP_c_r= %d,  GP_c_s= %d,  GP_c_t= %d\n",
-                //                            GP_c_r,GP_c_s,GP_c_t);
-                //printf("WEIGHT= %f", weight);
-                //Jacobian.print("J");
-                //JacobianINV.print("JINV");
-                //JacobianINVtemp.print("JINVtemp");
-                //BJtensor I= JacobianINV("ij")*Jacobian("jk");
-                //I.print("I");
-
-                //printf("determinant of Jacobian= %.6e", det_of_Jacobian);
-                //matpoint[where].report("Gauss Point\n");
-
-                // incremental strains at this Gauss point
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor1\n");
-
-    //incremental_strain =
-                //     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-
-    //incremental_strain.null_indices();
-                //incremental_strain.report("\n incremental_strain XC::BJtensor at GAUSS point\n");
-
-    // incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor2\n");
-                // initialize total strain with the strain at this Gauss point before
-                // adding this increments strains!
-                //                total_strain_at_GP.Initialize(*(GPstrain+where));
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point BEFORE\n");
-                // this is the addition of incremental strains to the previous strain state at
-                // this Gauss point
-                //                total_strain_at_GP= total_strain_at_GP + incremental_strain;
-                //total_strain_at_GP.reportshort("\n total_strain XC::BJtensor at GAUSS point AFTER\n");
-                //..   dakle ovde posalji strain_increment jer se stari stress cuva u okviru svake
-                //..   Gauss tacke a samo saljes strain_increment koji ce da se prenese
-                //..   u integracionu rutinu pa ce ta da vrati krajnji napon i onda moze da
-                //..   se pravi ConstitutiveStiffnessTensor.
-                // here comes the final_stress calculation
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point.
-
-                //final_stress_after_integration =
-                //    (matpoint)->operator[](where).FinalStress(*(GPstress+where),
-                //                                 incremental_strain,
-                //                                 (matpoint)->operator[](where),
-                //                                 number_of_subincrements,
-                //                                 this_one_PP);
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration in stiffness_tensor5\n");
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor3\n");
-                //final_stress_after_integration.reportshortpqtheta("\n final_stress_after_integration GAUSS \n");
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor4\n");
-
-                // this final stress after integration is used ONLY to obtain Constitutive XC::BJtensor
-                // at this Gauss point AND to set up the iterative_stress that is used in calculting
-                // internal forces during iterations!!
-
-                //GPiterative_stress[where].Initialize(final_stress_after_integration);
-                //GPiterative_stress[where].reportshortpqtheta("\n iterative_stress at GAUSS point in stiffness_tensor5\n");
-
-
-                // Stress state at Gauss point will be updated ( in the
-                // sense of updating stresses ( integrating them ) ) in function Update (...) ! ! ! ! !
-                // calculate the constitutive XC::BJtensor
-                //......         Constitutive=  GPtangent_E[where];
-
-    //Constitutive=  (matpoint)->operator[](where).ConstitutiveTensor(final_stress_after_integration,
-                //                                         *(GPstress+where),
-                //                                          incremental_strain,
-                //                                          (matpoint)->operator[](where),
-                //                                          this_one_PP);
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-          //EPState *tmp_eps= (matpoint[where]).getEPS();
-          //NDMaterial *tmp_ndm= (matpoint[where]).getNDMat();
-
-    //if( tmp_eps ) {     //Elasto-plastic case
-    //    mmodel->setEPS( *tmp_eps );
-
-    //int err= ( matpoint[where].matmodel )->setTrialStrainIncr( incremental_strain);
-    //if( err)
-                 //   std::cerr << "XC::EightNodeBrick::getStiffnessTensor (tag: %d), not converged",
-    //         this->getTag());
-
-    Constitutive= (matpoint[where].matmodel)->getTangentTensor();
-                //Constitutive.print("C","\n\n C XC::BJtensor \n");
-
-    //    matpoint[where].setEPS( mmodel->getEPS() );
-    //}
-    //else if( tmp_ndm ) { //Elastic case
-    //    (matpoint[where].p_matmodel)->setTrialStrainIncr( incremental_strain );
-    //    Constitutive= (matpoint[where].p_matmodel)->getTangentTensor();
-    //}
-    //else {
-                 //   std::cerr << "XC::EightNodeBrick::incremental_Update (tag: %d), could not getTangentTensor", this->getTag();
-    //   exit(1);
-    //}
-
-    //printf("Constitutive.trace= %12.6e\n", Constitutive.trace());
-                //Kmat= this->stiffness_matrix(Constitutive);
-                //printf("Constitutive XC::BJtensor max:= %10.3e\n", Kmat.mmax());
-
-                //----   GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor5\n");
-                // this is update of constitutive XC::BJtensor at this Gauss point
-                //GPtangent_E[where].Initialize(Constitutive);
-                //....GPtangent_E[where].print(" tangent E at GAUSS point");
-
-                //GPstress[where].reportshortpqtheta("\n stress at GAUSS point in stiffness_tensor6\n");
-
-                //K= K + temp2;
-
-    Kkt= dhGlobal("ib")*Constitutive("abcd");
-    Kkt= Kkt("aicd")*dhGlobal("jd")*weight;
-       Kk= Kk + Kkt;
-
-    //Kk= Kk + dhGlobal("ib")*Constitutive("abcd")*dhGlobal("jd")*weight;
-                //....K.print("K","\n\n K XC::BJtensor \n");
-
-    //Kmat= this->stiffness_matrix(Kkt);
-                //Kmat.print("Kmat");
-
-    //printf("K XC::BJtensor max= %10.3e\n", Kmat.mmax());
-
-                //convert constitutive and K to matrix and find min and max and print!
-
-
-
+                // derivatives of the shape functions with respect to the
+                // local and to the global coordinates.
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian= global_shape_derivatives(dh, N_C, dhGlobal);
+                const double weight= rw * sw * tw * det_of_Jacobian;
+                const FixedTensor4 Constitutive((matpoint[where].matmodel)->getTangentTensor());
+                // Kk_nklm+= dhGlobal_nb*C_kbld*dhGlobal_md*weight
+                add_stiffness_contribution(Kk, dhGlobal, Constitutive, weight);
               }
           }
       }
-    //Kk.print("K","\n\n K XC::BJtensor \n");
-    //K= Kk;
-    return Kk;
   }
 
 
@@ -1267,44 +1048,22 @@ XC::BJtensor XC::EightNodeBrick::stiffness_matrix(const BJtensor & K)
 ////#############################################################################
  XC::BJtensor XC::EightNodeBrick::Nodal_Coordinates(void) const
   {
-    const std::vector<int> dimensions({8,3});  // Xiaoyan changed from {20,3} to {8,3} for 8 nodes
-    BJtensor N_coord(dimensions, 0.0);
-
-    //for( int i=0 ; i<8 ; i++ )    // Xiaoyan changed from 20 to 8 for 8 nodes
-    //  {
-    //    //        N_coord(i+1,1)= nodes[ G_N_numbs[i] ].x_coordinate();
-    //    //        N_coord(i+1,2)= nodes[ G_N_numbs[i] ].y_coordinate();
-    //    //        N_coord(i+1,3)= nodes[ G_N_numbs[i] ].z_coordinate();
-    //    // Xiaoyan changed to the following:  09/27/00
-    //    /// LOOK WITH DDD
-    //  Vector Coordinates= nodes[ G_N_numbs[i] ].getCrds();
-    //    N_coord(i+1,1)= Coordinates(0);
-    //    N_coord(i+1,2)= Coordinates(1);
-    //    N_coord(i+1,3)= Coordinates(2);
-    //  }
+    FixedTensor<8,3> N_coord;
+    Nodal_Coordinates(N_coord);
+    return N_coord.getBJtensor();
+  }
 
+//! @brief Return the coordinates of the nodes (one row per node).
+void XC::EightNodeBrick::Nodal_Coordinates(FixedTensor<8,3> &N_coord) const
+  {
     //Zhaohui using node pointers, which come from the XC::Domain
-    const XC::Vector &nd1Crds= theNodes[0]->getCrds();
-    const XC::Vector &nd2Crds= theNodes[1]->getCrds();
-    const XC::Vector &nd3Crds= theNodes[2]->getCrds();
-    const XC::Vector &nd4Crds= theNodes[3]->getCrds();
-    const XC::Vector &nd5Crds= theNodes[4]->getCrds();
-    const XC::Vector &nd6Crds= theNodes[5]->getCrds();
-    const XC::Vector &nd7Crds= theNodes[6]->getCrds();
-    const XC::Vector &nd8Crds= theNodes[7]->getCrds();
-
-    N_coord(1,1)=nd1Crds(0); N_coord(1,2)=nd1Crds(1); N_coord(1,3)=nd1Crds(2);
-    N_coord(2,1)=nd2Crds(0); N_coord(2,2)=nd2Crds(1); N_coord(2,3)=nd2Crds(2);
-    N_coord(3,1)=nd3Crds(0); N_coord(3,2)=nd3Crds(1); N_coord(3,3)=nd3Crds(2);
-    N_coord(4,1)=nd4Crds(0); N_coord(4,2)=nd4Crds(1); N_coord(4,3)=nd4Crds(2);
-    N_coord(5,1)=nd5Crds(0); N_coord(5,2)=nd5Crds(1); N_coord(5,3)=nd5Crds(2);
-    N_coord(6,1)=nd6Crds(0); N_coord(6,2)=nd6Crds(1); N_coord(6,3)=nd6Crds(2);
-    N_coord(7,1)=nd7Crds(0); N_coord(7,2)=nd7Crds(1); N_coord(7,3)=nd7Crds(2);
-    N_coord(8,1)=nd8Crds(0); N_coord(8,2)=nd8Crds(1); N_coord(8,3)=nd8Crds(2);
-
-    //N_coord.print();
-
-    return N_coord;
+    for(int i= 0;i<8;i++)
+      {
+        const Vector &ndCrds= theNodes[i]->getCrds();
+        N_coord(i+1,1)= ndCrds(0);
+        N_coord(i+1,2)= ndCrds(1);
+        N_coord(i+1,3)= ndCrds(2);
+      }
   }
 
 ////#############################################################################
@@ -1484,202 +1243,44 @@ int * XC::EightNodeBrick::get_LM(void)
 // returns nodal forces for given stress field in an element
 XC::BJtensor XC::EightNodeBrick::nodal_forces(void) const
   {
+    FixedTensor<8,3> nodal_forces;
+    compute_nodal_forces(nodal_forces);
+    return nodal_forces.getBJtensor();
+  }
 
-//BJ//BJ
-//BJ    std::cerr << "\n\n\n\n Print in XC::BJtensor XC::EightNodeBrick::nodal_forces(" <<std::endl; this->Print(std::cerr);
-//BJ//BJ
-
-    std::vector<int> force_dim({8,3});  // Xiaoyan changed from {20,3 to {8,3} for 8 nodes
-
-    BJtensor nodal_forces(force_dim,0.0);
-
-    double r= 0.0;
-    double rw= 0.0;
-    double s= 0.0;
-    double sw= 0.0;
-    double t= 0.0;
-    double tw= 0.0;
-
-    short where= 0;
-    double weight= 0.0;
-
-    std::vector<int> dh_dim({8,3});  // Xiaoyan changed from {20,3 to {8,3} for 8 nodes
-
-    BJtensor dh(dh_dim, 0.0);
-
-    stresstensor stress_at_GP(0.0);
-
-    double det_of_Jacobian= 0.0;
-
-    straintensor incremental_strain;
-
-    static std::vector<int> disp_dim({8,3});   // Xiaoyan changed from {20,3} to {8,3}
-    BJtensor incremental_displacements(disp_dim,0.0); // \Delta u
-
-    incremental_displacements= incr_disp();
-
-    BJtensor Jacobian;
-    BJtensor JacobianINV;
-    BJtensor dhGlobal;
-
+//! @brief Compute the nodal forces that correspond to the stresses
+//! at the Gauss points.
+void XC::EightNodeBrick::compute_nodal_forces(FixedTensor<8,3> &nodal_forces) const
+  {
+    nodal_forces.Zero();
+    FixedTensor<8,3> N_C;
+    Nodal_Coordinates(N_C);
+    FixedTensor<8,3> dh;
+    FixedTensor<8,3> dhGlobal;
     for( short GP_c_r= 1 ; GP_c_r <= r_integration_order ; GP_c_r++ )
       {
-        r= get_Gauss_p_c( r_integration_order, GP_c_r );
-        rw= get_Gauss_p_w( r_integration_order, GP_c_r );
-
+        const double r= get_Gauss_p_c( r_integration_order, GP_c_r );
+        const double rw= get_Gauss_p_w( r_integration_order, GP_c_r );
         for( short GP_c_s= 1 ; GP_c_s <= s_integration_order ; GP_c_s++ )
           {
-            s= get_Gauss_p_c( s_integration_order, GP_c_s );
-            sw= get_Gauss_p_w( s_integration_order, GP_c_s );
-
+            const double s= get_Gauss_p_c( s_integration_order, GP_c_s );
+            const double sw= get_Gauss_p_w( s_integration_order, GP_c_s );
             for( short GP_c_t= 1 ; GP_c_t <= t_integration_order ; GP_c_t++ )
               {
-                t= get_Gauss_p_c( t_integration_order, GP_c_t );
-                tw= get_Gauss_p_w( t_integration_order, GP_c_t );
-
-                // this short routine is supposed to calculate position of
-                // Gauss point from 3D array of short's
-                where =
-                ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
-
-                // derivatives of local coordiantes with respect to local coordiantes
-                dh= dh_drst_at(r,s,t);
-
-                // Jacobian XC::BJtensor ( matrix )
-                Jacobian= Jacobian_3D(dh);
-                //....                Jacobian.print("J");
-
-                // Inverse of Jacobian XC::BJtensor ( matrix )
-                JacobianINV= Jacobian_3Dinv(dh);
-                //....                JacobianINV.print("JINV");
-
-                // determinant of Jacobian XC::BJtensor ( matrix )
-                det_of_Jacobian= Jacobian.determinant();
-                //....  ::printf("determinant of Jacobian is %f\n",Jacobian_determinant );
-
-                // Derivatives of local coordinates multiplied with inverse of Jacobian (see Bathe p-202)
-                dhGlobal= dh("ij") * JacobianINV("kj");
-
-                //weight
-                weight= rw * sw * tw * det_of_Jacobian;
-    //std::cerr << " UCD det_of_Jacobian "<< det_of_Jacobian << std::endl;
-                //..::printf("\n\nIN THE nodal forces ----**************** where= %d \n", where);
-                //..::printf("                    GP_c_r= %d,  GP_c_s= %d,  GP_c_t= %d\n",
-                //..                           GP_c_r,GP_c_s,GP_c_t);
-                //..::printf("WEIGHT= %f", weight);
-                //..::printf("determinant of Jacobian= %f", det_of_Jacobian);
-                //..matpoint[where].report("Gauss Point\n");
-
-                //..    just determine this BJtensor E yet and for each gauss point different !!!!!!!!!!!!
-                //..    here should be based on incremental shifts somewhere
-                //..    find incremental deformation (strain_increment) and then with it:
-                //..
-                //// BJtensor of incremental displacements taken from node objects
-                //                incremental_displacements= incr_disp();
-                //
-                //// incremental strains at this Gauss point
-                //                incremental_strain =
-                //                  (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-                //
-                //                incremental_strain.null_indices();
-                ////incremental_strain.reportshort("\n incremental_strain XC::BJtensor at GAUSS point\n");
-                //
-                ////                integr_type= (matpoint)->operator[](where).integration_type();
-                ////                if( !strcmp(integr_type,"BakcwardEuler")
-
-                //..  so send stress_increment here because old stress is stored within each
-                //..  Gauss points and only send strain_increment to be transmitted
-                //..  into the integration routine so that it will return the final voltage and then it can
-                //..  that is, the ConstitutiveStiffnessTensor.
-                //..  Actually send everything you have (incremental_strain, start_stress,
-                //..  number_of_subincrements. . . into this Constitutive_tensor function
-                //..  so let it go, depending on the model used and let
-                //..  then there in each special model function return what it needs
-                //..  (say Elastic returns Eelastic immediately and let's say MRS_Lade first
-                //..  asks what method of integration to use and then depending on it
-                //..  call function which integrals for that algorithm (ForwardEuler, BakcwardEuler,
-                //..  SemiBackwardEuler ,. . . ) and then when the function returns voltage then
-                //..  one wonders again what type of integration was at stake so the right one
-                //..  ConstitutiveTensor and brings it back!
-
-                //                   stress_at_GP= (GPstress)->operator[](where);
-                //stress_at_GP= GPstress[where];
-
-          //EPState *tmp_eps= (matpoint[where].matmodel)->getEPS();
-    //stress_at_GP= tmp_eps->getStress();
-    //std::cerr << "tmp_eps" << (*tmp_eps);
-
-          //NDMaterial *tmp_ndm= (matpoint[where]).getNDMat();
-
-    //if( tmp_eps ) {     //Elasto-plastic case
-
-    //stress_at_GP= (matpoint[where].matmodel->getEPS())->getStress();
-
-    //   EPState *tmp_eps= (matpoint[where].matmodel)->getEPS();
-    //   stress_at_GP= tmp_eps->getStress();
-
-
-
-//Guanzhou out 5-6-2004    incremental_strain =
-//Guanzhou out 5-6-2004                     (dhGlobal("ib")*incremental_displacements("ia")).symmetrize11();
-//Guanzhou out 5-6-2004//    if(where == 0)
-//Guanzhou out 5-6-2004//       //std::cerr << " In nodal_force delta_incremental_strain tag "<< getTag() <<"  " <<incremental_strain << std::endl;
-//Guanzhou out 5-6-2004////    std::cerr << " el tag= "<< getTag();
-//Guanzhou out 5-6-2004//
-//Guanzhou out 5-6-2004    int err= ( matpoint[where].matmodel )->setTrialStrainIncr( incremental_strain);
-//Guanzhou out 5-6-2004    if( err)
-//Guanzhou out 5-6-2004      std::cerr << "XC::EightNodeBrick::getStiffnessTensor (tag: " << this->getTag() << "), not converged\n";
-
-
-    //char *test= matpoint[where].matmodel->getType();
-    // fmk - changing if so if into else block must be XC::Template3Dep
-//    if(strcmp(matpoint[where].matmodel->getType(),"Template3Dep") != 0)
-       stress_at_GP= matpoint[where].getStressTensor();
-
-//         stress_at_GP.report("PROBLEM");
-//         getchar();
-
-//    else
-//    {
-//             //Some thing funny happened when getting stress directly from matpoint[where], i have to do it this way!
-//       EPState *tmp_eps= ((Template3Dep *)(matpoint[where].matmodel))->getEPS();
-//       stress_at_GP= tmp_eps->getStress();
-//       //delete tmp_eps;
-//           }
-
-             //double  p= stress_at_GP.p_hydrostatic();
-                //if( p < 0.0 )
-          //{
-          //  std::cerr << getTag();
-          //  std::cerr << " ***p=    " << p << std::endl;
-          //}
-
-    //std::cerr << " nodal_force :: stress_at_GP " << stress_at_GP << std::endl;
-
-    //}
-    //else if( tmp_ndm ) { //Elastic case
-               //    stress_at_GP= (matpoint[where].getNDMat())->getStressTensor();
-    //}
-    //else {
-                 //   std::cerr << "XC::EightNodeBrick::nodal_forces (tag: %d), could not getStress", this->getTag();
-    //   exit(1);
-    //}
-
-                //stress_at_GP.report("\n stress_at_GPtensor at GAUSS point for nodal forces \n");
-
-                // nodal forces See Zienkievicz part 1 pp 108
-                nodal_forces =
-                     nodal_forces + dhGlobal("ib")*stress_at_GP("ab")*weight;
-                //nodal_forces.print("nf","\n\n Nodal Forces \n");
-
+                const double t= get_Gauss_p_c( t_integration_order, GP_c_t );
+                const double tw= get_Gauss_p_w( t_integration_order, GP_c_t );
+                // position of the Gauss point in the matpoint array.
+                const short where=
+                   ((GP_c_r-1)*s_integration_order+GP_c_s-1)*t_integration_order+GP_c_t-1;
+                dh_drst_at(r,s,t,dh);
+                const double det_of_Jacobian= global_shape_derivatives(dh, N_C, dhGlobal);
+                const double weight= rw * sw * tw * det_of_Jacobian;
+                const FixedTensor2 stress_at_GP(matpoint[where].getStressTensor());
+                // nodal_forces_ia+= dhGlobal_ib*stress_ab*weight
+                nodal_forces.addTensor(mult_transposed(dhGlobal, stress_at_GP), weight);
               }
           }
       }
-
-    //std::cerr << "\n element no. " << getTag() << std::endl;
-    //nodal_forces.print("nf","\n Nodal Forces \n");
-    return nodal_forces;
-
   }
 
 ////#############################################################################
@@ -2621,25 +2222,13 @@ const XC::Matrix &XC::EightNodeBrick::getTangentStiff(void) const
 
 
 
-     BJtensor stifftensor= getStiffnessTensor();
-     int Ki=0;
-     int Kj=0;
-
+     FixedTensor<8,3,3,8> stifftensor;
+     compute_stiffness(stifftensor);
      for( int i=1 ; i<=8 ; i++ )
-     {
-        for( int j=1 ; j<=8 ; j++ )
-        {
-           for( int k=1 ; k<=3 ; k++ )
-           {
-              for( int l=1 ; l<=3 ; l++ )
-              {
-                 Ki= k+3*(i-1);
-                 Kj= l+3*(j-1);
-                 K( Ki-1 , Kj-1 )= stifftensor(i,k,l,j);
-              }
-           }
-        }
-     }
+       for( int k=1 ; k<=3 ; k++ )
+         for( int l=1 ; l<=3 ; l++ )
+           for( int j=1 ; j<=8 ; j++ )
+             K( k+3*(i-1)-1 , l+3*(j-1)-1 )= stifftensor(i,k,l,j);
 
      //std::cerr << " K " << K << std::endl;
      //K.Output(std::cerr);
@@ -2966,12 +2555,10 @@ const XC::Vector &XC::EightNodeBrick::getResistingForce(void) const
 //BJ    std::cerr << "\n\n\n\n Print in const XC::Vector &XC::EightNodeBrick::getResistingForce ()" <<std::endl; this->Print(std::cerr);
 //BJ//BJ
 
-    std::vector<int> force_dim({8,3});
-    BJtensor nodalforces(force_dim,0.0);
-
-    nodalforces= nodal_forces();
+    FixedTensor<8,3> nodalforces;
+    compute_nodal_forces(nodalforces);
 
-    //converting nodalforce XC::BJtensor to vector
+    //converting nodalforce tensor to vector
     for(int i= 0; i< 8; i++)
       for(int j= 0; j < 3; j++)
           P(i *3 + j)= nodalforces(i+1, j+1);
@@ -75,6 +75,7 @@ class MatPoint3D;
 class stresstensor;
 class Information;
 class BJtensor;
+template <size_t... Dims> class FixedTensor;
 //class QuadRule1d;
 
 //! @ingroup ElemVol
@@ -144,6 +145,10 @@ class EightNodeBrick: public ElementBase<8>
 
 
     int  LM[24]; //!< for 8noded x 3 = 24
+    void set_material_points(const NDMaterial *);
+  protected:
+    void compute_stiffness(FixedTensor<8,3,3,8> &) const;
+    void compute_nodal_forces(FixedTensor<8,3> &) const;
   public:
     EightNodeBrick(int element_number,
                    int node_numb_1, int node_numb_2, int node_numb_3, int node_numb_4,
@@ -152,6 +157,7 @@ class EightNodeBrick: public ElementBase<8>
                   double r, double p);
    // int dir, double surflevel);
    //, EPState *InitEPS);   const std::string &type,
+    EightNodeBrick(int tag, const NDMaterial *);
 
     EightNodeBrick(void);
     Element *getCopy(void) const;
@@ -210,6 +216,7 @@ class EightNodeBrick: public ElementBase<8>
     BJtensor H_3D(double r1, double r2, double r3) const;
     BJtensor interp_poli_at(double r, double s, double t);
     BJtensor dh_drst_at(double r, double s, double t) const;
+    void dh_drst_at(double r, double s, double t, FixedTensor<8,3> &) const;
 
 
     //CE Dynamic Allocation for for brick3d s.
@@ -228,6 +235,7 @@ class EightNodeBrick: public ElementBase<8>
     BJtensor Jacobian_3D(const BJtensor &dh) const;
     BJtensor Jacobian_3Dinv(const BJtensor &dh) const;
     BJtensor Nodal_Coordinates(void) const;
+    void Nodal_Coordinates(FixedTensor<8,3> &) const;
 
     BJtensor incr_disp(void) const;
     BJtensor total_disp(void) const;
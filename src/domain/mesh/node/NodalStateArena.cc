@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodalStateArena.cc
+
+#include "NodalStateArena.h"
+#include "Node.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::NodalStateArena::NodalStateArena(void)
+  : enabled(false), packed(false), storageStamp(0) {}
+
+//! @brief Return the number of values stored in the arena.
+size_t XC::NodalStateArena::size(void) const
+  { return dispValues.size()+velValues.size()+accelValues.size(); }
+
+//! @brief Compute the location in the arena arrays of the trial
+//! displacement, velocity and acceleration of the node. Return false
+//! if the node doesn't use the arena (i.e. it has been added after
+//! packing it).
+//!
+//! @param n: node to locate.
+//! @param dispOffset: location of the node trial displacement.
+//! @param velOffset: location of the node trial velocity.
+//! @param accelOffset: location of the node trial acceleration.
+bool XC::NodalStateArena::getOffsets(const Node &n, size_t &dispOffset, size_t &velOffset, size_t &accelOffset) const
+  {
+    const double *dispPtr= n.getTrialDisp().getDataPtr();
+    const double *velPtr= n.getTrialVel().getDataPtr();
+    const double *accelPtr= n.getTrialAccel().getDataPtr();
+    const bool retval= (!dispValues.empty() && (dispPtr>=dispValues.data()) && (dispPtr<dispValues.data()+dispValues.size()) &&
+                        (velPtr>=velValues.data()) && (velPtr<velValues.data()+velValues.size()) &&
+                        (accelPtr>=accelValues.data()) && (accelPtr<accelValues.data()+accelValues.size()));
+    if(retval)
+      {
+        dispOffset= dispPtr-dispValues.data();
+        velOffset= velPtr-velValues.data();
+        accelOffset= accelPtr-accelValues.data();
+      }
+    return retval;
+  }
+
+//! @brief Move the state of the nodes to new contiguous arrays,
+//! following the order of the argument. The previous arrays are
+//! released once all the nodes have been moved.
+//!
+//! @param theNodes: nodes of the mesh.
+//! @return number of nodes in the arena.
+int XC::NodalStateArena::pack(const std::vector<Node *> &theNodes)
+  {
+    // compute the sizes of the arrays.
+    size_t numDisp= 0, numVel= 0, numAccel= 0;
+    for(std::vector<Node *>::const_iterator i= theNodes.begin();i!=theNodes.end();i++)
+      {
+        const Node *nodePtr= *i;
+        numDisp+= nodePtr->getNumDispValues();
+        numVel+= nodePtr->getNumVelValues();
+        numAccel+= nodePtr->getNumAccelValues();
+      }
+    std::vector<double> newDisp(numDisp, 0.0);
+    std::vector<double> newVel(numVel, 0.0);
+    std::vector<double> newAccel(numAccel, 0.0);
+    // move the values of the nodes.
+    double *dispPtr= newDisp.data();
+    double *velPtr= newVel.data();
+    double *accelPtr= newAccel.data();
+    for(std::vector<Node *>::const_iterator i= theNodes.begin();i!=theNodes.end();i++)
+      {
+        Node *nodePtr= *i;
+        nodePtr->setStateStorage(dispPtr, velPtr, accelPtr);
+        dispPtr+= nodePtr->getNumDispValues();
+        velPtr+= nodePtr->getNumVelValues();
+        accelPtr+= nodePtr->getNumAccelValues();
+      }
+    // no node uses the old arrays now.
+    dispValues.swap(newDisp);
+    velValues.swap(newVel);
+    accelValues.swap(newAccel);
+    packed= true;
+    storageStamp++;
+    return theNodes.size();
+  }
+
+//! @brief Release the memory of the arena. Must be called only when
+//! no node uses it (i.e. after removing all the nodes of the mesh).
+void XC::NodalStateArena::clear(void)
+  {
+    std::vector<double>().swap(dispValues);
+    std::vector<double>().swap(velValues);
+    std::vector<double>().swap(accelValues);
+    packed= false;
+    storageStamp++;
+  }
+
+//! @brief Return a copy of the values stored in the arena
+//! (displacements, velocities and accelerations).
+XC::Vector XC::NodalStateArena::getSnapshot(void) const
+  {
+    Vector retval(size());
+    double *ptr= retval.getDataPtr();
+    ptr= std::copy(dispValues.begin(), dispValues.end(), ptr);
+    ptr= std::copy(velValues.begin(), velValues.end(), ptr);
+    std::copy(accelValues.begin(), accelValues.end(), ptr);
+    return retval;
+  }
+
+//! @brief Restore the values of the arena from a snapshot
+//! (see getSnapshot). Returns -1 if the size of the snapshot
+//! doesn't match the size of the arena.
+int XC::NodalStateArena::setSnapshot(const Vector &v)
+  {
+    if(size_t(v.Size())!=size())
+      {
+        std::cerr << "NodalStateArena::" << __FUNCTION__
+                  << "; snapshot size: " << v.Size()
+                  << " doesn't match the arena size: " << size()
+                  << std::endl;
+        return -1;
+      }
+    const double *ptr= v.getDataPtr();
+    std::copy(ptr, ptr+dispValues.size(), dispValues.begin());
+    ptr+= dispValues.size();
+    std::copy(ptr, ptr+velValues.size(), velValues.begin());
+    ptr+= velValues.size();
+    std::copy(ptr, ptr+accelValues.size(), accelValues.begin());
+    return 0;
+  }
+
+//! @brief Constructor.
+XC::NodalStateArenaMap::NodalStateArenaMap(void)
+  : arena(nullptr), storageStamp(0) {}
+
+//! @brief Remove all the DOFs from the map.
+void XC::NodalStateArenaMap::clear(void)
+  {
+    arena= nullptr;
+    storageStamp= 0;
+    equations.clear();
+    numDOFs.clear();
+    dispOffsets.clear();
+    velOffsets.clear();
+    accelOffsets.clear();
+  }
+
+//! @brief Start a new map on the given arena.
+void XC::NodalStateArenaMap::setArena(NodalStateArena &a)
+  {
+    clear();
+    arena= &a;
+    storageStamp= a.getStorageStamp();
+  }
+
+//! @brief Return true if the map has been built on the given arena
+//! and the arena values have not been moved since then.
+bool XC::NodalStateArenaMap::isUpToDate(const NodalStateArena &a) const
+  { return ((arena==&a) && (storageStamp==a.getStorageStamp())); }
+
+//! @brief Append the DOFs of the node to the map. Return false if the
+//! node values are not stored in the arena.
+//!
+//! @param n: node to append.
+//! @param eqNumbers: equation numbers of the node DOFs.
+bool XC::NodalStateArenaMap::addNode(const Node &n, const ID &eqNumbers)
+  {
+    bool retval= false;
+    size_t dispOffset= 0, velOffset= 0, accelOffset= 0;
+    const size_t nDOF= n.getNumberDOF();
+    if(arena && (size_t(eqNumbers.Size())==nDOF))
+      retval= arena->getOffsets(n, dispOffset, velOffset, accelOffset);
+    if(retval)
+      {
+        for(size_t i= 0;i<nDOF;i++)
+          {
+            equations.push_back(eqNumbers(i));
+            numDOFs.push_back(nDOF);
+            dispOffsets.push_back(dispOffset+i);
+            velOffsets.push_back(velOffset+i);
+            accelOffsets.push_back(accelOffset+i);
+          }
+      }
+    return retval;
+  }
+
+//! @brief Set the trial displacements of the mapped DOFs from the
+//! values of the argument (same as Node::setTrialDisp: the DOFs
+//! without equation keep their trial value).
+//!
+//! @param u: displacements of the analysis model equations.
+void XC::NodalStateArenaMap::setDisp(const Vector &u) const
+  {
+    double *values= arena->getDispValues();
+    const size_t sz= equations.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        // trial, committed, incremental and incremental delta
+        // values are nDOF doubles apart (see NodeDispVectors).
+        double *trial= values+dispOffsets[k];
+        const size_t nDOF= numDOFs[k];
+        const int loc= equations[k];
+        const double tDisp= (loc>=0) ? u(loc) : *trial;
+        trial[2*nDOF]= tDisp - trial[nDOF];
+        trial[3*nDOF]= tDisp - *trial;
+        *trial= tDisp;
+      }
+  }
+
+//! @brief Set the trial velocities of the mapped DOFs that have
+//! an equation number from the values of the argument.
+//!
+//! @param udot: velocities of the analysis model equations.
+void XC::NodalStateArenaMap::setVel(const Vector &udot) const
+  {
+    double *values= arena->getVelValues();
+    const size_t sz= equations.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        const int loc= equations[k];
+        if(loc>=0)
+          values[velOffsets[k]]= udot(loc);
+      }
+  }
+
+//! @brief Set the trial accelerations of the mapped DOFs that have
+//! an equation number from the values of the argument.
+//!
+//! @param udotdot: accelerations of the analysis model equations.
+void XC::NodalStateArenaMap::setAccel(const Vector &udotdot) const
+  {
+    double *values= arena->getAccelValues();
+    const size_t sz= equations.size();
+    for(size_t k= 0;k<sz;k++)
+      {
+        const int loc= equations[k];
+        if(loc>=0)
+          values[accelOffsets[k]]= udotdot(loc);
+      }
+  }
@@ -0,0 +1,136 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodalStateArena.h
+
+#ifndef NodalStateArena_h
+#define NodalStateArena_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class Node;
+class Vector;
+class ID;
+
+//! @ingroup Nod
+//
+//! @brief Contiguous storage of the displacements, velocities and
+//! accelerations (trial, committed and incremental values) of the
+//! nodes of a mesh.
+//!
+//! When the arena is packed, the values of each node are moved to
+//! three contiguous arrays (one for displacements, one for velocities
+//! and one for accelerations) following the order of the nodes,
+//! and the node vectors become views of these arrays. This way the
+//! nodal state is not scattered in small heap allocations and a
+//! snapshot of the state of the whole model is a copy of the arrays.
+//!
+//! The nodes added after packing the arena keep their own storage
+//! until it is packed again; the memory of the removed nodes is
+//! not released until then.
+class NodalStateArena
+  {
+  private:
+    std::vector<double> dispValues; //!< displacement values of the nodes.
+    std::vector<double> velValues; //!< velocity values of the nodes.
+    std::vector<double> accelValues; //!< acceleration values of the nodes.
+    bool enabled; //!< if true the mesh keeps the arena packed.
+    bool packed; //!< true if all the nodes of the mesh use the arena.
+    size_t storageStamp; //!< incremented each time the arrays are replaced.
+  public:
+    NodalStateArena(void);
+
+    inline bool isEnabled(void) const
+      { return enabled; }
+    inline void setEnabled(const bool &b)
+      { enabled= b; }
+    inline bool isPacked(void) const
+      { return packed; }
+    inline void invalidate(void)
+      { packed= false; }
+    //! @brief Return a value that changes each time the values
+    //! are moved to new arrays (see NodalStateArenaMap).
+    inline size_t getStorageStamp(void) const
+      { return storageStamp; }
+    size_t size(void) const;
+    inline double *getDispValues(void)
+      { return dispValues.data(); }
+    inline double *getVelValues(void)
+      { return velValues.data(); }
+    inline double *getAccelValues(void)
+      { return accelValues.data(); }
+    bool getOffsets(const Node &, size_t &, size_t &, size_t &) const;
+
+    int pack(const std::vector<Node *> &);
+    void clear(void);
+
+    Vector getSnapshot(void) const;
+    int setSnapshot(const Vector &);
+  };
+
+//! @ingroup Nod
+//
+//! @brief Map between the equation numbers of the analysis model and
+//! the values stored in a nodal state arena.
+//!
+//! Used by the AnalysisModel to set the trial displacements,
+//! velocities and accelerations of the nodes in a single loop
+//! over the DOFs (a gather from the solution vectors), instead
+//! of going through the DOF groups and the node vectors. The map
+//! must be rebuilt when the equations are numbered again or when
+//! the arena moves its values to new arrays.
+class NodalStateArenaMap
+  {
+  private:
+    NodalStateArena *arena; //!< arena that stores the nodal values.
+    size_t storageStamp; //!< storage stamp of the arena when the map was built.
+    std::vector<int> equations; //!< equation number of each DOF (-1 if none).
+    std::vector<size_t> numDOFs; //!< number of DOFs of the node of each DOF.
+    std::vector<size_t> dispOffsets; //!< location of the trial displacement of each DOF.
+    std::vector<size_t> velOffsets; //!< location of the trial velocity of each DOF.
+    std::vector<size_t> accelOffsets; //!< location of the trial acceleration of each DOF.
+  public:
+    NodalStateArenaMap(void);
+
+    void clear(void);
+    void setArena(NodalStateArena &);
+    bool isUpToDate(const NodalStateArena &) const;
+    bool addNode(const Node &, const ID &);
+    //! @brief Return the number of mapped DOFs.
+    inline size_t size(void) const
+      { return equations.size(); }
+
+    void setDisp(const Vector &) const;
+    void setVel(const Vector &) const;
+    void setAccel(const Vector &) const;
+  };
+
+} // end of XC namespace
+
+#endif
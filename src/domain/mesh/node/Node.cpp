@@ -1318,6 +1318,34 @@ int XC::Node::commitState(void)
   }
 
 
+//! @brief Return the number of doubles used to store the trial,
+//! committed and incremental displacements.
+size_t XC::Node::getNumDispValues(void) const
+  { return disp.getNumValues(numberDOF); }
+
+//! @brief Return the number of doubles used to store the trial
+//! and committed velocities.
+size_t XC::Node::getNumVelValues(void) const
+  { return vel.getNumValues(numberDOF); }
+
+//! @brief Return the number of doubles used to store the trial
+//! and committed accelerations.
+size_t XC::Node::getNumAccelValues(void) const
+  { return accel.getNumValues(numberDOF); }
+
+//! @brief Move the displacement, velocity and acceleration values
+//! of the node to the given locations (see NodalStateArena).
+//!
+//! @param dispPtr: location of getNumDispValues() doubles.
+//! @param velPtr: location of getNumVelValues() doubles.
+//! @param accelPtr: location of getNumAccelValues() doubles.
+void XC::Node::setStateStorage(double *dispPtr, double *velPtr, double *accelPtr)
+  {
+    disp.setStorage(dispPtr, numberDOF);
+    vel.setStorage(velPtr, numberDOF);
+    accel.setStorage(accelPtr, numberDOF);
+  }
+
 //! @brief Returns to the last committed state.
 //!
 //! Causes the node to set the trial nodal displacements, velocities and
@@ -289,6 +289,12 @@ class Node: public MeshComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // location of the displacement, velocity and acceleration values.
+    size_t getNumDispValues(void) const;
+    size_t getNumVelValues(void) const;
+    size_t getNumAccelValues(void) const;
+    void setStateStorage(double *, double *, double *);
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void) const;
     double getMassComponent(const int &) const;
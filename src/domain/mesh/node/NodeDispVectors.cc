@@ -94,6 +94,25 @@ const XC::Vector &XC::NodeDispVectors::getIncrDeltaDisp(const size_t &nDOF) cons
     return *incrDeltaDisp;
   }
 
+//! @brief Move the values to the memory pointed by the argument
+//! (see NodeVectors::setStorage).
+//! @param ptr: new location of the values.
+//! @param nDOF: number of degrees of freedom.
+void XC::NodeDispVectors::setStorage(double *ptr, const size_t &nDOF)
+  {
+    if(!trialData)
+      createDisp(nDOF);
+    NodeVectors::setStorage(ptr, nDOF);
+    if(incrDisp)
+      incrDisp->setData(ptr+2*nDOF, nDOF);
+    else
+      incrDisp= new Vector(ptr+2*nDOF, nDOF);
+    if(incrDeltaDisp)
+      incrDeltaDisp->setData(ptr+3*nDOF, nDOF);
+    else
+      incrDeltaDisp= new Vector(ptr+3*nDOF, nDOF);
+  }
+
 //! @brief Sets trial values for the displacement components.
 //! @param nDOF: number of degrees of freedom.
 //! @param dof: component of the displacement to set.
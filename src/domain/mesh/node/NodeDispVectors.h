@@ -59,6 +59,7 @@ class NodeDispVectors: public NodeVectors
     // response quantities of the node
     virtual const Vector &getIncrDisp(const size_t &) const;
     virtual const Vector &getIncrDeltaDisp(const size_t &) const;
+    void setStorage(double *, const size_t &nDOF);
 
     // public methods for updating the trial response quantities
     virtual int setTrialDispComponent(const size_t &nDOF,const double &value,const size_t &dof);
@@ -30,6 +30,7 @@
 #include <utility/tagged/TaggedObject.h>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/ID.h>
+#include <algorithm>
 
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 
@@ -91,6 +92,32 @@ size_t XC::NodeVectors::getVectorsSize(void) const
       return 0;
   }
 
+//! @brief Return the number of values stored (trial, committed,...).
+//! @param nDOF: number of degrees of freedom.
+size_t XC::NodeVectors::getNumValues(const size_t &nDOF) const
+  { return numVectors*nDOF; }
+
+//! @brief Move the values to the memory pointed by the argument (which
+//! must be able to hold getNumValues(nDOF) doubles and outlive this
+//! object or the next call to this method). The Vector objects returned
+//! by the accessors remain the same, only their data is moved.
+//! @param ptr: new location of the values.
+//! @param nDOF: number of degrees of freedom.
+void XC::NodeVectors::setStorage(double *ptr, const size_t &nDOF)
+  {
+    if(!trialData)
+      createData(nDOF);
+    const size_t sz= numVectors*nDOF;
+    const double *src= values.getDataPtr();
+    if(src!=ptr)
+      {
+        std::copy(src, src+sz, ptr);
+        values.setData(ptr, sz);
+        trialData->setData(ptr, nDOF);
+        commitData->setData(ptr+nDOF, nDOF);
+      }
+  }
+
 //! @brief Returns the data vector.
 const XC::Vector &XC::NodeVectors::getData(const size_t &nDOF) const
   {
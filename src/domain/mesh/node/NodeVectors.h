@@ -69,6 +69,8 @@ class NodeVectors: public CommandEntity, public MovableObject
 
     // public methods dealing with the DOF at the node
     size_t getVectorsSize(void) const;
+    size_t getNumValues(const size_t &nDOF) const;
+    virtual void setStorage(double *, const size_t &nDOF);
 
     // public methods for obtaining committed and trial 
     // response quantities of the node
@@ -51,6 +51,14 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumFreeNodes", &XC::Mesh::getNumFreeNodes,"Returns the number of free nodes.")
   .def("freezeDeadNodes",&XC::Mesh::freeze_dead_nodes,"freezeDeadNodes(lockerName) restrain movement of dead nodes.")
   .def("meltAliveNodes",&XC::Mesh::melt_alive_nodes,"freezeDeadNodes(lockerName) allows movement of melted nodes.")
+  .add_property("numThreads",&XC::Mesh::getNumThreads,&XC::Mesh::setNumThreads,"Get/set the number of threads used to commit, update and revert the state of the nodes and elements (1: serial).")
+  .add_property("nodalStateArena",&XC::Mesh::getNodalStateArena,&XC::Mesh::setNodalStateArena,"Get/set the storage of the nodal displacements, velocities and accelerations in contiguous arrays.")
+  .def("packNodalState",&XC::Mesh::packNodalState,"Move the displacements, velocities and accelerations of the nodes to contiguous arrays; return the number of nodes.")
+  .def("getNodalStateSnapshot",&XC::Mesh::getNodalStateSnapshot,"Return a copy of the displacements, velocities and accelerations of the nodes (the nodal state arena must be enabled).")
+  .def("setNodalStateSnapshot",&XC::Mesh::setNodalStateSnapshot,"setNodalStateSnapshot(snapshot): restore the displacements, velocities and accelerations of the nodes from a snapshot taken with getNodalStateSnapshot.")
+  .def("commit",&XC::Mesh::commit,"Commit the state of the nodes and elements of the mesh.")
+  .def("update",&XC::Mesh::update,"Update the state of the elements from the trial displacements of their nodes.")
+  .def("revertToLastCommit",&XC::Mesh::revertToLastCommit,"Return the nodes and elements of the mesh to their last committed state.")
   .def("calculateNodalReactions",&XC::Mesh::calculateNodalReactions,"triggers nodal reaction calculation.")
   .def("checkNodalReactions",&XC::Mesh::checkNodalReactions,"checkNodalReactions(tolerance): check that reactions at nodes correspond to constrained degrees of freedom.")
   .add_property("getElementIter", make_function( getElementIter, return_internal_reference<>() ),"returns an iterator over the elements of the mesh.")
@@ -253,6 +253,12 @@ bool XC::Material::needsUpdate(void) const
 void XC::Material::update(void)
    {return;}
 
+//! @brief Return true if the trial state of this material can be
+//! computed at the same time that those of other materials (in other
+//! threads), that is, if it doesn't write on class-wide work areas.
+bool XC::Material::allowsConcurrentStateDetermination(void) const
+  { return false; }
+
 //! @brief Increments generalized strain
 //! @param incS: strain increment.
 void XC::Material::incrementInitialGeneralizedStrain(const Vector &incS)
@@ -119,6 +119,7 @@ class Material: public TaggedObject, public MovableObject
 
     virtual bool needsUpdate(void) const;
     virtual void update(void);
+    virtual bool allowsConcurrentStateDetermination(void) const;
 
     virtual const Vector &getGeneralizedStress(void) const= 0;
     virtual const Vector &getGeneralizedStrain(void) const= 0;
@@ -77,6 +77,7 @@ class MaterialVector: public std::vector<MAT *>, public CommandEntity, public Mo
     void copyPropsFrom(const EntityWithProperties *);
     
     bool empty(void) const;
+    bool allowsConcurrentStateDetermination(void) const;
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
@@ -251,6 +252,21 @@ bool MaterialVector<MAT>::empty(void) const
       return ((*this)[0]==nullptr);
   }
 
+//! @brief Return true if all the materials allow concurrent
+//! state determination.
+template <class MAT>
+bool MaterialVector<MAT>::allowsConcurrentStateDetermination(void) const
+  {
+    bool retval= !empty();
+    for(const_iterator i=mat_vector::begin();i!=mat_vector::end();i++)
+      if(!(*i) || !(*i)->allowsConcurrentStateDetermination())
+	{
+	  retval= false;
+	  break;
+	}
+    return retval;
+  }
+
 template <class MAT>
 void MaterialVector<MAT>::clearAll(void)
   {
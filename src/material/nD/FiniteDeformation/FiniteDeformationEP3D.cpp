@@ -58,6 +58,7 @@
 #include <material/nD/FiniteDeformation/fdEvolution/fdEvolution_S.h>
 #include <material/nD/FiniteDeformation/fdEvolution/fdEvolution_T.h>
 #include "utility/matrix/nDarray/BJmatrix.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 #include <material/nD/NDMaterialType.h>
 
 const int    Max_Iter  = 40;
@@ -531,8 +532,8 @@ int XC::FiniteDeformationEP3D::ImplicitAlgorithm()
     Fp_n = Fp;
     Fpinv = Fp.inverse();
     Fp_ninv  =  Fp_n.inverse();
-    Fe = F("ij")*Fpinv("jk");   Fe.null_indices();
-    Ce = Fe("ki")*Fe("kj");     Ce.null_indices();
+    Fe = straintensor(mult(FixedTensor2(F), FixedTensor2(Fpinv)).data());
+    Ce = straintensor(transposed_mult(FixedTensor2(Fe), FixedTensor2(Fe)).data());
     Ee = (Ce - tensorI2) * 0.5;
     Ee_n = Ee;
 
@@ -552,8 +553,7 @@ int XC::FiniteDeformationEP3D::ImplicitAlgorithm()
     fde3d->setTrialC(Ce);         // Note: It is C, not F!!!
     B_PK2 = fde3d->getStressTensor();
 
-    B_Mandel = Ce("ik")*B_PK2("kj");        // Mandel Stress
-      B_Mandel.null_indices();
+    B_Mandel = stresstensor(mult(FixedTensor2(Ce), FixedTensor2(B_PK2)).data());        // Mandel Stress
 
     // Evaluate the value of yield function
     yieldfun = fdy->Yd(B_Mandel, *fdeps);
@@ -908,8 +908,7 @@ int XC::FiniteDeformationEP3D::ImplicitAlgorithm()
     Ce = Ee*2.0 + static_cast<const straintensor &>(tensorI2);
     fde3d->setTrialC(Ce);  // Note: It is C, not F!!!
     B_PK2 = fde3d->getStressTensor();    // Updated B_PK2
-        B_Mandel = Ce("ik")*B_PK2("kj");     // Update Mandel Stress
-          B_Mandel.null_indices();
+        B_Mandel = stresstensor(mult(FixedTensor2(Ce), FixedTensor2(B_PK2)).data());     // Update Mandel Stress
 
     xi += D_xi;
     q += Kscalar*D_xi;
@@ -969,14 +968,13 @@ int XC::FiniteDeformationEP3D::ImplicitAlgorithm()
       fdeps->setFpInVar(Fp);
       Fpinv = Fp.inverse();  //Using the iterative FP
 
-      Fe = F("ij")*Fpinv("jk");   Fe.null_indices();
-      Ce = Fe("ki")*Fe("kj");     Ce.null_indices();
+      Fe = straintensor(mult(FixedTensor2(F), FixedTensor2(Fpinv)).data());
+      Ce = straintensor(transposed_mult(FixedTensor2(Fe), FixedTensor2(Fe)).data());
       fde3d->setTrialC(Ce);       // Note: It is C, not F!!!
       B_PK2 = fde3d->getStressTensor();
 
       // iniPK2
-      iniPK2 = Fpinv("ip")*Fpinv("jq")*B_PK2("pq");
-        iniPK2.null_indices();
+      iniPK2 = stresstensor(mult_transposed(mult(FixedTensor2(Fpinv), FixedTensor2(B_PK2)), FixedTensor2(Fpinv)).data());
 
       //Begin, evaluate the first term of D^{1}
       tensorTemp8 = tensorTemp4 * (1.0/temp5);
@@ -1080,38 +1078,25 @@ int XC::FiniteDeformationEP3D::ImplicitAlgorithm()
     }      // end of plastic part
     else { // start of elastic part
 
-      Fe = F("ij") * Fp_ninv("jk");
-        Fe.null_indices();
-      Ce = Fe("ki") * Fe("kj");
-        Ce.null_indices();
+      Fe = straintensor(mult(FixedTensor2(F), FixedTensor2(Fp_ninv)).data());
+      Ce = straintensor(transposed_mult(FixedTensor2(Fe), FixedTensor2(Fe)).data());
 
       fde3d->setTrialC(Ce);  // Note: It is C, not F!!!
       B_PK2 = fde3d->getStressTensor();
 
-      iniPK2 = Fp_ninv("ip")*Fp_ninv("jq")*B_PK2("pq");
-        iniPK2.null_indices();
+      iniPK2 = stresstensor(mult_transposed(mult(FixedTensor2(Fp_ninv), FixedTensor2(B_PK2)), FixedTensor2(Fp_ninv)).data());
 
       LATStensor = fde3d->getTangentTensor();
 
-      tensorTemp1 = Fp_ninv("im")*Fp_ninv("jn");
-        tensorTemp1.null_indices();
-      tensorTemp2 = Fp_ninv("kr")*Fp_ninv("ls");
-        tensorTemp2.null_indices();
-      tensorTemp3 = tensorTemp1("imjn")*LATStensor("mnrs");
-        tensorTemp3.null_indices();
-      iniTangent = tensorTemp3("ijrs")*tensorTemp2("krls");
-        iniTangent.null_indices();
+      // iniTangent_ijkl= Fp_ninv_im*Fp_ninv_jn*LATS_mnrs*Fp_ninv_kr*Fp_ninv_ls
+      iniTangent = transform_indices(FixedTensor2(Fp_ninv), FixedTensor4(LATStensor)).getBJtensor();
     }
 
-    iniGreen = F("ki")*F("kj");
-      iniGreen.null_indices();
+    iniGreen = straintensor(transposed_mult(FixedTensor2(F), FixedTensor2(F)).data());
     iniGreen = (iniGreen - tensorI2) * 0.5;
 
-    cauchystress = Fe("ip")*B_PK2("pq");
-      cauchystress.null_indices();
-    cauchystress = cauchystress("iq")*Fe("jq");
-      cauchystress.null_indices();
-    cauchystress = cauchystress*(1.0/F.determinant());
+    const FixedTensor2 Fef(Fe);
+    cauchystress = stresstensor((mult_transposed(mult(Fef, FixedTensor2(B_PK2)), Fef)*(1.0/F.determinant())).data());
 
     return 0;
 }
@@ -1188,8 +1173,8 @@ int XC::FiniteDeformationEP3D::SemiImplicitAlgorithm()
     Fp_n = Fp;
     Fp_ninv  =  Fp_n.inverse();
     Fpinv = Fp.inverse();
-    Fe = F("ij")*Fpinv("jk");   Fe.null_indices();
-    Ce = Fe("ki")*Fe("kj");     Ce.null_indices();
+    Fe = straintensor(mult(FixedTensor2(F), FixedTensor2(Fpinv)).data());
+    Ce = straintensor(transposed_mult(FixedTensor2(Fe), FixedTensor2(Fe)).data());
     Ee = (Ce - tensorI2) * 0.5;
     Ee_n = Ee;
 
@@ -1209,8 +1194,7 @@ int XC::FiniteDeformationEP3D::SemiImplicitAlgorithm()
     fde3d->setTrialC(Ce);         // Note: It is C, not F!!!
     B_PK2 = fde3d->getStressTensor();
 
-    B_Mandel = Ce("ik")*B_PK2("kj");        // Mandel Stress
-      B_Mandel.null_indices();
+    B_Mandel = stresstensor(mult(FixedTensor2(Ce), FixedTensor2(B_PK2)).data());        // Mandel Stress
 
     // Evaluate the value of yield function
     yieldfun = fdy->Yd(B_Mandel, *fdeps);
@@ -1293,8 +1277,7 @@ int XC::FiniteDeformationEP3D::SemiImplicitAlgorithm()
     Ce = Ee*2.0 + straintensor(tensorI2);
     fde3d->setTrialC(Ce);  // Note: It is C, not F!!!
     B_PK2 = fde3d->getStressTensor();    // Updated B_PK2
-        B_Mandel = Ce("ik")*B_PK2("kj");     // Update Mandel Stress
-          B_Mandel.null_indices();
+        B_Mandel = stresstensor(mult(FixedTensor2(Ce), FixedTensor2(B_PK2)).data());     // Update Mandel Stress
 
     if( fdEvolutionS ) {
       xi += D_xi;
@@ -1339,17 +1322,14 @@ int XC::FiniteDeformationEP3D::SemiImplicitAlgorithm()
 
       // Return iniTangent and iniPK2
       Fpinv = Fp.inverse();       // Using the iterative FP
-      Fe = F("ij")*Fpinv("jk");
-        Fe.null_indices();
-      Ce = Fe("ki")*Fe("kj");
-        Ce.null_indices();
+      Fe = straintensor(mult(FixedTensor2(F), FixedTensor2(Fpinv)).data());
+      Ce = straintensor(transposed_mult(FixedTensor2(Fe), FixedTensor2(Fe)).data());
 
       fde3d->setTrialC(Ce);       // Note: It is C, not F!!!
       B_PK2 = fde3d->getStressTensor();
 
       //iniPK2 = B_PK2;
-      iniPK2 = Fpinv("ip")*Fpinv("jq")*B_PK2("pq");
-        iniPK2.null_indices();
+      iniPK2 = stresstensor(mult_transposed(mult(FixedTensor2(Fpinv), FixedTensor2(B_PK2)), FixedTensor2(Fpinv)).data());
 
       tensorTemp5 = Ltensor("ijkl") * MCtensor("kl");
         tensorTemp5.null_indices();
@@ -1385,40 +1365,27 @@ int XC::FiniteDeformationEP3D::SemiImplicitAlgorithm()
 
     // Return iniTangent and iniPK2
 
-      Fe = F("ij") * Fp_ninv("jk");
-        Fe.null_indices();
-      Ce = Fe("ki") * Fe("kj");
-        Ce.null_indices();
+      Fe = straintensor(mult(FixedTensor2(F), FixedTensor2(Fp_ninv)).data());
+      Ce = straintensor(transposed_mult(FixedTensor2(Fe), FixedTensor2(Fe)).data());
 
       fde3d->setTrialC(Ce);  // Note: It is C, not F!!!
       B_PK2 = fde3d->getStressTensor();
 
       //iniPK2 = B_PK2;
-      iniPK2 = Fp_ninv("ip")*Fp_ninv("jq")*B_PK2("pq");
-        iniPK2.null_indices();
+      iniPK2 = stresstensor(mult_transposed(mult(FixedTensor2(Fp_ninv), FixedTensor2(B_PK2)), FixedTensor2(Fp_ninv)).data());
 
       LATStensor = fde3d->getTangentTensor();
 
-      tensorTemp1 = Fp_ninv("im") * Fp_ninv("jn");
-        tensorTemp1.null_indices();
-      tensorTemp2 = Fp_ninv("kr") * Fp_ninv("ls");
-        tensorTemp2.null_indices();
-      tensorTemp3 = tensorTemp1("imjn") * LATStensor("mnrs");
-        tensorTemp3.null_indices();
-      iniTangent = tensorTemp3("ijrs") * tensorTemp2("krls");
-        iniTangent.null_indices();
+      // iniTangent_ijkl= Fp_ninv_im*Fp_ninv_jn*LATS_mnrs*Fp_ninv_kr*Fp_ninv_ls
+      iniTangent = transform_indices(FixedTensor2(Fp_ninv), FixedTensor4(LATStensor)).getBJtensor();
 
     }  // end of elastic part
 
-    iniGreen = F("ki") * F("kj");
-      iniGreen.null_indices();
+    iniGreen = straintensor(transposed_mult(FixedTensor2(F), FixedTensor2(F)).data());
     iniGreen = (iniGreen - tensorI2) * 0.5;
 
-    cauchystress = Fe("ip") * B_PK2("pq");
-      cauchystress.null_indices();
-    cauchystress = cauchystress("iq") * Fe("jq");
-      cauchystress.null_indices();
-    cauchystress = cauchystress * (1.0/F.determinant());
+    const FixedTensor2 Fef(Fe);
+    cauchystress = stresstensor((mult_transposed(mult(Fef, FixedTensor2(B_PK2)), Fef)*(1.0/F.determinant())).data());
 
     return 0;
 }
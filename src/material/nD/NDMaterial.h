@@ -145,7 +145,7 @@ class NDMaterial: public Material
     virtual int setTrialStrain(const Tensor &, const Tensor &);
     virtual int setTrialStrainIncr(const Tensor &);
     virtual int setTrialStrainIncr(const Tensor &, const Tensor &);
-    const Tensor &getTangentTensor(void) const;
+    virtual const Tensor &getTangentTensor(void) const;
     virtual const stresstensor &getStressTensor(void) const;
     virtual const straintensor &getStrainTensor(void) const;
     virtual const straintensor &getPlasticStrainTensor(void) const; //Added Joey Aug. 13, 2001
@@ -58,6 +58,9 @@
 
 XC::Matrix XC::ElasticIsotropic3D::D(6,6); // global for ElasticIsotropic3D only
 XC::Vector XC::ElasticIsotropic3D::sigma(6); // global for ElasticIsotropic3D only
+XC::Tensor XC::ElasticIsotropic3D::Dt(def_dim_4, 0.0); // global for ElasticIsotropic3D only
+XC::stresstensor XC::ElasticIsotropic3D::Stress; // global for ElasticIsotropic3D only
+XC::straintensor XC::ElasticIsotropic3D::Strain; // global for ElasticIsotropic3D only
 
 //! @brief Constructor.
 XC::ElasticIsotropic3D::ElasticIsotropic3D(int tag)
@@ -92,6 +95,55 @@ const XC::Matrix &XC::ElasticIsotropic3D::getInitialTangent(void) const
     return D;
   }
 
+//! @brief Return the strain vector [eps_11, eps_22, eps_33, gamma_12,
+//! gamma_23, gamma_31] that corresponds to the strain tensor argument.
+XC::Vector XC::ElasticIsotropic3D::get_strain_vector(const Tensor &t)
+  {
+    Vector retval(6);
+    retval(0)= t(1,1);
+    retval(1)= t(2,2);
+    retval(2)= t(3,3);
+    retval(3)= t(1,2)+t(2,1);
+    retval(4)= t(2,3)+t(3,2);
+    retval(5)= t(3,1)+t(1,3);
+    return retval;
+  }
+
+//! @brief Set the trial strain from the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrain(const Tensor &v)
+  { return ElasticIsotropicMaterial::setTrialStrain(get_strain_vector(v)); }
+
+//! @brief Set the trial strain from the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrain(const Tensor &v, const Tensor &r)
+  { return ElasticIsotropicMaterial::setTrialStrain(get_strain_vector(v)); }
+
+//! @brief Increment the trial strain with the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrainIncr(const Tensor &v)
+  { return ElasticIsotropicMaterial::setTrialStrainIncr(get_strain_vector(v)); }
+
+//! @brief Increment the trial strain with the strain tensor argument.
+int XC::ElasticIsotropic3D::setTrialStrainIncr(const Tensor &v, const Tensor &r)
+  { return ElasticIsotropicMaterial::setTrialStrainIncr(get_strain_vector(v)); }
+
+//! @brief Return the tangent stiffness tensor:
+//! E_ijkl= lambda*delta_ij*delta_kl+mu*(delta_ik*delta_jl+delta_il*delta_jk).
+const XC::Tensor &XC::ElasticIsotropic3D::getTangentTensor(void) const
+  {
+    const double mu2= E/(1.0+v);
+    const double lam= v*mu2/(1.0-2.0*v);
+    const double mu= 0.50*mu2;
+
+    Dt.Reset_to(0.0);
+    for(int i= 1;i<=3;i++)
+      for(int j= 1;j<=3;j++)
+        {
+          Dt.val(i,i,j,j)+= lam;
+          Dt.val(i,j,i,j)+= mu;
+          Dt.val(i,j,j,i)+= mu;
+        }
+    return Dt;
+  }
+
 const XC::Vector &XC::ElasticIsotropic3D::getStress(void) const
   {
     double mu2 = E/(1.0+v);
@@ -122,6 +174,39 @@ const XC::Vector &XC::ElasticIsotropic3D::getStress(void) const
     return sigma;
   }
 
+//! @brief Return the stress tensor.
+const XC::stresstensor &XC::ElasticIsotropic3D::getStressTensor(void) const
+  {
+    const Vector &s= getStress();
+    Stress.val(1,1)= s(0);
+    Stress.val(2,2)= s(1);
+    Stress.val(3,3)= s(2);
+    Stress.val(1,2)= Stress.val(2,1)= s(3);
+    Stress.val(2,3)= Stress.val(3,2)= s(4);
+    Stress.val(3,1)= Stress.val(1,3)= s(5);
+    return Stress;
+  }
+
+//! @brief Return the strain tensor.
+const XC::straintensor &XC::ElasticIsotropic3D::getStrainTensor(void) const
+  {
+    const Vector &e= getStrain();
+    Strain.val(1,1)= e(0);
+    Strain.val(2,2)= e(1);
+    Strain.val(3,3)= e(2);
+    Strain.val(1,2)= Strain.val(2,1)= 0.5*e(3);
+    Strain.val(2,3)= Strain.val(3,2)= 0.5*e(4);
+    Strain.val(3,1)= Strain.val(1,3)= 0.5*e(5);
+    return Strain;
+  }
+
+//! @brief Return the plastic strain tensor (always zero).
+const XC::straintensor &XC::ElasticIsotropic3D::getPlasticStrainTensor(void) const
+  {
+    static const straintensor retval;
+    return retval;
+  }
+
 //! @brief Commit the material state.
 int XC::ElasticIsotropic3D::commitState(void)
   {
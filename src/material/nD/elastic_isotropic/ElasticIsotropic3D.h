@@ -57,6 +57,9 @@
 #define ElasticIsotropic3D_h
 	 
 #include <material/nD/elastic_isotropic/ElasticIsotropicMaterial.h>
+#include <utility/matrix/nDarray/Tensor.h>
+#include <utility/matrix/nDarray/straint.h>
+#include <utility/matrix/nDarray/stresst.h>
 
 namespace XC {
 //! @ingroup NDMat
@@ -67,14 +70,30 @@ class ElasticIsotropic3D: public ElasticIsotropicMaterial
   private:
     static Vector sigma; //!< Stress vector
     static Matrix D; //!< Elastic constantsVector sigma;
+    static Tensor Dt; //!< Elastic constants tensor.
+    static stresstensor Stress; //!< Stress tensor.
+    static straintensor Strain; //!< Strain tensor.
+
+    static Vector get_strain_vector(const Tensor &);
   public:
     ElasticIsotropic3D(int tag= 0);
     ElasticIsotropic3D(int tag, double E, double nu, double rho);
 
+    using ElasticIsotropicMaterial::setTrialStrain;
+    using ElasticIsotropicMaterial::setTrialStrainIncr;
+    int setTrialStrain(const Tensor &v);
+    int setTrialStrain(const Tensor &v, const Tensor &r);
+    int setTrialStrainIncr(const Tensor &v);
+    int setTrialStrainIncr(const Tensor &v, const Tensor &r);
+
     const Matrix &getTangent(void) const;
     const Matrix &getInitialTangent(void) const;
+    const Tensor &getTangentTensor(void) const;
 
     const Vector &getStress(void) const;
+    const stresstensor &getStressTensor(void) const;
+    const straintensor &getStrainTensor(void) const;
+    const straintensor &getPlasticStrainTensor(void) const;
     
     int commitState(void);
     int revertToLastCommit(void);
@@ -22,6 +22,8 @@
 //python_interface.tcc
 
 int (XC::NDMaterial::*setNDTrialStrain)(const XC::Vector &)= &XC::NDMaterial::setTrialStrain;
+int (XC::NDMaterial::*setNDTrialStrainTensor)(const XC::BJtensor &)= &XC::NDMaterial::setTrialStrain;
+int (XC::NDMaterial::*setNDTrialStrainIncrTensor)(const XC::BJtensor &)= &XC::NDMaterial::setTrialStrainIncr;
 class_<XC::NDMaterial, XC::NDMaterial *, bases<XC::Material>, boost::noncopyable >("NDMaterial", no_init)
     .add_property("getRho", &XC::NDMaterial::getRho,"Return the material density.")
     .add_property("rho", &XC::NDMaterial::getRho, &XC::NDMaterial::setRho,"Material density.")
@@ -34,6 +36,11 @@ class_<XC::NDMaterial, XC::NDMaterial *, bases<XC::Material>, boost::noncopyable
     .def("setTrialStrain",setNDTrialStrain, "Set the trial strains for the material (the order of the components depends on the subclass) [eps_11, eps_22, eps_33, eps_12, eps_23, eps_31].") 
     .def("getStress",make_function(&XC::NDMaterial::getStress,return_internal_reference<>()), "Return the material stresses (the order of the components depends on the subclass) [sigma_11, sigma_22, sigma_33, sigma_12, sigma_23, sigma_31].") 
     .def("getStrain",make_function(&XC::NDMaterial::getStrain,return_internal_reference<>()), "Return the material strains (the order of the components depends on the subclass) [eps_11, eps_22, eps_33, eps_12, eps_23, eps_31].") 
+    .def("setTrialStrainTensor",setNDTrialStrainTensor, "Set the trial strain tensor (3D materials).")
+    .def("setTrialStrainIncrTensor",setNDTrialStrainIncrTensor, "Increment the trial strain with the strain tensor argument (3D materials).")
+    .def("getTangentTensor",make_function(&XC::NDMaterial::getTangentTensor,return_internal_reference<>()), "Return the fourth order tangent stiffness tensor (3D materials).")
+    .def("getStressTensor",make_function(&XC::NDMaterial::getStressTensor,return_internal_reference<>()), "Return the stress tensor.")
+    .def("getStrainTensor",make_function(&XC::NDMaterial::getStrainTensor,return_internal_reference<>()), "Return the strain tensor.")
   ;
 
 class_<XC::ElasticIsotropicMaterial, bases<XC::NDMaterial>, boost::noncopyable >("ElasticIsotropicMaterial", no_init)
@@ -50,10 +50,10 @@
 std::vector<double> XC::FluidSolidPorousMaterial::combinedBulkModulusx;
 double XC::FluidSolidPorousMaterial::pAtm = 101;
 
-XC::Vector XC::FluidSolidPorousMaterial::workV3(3);
-XC::Vector XC::FluidSolidPorousMaterial::workV6(6);
-XC::Matrix XC::FluidSolidPorousMaterial::workM3(3,3);
-XC::Matrix XC::FluidSolidPorousMaterial::workM6(6,6);
+thread_local XC::Vector XC::FluidSolidPorousMaterial::workV3(3);
+thread_local XC::Vector XC::FluidSolidPorousMaterial::workV6(6);
+thread_local XC::Matrix XC::FluidSolidPorousMaterial::workM3(3,3);
+thread_local XC::Matrix XC::FluidSolidPorousMaterial::workM6(6,6);
 
 void XC::FluidSolidPorousMaterial::free_mem(void)
   {
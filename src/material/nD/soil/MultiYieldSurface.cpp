@@ -42,22 +42,39 @@
 
 // YieldSurface class methods
 XC::MultiYieldSurface::MultiYieldSurface():
-theSize(0.0), theCenter(6), plastShearModulus(0.0)
+theSize(0.0), theCenter{0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, plastShearModulus(0.0)
   {}
 
 XC::MultiYieldSurface::MultiYieldSurface(const XC::Vector & theCenter_init, 
                                      double theSize_init, double plas_modul):
-theSize(theSize_init), theCenter(theCenter_init), plastShearModulus(plas_modul)
-  {}
+theSize(theSize_init), plastShearModulus(plas_modul)
+  { setCenter(theCenter_init); }
 
 void XC::MultiYieldSurface::setData(const XC::Vector & theCenter_init, 
                                 double theSize_init, double plas_modul)
   {
     theSize = theSize_init;
-    theCenter = theCenter_init;
+    setCenter(theCenter_init);
     plastShearModulus = plas_modul;
   }
 
+//! @brief Copy the center of the surface on the argument.
+void XC::MultiYieldSurface::getCenter(Vector &v) const
+  {
+    if(v.Size() != 6)
+      v.resize(6);
+    for(int i= 0; i<6; i++)
+      v(i)= theCenter[i];
+  }
+
+//! @brief Add the center of the surface multiplied by fact
+//! to the argument (v+= fact*center).
+void XC::MultiYieldSurface::addCenter(Vector &v, double fact) const
+  {
+    for(int i= 0; i<6; i++)
+      v(i)+= fact*theCenter[i];
+  }
+
 void XC::MultiYieldSurface::setCenter(const XC::Vector & newCenter)
   {
     if(newCenter.Size() != 6)
@@ -65,7 +82,8 @@ void XC::MultiYieldSurface::setCenter(const XC::Vector & newCenter)
 	std::cerr << "FATAL:XC::MultiYieldSurface::setCenter(XC::Vector &): vector size not equal 6" << std::endl;
         exit(-1);
       }
-    theCenter = newCenter;
+    for(int i= 0; i<6; i++)
+      theCenter[i]= newCenter(i);
   }
 
 
@@ -51,12 +51,16 @@ double secondOrderEqn(double A, double B, double C, int i);
 namespace XC {
 //! @ingroup SoilNDMat
 //
-//! @brief ??.
+//! @brief Yield surface of the multi-yield soil materials.
+//!
+//! The state is stored inline (no heap allocated center) so
+//! an array of surfaces is a contiguous block of doubles that
+//! can be copied in one pass.
 class MultiYieldSurface
   {
   private:
     double theSize;
-    Vector theCenter;  
+    double theCenter[6];
     double plastShearModulus;
   public:
     //constructors
@@ -65,7 +69,10 @@ class MultiYieldSurface
                     double plas_modul); 
 
     void setData(const Vector &center_init, double size_init,double plas_modul); 
-    const Vector & center() const {return theCenter; }
+    void getCenter(Vector &) const;
+    void addCenter(Vector &, double fact) const;
+    //! @brief Return a pointer to the center components.
+    const double *centerData(void) const {return theCenter; }
     double size() const {return theSize; }
     double modulus() const {return plastShearModulus; }
     void setCenter(const Vector &); 
@@ -216,7 +216,7 @@ const XC::Matrix & XC::PressureDependMultiYield::getTangent(void) const
   if(ndm==3) 
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -243,7 +243,6 @@ const XC::Matrix & XC::PressureDependMultiYield::getTangent(void) const
 const XC::Vector & XC::PressureDependMultiYield::getStress(void) const
 {
   int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
   int ndm = ndmx[matN];
 
   int i, is;
@@ -258,7 +257,7 @@ const XC::Vector & XC::PressureDependMultiYield::getStress(void) const
     trialStress.setData(workV6);
   }
   else {
-    for(i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    revert_surfaces();
     activeSurfaceNum = committedActiveSurf;
     pressureD = pressureDCommitted;
     reversalStress = reversalStressCommitted;
@@ -320,7 +319,7 @@ const XC::Vector & XC::PressureDependMultiYield::getStress(void) const
   if(ndm==3)
     return trialStress.t2Vector();
   else {
-                static XC::Vector workV(3);
+                static thread_local XC::Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -540,6 +539,7 @@ void XC::PressureDependMultiYield::setUpSurfaces(double * gredu)
                 }
   }  
 
+  mark_surfaces(1, numOfSurfaces+1);
   residualPressx[matN] = residualPress;
   frictionAnglex[matN] = frictionAngle;
   cohesionx[matN] = cohesion;
@@ -858,9 +858,9 @@ int XC::PressureDependMultiYield::stressCorrection(int crossedSurface) const
     double refShearModulus = refShearModulusx[matN];
         double refBulkModulus = refBulkModulusx[matN];
 
-  static XC::T2Vector contactStress;
+  static thread_local XC::T2Vector contactStress;
   getContactStress(contactStress);
-  static XC::T2Vector surfNormal;
+  static thread_local XC::T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   if(plasticPotential==LOCK_VALUE && (onPPZ == -1 || onPPZ == 1)) {
@@ -394,7 +394,7 @@ const XC::Matrix &XC::PressureDependMultiYield02::getTangent(void) const
   if(ndm==3)
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -420,7 +420,6 @@ const XC::Matrix &XC::PressureDependMultiYield02::getTangent(void) const
 const XC::Vector & XC::PressureDependMultiYield02::getStress(void) const
 {
   int loadStage = loadStagex[matN];
-  int numOfSurfaces = numOfSurfacesx[matN];
   int ndm = ndmx[matN];
 
   int i, is;
@@ -437,7 +436,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getStress(void) const
     trialStress.setData(workV6);
   }
   else {
-    for(i=1; i<=numOfSurfaces; i++) theSurfaces[i] = committedSurfaces[i];
+    revert_surfaces();
     activeSurfaceNum = committedActiveSurf;
     pressureD = pressureDCommitted;
     onPPZ = onPPZCommitted;
@@ -512,7 +511,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getStress(void) const
   if(ndm==3)
     return trialStress.t2Vector();
   else {
-        static XC::Vector workV(3);
+        static thread_local XC::Vector workV(3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -609,7 +608,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getCommittedStress(void)
         double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
         if(loadStagex[matN] != 1) scale = 0.;
   if(ndm==3) {
-                static XC::Vector temp7(7);
+                static thread_local XC::Vector temp7(7);
                 workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -631,7 +630,7 @@ const XC::Vector & XC::PressureDependMultiYield02::getCommittedStress(void)
         }
 
   else {
-    static XC::Vector temp5(5);
+    static thread_local XC::Vector temp5(5);
         workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -799,6 +798,7 @@ void XC::PressureDependMultiYield02::setUpSurfaces(const std::vector<double> &gr
 	  }
       }
 
+    mark_surfaces(1, numOfSurfaces+1);
     residualPressx[matN] = residualPress;
     frictionAnglex[matN] = frictionAngle;
     cohesionx[matN] = cohesion;
@@ -1151,9 +1151,9 @@ int XC::PressureDependMultiYield02::stressCorrection(int crossedSurface) const
     double refShearModulus = refShearModulusx[matN];
     double refBulkModulus = refBulkModulusx[matN];
 
-    static XC::T2Vector contactStress;
+    static thread_local XC::T2Vector contactStress;
     getContactStress(contactStress);
-    static XC::T2Vector surfNormal;
+    static thread_local XC::T2Vector surfNormal;
     getSurfaceNormal(contactStress, surfNormal);
     double plasticPotential = getPlasticPotential(contactStress,surfNormal);
     double tVolume = trialStress.volume();
@@ -55,9 +55,6 @@ std::vector<double> XC::PressureDependMultiYieldBase::Hvx;
 std::vector<double> XC::PressureDependMultiYieldBase::Pvx;
 
 double XC::PressureDependMultiYieldBase::pAtm = 101.;
-XC::T2Vector XC::PressureDependMultiYieldBase::trialStrain;
-XC::Vector XC::PressureDependMultiYieldBase::workV6(6);
-XC::T2Vector XC::PressureDependMultiYieldBase::workT2V;
 
 XC::PressureDependMultiYieldBase::PressureDependMultiYieldBase(int tag, int classTag, int nd, 
                                                     double r, double refShearModul,
@@ -76,22 +73,22 @@ XC::PressureDependMultiYieldBase::PressureDependMultiYieldBase(int tag, int clas
                                                     double volLim1, double volLim2, double volLim3,
                                                     double atm, double cohesi,
                                                         double hv, double pv)
-  : XC::PressureMultiYieldBase(tag,classTag,nd,r,frictionAng,peakShearStra,refPress,pressDependCoe,cohesi,numberOfYieldSurf), PPZPivot(), PPZCenter(), PPZPivotCommitted(), PPZCenterCommitted()
+  : XC::PressureMultiYieldBase(tag,classTag,nd,r,frictionAng,peakShearStra,refPress,pressDependCoe,cohesi,numberOfYieldSurf), trialStrain(), PPZPivot(), PPZCenter(), PPZPivotCommitted(), PPZCenterCommitted(), workV6(6), workT2V()
   {
      setupLocalMembers(nd, r, refShearModul, refBulkModul, frictionAng, peakShearStra, refPress, pressDependCoe, phaseTransformAng,  contractionParam1, dilationParam1, dilationParam2, liquefactionParam1, liquefactionParam2, numberOfYieldSurf, gredu, ei, volLim1, volLim2, volLim3, atm, cohesi, hv, pv);
   }
    
 XC::PressureDependMultiYieldBase::PressureDependMultiYieldBase(int tag, int classTag) 
- : XC::PressureMultiYieldBase(tag,classTag), PPZPivot(), PPZCenter(),
-   PPZPivotCommitted(), PPZCenterCommitted()
+ : XC::PressureMultiYieldBase(tag,classTag), trialStrain(), PPZPivot(), PPZCenter(),
+   PPZPivotCommitted(), PPZCenterCommitted(), workV6(6), workT2V()
   {}
 
 
 XC::PressureDependMultiYieldBase::PressureDependMultiYieldBase(const PressureDependMultiYieldBase & a)
- : XC::PressureMultiYieldBase(a), 
+ : XC::PressureMultiYieldBase(a), trialStrain(a.trialStrain),
    PPZPivot(a.PPZPivot), PPZCenter(a.PPZCenter), 
    PPZPivotCommitted(a.PPZPivotCommitted), 
-   PPZCenterCommitted(a.PPZCenterCommitted)
+   PPZCenterCommitted(a.PPZCenterCommitted), workV6(6), workT2V()
   {
     strainPTOcta = a.strainPTOcta;
     modulusFactor = a.modulusFactor;
@@ -366,7 +363,7 @@ const XC::Matrix &XC::PressureDependMultiYieldBase::getInitialTangent(void)
   if(ndm==3) 
     return theTangent;
   else {
-    static XC::Matrix workM(3,3);
+    static thread_local XC::Matrix workM(3,3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -411,7 +408,7 @@ int XC::PressureDependMultiYieldBase::commitState(void)
   if(loadStage==1)
     {
       committedActiveSurf = activeSurfaceNum;
-      committedSurfaces= theSurfaces;
+      commit_surfaces();
       pressureDCommitted = pressureD;
       onPPZCommitted = onPPZ;
       PPZSizeCommitted = PPZSize;
@@ -538,7 +535,7 @@ XC::Response *XC::PressureDependMultiYieldBase::setResponse(const std::vector<st
       {
         const int argc= argv.size();
         const int numOfSurfaces = numOfSurfacesx[matN];
-        static XC::Matrix curv(numOfSurfaces+1,(argc-1)*2);
+        XC::Matrix curv(numOfSurfaces+1,(argc-1)*2);
         for(int i=1; i<argc; i++)
           curv(0,(i-1)*2) = atoi(argv[i]);
         return new MaterialResponse(this, 4, curv);
@@ -633,7 +630,7 @@ const XC::Vector & XC::PressureDependMultiYieldBase::getCommittedStress(void)
         double scale = currentStress.deviatorRatio(residualPress)/committedSurfaces[numOfSurfaces].size();
         if(loadStagex[matN] != 1) scale = 0.;
   if(ndm==3) {
-                static XC::Vector temp7(7);
+                static thread_local XC::Vector temp7(7);
                 workV6 = currentStress.t2Vector();
     temp7[0] = workV6[0];
     temp7[1] = workV6[1];
@@ -646,7 +643,7 @@ const XC::Vector & XC::PressureDependMultiYieldBase::getCommittedStress(void)
         }
 
   else {
-    static XC::Vector temp5(5);  
+    static thread_local XC::Vector temp5(5);  
                 workV6 = currentStress.t2Vector();
     temp5[0] = workV6[0];
     temp5[1] = workV6[1];
@@ -673,7 +670,7 @@ const XC::Vector & XC::PressureDependMultiYieldBase::getCommittedStrain(void)
   if(ndm==3)
     return currentStrain.t2Vector(1);
   else {
-                static XC::Vector workV(3);
+                static thread_local XC::Vector workV(3);
                 workV6 = currentStrain.t2Vector(1);
     workV[0] = workV6[0];
     workV[1] = workV6[1];
@@ -690,7 +687,7 @@ double XC::PressureDependMultiYieldBase::yieldFunc(const XC::T2Vector & stress,
     const double coneHeight = stress.volume() - residualPress;
     //workV6 = stress.deviator() - surfaces[surfaceNum].center()*coneHeight;
     workV6 = stress.deviator();
-    workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
+    surfaces[surfaceNum].addCenter(workV6, -coneHeight);
     const double sz = surfaces[surfaceNum].size()*coneHeight;
     return 3./2.*(workV6 && workV6) - sz * sz;
   }
@@ -709,10 +706,10 @@ void XC::PressureDependMultiYieldBase::deviatorScaling(T2Vector & stress,
   if( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static XC::Vector devia(6);
+    static thread_local XC::Vector devia(6);
     devia = stress.deviator(); 
     workV6 = devia;
-    workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
+    surfaces[surfaceNum].addCenter(workV6, -coneHeight);
     double coeff = (sz-deviaSz) / deviaSz;
     if(coeff < 1.e-13) coeff = 1.e-13;
     //devia += workV6 * coeff;
@@ -739,7 +736,7 @@ void XC::PressureDependMultiYieldBase::initSurfaceUpdate(void) const
   if(committedActiveSurf == 0) return; 
   
   double coneHeight = - (currentStress.volume() - residualPress);
-  static XC::Vector devia(6); 
+  static thread_local XC::Vector devia(6); 
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -760,6 +757,7 @@ void XC::PressureDependMultiYieldBase::initSurfaceUpdate(void) const
     committedSurfaces[i].setCenter(workV6); 
     theSurfaces[i] = committedSurfaces[i];
   }
+  mark_surfaces(1, committedActiveSurf+1);
   activeSurfaceNum = committedActiveSurf;
 }
 
@@ -849,8 +847,8 @@ void XC::PressureDependMultiYieldBase::getContactStress(T2Vector &contactStress)
     double residualPress = residualPressx[matN];
 
   double conHeig = trialStress.volume() - residualPress;
-  static XC::Vector center(6);
-  center = theSurfaces[activeSurfaceNum].center(); 
+  static thread_local XC::Vector center(6);
+  theSurfaces[activeSurfaceNum].getCenter(center); 
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
   workV6.addVector(1.0, center, -conHeig);
@@ -885,8 +883,8 @@ void XC::PressureDependMultiYieldBase::getSurfaceNormal(const XC::T2Vector & str
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static XC::Vector center(6);
-  center = theSurfaces[activeSurfaceNum].center(); 
+  static thread_local XC::Vector center(6);
+  theSurfaces[activeSurfaceNum].getCenter(center); 
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
   //workT2V.setData((workV6-center*conHeig)*3., volume);
@@ -951,14 +949,14 @@ void XC::PressureDependMultiYieldBase::updateActiveSurface(void) const
   if(activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static XC::Vector t1(6);
-  static XC::Vector t2(6);
-  static XC::Vector center(6);
-  static XC::Vector outcenter(6);
+  static thread_local XC::Vector t1(6);
+  static thread_local XC::Vector t2(6);
+  static thread_local XC::Vector center(6);
+  static thread_local XC::Vector outcenter(6);
   double conHeig = trialStress.volume() - residualPress;
-  center = theSurfaces[activeSurfaceNum].center();
+  theSurfaces[activeSurfaceNum].getCenter(center);
   double size = theSurfaces[activeSurfaceNum].size();
-  outcenter = theSurfaces[activeSurfaceNum+1].center();
+  theSurfaces[activeSurfaceNum+1].getCenter(outcenter);
   double outsize = theSurfaces[activeSurfaceNum+1].size();
 
   //t1 = trialStress.deviator() - center*conHeig;
@@ -1018,6 +1016,7 @@ void XC::PressureDependMultiYieldBase::updateActiveSurface(void) const
 
   center.addVector(1.0, workV6, -X);
   theSurfaces[activeSurfaceNum].setCenter(center);
+  mark_surfaces(activeSurfaceNum, activeSurfaceNum+1);
 }      
 
 
@@ -1026,12 +1025,12 @@ void XC::PressureDependMultiYieldBase::updateInnerSurface(void) const
     double residualPress = residualPressx[matN];
 
         if(activeSurfaceNum <= 1) return;
-        static XC::Vector devia(6);
-        static XC::Vector center(6);
+        static thread_local XC::Vector devia(6);
+        static thread_local XC::Vector center(6);
 
         double conHeig = currentStress.volume() - residualPress;
         devia = currentStress.deviator();
-        center = theSurfaces[activeSurfaceNum].center();
+        theSurfaces[activeSurfaceNum].getCenter(center);
         double size = theSurfaces[activeSurfaceNum].size();
 
         for(int i=1; i<activeSurfaceNum; i++) {
@@ -1045,6 +1044,7 @@ void XC::PressureDependMultiYieldBase::updateInnerSurface(void) const
                 workV6 /= conHeig;
                 theSurfaces[i].setCenter(workV6);
         }
+        mark_surfaces(1, activeSurfaceNum);
 }
 
 
@@ -78,7 +78,7 @@ class PressureDependMultiYieldBase: public PressureMultiYieldBase
      mutable double cumuTranslateStrainOcta;
      mutable double prePPZStrainOcta;
      mutable double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     mutable T2Vector trialStrain;
      mutable T2Vector PPZPivot;
      mutable T2Vector PPZCenter;
 
@@ -90,8 +90,8 @@ class PressureDependMultiYieldBase: public PressureMultiYieldBase
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
 
-     static Vector workV6;
-     static T2Vector workT2V;
+     mutable Vector workV6;
+     mutable T2Vector workT2V;
      double maxPress;
      
      void setupLocalMembers(int nd,
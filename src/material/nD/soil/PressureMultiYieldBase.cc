@@ -29,6 +29,7 @@
 #include "PressureMultiYieldBase.h"
 #include <cmath>
 #include <cstdlib>
+#include <algorithm>
 #include <domain/mesh/element/utils/Information.h>
 #include <utility/matrix/ID.h>
 #include <utility/recorder/response/MaterialResponse.h>
@@ -50,9 +51,6 @@ std::vector<int> XC::PressureMultiYieldBase::numOfSurfacesx;
 std::vector<double> XC::PressureMultiYieldBase::residualPressx;
 std::vector<double> XC::PressureMultiYieldBase::stressRatioPTx;
 
-XC::Matrix XC::PressureMultiYieldBase::theTangent(6,6);
-XC::T2Vector XC::PressureMultiYieldBase::subStrainRate;
-
 void XC::PressureMultiYieldBase::resizeIfNeeded(void)
   {
     const int sz= rhox.size();
@@ -71,6 +69,38 @@ void XC::PressureMultiYieldBase::resizeIfNeeded(void)
       }    
   }
 
+//! @brief Mark the surfaces in the range [from,to) as modified
+//! since the last commit (or revert).
+void XC::PressureMultiYieldBase::mark_surfaces(int from, int to) const
+  {
+    if(dirtyBegin>=dirtyEnd)
+      {
+        dirtyBegin= from;
+        dirtyEnd= to;
+      }
+    else
+      {
+        dirtyBegin= std::min(dirtyBegin, from);
+        dirtyEnd= std::max(dirtyEnd, to);
+      }
+  }
+
+//! @brief Copy the modified trial surfaces on the committed ones.
+void XC::PressureMultiYieldBase::commit_surfaces(void) const
+  {
+    if(dirtyBegin<dirtyEnd)
+      std::copy(theSurfaces.begin()+dirtyBegin, theSurfaces.begin()+dirtyEnd, committedSurfaces.begin()+dirtyBegin);
+    dirtyBegin= dirtyEnd= 0;
+  }
+
+//! @brief Restore the modified trial surfaces from the committed ones.
+void XC::PressureMultiYieldBase::revert_surfaces(void) const
+  {
+    if(dirtyBegin<dirtyEnd)
+      std::copy(committedSurfaces.begin()+dirtyBegin, committedSurfaces.begin()+dirtyEnd, theSurfaces.begin()+dirtyBegin);
+    dirtyBegin= dirtyEnd= 0;
+  }
+
 void XC::PressureMultiYieldBase::setRho(const double &d)
   {
     if(d < 0)
@@ -175,25 +205,28 @@ void XC::PressureMultiYieldBase::setup(int nd, double r, double frictionAng,doub
   
     theSurfaces.resize(numOfSurfaces+1); //first surface not used
     committedSurfaces.resize(numOfSurfaces+1); 
+    dirtyBegin= dirtyEnd= 0;
   }
 
 XC::PressureMultiYieldBase::PressureMultiYieldBase(int tag, int classTag) 
- : XC::SoilMaterialBase(tag,classTag), 
-   theSurfaces(), committedSurfaces(),currentStress(), trialStress(), currentStrain(), 
-   strainRate()
+ : XC::SoilMaterialBase(tag,classTag), theTangent(6,6), subStrainRate(),
+   theSurfaces(), committedSurfaces(), dirtyBegin(0), dirtyEnd(0),
+   currentStress(), trialStress(), currentStrain(), strainRate()
   {
     resizeIfNeeded();
   }
 
 XC::PressureMultiYieldBase::PressureMultiYieldBase(int tag, int classTag, int nd, double r, double frictionAng,double peakShearStra, double refPress, double pressDependCoe, double cohesi,int numberOfYieldSurf)
- :XC::SoilMaterialBase(tag,classTag), theSurfaces(), committedSurfaces(), currentStress(),trialStress(), currentStrain(), strainRate()
+ :XC::SoilMaterialBase(tag,classTag), theTangent(6,6), subStrainRate(), theSurfaces(), committedSurfaces(), dirtyBegin(0), dirtyEnd(0), currentStress(),trialStress(), currentStrain(), strainRate()
   {
     resizeIfNeeded();
     setup(nd,r,frictionAng,peakShearStra,refPress,pressDependCoe,cohesi,numberOfYieldSurf);
   }
 
 XC::PressureMultiYieldBase::PressureMultiYieldBase(const PressureMultiYieldBase & a)
- : XC::SoilMaterialBase(a), currentStress(a.currentStress), trialStress(a.trialStress), 
+ : XC::SoilMaterialBase(a), theTangent(a.theTangent), subStrainRate(a.subStrainRate),
+  dirtyBegin(a.dirtyBegin), dirtyEnd(a.dirtyEnd),
+  currentStress(a.currentStress), trialStress(a.trialStress), 
   currentStrain(a.currentStrain), strainRate(a.strainRate)
   {
     matN = a.matN;
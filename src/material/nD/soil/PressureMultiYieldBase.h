@@ -32,6 +32,7 @@
 
 #include <material/nD/soil/SoilMaterialBase.h>
 #include "T2Vector.h"
+#include "utility/matrix/Matrix.h"
 
 
 namespace XC {
@@ -56,11 +57,13 @@ class PressureMultiYieldBase: public SoilMaterialBase
     // internal
     static std::vector<double> residualPressx;
     static std::vector<double> stressRatioPTx;
-    static Matrix theTangent;
-    static T2Vector subStrainRate;
+    mutable Matrix theTangent;
+    mutable T2Vector subStrainRate;
 
     mutable std::vector<MultiYieldSurface> theSurfaces; // NOTE: surfaces[0] is not used  
     mutable std::vector<MultiYieldSurface> committedSurfaces;  
+    mutable int dirtyBegin; //!< first surface that may differ from its committed state.
+    mutable int dirtyEnd; //!< one past the last surface that may differ from its committed state.
     mutable int activeSurfaceNum;  
     mutable int committedActiveSurf;
     mutable T2Vector currentStress;
@@ -70,6 +73,9 @@ class PressureMultiYieldBase: public SoilMaterialBase
 
   protected:
     void resizeIfNeeded(void);
+    void mark_surfaces(int from, int to) const;
+    void commit_surfaces(void) const;
+    void revert_surfaces(void) const;
     void setup(int nd, double r, double frictionAng,double peakShearStra, double refPress, double pressDependCoe, double cohesi,int numberOfYieldSurf);
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -40,7 +40,7 @@
 #include "T2Vector.h"
 
 
-XC::Vector XC::T2Vector::engrgStrain(6);
+thread_local XC::Vector XC::T2Vector::engrgStrain(6);
 
 //! @brief scalar product of two second order tensor vectors
 double XC::operator && (const XC::Vector & a, const XC::Vector & b)
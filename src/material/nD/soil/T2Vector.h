@@ -68,7 +68,7 @@ class T2Vector: public MovableObject
     Vector theT2Vector;
     Vector theDeviator;
     double theVolume;
-    static Vector engrgStrain;
+    static thread_local Vector engrgStrain;
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -76,6 +76,7 @@
 #include <utility/matrix/nDarray/stresst.h>
 #include <utility/matrix/nDarray/straint.h>
 #include <utility/matrix/nDarray/BJtensor.h>
+#include <utility/matrix/nDarray/FixedTensor.h>
 //** Include the Elastic Material Models here
 #include <material/nD/elastic_isotropic/ElasticIsotropic3D.h>
 #include <material/nD/ElasticCrossAnisotropic.h>
@@ -1266,7 +1267,11 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
 
     straintensor strain_incr = strain_increment;
     strain_incr.null_indices();
-    stresstensor stress_increment(E("ijpq") * strain_incr("pq"));
+    // Fixed size copies of the elastic tensors (avoid the allocations
+    // and the index parsing of the BJtensor products).
+    const FixedTensor4 Ef(E);
+    const FixedTensor4 Df(D);
+    stresstensor stress_increment(double_contraction(Ef, FixedTensor2(strain_incr)).data());
     stress_increment.null_indices();
     //std::cerr << " stress_increment: " << stress_increment << std::endl;
 
@@ -1344,7 +1349,7 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
         //forwardEPS.setStress( elpl_start_stress );
   //Should only count on that elastic portion, not st_vol...
         if( getELT1() ) {
-            El_strain_increment = D("ijpq") * EstressIncr("pq");
+            El_strain_increment = straintensor(double_contraction(Df, FixedTensor2(EstressIncr)).data());
        double st_vol_El_incr = El_strain_increment.Iinvariant1();
 
       //std::cerr << " FE crossing update... ";
@@ -1374,11 +1379,9 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
     stresstensor dFods;
     stresstensor dQods;
     //  stresstensor s;  // deviator
-    BJtensor H( def_dim_2, 0.0);
-    BJtensor temp1( def_dim_2, 0.0);
-    BJtensor temp2( def_dim_2, 0.0);
+    FixedTensor2 H;
+    FixedTensor2 temp1;
     double lower = 0.0;
-    BJtensor temp3( def_dim_2, 0.0);
 
     double Delta_lambda = 0.0;
     double h_s[4]       = {0.0, 0.0, 0.0, 0.0};
@@ -1408,13 +1411,11 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
         //std::cerr << "dQ/ds" << dQods << std::endl;
 
         // XC::Tensor H_kl  ( eq. 5.209 ) W.F. Chen
-        H = E("ijkl")*dQods("kl");       //E_ijkl * R_kl
-        H.null_indices();
-        temp1 = dFods("ij") * E("ijkl"); // L_ij * E_ijkl
-        temp1.null_indices();
-        temp2 = temp1("ij")*dQods("ij"); // L_ij * E_ijkl * R_kl
-        temp2.null_indices();
-        lower = temp2.trace();
+        const FixedTensor2 dFodsf(dFods);
+        const FixedTensor2 dQodsf(dQods);
+        H = double_contraction(Ef, dQodsf);       //E_ijkl * R_kl
+        temp1 = double_contraction(dFodsf, Ef); // L_ij * E_ijkl
+        lower = double_contraction(temp1, dQodsf); // L_ij * E_ijkl * R_kl
 
         // Evaluating the hardening modulus: sum of  (df/dq*) * qbar
 
@@ -1452,32 +1453,28 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
   if( getELT1() ) {
      h_t[0]  = getELT1()->h_t(&IntersectionEPS, getPS());
      xi_t[0] = getYS()->xi_t1( &IntersectionEPS );
-           BJtensor hm = (h_t[0])("ij") * (xi_t[0])("ij");
-       hardMod_ = hardMod_ + hm.trace();
+       hardMod_ = hardMod_ + double_contraction(FixedTensor2(h_t[0]), FixedTensor2(xi_t[0]));
   }
 
   // 2nd tensorial var
   if( getELT2() ) {
      h_t[1]  = getELT2()->h_t( &IntersectionEPS, getPS());
        xi_t[1] = getYS()->xi_t2( &IntersectionEPS );
-           BJtensor hm = (h_t[1])("ij") * (xi_t[1])("ij");
-       hardMod_ = hardMod_ + hm.trace();
+       hardMod_ = hardMod_ + double_contraction(FixedTensor2(h_t[1]), FixedTensor2(xi_t[1]));
   }
 
   // 3rd tensorial var
   if( getELT3() ) {
      h_t[2]  = getELT3()->h_t( &IntersectionEPS, getPS());
      xi_t[2] = getYS()->xi_t3( &IntersectionEPS );
-           BJtensor hm = (h_t[2])("ij") * (xi_t[2])("ij");
-       hardMod_ = hardMod_ + hm.trace();
+       hardMod_ = hardMod_ + double_contraction(FixedTensor2(h_t[2]), FixedTensor2(xi_t[2]));
   }
 
   // 4th tensorial var
   if( getELT4() ) {
      h_t[3]  = getELT4()->h_t(&IntersectionEPS, getPS());
      xi_t[3] = getYS()->xi_t4( &IntersectionEPS );
-           BJtensor hm = (h_t[3])("ij") * (xi_t[3])("ij");
-       hardMod_ = hardMod_ + hm.trace();
+       hardMod_ = hardMod_ + double_contraction(FixedTensor2(h_t[3]), FixedTensor2(xi_t[3]));
   }
 
   // Subtract accumulated hardMod_ from lower
@@ -1493,17 +1490,16 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
         //std::cerr << " stress_increment "<< stress_increment << std::endl;
         //std::cerr << " true_stress_increment "<< true_stress_increment << std::endl;
 
-        temp3 = dFods("ij") * true_stress_increment("ij"); // L_ij * E_ijkl * d e_kl (true ep strain increment)
-        temp3.null_indices();
+        const double temp3= double_contraction(dFodsf, FixedTensor2(true_stress_increment)); // L_ij * E_ijkl * d e_kl (true ep strain increment)
         //std::cerr << " temp3.trace() -- true_stress_incr " << temp3.trace() << std::endl;
   //GZ  temp3 = temp1("ij")*strain_incr("ij");
   //GZ  temp3.null_indices();
         //std::cerr << " temp3.trace() " << temp3.trace() << std::endl;
-        Delta_lambda = (temp3.trace())/lower;
+        Delta_lambda = temp3/lower;
         //std::cerr << "FE: Delta_lambda " <<  Delta_lambda << std::endl;
         if(Delta_lambda<0.0) Delta_lambda=0.0;
 
-        plastic_stress = H("kl") * Delta_lambda;
+        plastic_stress = stresstensor((H*Delta_lambda).data());
         plastic_strain = dQods("kl") * Delta_lambda; // plastic strain increment
         plastic_stress.null_indices();
         plastic_strain.null_indices();
@@ -1548,14 +1544,11 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
         dFods = getYS()->dFods( &IntersectionEPS );
         dQods = getPS()->dQods( &IntersectionEPS );
 
-  BJtensor upperE1 = E("pqkl")*dQods("kl");
-        upperE1.null_indices();
-  BJtensor upperE2 = dFods("ij")*E("ijmn");
-        upperE2.null_indices();
+  const FixedTensor2 upperE1= double_contraction(Ef, FixedTensor2(dQods));
+  const FixedTensor2 upperE2= double_contraction(FixedTensor2(dFods), Ef);
 
   //BJtensor upperE = upperE1("pq") * upperE1("mn");  // Bug found, Zhao Cheng Jan13, 2004
-  BJtensor upperE = upperE1("pq") * upperE2("mn");
-        upperE.null_indices();
+  const FixedTensor4 upperE= outer_product(upperE1, upperE2);
 
         /*//temp2 = upperE2("ij")*dQods("ij"); // L_ij * E_ijkl * R_kl
         temp2.null_indices();
@@ -1631,14 +1624,14 @@ XC::EPState XC::Template3Dep::ForwardEulerEPState(const straintensor &strain_inc
   lower = lower - hardMod_;
   */
 
-        BJtensor Ep = upperE*(1./lower);
+        const FixedTensor4 Ep= upperE*(1./lower);
 
   // elastoplastic constitutive XC::BJtensor
   double h_L = 0.0; // Bug fixed Joey 07-21-02 added h(L) function
   if( Delta_lambda > 0 ) h_L = 1.0;
   //std::cerr << " h_L = " << h_L << "\n";
         //Eep =  Eep - Ep*h_L;  // Bug found, Zhao Cheng Jan13, 2004
-  Eep =  E - Ep*h_L;
+  Eep =  (Ef - Ep*h_L).getBJtensor();
 
        //std::cerr <<" after calculation---Eep.rank()= " << Eep.rank() <<std::endl;
   //Eep.printshort(" IN template ");
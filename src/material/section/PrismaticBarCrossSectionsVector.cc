@@ -190,6 +190,21 @@ bool XC::PrismaticBarCrossSectionsVector::needsUpdate(void) const
     return retval;
   }
 
+//! @brief Return true if all the sections allow concurrent
+//! state determination.
+bool XC::PrismaticBarCrossSectionsVector::allowsConcurrentStateDetermination(void) const
+  {
+    bool retval= !empty();
+
+    for(const_iterator i=begin();i!=end();i++)
+      if(!(*i) || !(*i)->allowsConcurrentStateDetermination())
+	{
+	  retval= false;
+	  break;
+	}
+    return retval;
+  }
+
 //! @brief Commits sections state.
 int XC::PrismaticBarCrossSectionsVector::commitState(void)
   {
@@ -79,6 +79,7 @@ class PrismaticBarCrossSectionsVector: public CommandEntity, public std::vector<
     void setTrialSectionDeformations(const std::vector<Vector> &vs);
 
     bool needsUpdate(void) const;
+    bool allowsConcurrentStateDetermination(void) const;
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
@@ -71,6 +71,9 @@ class BaseElasticSection: public PrismaticBarCrossSection
     void zeroInitialSectionDeformation(void)
       { eInic.Zero(); }
     const Vector &getSectionDeformation(void) const;
+    //! @brief Stress resultant work areas are per-thread.
+    bool allowsConcurrentStateDetermination(void) const
+      { return true; }
     virtual double getRho(void) const= 0;
     virtual void setRho(const double &)= 0;
 
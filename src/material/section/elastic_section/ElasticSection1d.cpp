@@ -33,7 +33,7 @@
 #include <utility/matrix/Vector.h>
 #include "material/ResponseId.h"
 
-XC::Vector XC::ElasticSection1d::s(1);
+thread_local XC::Vector XC::ElasticSection1d::s(1);
 
 //! @brief Constructor.
 //!
@@ -83,7 +83,7 @@ class Information;
 class ElasticSection1d: public BaseElasticSection1d
   {
   private:
-    static Vector s;
+    static thread_local Vector s;
   public:
     ElasticSection1d(int tag= 0, double E= 0.0, double A=0.0);
     ElasticSection1d(int tag, double EA);
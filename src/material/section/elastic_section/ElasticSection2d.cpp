@@ -71,7 +71,7 @@
 
 #include "material/ResponseId.h"
 
-XC::Vector XC::ElasticSection2d::s(2);
+thread_local XC::Vector XC::ElasticSection2d::s(2);
 
 //! @brief Constructor.
 //!
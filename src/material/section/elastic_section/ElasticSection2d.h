@@ -83,7 +83,7 @@ class Information;
 class ElasticSection2d: public BaseElasticSection2d
   {
   private:
-    static Vector s;
+    static thread_local Vector s;
   public:
     ElasticSection2d(int tag, double E, double A, double I);
     ElasticSection2d(int tag, double EA, double EI);
@@ -67,7 +67,7 @@
 
 #include "material/ResponseId.h"
 
-XC::Vector XC::ElasticSection3d::s(4);
+thread_local XC::Vector XC::ElasticSection3d::s(4);
 
 //! @brief Constructor.
 //!
@@ -81,7 +81,7 @@ class Information;
 class ElasticSection3d: public BaseElasticSection3d
   {
   private:   
-    static Vector s;
+    static thread_local Vector s;
   public:
     ElasticSection3d(int tag, MaterialHandler *mat_ldr= nullptr, const CrossSectionProperties3d &ctes= CrossSectionProperties3d());
     ElasticSection3d(int tag, double E, double A, double Iz, double Iy, double G, double J);
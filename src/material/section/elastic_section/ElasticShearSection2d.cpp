@@ -58,7 +58,7 @@
 
 #include <cstdlib>
 
-XC::Vector XC::ElasticShearSection2d::s(3);
+thread_local XC::Vector XC::ElasticShearSection2d::s(3);
 
 //! @brief Default constructor.
 XC::ElasticShearSection2d::ElasticShearSection2d(void)
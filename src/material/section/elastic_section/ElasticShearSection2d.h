@@ -68,7 +68,7 @@ class ResponseId;
 class ElasticShearSection2d: public BaseElasticSection2d
   {
   private:
-    static Vector s;
+    static thread_local Vector s;
     int parameterID;
   protected:
     int sendData(Communicator &);
@@ -55,8 +55,8 @@
 #include "material/ResponseId.h"
 #include "utility/utils/misc_utils/colormod.h"
 
-XC::Vector XC::ElasticShearSection3d::s(6);
-XC::Matrix XC::ElasticShearSection3d::ks(6,6);
+thread_local XC::Vector XC::ElasticShearSection3d::s(6);
+thread_local XC::Matrix XC::ElasticShearSection3d::ks(6,6);
 
 //! @brief Default constructor.
 XC::ElasticShearSection3d::ElasticShearSection3d(void)
@@ -69,8 +69,8 @@ class ElasticShearSection3d: public BaseElasticSection3d
   {
   private:
   
-    static Vector s;
-    static Matrix ks;
+    static thread_local Vector s;
+    static thread_local Matrix ks;
 
     int parameterID;
   protected:
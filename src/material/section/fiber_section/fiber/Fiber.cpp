@@ -67,6 +67,8 @@
 
 #include "utility/geom/pos_vec/Pos2d.h"
 
+std::atomic<size_t> XC::Fiber::modificationStamp(0);
+
 //! @brief Constructor.
 XC::Fiber::Fiber(int tag, int classTag)
   : TaggedObject(tag), MovableObject(classTag), dead(false) {}
@@ -69,6 +69,7 @@
 
 #include "utility/tagged/TaggedObject.h"
 #include "utility/actor/actor/MovableObject.h"
+#include <atomic>
 
 class Pos2d;
 
@@ -90,12 +91,21 @@ class Response;
 class Fiber: public TaggedObject, public MovableObject
   {
     bool dead; //!< True if fiber is inactive.
+    static std::atomic<size_t> modificationStamp; //!< incremented each time the geometry or the material of a fiber changes.
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
+    //! @brief Notify that the position, the area or the material
+    //! of the fiber have changed (see FiberArrays).
+    inline static void markAsModified(void)
+      { modificationStamp++; }
 
   public:
     Fiber(int tag, int classTag);
+    //! @brief Return the number of changes of the position, area or
+    //! material of the fibers.
+    inline static size_t getModificationStamp(void)
+      { return modificationStamp; }
 
     virtual int setTrialFiberStrain(const Vector &vs)=0;
     virtual Vector &getFiberStressResultants(void) =0;
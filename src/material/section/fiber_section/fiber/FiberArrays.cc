@@ -0,0 +1,252 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberArrays.cc
+
+#include "FiberArrays.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <typeindex>
+#include <algorithm>
+
+//! @brief Constructor.
+XC::FiberArrays::FiberArrays(void)
+  : fibers(), fiberStamp(0), Atot(0.0), Qy(0.0), Qz(0.0), built(false)
+  {}
+
+//! @brief Copy constructor.
+//!
+//! The arrays store pointers to the fibers of the other container,
+//! so they are not copied (they will be rebuilt when needed).
+XC::FiberArrays::FiberArrays(const FiberArrays &)
+  : fibers(), fiberStamp(0), Atot(0.0), Qy(0.0), Qz(0.0), built(false)
+  {}
+
+//! @brief Assignment operator (see copy constructor).
+XC::FiberArrays &XC::FiberArrays::operator=(const FiberArrays &)
+  {
+    clear();
+    return *this;
+  }
+
+//! @brief Free the memory and mark the arrays as not built.
+void XC::FiberArrays::clear(void)
+  {
+    dbl_vector().swap(y);
+    dbl_vector().swap(z);
+    dbl_vector().swap(area);
+    std::vector<UniaxialMaterial *>().swap(materials);
+    dbl_vector().swap(strain);
+    dbl_vector().swap(stress);
+    dbl_vector().swap(tangent);
+    std::vector<Batch>().swap(batches);
+    std::vector<Fiber *>().swap(zeroAreaFibers);
+    std::vector<const Fiber *>().swap(fibers);
+    fiberStamp= 0;
+    Atot= 0.0; Qy= 0.0; Qz= 0.0;
+    built= false;
+  }
+
+//! @brief Return true if the arrays correspond to the fibers being
+//! passed as parameter and no fiber has changed its position, area
+//! or material since they were built.
+bool XC::FiberArrays::isUpToDate(const std::deque<Fiber *> &fibs) const
+  {
+    return (built && (fiberStamp==Fiber::getModificationStamp())
+            && (fibers.size()==fibs.size())
+            && std::equal(fibs.begin(), fibs.end(), fibers.begin()));
+  }
+
+//! @brief Copy the data of the fibers in the arrays, sorting
+//! them by material class.
+void XC::FiberArrays::build(const std::deque<Fiber *> &fibs)
+  {
+    clear();
+    fibers.assign(fibs.begin(), fibs.end());
+    fiberStamp= Fiber::getModificationStamp();
+    std::vector<Fiber *> tmp;
+    tmp.reserve(fibs.size());
+    for(std::deque<Fiber *>::const_iterator i= fibs.begin();i!=fibs.end();i++)
+      {
+        if((*i)->getArea()!=0.0)
+          tmp.push_back(*i);
+        else
+          zeroAreaFibers.push_back(*i);
+      }
+    // sort by material class (keeping the order of the fibers
+    // with the same class).
+    std::stable_sort(tmp.begin(), tmp.end(), [](Fiber *a, Fiber *b)
+      { return std::type_index(typeid(*a->getMaterial())) < std::type_index(typeid(*b->getMaterial())); });
+    const size_t n= tmp.size();
+    y.resize(n); z.resize(n); area.resize(n);
+    materials.resize(n);
+    strain.assign(n,0.0); stress.assign(n,0.0); tangent.assign(n,0.0);
+    for(size_t i= 0;i<n;i++)
+      {
+        const Fiber *f= tmp[i];
+        f->getFiberLocation(y[i], z[i]);
+        area[i]= f->getArea();
+        materials[i]= tmp[i]->getMaterial();
+        Atot+= area[i];
+        Qy+= y[i]*area[i];
+        Qz+= z[i]*area[i];
+        if((i==0) || (typeid(*materials[i])!=typeid(*materials[i-1])))
+          batches.push_back(Batch{i,i+1});
+        else
+          batches.back().last= i+1;
+      }
+    built= true;
+  }
+
+//! @brief Return the y coordinate of the center of mass of
+//! the fibers.
+double XC::FiberArrays::getCenterOfMassY(void) const
+  { return (Atot!=0.0 ? Qy/Atot : Qy); }
+
+//! @brief Return the z coordinate of the center of mass of
+//! the fibers.
+double XC::FiberArrays::getCenterOfMassZ(void) const
+  { return (Atot!=0.0 ? Qz/Atot : Qz); }
+
+//! @brief Compute the strain of the fibers from the section
+//! deformation (strain=e0+y*ey+z*ez) and update the materials,
+//! batch by batch.
+//!
+//! @param e0: axial strain.
+//! @param ey: strain gradient along y.
+//! @param ez: strain gradient along z.
+//! @return sum of the values returned by the material kernels.
+int XC::FiberArrays::setTrialStrain(const double &e0, const double &ey, const double &ez)
+  {
+    const size_t n= size();
+    const double *yp= y.data();
+    const double *zp= z.data();
+    double *ep= strain.data();
+    #pragma omp simd
+    for(size_t i= 0;i<n;i++)
+      ep[i]= e0+yp[i]*ey+zp[i]*ez;
+    int retval= 0;
+    for(std::vector<Batch>::const_iterator b= batches.begin();b!=batches.end();b++)
+      {
+        const size_t first= b->first;
+        retval+= materials[first]->setTrialBatch(b->last-first, materials.data()+first, ep+first, stress.data()+first, tangent.data()+first);
+      }
+    return retval;
+  }
+
+//! @brief Read the stress and the tangent from the current state
+//! of the materials.
+void XC::FiberArrays::updateState(void)
+  {
+    const size_t n= size();
+    for(size_t i= 0;i<n;i++)
+      {
+        stress[i]= materials[i]->getStress();
+        tangent[i]= materials[i]->getTangent();
+      }
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness
+//! matrix and the stress resultant of a 2D section.
+//!
+//! @param k: stiffness matrix data (2x2 column-major).
+//! @param r: stress resultant data (N, Mz).
+void XC::FiberArrays::updateK2d(double k[], double r[]) const
+  {
+    const size_t n= size();
+    const double *yp= y.data();
+    const double *ap= area.data();
+    const double *sp= stress.data();
+    const double *tp= tangent.data();
+    double k00= 0.0, k01= 0.0, k11= 0.0, N= 0.0, Mz= 0.0;
+    #pragma omp simd reduction(+:k00,k01,k11,N,Mz)
+    for(size_t i= 0;i<n;i++)
+      {
+        const double value= tp[i]*ap[i];
+        const double vas1= yp[i]*value;
+        k00+= value;
+        k01+= vas1;
+        k11+= vas1*yp[i];
+        const double fs0= sp[i]*ap[i];
+        N+= fs0;
+        Mz+= fs0*yp[i];
+      }
+    k[0]+= k00; k[1]+= k01; k[3]+= k11;
+    r[0]+= N; r[1]+= Mz;
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness
+//! matrix and the stress resultant of a 3D section.
+//!
+//! @param k: stiffness matrix data (3x3 column-major, lower triangle).
+//! @param r: stress resultant data (N, Mz, My).
+void XC::FiberArrays::updateK3d(double k[], double r[]) const
+  {
+    const size_t n= size();
+    const double *yp= y.data();
+    const double *zp= z.data();
+    const double *ap= area.data();
+    const double *sp= stress.data();
+    const double *tp= tangent.data();
+    double k00= 0.0, k01= 0.0, k02= 0.0, k11= 0.0, k12= 0.0, k22= 0.0;
+    double N= 0.0, Mz= 0.0, My= 0.0;
+    #pragma omp simd reduction(+:k00,k01,k02,k11,k12,k22,N,Mz,My)
+    for(size_t i= 0;i<n;i++)
+      {
+        const double value= tp[i]*ap[i];
+        const double vas1= yp[i]*value;
+        const double vas2= zp[i]*value;
+        k00+= value;
+        k01+= vas1;
+        k02+= vas2;
+        k11+= vas1*yp[i];
+        k12+= vas1*zp[i];
+        k22+= vas2*zp[i];
+        const double fs0= sp[i]*ap[i];
+        N+= fs0;
+        Mz+= fs0*yp[i];
+        My+= fs0*zp[i];
+      }
+    k[0]+= k00; k[1]+= k01; k[2]+= k02;
+    k[4]+= k11; k[5]+= k12;
+    k[8]+= k22;
+    r[0]+= N; r[1]+= Mz; r[2]+= My;
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness
+//! matrix and the stress resultant of a 3D section with torsion
+//! (the torsional terms are not computed here).
+//!
+//! @param k: stiffness matrix data (4x4 column-major, lower triangle).
+//! @param r: stress resultant data (N, Mz, My, T).
+void XC::FiberArrays::updateKGJ(double k[], double r[]) const
+  {
+    double k3d[9]= {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
+    updateK3d(k3d, r);
+    k[0]+= k3d[0]; k[1]+= k3d[1]; k[2]+= k3d[2];
+    k[5]+= k3d[4]; k[6]+= k3d[5];
+    k[10]+= k3d[8];
+  }
@@ -0,0 +1,117 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FiberArrays.h
+
+#ifndef FiberArrays_h
+#define FiberArrays_h
+
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+namespace XC {
+class Fiber;
+class UniaxialMaterial;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Fiber data stored as structure of arrays.
+//!
+//! The position, area and material of the fibers of a section are
+//! copied in contiguous arrays, sorted by material class, so:
+//!   - the strains of the fibers are computed in a single
+//!     vectorizable loop.
+//!   - the fibers whose materials have the same class are updated
+//!     in batches by the kernel of the material (see
+//!     UniaxialMaterial::setTrialBatch).
+//!   - the section stiffness and stress resultants are obtained by
+//!     vectorizable reductions.
+//! The fibers with zero area (that don't contribute to the section
+//! response) are stored apart. The arrays are a cache of the
+//! fiber container data and must be rebuilt each time the fibers
+//! change: the fiber pointers are compared with those of the
+//! container (fibers added, removed or replaced) and the
+//! modification stamp of the fibers (see Fiber::getModificationStamp)
+//! reveals the changes of position, area or material of the fibers.
+class FiberArrays
+  {
+  public:
+    typedef std::vector<double> dbl_vector;
+    //! @brief Fibers whose materials are of the same class.
+    struct Batch
+      {
+        size_t first; //!< index of the first fiber of the batch.
+        size_t last; //!< index past the last fiber of the batch.
+      };
+  private:
+    dbl_vector y; //!< y coordinate of the fibers.
+    dbl_vector z; //!< z coordinate of the fibers.
+    dbl_vector area; //!< area of the fibers.
+    std::vector<UniaxialMaterial *> materials; //!< fiber materials.
+    dbl_vector strain; //!< trial strain of the fibers.
+    dbl_vector stress; //!< stress of the fibers.
+    dbl_vector tangent; //!< tangent stiffness of the fibers.
+    std::vector<Batch> batches; //!< ranges of fibers with the same material class.
+    std::vector<Fiber *> zeroAreaFibers; //!< fibers with zero area.
+    std::vector<const Fiber *> fibers; //!< fibers of the container (zero area included) when the arrays were built.
+    size_t fiberStamp; //!< modification stamp of the fibers when the arrays were built.
+    double Atot; //!< total area.
+    double Qy; //!< static moment (sum of y*area).
+    double Qz; //!< static moment (sum of z*area).
+    bool built; //!< true if the arrays are up to date.
+  public:
+    FiberArrays(void);
+    FiberArrays(const FiberArrays &);
+    FiberArrays &operator=(const FiberArrays &);
+
+    void clear(void);
+    bool isUpToDate(const std::deque<Fiber *> &) const;
+    void build(const std::deque<Fiber *> &);
+
+    //! @brief Return the number of fibers with non-zero area.
+    inline size_t size(void) const
+      { return y.size(); }
+    //! @brief Return the number of batches.
+    inline size_t getNumBatches(void) const
+      { return batches.size(); }
+    //! @brief Return the fibers with zero area.
+    inline const std::vector<Fiber *> &getZeroAreaFibers(void) const
+      { return zeroAreaFibers; }
+    double getCenterOfMassY(void) const;
+    double getCenterOfMassZ(void) const;
+
+    int setTrialStrain(const double &, const double &, const double &);
+    void updateState(void);
+    void updateK2d(double k[], double r[]) const;
+    void updateK3d(double k[], double r[]) const;
+    void updateKGJ(double k[], double r[]) const;
+  };
+
+} // end of XC namespace
+
+#endif
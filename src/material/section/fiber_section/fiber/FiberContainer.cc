@@ -86,6 +86,7 @@ void XC::FiberContainer::free_mem(void)
           (*this)[i]= nullptr;
         }
     clear();
+    fiberArrays.clear();
   }
 
 //! @brief Default constructor.
@@ -77,7 +77,19 @@ XC::FiberPtrDeque &XC::FiberPtrDeque::operator=(const FiberPtrDeque &other)
 
 //! @brief Adds the fiber to the container.
 void XC::FiberPtrDeque::push_back(Fiber *f)
-   { fiber_ptrs_dq::push_back(f); }
+   {
+     fiberArrays.clear();
+     fiber_ptrs_dq::push_back(f);
+   }
+
+//! @brief Return the fiber data as structure of arrays, building
+//! them if the fibers have changed.
+XC::FiberArrays &XC::FiberPtrDeque::getFiberArrays(void)
+  {
+    if(!fiberArrays.isUpToDate(*this))
+      fiberArrays.build(*this);
+    return fiberArrays;
+  }
 
 
 //! @brief Return true if the material of any of its fibers needs to update
@@ -1743,36 +1755,13 @@ int XC::FiberPtrDeque::updateCenterOfMass(void)
 int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
     kr2.zero();
-    double Qz= 0.0;
-    double Atot= 0.0;//!< Total area of the fibers.
-    double fiberArea= 0.0;//!< Area of a fiber.
-    double yLoc= 0.0, zLoc= 0.0;
-
-    double tangent,stress,fs0;
+    FiberArrays &fa= getFiberArrays();
     // Recompute centroid
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        (*i)->getFiberLocation(yLoc, zLoc);
-        fiberArea= (*i)->getArea();
-        if(fiberArea!= 0.0)
-          {
-            Atot+= fiberArea;
-            Qz+= -yLoc*fiberArea; //minus y coordinate.
+    yCenterOfMass= fa.getCenterOfMassY();
 
-            //Updating stiffness matrix.
-            tangent= (*i)->getMaterial()->getTangent();
-            kr2.updateK2d(fiberArea,yLoc,tangent);
-
-            //Updating stress resultant.
-            stress= (*i)->getMaterial()->getStress();
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,yLoc);
-          }
-      }
-    yCenterOfMass= -Qz; //center or mass z coordinate
-    if(Atot!=0.0)
-        yCenterOfMass/= Atot;
+    // Updating stiffness matrix and stress resultant.
+    fa.updateState();
+    fa.updateK2d(kr2.kData,kr2.rData);
     kr2.kData[2]= kr2.kData[1]; //Symmetry.
     return 0;
   }
@@ -1805,32 +1794,19 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection2d &Sectio
   }
 
 //! @brief Sets trial strains values.
+//!
+//! The fibers are updated in batches of the same material class
+//! (see FiberArrays); the fibers with zero area are not updated.
 int XC::FiberPtrDeque::setTrialSectionDeformation(const FiberSection2d &Section2d,CrossSectionKR &kr2)
   {
-    int retval= 0;
     kr2.zero();
-    UniaxialMaterial *theMat;
-    double y,fiberArea,strain,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            strain= Section2d.get_strain(y);
-            retval+= theMat->setTrial(strain, stress, tangent);
-
-            //Updating stiffness matrix.
-            kr2.updateK2d(fiberArea,y,tangent);
+    FiberArrays &fa= getFiberArrays();
+    // determine material strains (def(0) + y*def(1)) and set them.
+    const Vector &def= Section2d.getSectionDeformation();
+    const int retval= fa.setTrialStrain(def(0),def(1),0.0);
 
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr2.updateNMz(fs0,y);
-          }
-      }
+    // Updating stiffness matrix and stress resultant.
+    fa.updateK2d(kr2.kData,kr2.rData);
     kr2.kData[2]= kr2.kData[1]; //Symmetry.
     return retval;
   }
@@ -1926,43 +1902,14 @@ int XC::FiberPtrDeque::commitSensitivity(const XC::Vector& defSens, int gradNumb
 int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
     kr3.zero();
-    double Qy= 0.0,Qz= 0.0;
-    double Atot= 0.0;
-    double fiberArea= 0.0;
-    double yLoc= 0.0, zLoc= 0.0;
-
+    FiberArrays &fa= getFiberArrays();
     // Recompute centroid
-    double stress,tangent,fs0;
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        yLoc= (*i)->getLocY();
-        zLoc= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            Atot+= fiberArea;
-            Qz+= -yLoc*fiberArea; //minus y coordinate.
-            Qy+= zLoc*fiberArea;
-
-            //Updating stiffness matrix.
-            tangent= (*i)->getMaterial()->getTangent();
-
-            kr3.updateK3d(fiberArea,yLoc,zLoc,tangent);
+    yCenterOfMass= fa.getCenterOfMassY();
+    zCenterOfMass= fa.getCenterOfMassZ();
 
-            //Updating stress resultant.
-            stress= (*i)->getMaterial()->getStress();
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,yLoc,zLoc);
-	  }
-      }
-    yCenterOfMass= -Qz; //center of mass y coordinate  XXX ¿Signo menos?
-    zCenterOfMass= Qy; //center of mass z coordinate
-    if(Atot!=0.0)
-      {
-        yCenterOfMass/= Atot;
-        zCenterOfMass/= Atot;
-      }
+    // Updating stiffness matrix and stress resultant.
+    fa.updateState();
+    fa.updateK3d(kr3.kData,kr3.rData);
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
     kr3.kData[6]= kr3.kData[2];
     kr3.kData[7]= kr3.kData[5];
@@ -1988,33 +1935,24 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection3d &Sectio
   }
 
 //! @brief Set the trial strains.
+//!
+//! The fibers are updated in batches of the same material class
+//! (see FiberArrays).
 int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSection3d &Section3d,CrossSectionKR &kr3)
   {
-    int retval= 0;
     kr3.zero();
-    std::deque<Fiber *>::iterator i= begin();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-
-        // determine material strain and set it
-        retval+= theMat->setTrial(Section3d.get_strain(y,z), stress, tangent);
-
-        //Updating stiffness matrix.
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            kr3.updateK3d(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            kr3.updateNMzMy(fs0,y,z);
-          }
-      }
+    FiberArrays &fa= getFiberArrays();
+    // determine material strains (def(0) + y*def(1) + z*def(2)) and set them.
+    const Vector &def= Section3d.getSectionDeformation();
+    int retval= fa.setTrialStrain(def(0),def(1),def(2));
+    // fibers with zero area (no contribution to K and R).
+    const std::vector<Fiber *> &zeroAreaFibers= fa.getZeroAreaFibers();
+    double stress, tangent;
+    for(std::vector<Fiber *>::const_iterator i= zeroAreaFibers.begin();i!= zeroAreaFibers.end();i++)
+      retval+= (*i)->getMaterial()->setTrial(Section3d.get_strain((*i)->getLocY(),(*i)->getLocZ()), stress, tangent);
+
+    // Updating stiffness matrix and stress resultant.
+    fa.updateK3d(kr3.kData,kr3.rData);
     kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
     kr3.kData[6]= kr3.kData[2];
     kr3.kData[7]= kr3.kData[5];
@@ -2083,43 +2021,14 @@ const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection3d &Sec
 int XC::FiberPtrDeque::updateKRCenterOfMass(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
     krGJ.zero();
-    double Qy= 0.0,Qz= 0.0;
-    double Atot= 0.0;
-    double fiberArea= 0.0;
-    double yLoc= 0.0, zLoc=0.0;
-
+    FiberArrays &fa= getFiberArrays();
     // Recompute centroid
-    double stress,tangent,fs0;
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        yLoc= (*i)->getLocY();
-        zLoc= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
-        if(fiberArea!=0.0)
-          {
-            Atot+= fiberArea;
-            Qz+= -yLoc*fiberArea; //minus y coordinate.
-            Qy+= zLoc*fiberArea;
+    yCenterOfMass= fa.getCenterOfMassY();
+    zCenterOfMass= fa.getCenterOfMassZ();
 
-            tangent= (*i)->getMaterial()->getTangent();
-
-            //Updating stiffness matrix.
-            krGJ.updateKGJ(fiberArea,yLoc,zLoc,tangent);
-
-            //Updating stress resultant.
-            stress= (*i)->getMaterial()->getStress();
-            fs0= stress * fiberArea;
-            krGJ.updateNMzMy(fs0,yLoc,zLoc);
-          }
-      }
-    yCenterOfMass= -Qz; //center of mass y coordinate  XXX ¿Signo menos?
-    zCenterOfMass= Qy; //center of mass z coordinate
-    if(Atot!=0.0)
-      {
-        yCenterOfMass/= Atot;
-        zCenterOfMass/= Atot;
-      }
+    // Updating stiffness matrix and stress resultant.
+    fa.updateState();
+    fa.updateKGJ(krGJ.kData,krGJ.rData);
     krGJ.kData[4]= krGJ.kData[1]; //Stiffness matrix symmetry.
     krGJ.kData[8]= krGJ.kData[2];
     krGJ.kData[9]= krGJ.kData[6];
@@ -2148,33 +2057,19 @@ int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSectionGJ &Sectio
   }
 
 //! @brief Sets generalized trial strains values.
+//!
+//! The fibers are updated in batches of the same material class
+//! (see FiberArrays); the fibers with zero area are not updated.
 int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSectionGJ &SectionGJ,CrossSectionKR &krGJ)
   {
-    int retval= 0;
     krGJ.zero();
-    UniaxialMaterial *theMat;
-    double y,z,fiberArea,tangent,stress, fs0; 
-    std::deque<Fiber *>::iterator i= begin();
-    for(;i!= end();i++)
-      {
-        theMat= (*i)->getMaterial();
-        y= (*i)->getLocY();
-        z= (*i)->getLocZ();
-        fiberArea= (*i)->getArea();
+    FiberArrays &fa= getFiberArrays();
+    // determine material strains (def(0) + y*def(1) + z*def(2)) and set them.
+    const Vector &def= SectionGJ.getSectionDeformation();
+    const int retval= fa.setTrialStrain(def(0),def(1),def(2));
 
-        if(fiberArea!=0.0)
-          {
-            // determine material strain and set it
-            retval= theMat->setTrial(SectionGJ.get_strain(y,z), stress, tangent);
-
-            //Updating stiffness matrix.
-            krGJ.updateKGJ(fiberArea,y,z,tangent);
-
-            //Updating stress resultant.
-            fs0= stress * fiberArea;
-            krGJ.updateNMzMy(fs0,y,z);
-	  }
-      }
+    // Updating stiffness matrix and stress resultant.
+    fa.updateKGJ(krGJ.kData,krGJ.rData);
     krGJ.kData[4]= krGJ.kData[1]; //Stiffness matrix symmetry.
     krGJ.kData[8]= krGJ.kData[2];
     krGJ.kData[9]= krGJ.kData[6];
@@ -2602,6 +2497,7 @@ int XC::FiberPtrDeque::recvData(const Communicator &comm)
   {
     int res= comm.receiveDoubles(yCenterOfMass,zCenterOfMass,getDbTagData(),CommMetaData(0));
     res+= receiveDeque(*this,comm,getDbTagData(),CommMetaData(1),&FEM_ObjectBroker::getNewFiber);
+    fiberArrays.clear();
     std::clog << Color::yellow << getClassName() << "::" << __FUNCTION__
 	      << "; not fully implemented yet."
 	      << Color::def << std::endl;
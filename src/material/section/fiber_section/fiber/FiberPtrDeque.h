@@ -33,6 +33,7 @@
 #include "utility/kernel/CommandEntity.h"
 #include "utility/geom/GeomObj.h"
 #include "utility/actor/actor/MovableObject.h"
+#include "material/section/fiber_section/fiber/FiberArrays.h"
 #include <deque>
 
 class Ref3d3d;
@@ -81,9 +82,14 @@ class FiberPtrDeque: public CommandEntity, public std::deque<Fiber *>, public Mo
     mutable std::deque<std::list<Polygon2d> > dq_ac_effective; //!< (Where appropriate) effective concrete areas for each fiber.
     mutable std::deque<double> recubs; //! Cover for each fiber.
     mutable std::deque<double> seps; //! Spacing for each fiber.
+    FiberArrays fiberArrays; //!< fiber data as structure of arrays (built on demand).
 
+    FiberArrays &getFiberArrays(void);
     inline void resize(const size_t &nf)
-      { fiber_ptrs_dq::resize(nf,nullptr); }
+      {
+        fiberArrays.clear();
+        fiber_ptrs_dq::resize(nf,nullptr);
+      }
 
     inline reference operator[](const size_t &i)
       { return fiber_ptrs_dq::operator[](i); }
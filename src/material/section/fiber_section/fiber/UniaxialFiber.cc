@@ -116,7 +116,7 @@ XC::UniaxialFiber &XC::UniaxialFiber::operator=(const UniaxialFiber &other)
   {
     Fiber::operator=(other);
     area= other.area;
-    setMaterial(other.theMaterial);
+    setMaterial(other.theMaterial); // marks the fiber as modified.
     return *this;
   }
 
@@ -131,6 +131,7 @@ void XC::UniaxialFiber::setMaterial(const UniaxialMaterial *theMat)
       alloc(*theMat);
     else
       free_mem();
+    markAsModified();
   }
 
 //! @brief Sets the fiber material (identified by name).
@@ -170,5 +171,6 @@ int XC::UniaxialFiber::recvData(const Communicator &comm)
     int res= Fiber::recvData(comm);
     theMaterial= comm.getBrokedMaterial(theMaterial,getDbTagData(),BrokedPtrCommMetaData(2,3,4));
     res+= comm.receiveDouble(area,getDbTagData(),CommMetaData(5));
+    markAsModified();
     return res;
   }
@@ -34,25 +34,17 @@
 #include "utility/geom/d3/BND3d.h"
 #include "utility/geom/d1/Segment3d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <algorithm>
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
 
 
-//! @brier We classify the trihedron by its quadrant.
-void XC::InteractionDiagram::classify_trihedron(const Trihedron &tdro)
-  {
-    for(int i= 0;i<8;i++)
-      if(tdro.TocaCuadrante(i+1)) quadrant_trihedrons[i].insert(&tdro);
-  }
-
-//! @brier We classify the trihedrons by its quadrants.
+//! @brief Classify the trihedrons by the directions they cover
+//! (see TrihedronCubeMap).
 void XC::InteractionDiagram::classify_trihedrons(void)
-  {
-    //Clasificamos los trihedrons por cuadrantes.
-    for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
-      classify_trihedron(*i);
-  }
+  { trihedron_index.build(trihedrons); }
 
 //! @brief Default constructor.
 XC::InteractionDiagram::InteractionDiagram(void)
@@ -94,14 +86,8 @@ const Trihedron *XC::InteractionDiagram::findTrihedronPtr(const Pos3d &p) const
                   << std::endl;
         return retval;
       }
-    const int cuadrante= p.Cuadrante();
-    const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
-    for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
-      if((*i)->In(p,tol))
-        {
-          retval= *i;
-          break;
-        }
+    // Search the candidates for the direction of p.
+    retval= trihedron_index.findTrihedronPtr(p,tol);
     if(!retval) //Not found, so brute-force search.
       {
         for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
@@ -298,6 +284,27 @@ XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces triplets
+//! (N,My,Mz) in the rows of the matrix argument.
+//!
+//! @param m: matrix with a row for each internal forces triplet.
+//! @param numThreads: number of threads to use.
+XC::Vector XC::InteractionDiagram::getCapacityFactors(const Matrix &m, const int &numThreads) const
+  {
+    const int numRows= m.noRows();
+    Vector retval(numRows);
+    if(m.noCols()!=3)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; matrix must have three columns (N,My,Mz), it has: "
+		  << m.noCols() << std::endl;
+        return retval;
+      }
+#pragma omp parallel for schedule(dynamic,64) num_threads(std::max(numThreads,1))
+    for(int i= 0;i<numRows;i++)
+      retval[i]= getCapacityFactor(Pos3d(m(i,0),m(i,1),m(i,2)));
+    return retval;
+  }
 
 void XC::InteractionDiagram::Print(std::ostream &os) const
   {
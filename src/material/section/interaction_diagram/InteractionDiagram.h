@@ -34,12 +34,14 @@
 #include <set>
 #include <deque>
 #include "ClosedTriangleMesh.h"
+#include "TrihedronCubeMap.h"
 
 class Triang3dMesh;
 
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -49,12 +51,8 @@ class InteractionDiagramData;
 class InteractionDiagram: public ClosedTriangleMesh
   {
   protected:
-    typedef std::set<const Trihedron *> set_ptr_trihedrons;
+    TrihedronCubeMap trihedron_index; //!< trihedrons classified by direction.
 
-    
-    set_ptr_trihedrons quadrant_trihedrons[8];
-
-    void classify_trihedron(const Trihedron &tdro);
     void classify_trihedrons(void);
     void setPositionsMatrix(const Matrix &);
     GeomObj::list_Pos3d get_intersection(const Pos3d &p) const;
@@ -69,6 +67,7 @@ class InteractionDiagram: public ClosedTriangleMesh
     Pos3d getIntersection(const Pos3d &) const;
     double getCapacityFactor(const Pos3d &) const;
     Vector getCapacityFactor(const GeomObj::list_Pos3d &) const;
+    Vector getCapacityFactors(const Matrix &, const int &numThreads= 1) const;
 
     void Print(std::ostream &os) const;
   };
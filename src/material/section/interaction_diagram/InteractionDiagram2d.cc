@@ -29,6 +29,8 @@
 #include "InteractionDiagram2d.h"
 #include "utility/geom/d1/Segment2d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <algorithm>
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
@@ -55,16 +57,115 @@ XC::InteractionDiagram2d::InteractionDiagram2d(void)
 
 XC::InteractionDiagram2d::InteractionDiagram2d(const Polygon2d &pts)
   : Polygon2d(pts) //sort_points(pts))
-  { }
+  { build_angular_index(); }
 
 //! @brief Virtual constructor.
 XC::InteractionDiagram2d *XC::InteractionDiagram2d::getCopy(void) const
   { return new InteractionDiagram2d(*this); }
 
+//! @brief Classify the edges of the diagram by the angular sectors
+//! (around the origin) they cover, so the edge intersected by a
+//! half-line from the origin is searched among a few candidates.
+//!
+//! The index is used only if the origin is inside the diagram; the
+//! vertices are stored anyway so the index can be checked against
+//! the current vertices of the diagram (see angular_index_outdated).
+void XC::InteractionDiagram2d::build_angular_index(void) const
+  {
+    index_vertices.clear();
+    angular_bins.clear();
+    const size_t numVertices= getNumVertices();
+    index_vertices.reserve(numVertices);
+    for(size_t i= 0;i<numVertices;i++)
+      index_vertices.push_back(Vertice0(i));
+    const Pos2d O= Pos2d(0.0,0.0);
+    if((numVertices<3) || !In(O))
+      return;
+    if(std::find(index_vertices.begin(),index_vertices.end(),O)!=index_vertices.end())
+      return;
+    const size_t numBins= std::max(size_t(16),2*numVertices);
+    angular_bins.resize(numBins);
+    const double twoPi= 2.0*M_PI;
+    for(size_t i= 0;i<numVertices;i++)
+      {
+        const double a1= ::angle(index_vertices[i]);
+        const double a2= ::angle(index_vertices[(i+1)%numVertices]);
+        double delta= a2-a1; // angle subtended by the edge.
+        if(delta>M_PI) delta-= twoPi;
+        else if(delta<=-M_PI) delta+= twoPi;
+        const double start= (delta>=0.0) ? a1 : a2;
+        const int first= int(floor((start+M_PI)/twoPi*numBins))-1;
+        const int last= int(floor((start+fabs(delta)+M_PI)/twoPi*numBins))+1;
+        for(int j= first;j<=last;j++)
+          angular_bins[(j+numBins)%numBins].push_back(i);
+      }
+  }
+
+//! @brief Return true if the vertices of the diagram have changed
+//! (i.e. by means of the Polygon2d modifiers) since the angular
+//! index was built.
+bool XC::InteractionDiagram2d::angular_index_outdated(void) const
+  {
+    const size_t numVertices= getNumVertices();
+    if(numVertices!=index_vertices.size())
+      return true;
+    for(size_t i= 0;i<numVertices;i++)
+      if(Vertice0(i)!=index_vertices[i])
+        return true;
+    return false;
+  }
+
+//! @brief Rebuild the angular index if the vertices of the diagram
+//! have changed. It must be called before any query, out of the
+//! parallel regions (the workers only read the index).
+void XC::InteractionDiagram2d::update_angular_index(void) const
+  {
+    if(angular_index_outdated())
+      build_angular_index();
+  }
+
+//! @brief Search for the intersection of the half-line from the origin
+//! through p with the diagram using the angular index. Return false
+//! if the index is not available or the intersection is not found.
+bool XC::InteractionDiagram2d::find_intersection(const Pos2d &p, Pos2d &C) const
+  {
+    const size_t numVertices= index_vertices.size();
+    if(angular_bins.empty())
+      return false;
+    const double dx= p.x(), dy= p.y();
+    const size_t numBins= angular_bins.size();
+    const size_t bin= std::min(numBins-1,size_t(std::max(0.0,(::angle(p)+M_PI)/(2.0*M_PI)*numBins)));
+    const std::vector<size_t> &candidates= angular_bins[bin];
+    double tMin= -1.0;
+    for(std::vector<size_t>::const_iterator i= candidates.begin();i!=candidates.end();i++)
+      {
+        const Pos2d &A= index_vertices[*i];
+        const Pos2d &B= index_vertices[(*i+1)%numVertices];
+        const double ex= B.x()-A.x(), ey= B.y()-A.y();
+        const double denom= dx*ey-dy*ex;
+        if(denom==0.0) // parallel.
+          continue;
+        const double t= (A.x()*ey-A.y()*ex)/denom;
+        const double s= (A.x()*dy-A.y()*dx)/denom;
+        if((t>0.0) && (s>=-1e-9) && (s<=1.0+1e-9))
+          if((tMin<0.0) || (t<tMin))
+            tMin= t;
+      }
+    if(tMin>0.0)
+      {
+        C= Pos2d(tMin*dx,tMin*dy);
+        return true;
+      }
+    return false;
+  }
+
 //! @brief Return the intersection of the half-line that links
 //! the origin (0,0,0) with p an the interaction diagram.
 Pos2d XC::InteractionDiagram2d::get_intersection(const Pos2d &p) const
   {
+    Pos2d retval;
+    if(find_intersection(p, retval))
+      return retval;
     const Pos2d O= Pos2d(0.0,0.0);
     //Search for the trihedron that contains p.
     Ray2d Op(O,p);
@@ -96,15 +197,20 @@ void XC::InteractionDiagram2d::Simplify(void)
     push_back(p2);
     push_back(p3);
     push_back(p4);
+    build_angular_index();
   }
 
 //! @brief Returns the intersection of the ray O->esf_d with the
 //! interaction diagram.
 Pos2d XC::InteractionDiagram2d::getIntersection(const Pos2d &esf_d) const
-  { return get_intersection(esf_d); }
+  {
+    update_angular_index();
+    return get_intersection(esf_d);
+  }
 
-//! @brief Returns the capacity factor for the internal forces triplet being passed as parameters.
-double XC::InteractionDiagram2d::getCapacityFactor(const Pos2d &esf_d) const
+//! @brief Returns the capacity factor for the internal forces triplet
+//! being passed as parameters (the angular index must be up to date).
+double XC::InteractionDiagram2d::get_capacity_factor(const Pos2d &esf_d) const
   {
     double retval= 1e6;
     static const Pos2d O= Pos2d(0.0,0.0);
@@ -120,15 +226,45 @@ double XC::InteractionDiagram2d::getCapacityFactor(const Pos2d &esf_d) const
     return retval;
   }
 
+//! @brief Returns the capacity factor for the internal forces triplet being passed as parameters.
+double XC::InteractionDiagram2d::getCapacityFactor(const Pos2d &esf_d) const
+  {
+    update_angular_index();
+    return get_capacity_factor(esf_d);
+  }
+
 XC::Vector XC::InteractionDiagram2d::getCapacityFactor(const GeomObj::list_Pos2d &lp) const
   {
+    update_angular_index();
     Vector retval(lp.size());
     int i= 0;
     for(GeomObj::list_Pos2d::const_iterator j= lp.begin();j!=lp.end(); j++, i++)
-      retval[i]= getCapacityFactor(*j);
+      retval[i]= get_capacity_factor(*j);
     return retval;
   }
 
+//! @brief Return the capacity factors for the internal forces pairs
+//! (N,M) in the rows of the matrix argument.
+//!
+//! @param m: matrix with a row for each internal forces pair.
+//! @param numThreads: number of threads to use.
+XC::Vector XC::InteractionDiagram2d::getCapacityFactors(const Matrix &m, const int &numThreads) const
+  {
+    const int numRows= m.noRows();
+    Vector retval(numRows);
+    if(m.noCols()!=2)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; matrix must have two columns (N,M), it has: "
+		  << m.noCols() << std::endl;
+        return retval;
+      }
+    update_angular_index();
+#pragma omp parallel for schedule(dynamic,64) num_threads(std::max(numThreads,1))
+    for(int i= 0;i<numRows;i++)
+      retval[i]= get_capacity_factor(Pos2d(m(i,0),m(i,1)));
+    return retval;
+  }
 
 void XC::InteractionDiagram2d::Print(std::ostream &os) const
   {
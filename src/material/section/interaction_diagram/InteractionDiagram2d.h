@@ -35,6 +35,7 @@
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -45,7 +46,15 @@ class InteractionDiagramData;
 class InteractionDiagram2d: public Polygon2d
   {
   protected:
+    mutable std::vector<Pos2d> index_vertices; //!< vertices of the diagram when the angular index was built.
+    mutable std::vector<std::vector<size_t> > angular_bins; //!< edges that may intersect the half-lines of each angular sector.
+
+    void build_angular_index(void) const;
+    bool angular_index_outdated(void) const;
+    void update_angular_index(void) const;
+    bool find_intersection(const Pos2d &p, Pos2d &) const;
     Pos2d get_intersection(const Pos2d &p) const;
+    double get_capacity_factor(const Pos2d &esf_d) const;
   public:
     InteractionDiagram2d(void);
     InteractionDiagram2d(const Polygon2d &);
@@ -55,6 +64,7 @@ class InteractionDiagram2d: public Polygon2d
     Pos2d getIntersection(const Pos2d &) const;
     double getCapacityFactor(const Pos2d &esf_d) const;
     Vector getCapacityFactor(const GeomObj::list_Pos2d &lp) const;
+    Vector getCapacityFactors(const Matrix &, const int &numThreads= 1) const;
 
     void Print(std::ostream &os) const;
   };
@@ -0,0 +1,206 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronCubeMap.cc
+
+#include "TrihedronCubeMap.h"
+#include "utility/geom/d2/Trihedron.h"
+#include <cmath>
+#include <algorithm>
+
+namespace {
+//! @brief Normalize the vector argument; return its norm.
+inline double normalize(double *v)
+  {
+    const double n= sqrt(v[0]*v[0]+v[1]*v[1]+v[2]*v[2]);
+    if(n>0.0)
+      { v[0]/= n; v[1]/= n; v[2]/= n; }
+    return n;
+  }
+
+inline double dot(const double *a, const double *b)
+  { return a[0]*b[0]+a[1]*b[1]+a[2]*b[2]; }
+
+//! @brief Spherical cap (unit center and cosine and sine of its
+//! angular radius).
+struct Cap
+  {
+    double c[3];
+    double cosR;
+    double sinR;
+
+    //! @brief Compute the smallest cap centered in the normalized
+    //! sum of the directions that contains all of them.
+    Cap(const double dirs[][3], const size_t &n, const double &padding)
+      {
+        c[0]= c[1]= c[2]= 0.0;
+        for(size_t i= 0;i<n;i++)
+          for(size_t j= 0;j<3;j++)
+            c[j]+= dirs[i][j];
+        normalize(c);
+        double minCos= 1.0;
+        for(size_t i= 0;i<n;i++)
+          minCos= std::min(minCos, dot(c, dirs[i]));
+        const double r= acos(std::max(-1.0,std::min(1.0,minCos)))+padding;
+        cosR= cos(r);
+        sinR= sin(r);
+      }
+    //! @brief Return true if the cap covers less than a hemisphere.
+    bool small(void) const
+      { return (cosR>0.0); }
+    //! @brief Return true if both caps can intersect.
+    bool intersects(const Cap &other) const
+      {
+        // cos(r1+r2)= cos(r1)*cos(r2)-sin(r1)*sin(r2)
+        const double cosSum= cosR*other.cosR-sinR*other.sinR;
+        return (dot(c,other.c)>=cosSum);
+      }
+  };
+} // end of anonymous namespace
+
+//! @brief Default constructor.
+XC::TrihedronCubeMap::TrihedronCubeMap(void)
+  : numDiv(0)
+  { org[0]= org[1]= org[2]= 0.0; }
+
+//! @brief Remove all the trihedrons from the index.
+void XC::TrihedronCubeMap::clear(void)
+  {
+    numDiv= 0;
+    cells.clear();
+    others.clear();
+  }
+
+//! @brief Return the index of the cell that contains the direction
+//! argument (not necessarily unit).
+size_t XC::TrihedronCubeMap::get_cell_index(const double *d) const
+  {
+    // major axis.
+    size_t axis= 0;
+    if(fabs(d[1])>fabs(d[axis])) axis= 1;
+    if(fabs(d[2])>fabs(d[axis])) axis= 2;
+    const size_t face= 2*axis+((d[axis]<0.0) ? 1 : 0);
+    const double a= fabs(d[axis]);
+    const double u= d[(axis+1)%3]/a; // in [-1,1]
+    const double v= d[(axis+2)%3]/a; // in [-1,1]
+    const size_t iu= std::min(numDiv-1, size_t(std::max(0.0,(u+1.0)*0.5*numDiv)));
+    const size_t iv= std::min(numDiv-1, size_t(std::max(0.0,(v+1.0)*0.5*numDiv)));
+    return (face*numDiv+iu)*numDiv+iv;
+  }
+
+//! @brief Return the unit direction that corresponds to the
+//! coordinates (u,v) in [0,numDiv] of the face argument.
+void XC::TrihedronCubeMap::get_cell_direction(const size_t &face, const double &u, const double &v, double *d) const
+  {
+    const size_t axis= face/2;
+    d[axis]= (face%2) ? -1.0 : 1.0;
+    d[(axis+1)%3]= 2.0*u/numDiv-1.0;
+    d[(axis+2)%3]= 2.0*v/numDiv-1.0;
+    normalize(d);
+  }
+
+//! @brief Build the index for the trihedrons argument. The pointers
+//! stored in the index are valid as long as the vector is not
+//! modified.
+void XC::TrihedronCubeMap::build(const std::vector<Trihedron> &trihedrons)
+  {
+    clear();
+    if(trihedrons.empty())
+      return;
+    const Pos3d &cusp= trihedrons.front().Cuspide();
+    org[0]= cusp.x(); org[1]= cusp.y(); org[2]= cusp.z();
+    // about one trihedron per cell.
+    const size_t n= trihedrons.size();
+    numDiv= std::max(size_t(4),std::min(size_t(64),size_t(ceil(sqrt(n/6.0)))));
+    cells.resize(6*numDiv*numDiv);
+    // bounding caps of the cells.
+    std::vector<Cap> cellCaps;
+    cellCaps.reserve(cells.size());
+    for(size_t face= 0;face<6;face++)
+      for(size_t iu= 0;iu<numDiv;iu++)
+        for(size_t iv= 0;iv<numDiv;iv++)
+          {
+            double corners[4][3];
+            get_cell_direction(face, iu, iv, corners[0]);
+            get_cell_direction(face, iu+1, iv, corners[1]);
+            get_cell_direction(face, iu+1, iv+1, corners[2]);
+            get_cell_direction(face, iu, iv+1, corners[3]);
+            cellCaps.push_back(Cap(corners, 4, 0.0));
+          }
+    // bounding caps of the trihedrons.
+    const double padding= 1e-3; // to take into account the tolerance of Trihedron::In.
+    for(std::vector<Trihedron>::const_iterator i= trihedrons.begin();i!=trihedrons.end();i++)
+      {
+        const Trihedron &t= *i;
+        const Pos3d &p0= t.Cuspide();
+        bool sameCusp= (p0.x()==org[0]) && (p0.y()==org[1]) && (p0.z()==org[2]);
+        double dirs[3][3];
+        for(size_t j= 0;j<3;j++)
+          {
+            const Pos3d v= t.Vertice(j+1);
+            dirs[j][0]= v.x()-org[0];
+            dirs[j][1]= v.y()-org[1];
+            dirs[j][2]= v.z()-org[2];
+            if(normalize(dirs[j])==0.0)
+              sameCusp= false;
+          }
+        const Cap cap(dirs, 3, padding);
+        if(!sameCusp || !cap.small())
+          others.push_back(&t); // can't be classified.
+        else
+          for(size_t k= 0;k<cells.size();k++)
+            if(cap.intersects(cellCaps[k]))
+              cells[k].push_back(&t);
+      }
+  }
+
+//! @brief Search for the trihedron that contains the point argument
+//! among the candidates of its cell. Return nullptr if not found.
+//!
+//! @param p: point to search for.
+//! @param tol: tolerance for Trihedron::In.
+const Trihedron *XC::TrihedronCubeMap::findTrihedronPtr(const Pos3d &p, const double &tol) const
+  {
+    const Trihedron *retval= nullptr;
+    if(!cells.empty())
+      {
+        const double d[3]= {p.x()-org[0], p.y()-org[1], p.z()-org[2]};
+        if((d[0]!=0.0) || (d[1]!=0.0) || (d[2]!=0.0))
+          {
+            const trihedron_ptrs &candidates= cells[get_cell_index(d)];
+            for(trihedron_ptrs::const_iterator i= candidates.begin();i!=candidates.end();i++)
+              if((*i)->In(p,tol))
+                return *i;
+          }
+      }
+    for(trihedron_ptrs::const_iterator i= others.begin();i!=others.end();i++)
+      if((*i)->In(p,tol))
+        {
+          retval= *i;
+          break;
+        }
+    return retval;
+  }
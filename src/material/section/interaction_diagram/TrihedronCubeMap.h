@@ -0,0 +1,74 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronCubeMap.h
+
+#ifndef TRIHEDRONCUBEMAP_H
+#define TRIHEDRONCUBEMAP_H
+
+#include <vector>
+#include <cstddef>
+
+class Trihedron;
+class Pos3d;
+
+namespace XC {
+
+//! @ingroup MATSCCDiagInt
+//
+//! @brief Index of the trihedrons of a closed triangle mesh by
+//! the direction of the half-lines that start in its (common) cusp.
+//!
+//! The directions are classified using a cube map: each face of a
+//! cube centered in the cusp is divided in numDiv x numDiv cells
+//! and each cell stores the trihedrons whose solid angle may
+//! intersect the cell. This way the trihedron that contains a point
+//! is searched only among a few candidates.
+class TrihedronCubeMap
+  {
+  public:
+    typedef std::vector<const Trihedron *> trihedron_ptrs;
+  private:
+    double org[3]; //!< common cusp of the trihedrons.
+    size_t numDiv; //!< number of divisions of each edge of the cube.
+    std::vector<trihedron_ptrs> cells; //!< trihedrons that intersect each cell.
+    trihedron_ptrs others; //!< trihedrons that must be checked for any direction.
+
+    size_t get_cell_index(const double *) const;
+    void get_cell_direction(const size_t &, const double &, const double &, double *) const;
+  public:
+    TrihedronCubeMap(void);
+    void clear(void);
+    void build(const std::vector<Trihedron> &);
+    inline bool empty(void) const
+      { return cells.empty() && others.empty(); }
+    const Trihedron *findTrihedronPtr(const Pos3d &, const double &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -61,6 +61,7 @@
 // What: "@(#) ElasticMaterial.C, revA"
 
 #include <material/uniaxial/ElasticMaterial.h>
+#include <typeinfo>
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/Information.h"
@@ -104,6 +105,27 @@ int XC::ElasticMaterial::setTrial(double strain, double &stress, double &tangent
     return 0;
   }
 
+//! @brief Batch kernel: set the trial strain of each of the materials
+//! of the array (all of them of class ElasticMaterial) and return their
+//! stresses and tangents.
+//!
+//! The strain rate is set to zero (as in the fiber section loops).
+int XC::ElasticMaterial::setTrialBatch(const size_t &n, UniaxialMaterial *const *materials, const double *strains, double *stresses, double *tangents) const
+  {
+    // derived classes may redefine the state determination.
+    if(typeid(*this)!=typeid(ElasticMaterial))
+      return ElasticBaseMaterial::setTrialBatch(n, materials, strains, stresses, tangents);
+    for(size_t i= 0;i<n;i++)
+      {
+        ElasticMaterial *m= static_cast<ElasticMaterial *>(materials[i]);
+        m->trialStrain= strains[i];
+        m->trialStrainRate= 0.0;
+        stresses[i]= m->E*m->ElasticBaseMaterial::get_total_strain();
+        tangents[i]= m->E;
+      }
+    return 0;
+  }
+
 //! @brief Returns the product of \f$E * \epsilon\f$, where \f$\epsilon\f$ is
 //! the current trial strain.
 double XC::ElasticMaterial::getStress(void) const
@@ -92,6 +92,28 @@ int XC::UniaxialMaterial::setTrial(double strain, double &stress, double &tangen
     return res;
   }
 
+//! @brief Batch kernel: set the trial strain of each of the materials
+//! of the array and return their stresses and tangents.
+//!
+//! All the materials of the array must be of the same class than this
+//! object, so the derived classes can update them in a single loop
+//! without virtual calls (see FiberArrays). This default
+//! implementation calls setTrial on each material.
+//!
+//! @param n: number of materials.
+//! @param materials: materials to update.
+//! @param strains: trial strains (one for each material).
+//! @param stresses: resulting stresses (one for each material).
+//! @param tangents: resulting tangents (one for each material).
+//! @return sum of the values returned by setTrial.
+int XC::UniaxialMaterial::setTrialBatch(const size_t &n, UniaxialMaterial *const *materials, const double *strains, double *stresses, double *tangents) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      retval+= materials[i]->setTrial(strains[i], stresses[i], tangents[i]);
+    return retval;
+  }
+
 //! @brief Return the initial strain.
 double XC::UniaxialMaterial::getInitialStrain(void) const
   { return 0.0; }
@@ -62,6 +62,7 @@
 
 
 #include <material/uniaxial/concrete/Concrete01.h>
+#include <typeinfo>
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 
@@ -237,6 +238,26 @@ int XC::Concrete01::setTrial(double strain, double &stress, double &tangent, dou
     return 0;
   }
 
+//! @brief Batch kernel: set the trial strain of each of the materials
+//! of the array (all of them of class Concrete01) and return their
+//! stresses and tangents.
+//!
+//! The loop calls the non-virtual version of the state determination
+//! of each material.
+int XC::Concrete01::setTrialBatch(const size_t &n, UniaxialMaterial *const *materials, const double *strains, double *stresses, double *tangents) const
+  {
+    // derived classes may redefine the state determination.
+    if(typeid(*this)!=typeid(Concrete01))
+      return ConcreteBase::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Concrete01 *m= static_cast<Concrete01 *>(materials[i]);
+        retval+= m->Concrete01::setTrial(strains[i], stresses[i], tangents[i]);
+      }
+    return retval;
+  }
+
 //! @brief ??
 void XC::Concrete01::determineTrialState(double dStrain)
   {
@@ -63,6 +63,7 @@
 
 
 #include <material/uniaxial/concrete/Concrete02.h>
+#include <typeinfo>
 #include <cfloat>
 
 void XC::Concrete02::setup_parameters(void)
@@ -253,6 +254,28 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
     return 0;
   }
 
+//! @brief Batch kernel: set the trial strain of each of the materials
+//! of the array (all of them of class Concrete02) and return their
+//! stresses and tangents.
+//!
+//! The loop calls the non-virtual version of the state determination
+//! of each material.
+int XC::Concrete02::setTrialBatch(const size_t &n, UniaxialMaterial *const *materials, const double *strains, double *stresses, double *tangents) const
+  {
+    // derived classes may redefine the state determination.
+    if(typeid(*this)!=typeid(Concrete02))
+      return RawConcrete::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Concrete02 *m= static_cast<Concrete02 *>(materials[i]);
+        retval+= m->Concrete02::setTrialStrain(strains[i]);
+        stresses[i]= m->hstv.getStress();
+        tangents[i]= m->hstv.getTangent();
+      }
+    return retval;
+  }
+
 
 
 //! @brief Commit the state of the material.
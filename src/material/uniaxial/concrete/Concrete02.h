@@ -166,6 +166,7 @@ class Concrete02: public RawConcrete
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(const size_t &, UniaxialMaterial *const *, const double *, double *, double *) const;
     inline double getStrain(void) const
       { return hstv.getStrain(); }
     inline double getStress(void) const
@@ -0,0 +1,235 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KelvinChainCreep.cc
+
+#include "KelvinChainCreep.h"
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+
+namespace {
+//! @brief Least squares projection matrix (numTerms x numSamples)
+//! that computes the amplitudes of the series from the values of
+//! the creep function in the sample points.
+//!
+//! The basis functions 1-exp(-x_j/theta_k) don't depend on the
+//! loading age, so the (regularized) normal equations are factorized
+//! only once.
+struct Projection
+  {
+    typedef XC::KelvinChainCreep KCC;
+    double p[KCC::numTerms][KCC::numSamples];
+
+    Projection(void)
+      {
+        const size_t n= KCC::numTerms;
+        const size_t m= KCC::numSamples;
+        double b[m][n]; // basis functions in the sample points.
+        for(size_t j= 0;j<m;j++)
+          for(size_t k= 0;k<n;k++)
+            b[j][k]= 1.0-exp(-KCC::getSampleTime(j)/KCC::getRetardationTime(k));
+        // Normal equations.
+        double a[n][n];
+        double trace= 0.0;
+        for(size_t k= 0;k<n;k++)
+          for(size_t l= 0;l<n;l++)
+            {
+              double s= 0.0;
+              for(size_t j= 0;j<m;j++)
+                s+= b[j][k]*b[j][l];
+              a[k][l]= s;
+              if(k==l)
+                trace+= s;
+            }
+        // Tikhonov regularization (the terms with large retardation
+        // times are almost linear in the fitting interval).
+        const double lambda= 1e-8*trace;
+        for(size_t k= 0;k<n;k++)
+          a[k][k]+= lambda;
+        // Cholesky factorization (a= L*L^T, L stored in a).
+        for(size_t k= 0;k<n;k++)
+          {
+            for(size_t l= 0;l<k;l++)
+              a[k][k]-= a[k][l]*a[k][l];
+            a[k][k]= sqrt(a[k][k]);
+            for(size_t i= k+1;i<n;i++)
+              {
+                for(size_t l= 0;l<k;l++)
+                  a[i][k]-= a[i][l]*a[k][l];
+                a[i][k]/= a[k][k];
+              }
+          }
+        // p= (B^T*B+lambda*I)^-1*B^T, column by column.
+        for(size_t j= 0;j<m;j++)
+          {
+            double y[n];
+            for(size_t k= 0;k<n;k++)
+              {
+                y[k]= b[j][k];
+                for(size_t l= 0;l<k;l++)
+                  y[k]-= a[k][l]*y[l];
+                y[k]/= a[k][k];
+              }
+            for(size_t k= n;k-- > 0;)
+              {
+                for(size_t l= k+1;l<n;l++)
+                  y[k]-= a[l][k]*y[l];
+                y[k]/= a[k][k];
+              }
+            for(size_t k= 0;k<n;k++)
+              p[k][j]= y[k];
+          }
+      }
+  };
+} // end of anonymous namespace
+
+//! @brief Constructor.
+XC::KelvinChainCreep::KelvinChainCreep(void)
+  { reset(); }
+
+//! @brief Reset the stress history.
+void XC::KelvinChainCreep::reset(void)
+  {
+    sumAmp.fill(0.0);
+    decayed.fill(0.0);
+    tLast= 0.0;
+  }
+
+//! @brief Return the retardation times of the series: two per
+//! decade from 0.01 to 10^5 days.
+const XC::KelvinChainCreep::term_array &XC::KelvinChainCreep::getRetardationTimes(void)
+  {
+    static const term_array retval= [](){
+        term_array tmp;
+        for(size_t k= 0;k<numTerms;k++)
+          tmp[k]= 0.01*pow(10.0,0.5*k);
+        return tmp;
+      }();
+    return retval;
+  }
+
+//! @brief Return the load durations used to fit the series: four
+//! per decade from 0.01 to 10^5 days.
+const XC::KelvinChainCreep::sample_array &XC::KelvinChainCreep::getSampleTimes(void)
+  {
+    static const sample_array retval= [](){
+        sample_array tmp;
+        for(size_t j= 0;j<numSamples;j++)
+          tmp[j]= pow(10.0,-2.0+0.25*j);
+        return tmp;
+      }();
+    return retval;
+  }
+
+//! @brief Return the k-th retardation time.
+double XC::KelvinChainCreep::getRetardationTime(const size_t &k)
+  { return getRetardationTimes()[k]; }
+
+//! @brief Return the j-th load duration used to fit the series.
+double XC::KelvinChainCreep::getSampleTime(const size_t &j)
+  { return getSampleTimes()[j]; }
+
+//! @brief Compute the amplitudes of the series that fit the
+//! values of the creep function in the sample points.
+//!
+//! @param values: values of the creep function phi(tau+x_j, tau).
+//! @param amplitudes: amplitudes of the series (output).
+void XC::KelvinChainCreep::fit(const sample_array &values, term_array &amplitudes)
+  {
+    static const Projection projection;
+    for(size_t k= 0;k<numTerms;k++)
+      {
+        double s= 0.0;
+        for(size_t j= 0;j<numSamples;j++)
+          s+= projection.p[k][j]*values[j];
+        amplitudes[k]= s;
+      }
+  }
+
+//! @brief Return the time of the last stress increment.
+double XC::KelvinChainCreep::getLastTime(void) const
+  { return tLast; }
+
+//! @brief Return the internal variables of the chain (sums of the
+//! amplitudes, decayed amplitudes and time of the last increment).
+std::vector<double> XC::KelvinChainCreep::getState(void) const
+  {
+    std::vector<double> retval(2*numTerms+1);
+    std::copy(sumAmp.begin(), sumAmp.end(), retval.begin());
+    std::copy(decayed.begin(), decayed.end(), retval.begin()+numTerms);
+    retval[2*numTerms]= tLast;
+    return retval;
+  }
+
+//! @brief Set the internal variables of the chain (see getState).
+void XC::KelvinChainCreep::setState(const std::vector<double> &v)
+  {
+    if(v.size()==2*numTerms+1)
+      {
+        std::copy(v.begin(), v.begin()+numTerms, sumAmp.begin());
+        std::copy(v.begin()+numTerms, v.begin()+2*numTerms, decayed.begin());
+        tLast= v[2*numTerms];
+      }
+    else
+      {
+        std::cerr << "KelvinChainCreep::" << __FUNCTION__
+                  << "; wrong number of values: " << v.size()
+                  << " (" << 2*numTerms+1 << " expected)."
+                  << std::endl;
+        reset();
+      }
+  }
+
+//! @brief Add the stress increment committed at the time tau.
+//!
+//! @param dsig: stress increment.
+//! @param tau: time of the stress increment (loading age).
+//! @param amplitudes: amplitudes of the series for the loading age tau.
+void XC::KelvinChainCreep::addStressIncrement(const double &dsig, const double &tau, const term_array &amplitudes)
+  {
+    const double dt= tau-tLast;
+    for(size_t k= 0;k<numTerms;k++)
+      {
+        const double inc= dsig*amplitudes[k];
+        decayed[k]= decayed[k]*exp(-dt/getRetardationTime(k))+inc;
+        sumAmp[k]+= inc;
+      }
+    tLast= tau;
+  }
+
+//! @brief Return the creep strain at time t.
+//!
+//! @param t: current time.
+//! @param E: modulus used to normalize the creep coefficient.
+double XC::KelvinChainCreep::getCreepStrain(const double &t, const double &E) const
+  {
+    const double dt= t-tLast;
+    double retval= 0.0;
+    for(size_t k= 0;k<numTerms;k++)
+      retval+= sumAmp[k]-decayed[k]*exp(-dt/getRetardationTime(k));
+    return retval/E;
+  }
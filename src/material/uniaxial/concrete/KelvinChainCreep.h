@@ -0,0 +1,113 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KelvinChainCreep.h
+
+#ifndef KelvinChainCreep_h
+#define KelvinChainCreep_h
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace XC {
+
+//! @ingroup MatUnx
+//
+//! @brief Creep strain history of a time-dependent concrete stored
+//! as the internal variables of a Kelvin chain.
+//!
+//! The creep coefficient for a load applied at time tau is
+//! approximated by a Dirichlet (exponential) series with fixed
+//! retardation times:
+//! \f[ \phi(t,\tau) \approx \sum_k a_k(\tau) (1-e^{-(t-\tau)/\theta_k}) \f]
+//! where the amplitudes a_k(tau) are fitted (least squares) to the
+//! creep function of the material when the stress increment is
+//! committed. Since the retardation times do not depend on tau, the
+//! creep strain of the whole stress history:
+//! \f[ \epsilon_{cr}(t)= \frac{1}{E}\sum_i \Delta\sigma_i \phi(t,\tau_i) \f]
+//! can be obtained from two sums per term of the series that are
+//! updated recursively. Memory and time per step don't depend on the
+//! number of steps of the analysis (see Bazant, Z.P. and Wu, S.T.
+//! "Dirichlet series creep function for aging concrete". Journal of
+//! the Engineering Mechanics Division, 1973).
+class KelvinChainCreep
+  {
+  public:
+    static const size_t numTerms= 15; //!< number of terms of the series.
+    static const size_t numSamples= 29; //!< number of fitting points.
+    typedef std::array<double, numTerms> term_array;
+    typedef std::array<double, numSamples> sample_array;
+  private:
+    term_array sumAmp; //!< sum of the amplitudes: sum(dsig_i*a_k(tau_i)).
+    term_array decayed; //!< decayed amplitudes: sum(dsig_i*a_k(tau_i)*exp(-(tLast-tau_i)/theta_k)).
+    double tLast; //!< time of the last stress increment.
+
+    static const term_array &getRetardationTimes(void);
+    static const sample_array &getSampleTimes(void);
+    static void fit(const sample_array &, term_array &);
+  public:
+    KelvinChainCreep(void);
+    void reset(void);
+
+    double getLastTime(void) const;
+    std::vector<double> getState(void) const;
+    void setState(const std::vector<double> &);
+    double getCreepStrain(const double &, const double &) const;
+
+    template <class CreepFunction>
+    void addStressIncrement(const double &, const double &, const CreepFunction &);
+    void addStressIncrement(const double &, const double &, const term_array &);
+
+    static double getRetardationTime(const size_t &);
+    static double getSampleTime(const size_t &);
+  };
+
+//! @brief Add the stress increment committed at the time tau.
+//!
+//! @param dsig: stress increment.
+//! @param tau: time of the stress increment (loading age).
+//! @param phi: creep function phi(t,tau) of the material.
+template <class CreepFunction>
+void KelvinChainCreep::addStressIncrement(const double &dsig, const double &tau, const CreepFunction &phi)
+  {
+    term_array amplitudes;
+    if(dsig!=0.0)
+      {
+        sample_array values;
+        for(size_t j= 0;j<numSamples;j++)
+          values[j]= phi(tau+getSampleTime(j), tau);
+        fit(values, amplitudes);
+      }
+    else
+      amplitudes.fill(0.0);
+    addStressIncrement(dsig, tau, amplitudes);
+  }
+
+} // end of XC namespace
+
+#endif
@@ -151,6 +151,11 @@ XC::UniaxialMaterial *XC::TDConcrete::getCopy(void) const
 
 double XC::TDConcrete::setCreepStrain(double time, double stress)
   {
+    if(exponentialCreep)
+      {
+        phi_i= setPhi(time, creepChain.getLastTime());
+        return creepChain.getCreepStrain(time, Ec);
+      }
     double creep;
     double runSum = 0.0;
     
@@ -230,7 +235,7 @@ int XC::TDConcrete::setTrialStrain(double trialStrain, double strainRate)
             // Calculate creep and mechanical strain, assuming stress remains constant in a time step:
             if(creepControl == 1)
 	      {
-                if(fabs(t-TIME_i[count]) <= 0.0001)
+                if(fabs(t-getLastCommitTime()) <= 0.0001)
 		  { //If t = t(i-1), use creep/shrinkage from last calculated time step
                     eps_cr = epsP_cr;
                     eps_sh = epsP_sh;
@@ -379,6 +384,16 @@ void XC::TDConcrete::setCreepDParameter(const double &d)
 double XC::TDConcrete::getCreepDParameter(void) const
   { return epscrd; }
 
+//! @brief Return the number of values stored to compute the
+//! creep strain.
+size_t XC::TDConcrete::getHistorySize(void) const
+  {
+    size_t retval= TDConcreteBase::getHistorySize()+PHI_i.size();
+    if(exponentialCreep)
+      retval+= 2*KelvinChainCreep::numTerms+1;
+    return retval;
+  }
+
 int XC::TDConcrete::commitState(void)
   {
     iter = 0;
@@ -386,33 +401,41 @@ int XC::TDConcrete::commitState(void)
     ecmaxP = ecmax;
     deptP = dept;
 
-    dsig_i[count]=sig-sigP;
-    /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
-    //if(crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
-    //        if(sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
-    //                DSIG_i[count+1] = sig;
-    //        }
-    //        if(sig > 0) {// Concrete should not creep when crack is opened
-    //                DSIG_i[count+1] = 0.0;
-    //        }
-    //        if(sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
-    //                DSIG_i[count+1] = sig-sigP;
-    //        }
-    //} else { //concrete is uncracked, DSIG = sig - sigP
-    //        DSIG_i[count+1] = sig-sigP;
-    //}
-    DSIG_i[count+1] = sig-sigP;
-
-    //Secant Stiffness for determination of creep strain:
-    if(fabs(eps_m/sig)>Ec)
-      { E_i[count+1] = Ec; }
+    if(exponentialCreep)
+      {
+        tLastCommit= getCurrentTime();
+        creepChain.addStressIncrement(sig-sigP, tLastCommit, [this](double time, double tp) { return setPhi(time, tp); });
+      }
     else
-      { E_i[count+1] = fabs(sig/eps_m); } //ADDED 7/22
-
-    if(isnan(E_i[count+1]))
-      { E_i[count+1] = Ec; }
-
-    TIME_i[count+1] = getCurrentTime();
+      {
+        dsig_i[count]=sig-sigP;
+        /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
+        //if(crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
+        //        if(sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
+        //                DSIG_i[count+1] = sig;
+        //        }
+        //        if(sig > 0) {// Concrete should not creep when crack is opened
+        //                DSIG_i[count+1] = 0.0;
+        //        }
+        //        if(sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
+        //                DSIG_i[count+1] = sig-sigP;
+        //        }
+        //} else { //concrete is uncracked, DSIG = sig - sigP
+        //        DSIG_i[count+1] = sig-sigP;
+        //}
+        DSIG_i[count+1] = sig-sigP;
+
+        //Secant Stiffness for determination of creep strain:
+        if(fabs(eps_m/sig)>Ec)
+          { E_i[count+1] = Ec; }
+        else
+          { E_i[count+1] = fabs(sig/eps_m); } //ADDED 7/22
+
+        if(isnan(E_i[count+1]))
+          { E_i[count+1] = Ec; }
+
+        TIME_i[count+1] = getCurrentTime();
+      }
 
     eP = e;
     sigP = sig;
@@ -505,6 +528,8 @@ int XC::TDConcrete::revertToStart(void)
     else
       { count= 1; }
     resize();
+    creepChain.reset();
+    tLastCommit= 0.0;
 
     return 0;
   }
@@ -513,7 +538,8 @@ int XC::TDConcrete::revertToStart(void)
 int XC::TDConcrete::sendData(Communicator &comm)
   {
     int res= TDConcreteBase::sendData(comm);
-    res+= comm.sendDoubles(epsshu, epssha, tcr, epscru, epscra, epscrd,getDbTagData(),CommMetaData(3));
+    res+= comm.sendDoubles(epsshu, epssha, tcr, epscru, epscra, epscrd,getDbTagData(),CommMetaData(4));
+    res+= comm.sendVector(creepChain.getState(),getDbTagData(),CommMetaData(5));
     return res;
   }
 
@@ -521,7 +547,10 @@ int XC::TDConcrete::sendData(Communicator &comm)
 int XC::TDConcrete::recvData(const Communicator &comm)
   {
     int res= TDConcreteBase::recvData(comm);
-    res+= comm.receiveDoubles(epsshu, epssha, tcr, epscru, epscra, epscrd,getDbTagData(),CommMetaData(3));
+    res+= comm.receiveDoubles(epsshu, epssha, tcr, epscru, epscra, epscrd,getDbTagData(),CommMetaData(4));
+    std::vector<double> chainState;
+    res+= comm.receiveVector(chainState,getDbTagData(),CommMetaData(5));
+    creepChain.setState(chainState);
     return res;
   }
 //! @brief Sends object through the communicator argument.
@@ -529,7 +558,7 @@ int XC::TDConcrete::sendSelf(Communicator &comm)
   {
     setDbTag(comm);
     const int dataTag= getDbTag();
-    inicComm(4);
+    inicComm(6);
     int res= sendData(comm);
 
     res+= comm.sendIdData(getDbTagData(),dataTag);
@@ -541,7 +570,7 @@ int XC::TDConcrete::sendSelf(Communicator &comm)
 //! @brief Receives object through the communicator argument.
 int XC::TDConcrete::recvSelf(const Communicator &comm)
   {
-    inicComm(4);
+    inicComm(6);
     const int dataTag= getDbTag();
     int res= comm.receiveIdData(getDbTagData(),dataTag);
 
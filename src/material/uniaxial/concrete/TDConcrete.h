@@ -88,6 +88,7 @@
 #define TDConcrete_h
 
 #include "material/uniaxial/concrete/TDConcreteBase.h"
+#include "material/uniaxial/concrete/KelvinChainCreep.h"
 
 namespace XC {
 
@@ -111,6 +112,7 @@ class TDConcrete : public TDConcreteBase
     double phi_i;
     
     std::vector<float> PHI_i;
+    KelvinChainCreep creepChain; //!< creep history (exponential creep only).
 
     void Tens_Envlp (double epsc, double &sigc, double &Ect);
     void Compr_Envlp (double epsc, double &sigc, double &Ect);    
@@ -148,7 +150,7 @@ class TDConcrete : public TDConcreteBase
     double getCreepExponentParameter(void) const;
     void setCreepDParameter(const double &);
     double getCreepDParameter(void) const;
-
+    size_t getHistorySize(void) const;
     
     int commitState(void);
     int revertToLastCommit(void);    
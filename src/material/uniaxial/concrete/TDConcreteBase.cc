@@ -127,11 +127,22 @@ void XC::TDConcreteBase::setup_parameters(void)
     fpc= -fabs(fpc); 
   }
 
+//! @brief Resize the vectors that store the stress history.
+//!
+//! @return new size of the vectors.
 size_t XC::TDConcreteBase::resize(void)
   {
-    size_t newSize= 10;
-    if(count<2) // restart.
+    if(exponentialCreep) // stress history not stored.
       {
+	E_i.clear();
+	DSIG_i.clear();
+	dsig_i.clear();
+	TIME_i.clear();
+	DTIME_i.clear();
+      }
+    else if(count<2) // restart.
+      {
+        const size_t newSize= 10;
 	E_i.resize(newSize);
 	DSIG_i.resize(newSize);
 	dsig_i.resize(newSize);
@@ -142,7 +153,7 @@ size_t XC::TDConcreteBase::resize(void)
       { 
 	if(static_cast<size_t>(count+1)>=E_i.size())
 	  {
-            newSize= 2*(count+1);
+            const size_t newSize= 2*(count+1);
 	    E_i.resize(newSize);
 	    DSIG_i.resize(newSize);
 	    dsig_i.resize(newSize);
@@ -150,12 +161,16 @@ size_t XC::TDConcreteBase::resize(void)
 	    DTIME_i.resize(newSize);
 	  }
       }
-    return newSize;
+    return E_i.size();
   }
 
+//! @brief Return the time of the last committed step.
+double XC::TDConcreteBase::getLastCommitTime(void) const
+  { return (exponentialCreep ? tLastCommit : TIME_i[count]); }
+
 //! @brief Constructor.
 XC::TDConcreteBase::TDConcreteBase(int tag, int classTag)
-  : RawConcrete(tag, classTag) {}
+  : RawConcrete(tag, classTag), exponentialCreep(false), tLastCommit(0.0) {}
 
 //! @brief Constructor.
 //! @param _fpc: cylinder compressive strength (this is a dummy parameter since compression behavior is linear).
@@ -166,7 +181,8 @@ XC::TDConcreteBase::TDConcreteBase(int tag, int classTag)
 //! @param _tcast: analysis time corresponding to concrete casting in days (note: concrete will not be able to take on loads until the age of 2 days).
 XC::TDConcreteBase::TDConcreteBase(int tag, int classTag, double _fpc, double _ft, double _Ec, double _beta, double _age, double _tcast): 
   RawConcrete(tag, classTag, _fpc, 0.0, 0.0),
-  ft(_ft), Ec(_Ec), age(_age), beta(_beta), tcast(_tcast)
+  ft(_ft), Ec(_Ec), age(_age), beta(_beta), tcast(_tcast),
+  exponentialCreep(false), tLastCommit(0.0)
   {
     // setup_parameters(); Called in the constructors of derived classes.
   }
@@ -271,6 +287,39 @@ void XC::TDConcreteBase::setTCast(const double &d)
 double XC::TDConcreteBase::getTCast(void) const
   { return tcast; }
 
+//! @brief Select the algorithm used to compute the creep strain.
+//!
+//! If true, the creep function is approximated by a Dirichlet series
+//! whose internal variables (see KelvinChainCreep) are updated at each
+//! commit, so the memory and the time per step don't depend on the
+//! number of steps. Otherwise the creep strain is computed integrating
+//! the whole stress history. Must be set before the analysis starts.
+void XC::TDConcreteBase::setExponentialCreep(const bool &b)
+  {
+    if(b!=exponentialCreep)
+      {
+        if(count>1)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; Warning!, creep algorithm changed after "
+                    << count << " committed steps; the stress history"
+                    << " is lost." << std::endl;
+        exponentialCreep= b;
+        tLastCommit= 0.0;
+        count= 0;
+        resize();
+      }
+  }
+
+//! @brief Return true if the creep strain is computed using a Dirichlet
+//! series approximation of the creep function.
+bool XC::TDConcreteBase::getExponentialCreep(void) const
+  { return exponentialCreep; }
+
+//! @brief Return the number of values stored to compute the
+//! creep strain.
+size_t XC::TDConcreteBase::getHistorySize(void) const
+  { return E_i.size()+DSIG_i.size()+dsig_i.size()+TIME_i.size()+DTIME_i.size(); }
+
 
 void XC::TDConcreteBase::setCreepOn(void)
   { creepControl= 1; }
@@ -291,7 +340,8 @@ double XC::TDConcreteBase::getCreepDt(void)
 int XC::TDConcreteBase::sendData(Communicator &comm)
   {
     int res= RawConcrete::sendData(comm);
-    res+= comm.sendDoubles(ft, Ec, beta, age, getDbTagData(), CommMetaData(2));
+    res+= comm.sendDoubles(ft, Ec, beta, age, tLastCommit, getDbTagData(), CommMetaData(2));
+    res+= comm.sendBool(exponentialCreep, getDbTagData(), CommMetaData(3));
     return res;
   }
 
@@ -299,7 +349,9 @@ int XC::TDConcreteBase::sendData(Communicator &comm)
 int XC::TDConcreteBase::recvData(const Communicator &comm)
   {
     int res= RawConcrete::recvData(comm);
-    res+= comm.receiveDoubles(ft, Ec, beta, age, getDbTagData(),CommMetaData(2));
+    res+= comm.receiveDoubles(ft, Ec, beta, age, tLastCommit, getDbTagData(),CommMetaData(2));
+    res+= comm.receiveBool(exponentialCreep, getDbTagData(),CommMetaData(3));
+    resize();
     return res;
   }
 //! @brief Sends object through the communicator argument.
@@ -107,6 +107,8 @@ class TDConcreteBase : public RawConcrete
     std::vector<float> dsig_i;
     std::vector<float> TIME_i; //Time from the previous time step
     std::vector<float> DTIME_i;
+    bool exponentialCreep; //!< if true, don't store the stress history; use a Dirichlet series approximation of the creep function (see KelvinChainCreep).
+    double tLastCommit; //!< time of the last committed step (exponential creep only).
 
     static int creepControl; //!< Controls creep calculation (see setTrialStrain).
     static double creepDt; 
@@ -115,7 +117,8 @@ class TDConcreteBase : public RawConcrete
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
-    size_t resize(void);
+    virtual size_t resize(void);
+    double getLastCommitTime(void) const;
     
   public:
     TDConcreteBase(int tag, int classTag);
@@ -143,6 +146,9 @@ class TDConcreteBase : public RawConcrete
     double getAge(void) const;
     void setTCast(const double &);
     double getTCast(void) const;
+    void setExponentialCreep(const bool &);
+    bool getExponentialCreep(void) const;
+    virtual size_t getHistorySize(void) const;
     
     int sendSelf(Communicator &);  
     int recvSelf(const Communicator &);
@@ -131,6 +131,8 @@ XC::UniaxialMaterial *XC::TDConcreteMC10::getCopy(void) const
 //ntosic
 double XC::TDConcreteMC10::setCreepBasicStrain(double time, double stress)
   {
+    if(exponentialCreep)
+      { return get_chain_creep_basic_strain(time); }
     double creepBasic;
     double runSum = 0.0;
     
@@ -150,6 +152,8 @@ double XC::TDConcreteMC10::setCreepBasicStrain(double time, double stress)
 //ntosic
 double XC::TDConcreteMC10::setCreepDryingStrain(double time, double stress)
   {
+    if(exponentialCreep)
+      { return get_chain_creep_drying_strain(time); }
 	double creepDrying;
 	double runSum = 0.0;
 
@@ -210,7 +214,7 @@ int XC::TDConcreteMC10::setTrialStrain(double trialStrain, double strainRate)
     	// Calculate creep and mechanical strain, assuming stress remains constant in a time step:
     	if(creepControl == 1)
 	  {
-	    if (fabs(t-TIME_i[count]) <= 0.0001)
+	    if (fabs(t-getLastCommitTime()) <= 0.0001)
 	      { //If t = t(i-1), use creep/shrinkage from last calculated time step
             	eps_crb = epsP_crb; //ntosic
 		eps_crd = epsP_crd; //ntosic
@@ -325,36 +329,41 @@ int XC::TDConcreteMC10::commitState(void)
     ecmaxP= ecmax;
     deptP= dept;
 
-    dsig_i[count]=sig-sigP;
-    /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
-    //if (crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
-    //	if (sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
-    //		DSIG_i[count+1] = sig;
-    //	}
-    //	if (sig > 0) {// Concrete should not creep when crack is opened
-    //		DSIG_i[count+1] = 0.0;
-    //	}
-    //	if (sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
-    //		DSIG_i[count+1] = sig-sigP;
-    //	}
-    //} else { //concrete is uncracked, DSIG = sig - sigP
-    //	DSIG_i[count+1] = sig-sigP;
-    //}
-    DSIG_i[count+1] = sig-sigP;
-
-    //Secant Stiffness for determination of creep strain:
-	if (fabs(eps_m/sig)>Ec) { //ntosic: originally was eps_m/sig
-	    E_i[count+1] = Ec;
-	} else {
-	    E_i[count+1] = fabs(sig/eps_m); //ADDED 7/22
-	}
-
-	if (isnan(E_i[count+1])) {
-	    E_i[count+1] = Ec;
-	}
-
-
-    TIME_i[count+1] = getCurrentTime();
+    if(exponentialCreep)
+      { commit_creep_chains(); }
+    else
+      {
+        dsig_i[count]=sig-sigP;
+        /* 5/8/2013: commented the following lines so that the DSIG_i[count+1]=sig-sigP;*/
+        //if (crack_flag == 1) {// DSIG_i will be different depending on how the fiber is cracked
+        //	if (sig < 0 && sigP > 0) { //if current step puts concrete from tension to compression, DSIG_i will be only the comp. stress
+        //		DSIG_i[count+1] = sig;
+        //	}
+        //	if (sig > 0) {// Concrete should not creep when crack is opened
+        //		DSIG_i[count+1] = 0.0;
+        //	}
+        //	if (sig > 0 && sigP < 0) {//if current step goes from compression to tension, DSIG_i will be the stress difference
+        //		DSIG_i[count+1] = sig-sigP;
+        //	}
+        //} else { //concrete is uncracked, DSIG = sig - sigP
+        //	DSIG_i[count+1] = sig-sigP;
+        //}
+        DSIG_i[count+1] = sig-sigP;
+
+        //Secant Stiffness for determination of creep strain:
+    	if (fabs(eps_m/sig)>Ec) { //ntosic: originally was eps_m/sig
+    	    E_i[count+1] = Ec;
+    	} else {
+    	    E_i[count+1] = fabs(sig/eps_m); //ADDED 7/22
+    	}
+
+    	if (isnan(E_i[count+1])) {
+    	    E_i[count+1] = Ec;
+    	}
+
+
+        TIME_i[count+1] = getCurrentTime();
+      }
 
     eP = e;
     sigP = sig;
@@ -260,6 +260,42 @@ double XC::TDConcreteMC10Base::getShrinkBasic(void) const
 double XC::TDConcreteMC10Base::getShrinkDrying(void) const
   { return eps_shd; }
 
+//! @brief Return the basic creep strain at the time argument
+//! computed from the Kelvin chain (exponential creep only).
+double XC::TDConcreteMC10Base::get_chain_creep_basic_strain(const double &time)
+  {
+    phib_i= setPhiBasic(time, basicCreepChain.getLastTime());
+    return basicCreepChain.getCreepStrain(time, Ecm);
+  }
+
+//! @brief Return the drying creep strain at the time argument
+//! computed from the Kelvin chain (exponential creep only).
+double XC::TDConcreteMC10Base::get_chain_creep_drying_strain(const double &time)
+  {
+    phid_i= setPhiDrying(time, dryingCreepChain.getLastTime());
+    return dryingCreepChain.getCreepStrain(time, Ecm);
+  }
+
+//! @brief Add the stress increment of the step being committed
+//! to the Kelvin chains (exponential creep only).
+void XC::TDConcreteMC10Base::commit_creep_chains(void)
+  {
+    tLastCommit= getCurrentTime();
+    const double dsig= sig-sigP;
+    basicCreepChain.addStressIncrement(dsig, tLastCommit, [this](double time, double tp) { return setPhiBasic(time, tp); });
+    dryingCreepChain.addStressIncrement(dsig, tLastCommit, [this](double time, double tp) { return setPhiDrying(time, tp); });
+  }
+
+//! @brief Return the number of values stored to compute the
+//! creep strain.
+size_t XC::TDConcreteMC10Base::getHistorySize(void) const
+  {
+    size_t retval= TDConcreteBase::getHistorySize()+PHIB_i.size()+PHID_i.size();
+    if(exponentialCreep)
+      retval+= 2*(2*KelvinChainCreep::numTerms+1);
+    return retval;
+  }
+
 int XC::TDConcreteMC10Base::revertToLastCommit(void)
   {
     eps_total = epsP_total; //Added by AMK;
@@ -297,6 +333,9 @@ int XC::TDConcreteMC10Base::revertToStart(void)
     else
       { count= 1; }
     resize();
+    basicCreepChain.reset();
+    dryingCreepChain.reset();
+    tLastCommit= 0.0;
     return 0;
   }
 
@@ -304,10 +343,12 @@ int XC::TDConcreteMC10Base::revertToStart(void)
 int XC::TDConcreteMC10Base::sendData(Communicator &comm)
   {
     int res= TDConcreteBase::sendData(comm);
-    res+= comm.sendDoubles(Ecm, epsba, epsbb, epsda, epsdb,getDbTagData(),CommMetaData(3));
-    res+= comm.sendDoubles(phiba, phibb, phida, phidb, getDbTagData(),CommMetaData(4));
-    res+= comm.sendDoubles(cem, ecminP, ecmaxP, deptP, epsP, getDbTagData(),CommMetaData(5));
-    res+= comm.sendDoubles(sigP, eP, getDbTagData(),CommMetaData(6));
+    res+= comm.sendDoubles(Ecm, epsba, epsbb, epsda, epsdb,getDbTagData(),CommMetaData(4));
+    res+= comm.sendDoubles(phiba, phibb, phida, phidb, getDbTagData(),CommMetaData(5));
+    res+= comm.sendDoubles(cem, ecminP, ecmaxP, deptP, epsP, getDbTagData(),CommMetaData(6));
+    res+= comm.sendDoubles(sigP, eP, getDbTagData(),CommMetaData(7));
+    res+= comm.sendVector(basicCreepChain.getState(),getDbTagData(),CommMetaData(8));
+    res+= comm.sendVector(dryingCreepChain.getState(),getDbTagData(),CommMetaData(9));
     return res;
   }
 
@@ -315,10 +356,15 @@ int XC::TDConcreteMC10Base::sendData(Communicator &comm)
 int XC::TDConcreteMC10Base::recvData(const Communicator &comm)
   {
     int res= TDConcreteBase::recvData(comm);
-    res+= comm.receiveDoubles(Ecm, epsba, epsbb, epsda, epsdb,getDbTagData(),CommMetaData(3));
-    res+= comm.receiveDoubles(phiba, phibb, phida, phidb, getDbTagData(),CommMetaData(4));
-    res+= comm.receiveDoubles(cem, ecminP, ecmaxP, deptP, epsP, getDbTagData(),CommMetaData(5));
-    res+= comm.receiveDoubles(sigP, eP, getDbTagData(),CommMetaData(6));
+    res+= comm.receiveDoubles(Ecm, epsba, epsbb, epsda, epsdb,getDbTagData(),CommMetaData(4));
+    res+= comm.receiveDoubles(phiba, phibb, phida, phidb, getDbTagData(),CommMetaData(5));
+    res+= comm.receiveDoubles(cem, ecminP, ecmaxP, deptP, epsP, getDbTagData(),CommMetaData(6));
+    res+= comm.receiveDoubles(sigP, eP, getDbTagData(),CommMetaData(7));
+    std::vector<double> chainState;
+    res+= comm.receiveVector(chainState,getDbTagData(),CommMetaData(8));
+    basicCreepChain.setState(chainState);
+    res+= comm.receiveVector(chainState,getDbTagData(),CommMetaData(9));
+    dryingCreepChain.setState(chainState);
     return res;
   }
 
@@ -326,7 +372,7 @@ int XC::TDConcreteMC10Base::sendSelf(Communicator &comm)
   {
     setDbTag(comm);
     const int dataTag= getDbTag();
-    inicComm(7);
+    inicComm(10);
     int res= sendData(comm);
 
     res+= comm.sendIdData(getDbTagData(),dataTag);
@@ -337,7 +383,7 @@ int XC::TDConcreteMC10Base::sendSelf(Communicator &comm)
 
 int XC::TDConcreteMC10Base::recvSelf(const Communicator &comm)
   {
-    inicComm(7);
+    inicComm(10);
     const int dataTag= getDbTag();
     int res= comm.receiveIdData(getDbTagData(),dataTag);
 
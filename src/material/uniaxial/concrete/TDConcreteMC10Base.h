@@ -49,6 +49,7 @@
 #define TDConcreteMC10Base_h
 
 #include "material/uniaxial/concrete/TDConcreteBase.h"
+#include "material/uniaxial/concrete/KelvinChainCreep.h"
 
 namespace XC {
   
@@ -85,11 +86,16 @@ class TDConcreteMC10Base : public TDConcreteBase
     
     std::vector<float> PHIB_i; //!< split into basic and drying creep (ntosic)
     std::vector<float> PHID_i; //!< split into basic and drying creep (ntosic)
+    KelvinChainCreep basicCreepChain; //!< basic creep history (exponential creep only).
+    KelvinChainCreep dryingCreepChain; //!< drying creep history (exponential creep only).
 
   protected:
     int sendData(Communicator &);
     int recvData(const Communicator &);
     size_t resize(void);
+    double get_chain_creep_basic_strain(const double &);
+    double get_chain_creep_drying_strain(const double &);
+    void commit_creep_chains(void);
   public:
     TDConcreteMC10Base(int tag, int classTag);
     TDConcreteMC10Base(int tag, int classTag, double _fc, double _ft, double _Ec, double _Ecm, double _beta, double _age, double _epsba, double _epsbb, double _epsda, double _epsdb, double _phiba, double _phibb, double _phida, double _phidb, double _tcast, double _cem);
@@ -129,6 +135,7 @@ class TDConcreteMC10Base : public TDConcreteBase
     double setShrinkDrying(double time); //Added by AMK //ntosic: split into basic and drying shrinkage
     double getShrinkBasic(void) const; //Added by AMK //ntosic: split into basic and drying
     double getShrinkDrying(void) const; //Added by AMK //ntosic: split into basic and drying
+    size_t getHistorySize(void) const;
     
     int revertToLastCommit(void);    
     int revertToStart(void);        
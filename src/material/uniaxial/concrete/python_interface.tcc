@@ -50,6 +50,8 @@ class_<XC::TDConcreteBase, bases<XC::RawConcrete>, boost::noncopyable >("TDConcr
   .add_property("age", &XC::TDConcreteBase::getAge,  &XC::TDConcreteBase::setAge, "concrete age.")
   .add_property("beta", &XC::TDConcreteBase::getBeta,  &XC::TDConcreteBase::setBeta,"concrete beta parameter.")
   .add_property("tcast", &XC::TDConcreteBase::getTCast,  &XC::TDConcreteBase::setTCast,"tcast.")
+  .add_property("exponentialCreep", &XC::TDConcreteBase::getExponentialCreep,  &XC::TDConcreteBase::setExponentialCreep,"if true, compute the creep strain using a Dirichlet series (Kelvin chain) approximation of the creep function instead of integrating the whole stress history (constant memory and time per step).")
+  .def("getHistorySize", &XC::TDConcreteBase::getHistorySize,"Return the number of values stored to compute the creep strain.")
   .def("setCreepOn", &XC::TDConcreteBase::setCreepOn,"Activate creep.").staticmethod("setCreepOn")
   .def("setCreepOff", &XC::TDConcreteBase::setCreepOff,"Deactivate creep.").staticmethod("setCreepOff")
   .def("isCreepOn", &XC::TDConcreteBase::isCreepOn,"Return true if creep is activen.").staticmethod("isCreepOn")
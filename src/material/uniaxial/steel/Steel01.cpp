@@ -59,6 +59,7 @@
 
 
 #include <material/uniaxial/steel/Steel01.h>
+#include <typeinfo>
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
 
@@ -187,6 +188,28 @@ void XC::Steel01::determineTrialState(double dStrain)
       }
   }
 
+//! @brief Batch kernel: set the trial strain of each of the materials
+//! of the array (all of them of class Steel01) and return their
+//! stresses and tangents.
+//!
+//! The loop calls directly the trial strain update of SteelBase0103
+//! for each material.
+int XC::Steel01::setTrialBatch(const size_t &n, UniaxialMaterial *const *materials, const double *strains, double *stresses, double *tangents) const
+  {
+    // derived classes may redefine the state determination.
+    if(typeid(*this)!=typeid(Steel01))
+      return SteelBase0103::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Steel01 *m= static_cast<Steel01 *>(materials[i]);
+        retval+= m->SteelBase0103::setTrialStrain(strains[i]);
+        stresses[i]= m->Tstress;
+        tangents[i]= m->Ttangent;
+      }
+    return retval;
+  }
+
 //! @brief Determines if a load reversal has occurred based on the trial strain
 void XC::Steel01::detectLoadReversal(double dStrain)
   {
@@ -62,6 +62,7 @@
 //-----------------------------------------------------------------------
 
 #include <material/uniaxial/steel/Steel02.h>
+#include <typeinfo>
 #include <utility/matrix/Vector.h>
 #include <cfloat>
 #include <cstdlib>
@@ -334,6 +335,28 @@ int XC::Steel02::setTrialStrain(double trialStrain, double strainRate)
     return 0;
   }
 
+//! @brief Batch kernel: set the trial strain of each of the materials
+//! of the array (all of them of class Steel02) and return their
+//! stresses and tangents.
+//!
+//! The loop calls the non-virtual version of the state determination
+//! of each material.
+int XC::Steel02::setTrialBatch(const size_t &n, UniaxialMaterial *const *materials, const double *strains, double *stresses, double *tangents) const
+  {
+    // derived classes may redefine the state determination.
+    if(typeid(*this)!=typeid(Steel02))
+      return SteelBase::setTrialBatch(n, materials, strains, stresses, tangents);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Steel02 *m= static_cast<Steel02 *>(materials[i]);
+        retval+= m->Steel02::setTrialStrain(strains[i]);
+        stresses[i]= m->Steel02::getStress();
+        tangents[i]= m->Steel02::getTangent();
+      }
+    return retval;
+  }
+
 //! @brief Return material strain
 double XC::Steel02::getStrain(void) const
   { return eps; }
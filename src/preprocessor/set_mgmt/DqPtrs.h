@@ -35,7 +35,10 @@
 #include "utility/kernel/CommandEntity.h"
 #include <deque>
 #include <set>
+#include <unordered_set>
 #include "utility/actor/actor/MovableID.h"
+#include "utility/matrix/Matrix.h"
+#include <limits>
 #include <boost/iterator/indirect_iterator.hpp>
 
 
@@ -53,6 +56,11 @@ namespace XC {
 //!  - Line.
 //!  - Suprface.
 //!  - Body.
+//!
+//!  The container keeps an index (hash table) of the stored pointers
+//!  so membership queries and insertions don't need to traverse the
+//!  whole container and the set operations (union, difference and
+//!  intersection) run in linear time preserving the insertion order.
 template <class T>
 class DqPtrs: public CommandEntity, protected std::deque<T *>
   {
@@ -66,6 +74,15 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     typedef typename lst_ptr::value_type value_type;
     typedef typename lst_ptr::difference_type difference_type;
     typedef boost::indirect_iterator<iterator> indIterator;
+    typedef std::unordered_set<const T *> ptr_index;
+  private:
+    ptr_index index; //!< pointers in the container.
+  protected:
+    bool push_back_new(T *);
+    template <class Predicate>
+    size_t remove_if(const Predicate &);
+    template <class Getter>
+    Matrix get_rows(const Getter &) const;
   public:
     DqPtrs(CommandEntity *owr= nullptr);
     DqPtrs(const DqPtrs &);
@@ -98,6 +115,8 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
       { return lst_ptr::size(); }
     bool in(const T *) const;
     bool remove(T *);
+    void remove(const DqPtrs &);
+    void intersect(const DqPtrs &);
     //void sort_on_prop(const std::string &cod,const bool &ascending= true);
     
     boost::python::list getPythonList(void);
@@ -106,16 +125,16 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     T *findTag(const size_t &);
     template <class InputIterator>
     void insert(iterator pos, InputIterator f, InputIterator l)
-      { lst_ptr::insert(pos,f,l); }
+      { insert_unique(pos,f,l); }
     template <class InputIterator>
     void insert_unique(iterator pos, InputIterator f, InputIterator l)
       {
-	DqPtrs<T> tmp;
+	std::deque<T *> tmp;
 	//Filter those already in the container.
 	for(InputIterator i= f;i!=l;i++)
 	  {
 	    T *ptr= *i;
-	    if(!this->in(ptr))
+	    if(ptr && index.insert(ptr).second)
 	      { tmp.push_back(ptr); }
 	  }
 	lst_ptr::insert(pos,tmp.begin(),tmp.end()); //Add only new ones.
@@ -135,24 +154,29 @@ DqPtrs<T>::DqPtrs(CommandEntity *owr)
 //! @brief Copy constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(const DqPtrs<T> &other)
-  : CommandEntity(other), lst_ptr(other)
+  : CommandEntity(other), lst_ptr(other), index(other.index)
   {}
 
-//! @brief Copy from deque container.
+//! @brief Copy from deque container (repeated pointers are ignored).
 template <class T>
 DqPtrs<T>::DqPtrs(const std::deque<T *> &ts)
-  : CommandEntity(), lst_ptr(ts)
-  {}
+  : CommandEntity(), lst_ptr()
+  {
+    index.reserve(ts.size());
+    for(typename std::deque<T *>::const_iterator i= ts.begin();i!=ts.end();i++)
+      push_back_new(*i);
+  }
 
 //! @brief Copy from set container.
 template <class T>
 DqPtrs<T>::DqPtrs(const std::set<const T *> &st)
   : CommandEntity(), lst_ptr()
   {
+    index.reserve(st.size());
     typename std::set<const T *>::const_iterator k;
     k= st.begin();
     for(;k!=st.end();k++)
-      lst_ptr::push_back(const_cast<T *>(*k));
+      push_back_new(const_cast<T *>(*k));
   }
 
 //! @brief Assignment operator.
@@ -161,6 +185,7 @@ DqPtrs<T> &DqPtrs<T>::operator=(const DqPtrs &other)
   {
     CommandEntity::operator=(other);
     lst_ptr::operator=(other);
+    index= other.index;
     return *this;
   }
 
@@ -174,12 +199,17 @@ DqPtrs<T> &DqPtrs<T>::operator+=(const DqPtrs &other)
 
 
 //! @brief Extend this container with the pointers from the container
-//! being passed as parameter.
+//! being passed as parameter (union). The pointers already in this
+//! container are ignored, the order of the remaining ones is preserved.
 template <class T>
 void DqPtrs<T>::extend(const DqPtrs &other)
   {
-    for( const_iterator i= other.begin();i!=other.end();i++)
-      push_back(*i);
+    if(&other!=this)
+      {
+        index.reserve(size()+other.size());
+        for(const_iterator i= other.begin();i!=other.end();i++)
+          push_back_new(*i);
+      }
   }
 
 //! @brief Return a python list containing the pointers to the
@@ -196,7 +226,10 @@ boost::python::list DqPtrs<T>::getPythonList(void)
 //! @brief Clears out the list of pointers.
 template<class T>
 void DqPtrs<T>::clear(void)
-  { lst_ptr::clear(); }
+  {
+    lst_ptr::clear();
+    index.clear();
+  }
 
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template<class T>
@@ -217,29 +250,74 @@ const T &DqPtrs<T>::get(const size_t &i) const
 //! @brief Returns true if the pointer is in the container.
 template<class T>
 bool DqPtrs<T>::in(const T *ptr) const
+  { return (index.find(ptr)!=index.end()); }
+
+//! @brief Remove the given pointer from the container.
+template<class T>
+bool DqPtrs<T>::remove(T *ptr)
   {
     bool retval= false;
-    for(const_iterator i= begin();i!= end();i++)
-      if(*i==ptr)
-        {
-          retval= true;
-          break;
-        }
+    if(index.erase(ptr)>0) //It's in the container.
+      {
+        iterator i= find(begin(),end(),ptr);
+        this->erase(i);
+        retval= true;
+      }
     return retval;
   }
 
-//! @brief Remove the given pointer from the container.
+//! @brief Remove the pointers for which the predicate is true
+//! preserving the order of the remaining ones.
+//! @return number of removed pointers.
 template<class T>
-bool DqPtrs<T>::remove(T *ptr)
+template <class Predicate>
+size_t DqPtrs<T>::remove_if(const Predicate &pred)
   {
-    bool retval= false;
-    for(const_iterator i= begin();i!= end();i++)
-      if(*i==ptr)
-        {
-          retval= true;
-	  this->erase(i);
-          break;
-        }
+    iterator j= begin();
+    for(iterator i= begin();i!=end();i++)
+      {
+        T *ptr= *i;
+        if(pred(ptr))
+          index.erase(ptr);
+        else
+          {
+            *j= ptr;
+            j++;
+          }
+      }
+    const size_t retval= end()-j;
+    this->erase(j,end());
+    return retval;
+  }
+
+//! @brief Removes the pointers that belong also to the given
+//! container (difference).
+template<class T>
+void DqPtrs<T>::remove(const DqPtrs &other)
+  {
+    if(&other==this)
+      clear();
+    else if(!other.empty())
+      remove_if([&other](const T *ptr){ return other.in(ptr); });
+  }
+
+//! @brief Removes the pointers that don't belong to the given
+//! container (intersection).
+template<class T>
+void DqPtrs<T>::intersect(const DqPtrs &other)
+  {
+    if(&other!=this)
+      remove_if([&other](const T *ptr){ return !other.in(ptr); });
+  }
+
+//! @brief Append the pointer if it's not already in the container
+//! (no error checking).
+template <class T>
+bool DqPtrs<T>::push_back_new(T *t)
+  {
+    const bool retval= index.insert(t).second;
+    if(retval) //It's a new element.
+      lst_ptr::push_back(t);
     return retval;
   }
   
@@ -248,13 +326,7 @@ bool DqPtrs<T>::push_back(T *t)
   {
     bool retval= false;
     if(t)
-      {
-        if(find(begin(),end(),t) == end()) //It's a new element.
-          {
-            lst_ptr::push_back(t);
-            retval= true;
-          }
-      }
+      retval= push_back_new(t);
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 	        << "; attempt to insert a null pointer." << std::endl;
@@ -267,7 +339,7 @@ bool DqPtrs<T>::push_front(T *t)
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //New element.
+        if(index.insert(t).second) //New element.
           {
             lst_ptr::push_front(t);
             retval= true;
@@ -299,6 +371,38 @@ const ID &DqPtrs<T>::getTags(void) const
     return retval;
   }
   
+//! @brief Return a matrix whose i-th row contains the components
+//! of the vector returned by the getter for the i-th object of the
+//! container (in the same order as getTags). If the vectors have
+//! different sizes the missing components are NaN.
+//!
+//! @param getter: function that returns the vector of each object.
+template <class T>
+template <class Getter>
+Matrix DqPtrs<T>::get_rows(const Getter &getter) const
+  {
+    const size_t nRows= size();
+    std::vector<Vector> rows;
+    rows.reserve(nRows);
+    int nCols= 0;
+    for(const_iterator i= begin();i!=end();i++)
+      {
+        rows.push_back(getter(**i));
+        nCols= std::max(nCols, rows.back().Size());
+      }
+    Matrix retval(nRows, nCols);
+    for(size_t i= 0;i<nRows;i++)
+      {
+        const Vector &row= rows[i];
+        const int sz= row.Size();
+        for(int j= 0;j<sz;j++)
+          retval(i,j)= row(j);
+        for(int j= sz;j<nCols;j++)
+          retval(i,j)= std::numeric_limits<double>::quiet_NaN();
+      }
+    return retval;
+  }
+  
 //! @brief Returns a pointer to the object identified by the tag argument.
 template <class T>
 T *DqPtrs<T>::findTag(const size_t &tag)
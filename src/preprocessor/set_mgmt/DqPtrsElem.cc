@@ -37,6 +37,34 @@
 #include <boost/algorithm/string/find.hpp>
 #include "utility/geom/d3/BND3d.h"
 #include "utility/utils/misc_utils/colormod.h"
+#include <boost/python/extract.hpp>
+
+namespace {
+//! @brief Return the values in the list (numbers or vectors) one
+//! after another in a vector.
+XC::Vector flatten_values(const boost::python::list &values)
+  {
+    std::vector<double> tmp;
+    const size_t sz= boost::python::len(values);
+    for(size_t i= 0;i<sz;i++)
+      {
+        boost::python::extract<double> d(values[i]);
+        if(d.check())
+          tmp.push_back(d());
+        else
+          {
+            boost::python::extract<XC::Vector> v(values[i]);
+            if(v.check())
+              {
+                const XC::Vector vi= v();
+                for(int j= 0;j<vi.Size();j++)
+                  tmp.push_back(vi(j));
+              }
+          }
+      }
+    return XC::Vector(tmp);
+  }
+} // end of anonymous namespace
 
 //! @brief Constructor.
 XC::DqPtrsElem::DqPtrsElem(CommandEntity *owr)
@@ -308,6 +336,20 @@ XC::Matrix XC::DqPtrsElem::getTotalMass(void) const
     return retval;
   }
 
+//! @brief Return a matrix whose rows are the resisting forces of
+//! the elements (in the same order as getTags).
+XC::Matrix XC::DqPtrsElem::getResistingForceMatrix(void) const
+  { return get_rows([](const Element &e) -> const Vector & { return e.getResistingForce(); }); }
+
+//! @brief Return a matrix whose i-th row contains the values of the
+//! argument property at the nodes of the i-th element (see
+//! Element::getValuesAtNodes) one node after another.
+//!
+//! @param code: identifier of the requested value.
+//! @param silent: if true, don't complaint about non-existent property.
+XC::Matrix XC::DqPtrsElem::getValuesAtNodesMatrix(const std::string &code, bool silent) const
+  { return get_rows([&code, silent](const Element &e) { return flatten_values(e.getValuesAtNodes(code, silent)); }); }
+
 //! @brief Return the total mass matrix component for the DOF argument.
 double XC::DqPtrsElem::getTotalMassComponent(const int &dof) const
   {
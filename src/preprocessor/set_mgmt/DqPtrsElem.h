@@ -99,6 +99,10 @@ class DqPtrsElem: public DqPtrsKDTree<Element,KDTreeElements>
     ElementalLoad *vector2dPointLoadLocal(const Vector &,const Vector &);
     ElementalLoad *vector3dPointLoadGlobal(const Vector &,const Vector &);
     ElementalLoad *vector3dPointLoadLocal(const Vector &,const Vector &);    
+
+    // Bulk access to the results (one row for each element).
+    Matrix getResistingForceMatrix(void) const;
+    Matrix getValuesAtNodesMatrix(const std::string &, bool silent= false) const;
     
     // mass distribution
     Matrix getTotalMass(void) const;
@@ -339,28 +339,12 @@ BND3d DqPtrsEntities<T>::Bnd(void) const
 //! @brief Removes the objects that belongs also to the given container.
 template <class T>
 void DqPtrsEntities<T>::remove(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j!=this->end()) //Found.
-	  this->erase(j);
-      }
-  }
+  { dq_ptr::remove(other); }
 
-//! @brief Removes the objects that belongs also to the given container.
+//! @brief Removes the objects that don't belong to the given container.
 template <class T>
 void DqPtrsEntities<T>::intersect(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j==this->end()) //Not found
-	  this->erase(j);
-      }
-  }
+  { dq_ptr::intersect(other); }
 
 //! @brief Remove the given element from the entities of this container
 // (remove means set the corresponding pointer to null).
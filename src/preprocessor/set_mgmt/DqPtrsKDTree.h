@@ -68,6 +68,8 @@ class DqPtrsKDTree: public DqPtrs<T>
     bool push_back(T *);
     bool push_front(T *);
     bool remove(T *);
+    void remove(const DqPtrsKDTree &);
+    void intersect(const DqPtrsKDTree &);
     void clearAll(void);
 
     T *getNearest(const Pos3d &p);
@@ -170,6 +172,26 @@ bool XC::DqPtrsKDTree<T,KDTree>::remove(T *t)
     return retval;
   }
 
+//! @brief Removes the objects that belong also to the given container.
+template <class T,class KDTree>
+void XC::DqPtrsKDTree<T,KDTree>::remove(const DqPtrsKDTree &other)
+  {
+    const size_t sz= this->size();
+    DqPtrs<T>::remove(other);
+    if(this->size()!=sz)
+      create_tree();
+  }
+
+//! @brief Removes the objects that don't belong to the given container.
+template <class T,class KDTree>
+void XC::DqPtrsKDTree<T,KDTree>::intersect(const DqPtrsKDTree &other)
+  {
+    const size_t sz= this->size();
+    DqPtrs<T>::intersect(other);
+    if(this->size()!=sz)
+      create_tree();
+  }
+
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template <class T,class KDTree>
 void DqPtrsKDTree<T,KDTree>::clearAll(void)
@@ -211,7 +233,7 @@ DqPtrsKDTree<T,KDTree> operator-(const DqPtrsKDTree<T,KDTree> &a,const DqPtrsKDT
       {
         T *n= (*i);
         assert(n);
-	if(!b.in(n)) //If not in b.
+	if(!b.in(n)) //If not in b (constant time).
 	  retval.push_back(n);
       }
     return retval;    
@@ -226,7 +248,7 @@ DqPtrsKDTree<T,KDTree> operator*(const DqPtrsKDTree<T,KDTree> &a,const DqPtrsKDT
       {
         T *n= (*i);
         assert(n);
-	if(b.in(n)) //If also in b.
+	if(b.in(n)) //If also in b (constant time).
 	  retval.push_back(n);
       }
     return retval;    
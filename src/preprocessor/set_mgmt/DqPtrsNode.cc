@@ -201,6 +201,26 @@ XC::Matrix XC::DqPtrsNode::getTotalMass(void) const
     return retval;
   }
 
+//! @brief Return a matrix whose rows are the displacement vectors of
+//! the nodes (in the same order as getTags).
+XC::Matrix XC::DqPtrsNode::getDispMatrix(void) const
+  { return get_rows([](const Node &n) -> const Vector & { return n.getDisp(); }); }
+
+//! @brief Return a matrix whose rows are the velocity vectors of
+//! the nodes (in the same order as getTags).
+XC::Matrix XC::DqPtrsNode::getVelMatrix(void) const
+  { return get_rows([](const Node &n) -> const Vector & { return n.getVel(); }); }
+
+//! @brief Return a matrix whose rows are the acceleration vectors of
+//! the nodes (in the same order as getTags).
+XC::Matrix XC::DqPtrsNode::getAccelMatrix(void) const
+  { return get_rows([](const Node &n) -> const Vector & { return n.getAccel(); }); }
+
+//! @brief Return a matrix whose rows are the reactions of the nodes
+//! (in the same order as getTags).
+XC::Matrix XC::DqPtrsNode::getReactionMatrix(void) const
+  { return get_rows([](const Node &n) -> const Vector & { return n.getReaction(); }); }
+
 //! @brief Return the total mass matrix component for the DOF argument.
 double XC::DqPtrsNode::getTotalMassComponent(const int &dof) const
   {
@@ -83,6 +83,12 @@ class DqPtrsNode: public DqPtrsKDTree<Node,KDTreeNodes>
     void numerate(void);
 
     boost::python::list createInertiaLoads(const Vector &);
+
+    // Bulk access to the results (one row for each node).
+    Matrix getDispMatrix(void) const;
+    Matrix getVelMatrix(void) const;
+    Matrix getAccelMatrix(void) const;
+    Matrix getReactionMatrix(void) const;
     
     // mass distribution
     Matrix getTotalMass(void) const;
@@ -175,15 +175,15 @@ void XC::SetEntities::substract_lists(const SetEntities &other)
     this->substract(other.uniform_grids);
   }
 
-//! @brief Removes from this set the objects that belongs
-//! also to the argument.
+//! @brief Removes from this set the objects that doesn't belong
+//! to the argument.
 void XC::SetEntities::intersect_lists(const SetEntities &other)
   {
-    points-= other.points;
-    lines-= other.lines;
-    surfaces-= other.surfaces;
-    bodies-= other.bodies;
-    uniform_grids-= other.uniform_grids;
+    points*= other.points;
+    lines*= other.lines;
+    surfaces*= other.surfaces;
+    bodies*= other.bodies;
+    uniform_grids*= other.uniform_grids;
   }
 
 //! @brief Addition assignment operator.
@@ -33,6 +33,7 @@ class_<dq_ptrs_node, bases<CommandEntity>, boost::noncopyable >("dq_ptrs_node",n
   .def("getTags",make_function(&dq_ptrs_node::getTags, return_internal_reference<>() ),"Returns node identifiers.")
   .def("findTag",make_function(dq_ptrs_find_node_tag, return_internal_reference<>() ),"Returns the node identified by the tag argument.")
   .def("clear",&dq_ptrs_node::clear,"Removes all items.")
+  .def("__contains__",&dq_ptrs_node::in,"Return true if the node is in the container.")
   ;
 
 XC::Node *(XC::DqPtrsNode::*getNearestNodeDqPtrs)(const Pos3d &)= &XC::DqPtrsNode::getNearest;
@@ -55,6 +56,10 @@ class_<XC::DqPtrsNode, bases<dq_ptrs_node> >("DqPtrsNode",no_init)
   .def(self - self)
   .def(self * self)
   .def("createInertiaLoads", &XC::DqPtrsNode::createInertiaLoads,"Create the inertia load for the given acceleration vector.")
+  .def("getDispMatrix", &XC::DqPtrsNode::getDispMatrix, "Return a matrix whose rows are the displacements of the nodes (use numpy.asarray to get a view of it).")
+  .def("getVelMatrix", &XC::DqPtrsNode::getVelMatrix, "Return a matrix whose rows are the velocities of the nodes (use numpy.asarray to get a view of it).")
+  .def("getAccelMatrix", &XC::DqPtrsNode::getAccelMatrix, "Return a matrix whose rows are the accelerations of the nodes (use numpy.asarray to get a view of it).")
+  .def("getReactionMatrix", &XC::DqPtrsNode::getReactionMatrix, "Return a matrix whose rows are the reactions of the nodes (use numpy.asarray to get a view of it).")
   .add_property("totalMass", &XC::DqPtrsNode::getTotalMass, "Return the total mass matrix.")
   .def("getTotalMassComponent", &XC::DqPtrsNode::getTotalMassComponent,"Return the total mass matrix component for the DOF argument.")
   ;
@@ -71,6 +76,7 @@ class_<dq_ptrs_element, bases<CommandEntity>, boost::noncopyable >("dq_ptrs_elem
   .def("getTags",make_function(&dq_ptrs_element::getTags, return_internal_reference<>() ),"Returns element identifiers.")
   .def("findTag",make_function(dq_ptrs_find_element_tag, return_internal_reference<>() ),"Returns the element identified by the tag argument.")
   .def("clear",&dq_ptrs_element::clear,"Removes all items.")
+  .def("__contains__",&dq_ptrs_element::in,"Return true if the element is in the container.")
   ;
 
 XC::Element *(XC::DqPtrsElem::*getNearestElementDqPtrs)(const Pos3d &)= &XC::DqPtrsElem::getNearest;
@@ -103,6 +109,8 @@ class_<XC::DqPtrsElem, bases<dq_ptrs_element> >("DqPtrsElem",no_init)
   .def("vector3dPointLoadGlobal",  make_function(&XC::DqPtrsElem::vector3dPointLoadGlobal, return_internal_reference<>() ), "Element's load.")
   .def("vector3dPointLoadLocal",  make_function(&XC::DqPtrsElem::vector3dPointLoadLocal, return_internal_reference<>() ), "Element's load.")
 
+  .def("getResistingForceMatrix", &XC::DqPtrsElem::getResistingForceMatrix, "Return a matrix whose rows are the resisting forces of the elements (use numpy.asarray to get a view of it).")
+  .def("getValuesAtNodesMatrix", &XC::DqPtrsElem::getValuesAtNodesMatrix, (arg("code"), arg("silent")= false), "getValuesAtNodesMatrix(code, silent): return a matrix whose rows are the values of the argument at the nodes of each element (see Element::getValuesAtNodes).")
   .add_property("totalMass", &XC::DqPtrsElem::getTotalMass, "Return the total mass matrix.")
   .def("getTotalMassComponent", &XC::DqPtrsElem::getTotalMassComponent,"Return the total mass matrix component for the DOF argument.")
   .def("getAverageSize", &XC::DqPtrsElem::getAverageSize,"Get the average size of the elements (elements of dimension zero are ignored).")
@@ -122,6 +130,7 @@ class_<dq_ptrs_constraint, bases<CommandEntity>, boost::noncopyable >("dq_ptrs_c
   .def("getPythonList",&dq_ptrs_constraint::getPythonList, "Returns the constraints in a Python list.")
   .def("getTags",make_function(&dq_ptrs_constraint::getTags, return_internal_reference<>() ),"Returns constraint identifiers.")
   .def("clear",&dq_ptrs_constraint::clear,"Removes all items.")
+  .def("__contains__",&dq_ptrs_constraint::in,"Return true if the constraint is in the container.")
   ;
 
 class_<XC::DqPtrsConstraint, bases<dq_ptrs_constraint>, boost::noncopyable >("DqPtrsConstraint",no_init)
@@ -36,6 +36,7 @@
 #include <solution/analysis/analysis/IllConditioningAnalysis.h>
 #include <solution/analysis/analysis/LinearBucklingAnalysis.h>
 #include <solution/analysis/analysis/LinearBucklingEigenAnalysis.h>
+#include <solution/analysis/analysis/LinearCombinationAnalysis.h>
 #include <solution/analysis/analysis/StaticAnalysis.h>
 #include <solution/analysis/analysis/DirectIntegrationAnalysis.h>
 #include <solution/analysis/analysis/VariableTimeStepDirectIntegrationAnalysis.h>
@@ -91,6 +92,8 @@ bool XC::SolutionProcedure::alloc_analysis(const std::string &cod,const std::str
               theAnalysis= new IllConditioningAnalysis(analysis_aggregation);
             else if(cod=="static_analysis")
               theAnalysis= new StaticAnalysis(analysis_aggregation);
+            else if(cod=="linear_combination_analysis")
+              theAnalysis= new LinearCombinationAnalysis(analysis_aggregation);
             else if(cod=="variable_time_step_direct_integration_analysis")
               theAnalysis= new VariableTimeStepDirectIntegrationAnalysis(analysis_aggregation);
 	    else
@@ -634,6 +634,12 @@ bool XC::SolutionStrategy::alloc_system_of_equations(const std::string &nmb,Anal
       theSOE= new SymSparseLinSOE(this);
     else if(nmb=="umfpack_gen_lin_soe")
       theSOE= new UmfpackGenLinSOE(this);
+#ifdef USE_EIGEN
+    else if(nmb=="eigen_sparse_spd_lin_soe")
+      theSOE= new EigenSparseSPDLinSOE(this);
+#endif
+    else if(nmb=="csr_spd_lin_soe")
+      theSOE= new CsrSPDLinSOE(this);
     else if(nmb=="mumps_soe")
       theSOE= new MumpsSOE(this);
     else if(nmb=="mumps_parallel_soe")
@@ -74,7 +74,8 @@
 
 //! @brief Constructor
 XC::Linear::Linear(SolutionStrategy *owr)
-  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear) {}
+  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear),
+   factorOnce(false), tangentFormed(false), numTangentForms(0) {}
 
 XC::SolutionAlgorithm *XC::Linear::getCopy(void) const
   { return new Linear(*this); }
@@ -95,13 +96,18 @@ int XC::Linear::resuelve(void)
         return -5;
       }
 
-    if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+    if(!factorOnce || !tangentFormed)
       {
-        std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
-                  << "; WARNING the XC::Integrator"
-                  << " failed in formTangent()."
-	          << Color::def << std::endl;
-        return -1;
+        if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING the XC::Integrator"
+                      << " failed in formTangent()."
+                      << Color::def << std::endl;
+            return -1;
+          }
+        tangentFormed= true;
+        numTangentForms++;
       }
 
     if(theIncIntegrator->formUnbalance()<0) //Builds load vector.
@@ -159,6 +165,32 @@ int XC::Linear::solveCurrentStep(void)
     return resuelve();
   }
 
+//! @brief Called when the domain has changed, the tangent
+//! will be formed again in the next step.
+int XC::Linear::domainChanged(void)
+  {
+    tangentFormed= false;
+    return EquiSolnAlgo::domainChanged();
+  }
+
+//! @brief Return true if the tangent is formed only in the first step
+//! and after a change in the domain.
+bool XC::Linear::getFactorOnce(void) const
+  { return factorOnce; }
+
+//! @brief If true, form the tangent (and factor it) only in the first
+//! step and after a change in the domain; the next steps reuse the
+//! factorization of the system of equations.
+void XC::Linear::setFactorOnce(const bool &b)
+  {
+    factorOnce= b;
+    tangentFormed= false;
+  }
+
+//! @brief Return the number of times the tangent has been formed.
+size_t XC::Linear::getNumTangentForms(void) const
+  { return numTangentForms; }
+
 //! @brief Sets the convergence test to use in the analysis.
 int XC::Linear::setConvergenceTest(ConvergenceTest *theNewTest)
   { return 0; }
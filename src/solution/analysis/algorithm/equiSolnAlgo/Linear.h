@@ -93,8 +93,19 @@ namespace XC {
 //! \f$U = U_{a} + \Delta U\f$.
 //! To start the iteration \f$U_a = U_{trial}\f$, i.e. the current trial
 //! response quantities are chosen as approximate solution quantities.
+//!
+//! If factorOnce is true the tangent is formed (and factored by the
+//! solver) only in the first step and after a change in the domain,
+//! so the following steps reuse the factorization (see for example
+//! UmfpackGenLinSolver). This is only valid if the tangent doesn't
+//! change between steps: linear elements and materials, no element
+//! activation or deactivation and, in transient analyses, a constant
+//! time step.
 class Linear: public EquiSolnAlgo
   {
+    bool factorOnce; //!< if true, form the tangent only when the domain changes.
+    bool tangentFormed; //!< true if the tangent has been formed after the last domain change.
+    size_t numTangentForms; //!< number of times the tangent has been formed.
     int resuelve();
   protected:
     friend class SolutionStrategy;
@@ -105,6 +116,11 @@ class Linear: public EquiSolnAlgo
 
     int solveCurrentStep(void);
     int setConvergenceTest(ConvergenceTest *theNewTest);
+    int domainChanged(void);
+
+    bool getFactorOnce(void) const;
+    void setFactorOnce(const bool &);
+    size_t getNumTangentForms(void) const;
     
     virtual int sendSelf(Communicator &);
     virtual int recvSelf(const Communicator &);
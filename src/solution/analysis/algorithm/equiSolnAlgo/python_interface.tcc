@@ -35,7 +35,10 @@ class_<XC::KrylovNewton, bases<XC::EquiSolnAlgo>, boost::noncopyable >("KrylovNe
   .add_property("maxDimension", &XC::KrylovNewton::getMaxDimension, &XC::KrylovNewton::setMaxDimension,"max number of iterations until the tangent is reformed and the acceleration restarts (default = 3)")
   ;
 
-class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init);
+class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init)
+  .add_property("factorOnce", &XC::Linear::getFactorOnce, &XC::Linear::setFactorOnce,"if true, form and factor the tangent only in the first step and after a change in the domain (the tangent must not change between steps).")
+  .add_property("numTangentForms", &XC::Linear::getNumTangentForms,"return the number of times the tangent has been formed.")
+  ;
 
 class_<XC::NewtonBased, bases<XC::EquiSolnAlgo>, boost::noncopyable >("NewtonBased", no_init);
 
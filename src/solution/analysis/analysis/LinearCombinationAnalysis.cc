@@ -0,0 +1,286 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LinearCombinationAnalysis.cc
+
+#include "LinearCombinationAnalysis.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/system_of_eqn/linearSOE/LinearSOE.h"
+#include "solution/analysis/integrator/IncrementalIntegrator.h"
+#include "domain/domain/Domain.h"
+#include "domain/load/pattern/LoadPattern.h"
+#include "domain/load/pattern/LoadCombination.h"
+#include "domain/load/pattern/LoadCombinationGroup.h"
+#include "domain/load/pattern/MapLoadPatterns.h"
+#include "preprocessor/prep_handlers/LoadHandler.h"
+#include "utility/matrix/Vector.h"
+#include "utility/utils/misc_utils/colormod.h"
+
+
+//! @brief Constructor.
+XC::LinearCombinationAnalysis::LinearCombinationAnalysis(SolutionStrategy *analysis_aggregation)
+  : StaticAnalysis(analysis_aggregation), primaryColumns(),
+    primaryDisplacements(), primaryDomainStamp(-1) {}
+
+//! @brief Clears all object members (constraint handler, analysis model,...).
+void XC::LinearCombinationAnalysis::clearAll(void)
+  {
+    StaticAnalysis::clearAll();
+    clearPrimaryResponses();
+  }
+
+//! @brief Method invoked during the analysis to deal with domain
+//! changes. The primary responses are no longer valid.
+int XC::LinearCombinationAnalysis::domainChanged(void)
+  {
+    clearPrimaryResponses();
+    return StaticAnalysis::domainChanged();
+  }
+
+//! @brief Remove the computed primary responses.
+void XC::LinearCombinationAnalysis::clearPrimaryResponses(void)
+  {
+    primaryColumns.clear();
+    primaryDisplacements= Matrix();
+    primaryDomainStamp= -1;
+  }
+
+//! @brief Return true if the response for the load pattern
+//! argument is already computed.
+bool XC::LinearCombinationAnalysis::hasPrimaryResponse(const LoadPattern *lp) const
+  { return (primaryColumns.find(lp)!=primaryColumns.end()); }
+
+//! @brief Compute the right hand side of the system for the load
+//! pattern argument (with a partial safety factor equal to one) and
+//! stores it in the column col of the matrix argument.
+int XC::LinearCombinationAnalysis::compute_primary_rhs(LoadPattern &lp, Matrix &rhs, const int &col)
+  {
+    Domain *dom= getDomainPtr();
+    const double gammaF= lp.GammaF();
+    lp.setGammaF(1.0);
+    dom->addLoadPattern(&lp);
+    getAnalysisModelPtr()->applyLoadDomain(1.0);
+    const int retval= getIncrementalIntegratorPtr()->formUnbalance();
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; failed to compute the unbalance for load pattern: "
+		<< lp.getTag() << Color::def << std::endl;
+    else
+      {
+	const Vector &b= getLinearSOEPtr()->getB();
+	const int n= rhs.noRows();
+	for(int i= 0; i<n; i++)
+	  rhs(i,col)= b(i);
+      }
+    dom->removeLoadPattern(&lp);
+    lp.setGammaF(gammaF);
+    return retval;
+  }
+
+//! @brief Compute the displacements produced by each of the load
+//! patterns of the set argument.
+//!
+//! The stiffness matrix is assembled and factorized once at the
+//! initial state of the domain. The load patterns active in the domain
+//! are removed during the computation and added again at the end.
+int XC::LinearCombinationAnalysis::computePrimaryResponses(const std::set<LoadPattern *> &loadPatterns)
+  {
+    clearPrimaryResponses();
+    Domain *dom= getDomainPtr();
+    for(std::set<LoadPattern *>::const_iterator i= loadPatterns.begin(); i!=loadPatterns.end(); i++)
+      {
+	if((*i)->getNumSPs()>0)
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; load pattern: " << (*i)->getTag()
+		      << " has imposed displacements, which are not"
+		      << " supported by this analysis."
+		      << Color::def << std::endl;
+	    return -1;
+	  }
+      }
+
+    // Remove the active load patterns.
+    const std::map<int,LoadPattern *> activeLoadPatterns= dom->getConstraints().getLoadPatterns();
+    dom->removeAllLoadPatterns();
+    dom->revertToStart();
+
+    int retval= initialize();
+    if(retval<0)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; failed to initialize the analysis."
+		  << Color::def << std::endl;
+      }
+    else
+      {
+	// Assemble the stiffness matrix once.
+	retval= getIncrementalIntegratorPtr()->formTangent();
+	if(retval<0)
+	  std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		    << "; failed to form the tangent."
+		    << Color::def << std::endl;
+      }
+    if(retval>=0)
+      {
+	LinearSOE *soe= getLinearSOEPtr();
+	const int n= soe->getNumEqn();
+	Matrix rhs(n, loadPatterns.size());
+	std::map<const LoadPattern *, int> columns;
+	int col= 0;
+	for(std::set<LoadPattern *>::const_iterator i= loadPatterns.begin(); i!=loadPatterns.end(); i++, col++)
+	  {
+	    retval= compute_primary_rhs(**i, rhs, col);
+	    if(retval<0)
+	      break;
+	    columns[*i]= col;
+	  }
+	if(retval>=0)
+	  {
+	    // Solve all the load patterns with the same factorization.
+	    retval= soe->solveMultipleRHS(rhs, primaryDisplacements);
+	    if(retval<0)
+	      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+			<< "; failed to solve the system of equations."
+			<< Color::def << std::endl;
+	    else
+	      {
+		primaryColumns= columns;
+		primaryDomainStamp= domainStamp;
+	      }
+	  }
+      }
+
+    // Restore the domain.
+    dom->revertToStart();
+    for(std::map<int,LoadPattern *>::const_iterator i= activeLoadPatterns.begin(); i!=activeLoadPatterns.end(); i++)
+      dom->addLoadPattern(i->second);
+    if(retval<0)
+      clearPrimaryResponses();
+    return retval;
+  }
+
+//! @brief Compute the displacements produced by each of the load
+//! patterns that appear in the combinations of the group argument.
+int XC::LinearCombinationAnalysis::computePrimaryResponses(LoadCombinationGroup &combinations)
+  {
+    std::set<LoadPattern *> loadPatterns;
+    MapLoadPatterns &lPatterns= combinations.getLoadHandler()->getLoadPatterns();
+    for(LoadCombinationGroup::const_iterator i= combinations.begin(); i!=combinations.end(); i++)
+      {
+	const LoadCombination *comb= i->second;
+	for(LoadCombination::const_iterator j= comb->begin(); j!=comb->end(); j++)
+	  {
+	    const LoadPattern *clp= j->getLoadPattern();
+	    if(clp)
+	      {
+		LoadPattern *lp= lPatterns.findLoadPattern(clp->getTag());
+		if(lp)
+		  loadPatterns.insert(lp);
+	      }
+	  }
+      }
+    return computePrimaryResponses(loadPatterns);
+  }
+
+//! @brief Return the displacements (in the equation numbering) that
+//! correspond to the combination argument, obtained by superposition
+//! of the primary responses.
+XC::Vector XC::LinearCombinationAnalysis::getCombinationDisplacements(const LoadCombination &comb) const
+  {
+    const int n= primaryDisplacements.noRows();
+    Vector retval(n);
+    for(LoadCombination::const_iterator j= comb.begin(); j!=comb.end(); j++)
+      {
+	const LoadPattern *lp= j->getLoadPattern();
+	std::map<const LoadPattern *, int>::const_iterator k= primaryColumns.find(lp);
+	if(k==primaryColumns.end())
+	  {
+	    std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		      << "; response for load pattern: "
+		      << (lp ? lp->getTag() : -1)
+		      << " of combination: '" << comb.getName()
+		      << "' not computed yet."
+		      << Color::def << std::endl;
+	    return Vector();
+	  }
+	const int col= k->second;
+	const double factor= j->getFactor();
+	for(int i= 0; i<n; i++)
+	  retval(i)+= factor*primaryDisplacements(i,col);
+      }
+    return retval;
+  }
+
+//! @brief Obtain the response of the model under the combination
+//! argument by superposition of the primary responses.
+//!
+//! The combination must be already added to the domain (so the
+//! element loads are taken into account when the element internal
+//! forces are computed). The domain is updated with the combination
+//! displacements and then committed.
+int XC::LinearCombinationAnalysis::solveComb(const LoadCombination &comb)
+  {
+    Domain *dom= getDomainPtr();
+    if(primaryColumns.empty())
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; primary responses not computed yet."
+		  << Color::def << std::endl;
+	return -1;
+      }
+    if(dom->hasDomainChanged()!=primaryDomainStamp)
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; the domain has changed since the primary responses"
+		  << " were computed."
+		  << Color::def << std::endl;
+	return -1;
+      }
+    if(!comb.isActive())
+      {
+	std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		  << "; combination: '" << comb.getName()
+		  << "' is not added to the domain."
+		  << Color::def << std::endl;
+	return -1;
+      }
+    const Vector u= getCombinationDisplacements(comb);
+    if(u.Size()!=primaryDisplacements.noRows())
+      return -1;
+    AnalysisModel *am= getAnalysisModelPtr();
+    am->applyLoadDomain(1.0);
+    am->setDisp(u);
+    int retval= am->updateDomain();
+    if(retval==0)
+      retval= am->commitDomain();
+    if(retval<0)
+      std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+		<< "; failed to update the domain for combination: '"
+		<< comb.getName() << "'."
+		<< Color::def << std::endl;
+    return retval;
+  }
@@ -0,0 +1,96 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//LinearCombinationAnalysis.h
+                                                                        
+                                                                        
+#ifndef LinearCombinationAnalysis_h
+#define LinearCombinationAnalysis_h
+
+
+// Description: This file contains the interface for the
+// LinearCombinationAnalysis class. LinearCombinationAnalysis is a subclass
+// of StaticAnalysis, it is used to obtain the response of a linear
+// FE\_Model under many load combinations using only one factorization
+// of the stiffness matrix.
+
+#include <solution/analysis/analysis/StaticAnalysis.h>
+#include "utility/matrix/Matrix.h"
+#include <map>
+#include <set>
+
+namespace XC {
+class LoadPattern;
+class LoadCombination;
+class LoadCombinationGroup;
+class Vector;
+
+//! @ingroup AnalysisType
+//
+//! @brief Static analysis of load combinations by linear superposition.
+//!
+//! The stiffness matrix is assembled and factorized once and the
+//! displacements produced by each of the load patterns that appear in
+//! the combinations (primary responses) are obtained as a multiple right
+//! hand side solution. The displacements of each combination are then
+//! obtained by superposition (using the combination factors) and the
+//! element internal forces are recovered from them by updating the
+//! element state, so no new factorization is needed for each
+//! combination. The results are valid only for linear models.
+class LinearCombinationAnalysis: public StaticAnalysis
+  {
+  private:
+    std::map<const LoadPattern *, int> primaryColumns; //!< column of each load pattern in primaryDisplacements.
+    Matrix primaryDisplacements; //!< displacements (one column per load pattern).
+    int primaryDomainStamp; //!< domain stamp when the primary responses were computed.
+
+    int compute_primary_rhs(LoadPattern &, Matrix &, const int &);
+  protected:
+    friend class SolutionProcedure;
+    LinearCombinationAnalysis(SolutionStrategy *);
+    Analysis *getCopy(void) const;
+  public:
+    void clearAll(void);
+    int domainChanged(void);
+
+    int computePrimaryResponses(const std::set<LoadPattern *> &);
+    int computePrimaryResponses(LoadCombinationGroup &);
+    void clearPrimaryResponses(void);
+    //! @brief Return the number of primary responses computed.
+    inline size_t getNumPrimaryResponses(void) const
+      { return primaryColumns.size(); }
+    bool hasPrimaryResponse(const LoadPattern *) const;
+    
+    Vector getCombinationDisplacements(const LoadCombination &) const;
+    int solveComb(const LoadCombination &);
+  };
+
+//! @brief Virtual constructor.
+inline Analysis *LinearCombinationAnalysis::getCopy(void) const
+  { return new LinearCombinationAnalysis(*this); }
+} // end of XC namespace
+
+#endif
@@ -77,7 +77,8 @@ const std::string stepNumberMessage= "In a static analysis, a number of steps gr
 
 //! @brief Constructor.
 XC::StaticAnalysis::StaticAnalysis(SolutionStrategy *analysis_aggregation)
-  :Analysis(analysis_aggregation), domainStamp(0)
+  :Analysis(analysis_aggregation), domainStamp(0), topologyStamp(-1),
+   incrementalSetup(false), numFullSetups(0), numIncrementalSetups(0)
   {
     // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -364,10 +365,26 @@ int XC::StaticAnalysis::initialize(void)
 //! Returns \f$0\f$ if successful. At any stage above, if an error occurs the
 //! method is stopped, a warning message is printed and a negative number
 //! is returned.
+//!
+//! If the incremental setup is enabled and the only changes of the
+//! domain since the last call affect its single freedom constraints
+//! (i.e. the nodes locked or released by the construction stages),
+//! the analysis model is updated through update\_sp\_constraints()
+//! instead.
 int XC::StaticAnalysis::domainChanged(void)
   {
     Domain *the_Domain= this->getDomainPtr();
     domainStamp= the_Domain->hasDomainChanged();
+    const int topology= the_Domain->getCurrentTopologyTag();
+    if(incrementalSetup && (topology==topologyStamp))
+      {
+        if(update_sp_constraints()==0)
+          {
+            numIncrementalSetups++;
+            return 0;
+          }
+      }
+    topologyStamp= topology;
 
     getAnalysisModelPtr()->clearAll();
     getConstraintHandlerPtr()->clearAll();
@@ -419,6 +436,7 @@ int XC::StaticAnalysis::domainChanged(void)
 		  << Color::def << std::endl;
         return -4;
       }
+    numFullSetups++;
 
     // finally we invoke domainChanged on the Integrator and Algorithm
     // objects .. informing them that the model has changed
@@ -445,6 +463,65 @@ int XC::StaticAnalysis::domainChanged(void)
     return 0;
   }
 
+//! @brief Update the analysis model after a change of the domain
+//! that affects only its single freedom constraints.
+//!
+//! Asks the constraint handler to update its FE\_Elements
+//! keeping the DOF numbering; if it can, the numberer and the
+//! setSize() call on the system of equations are skipped
+//! (the sparsity pattern doesn't change) and domainChanged() is
+//! invoked on the integrator and the algorithm. Returns \f$0\f$
+//! if successful, otherwise the analysis model must be built from scratch.
+int XC::StaticAnalysis::update_sp_constraints(void)
+  {
+    int result= getConstraintHandlerPtr()->handleSFreedomChanges();
+    if(result==0)
+      {
+        result= getStaticIntegratorPtr()->domainChanged();
+        if(result < 0)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; Integrator::domainChanged() failed."
+                      << Color::def << std::endl;
+            return -5;
+          }
+        result= getEquiSolutionAlgorithmPtr()->domainChanged();
+        if(result < 0)
+          {
+            std::cerr << Color::red << getClassName() << "::" << __FUNCTION__
+                      << "; Algorithm::domainChanged() failed."
+                      << Color::def << std::endl;
+            return -6;
+          }
+      }
+    return result;
+  }
+
+//! @brief Return true if the DOF numbering and the size of the system of
+//! equations are reused when only the single freedom constraints
+//! of the domain change (see update\_sp\_constraints()).
+bool XC::StaticAnalysis::getIncrementalSetup(void) const
+  { return incrementalSetup; }
+
+//! @brief Enable or disable the reuse of the DOF numbering and the
+//! size of the system of equations when only the single freedom
+//! constraints of the domain change (i.e. when the construction stages
+//! lock or release the nodes of the deactivated elements).
+void XC::StaticAnalysis::setIncrementalSetup(const bool &b)
+  { incrementalSetup= b; }
+
+//! @brief Return the number of times the analysis model has been built
+//! from scratch (DOF numbering and sizing of the system of equations).
+size_t XC::StaticAnalysis::getNumFullSetups(void) const
+  { return numFullSetups; }
+
+//! @brief Return the number of times the analysis model has been updated
+//! keeping the DOF numbering and the size of the system of equations
+//! (see update\_sp\_constraints()).
+size_t XC::StaticAnalysis::getNumIncrementalSetups(void) const
+  { return numIncrementalSetups; }
+
+
 // AddingSensitivity:BEGIN //////////////////////////////
 #ifdef _RELIABILITY
 int XC::StaticAnalysis::setSensitivityAlgorithm(SensitivityAlgorithm *passedSensitivityAlgorithm)
@@ -466,6 +543,7 @@ int XC::StaticAnalysis::setNumberer(DOF_Numberer &theNewNumberer)
     Analysis::setNumberer(theNewNumberer);
     // invoke domainChanged() either indirectly or directly
     domainStamp= 0;
+    topologyStamp= -1; // build the model from scratch.
     return 0;
   }
 
@@ -481,6 +559,7 @@ int XC::StaticAnalysis::setAlgorithm(EquiSolnAlgo &theNewAlgorithm)
 
     // invoke domainChanged() either indirectly or directly
     domainStamp= 0; // cause domainChanged to be invoked on next analyze
+    topologyStamp= -1; // build the model from scratch.
     return 0;
   }
 
@@ -493,6 +572,7 @@ int XC::StaticAnalysis::setIntegrator(StaticIntegrator &theNewIntegrator)
   {
     Analysis::setIntegrator(theNewIntegrator);
     domainStamp= 0; // cause domainChanged to be invoked on next analyze
+    topologyStamp= -1; // build the model from scratch.
     return 0;
   }
 
@@ -506,6 +586,7 @@ int XC::StaticAnalysis::setLinearSOE(LinearSOE &theNewSOE)
     // invoke the destructor on the old one
     Analysis::setLinearSOE(theNewSOE);
     domainStamp= 0; // cause domainChanged to be invoked on next analyze
+    topologyStamp= -1; // build the model from scratch.
     return 0;
   }
 
@@ -80,6 +80,10 @@ class StaticAnalysis: public Analysis
   {
   protected:
     int domainStamp;
+    int topologyStamp; //!< topology tag of the domain when the model was built.
+    bool incrementalSetup; //!< if true, reuse the DOF numbering when only the SPs change.
+    size_t numFullSetups; //!< number of times the DOFs have been numbered and the SOE sized.
+    size_t numIncrementalSetups; //!< number of times only the single freedom constraints have been updated.
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -94,6 +98,7 @@ class StaticAnalysis: public Analysis
     int compute_sensitivities_step(int num_step);
     int commit_step(int num_step);
     int run_analysis_step(int num_step,int numSteps);
+    int update_sp_constraints(void);
 
     friend class SolutionProcedure;
     StaticAnalysis(SolutionStrategy *analysis_aggregation);
@@ -116,6 +121,11 @@ class StaticAnalysis: public Analysis
 
     ConvergenceTest *getConvergenceTest(void);
 
+    bool getIncrementalSetup(void) const;
+    void setIncrementalSetup(const bool &);
+    size_t getNumFullSetups(void) const;
+    size_t getNumIncrementalSetups(void) const;
+
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
     int setSensitivityAlgorithm(SensitivityAlgorithm *theSensitivityAlgorithm);
@@ -33,6 +33,9 @@ class_<XC::Analysis, XC::Analysis *, bases<CommandEntity>, boost::noncopyable >(
 class_<XC::StaticAnalysis, bases<XC::Analysis>, boost::noncopyable >("StaticAnalysis", no_init)
   .def("analyze", &XC::StaticAnalysis::analyze,"Performs the analysis. A number of steps greater than 1 is useless if the loads are constant.")
   .def("initialize", &XC::StaticAnalysis::initialize,"Initialize analysis.")
+  .add_property("incrementalSetup", &XC::StaticAnalysis::getIncrementalSetup, &XC::StaticAnalysis::setIncrementalSetup,"if true, the DOF numbering and the size of the system of equations are reused when only the single freedom constraints change (construction stages with the penalty constraint handler).")
+  .add_property("numFullSetups", &XC::StaticAnalysis::getNumFullSetups,"number of times the DOFs have been numbered and the system of equations sized.")
+  .add_property("numIncrementalSetups", &XC::StaticAnalysis::getNumIncrementalSetups,"number of times only the single freedom constraints have been updated, keeping the DOF numbering and the size of the system of equations.")
     ;
 
 class_<XC::EigenAnalysis , bases<XC::Analysis>, boost::noncopyable >("EigenAnalysis", no_init)
@@ -94,6 +97,16 @@ class_<XC::LinearBucklingAnalysis, bases<XC::StaticAnalysis>, boost::noncopyable
   .add_property("eigenAnalysis", make_function( getLinearBucklingEigenAnalysis, return_internal_reference<>() ),"return a reference to the internal eigenanalysis object.")
   ;
 
+int (XC::LinearCombinationAnalysis::*computePrimaryResponsesGroup)(XC::LoadCombinationGroup &)= &XC::LinearCombinationAnalysis::computePrimaryResponses;
+class_<XC::LinearCombinationAnalysis, bases<XC::StaticAnalysis>, boost::noncopyable >("LinearCombinationAnalysis", no_init)
+  .def("computePrimaryResponses", computePrimaryResponsesGroup, "computePrimaryResponses(combinations): compute the displacements produced by each of the load patterns of the given load combinations using only one factorization of the stiffness matrix.")
+  .def("clearPrimaryResponses", &XC::LinearCombinationAnalysis::clearPrimaryResponses, "Remove the computed primary responses.")
+  .add_property("numPrimaryResponses", &XC::LinearCombinationAnalysis::getNumPrimaryResponses, "Return the number of primary responses computed.")
+  .def("hasPrimaryResponse", &XC::LinearCombinationAnalysis::hasPrimaryResponse, "hasPrimaryResponse(loadPattern): return true if the response for the given load pattern has been computed.")
+  .def("getCombinationDisplacements", &XC::LinearCombinationAnalysis::getCombinationDisplacements, "getCombinationDisplacements(comb): return the displacement vector (equation numbering) of the given combination.")
+  .def("solveComb", &XC::LinearCombinationAnalysis::solveComb, "solveComb(comb): update the model with the response of the given combination (which must be added to the domain) obtained by superposition of the primary responses.")
+  ;
+
 class_<XC::IllConditioningAnalysis, bases<XC::EigenAnalysis>, boost::noncopyable >("IllConditioningAnalysis", no_init)
   .def("getEigenvalue", make_function(&XC::IllConditioningAnalysis::getEigenvalue, return_value_policy<copy_const_reference>()) )
   ;
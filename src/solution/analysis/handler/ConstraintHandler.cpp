@@ -83,6 +83,18 @@ int XC::ConstraintHandler::doneNumberingDOF(void)
     return 0;
   }
 
+//! @brief Update the FE\_Element and DOF\_Group objects after a
+//! change that affects only the single freedom constraints of the domain,
+//! keeping the DOF numbering.
+//!
+//! Returns \f$0\f$ if the analysis model has been updated. A non-zero
+//! value means that the analysis model must be built again from
+//! scratch (handle(), numbering of the DOFs,...). This default
+//! implementation returns \f$-1\f$, since the handlers that use the single
+//! freedom constraints to number the DOFs can't keep the numbering.
+int XC::ConstraintHandler::handleSFreedomChanges(void)
+  { return -1; }
+
 //! @brief Update the state of the constraints.
 int XC::ConstraintHandler::update(void)
   { return 0; }
@@ -135,6 +135,7 @@ class ConstraintHandler: public MovableObject, public CommandEntity
     //! is responsible for setting the FE\_Element by calling {\em
     //! setFE\_elementPtr}.    
     virtual int handle(const ID *nodesNumberedLast =0) =0;
+    virtual int handleSFreedomChanges(void);
     virtual int update(void);
     virtual int applyLoad(void);
     virtual int doneNumberingDOF(void);
@@ -56,6 +56,7 @@
 
 #include <solution/analysis/handler/PenaltyConstraintHandler.h>
 #include <cstdlib>
+#include <deque>
 #include <solution/analysis/model/AnalysisModel.h>
 #include <domain/domain/Domain.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
@@ -76,6 +77,7 @@
 #include <solution/analysis/model/fe_ele/penalty/PenaltySFreedom_FE.h>
 #include <solution/analysis/model/fe_ele/penalty/PenaltyMFreedom_FE.h>
 #include <solution/analysis/model/fe_ele/penalty/PenaltyMRMFreedom_FE.h>
+#include <solution/analysis/model/FE_EleIter.h>
 
 
 //! @brief Constructor.
@@ -225,4 +227,63 @@ int XC::PenaltyConstraintHandler::handle(const ID *nodesLast)
     return count3;
   }
 
+//! @brief Update the analysis model after a change that affects only
+//! the single freedom constraints of the domain.
+//!
+//! The penalty method doesn't use the single freedom constraints to
+//! number the DOFs, so the DOF\_Groups, their equation numbers and the
+//! FE\_Elements of the elements and the multi-freedom constraints remain
+//! valid. Only the PenaltySFreedom\_FE objects are replaced by new ones,
+//! whose IDs are set from the existing numbering. Each of them is
+//! connected to a single DOF so the sparsity pattern of the system
+//! of equations doesn't change either. Returns \f$0\f$ if successful, 
+//! a negative value if the analysis model must be built from scratch.
+int XC::PenaltyConstraintHandler::handleSFreedomChanges(void)
+  {
+    Domain *theDomain = this->getDomainPtr();
+    AnalysisModel *theModel = this->getAnalysisModelPtr();
+    if((!theDomain) || (!theModel))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; domain or model was not set.\n";
+        return -1;
+      }
+    if(theModel->getNumDOF_Groups()==0) // not handled yet.
+      return -2;
 
+    // remove the current PenaltySFreedom_FE objects, keeping
+    // their tags to reuse them.
+    std::deque<int> freeTags;
+    int nextTag= 0;
+    FE_EleIter &theFEs= theModel->getFEs();
+    FE_Element *fePtr= nullptr;
+    while((fePtr = theFEs()) != nullptr)
+      {
+        const int tag= fePtr->getTag();
+        if(dynamic_cast<PenaltySFreedom_FE *>(fePtr))
+          freeTags.push_back(tag);
+        nextTag= std::max(nextTag,tag+1);
+      }
+    for(std::deque<int>::const_iterator i= freeTags.begin();i!=freeTags.end();i++)
+      theModel->removeFE_Element(*i);
+
+    // create the PenaltySFreedom_FE for the current SFreedom_Constraints.
+    SFreedom_ConstraintIter &theSPs = theDomain->getConstraints().getDomainAndLoadPatternSPs();
+    SFreedom_Constraint *spPtr= nullptr;
+    while((spPtr = theSPs()) != nullptr)
+      {
+        int tag= nextTag;
+        if(!freeTags.empty())
+          {
+            tag= freeTags.front();
+            freeTags.pop_front();
+          }
+        else
+          nextTag++;
+        fePtr= theModel->createPenaltySFreedom_FE(tag, *spPtr, alphaSP);
+        if(!fePtr)
+          return -3;
+        fePtr->setID();
+      }
+    return 0;
+  }
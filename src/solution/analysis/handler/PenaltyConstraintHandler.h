@@ -92,6 +92,7 @@ class PenaltyConstraintHandler: public FactorsConstraintHandler
     ConstraintHandler *getCopy(void) const;
   public:
     int handle(const ID *nodesNumberedLast =0);
+    int handleSFreedomChanges(void);
   };
 } // end of XC namespace
 
@@ -65,13 +65,18 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include <utility/matrix/Matrix.h>
+#include <algorithm>
 
+//! @brief Offset value for the FE_Elements whose contribution
+//! is computed during the (serial) assembly.
+static const size_t serialContribution= static_cast<size_t>(-1);
 
 //! @brief Constructor.
 //!
 //! @param owr: set of objects used to perform the analysis.
 XC::IncrementalIntegrator::IncrementalIntegrator(SolutionStrategy *owr,int classTag)
-  : Integrator(owr,classTag), statusFlag(CURRENT_TANGENT) {}
+  : Integrator(owr,classTag), numThreads(1), statusFlag(CURRENT_TANGENT) {}
 
 //! @brief Get the value of the flag to compute the tangent stiffness: CURRENT_TANGENT: 0; INITIAL_TANGENT: 1; CURRENT_SECANT: 2; INITIAL_THEN_CURRENT_TANGENT: 3; NO_TANGENT: 4; SECOND_TANGENT: 5; HALL_TANGENT: 6
 int XC::IncrementalIntegrator::getTangFlag(void) const
@@ -81,6 +86,36 @@ int XC::IncrementalIntegrator::getTangFlag(void) const
 void XC::IncrementalIntegrator::setTangFlag(const int &i)
   { statusFlag= i; }
 
+//! @brief Return the number of threads used to compute the element
+//! tangents and residuals.
+int XC::IncrementalIntegrator::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Set the number of threads used to compute the element
+//! tangents and residuals.
+//!
+//! If the number of threads is greater than one, the tangents (or the
+//! residuals) of the FE_Elements that allow it (see
+//! FE_Element::allowsConcurrentStateDetermination) are computed
+//! concurrently and stored in a buffer. Then they are added to the system
+//! of equations by the calling thread following the same order used in the
+//! serial assembly, so the results do not depend on the number of
+//! threads. The state determination of the elements and its materials
+//! must be reentrant (no writing on class-wide work areas) to use this
+//! option.
+void XC::IncrementalIntegrator::setNumThreads(const int &n)
+  {
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING number of threads must be at least one."
+		  << " Using one thread." << std::endl;
+	numThreads= 1;
+      }
+    else
+      numThreads= n;
+  }
+
 //! @brief Builds tangent stiffness matrix.
 //!
 //! Invoked to form the structure tangent matrix. The method first loops
@@ -116,6 +151,9 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
       }
 
     theSOE->zeroA(); //Zeroes the matrix elements.
+
+    if(numThreads>1)
+      return formTangentConcurrently(*mdl, *theSOE);
     
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
@@ -358,6 +396,9 @@ int XC::IncrementalIntegrator::formElementResidual(void)
 
     LinearSOE *theSOE= getLinearSOEPtr();
     AnalysisModel *mdl= getAnalysisModelPtr();
+    if(numThreads>1)
+      return formElementResidualConcurrently(*mdl, *theSOE);
+    
     FE_EleIter &theEles2 = mdl->getFEs();
     while((elePtr= theEles2()) != nullptr)
       {
@@ -373,6 +414,133 @@ int XC::IncrementalIntegrator::formElementResidual(void)
     return res;	    
   }
 
+//! @brief Collects the FE_Elements of the model in assembly order
+//! and computes the position of its contributions in the assembly buffer.
+//!
+//! @param mdl: analysis model.
+//! @param tangent: if true compute the positions of the tangent matrices,
+//!                 otherwise compute the positions of the residual vectors.
+//! @return size of the buffer.
+size_t XC::IncrementalIntegrator::setupConcurrentAssembly(AnalysisModel &mdl, bool tangent)
+  {
+    theFEs.clear();
+    theOffsets.clear();
+    size_t retval= 0;
+    FE_Element *elePtr= nullptr;
+    FE_EleIter &theEles= mdl.getFEs();
+    while((elePtr= theEles()) != nullptr)
+      {
+	theFEs.push_back(elePtr);
+	if(elePtr->allowsConcurrentStateDetermination())
+	  {
+	    theOffsets.push_back(retval);
+	    const size_t n= elePtr->getID().Size();
+	    retval+= (tangent ? n*n : n);
+	  }
+	else
+	  theOffsets.push_back(serialContribution);
+      }
+    assemblyBuffer.resize(retval);
+    return retval;
+  }
+
+//! @brief Builds the tangent stiffness matrix using numThreads threads
+//! (see setNumThreads).
+int XC::IncrementalIntegrator::formTangentConcurrently(AnalysisModel &mdl, LinearSOE &theSOE)
+  {
+    int result= 0;
+    setupConcurrentAssembly(mdl, true);
+    const long numFEs= theFEs.size();
+    double *buffer= assemblyBuffer.data();
+
+    // compute the element tangents.
+#pragma omp parallel for schedule(static) num_threads(numThreads)
+    for(long i= 0;i<numFEs;i++)
+      {
+	const size_t offset= theOffsets[i];
+	if(offset!=serialContribution)
+	  {
+	    const Matrix &K= theFEs[i]->getTangent(this);
+	    const double *K_data= K.getDataPtr();
+	    std::copy(K_data, K_data+K.getDataSize(), buffer+offset);
+	  }
+      }
+
+    // add them to the system of equations following the
+    // iteration order.
+    for(long i= 0;i<numFEs;i++)
+      {
+	FE_Element *elePtr= theFEs[i];
+	const ID &id= elePtr->getID();
+	const size_t offset= theOffsets[i];
+	int ok= 0;
+	if(offset!=serialContribution)
+	  {
+	    const int n= id.Size();
+	    const Matrix K(buffer+offset, n, n);
+	    ok= theSOE.addA(K,id);
+	  }
+	else
+	  ok= theSOE.addA(elePtr->getTangent(this),id);
+	if(ok<0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	  	      << "; WARNING failed in addA for ID "
+		      << id;
+	    result = -3;
+	  }
+      }
+    return result;
+  }
+
+//! @brief Builds the unbalanced load vector of the elements using
+//! numThreads threads (see setNumThreads).
+int XC::IncrementalIntegrator::formElementResidualConcurrently(AnalysisModel &mdl, LinearSOE &theSOE)
+  {
+    int res= 0;
+    setupConcurrentAssembly(mdl, false);
+    const long numFEs= theFEs.size();
+    double *buffer= assemblyBuffer.data();
+
+    // compute the element residuals.
+#pragma omp parallel for schedule(static) num_threads(numThreads)
+    for(long i= 0;i<numFEs;i++)
+      {
+	const size_t offset= theOffsets[i];
+	if(offset!=serialContribution)
+	  {
+	    const Vector &R= theFEs[i]->getResidual(this);
+	    const double *R_data= R.getDataPtr();
+	    std::copy(R_data, R_data+R.Size(), buffer+offset);
+	  }
+      }
+
+    // add them to the system of equations following the
+    // iteration order.
+    for(long i= 0;i<numFEs;i++)
+      {
+	FE_Element *elePtr= theFEs[i];
+	const ID &id= elePtr->getID();
+	const size_t offset= theOffsets[i];
+	int ok= 0;
+	if(offset!=serialContribution)
+	  {
+	    const Vector R(buffer+offset, id.Size());
+	    ok= theSOE.addB(R,id);
+	  }
+	else
+	  ok= theSOE.addB(elePtr->getResidual(this),id);
+	if(ok<0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING failed in addB for ID: "
+		      << id;
+	    res = -2;
+	  }
+      }
+    return res;
+  }
+
 //! @brief Function related to modal damping (not implemented yet).
 double XC::IncrementalIntegrator::getCFactor(void)
   { return 0; }
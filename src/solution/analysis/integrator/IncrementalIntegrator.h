@@ -67,6 +67,7 @@
 // What: "@(#) IncrementalIntegrator.h, revA"
 
 #include <solution/analysis/integrator/Integrator.h>
+#include <vector>
 
 namespace XC {
 class LinearSOE;
@@ -99,6 +100,15 @@ class Vector;
 //! some function of the solution to the linear system of equations.
 class IncrementalIntegrator: public Integrator
   {
+  private:
+    int numThreads; //!< number of threads used to compute the element contributions.
+    std::vector<FE_Element *> theFEs; //!< FE_Elements in assembly order (concurrent assembly).
+    std::vector<size_t> theOffsets; //!< position of each FE_Element contribution in the assembly buffer.
+    std::vector<double> assemblyBuffer; //!< element contributions computed concurrently.
+
+    size_t setupConcurrentAssembly(AnalysisModel &, bool);
+    int formTangentConcurrently(AnalysisModel &, LinearSOE &);
+    int formElementResidualConcurrently(AnalysisModel &, LinearSOE &);
   protected:
     double iFactor;
     double cFactor;
@@ -122,6 +132,8 @@ class IncrementalIntegrator: public Integrator
 
     int getTangFlag(void) const;
     void setTangFlag(const int &);
+    int getNumThreads(void) const;
+    void setNumThreads(const int &);
 
     // pure virtual methods to define the FE_ELe and DOF_Group contributions
     //! @brief To inform the FE\_Element how to build its tangent matrix for
@@ -29,6 +29,7 @@ class_<XC::EigenIntegrator, bases<XC::Integrator>, boost::noncopyable >("EigenIn
 
 class_<XC::IncrementalIntegrator, bases<XC::Integrator>, boost::noncopyable >("IncrementalIntegrator", no_init)
   .add_property("tangFlag",&XC::IncrementalIntegrator::getTangFlag,&XC::IncrementalIntegrator::setTangFlag,"Get/set the value of the flag to compute the tangent stiffness: CURRENT_TANGENT: 0; INITIAL_TANGENT: 1; CURRENT_SECANT: 2; INITIAL_THEN_CURRENT_TANGENT: 3; NO_TANGENT: 4; SECOND_TANGENT: 5; HALL_TANGENT: 6")
+  .add_property("numThreads",&XC::IncrementalIntegrator::getNumThreads,&XC::IncrementalIntegrator::setNumThreads,"Get/set the number of threads used to compute the element tangents and residuals (1: serial assembly).")
   ;
 
 class_<XC::StaticIntegrator, bases<XC::IncrementalIntegrator>, boost::noncopyable >("StaticIntegrator", no_init);
@@ -69,6 +69,7 @@
 #include "solution/analysis/ModelWrapper.h"
 #include <utility/tagged/storage/ArrayOfTaggedObjects.h>
 #include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include <solution/analysis/model/fe_ele/lagrange/LagrangeSFreedom_FE.h>
 #include <solution/analysis/model/fe_ele/lagrange/LagrangeMFreedom_FE.h>
@@ -132,6 +133,8 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
     numEqn= other.numEqn;
     theFEs= other.theFEs;
     theDOFGroups= other.theDOFGroups;
+    nodalStateMap.clear();
+    unmappedDOF_Groups.clear();
     myDOFGraph= DOF_Graph(*this);
     myGroupGraph= DOF_GroupGraph(*this);
     updateGraphs= false; //Update just finished
@@ -502,6 +505,21 @@ XC::TransformationDOF_Group *XC::AnalysisModel::createTransformationDOF_Group(co
     return dofPtr;
   }
 
+//! @brief Removes from the model (and deletes) the FE\_Element
+//! identified by the argument.
+//!
+//! @param tag: identifier of the FE\_Element to remove.
+bool XC::AnalysisModel::removeFE_Element(int tag)
+  {
+    const bool retval= theFEs.removeComponent(tag);
+    if(retval)
+      {
+        numFE_Ele--;
+        updateGraphs= true;
+      }
+    return retval;
+  }
+
 //! Clears from the model all FE\_Element and DOF\_Group objects.
 //! 
 //! Clears from the model all FE\_Element and DOF\_Group objects that have
@@ -519,6 +537,8 @@ void XC::AnalysisModel::clearAll(void)
     numDOF_Grp= 0;
     numEqn= 0;    
     updateGraphs= true;
+    nodalStateMap.clear();
+    unmappedDOF_Groups.clear();
   }
 
 
@@ -588,7 +608,11 @@ XC::DOF_GrpConstIter &XC::AnalysisModel::getConstDOFs() const
 //! @brief Sets the value of the number of equations in the model.
 //! Invoked by the DOF\_Numberer when it is numbering the dofs.
 void XC::AnalysisModel::setNumEqn(int theNumEqn)
-  { numEqn= theNumEqn; }
+  {
+    numEqn= theNumEqn;
+    nodalStateMap.clear(); // equation numbers have changed.
+    unmappedDOF_Groups.clear();
+  }
 
 //! @brief Returns the number of DOFs in the model which have been assigned
 //! an equation number.
@@ -653,6 +677,49 @@ const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
     return myGroupGraph;
   }
 
+//! @brief Build the map between the equations and the nodal state
+//! arena values. The DOF groups whose node is not stored in the arena
+//! or whose response is not taken directly from the equations
+//! (transformation and Lagrange DOF groups) are stored in
+//! unmappedDOF_Groups.
+void XC::AnalysisModel::build_nodal_state_map(NodalStateArena &arena)
+  {
+    nodalStateMap.setArena(arena);
+    unmappedDOF_Groups.clear();
+    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+    DOF_Group *dofPtr= nullptr;
+    while((dofPtr= theDOFGrps()) != nullptr)
+      {
+        bool mapped= false;
+        if(dofPtr->setsNodeResponseDirectly())
+          mapped= nodalStateMap.addNode(*dofPtr->myNode, dofPtr->getID());
+        if(!mapped)
+          unmappedDOF_Groups.push_back(dofPtr);
+      }
+  }
+
+//! @brief Return true if the nodal displacements, velocities and
+//! accelerations are stored in the mesh nodal state arena, so they
+//! can be set in a single loop over the DOFs (see setDisp). Rebuilds
+//! the map between equations and arena values if needed.
+bool XC::AnalysisModel::use_nodal_state_arena(void)
+  {
+    bool retval= false;
+    ModelWrapper *sm= getModelWrapper();
+    Domain *theDomain= (sm ? sm->getDomainPtr() : nullptr);
+    if(theDomain)
+      {
+        NodalStateArena &arena= theDomain->getMesh().getNodalState();
+        if(arena.isEnabled())
+          {
+            if(!nodalStateMap.isUpToDate(arena))
+              build_nodal_state_map(arena);
+            retval= true;
+          }
+      }
+    return retval;
+  }
+
 //! @brief Sets the values of the displacement, velocity and acceleration of
 //! the nodes.
 //! 
@@ -662,13 +729,28 @@ const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
 //! iter.
 void XC::AnalysisModel::setResponse(const Vector &disp, const Vector &vel, const Vector &accel)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while((dofPtr= theDOFGrps()) != 0)
+    if(use_nodal_state_arena())
       {
-        dofPtr->setNodeDisp(disp);
-        dofPtr->setNodeVel(vel);
-        dofPtr->setNodeAccel(accel);        
+        nodalStateMap.setDisp(disp);
+        nodalStateMap.setVel(vel);
+        nodalStateMap.setAccel(accel);
+        for(std::vector<DOF_Group *>::iterator i= unmappedDOF_Groups.begin();i!=unmappedDOF_Groups.end();i++)
+          {
+            (*i)->setNodeDisp(disp);
+            (*i)->setNodeVel(vel);
+            (*i)->setNodeAccel(accel);
+          }
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFGrps()) != 0)
+          {
+            dofPtr->setNodeDisp(disp);
+            dofPtr->setNodeVel(vel);
+            dofPtr->setNodeAccel(accel);        
+          }
       }
   }
         
@@ -680,10 +762,19 @@ void XC::AnalysisModel::setResponse(const Vector &disp, const Vector &vel, const
 //! setNodeDisp(disp)} on each DOF\_Group.
 void XC::AnalysisModel::setDisp(const Vector &disp)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while ((dofPtr= theDOFGrps()) != 0) 
-        dofPtr->setNodeDisp(disp);
+    if(use_nodal_state_arena())
+      {
+        nodalStateMap.setDisp(disp);
+        for(std::vector<DOF_Group *>::iterator i= unmappedDOF_Groups.begin();i!=unmappedDOF_Groups.end();i++)
+          (*i)->setNodeDisp(disp);
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while ((dofPtr= theDOFGrps()) != 0) 
+            dofPtr->setNodeDisp(disp);
+      }
   }        
         
 //! @brief Sets the values of the velocity of the nodes.
@@ -694,10 +785,19 @@ void XC::AnalysisModel::setDisp(const Vector &disp)
 //! setNodeVel(vel)} on each DOF\_Group.
 void XC::AnalysisModel::setVel(const Vector &vel)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while ((dofPtr= theDOFGrps()) != 0) 
-        dofPtr->setNodeVel(vel);
+    if(use_nodal_state_arena())
+      {
+        nodalStateMap.setVel(vel);
+        for(std::vector<DOF_Group *>::iterator i= unmappedDOF_Groups.begin();i!=unmappedDOF_Groups.end();i++)
+          (*i)->setNodeVel(vel);
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while ((dofPtr= theDOFGrps()) != 0) 
+            dofPtr->setNodeVel(vel);
+      }
   }        
         
 //! @brief Sets the values of the acceleration of the nodes.
@@ -708,10 +808,19 @@ void XC::AnalysisModel::setVel(const Vector &vel)
 //! setNodeAccel(accel)} on each DOF\_Group.
 void XC::AnalysisModel::setAccel(const Vector &accel)
   {
-    DOF_GrpIter &theDOFGrps= this->getDOFGroups();
-    DOF_Group *dofPtr= nullptr;
-    while ((dofPtr= theDOFGrps()) != 0) 
-        dofPtr->setNodeAccel(accel);        
+    if(use_nodal_state_arena())
+      {
+        nodalStateMap.setAccel(accel);
+        for(std::vector<DOF_Group *>::iterator i= unmappedDOF_Groups.begin();i!=unmappedDOF_Groups.end();i++)
+          (*i)->setNodeAccel(accel);
+      }
+    else
+      {
+        DOF_GrpIter &theDOFGrps= this->getDOFGroups();
+        DOF_Group *dofPtr= nullptr;
+        while ((dofPtr= theDOFGrps()) != 0) 
+            dofPtr->setNodeAccel(accel);
+      }
   }
 
 //! @brief Sets the values of the displacement increment of the nodes.
@@ -75,6 +75,7 @@
 #include "solution/analysis/model/FE_EleConstIter.h"
 #include "solution/analysis/model/DOF_GrpIter.h"
 #include "solution/analysis/model/DOF_GrpConstIter.h"
+#include "domain/mesh/node/NodalStateArena.h"
 
 namespace XC {
 class Domain;
@@ -149,6 +150,11 @@ class AnalysisModel: public MovableObject, public CommandEntity
     mutable DOF_GroupGraph myGroupGraph;
     mutable bool updateGraphs;
 
+    NodalStateArenaMap nodalStateMap; //!< equations to nodal state arena map.
+    std::vector<DOF_Group *> unmappedDOF_Groups; //!< DOF groups not in nodalStateMap.
+    void build_nodal_state_map(NodalStateArena &);
+    bool use_nodal_state_arena(void);
+
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
   protected:
@@ -156,6 +162,7 @@ class AnalysisModel: public MovableObject, public CommandEntity
 
     friend class Integrator;
     friend class Analysis;
+    friend class LinearCombinationAnalysis;
     virtual void applyLoadDomain(double newTime);
     virtual int updateDomain(void);
     virtual int updateDomain(double newTime, double dT);
@@ -196,6 +203,7 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual PenaltyMFreedom_FE *createPenaltyMFreedom_FE(const int &, MFreedom_Constraint &, const double &);
     virtual PenaltyMRMFreedom_FE *createPenaltyMRMFreedom_FE(const int &, MRMFreedom_Constraint &, const double &);
     virtual FE_Element *createTransformationFE(const int &, Element *, const std::set<int> &,std::set<FE_Element *> &);
+    virtual bool removeFE_Element(int tag);
     virtual void clearAll(void);
 
     // methods to access the FE_Elements and DOF_Groups and their numbers
@@ -29,42 +29,48 @@
 #include "UnbalAndTangent.h"
 
 
-void XC::UnbalAndTangent::alloc(void)
+//! @brief Return the storage for the calling thread, allocating
+//! the matrix and the vector if they're not already there.
+XC::UnbalAndTangentStorage &XC::UnbalAndTangent::alloc(void) const
   {
-    unbalAndTangentArray->alloc(nDOF);
+    UnbalAndTangentStorage &retval= getStorage();
+    if(nDOF>0)
+      retval.alloc(nDOF);
+    return retval;
   }
 
 //! @brief Constructor.
-XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,UnbalAndTangentStorage &a)
-  :nDOF(n), unbalAndTangentArray(&a) 
+XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,storage_getter g)
+  :nDOF(n), getStorage(g) 
   { alloc(); }
 
 //! @brief destructor.
 XC::UnbalAndTangent::~UnbalAndTangent(void)
   {
-    unbalAndTangentArray= nullptr;
+    getStorage= nullptr;
   }
 
 //! @brief Return the tangent stiffness matrix.
 const XC::Matrix &XC::UnbalAndTangent::getTangent(void) const
   {
-    return unbalAndTangentArray->getTangent(this->nDOF);
+    return alloc().getTangent(this->nDOF);
   }
 
 //! @brief Return the tangent stiffness matrix.
 XC::Matrix &XC::UnbalAndTangent::getTangent(void)
   {
-    return unbalAndTangentArray->getTangent(this->nDOF);
+    return alloc().getTangent(this->nDOF);
   }
 
 //! @brief Returns the residual vector.
 const XC::Vector &XC::UnbalAndTangent::getResidual(void) const
   {
-    return unbalAndTangentArray->getUnbalance(this->nDOF);
+    return alloc().getUnbalance(this->nDOF);
   }
 
 //! @brief Return the residual vector.
 XC::Vector &XC::UnbalAndTangent::getResidual(void)
   {
-    return unbalAndTangentArray->getUnbalance(this->nDOF);
+    return alloc().getUnbalance(this->nDOF);
   }
+
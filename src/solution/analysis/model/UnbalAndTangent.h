@@ -38,15 +38,22 @@ namespace XC {
 //! @ingroup Analysis
 //
 //! @brief Unbalanced force vector and tangent stiffness matrix.
+//!
+//! The storage is not kept as a pointer but obtained through a function
+//! supplied by the owner class, so the owner can provide a different
+//! (i.e. thread local) storage for each thread that computes the
+//! tangent or the residual.
 class UnbalAndTangent
   {
+  public:
+    typedef UnbalAndTangentStorage &(*storage_getter)(void);
   private:
     size_t nDOF;
-    UnbalAndTangentStorage *unbalAndTangentArray; //!< Reference to array of class wide vectors and matrices
-    void alloc(void);
+    storage_getter getStorage; //!< Returns the array of class wide vectors and matrices for the calling thread.
+    UnbalAndTangentStorage &alloc(void) const;
 
   public:
-    UnbalAndTangent(const size_t &,UnbalAndTangentStorage &);
+    UnbalAndTangent(const size_t &,storage_getter);
     virtual ~UnbalAndTangent(void);
 
     inline const size_t &getNumDOF(void) const
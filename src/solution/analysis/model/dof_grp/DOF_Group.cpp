@@ -77,6 +77,10 @@ const int MAX_NUM_DOF= 256;
 XC::Matrix XC::DOF_Group::errMatrix(1,1);
 XC::Vector XC::DOF_Group::errVect(1);
 XC::UnbalAndTangentStorage XC::DOF_Group::unbalAndTangentArray(MAX_NUM_DOF+1);
+
+//! @brief Return the class wide vectors and matrices.
+XC::UnbalAndTangentStorage &XC::DOF_Group::getUnbalAndTangentStorage(void)
+  { return unbalAndTangentArray; }
 int XC::DOF_Group::numDOF_Groups(0); // number of objects
 
 
@@ -115,7 +119,7 @@ void XC::DOF_Group::inicID(void)
 //! @param node: node associated to the DOF group.
 XC::DOF_Group::DOF_Group(int tag, Node *node)
   :TaggedObject(tag), myID(node->getNumberDOF()),
-   unbalAndTangent(node->getNumberDOF(),unbalAndTangentArray), myNode(node)
+   unbalAndTangent(node->getNumberDOF(),getUnbalAndTangentStorage), myNode(node)
    
   {
     inicID();
@@ -134,7 +138,7 @@ XC::DOF_Group::DOF_Group(int tag, Node *node)
 //! warning message is orinted and \p numDOF set to \f$0\f$.
 XC::DOF_Group::DOF_Group(int tag, int ndof)
   :TaggedObject(tag), myID(ndof),
-   unbalAndTangent(ndof,unbalAndTangentArray), myNode(nullptr)
+   unbalAndTangent(ndof,getUnbalAndTangentStorage), myNode(nullptr)
   {
     inicID();
     numDOF_Groups++;
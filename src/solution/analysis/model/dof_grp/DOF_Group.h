@@ -114,6 +114,7 @@ class DOF_Group: public TaggedObject
     static Matrix errMatrix;
     static Vector errVect;
     static UnbalAndTangentStorage unbalAndTangentArray; //!< array of class wide vectors and matrices
+    static UnbalAndTangentStorage &getUnbalAndTangentStorage(void);
     static int numDOF_Groups; //!< number of objects of this class
 
     void inicID(void);
@@ -167,6 +168,10 @@ class DOF_Group: public TaggedObject
     virtual const Vector &getCommittedAccel(void) const;
     
     // methods to update the trial response at the nodes
+    //! @brief Return true if the trial response of the node is
+    //! taken directly from the equation values (see setNodeDisp).
+    virtual bool setsNodeResponseDirectly(void) const
+      { return (myNode!=nullptr); }
     virtual void setNodeDisp(const Vector &u);
     virtual void setNodeVel(const Vector &udot);
     virtual void setNodeAccel(const Vector &udotdot);
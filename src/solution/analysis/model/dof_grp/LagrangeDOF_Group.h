@@ -109,6 +109,9 @@ class LagrangeDOF_Group: public DOF_Group
     virtual const Vector &getTrialAccel() const;
     
     // methods to update the trial response at the nodes
+    //! @brief No node response to set.
+    virtual bool setsNodeResponseDirectly(void) const
+      { return false; }
     virtual void setNodeDisp(const Vector &u);
     virtual void setNodeVel(const Vector &udot);
     virtual void setNodeAccel(const Vector &udotdot);
@@ -76,6 +76,10 @@ const int MAX_NUM_DOF= 16;
 
 // static variables initialization
 XC::UnbalAndTangentStorage XC::TransformationDOF_Group::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
+
+//! @brief Return the class wide vectors and matrices.
+XC::UnbalAndTangentStorage &XC::TransformationDOF_Group::getUnbalAndTangentStorageMod(void)
+  { return unbalAndTangentArrayMod; }
 XC::TransformationConstraintHandler *XC::TransformationDOF_Group::theHandler= nullptr;     // number of objects
 XC::Vector XC::TransformationDOF_Group::modTrialDispOld;
 
@@ -92,7 +96,7 @@ std::vector<XC::SFreedom_Constraint *> XC::TransformationDOF_Group::getSFreedomC
 void XC::TransformationDOF_Group::arrays_setup(int numNodalDOF, int numConstrainedNodeRetainedDOF, int numRetainedNodeDOF, int numRetainedNodes)  
   {
     this->modNumDOF= numConstrainedNodeRetainedDOF + numRetainedNodes*numRetainedNodeDOF;
-    unbalAndTangentMod= UnbalAndTangent(modNumDOF, unbalAndTangentArrayMod);
+    unbalAndTangentMod= UnbalAndTangent(modNumDOF, getUnbalAndTangentStorageMod);
 
     // create ID and transformation matrix
     modID= ID(modNumDOF);
@@ -157,7 +161,7 @@ void XC::TransformationDOF_Group::initialize(TransformationConstraintHandler *th
   }
 
 XC::TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, MFreedom_ConstraintBase *m, TransformationConstraintHandler *theTHandler)  
-  :DOF_Group(tag,node), mfc(m), unbalAndTangentMod(0,unbalAndTangentArrayMod),
+  :DOF_Group(tag,node), mfc(m), unbalAndTangentMod(0,getUnbalAndTangentStorageMod),
   needRetainedData(-1), theSPs()
   { initialize(theHandler); }
 
@@ -172,7 +176,7 @@ void XC::TransformationDOF_Group::setID(int dof, int value)
 
 XC::TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, TransformationConstraintHandler *theTHandler)
   :DOF_Group(tag,node), mfc(nullptr), modNumDOF(node->getNumberDOF()),
-   unbalAndTangentMod(node->getNumberDOF(),unbalAndTangentArrayMod),
+   unbalAndTangentMod(node->getNumberDOF(),getUnbalAndTangentStorageMod),
   needRetainedData(-1), theSPs()
   {
     // create space for the SFreedom_Constraint array
@@ -103,6 +103,7 @@ class TransformationDOF_Group: public DOF_Group
     
     // static variables - single copy for all objects of the class	    
     static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
+    static UnbalAndTangentStorage &getUnbalAndTangentStorageMod(void);
     static TransformationConstraintHandler *theHandler; //!< Transformation constraint handler.
 
 #ifdef TRANSF_INCREMENTAL_MP
@@ -165,6 +166,9 @@ class TransformationDOF_Group: public DOF_Group
     const Vector &getCommittedAccel(void) const;
     
     // methods to update the trial response at the nodes
+    //! @brief The node response is obtained through the transformation matrix.
+    bool setsNodeResponseDirectly(void) const
+      { return false; }
     void setNodeDisp(const Vector &u);
     void setNodeVel(const Vector &udot);
     void setNodeAccel(const Vector &udotdot);
@@ -76,16 +76,21 @@ const int MAX_NUM_DOF= 64;
 // static variables initialization
 XC::Matrix XC::FE_Element::errMatrix(1,1);
 XC::Vector XC::FE_Element::errVector(1);
-XC::UnbalAndTangentStorage XC::FE_Element::unbalAndTangentArray(MAX_NUM_DOF+1);
+thread_local XC::UnbalAndTangentStorage XC::FE_Element::unbalAndTangentArray(MAX_NUM_DOF+1);
 int XC::FE_Element::numFEs(0);           // number of objects
 
 
+//! @brief Return the class wide vectors and matrices for the calling
+//! thread.
+XC::UnbalAndTangentStorage &XC::FE_Element::getUnbalAndTangentStorage(void)
+  { return unbalAndTangentArray; }
+
 //! @brief set the pointers for the tangent and residual
 void XC::FE_Element::set_pointers(void)
   {
     if(myEle->isSubdomain() == false)
       {
-        unbalAndTangent= UnbalAndTangent(numDOF,unbalAndTangentArray);
+        unbalAndTangent= UnbalAndTangent(numDOF,getUnbalAndTangentStorage);
       }
     else
       {
@@ -116,7 +121,7 @@ void XC::FE_Element::set_pointers(void)
 //! object, or there is not enough memory for the Vectors and Matrices
 //! required.
 XC::FE_Element::FE_Element(int tag, Element *ele)
-  :TaggedObject(tag),numDOF(ele->getNumDOF()),unbalAndTangent(0,unbalAndTangentArray),
+  :TaggedObject(tag),numDOF(ele->getNumDOF()),unbalAndTangent(0,getUnbalAndTangentStorage),
    theModel(nullptr), myEle(ele), theIntegrator(nullptr),
    myDOF_Groups((ele->getNodePtrs().getExternalNodes()).Size()), myID(ele->getNumDOF())
   {
@@ -182,7 +187,7 @@ XC::FE_Element::FE_Element(int tag, Element *ele)
 //! tangent and residual matrix and vector, this is the responsibility of
 //! the subclass.
 XC::FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
-  :TaggedObject(tag),numDOF(ndof),unbalAndTangent(ndof,unbalAndTangentArray),
+  :TaggedObject(tag),numDOF(ndof),unbalAndTangent(ndof,getUnbalAndTangentStorage),
     theModel(nullptr), myEle(nullptr), theIntegrator(nullptr),
     myDOF_Groups(numDOF_Group), myID(ndof)
   {
@@ -1100,6 +1105,20 @@ void XC::FE_Element::addLocalD_Force(const XC::Vector &accel, double fact)
 XC::Element *XC::FE_Element::getElement(void)
   { return myEle; }
 
+//! @brief Return true if the tangent and the residual of this object
+//! can be computed at the same time that those of other FE_Elements
+//! (see IncrementalIntegrator::setNumThreads). Subdomains, the
+//! FE_Elements that have no associated element and the elements
+//! that are not reentrant (see Element::allowsConcurrentStateDetermination)
+//! are computed by the calling thread.
+bool XC::FE_Element::allowsConcurrentStateDetermination(void) const
+  {
+    bool retval= false;
+    if(myEle && !myEle->isSubdomain())
+      retval= myEle->allowsConcurrentStateDetermination();
+    return retval;
+  }
+
 //! @brief Returns the name of the associated element (if any).
 std::string XC::FE_Element::getElementClassName(void) const
   {
@@ -117,7 +117,8 @@ class FE_Element: public TaggedObject
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static UnbalAndTangentStorage unbalAndTangentArray; //!< array of class wide vectors and matrices
+    static thread_local UnbalAndTangentStorage unbalAndTangentArray; //!< array of class wide vectors and matrices (one for each thread).
+    static UnbalAndTangentStorage &getUnbalAndTangentStorage(void);
     static int numFEs; //!< number of objects
     void set_pointers(void);
 
@@ -180,6 +181,7 @@ class FE_Element: public TaggedObject
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
+    virtual bool allowsConcurrentStateDetermination(void) const;
     std::string getElementClassName(void) const;
 
     virtual void Print(std::ostream &, int = 0) {return;};
@@ -0,0 +1,251 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//BlockTransformation.cc
+
+#include "BlockTransformation.h"
+#include <solution/analysis/model/dof_grp/DOF_Group.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
+#include <algorithm>
+#include <cstring>
+
+XC::BlockTransformation::dbl_vector XC::BlockTransformation::work;
+
+//! @brief Constructor.
+XC::BlockTransformation::BlockTransformation(void)
+  : numOriginal(0), numTransformed(0), rowStart(1,0), identity(true) {}
+
+//! @brief Add the non-zero entries of the row of a block.
+//!
+//! @param row: row of the block.
+//! @param T: transformation of the block (nullptr if identity).
+//! @param numCols: number of columns of the block.
+//! @param colOffset: column of T where the block starts.
+void XC::BlockTransformation::add_row(const int &row, const Matrix *T, const int &numCols, const int &colOffset)
+  {
+    const size_t first= cols.size();
+    if(T)
+      {
+        for(int j= 0; j<numCols; j++)
+          {
+            const double v= (*T)(row,j);
+            if(v!=0.0)
+              {
+                cols.push_back(colOffset+j);
+                values.push_back(v);
+              }
+          }
+      }
+    else
+      {
+        cols.push_back(colOffset+row);
+        values.push_back(1.0);
+      }
+    const size_t numEntries= cols.size()-first;
+    if((numEntries==1) && (values.back()==1.0))
+      unitCol.push_back(cols.back());
+    else
+      unitCol.push_back(-1);
+    rowStart.push_back(cols.size());
+  }
+
+//! @brief Build the sparse structure from the transformations of the
+//! DOF groups.
+void XC::BlockTransformation::build(const std::vector<DOF_Group *> &theDOFs)
+  {
+    const size_t numGroups= theDOFs.size();
+    blocks.resize(numGroups);
+    snapshot.clear();
+    rowStart.assign(1,0);
+    cols.clear();
+    values.clear();
+    unitCol.clear();
+    numOriginal= 0;
+    numTransformed= 0;
+    for(size_t a= 0; a<numGroups; a++)
+      {
+        const Matrix *T= theDOFs[a]->getT();
+        blocks[a]= T;
+        int numRows= theDOFs[a]->getNumDOF();
+        int numCols= numRows;
+        if(T)
+          {
+            numRows= T->noRows();
+            numCols= T->noCols();
+            snapshot.insert(snapshot.end(), T->getDataPtr(), T->getDataPtr()+T->getDataSize());
+          }
+        for(int i= 0; i<numRows; i++)
+          add_row(i, T, numCols, numTransformed);
+        numOriginal+= numRows;
+        numTransformed+= numCols;
+      }
+    identity= (numOriginal==numTransformed);
+    for(int r= 0; identity && (r<numOriginal); r++)
+      identity= (unitCol[r]==r);
+  }
+
+//! @brief Return true if the transformations of the DOF groups are the
+//! same (and have the same values) as when the structure was built.
+bool XC::BlockTransformation::isUpToDate(const std::vector<DOF_Group *> &theDOFs) const
+  {
+    const size_t numGroups= theDOFs.size();
+    if(numGroups!=blocks.size())
+      return false;
+    size_t pos= 0;
+    for(size_t a= 0; a<numGroups; a++)
+      {
+        const Matrix *T= theDOFs[a]->getT();
+        if(T!=blocks[a])
+          return false;
+        if(T)
+          {
+            const size_t sz= T->getDataSize();
+            if((pos+sz>snapshot.size()) || (std::memcmp(T->getDataPtr(), snapshot.data()+pos, sz*sizeof(double))!=0))
+              return false;
+            pos+= sz;
+          }
+      }
+    return true;
+  }
+
+//! @brief Rebuild the structure if the transformations have changed.
+//!
+//! @return true if the structure has been rebuilt.
+bool XC::BlockTransformation::update(const std::vector<DOF_Group *> &theDOFs)
+  {
+    bool retval= false;
+    if(!isUpToDate(theDOFs))
+      {
+        build(theDOFs);
+        retval= true;
+      }
+    return retval;
+  }
+
+//! @brief Compute the product \f$T^T K T\f$.
+//!
+//! The product \f$W= K T\f$ is computed column by column in a class
+//! wide buffer and then \f$T^T W\f$ is written in the result, using the
+//! sparsity of T in both products (zero entries of W are skipped). If
+//! T is the identity the matrix is just copied.
+//!
+//! @param K: matrix to transform (numOriginal x numOriginal).
+//! @param result: transformed matrix (numTransformed x numTransformed).
+void XC::BlockTransformation::TtKT(const Matrix &K, Matrix &result) const
+  {
+    const int nO= numOriginal;
+    const int nT= numTransformed;
+    if(identity)
+      {
+        std::copy(K.getDataPtr(), K.getDataPtr()+static_cast<size_t>(nO)*nO, result.getDataPtr());
+        return;
+      }
+    work.assign(static_cast<size_t>(nO)*nT, 0.0);
+    // W= K T (column-major storage).
+    const double *k= K.getDataPtr();
+    double *w= work.data();
+    for(int r= 0; r<nO; r++)
+      {
+        const double *Kr= k+static_cast<size_t>(r)*nO; // column r of K.
+        const int c= unitCol[r];
+        if(c>=0)
+          {
+            double *Wc= w+static_cast<size_t>(c)*nO;
+            for(int p= 0; p<nO; p++)
+              Wc[p]+= Kr[p];
+          }
+        else
+          for(int e= rowStart[r]; e<rowStart[r+1]; e++)
+            {
+              const double v= values[e];
+              double *Wc= w+static_cast<size_t>(cols[e])*nO;
+              for(int p= 0; p<nO; p++)
+                Wc[p]+= v*Kr[p];
+            }
+      }
+    // result= T^T W.
+    result.Zero();
+    double *m= result.getDataPtr();
+    for(int q= 0; q<nT; q++)
+      {
+        const double *Wq= w+static_cast<size_t>(q)*nO;
+        double *Mq= m+static_cast<size_t>(q)*nT;
+        for(int r= 0; r<nO; r++)
+          {
+            const double wrq= Wq[r];
+            if(wrq!=0.0)
+              {
+                const int c= unitCol[r];
+                if(c>=0)
+                  Mq[c]+= wrq;
+                else
+                  for(int e= rowStart[r]; e<rowStart[r+1]; e++)
+                    Mq[cols[e]]+= values[e]*wrq;
+              }
+          }
+      }
+  }
+
+//! @brief Compute the product \f$T^T V\f$.
+//!
+//! @param V: vector to transform (size numOriginal).
+//! @param result: transformed vector (size numTransformed).
+void XC::BlockTransformation::TtV(const Vector &V, Vector &result) const
+  {
+    result.Zero();
+    for(int r= 0; r<numOriginal; r++)
+      {
+        const double vr= V(r);
+        const int c= unitCol[r];
+        if(c>=0)
+          result(c)+= vr;
+        else
+          for(int e= rowStart[r]; e<rowStart[r+1]; e++)
+            result(cols[e])+= values[e]*vr;
+      }
+  }
+
+//! @brief Compute the product \f$T V\f$.
+//!
+//! @param V: vector to transform (size numTransformed).
+//! @param result: transformed vector (size numOriginal).
+void XC::BlockTransformation::TV(const Vector &V, Vector &result) const
+  {
+    for(int r= 0; r<numOriginal; r++)
+      {
+        const int c= unitCol[r];
+        if(c>=0)
+          result(r)= V(c);
+        else
+          {
+            double sum= 0.0;
+            for(int e= rowStart[r]; e<rowStart[r+1]; e++)
+              sum+= values[e]*V(cols[e]);
+            result(r)= sum;
+          }
+      }
+  }
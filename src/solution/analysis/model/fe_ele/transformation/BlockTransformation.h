@@ -0,0 +1,97 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//BlockTransformation.h
+
+#ifndef BlockTransformation_h
+#define BlockTransformation_h
+
+#include <vector>
+
+namespace XC {
+class DOF_Group;
+class Matrix;
+class Vector;
+
+//! @ingroup AnalysisFE
+//
+//! @brief Block diagonal transformation matrix T of a TransformationFE
+//! stored in compressed sparse row format.
+//!
+//! Each diagonal block corresponds to the transformation matrix of one
+//! of the DOF groups of the element (the identity if the group has no
+//! transformation). The rows that contain a single unit value (the
+//! identity blocks and the unconstrained DOFs) are flagged, so the
+//! products with them are just copies. The structure is built when
+//! the element DOF numbers are set (see TransformationFE::setID) and
+//! rebuilt only if the values of the transformation matrices change
+//! (time varying constraints).
+class BlockTransformation
+  {
+  public:
+    typedef std::vector<int> int_vector;
+    typedef std::vector<double> dbl_vector;
+  private:
+    std::vector<const Matrix *> blocks; //!< transformation of each DOF group (nullptr if identity).
+    dbl_vector snapshot; //!< values of the transformations when the structure was built.
+    int numOriginal; //!< number of rows of T (element DOFs).
+    int numTransformed; //!< number of columns of T (transformed DOFs).
+    int_vector rowStart; //!< start of the entries of each row.
+    int_vector cols; //!< column of each entry.
+    dbl_vector values; //!< value of each entry.
+    int_vector unitCol; //!< column of the unit value if the row has only that entry, otherwise -1.
+    bool identity; //!< true if T is the identity matrix.
+    static dbl_vector work; //!< K T product (class wide buffer).
+
+    void add_row(const int &, const Matrix *, const int &, const int &);
+  public:
+    BlockTransformation(void);
+
+    void build(const std::vector<DOF_Group *> &);
+    bool isUpToDate(const std::vector<DOF_Group *> &) const;
+    bool update(const std::vector<DOF_Group *> &);
+
+    //! @brief Return the number of rows of T (element DOFs).
+    inline int getNumOriginal(void) const
+      { return numOriginal; }
+    //! @brief Return the number of columns of T (transformed DOFs).
+    inline int getNumTransformed(void) const
+      { return numTransformed; }
+    //! @brief Return true if T is the identity matrix.
+    inline bool isIdentity(void) const
+      { return identity; }
+    //! @brief Return the number of non-zero entries of T.
+    inline int getNumEntries(void) const
+      { return cols.size(); }
+
+    void TtKT(const Matrix &, Matrix &) const;
+    void TtV(const Vector &, Vector &) const;
+    void TV(const Vector &, Vector &) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -64,7 +64,6 @@
 #include <solution/analysis/integrator/Integrator.h>
 #include "domain/domain/subdomain/Subdomain.h"
 #include <solution/analysis/model/AnalysisModel.h>
-#include <utility/matrix/IntPtrWrapper.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
@@ -73,20 +72,18 @@ const int MAX_NUM_DOF= 64;
 
 // static variables initialization
 XC::UnbalAndTangentStorage XC::TransformationFE::unbalAndTangentArrayMod(MAX_NUM_DOF+1);
-std::vector<const XC::Matrix *> XC::TransformationFE::theTransformations; 
+
+//! @brief Return the class wide vectors and matrices.
+XC::UnbalAndTangentStorage &XC::TransformationFE::getUnbalAndTangentStorageMod(void)
+  { return unbalAndTangentArrayMod; }
 int XC::TransformationFE::numTransFE(0);           
-int XC::TransformationFE::transCounter(0);           
-int XC::TransformationFE::sizeTransformations(0);          
 XC::Vector XC::TransformationFE::dataBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
-XC::Vector XC::TransformationFE::localKbuffer(MAX_NUM_DOF*MAX_NUM_DOF);          
-XC::ID XC::TransformationFE::dofData(MAX_NUM_DOF);          
-int XC::TransformationFE::sizeBuffer(MAX_NUM_DOF*MAX_NUM_DOF);
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
 XC::TransformationFE::TransformationFE(int tag, Element *ele)
   :FE_Element(tag, ele), theDOFs(), /* numSPs(0), theSPs(),*/  
-  numGroups(0), numTransformedDOF(0),unbalAndTangentMod(numTransformedDOF,unbalAndTangentArrayMod)
+  numGroups(0), numTransformedDOF(0),unbalAndTangentMod(numTransformedDOF,getUnbalAndTangentStorageMod)
   {
   // set number of original dof at ele
     numOriginalDOF = ele->getNumDOF();
@@ -122,32 +119,13 @@ XC::TransformationFE::TransformationFE(int tag, Element *ele)
         theDOFs[i] = theDofGroup;
       }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new_ one
-    if(numNodes > sizeTransformations)
-      {
-        theTransformations.resize(numNodes,static_cast<const Matrix *>(nullptr));
-        sizeTransformations = numNodes;
-      }        
-
     // increment the number of transformations
     numTransFE++;
   }
 
 //! @brief Destructor.
 XC::TransformationFE::~TransformationFE(void)
-  {
-    numTransFE--;
-
-    // if this is the last XC::FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if(numTransFE == 0)
-      {
-        sizeTransformations = 0;
-        sizeBuffer = 0;
-        transCounter = 0;
-      }
-  }    
+  { numTransFE--; }
 
 
 const XC::ID &XC::TransformationFE::getDOFtags(void) const 
@@ -192,162 +170,77 @@ int XC::TransformationFE::setID(void)
                 return -3;
               }                
       }
-    unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,unbalAndTangentArrayMod);
+    unbalAndTangentMod= UnbalAndTangent(numTransformedDOF,getUnbalAndTangentStorageMod);
+    // sparse representation of the transformation.
+    transformation.build(theDOFs);
     return 0;
   }
 
-const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
+//! @brief Rebuild the sparse representation of the transformation
+//! if the transformation matrices of the DOF groups have changed.
+void XC::TransformationFE::update_transformation(void)
   {
-    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+    transformation.update(theDOFs);
+    if(transformation.getNumOriginal()!=numOriginalDOF)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; WARNING the number of rows of the transformation: "
+                << transformation.getNumOriginal()
+                << " doesn't match the number of DOFs of the element: "
+                << numOriginalDOF << std::endl;
+  }
 
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-    
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a= 0;a<numNode;a++)
+//! @brief Compute the transformed tangent \f$T^T K T\f$ from the
+//! tangent of the element.
+const XC::Matrix &XC::TransformationFE::transform_tangent(const Matrix &theTangent)
+  {
+    update_transformation();
+    Matrix &modTangent= unbalAndTangentMod.getTangent();
+    transformation.TtKT(theTangent, modTangent);
+    return modTangent;
+  }
+
+//! @brief Return the product of the transformed tangent and the
+//! components of the vector argument that correspond to the element
+//! DOFs.
+const XC::Vector &XC::TransformationFE::transformed_tangent_times(const Vector &theVector)
+  {
+    transform_tangent(this->FE_Element::getTangent(nullptr));
+    // get the components we need out of the vector
+    // and place in a temporary vector
+    static Vector tmp;
+    tmp.resize(numTransformedDOF);
+    for(int j=0; j<numTransformedDOF; j++)
       {
-        const Matrix *theT= theDOFs[a]->getT();
-        theTransformations[a] = theT;
-        if(theT != 0)
-          numDOFs[a] = theT->noRows(); // T^ 
-        else
-          numDOFs[a] = theDOFs[a]->getNumDOF();
+	const int dof= modID(j);
+	if(dof >= 0)
+	  tmp(j)= theVector(dof);
+	else
+	  tmp(j)= 0.0;
       }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static XC::Matrix localK;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-
-        int startCol = 0;
-        int numDOFi = numDOFs[i];        
-        int noColsOriginal = 0;
-
-        for(int j=0; j<numNode; j++) {
-
-            const Matrix *Ti= theTransformations[i];
-            const Matrix *Tj= theTransformations[j];
-            int numDOFj = numDOFs[j];        
-            localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-            // copy K(i,j) into localK matrix
-            // CHECK SIZE OF BUFFER            
-            for(int a=0; a<numDOFi; a++)
-                for(int b=0; b<numDOFj; b++)
-                    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-            // now perform the matrix computation T(i)^T localK T(j)
-            // note: if T == 0 then the Identity is assumed
-            int noColsTransformed = 0;
-            static Matrix localTtKT;
-            
-            if(Ti != 0 && Tj != 0) {
-                noRowsTransformed = Ti->noCols();
-                noColsTransformed = Tj->noCols();
-                // CHECK SIZE OF BUFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = (*Ti) ^ localK * (*Tj);
-            } else if(Ti == 0 && Tj != 0) {
-                noRowsTransformed = numDOFi;
-                noColsTransformed = Tj->noCols();
-                // CHECK SIZE OF BUFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                // localTtKT = localK * (*Tj);               
-                localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-            } else if(Ti != 0 && Tj == 0) {
-                noRowsTransformed = Ti->noCols();
-                noColsTransformed = numDOFj;
-                // CHECK SIZE OF BUFFER
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = (*Ti) ^ localK;
-            } else {
-                noRowsTransformed = numDOFi;
-                noColsTransformed = numDOFj;
-                localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-                localTtKT = localK;
-            }
-            // now copy into modTangent the T(i)^t K(i,j) T(j) product
-            for(int c=0; c<noRowsTransformed; c++) 
-                for(int d=0; d<noColsTransformed; d++) 
-                    (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-            
-            startCol += noColsTransformed;
-            noColsOriginal += numDOFj;
-        }
-
-        noRowsOriginal += numDOFi;
-        startRow += noRowsTransformed;
-    }
-
-    return unbalAndTangentMod.getTangent();
+    Vector &modResidual= unbalAndTangentMod.getResidual();
+    modResidual.addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
+    return modResidual;
   }
 
+//! @brief Return the transformed tangent \f$T^T K T\f$.
+//!
+//! T is block diagonal, its sparse representation (see
+//! BlockTransformation) is computed when the DOF numbers are set.
+const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
+  {
+    const Matrix &theTangent= this->FE_Element::getTangent(theNewIntegrator);
+    return transform_tangent(theTangent);
+  }
 
+//! @brief Return the transformed residual \f$T^T R\f$.
 const XC::Vector &XC::TransformationFE::getResidual(Integrator *theNewIntegrator)
   {
-    const Vector &theResidual = this->XC::FE_Element::getResidual(theNewIntegrator);
-    // DO THE SP STUFF TO THE TANGENT
-    
-    // perform Tt R  -- as T is block diagonal do T(i)^T R(i)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRowTransformed = 0;
-    int startRowOriginal = 0;
-    int numNode = numGroups;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-        int noRows = 0;
-        int noCols = 0;
-        const Matrix *Ti= theDOFs[i]->getT();
-        if(Ti != 0) {
-          noRows = Ti->noCols(); // T^
-          noCols = Ti->noRows();
-
-          /*
-          Vector orig(noCols);
-          Vector mod(noRows);
-          for(int k=startRowOriginal; k<startRowOriginal+noCols; k++)
-            orig(k-startRowOriginal)= theResidual(k);
-          mod = (*Ti)^orig;
-          for(int k=startRowTransformed; k<startRowTransformed+noRows; k++)
-            (unbalAndTangentMod.getResidual())(k) = mod (k-startRowTransformed);
-
-          */
-
-          for(int j=0; j<noRows; j++) {
-            double sum = 0.0;
-            for(int k=0; k<noCols; k++)
-              sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-            (unbalAndTangentMod.getResidual())(startRowTransformed +j) = sum;
-          }
-
-        } else {
-          noCols = theDOFs[i]->getNumDOF();
-          noRows = noCols;
-          for(int j=0; j<noRows; j++)
-            (unbalAndTangentMod.getResidual())(startRowTransformed +j) = theResidual(startRowOriginal + j);
-        }
-        startRowTransformed += noRows;
-        startRowOriginal += noCols;
-    }
-
-    return unbalAndTangentMod.getResidual();
-}
-
-
-
+    const Vector &theResidual= this->FE_Element::getResidual(theNewIntegrator);
+    update_transformation();
+    Vector &modResidual= unbalAndTangentMod.getResidual();
+    transformation.TtV(theResidual, modResidual);
+    return modResidual;
+  }
 
 const XC::Vector &XC::TransformationFE::getTangForce(const XC::Vector &disp, double fact)
   {
@@ -361,461 +254,30 @@ const XC::Vector &XC::TransformationFE::getK_Force(const XC::Vector &accel, doub
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addKtToTang();    
-    const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a = 0; a<numNode; a++)
-      {
-	const Matrix *theT= theDOFs[a]->getT();
-	theTransformations[a] = theT;
-	if(theT != 0)
-	  numDOFs[a] = theT->noRows(); // T^ 
-	else
-	  numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static XC::Matrix localK;
-
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++) {
-
-      int startCol = 0;
-      int numDOFi = numDOFs[i];        
-      int noColsOriginal = 0;
-
-      for(int j=0; j<numNode; j++)
-	{
-	  const Matrix *Ti= theTransformations[i];
-	  const Matrix *Tj= theTransformations[j];
-	int numDOFj = numDOFs[j];        
-	localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-	// copy K(i,j) into localK matrix
-	// CHECK SIZE OF BUFFER            
-	for(int a=0; a<numDOFi; a++)
-	  for(int b=0; b<numDOFj; b++)
-	    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	// now perform the matrix computation T(i)^T localK T(j)
-	// note: if T == 0 then the Identity is assumed
-	int noColsTransformed = 0;
-	static XC::Matrix localTtKT;
-
-	if(Ti != 0 && Tj != 0) {
-	  noRowsTransformed = Ti->noCols();
-	  noColsTransformed = Tj->noCols();
-	  // CHECK SIZE OF BUFFER
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  localTtKT = (*Ti) ^ localK * (*Tj);
-	} else if(Ti == 0 && Tj != 0) {
-	  noRowsTransformed = numDOFi;
-	  noColsTransformed = Tj->noCols();
-	  // CHECK SIZE OF BUFFER
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  // localTtKT = localK * (*Tj);               
-	  localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	} else if(Ti != 0 && Tj == 0) {
-	  noRowsTransformed = Ti->noCols();
-	  noColsTransformed = numDOFj;
-	  // CHECK SIZE OF BUFFER
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  localTtKT = (*Ti) ^ localK;
-	} else {
-	  noRowsTransformed = numDOFi;
-	  noColsTransformed = numDOFj;
-	  localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-	  localTtKT = localK;
-	}
-	// now copy into modTangent the T(i)^t K(i,j) T(j) product
-	for(int c=0; c<noRowsTransformed; c++) 
-	  for(int d=0; d<noColsTransformed; d++) 
-	    (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-
-	startCol += noColsTransformed;
-	noColsOriginal += numDOFj;
-      }
-
-      noRowsOriginal += numDOFi;
-      startRow += noRowsTransformed;
-    }
-
-    // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numTransformedDOF);
-    for(int j=0; j<numTransformedDOF; j++)
-      {
-	int dof = modID(j);
-	if(dof >= 0)
-	  tmp(j) = accel(dof);
-	else
-	  tmp(j) = 0.0;
-      }
-
-    unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-    return unbalAndTangentMod.getResidual();
+    return transformed_tangent_times(accel);
   }
 
 const XC::Vector &XC::TransformationFE::getKi_Force(const XC::Vector &accel, double fact)
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addKiToTang();    
-    const Matrix &theTangent= this->FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-
-    // DO THE SP STUFF TO THE TANGENT 
-
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    const int numNode = numGroups;
-    for (int a = 0; a<numNode; a++)
-      {
-	const Matrix *theT= theDOFs[a]->getT();
-	theTransformations[a] = theT;
-	if (theT != nullptr)
-	  numDOFs[a] = theT->noRows(); // T^ 
-	else
-	  numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++)
-      {
-	int startCol = 0;
-	int numDOFi = numDOFs[i];	
-	int noColsOriginal = 0;
-
-	for (int j=0; j<numNode; j++)
-	  {
-	    const Matrix *Ti= theTransformations[i];
-	    const Matrix *Tj= theTransformations[j];
-	    const int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFER	    
-	    for (int a=0; a<numDOFi; a++)
-	      for (int b=0; b<numDOFj; b++)
-		localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	// now perform the matrix computation T(i)^T localK T(j)
-	// note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-
-	    if (Ti != nullptr && Tj != nullptr)
-	      {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	      }
-	    else if (Ti == nullptr && Tj != nullptr)
-	      {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	      }
-	    else if (Ti != nullptr && Tj == nullptr)
-	      {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		// CHECK SIZE OF BUFFER
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	      }
-	    else
-	      {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
-	      }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-	      for (int d=0; d<noColsTransformed; d++) 
-		(unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
-	  }
-
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
-      }
-
-    // get the components we need out of the vector
-    // and place in a temporary vector
-    Vector tmp(numTransformedDOF);
-    for(int j=0; j<numTransformedDOF; j++)
-      {
-	const int dof = modID(j);
-	if (dof >= 0)
-	  tmp(j)= accel(dof);
-	else
-	  tmp(j)= 0.0;
-      }
-
-    unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-    return unbalAndTangentMod.getResidual();
+    return transformed_tangent_times(accel);
   }
+
 const XC::Vector &XC::TransformationFE::getM_Force(const Vector &accel, double fact)
   {
     this->FE_Element::zeroTangent();    
     this->FE_Element::addMtoTang();    
-    const Matrix &theTangent = this->FE_Element::getTangent(0);
-
-    static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-    numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-    // DO THE SP STUFF TO THE TANGENT 
-  
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for(int a = 0; a<numNode; a++)
-      {
-        const Matrix *theT= theDOFs[a]->getT();
-        theTransformations[a] = theT;
-        if(theT != 0)
-          numDOFs[a] = theT->noRows(); // T^ 
-        else
-          numDOFs[a] = theDOFs[a]->getNumDOF();
-      }
-  
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-  
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-  
-    static Matrix localK;
-  
-    // foreach block row, for each block col do
-    for(int i=0; i<numNode; i++)
-      {
-    
-        int startCol = 0;
-        int numDOFi = numDOFs[i];        
-        int noColsOriginal = 0;
-    
-        for(int j=0; j<numNode; j++)
-          {
-            const Matrix *Ti= theTransformations[i];
-            const Matrix *Tj= theTransformations[j];
-            int numDOFj = numDOFs[j];        
-            localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-            // copy K(i,j) into localK matrix
-            // CHECK SIZE OF BUFFER            
-            for(int a=0; a<numDOFi; a++)
-              for(int b=0; b<numDOFj; b++)
-                localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-            // now perform the matrix computation T(i)^T localK T(j)
-            // note: if T == 0 then the Identity is assumed
-            int noColsTransformed = 0;
-            static Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
+    return transformed_tangent_times(accel);
   }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
-  }
-
-  unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getResidual();
-}
 
 const XC::Vector &XC::TransformationFE::getC_Force(const XC::Vector &accel, double fact)
-{
-  this->FE_Element::zeroTangent();    
-  this->FE_Element::addCtoTang();    
-  const Matrix &theTangent = this->XC::FE_Element::getTangent(0);
-
-  static IntPtrWrapper numDOFs(dofData.getDataPtr(), 1);
-  numDOFs.setData(dofData.getDataPtr(), numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for(int a = 0; a<numNode; a++)
-    {
-      const Matrix *theT= theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if(theT != 0)
-        numDOFs[a] = theT->noRows(); // T^ 
-      else
-        numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static XC::Matrix localK;
-  
-  // foreach block row, for each block col do
-  for(int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];        
-    int noColsOriginal = 0;
-    
-    for(int j=0; j<numNode; j++)
-      {
-        const Matrix *Ti= theTransformations[i];
-        const Matrix *Tj= theTransformations[j];
-      int numDOFj = numDOFs[j];        
-      localK.setData(localKbuffer.getDataPtr(), numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFER            
-      for(int a=0; a<numDOFi; a++)
-        for(int b=0; b<numDOFj; b++)
-          localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static XC::Matrix localTtKT;
-      
-      if(Ti != 0 && Tj != 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK * (*Tj);
-      } else if(Ti == 0 && Tj != 0) {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = Tj->noCols();
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        // localTtKT = localK * (*Tj);               
-        localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if(Ti != 0 && Tj == 0) {
-        noRowsTransformed = Ti->noCols();
-        noColsTransformed = numDOFj;
-        // CHECK SIZE OF BUFFER
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = (*Ti) ^ localK;
-      } else {
-        noRowsTransformed = numDOFi;
-        noColsTransformed = numDOFj;
-        localTtKT.setData(dataBuffer.getDataPtr(), noRowsTransformed, noColsTransformed);
-        localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for(int c=0; c<noRowsTransformed; c++) 
-        for(int d=0; d<noColsTransformed; d++) 
-          (unbalAndTangentMod.getTangent())(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
-  
-  // get the components we need out of the vector
-  // and place in a temporary vector
-  Vector tmp(numTransformedDOF);
-  for(int j=0; j<numTransformedDOF; j++) {
-    int dof = modID(j);
-    if(dof >= 0)
-      tmp(j) = accel(dof);
-    else
-      tmp(j) = 0.0;
+  {
+    this->FE_Element::zeroTangent();    
+    this->FE_Element::addCtoTang();    
+    return transformed_tangent_times(accel);
   }
 
-  unbalAndTangentMod.getResidual().addMatrixVector(0.0, unbalAndTangentMod.getTangent(), tmp, 1.0);
-
-  return unbalAndTangentMod.getResidual();
-}
-
 
 void XC::TransformationFE::addD_Force(const XC::Vector &disp,  double fact)
   {
@@ -856,6 +318,10 @@ void XC::TransformationFE::addM_Force(const XC::Vector &disp,  double fact)
   }            
 
 
+//! @brief The transformed tangent and residual are computed using
+//! class wide buffers, so they must be computed by the calling thread.
+bool XC::TransformationFE::allowsConcurrentStateDetermination(void) const
+  { return false; }
 
 // CHANGE THE XC::ID SENT
 const XC::Vector &XC::TransformationFE::getLastResponse(void)
@@ -886,39 +352,8 @@ int XC::TransformationFE::transformResponse(const XC::Vector &modResp,
   {
     // perform T R  -- as T is block diagonal do T(i) R(i)
     // where blocks are of size equal to num ele dof at a node
-
-    int startRowOriginal = 0;
-    int startRowTransformed = 0;
-    int numNode = numGroups;
-    int noRows = 0;
-    int noCols = 0;
-
-    for(int i=0; i<numNode; i++)
-      {
-        const Matrix *Ti = theDOFs[i]->getT();
-        if(Ti != 0)
-	  {
-            noRows = Ti->noRows();
-            noCols = Ti->noCols();
-            for(int j=0; j<noRows; j++)
-	      {
-                double sum = 0.0;
-                for(int k=0; k<noCols; k++)
-                    sum += (*Ti)(j,k) * modResp(startRowTransformed +k) ;
-                unmodResp(startRowOriginal + j) = sum;
-	      }
-	  }
-	else
-	  {
-            noCols = theDOFs[i]->getNumDOF();
-            noRows = noCols;
-            for(int j=0; j<noCols; j++)
-	      unmodResp(startRowOriginal + j) = modResp(startRowTransformed +j);
-	  }
-        startRowOriginal += noRows;
-        startRowTransformed += noCols;
-      }
-    
+    update_transformation();
+    transformation.TV(modResp, unmodResp);
     return 0;
   }
 
@@ -65,6 +65,7 @@
 
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include "solution/analysis/model/UnbalAndTangent.h"
+#include "BlockTransformation.h"
 
 namespace XC {
 class SFreedom_Constraint;
@@ -99,16 +100,15 @@ class TransformationFE: public FE_Element
     
     // static variables - single copy for all objects of the class	
     static UnbalAndTangentStorage unbalAndTangentArrayMod; //!< array of class wide vectors and matrices
-    static std::vector<const Matrix *> theTransformations; //!< for holding pointers to the T matrices
+    static UnbalAndTangentStorage &getUnbalAndTangentStorageMod(void);
     static int numTransFE;     //!< number of objects    
-    static int transCounter;   //!< a counter used to indicate when to do something
-    static int sizeTransformations; //!< size of theTransformations array
     static Vector dataBuffer;
-    static Vector localKbuffer;
-    static ID dofData;
-    static int sizeBuffer;
+    BlockTransformation transformation; //!< sparse representation of the T matrix.
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
+    void update_transformation(void);
+    const Matrix &transform_tangent(const Matrix &);
+    const Vector &transformed_tangent_times(const Vector &);
  
     friend class AnalysisModel;
     TransformationFE(int tag, Element *theElement);
@@ -135,6 +135,7 @@ class TransformationFE: public FE_Element
     virtual void addM_Force(const Vector &accel, double fact = 1.0);    
     
     const Vector &getLastResponse(void);
+    bool allowsConcurrentStateDetermination(void) const;
     int addSP(SFreedom_Constraint &theSP);
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
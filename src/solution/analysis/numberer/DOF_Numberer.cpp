@@ -65,6 +65,7 @@
 #include "solution/graph/numberer/GraphNumberer.h"
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/AMD.h"
+#include "solution/graph/numberer/NestedDissection.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
 #include <utility/matrix/ID.h>
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
@@ -90,6 +91,8 @@ void XC::DOF_Numberer::alloc(const std::string &str)
       theGraphNumberer=new RCM(); //Reverse Cuthill-Macgee.
     else if(str=="amd")
       theGraphNumberer=new AMD(); //Approximate minimum degree ordering
+    else if(str=="nested_dissection")
+      theGraphNumberer=new NestedDissection(); //Fill-reducing ordering.
     else if(str=="simple")
       theGraphNumberer=new SimpleNumberer();
     else
@@ -0,0 +1,238 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRGraph.cc
+
+#include "CSRGraph.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/Vertex.h"
+#include "solution/graph/graph/VertexIter.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::CSRGraph::CSRGraph(void)
+  {}
+
+//! @brief Return true if the index corresponds to a vertex of the graph.
+bool XC::CSRGraph::in_range(const int &i) const
+  { return ((i>=0) && (i<getNumVertex())); }
+
+//! @brief Free the memory.
+void XC::CSRGraph::clear(void)
+  {
+    int_vector().swap(rowStart);
+    int_vector().swap(adjacency);
+    int_vector().swap(cursor);
+  }
+
+//! @brief Start the construction of a graph with the given number
+//! of vertices (first pass).
+void XC::CSRGraph::reset(const int &numVertex)
+  {
+    adjacency.clear();
+    cursor.clear();
+    rowStart.assign(numVertex+1,0);
+  }
+
+//! @brief Count the edges of the clique defined by the ID
+//! argument (first pass).
+//!
+//! The count is an upper bound of the degree of each vertex;
+//! the repeated edges are removed by compress().
+void XC::CSRGraph::countClique(const ID &id)
+  {
+    const int sz= id.Size();
+    int numValid= 0;
+    for(int i= 0;i<sz;i++)
+      if(in_range(id(i)))
+        numValid++;
+    if(numValid>1)
+      for(int i= 0;i<sz;i++)
+        {
+          const int v= id(i);
+          if(in_range(v))
+            rowStart[v+1]+= numValid-1;
+        }
+  }
+
+//! @brief Allocate the memory for the edges counted in the
+//! first pass.
+void XC::CSRGraph::allocate(void)
+  {
+    const int numVertex= getNumVertex();
+    for(int i= 0;i<numVertex;i++)
+      rowStart[i+1]+= rowStart[i];
+    adjacency.resize(rowStart[numVertex]);
+    cursor.assign(rowStart.begin(),rowStart.end()-1);
+  }
+
+//! @brief Add the edges of the clique defined by the ID argument
+//! (second pass).
+void XC::CSRGraph::addClique(const ID &id)
+  {
+    const int sz= id.Size();
+    for(int i= 0;i<sz;i++)
+      {
+        const int vi= id(i);
+        if(in_range(vi))
+          for(int j= 0;j<sz;j++)
+            {
+              const int vj= id(j);
+              if((vj!=vi) && in_range(vj))
+                adjacency[cursor[vi]++]= vj;
+            }
+      }
+  }
+
+//! @brief Sort the adjacency of each vertex and remove the repeated
+//! edges.
+void XC::CSRGraph::compress(void)
+  {
+    const int numVertex= getNumVertex();
+    int w= 0; // write position.
+    int rowBegin= 0;
+    for(int i= 0;i<numVertex;i++)
+      {
+        int_vector::iterator first= adjacency.begin()+rowBegin;
+        int_vector::iterator last= adjacency.begin()+(cursor.empty() ? rowStart[i+1] : cursor[i]);
+        rowBegin= rowStart[i+1];
+        std::sort(first,last);
+        last= std::unique(first,last);
+        rowStart[i]= w;
+        w+= std::distance(first,last);
+        std::copy(first,last,adjacency.begin()+rowStart[i]);
+      }
+    rowStart[numVertex]= w;
+    adjacency.resize(w);
+    adjacency.shrink_to_fit();
+    int_vector().swap(cursor);
+  }
+
+//! @brief Build the compressed adjacency from the vertices of the
+//! graph argument. The vertex tags must range from START_VERTEX_NUM
+//! to START_VERTEX_NUM+numVertex-1.
+//!
+//! @return 0 if success, -1 if a vertex tag is out of range.
+int XC::CSRGraph::build(const Graph &theGraph)
+  {
+    int retval= 0;
+    const int numVertex= theGraph.getNumVertex();
+    reset(numVertex);
+    Graph &graph_no_const= const_cast<Graph &>(theGraph);
+    Vertex *vertexPtr= nullptr;
+    VertexIter &theVertices= graph_no_const.getVertices();
+    while((vertexPtr= theVertices()) != nullptr)
+      {
+        const int i= vertexPtr->getTag()-START_VERTEX_NUM;
+        if(!in_range(i))
+          {
+            std::cerr << "CSRGraph::" << __FUNCTION__
+                      << "; vertex tag: " << vertexPtr->getTag()
+                      << " out of range [" << START_VERTEX_NUM << ","
+                      << START_VERTEX_NUM+numVertex << ").\n";
+            reset(0);
+            return -1;
+          }
+        rowStart[i+1]= vertexPtr->getAdjacency().size();
+      }
+    allocate();
+    VertexIter &theVertices2= graph_no_const.getVertices();
+    while((vertexPtr= theVertices2()) != nullptr)
+      {
+        const int i= vertexPtr->getTag()-START_VERTEX_NUM;
+        const std::set<int> &adj= vertexPtr->getAdjacency();
+        for(std::set<int>::const_iterator j= adj.begin(); j!=adj.end(); j++)
+          adjacency[cursor[i]++]= *j-START_VERTEX_NUM;
+      }
+    compress();
+    return retval;
+  }
+
+//! @brief Write in the array argument the (sorted) indexes of the
+//! vertices adjacent to the i-th one including the i-th vertex itself
+//! (the diagonal of the adjacency matrix).
+//!
+//! @param i: index of the vertex.
+//! @param dest: destination array (size >= getDegree(i)+1).
+//! @return number of indexes written.
+int XC::CSRGraph::copyWithDiagonal(const int &i, int *dest) const
+  {
+    int retval= 0;
+    const int *p= begin(i);
+    const int *e= end(i);
+    for(;(p!=e) && (*p<i);p++)
+      dest[retval++]= *p;
+    dest[retval++]= i;
+    for(;p!=e;p++)
+      dest[retval++]= *p;
+    return retval;
+  }
+
+//! @brief Return true if the vertices i and j are adjacent.
+bool XC::CSRGraph::isAdjacent(const int &i, const int &j) const
+  { return std::binary_search(begin(i),end(i),j); }
+
+//! @brief Returns the ends of the bandwidth.
+void XC::CSRGraph::getBand(int &numSubD,int &numSuperD) const
+  {
+    numSubD= 0;
+    numSuperD= 0;
+    const int numVertex= getNumVertex();
+    for(int i= 0;i<numVertex;i++)
+      if(getDegree(i)>0)
+        {
+          // adjacency sorted: extreme values at the ends.
+          const int diffSuper= i-*begin(i);
+          const int diffSub= *(end(i)-1)-i;
+          if(diffSuper>numSuperD)
+            numSuperD= diffSuper;
+          if(diffSub>numSubD)
+            numSubD= diffSub;
+        }
+  }
+
+//! @brief Print stuff.
+void XC::CSRGraph::Print(std::ostream &os) const
+  {
+    const int numVertex= getNumVertex();
+    os << "CSRGraph; number of vertices: " << numVertex
+       << " number of edges: " << getNumEdge() << std::endl;
+    for(int i= 0;i<numVertex;i++)
+      {
+        os << i << ": ";
+        for(const int *j= begin(i);j!=end(i);j++)
+          os << *j << " ";
+        os << std::endl;
+      }
+  }
+
+//! @brief Insertion in an output stream.
+std::ostream &XC::operator<<(std::ostream &os, const CSRGraph &g)
+  {
+    g.Print(os);
+    return os;
+  }
@@ -0,0 +1,113 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRGraph.h
+
+
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+#include <vector>
+#include <iostream>
+
+namespace XC {
+class ID;
+class Graph;
+
+//! @ingroup Graph
+//
+//! @brief Adjacency of a graph in compressed sparse row format.
+//!
+//! The vertices are numbered from 0 to n-1 (the vertex tag minus
+//! START_VERTEX_NUM) and the adjacency of the vertex i is stored
+//! in ascending order in adjacency[rowStart[i]:rowStart[i+1]]. The
+//! diagonal (the vertex itself) is not stored.
+//!
+//! The graph of a finite element model is built from the cliques
+//! defined by the element IDs in two passes:
+//!   -# reset(numVertex) then countClique(id) for each element.
+//!   -# allocate() then addClique(id) for each element.
+//! and compress() which sorts the rows and removes the duplicates.
+//! Negative entries of the IDs (constrained DOFs) are ignored. No
+//! per-vertex containers are allocated, so the memory footprint is
+//! two integer arrays.
+class CSRGraph
+  {
+  public:
+    typedef std::vector<int> int_vector;
+  private:
+    int_vector rowStart; //!< start of the adjacency of each vertex (size n+1).
+    int_vector adjacency; //!< adjacent vertices.
+    int_vector cursor; //!< insertion point of each row (only while building).
+    bool in_range(const int &) const;
+  public:
+    CSRGraph(void);
+
+    void clear(void);
+    void reset(const int &);
+    void countClique(const ID &);
+    void allocate(void);
+    void addClique(const ID &);
+    void compress(void);
+    int build(const Graph &);
+
+    //! @brief Return the number of vertices.
+    inline int getNumVertex(void) const
+      { return (rowStart.empty() ? 0 : rowStart.size()-1); }
+    //! @brief Return the number of edges.
+    inline int getNumEdge(void) const
+      { return adjacency.size()/2; }
+    //! @brief Return the degree of the i-th vertex.
+    inline int getDegree(const int &i) const
+      { return rowStart[i+1]-rowStart[i]; }
+    //! @brief Return a pointer to the first vertex adjacent to the i-th one.
+    inline const int *begin(const int &i) const
+      { return adjacency.data()+rowStart[i]; }
+    //! @brief Return a pointer past the last vertex adjacent to the i-th one.
+    inline const int *end(const int &i) const
+      { return adjacency.data()+rowStart[i+1]; }
+    //! @brief Return the row start array.
+    inline const int_vector &getRowStart(void) const
+      { return rowStart; }
+    //! @brief Return the adjacency array.
+    inline const int_vector &getAdjacency(void) const
+      { return adjacency; }
+    //! @brief Return the number of entries of the adjacency matrix
+    //! including the diagonal.
+    inline int getNumEntriesWithDiagonal(void) const
+      { return adjacency.size()+getNumVertex(); }
+    int copyWithDiagonal(const int &, int *) const;
+    bool isAdjacent(const int &, const int &) const;
+    void getBand(int &,int &) const;
+
+    void Print(std::ostream &os) const;
+  };
+
+std::ostream &operator<<(std::ostream &, const CSRGraph &);
+} // end of XC namespace
+
+#endif
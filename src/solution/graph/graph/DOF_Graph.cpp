@@ -70,75 +70,51 @@
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include <solution/analysis/model/FE_EleIter.h>
 
-#define START_EQN_NUM 0
 
 //! @brief Constructor.
 //!
 //! The constructor is responsible for constructing the graph given {\em
-//! theModel}. It creates the vertices of the graph, one for every
-//! DOF in the model and adds all edges based on the FE\_Element
-//! connectivity. For this reason the model must be fully populated with
-//! the DOF\_Group and FE\_Element objects before the constructor is
-//! called.
+//! theModel}. The graph has one vertex for every equation of the
+//! model and its edges are obtained from the FE\_Element
+//! connectivity. The adjacency is built in compressed form (two
+//! passes over the elements, see CSRGraph); the Vertex objects are
+//! created only if requested (see ModelGraph). For this reason the
+//! model must be fully populated with the DOF\_Group and FE\_Element
+//! objects and numbered before the constructor is called.
 XC::DOF_Graph::DOF_Graph(const AnalysisModel &theModel)
-  :ModelGraph(theModel.getNumEqn(),theModel)
+  :ModelGraph(32,theModel)
   {
-    //
-    // create a vertex for each dof
-    //
     assert(myModel);
-    const DOF_Group *dofPtr= nullptr;
-    DOF_GrpConstIter &theDOFs= myModel->getConstDOFs();
-    while((dofPtr= theDOFs()) != 0)
-      {
-        const ID &id= dofPtr->getID();
-        const int size= id.Size();
-        for(int i=0; i<size; i++)
-          {
-            int dofTag= id(i);
-            if(dofTag >= START_EQN_NUM)
-              {
-	        Vertex *vertexPtr= this->getVertexPtr(dofTag);
-	        if(!vertexPtr)
-                  {
-	            Vertex vrt(dofTag, dofTag);      
-	            if(this->addVertex(vrt, false) == false)
-                      { std::cerr << "WARNING DOF_Graph::DOF_Graph - error adding vertex\n"; }
-	          }
-              }
-          }
-      }
+    const int numEqn= myModel->getNumEqn();
+    csr.reset(numEqn);
 
-    // now add the edges, by looping over the FE_elements, getting their
-    // IDs and adding edges between DOFs for equation numbers >= START_EQN_NUM
-  
+    // count the edges, by looping over the FE_elements, getting their
+    // IDs (equation numbers; negative ones are ignored).
     const FE_Element *elePtr= nullptr;
     FE_EleConstIter &eleIter= myModel->getConstFEs();
-    int cnt= 0;
+    while((elePtr= eleIter()) != nullptr)
+      csr.countClique(elePtr->getID());
+
+    // now add the edges.
+    csr.allocate();
+    FE_EleConstIter &eleIter2= myModel->getConstFEs();
+    while((elePtr= eleIter2()) != nullptr)
+      csr.addClique(elePtr->getID());
+    csr.compress();
+    csrUpToDate= true;
+  }
 
-    while((elePtr= eleIter()) != 0)
+//! @brief Create a vertex for each equation.
+void XC::DOF_Graph::create_vertices(const CSRGraph &g)
+  {
+    const int numVertex= g.getNumVertex();
+    if(numVertex>0)
+      inic(numVertex);
+    for(int i= 0;i<numVertex;i++)
       {
-        const ID &id= elePtr->getID();
-        cnt++;
-        const int size= id.Size();
-        for(int i=0; i<size; i++)
-          {
-            const int eqn1= id(i);
-	    
-            // if eqnNum of DOF is a valid eqn number add an edge
-            // to all other DOFs with valid eqn numbers.
-            if(eqn1 >=START_EQN_NUM)
-              {
-	        for(int j=i+1; j<size; j++)
-                  {
-	            const int eqn2= id(j);
-	            if(eqn2 >=START_EQN_NUM)
-	            this->addEdge(eqn1-START_EQN_NUM+START_VERTEX_NUM,eqn2-START_EQN_NUM+START_VERTEX_NUM);
-	          }
-              }
-          }
+        const int vertexTag= i+START_VERTEX_NUM;
+        Vertex vrt(vertexTag, vertexTag);
+        if(this->Graph::addVertex(vrt, false) == false)
+          { std::cerr << "WARNING DOF_Graph::DOF_Graph - error adding vertex\n"; }
       }
   }
-
-
-
@@ -88,6 +88,7 @@ class DOF_Graph: public ModelGraph
   protected:
     friend class AnalysisModel;
     DOF_Graph(const AnalysisModel &theModel);
+    void create_vertices(const CSRGraph &);
   };
 } // end of XC namespace
 
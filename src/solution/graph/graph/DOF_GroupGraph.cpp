@@ -70,57 +70,56 @@
 //! @brief Constructor.
 //!
 //! The constructor is responsible for constructing the graph given {\em
-//! theModel}. It creates the vertices of the graph, one for every
-//! equation  (each DOF that has not been constrained out by the
-//! constraint handler)  in the model and adds all edges based on the
-//! FE\_Element connectivity. For this reason the model must be fully
-//! populated with the DOF\_Group and FE\_Element objects before
-// the constructor is called.
+//! theModel}. The graph has one vertex for every DOF\_Group of the
+//! model (the vertex tag is the DOF\_Group tag) and its edges are
+//! obtained from the FE\_Element connectivity. The adjacency is built
+//! in compressed form (two passes over the elements, see CSRGraph);
+//! the Vertex objects are created only if requested (see
+//! ModelGraph). For this reason the model must be fully populated
+//! with the DOF\_Group and FE\_Element objects before the
+//! constructor is called.
 XC::DOF_GroupGraph::DOF_GroupGraph(const AnalysisModel &theModel)
-  :ModelGraph(theModel.getNumDOF_Groups()+START_VERTEX_NUM,theModel)
+  :ModelGraph(32,theModel)
   {
     assert(myModel);
     const int numVertex= myModel->getNumDOF_Groups();
+    csr.reset(numVertex);
+    if(numVertex>0)
+      {
+        // count the edges, by looping over the Elements, getting their
+        // DOF_Group tags.
+        const FE_Element *elePtr= nullptr;
+        FE_EleConstIter &eleIter= myModel->getConstFEs();
+        while((elePtr= eleIter()) != nullptr)
+          csr.countClique(elePtr->getDOFtags());
+
+        // now add the edges.
+        csr.allocate();
+        FE_EleConstIter &eleIter2= myModel->getConstFEs();
+        while((elePtr= eleIter2()) != nullptr)
+          csr.addClique(elePtr->getDOFtags());
+        csr.compress();
+      }
+    csrUpToDate= true;
+  }
 
+//! @brief Create the vertices with a reference equal to the
+//! DOF_Group number and a tag which ranges from 0 through numVertex-1
+void XC::DOF_GroupGraph::create_vertices(const CSRGraph &g)
+  {
+    const int numVertex= g.getNumVertex();
     if(numVertex>0)
       {
-	
+        inic(numVertex);
         const DOF_Group *dofGroupPtr= nullptr;
-
-        // now create the vertices with a reference equal to the DOF_Group number.
-        // and a tag which ranges from 0 through numVertex-1
         DOF_GrpConstIter &dofIter2 = myModel->getConstDOFs();
-        while((dofGroupPtr = dofIter2()) != 0)
+        while((dofGroupPtr = dofIter2()) != nullptr)
           {
 	    const int DOF_GroupTag = dofGroupPtr->getTag();
             const int DOF_GroupNodeTag = dofGroupPtr->getNodeTag();
 	    const int numDOF = dofGroupPtr->getNumFreeDOF();
             Vertex vrt(DOF_GroupTag, DOF_GroupNodeTag, 0, numDOF);
-            this->addVertex(vrt);
-          }
-
-
-        // now add the edges, by looping over the Elements, getting their
-        // IDs and adding edges between DOFs for equation numbers >= START_EQN_NUM
-    
-        const FE_Element *elePtr= nullptr;
-        FE_EleConstIter &eleIter = myModel->getConstFEs();
-        while((elePtr = eleIter()) != 0)
-          {
-	    const ID &id= elePtr->getDOFtags();
-	    const int size = id.Size();
-            for(int i=0; i<size; i++)
-              {
-	        int dof1 = id(i);
-	        for(int j=0; j<size; j++)
-                  if(i != j)
-                    {
-		      const int dof2 = id(j);
-		      this->addEdge(dof1,dof2);
-		    }
-	      }
+            this->Graph::addVertex(vrt);
           }
       }
   }
-
-
@@ -85,6 +85,7 @@ class DOF_GroupGraph: public ModelGraph
   protected:
     friend class AnalysisModel;
     DOF_GroupGraph(const AnalysisModel &theModel);
+    void create_vertices(const CSRGraph &);
   };
 } // end of XC namespace
 
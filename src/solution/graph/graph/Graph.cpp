@@ -63,18 +63,32 @@
 #include <cstdlib>
 
 void XC::Graph::inic(const size_t &sz)
-  { myVertices= ArrayOfTaggedObjects(nullptr,sz,"vertice"); }
+  {
+    myVertices= ArrayOfTaggedObjects(nullptr,sz,"vertice");
+    invalidateCSR();
+  }
+
+//! @brief Marks the compressed adjacency as outdated (to call
+//! each time the vertices or the edges change).
+void XC::Graph::invalidateCSR(void)
+  {
+    csrUpToDate= false;
+    csr.clear();
+  }
 
+//!
+//! The calls are qualified so the copy is not affected by the
+//! way the derived classes store (or defer) their vertices.
 void XC::Graph::copy(const Graph &other)
   {
-    const size_t numVertex= other.getNumVertex();
+    const size_t numVertex= other.Graph::getNumVertex();
     if(numVertex>0)
       {
         inic(numVertex);
 
         Graph &other_no_const= const_cast<Graph &>(other);
 
-        VertexIter &otherVertices= other_no_const.getVertices();
+        VertexIter &otherVertices= other_no_const.Graph::getVertices();
         Vertex *vertexPtr= nullptr;
 
         // loop through other creating vertices if tag not the same in this
@@ -83,18 +97,18 @@ void XC::Graph::copy(const Graph &other)
             const int vertexTag= vertexPtr->getTag();
             const int vertexRef= vertexPtr->getRef();
             Vertex newVertex(vertexTag, vertexRef);
-            this->addVertex(newVertex, false);
+            this->Graph::addVertex(newVertex, false);
           }
 
         // loop through other adding all the edges that exist in other
-        VertexIter &otherVertices2 = other_no_const.getVertices();
+        VertexIter &otherVertices2 = other_no_const.Graph::getVertices();
         while((vertexPtr = otherVertices2()) != nullptr)
           {
             int vertexTag = vertexPtr->getTag();
             const std::set<int> &adjacency= vertexPtr->getAdjacency();
             for(std::set<int>::const_iterator i=adjacency.begin(); i!=adjacency.end(); i++)
               {
-                if(this->addEdge(vertexTag, *i) < 0)
+                if(this->Graph::addEdge(vertexTag, *i) < 0)
                   {
 	            std::cerr << "Graph::" << __FUNCTION__
 		              << "; could not add an edge!\n";
@@ -110,17 +124,19 @@ void XC::Graph::copy(const Graph &other)
 	nextFreeTag= START_VERTEX_NUM;
       }
     theVertexIter= VertexIter(&myVertices);
+    csr= other.csr;
+    csrUpToDate= other.csrUpToDate;
   }
 
 //! @brief Constructor.
 //!
 //! To create an empty Graph.
 XC::Graph::Graph(int numVertices)
-  :MovableObject(Graph_TAG), myVertices(nullptr,numVertices,"vertice"), theVertexIter(&myVertices), numEdge(0), nextFreeTag(START_VERTEX_NUM) {}
+  :MovableObject(Graph_TAG), myVertices(nullptr,numVertices,"vertice"), theVertexIter(&myVertices), numEdge(0), nextFreeTag(START_VERTEX_NUM), csrUpToDate(false) {}
 
 //! @brief Copy constructor.
 XC::Graph::Graph(const Graph &other) 
-  :MovableObject(other), myVertices(nullptr,32,"vertice"), theVertexIter(&myVertices), numEdge(0), nextFreeTag(START_VERTEX_NUM)
+  :MovableObject(other), myVertices(nullptr,32,"vertice"), theVertexIter(&myVertices), numEdge(0), nextFreeTag(START_VERTEX_NUM), csrUpToDate(false)
   { copy(other); }
 
 //! @brief Assignment operator.
@@ -173,6 +189,7 @@ bool XC::Graph::addVertex(const Vertex &vrt, bool checkAdjacency)
 
     const int tag= vertexPtr->getTag();
     bool result = myVertices.addComponent(vertexPtr);
+    invalidateCSR();
     if(result == false)
       std::cerr << *this
 	        << typeid(Graph).name() << "::" << __FUNCTION__
@@ -219,6 +236,7 @@ int XC::Graph::addEdge(int vertexTag, int otherVertexTag)
       {
         // add an edge to each vertex
         int result = vertex1->addEdge(otherVertexTag);
+        invalidateCSR();
         if(result == 1)
           retval= 0;  // already there
         else if(result == 0)
@@ -325,6 +343,7 @@ bool XC::Graph::removeVertex(int tag, bool flag)
 		      << "; no code to remove edges yet\n";
           }
         myVertices.removeComponent(tag);
+        invalidateCSR();
         retval= true;
       }
     return retval;
@@ -375,36 +394,27 @@ int XC::Graph::merge(Graph &other)
     return result;
   }
 
-//! @brief Returns the ends of the bandwidth.
-void XC::Graph::getBand(int &numSubD,int &numSuperD) const
+//! @brief Returns the compressed adjacency of the graph.
+//!
+//! The compressed (CSR) adjacency is built from the vertices the
+//! first time it is requested and kept until the graph changes
+//! (vertices or edges added or removed through the graph
+//! interface). The vertex tags must range from START_VERTEX_NUM to
+//! START_VERTEX_NUM+numVertex-1 (see CSRGraph::build).
+const XC::CSRGraph &XC::Graph::getCSR(void) const
   {
-    numSubD = 0;
-    numSuperD = 0;
-    Vertex *vertexPtr;
-    Graph *this_no_const= const_cast<Graph *>(this);
-    VertexIter &theVertices= this_no_const->getVertices();
-    
-    while((vertexPtr = theVertices()) != 0)
+    if(!csrUpToDate)
       {
-        const int vertexNum= vertexPtr->getTag();
-        const std::set<int> &theAdjacency= vertexPtr->getAdjacency();
-        for(std::set<int>::const_iterator i= theAdjacency.begin(); i!= theAdjacency.end(); i++)
-          {
-            const int otherNum= *i;
-            const int diff= vertexNum - otherNum;
-	    if(diff > 0)
-              {
-                if(diff > numSuperD)
-                  numSuperD = diff;
-	      }
-            else 
-              if(diff < numSubD)
-	        numSubD = diff;
-          }
+        csr.build(*this);
+        csrUpToDate= true;
       }
-    numSubD*= -1;
+    return csr;
   }
 
+//! @brief Returns the ends of the bandwidth.
+void XC::Graph::getBand(int &numSubD,int &numSuperD) const
+  { getCSR().getBand(numSubD,numSuperD); }
+
 //! @brief Returns the maximum (positive) of the difference between
 //! vertices indexes.
 int XC::Graph::getVertexDiffMaxima(void) const
@@ -486,6 +496,7 @@ int XC::Graph::recvData(const Communicator &comm)
     //setTag(getDbTagDataPos(0));
     int res= comm.receiveInts(numEdge,nextFreeTag,getDbTagData(),CommMetaData(2));
     res+= myVertices.receive<Vertex>(getDbTagDataPos(3),comm,&FEM_ObjectBroker::getNewVertex);
+    invalidateCSR();
     return res;
   }
 
@@ -68,6 +68,7 @@
 #include "utility/actor/actor/MovableObject.h"
 #include "utility/tagged/storage/ArrayOfTaggedObjects.h"
 #include "solution/graph/graph/VertexIter.h"
+#include "solution/graph/graph/CSRGraph.h"
 
 namespace XC {
 class Vertex;
@@ -98,8 +99,11 @@ class Graph: public MovableObject
     VertexIter theVertexIter;
     int numEdge;
     int nextFreeTag;
+    mutable CSRGraph csr; //!< compressed adjacency (cache).
+    mutable bool csrUpToDate; //!< true if csr corresponds to the vertices.
 
     void inic(const size_t &);
+    void invalidateCSR(void);
     void copy(const Graph &other);
     int sendData(Communicator &);
     int recvData(const Communicator &);
@@ -123,6 +127,7 @@ class Graph: public MovableObject
     void getBand(int &,int &) const;
     int getVertexDiffMaxima(void) const;
     int getVertexDiffExtrema(void) const;
+    virtual const CSRGraph &getCSR(void) const;
 
 
     virtual int merge(Graph &other);
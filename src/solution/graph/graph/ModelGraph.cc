@@ -63,10 +63,123 @@
 
 
 #include <solution/graph/graph/ModelGraph.h>
+#include <solution/graph/graph/Vertex.h>
 
 //! @brief Constructor.
 XC::ModelGraph::ModelGraph(int numVertices,const AnalysisModel &theModel)
-  :Graph(numVertices), myModel(&theModel) {}
+  :Graph(numVertices), myModel(&theModel), verticesReady(false) {}
+
+//! @brief Create the Vertex objects from the compressed adjacency
+//! (if not already created).
+void XC::ModelGraph::materialize(void) const
+  {
+    if(!verticesReady)
+      {
+        ModelGraph *this_no_const= const_cast<ModelGraph *>(this);
+        // adding vertices and edges invalidates the compressed
+        // adjacency, so keep it aside meanwhile.
+        CSRGraph tmp;
+        std::swap(tmp, csr);
+        this_no_const->create_vertices(tmp);
+        const int numVertex= tmp.getNumVertex();
+        for(int i= 0;i<numVertex;i++)
+          for(const int *j= tmp.begin(i);j!=tmp.end(i);j++)
+            if(*j>i)
+              this_no_const->Graph::addEdge(i+START_VERTEX_NUM, *j+START_VERTEX_NUM);
+        std::swap(tmp, csr);
+        csrUpToDate= true;
+        verticesReady= true;
+      }
+  }
+
+//! @brief Appends a vertex to the graph.
+bool XC::ModelGraph::addVertex(const Vertex &vrt, bool checkAdjacency)
+  {
+    materialize();
+    return Graph::addVertex(vrt, checkAdjacency);
+  }
+
+//! @brief Adds an edge to the graph.
+int XC::ModelGraph::addEdge(int vertexTag, int otherVertexTag)
+  {
+    materialize();
+    return Graph::addEdge(vertexTag, otherVertexTag);
+  }
+
+//! @brief Returns a pointer to the vertex identified by the tag being passed as parameter.
+XC::Vertex *XC::ModelGraph::getVertexPtr(int vertexTag)
+  {
+    materialize();
+    return Graph::getVertexPtr(vertexTag);
+  }
+
+//! @brief Returns a pointer to the vertex identified by the tag being passed as parameter.
+const XC::Vertex *XC::ModelGraph::getVertexPtr(int vertexTag) const
+  {
+    materialize();
+    return Graph::getVertexPtr(vertexTag);
+  }
+
+//! @brief Returns an iterator to the vertices of the graph.
+XC::VertexIter &XC::ModelGraph::getVertices(void)
+  {
+    materialize();
+    return Graph::getVertices();
+  }
+
+//! @brief Return the number of vertices in the graph.
+int XC::ModelGraph::getNumVertex(void) const
+  {
+    int retval= 0;
+    if(verticesReady)
+      retval= Graph::getNumVertex();
+    else
+      retval= csr.getNumVertex();
+    return retval;
+  }
+
+//! @brief Return the number of edges in the graph.
+int XC::ModelGraph::getNumEdge(void) const
+  {
+    int retval= 0;
+    if(verticesReady)
+      retval= Graph::getNumEdge();
+    else
+      retval= csr.getNumEdge();
+    return retval;
+  }
+
+//! @brief Removes from the graph the vertex identified by
+//! the tag being passed as parameter.
+bool XC::ModelGraph::removeVertex(int tag, bool flag)
+  {
+    materialize();
+    return Graph::removeVertex(tag, flag);
+  }
+
+//! @brief Prints the graph.
+void XC::ModelGraph::Print(std::ostream &os, int flag) const
+  {
+    if(verticesReady)
+      Graph::Print(os, flag);
+    else
+      csr.Print(os);
+  }
+
+//! @brief Sends object through the communicator argument.
+int XC::ModelGraph::sendSelf(Communicator &comm)
+  {
+    materialize();
+    return Graph::sendSelf(comm);
+  }
+
+//! @brief Receives object through the communicator argument.
+int XC::ModelGraph::recvSelf(const Communicator &comm)
+  {
+    const int retval= Graph::recvSelf(comm);
+    verticesReady= true;
+    return retval;
+  }
 
 
 
@@ -38,12 +38,37 @@ class AnalysisModel;
 //! @ingroup Graph
 //
 //! @brief Base class for model graph.
+//!
+//! The adjacency of the model graphs is built directly in
+//! compressed form (see CSRGraph) from the element connectivity. The
+//! Vertex objects (and their adjacency sets) are created only when
+//! some client asks for them (vertex pointers or vertex iterator),
+//! so the solvers and numberers that work with the compressed
+//! adjacency (see Graph::getCSR) don't pay for them.
 class ModelGraph: public Graph
   {
   protected:
     const AnalysisModel *myModel;
+    mutable bool verticesReady; //!< true if the Vertex objects exist.
 
     ModelGraph(int numVertices,const AnalysisModel &theModel);
+    //! @brief Create the vertices of the graph (without edges).
+    virtual void create_vertices(const CSRGraph &)= 0;
+    void materialize(void) const;
+  public:
+    virtual bool addVertex(const Vertex &vertexPtr, bool checkAdjacency = true);
+    virtual int addEdge(int vertexTag, int otherVertexTag);
+    
+    virtual Vertex *getVertexPtr(int vertexTag);
+    virtual const Vertex *getVertexPtr(int vertexTag) const;
+    virtual VertexIter &getVertices(void);
+    virtual int getNumVertex(void) const;
+    virtual int getNumEdge(void) const;
+    virtual bool removeVertex(int tag, bool removeEdgeFlag = true);
+
+    virtual void Print(std::ostream &os, int flag =0) const;
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);
   };
 } // end of XC namespace
 
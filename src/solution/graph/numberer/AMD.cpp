@@ -56,8 +56,8 @@
 
 #include "AMD.h"
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include "solution/graph/graph/Vertex.h"
-#include "solution/graph/graph/VertexIter.h"
 #include "utility/matrix/ID.h"
 #include "suitesparse/amd.h"
 
@@ -79,40 +79,15 @@ const XC::ID &XC::AMD::number(Graph &theGraph, int startVertex)
 
     theRefResult.resize(numVertex);
 
-    int nnz = 0;
-    Vertex *vertexPtr;
-    VertexIter &vertexIter = theGraph.getVertices();
-
-    while ((vertexPtr = vertexIter()) != 0)
-      {
-        const std::set<int> &adjacency = vertexPtr->getAdjacency();
-        nnz+= adjacency.size();
-      }
-
+    // the compressed adjacency of the graph is already the
+    // input that AMD expects (column pointers and row indexes).
+    const CSRGraph &g= theGraph.getCSR();
     std::vector<int> P(numVertex);
-    std::vector<int> Ap(numVertex+1);
-    std::vector<int> Ai(nnz);
-    //double Control[AMD_CONTROL];
-    //double Info[AMD_INFO];
-
-    VertexIter &vertexIter2 = theGraph.getVertices();
-
-    nnz = 0;
-    int count = 1;
-    Ap[0] = 0;
-
-    while((vertexPtr = vertexIter2()) != 0)
-      {
-        const std::set<int> &adjacency = vertexPtr->getAdjacency();
-        for(std::set<int>::const_iterator i= adjacency.begin(); i!= adjacency.end(); i++)
-	  { Ai[nnz++]= *i; }
-        Ap[count++] = nnz;
-      }  
 
-    amd_order(numVertex, Ap.data(), Ai.data(), P.data(), (double *)nullptr, (double *)nullptr);
+    amd_order(numVertex, g.getRowStart().data(), g.getAdjacency().data(), P.data(), (double *)nullptr, (double *)nullptr);
 
     for(int i=0; i<numVertex; i++)
-      theRefResult[i] = P[i];
+      theRefResult[i] = P[i]+START_VERTEX_NUM;
 
     return theRefResult;
   }
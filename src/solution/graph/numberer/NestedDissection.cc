@@ -0,0 +1,449 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissection.cc
+
+#include "NestedDissection.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include "solution/graph/graph/Vertex.h"
+#include "utility/matrix/ID.h"
+#include "suitesparse/amd.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::NestedDissection::NestedDissection(void)
+  : BaseNumberer(GraphNUMBERER_TAG_NestedDissection), maxCacheSize(4), leafSize(64), numCacheHits(0), nextLabel(0) {}
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::NestedDissection::getCopy(void) const
+  { return new NestedDissection(*this); }
+
+//! @brief Return the maximum number of cached orderings.
+size_t XC::NestedDissection::getMaxCacheSize(void) const
+  { return maxCacheSize; }
+
+//! @brief Set the maximum number of cached orderings (zero disables
+//! the cache).
+void XC::NestedDissection::setMaxCacheSize(const size_t &sz)
+  {
+    maxCacheSize= sz;
+    if(cache.size()>maxCacheSize)
+      cache.resize(maxCacheSize);
+  }
+
+//! @brief Return the size of the subgraphs that are ordered using
+//! the approximate minimum degree algorithm.
+int XC::NestedDissection::getLeafSize(void) const
+  { return leafSize; }
+
+//! @brief Set the size of the subgraphs that are ordered using
+//! the approximate minimum degree algorithm.
+void XC::NestedDissection::setLeafSize(const int &sz)
+  {
+    if(sz!=leafSize)
+      {
+        leafSize= std::max(sz,2);
+        clearCache(); // cached orderings obsolete.
+      }
+  }
+
+//! @brief Return the number of orderings taken from the cache.
+size_t XC::NestedDissection::getNumCacheHits(void) const
+  { return numCacheHits; }
+
+//! @brief Remove the cached orderings.
+void XC::NestedDissection::clearCache(void)
+  { cache.clear(); }
+
+//! @brief Return a hash (FNV-1a) of the graph topology.
+uint64_t XC::NestedDissection::topology_hash(const CSRGraph &g)
+  {
+    uint64_t retval= 14695981039346656037ULL;
+    const uint64_t prime= 1099511628211ULL;
+    const CSRGraph::int_vector &rowStart= g.getRowStart();
+    for(CSRGraph::int_vector::const_iterator i= rowStart.begin(); i!=rowStart.end(); i++)
+      { retval^= static_cast<uint32_t>(*i); retval*= prime; }
+    const CSRGraph::int_vector &adjacency= g.getAdjacency();
+    for(CSRGraph::int_vector::const_iterator i= adjacency.begin(); i!=adjacency.end(); i++)
+      { retval^= static_cast<uint32_t>(*i); retval*= prime; }
+    return retval;
+  }
+
+//! @brief Compute the level structure rooted at the given vertex of
+//! the subgraph whose vertices are labelled with lbl.
+//!
+//! @param g: graph.
+//! @param root: index of the root vertex.
+//! @param lbl: label of the subgraph.
+//! @param part: vertices of the subgraph.
+//! @param bfs: on return, vertices of the connected component of
+//!             the root in breadth-first order (so sorted by level).
+//! @return number of levels.
+int XC::NestedDissection::level_structure(const CSRGraph &g, const int &root, const int &lbl, const int_vector &part, int_vector &bfs)
+  {
+    for(int_vector::const_iterator i= part.begin(); i!=part.end(); i++)
+      level[*i]= -1;
+    bfs.clear();
+    bfs.push_back(root);
+    level[root]= 0;
+    size_t head= 0;
+    while(head<bfs.size())
+      {
+        const int v= bfs[head++];
+        const int nextLevel= level[v]+1;
+        for(const int *i= g.begin(v); i!=g.end(v); i++)
+          {
+            const int w= *i;
+            if((label[w]==lbl) && (level[w]<0))
+              {
+                level[w]= nextLevel;
+                bfs.push_back(w);
+              }
+          }
+      }
+    return level[bfs.back()]+1;
+  }
+
+//! @brief Search for a pseudo-peripheral vertex of the connected
+//! subgraph (George and Liu algorithm) and compute its level structure.
+//!
+//! @param g: graph.
+//! @param lbl: label of the subgraph.
+//! @param part: vertices of the subgraph.
+//! @param bfs: on return, vertices of the subgraph in breadth-first
+//!             order from the pseudo-peripheral vertex.
+//! @param numLevels: on return, number of levels of the structure.
+//! @return index of the pseudo-peripheral vertex.
+int XC::NestedDissection::pseudo_peripheral_vertex(const CSRGraph &g, const int &lbl, const int_vector &part, int_vector &bfs, int &numLevels)
+  {
+    // start with a vertex of minimum degree.
+    int retval= part.front();
+    for(int_vector::const_iterator i= part.begin(); i!=part.end(); i++)
+      if(g.getDegree(*i)<g.getDegree(retval))
+        retval= *i;
+    numLevels= level_structure(g, retval, lbl, part, bfs);
+    const int maxIter= 8;
+    for(int iter= 0; iter<maxIter; iter++)
+      {
+        // minimum degree vertex of the last level.
+        int candidate= bfs.back();
+        for(int_vector::const_reverse_iterator i= bfs.rbegin(); (i!=bfs.rend()) && (level[*i]==numLevels-1); i++)
+          if(g.getDegree(*i)<g.getDegree(candidate))
+            candidate= *i;
+        int_vector candidateBfs;
+        const int candidateLevels= level_structure(g, candidate, lbl, part, candidateBfs);
+        if(candidateLevels>numLevels)
+          {
+            retval= candidate;
+            numLevels= candidateLevels;
+            bfs.swap(candidateBfs);
+          }
+        else
+          {
+            // the levels of the returned structure were overwritten.
+            level_structure(g, retval, lbl, part, bfs);
+            break;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Split the subgraph in its connected components in a single
+//! breadth-first sweep. The vertices of the first component keep
+//! the label of the subgraph, the other components get a new one.
+//!
+//! @param g: graph.
+//! @param lbl: label of the subgraph.
+//! @param part: vertices of the subgraph.
+//! @param components: on return, vertices of each component.
+//! @return number of components.
+size_t XC::NestedDissection::connected_components(const CSRGraph &g, const int &lbl, const int_vector &part, std::vector<int_vector> &components)
+  {
+    components.clear();
+    for(int_vector::const_iterator i= part.begin(); i!=part.end(); i++)
+      level[*i]= -1;
+    for(int_vector::const_iterator i= part.begin(); i!=part.end(); i++)
+      {
+        if(level[*i]>=0) // already visited.
+          continue;
+        const int componentLabel= components.empty() ? lbl : nextLabel++;
+        components.push_back(int_vector());
+        int_vector &bfs= components.back();
+        bfs.push_back(*i);
+        level[*i]= 0;
+        size_t head= 0;
+        while(head<bfs.size())
+          {
+            const int v= bfs[head++];
+            for(const int *j= g.begin(v); j!=g.end(v); j++)
+              {
+                const int w= *j;
+                if((label[w]==lbl) && (level[w]<0))
+                  {
+                    level[w]= 0;
+                    bfs.push_back(w);
+                  }
+              }
+          }
+        if(componentLabel!=lbl)
+          for(int_vector::const_iterator j= bfs.begin(); j!=bfs.end(); j++)
+            label[*j]= componentLabel;
+      }
+    return components.size();
+  }
+
+//! @brief Order the vertices of the subgraph using the approximate
+//! minimum degree algorithm.
+//!
+//! @param g: graph.
+//! @param part: vertices of the subgraph.
+void XC::NestedDissection::order_leaf(const CSRGraph &g, const int_vector &part)
+  {
+    const int n= part.size();
+    if(n<3)
+      {
+        order.insert(order.end(), part.begin(), part.end());
+        return;
+      }
+    const int lbl= label[part.front()];
+    for(int i= 0; i<n; i++)
+      localIndex[part[i]]= i;
+    // adjacency of the induced subgraph.
+    int_vector Ap(n+1,0);
+    int_vector Ai;
+    for(int i= 0; i<n; i++)
+      {
+        const int v= part[i];
+        for(const int *j= g.begin(v); j!=g.end(v); j++)
+          if(label[*j]==lbl)
+            Ai.push_back(localIndex[*j]);
+        Ap[i+1]= Ai.size();
+      }
+    int_vector P(n);
+    const int status= amd_order(n, Ap.data(), Ai.data(), P.data(), (double *)nullptr, (double *)nullptr);
+    if(status<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; AMD failed (status: " << status
+                  << "); natural order used." << std::endl;
+        order.insert(order.end(), part.begin(), part.end());
+      }
+    else
+      for(int i= 0; i<n; i++)
+        order.push_back(part[P[i]]);
+  }
+
+//! @brief Order the vertices of the subgraph: the vertices of the
+//! parts obtained by removing a separator first, then the vertices
+//! of the separator.
+//!
+//! @param g: graph.
+//! @param lbl: label of the subgraph.
+//! @param part: vertices of the subgraph (consumed).
+void XC::NestedDissection::dissect(const CSRGraph &g, const int &lbl, int_vector &part)
+  {
+    const int n= part.size();
+    if(n<=leafSize)
+      {
+        order_leaf(g, part);
+        return;
+      }
+    std::vector<int_vector> components;
+    if(connected_components(g, lbl, part, components)>1) // disconnected.
+      {
+        int_vector().swap(part);
+        for(std::vector<int_vector>::iterator i= components.begin(); i!=components.end(); i++)
+          dissect(g, label[i->front()], *i);
+        return;
+      }
+    std::vector<int_vector>().swap(components);
+    int_vector bfs;
+    int numLevels= 0;
+    pseudo_peripheral_vertex(g, lbl, part, bfs, numLevels);
+    if(numLevels<3) // no separator (dense subgraph).
+      {
+        order_leaf(g, part);
+        return;
+      }
+    // level sizes.
+    int_vector levelStart(numLevels+1,0);
+    for(int_vector::const_iterator i= bfs.begin(); i!=bfs.end(); i++)
+      levelStart[level[*i]+1]++;
+    for(int k= 0; k<numLevels; k++)
+      levelStart[k+1]+= levelStart[k];
+    // choose the smallest level that gives a balanced partition
+    // (the level closest to the middle if there is none).
+    const double minFraction= 0.25;
+    int sep= -1;
+    int bestBalanced= -1;
+    int bestImbalance= n;
+    for(int k= 1; k<numLevels-1; k++)
+      {
+        const int below= levelStart[k];
+        const int sz= levelStart[k+1]-levelStart[k];
+        const int above= n-levelStart[k+1];
+        if(std::min(below,above)>=minFraction*(below+above))
+          {
+            if((bestBalanced<0) || (sz<(levelStart[bestBalanced+1]-levelStart[bestBalanced])))
+              bestBalanced= k;
+          }
+        const int imbalance= std::abs(above-below);
+        if(imbalance<bestImbalance)
+          {
+            bestImbalance= imbalance;
+            sep= k;
+          }
+      }
+    if(bestBalanced>=0)
+      sep= bestBalanced;
+    // split the subgraph.
+    const int labelA= nextLabel++;
+    const int labelB= nextLabel++;
+    const int labelS= nextLabel++;
+    int_vector A(bfs.begin(), bfs.begin()+levelStart[sep]);
+    int_vector S(bfs.begin()+levelStart[sep], bfs.begin()+levelStart[sep+1]);
+    int_vector B(bfs.begin()+levelStart[sep+1], bfs.end());
+    int_vector().swap(part);
+    int_vector().swap(bfs);
+    for(int_vector::const_iterator i= A.begin(); i!=A.end(); i++)
+      label[*i]= labelA;
+    for(int_vector::const_iterator i= B.begin(); i!=B.end(); i++)
+      label[*i]= labelB;
+    for(int_vector::const_iterator i= S.begin(); i!=S.end(); i++)
+      label[*i]= labelS;
+    // thin the separator: the vertices not adjacent to one of the
+    // parts can be moved to the other one.
+    int_vector thinS;
+    thinS.reserve(S.size());
+    for(int_vector::const_iterator i= S.begin(); i!=S.end(); i++)
+      {
+        const int v= *i;
+        bool adjacentToB= false;
+        for(const int *j= g.begin(v); j!=g.end(v); j++)
+          if(label[*j]==labelB)
+            { adjacentToB= true; break; }
+        if(!adjacentToB)
+          { label[v]= labelA; A.push_back(v); }
+        else
+          thinS.push_back(v);
+      }
+    S.clear();
+    for(int_vector::const_iterator i= thinS.begin(); i!=thinS.end(); i++)
+      {
+        const int v= *i;
+        bool adjacentToA= false;
+        for(const int *j= g.begin(v); j!=g.end(v); j++)
+          if(label[*j]==labelA)
+            { adjacentToA= true; break; }
+        if(!adjacentToA)
+          { label[v]= labelB; B.push_back(v); }
+        else
+          S.push_back(v);
+      }
+    dissect(g, labelA, A);
+    dissect(g, labelB, B);
+    order.insert(order.end(), S.begin(), S.end());
+  }
+
+//! @brief Compute the nested dissection ordering of the graph.
+void XC::NestedDissection::compute_ordering(const CSRGraph &g)
+  {
+    const int numVertex= g.getNumVertex();
+    label.assign(numVertex,0);
+    level.assign(numVertex,-1);
+    localIndex.assign(numVertex,-1);
+    nextLabel= 1;
+    order.clear();
+    order.reserve(numVertex);
+    int_vector part(numVertex);
+    for(int i= 0; i<numVertex; i++)
+      part[i]= i;
+    dissect(g, 0, part);
+    // free the work arrays.
+    int_vector().swap(label);
+    int_vector().swap(level);
+    int_vector().swap(localIndex);
+  }
+
+//! @brief Do the numbering.
+//!
+//! The vertex passed as argument is ignored: nested dissection
+//! determines the elimination order of all the vertices.
+const XC::ID &XC::NestedDissection::number(Graph &theGraph, int lastVertex)
+  {
+    const CSRGraph &g= theGraph.getCSR();
+    const int numVertex= g.getNumVertex();
+    if(numVertex == 0)
+      {
+        theRefResult.resize(0);
+        return theRefResult;
+      }
+
+    // look for the ordering in the cache.
+    const int numEdge= g.getNumEdge();
+    const uint64_t hash= topology_hash(g);
+    for(std::list<CacheEntry>::iterator i= cache.begin(); i!=cache.end(); i++)
+      if((i->numVertex==numVertex) && (i->numEdge==numEdge) && (i->hash==hash))
+        {
+          cache.splice(cache.begin(), cache, i); // most recently used.
+          theRefResult= cache.front().ordering;
+          numCacheHits++;
+          return theRefResult;
+        }
+
+    compute_ordering(g);
+    theRefResult.resize(numVertex);
+    for(int i=0; i<numVertex; i++)
+      theRefResult[i]= order[i]+START_VERTEX_NUM;
+    int_vector().swap(order);
+
+    if(maxCacheSize>0)
+      {
+        CacheEntry entry;
+        entry.numVertex= numVertex;
+        entry.numEdge= numEdge;
+        entry.hash= hash;
+        entry.ordering= theRefResult;
+        cache.push_front(entry);
+        if(cache.size()>maxCacheSize)
+          cache.pop_back();
+      }
+    return theRefResult;
+  }
+
+//! @brief Do the numbering (the vertices passed as argument are
+//! ignored, see number(Graph &, int)).
+const XC::ID &XC::NestedDissection::number(Graph &theGraph, const ID &lastVertices)
+  { return number(theGraph); }
+
+//! @brief Send the object thru the communicator argument.
+int XC::NestedDissection::sendSelf(Communicator &comm)
+  { return 0; }
+
+//! @brief Receive the object thru the communicator argument.
+int XC::NestedDissection::recvSelf(const Communicator &comm)
+  { return 0; }
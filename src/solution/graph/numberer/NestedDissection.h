@@ -0,0 +1,110 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NestedDissection.h
+
+#ifndef NestedDissection_h
+#define NestedDissection_h
+
+#include "BaseNumberer.h"
+#include <list>
+#include <vector>
+#include <cstdint>
+
+namespace XC {
+class CSRGraph;
+
+//! @ingroup Graph
+//
+//! @brief Nested dissection numberer: fill-reducing ordering for
+//! sparse direct solvers.
+//!
+//! The graph is recursively split by vertex separators obtained
+//! from the level structure rooted at a pseudo-peripheral vertex;
+//! the vertices of each part are numbered before those of the
+//! separator. The subgraphs that are small enough are ordered
+//! using the approximate minimum degree algorithm.
+//!
+//! The orderings are cached using a hash of the graph topology as
+//! key, so the staged analyses that go back to an already seen
+//! pattern of active elements skip the reordering.
+//!
+//! Reference: <a href="https://doi.org/10.1137/0710032">George, A. Nested dissection of a regular finite element mesh.</a>
+class NestedDissection: public BaseNumberer
+  {
+  public:
+    typedef std::vector<int> int_vector;
+  private:
+    //! @brief Ordering of a graph.
+    struct CacheEntry
+      {
+        int numVertex; //!< number of vertices of the graph.
+        int numEdge; //!< number of edges of the graph.
+        uint64_t hash; //!< hash of the graph topology.
+        ID ordering; //!< vertex tags in elimination order.
+      };
+    std::list<CacheEntry> cache; //!< cached orderings (most recently used first).
+    size_t maxCacheSize; //!< maximum number of cached orderings.
+    int leafSize; //!< size of the subgraphs ordered using AMD.
+    size_t numCacheHits; //!< number of orderings taken from the cache.
+
+    // work arrays.
+    int_vector label; //!< subgraph that contains each vertex.
+    int_vector level; //!< level of each vertex in the level structure.
+    int_vector localIndex; //!< index of each vertex in its subgraph.
+    int nextLabel; //!< label of the next subgraph.
+    int_vector order; //!< vertex indexes in elimination order.
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class DOF_Numberer;
+    NestedDissection(void);
+    GraphNumberer *getCopy(void) const;
+
+    static uint64_t topology_hash(const CSRGraph &);
+    int level_structure(const CSRGraph &, const int &, const int &, const int_vector &, int_vector &);
+    int pseudo_peripheral_vertex(const CSRGraph &, const int &, const int_vector &, int_vector &, int &);
+    size_t connected_components(const CSRGraph &, const int &, const int_vector &, std::vector<int_vector> &);
+    void order_leaf(const CSRGraph &, const int_vector &);
+    void dissect(const CSRGraph &, const int &, int_vector &);
+    void compute_ordering(const CSRGraph &);
+  public:
+    size_t getMaxCacheSize(void) const;
+    void setMaxCacheSize(const size_t &);
+    int getLeafSize(void) const;
+    void setLeafSize(const int &);
+    size_t getNumCacheHits(void) const;
+    void clearCache(void);
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+
+    virtual int sendSelf(Communicator &);
+    virtual int recvSelf(const Communicator &);
+  };
+} // end of XC namespace
+
+#endif
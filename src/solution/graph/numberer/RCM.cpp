@@ -61,9 +61,10 @@
 
 #include <solution/graph/numberer/RCM.h>
 #include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/CSRGraph.h>
 #include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
+#include <vector>
 
 //! @brief  Constructor.
 //! 
@@ -77,36 +78,115 @@ XC::RCM::RCM(bool gps)
 XC::GraphNumberer *XC::RCM::getCopy(void) const
   { return new RCM(*this); }
 
+//! @brief Reverse Cuthill-McKee numbering from the vertex whose index
+//! is given by start.
+//!
+//! The vertices at a distance \f$d\f$ from the starting vertex are
+//! placed in the d'th level set; as this is RCM, the vertices in
+//! level set \f$n\f$ are assigned a higher number than those in level
+//! set \f$n+1\f$. If the graph is disconnected the numbering continues
+//! with the first vertex not yet numbered. The vertex tags are
+//! stored in theRefResult.
+//!
+//! @param g: compressed adjacency of the graph.
+//! @param start: index of the starting vertex.
+//! @param startLastLevelSet: on return, theRefResult(0:startLastLevelSet)
+//!                           contains the vertices of the last level set.
+//! @return profile of the numbering.
+int XC::RCM::rcm_from(const CSRGraph &g, const int &start, int &startLastLevelSet)
+  {
+    const int numVertex= getNumVertex();
+    std::vector<bool> added(numVertex,false);
+    int currentMark= numVertex-1;  // marks current vertex visiting.
+    int nextMark= currentMark-1;  // marks where to put next index.
+    int nextUnvisited= 0; // first candidate if graph is disconnected.
+    int profile= 0;
+    startLastLevelSet= nextMark;
+    theRefResult(currentMark)= start;
+    added[start]= true;
+
+    // we continue till the ID is full
+    while(nextMark >= 0)
+      {
+        // go through the adjacency of the current vertex and add
+        // the vertices which have not been added yet.
+        const int v= theRefResult(currentMark);
+        for(const int *i= g.begin(v); i!=g.end(v); i++)
+          {
+            const int other= *i;
+            if(!added[other])
+              {
+                added[other]= true;
+                profile+= (currentMark-nextMark);
+                theRefResult(nextMark--)= other;
+              }
+          }
+
+        // go to the next vertex
+        //  we decrement because we are doing reverse Cuthill-McKee
+        currentMark--;
+
+        if(startLastLevelSet == currentMark)
+          startLastLevelSet= nextMark;
+
+        // check to see if graph is disconnected
+        if((currentMark == nextMark) && (currentMark >= 0))
+          {
+            while(added[nextUnvisited])
+              nextUnvisited++;
+            nextMark--;
+            startLastLevelSet= nextMark;
+            added[nextUnvisited]= true;
+            theRefResult(currentMark)= nextUnvisited;
+          }
+      }
+    // vertex indexes to vertex tags.
+    if(START_VERTEX_NUM!=0)
+      for(int i=0; i<numVertex; i++)
+        theRefResult(i)+= START_VERTEX_NUM;
+    return profile;
+  }
+
+//! @brief Return the index in the compressed graph of the vertex
+//! whose tag is being passed as parameter (-1 if there is no such
+//! vertex).
+int XC::RCM::get_start_index(const CSRGraph &g, const int &vertexTag) const
+  {
+    int retval= -1;
+    if(vertexTag != -1)
+      {
+        retval= vertexTag-START_VERTEX_NUM;
+        if((retval<0) || (retval>=g.getNumVertex()))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: no vertex with tag: "
+                      << vertexTag << " exists - using first vertex.\n";
+            retval= -1;
+          }
+      }
+    return retval;
+  }
+
 // const ID &number(Graph &theGraph,int startVertexTag= -1,
 //                  bool minDegree= false)
 //! @brief Method to perform the Reverse Cuthill-mcKenn numbering scheme. The
 //! user can supply a starting vertex, if none is provided the first vertex
-//! returned by the iter is used. If minDegree flag is set to true, at each 
-//! level set the adjacent vertices not yet added from a vertex in the previous
-//! level set are added in descending degree. The result of the numbering scheme
-//! is returned in an ID which contains the references for the vertices.
+//! of the graph is used. The result of the numbering scheme
+//! is returned in an ID which contains the tags of the vertices.
 //!
-//! side effects: this routine changes the color of the vertices.
 //! If the present ID used for the result is not of size equal to the
 //! number of Vertices in \p theGraph, it deletes the old and
-//! constructs a new ID. Starts by iterating through the Vertices of the
-//! graph setting the \p tmp variable of each to \f$-1\f$. The Vertices are
-//! then numbered using a depth first sort of the Graph, with each
-//! unmarked Vertex in the Graph at a distance \f$d\f$ from starting Vertex
-//! being placed in the d'th level set. As this is RCM, the Vertices in
-//! level set \f$n\f$ are assigned a higher number than those in level set
-//! \f$n+1\f$ with the \p tmp variable of the starting Vertex being
-//! assigned \p numVertices \f$-1\f$. The \p tags of the Vertices are
-//! placed into the ID at location given by their \p tmp variable. These
-//! are replaced with the \p ref variable of each Vertex, which is
-//! returned on successful completion. 
+//! constructs a new ID. The vertices are then numbered using a
+//! breadth first traversal of the compressed adjacency of the graph
+//! (see Graph::getCSR), with each vertex at a distance \f$d\f$ from
+//! starting Vertex being placed in the d'th level set (see rcm_from).
 //!
 //! The Vertex chosen as the starting Vertex is the one whose tag is given
 //! by \p lastVertex. If this is \f$-1\f$ or the Vertex corresponding to
 //! \p lastVertex does not exist then another Vertex is chosen. If the
-//! \p GPS flag in constructor is \p false the first Vertex from the
-//! Graphs VertexIter is used; if \p true a RCM numbering using the
-//! first Vertex from the VertexIter is performed and the Vertices in the
+//! \p GPS flag in constructor is \p false the first Vertex of the
+//! graph is used; if \p true a RCM numbering using the
+//! first Vertex is performed and the Vertices in the
 //! last level set are then used to create an ID \p lastVertices with
 //! which {\em number(theGraph, lastVertices)} can be invoked to determine
 //! the numbering.
@@ -116,93 +196,18 @@ const XC::ID &XC::RCM::number(Graph &theGraph, int startVertex)
     if(!checkSize(theGraph)) 
       return theRefResult;
 
-    // we first set the Tmp of all vertices to -1, indicating
-    // they have not yet been added.
-    Vertex *vertexPtr= nullptr;
-    VertexIter &vertexIter= theGraph.getVertices();
-    
-    while((vertexPtr= vertexIter()) != 0)
-      vertexPtr->setTmp(-1);
-
-    // we now set up; setting our markers and getting first vertex
-    int startVertexTag= startVertex;   
-    if(startVertexTag != -1)
+    const CSRGraph &g= theGraph.getCSR();
+    int start= get_start_index(g, startVertex);
+    int startLastLevelSet= 0;
+    if(start == -1)
       {
-        vertexPtr= theGraph.getVertexPtr(startVertexTag);
-        if(vertexPtr == 0)
-          {
-            std::cerr << "WARNING:  RCM::number - No vertex with tag ";
-            std::cerr << startVertexTag << "Exists - using first come from iter\n";
-            startVertexTag= -1;
-          }
-      }
-
-    // if no starting vertex use the first one we get from the VertexIter
-    VertexIter &vertexIter2= theGraph.getVertices();    
-    Vertex *start= nullptr;
-    const int numVertex= getNumVertex();
-    if(startVertexTag == -1)
-      {
-        vertexPtr= vertexIter2();
-        start= vertexPtr;
-
+        start= 0;
         // if GPS true use gibbs-poole-stodlmyer determine the last 
         // level set assuming a starting vertex and then use one of the 
         // nodes in this set to base the numbering on        
         if(GPS == true)
-          {  
-            int currentMark= numVertex-1;  // marks current vertex visiting.
-            int nextMark= currentMark -1;  // marks where to put next Tag
-            int startLastLevelSet= nextMark;
-            theRefResult(currentMark)= vertexPtr->getTag();
-            vertexPtr->setTmp(currentMark);    
-
-            // we continue till the ID is full
-
-            while(nextMark >= 0)
-              {
-                // get the current vertex and its adjacency  
-                vertexPtr= theGraph.getVertexPtr(theRefResult(currentMark));
-                const std::set<int> &adjacency= vertexPtr->getAdjacency();
-
-                // go through the vertices adjacency and add vertices which
-                // have not yet been Tmp'ed to the (theRefResult)
-
-                for(std::set<int>::const_iterator i= adjacency.begin(); i!= adjacency.end(); i++)
-                  {            
-                    const int vertexTag= *i;
-                    vertexPtr= theGraph.getVertexPtr(vertexTag);
-                    if((vertexPtr->getTmp()) == -1)
-                      {
-                        vertexPtr->setTmp(nextMark);
-                        theRefResult(nextMark--)= vertexTag;
-                      }
-                  }
-
-                // go to the next vertex
-                //  we decrement because we are doing reverse Cuthill-McKee
-                currentMark--;
-                
-                if(startLastLevelSet == currentMark)
-                  startLastLevelSet= nextMark;
-
-                // check to see if graph is disconnected
-        
-                if((currentMark == nextMark) && (currentMark >= 0))
-                  {
-
-                    // loop over iter till we get a vertex not yet Tmped
-                    while(((vertexPtr= vertexIter2()) != 0) && 
-                           (vertexPtr->getTmp() != -1)) 
-                        ;
-            
-                    nextMark--;
-                    startLastLevelSet= nextMark;
-                    vertexPtr->setTmp(currentMark);
-                    theRefResult(currentMark)= vertexPtr->getTag();
-                  }
-              }
-
+          {
+            rcm_from(g, start, startLastLevelSet);
             // create an id of the last level set
             if(startLastLevelSet > 0)
               {
@@ -212,79 +217,11 @@ const XC::ID &XC::RCM::number(Graph &theGraph, int startVertex)
                 return this->number(theGraph,lastLevelSet);
               }
           }
-        else // we start with just the first vertex we get
-          vertexPtr= start;
-      }
-
-    VertexIter &vertexIter3= theGraph.getVertices();
-    Vertex *otherPtr= nullptr;
-
-    // set to -1 all the vertices     
-    while((otherPtr= vertexIter3()) != 0)
-      otherPtr->setTmp(-1);
-
-    VertexIter &vertexIter4= theGraph.getVertices();
-
-    int currentMark= numVertex-1;  // marks current vertex visiting.
-    int nextMark= currentMark -1;  // indiactes where to put next Tag in XC::ID.
-    theRefResult(currentMark)= vertexPtr->getTag();
-    vertexPtr->setTmp(currentMark);
-
-    // we continue till the ID is full
-    while(nextMark >= 0)
-      {
-        // get the current vertex and its adjacency
-        vertexPtr= theGraph.getVertexPtr(theRefResult(currentMark));
-        const std::set<int> &adjacency= vertexPtr->getAdjacency();
-
-        // go through the vertices adjacency and add vertices which
-        // have not yet been Tmp'ed to the (theRefResult)
-
-        for(std::set<int>::const_iterator i= adjacency.begin(); i!= adjacency.end(); i++)
-          {            
-            const int vertexTag= *i;
-            vertexPtr= theGraph.getVertexPtr(vertexTag);
-            if((vertexPtr->getTmp()) == -1)
-              {
-                vertexPtr->setTmp(nextMark);
-                theRefResult(nextMark--)= vertexTag;
-              }
-          }
-
-        // go to the next vertex
-        //  we decrement because we are doing reverse Cuthill-McKee
-        currentMark--;
-
-        // check to see if graph is disconnected
-        
-        if((currentMark == nextMark) && (currentMark >= 0))
-          {
-            // std::cerr << "WARNING:  XC::RCM::number - Disconnected graph -2 \n ";
-            // loop over iter till we get a vertex not yet Tmped         
-            while(((vertexPtr= vertexIter4()) != 0) && 
-                   (vertexPtr->getTmp() != -1)) 
-              ;
-            
-            nextMark--;
-            vertexPtr->setTmp(currentMark);
-            theRefResult(currentMark)= vertexPtr->getTag();
-          }
-      }
-    
-    // now set the vertex references instead of the vertex tags
-    // in the result, we change the Tmp to indicate number and return  
-    for(int i=0; i<numVertex; i++)
-      {
-        const int vertexTag= theRefResult(i);
-        vertexPtr= theGraph.getVertexPtr(vertexTag);
-        vertexPtr->setTmp(i+1); // 1 through numVertex
-        theRefResult(i)= vertexPtr->getTag();
       }
+    rcm_from(g, start, startLastLevelSet);
     return theRefResult;
   }
 
-
-
 int XC::RCM::sendSelf(Communicator &comm)
   { return 0; }
 
@@ -303,182 +240,33 @@ int XC::RCM::recvSelf(const Communicator &comm)
 //! with this starting Vertex.
 const XC::ID &XC::RCM::number(Graph &theGraph, const ID &startVertices)
   {
-
     // see if we can do quick return
     if(!checkSize(theGraph)) 
       return theRefResult;
 
+    const CSRGraph &g= theGraph.getCSR();
+
     // determine one that gives the min avg profile            
-    int minStartVertexTag =0;
+    int minStart= 0;
     int minAvgProfile= 0;
+    int start= 0;
+    int startLastLevelSet= 0;
     const int startVerticesSize= startVertices.Size();
-    Vertex *vertexPtr;
-    
-    int startVertexTag =0;
-    const int numVertex= getNumVertex();
-    
     for(int i=0; i<startVerticesSize; i++)
       {
-        // we first set the Tmp of all vertices to -1, indicating
-        // they have not yet been added.
-        VertexIter &vertexIter= theGraph.getVertices();
-    
-        while((vertexPtr= vertexIter()) != 0)
-            vertexPtr->setTmp(-1);
-
-        startVertexTag= startVertices(i);
-
-        if(startVertexTag != -1) {
-            vertexPtr= theGraph.getVertexPtr(startVertexTag);
-            if(vertexPtr == 0) {
-                std::cerr << "WARNING:  XC::RCM::number - No vertex with tag ";
-                std::cerr << startVertexTag << "Exists - using first come from iter\n";
-                startVertexTag= -1;
-            }
-        }        
-
-        int currentMark= numVertex-1;  // marks current vertex visiting.
-        int nextMark= currentMark -1;  // indiactes where to put next Tag in XC::ID.
-        theRefResult(currentMark)= vertexPtr->getTag();
-        vertexPtr->setTmp(currentMark);
-        int avgProfile= 0;
-        VertexIter &vertexIter2= theGraph.getVertices();    
-
-        // we continue till the XC::ID is full
-
-        while(nextMark >= 0)
+        start= get_start_index(g, startVertices(i));
+        if(start == -1)
+          start= 0;
+        const int avgProfile= rcm_from(g, start, startLastLevelSet);
+        if(i == 0 || minAvgProfile > avgProfile)
           {
-            // get the current vertex and its adjacency
-            vertexPtr= theGraph.getVertexPtr(theRefResult(currentMark));
-            const std::set<int> &adjacency= vertexPtr->getAdjacency();
- 
-            // go through the vertices adjacency and add vertices which
-            // have not yet been Tmp'ed to the (theRefResult)
-
-            for(std::set<int>::const_iterator i= adjacency.begin(); i!= adjacency.end(); i++)
-              {            
-                const int vertexTag= *i;
-                vertexPtr= theGraph.getVertexPtr(vertexTag);
-                if((vertexPtr->getTmp()) == -1) {
-                    vertexPtr->setTmp(nextMark);
-                    avgProfile += (currentMark - nextMark);
-                    theRefResult(nextMark--)= vertexTag;
-                }
-            }
-
-            // go to the next vertex
-            //  we decrement because we are doing reverse Cuthill-McKee
-        
-            currentMark--;
-
-            // check to see if graph is disconnected
-        
-            if((currentMark == nextMark) && (currentMark >= 0)) {
-            
-                // loop over iter till we get a vertex not yet Tmped
-            
-                while(((vertexPtr= vertexIter2()) != 0) && 
-                       (vertexPtr->getTmp() != -1)) 
-                    ;
-                nextMark--;
-        
-                vertexPtr->setTmp(currentMark);
-                theRefResult(currentMark)= vertexPtr->getTag();
-            }
-
-        }                
-
-        if(i == 0 || minAvgProfile > avgProfile) {
-            minStartVertexTag= startVertexTag;
+            minStart= start;
             minAvgProfile= avgProfile;
-        }
-        
-    }
-
-        
-    // we number based on minStartVertexTag
-    minAvgProfile= 0;
-
-    if(minStartVertexTag != startVertexTag) {
-
-        // we could just call the other numbering routine - 
-        // we will    just write it out again for now - CHANGE LATER
-        startVertexTag= minStartVertexTag;
-
-        // set all unmarked
-        VertexIter &vertexIter= theGraph.getVertices();
-        while((vertexPtr= vertexIter()) != 0)
-            vertexPtr->setTmp(-1);
-        
-        vertexPtr= theGraph.getVertexPtr(startVertexTag);
-
-        int currentMark= numVertex-1;  // marks current vertex visiting.
-        int nextMark= currentMark -1;  // indiactes where to put next Tag in XC::ID.
-        theRefResult(currentMark)= vertexPtr->getTag();
-        vertexPtr->setTmp(currentMark);
-        VertexIter &vertexIter2= theGraph.getVertices();    
-
-        // we continue till the XC::ID is full
-
-        while(nextMark >= 0)
-          {
-            // get the current vertex and its adjacency        
-            vertexPtr= theGraph.getVertexPtr(theRefResult(currentMark));
-            const std::set<int> &adjacency= vertexPtr->getAdjacency();
-
-            // go through the vertices adjacency and add vertices which
-            // have not yet been Tmp'ed to the (theRefResult)
-
-            for(std::set<int>::const_iterator i= adjacency.begin(); i!= adjacency.end(); i++)
-              {            
-                const int vertexTag= *i;
-                vertexPtr= theGraph.getVertexPtr(vertexTag);
-                if((vertexPtr->getTmp()) == -1)
-                  {
-                    vertexPtr->setTmp(nextMark);
-                    minAvgProfile += (currentMark-nextMark);
-                    theRefResult(nextMark--)= vertexTag;
-                  }
-              }
-
-            // go to the next vertex
-            //  we decrement because we are doing reverse Cuthill-McKee
-        
-            currentMark--;
-
-            // loop over iter till we get a vertex not yet Tmped
-            if((currentMark == nextMark) && (currentMark >= 0))
-              {
-                // std::cerr << "WARNING:  XC::RCM::number - Disconnected graph\n";
-                
-                while(((vertexPtr= vertexIter2()) != 0) && 
-                       (vertexPtr->getTmp() != -1)) 
-                  ;
-              
-                nextMark--;
-                vertexPtr->setTmp(currentMark);
-                theRefResult(currentMark)= vertexPtr->getTag();
-              }
-          }            
-      }        
+          }
+      }
 
-    // now set the vertex references instead of the vertex tags
-    // in the result, we change the Tmp to indicate number and return
-    for(int j=0; j<numVertex; j++)
-      {
-        int vertexTag= theRefResult(j);
-        vertexPtr= theGraph.getVertexPtr(vertexTag);
-        vertexPtr->setTmp(j+1); // 1 through numVertex
-        theRefResult(j)= vertexPtr->getTag();
-      }        
+    // we number based on minStart
+    if((startVerticesSize == 0) || (minStart != start))
+      rcm_from(g, minStart, startLastLevelSet);
     return theRefResult;
   }
-
-
-
-
-
-
-
-
-
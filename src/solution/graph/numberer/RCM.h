@@ -61,9 +61,6 @@
 // scheme on the vertices of a graph. This is done by invoking the
 // number() method with the Graph to be numbered.
 //
-// Side effects: numberer() changes the Tmp values of the vertices to
-// the number assigned to that vertex.
-//
 // What: "@(#) RCM.h, revA"
 
 #ifndef RCM_h
@@ -72,6 +69,8 @@
 #include "BaseNumberer.h"
 
 namespace XC {
+class CSRGraph;
+
 //! @ingroup Graph
 //
 //! @brief Class designed to perform the Reverse Cuthill-McKee numbering
@@ -83,6 +82,8 @@ class RCM: public BaseNumberer
   {
   private:
     bool GPS; // flag for gibbs-poole-stodlymer
+    int rcm_from(const CSRGraph &, const int &, int &);
+    int get_start_index(const CSRGraph &, const int &) const;
   protected:
     friend class FEM_ObjectBroker;
     friend class DOF_Numberer;
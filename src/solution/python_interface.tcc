@@ -33,7 +33,7 @@ class_<XC::SolutionStrategy, bases<CommandEntity>, boost::noncopyable >("Solutio
   .add_property("getModelWrapper", make_function( getSSModelWrapperPtr, return_internal_reference<>() )," \n""getModelWrapper() \n""Return a pointer to the model wrapper.\n")
   .def("newSolutionAlgorithm", &XC::SolutionStrategy::newSolutionAlgorithm,return_internal_reference<>(),"\n""newSolutionAlgorithm(type) \n""Define the solution algorithm to be used.\n" "Parameters: \n""type: type of solution algorithm. Available types: 'bfgs_soln_algo', 'broyden_soln_algo','krylov_newton_soln_algo','linear_soln_algo','modified_newton_soln_algo','newton_raphson_soln_algo','newton_line_search_soln_algo','periodic_newton_soln_algo','frequency_soln_algo','standard_eigen_soln_algo','linear_buckling_soln_algo','ill-conditioning_soln_algo' \n")
     .def("newIntegrator", &XC::SolutionStrategy::newIntegrator,return_internal_reference<>()," \n""newIntegrator(type,params) \n""Define the integrator to be used. \n""Parameters: \n""type: type of integrator. Available types:  'arc_length_integrator', 'arc_length1_integrator', 'displacement_control_integrator', 'distributed_displacement_control_integrator', 'HS_constraint_integrator', 'load_control_integrator', 'load_path_integrator', 'min_unbal_disp_norm_integrator', 'eigen_integrator', 'linear_buckling_integrator', 'ill-conditioning_integrator', 'alpha_os_integrator', 'alpha_os_generalized_integrator', 'central_difference_integrator', 'central_difference_alternative_integrator', 'central_difference_no_damping_integrator', 'collocation_integrator', 'collocation_hybrid_simulation_integrator', 'HHT_integrator', 'HHT1_integrator', 'HHT_explicit_integrator', 'HHT_generalized_integrator', 'HHT_generalized_explicit_integrator', 'HHT_hybrid_simulation_integrator', 'TRBDF2_integrator', 'TRBDF3_integrator', 'newmark_integrator', 'newmark1_integrator', 'newmark_explicit_integrator' 'newmark_hybrid_simulation_integrator', 'wilson_theta_integrator'. \n""params: parameters depending upon the integrator type. \n")
-    .def("newSystemOfEqn", &XC::SolutionStrategy::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(type) \n""Define the system of equations to be used. \n""Parameters: \n""type: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'sym_sparse_lin_soe'.  \n")
+    .def("newSystemOfEqn", &XC::SolutionStrategy::newSystemOfEqn,return_internal_reference<>()," \n""newSystemOfEqn(type) \n""Define the system of equations to be used. \n""Parameters: \n""type: type of system of equations. Available types: 'band_arpack_soe', 'band_arpackpp_soe', 'sym_arpack_soe', 'sym_band_eigen_soe', 'full_gen_eigen_soe', 'band_gen_lin_soe', 'distributed_band_gen_lin_soe', 'band_spd_lin_soe', 'distributed_band_spd_lin_soe', 'diagonal_soe', 'distributed_diagonal_soe', 'full_gen_lin_soe', 'profile_spd_lin_soe', 'distributed_profile_spd_lin_soe', 'sparse_gen_col_lin_soe', 'distributed_sparse_gen_col_lin_soe', 'sparse_gen_row_lin_soe', 'distributed_sparse_gen_row_lin_soe', 'sym_sparse_lin_soe', 'csr_spd_lin_soe'.  \n")
    .def("newConvergenceTest", &XC::SolutionStrategy::newConvergenceTest,return_internal_reference<>()," \n""newConvergenceTest(cmd) \n""Define the convergence test to be used. \n""Parameters: \n""cmd: type of convergente test. Available types: 'energy_inc_conv_test', 'fixed_num_iter_conv_test', 'norm_disp_incr_conv_test', 'norm_unbalance_conv_test', 'relative_energy_incr_conv_test', 'relative_norm_disp_incr_conv_test', 'relative_norm_unbalance_conv_test', 'relative_total_norm_disp_incr_conv_test'. \n")
   .add_property("getDomain", make_function( getSolutionStrategyDomain, return_internal_reference<>() ),"return a reference to the domain.")
   .add_property("getIntegrator", make_function( getSolutionStrategyIntegrator, return_internal_reference<>() ),"return a reference to the integragor.")
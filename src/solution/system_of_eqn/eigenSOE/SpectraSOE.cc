@@ -29,12 +29,14 @@
 #include <solution/system_of_eqn/eigenSOE/SpectraSOE.h>
 #include <solution/system_of_eqn/eigenSOE/SpectraSolver.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <algorithm>
 #include "utility/matrix/Matrix.h"
 #include "utility/matrix/ID.h"
 
 //! @brief Constructor.
 XC::SpectraSOE::SpectraSOE(SolutionStrategy *owr)
-  :EigenSOE(owr,EigenSOE_TAGS_SpectraSOE), A(), M() {}
+  :EigenSOE(owr,EigenSOE_TAGS_SpectraSOE), A(), M(), scatterMap() {}
 
 //! @brief Sets the solver to use.
 bool XC::SpectraSOE::setSolver(EigenSolver *newSolver)
@@ -53,96 +55,102 @@ bool XC::SpectraSOE::setSolver(EigenSolver *newSolver)
   }
 
 //! @brief Sets the system size.
+//!
+//! The sparsity pattern of A (the diagonal and the adjacency of each
+//! vertex of the graph) is stored in A, so the element matrices can be
+//! added directly to its coefficients.
 int XC::SpectraSOE::setSize(Graph &theGraph)
   {
     int result = 0;
-    const int newSize= checkSize(theGraph);
-    if(size!=newSize)
+    size= checkSize(theGraph);
+    const CSRGraph &g= theGraph.getCSR();
+    std::vector<T> pattern;
+    if(g.getNumVertex() != size)
       {
-        size= newSize;
-        A.resize(size,size);
-        M.resize(size,size);
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: graph vertices not numbered from 0 to "
+		  << size-1 << " - size set to 0.\n";
+	size= 0;
+	result= -1;
       }
+    else
+      {
+	pattern.reserve(g.getNumEntriesWithDiagonal());
+	for(int col=0; col<size; col++)
+	  {
+	    pattern.push_back(T(col,col,0.0)); // diagonal.
+	    for(const int *i= g.begin(col); i!=g.end(col); i++)
+	      pattern.push_back(T(*i,col,0.0));
+	  }
+      }
+    A.resize(size,size);
+    A.setFromTriplets(pattern.begin(), pattern.end());
+    A.makeCompressed();
+    M.resize(size,size);
+    scatterMap.clear(); // A storage has changed.
     return result;
   }
 
+//! @brief Compute the locations in A of the coefficients that
+//! correspond to the equation numbers being passed as parameter.
+const XC::ScatterMap::location_vector &XC::SpectraSOE::compute_locations(const ID &id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(id);
+    const int idSize= id.Size();
+    const int *outer= A.outerIndexPtr();
+    const int *inner= A.innerIndexPtr();
+    for(int j= 0; j<idSize; j++)
+      {
+	const int col= id(j);
+	if(col < size && col >= 0)
+	  {
+	    const int *colBegin= inner+outer[col];
+	    const int *colEnd= inner+outer[col+1];
+	    for(int i= 0; i<idSize; i++)
+	      {
+		const int row= id(i);
+		if(row < size && row >= 0)
+		  {
+		    // row indexes are sorted in each column.
+		    const int *k= std::lower_bound(colBegin, colEnd, row);
+		    if((k!=colEnd) && (*k==row))
+		      retval[j*idSize+i]= k-inner;
+		  }
+	      }
+	  }
+      }
+    return retval;
+  }
+
 //! @brief Assemblies into A the matrix being passed as parameter
 //! multimplied by the fact parameter.
-int XC::SpectraSOE::addToMatrix(std::deque<T> &tripletList,const Matrix &m, const ID &id,const double &fact)
+//!
+//! The locations of the coefficients are computed the first time the
+//! ID is assembled and then reused until the size of the system changes.
+int XC::SpectraSOE::addA(const Matrix &a, const ID &id, double fact)
   {
     // check for a quick return 
     if(fact == 0.0) return 0;
 
     // check that m and id are of similar size
     const int idSize = id.Size();
-    if(idSize != m.noRows() && idSize != m.noCols())
+    if(idSize != a.noRows() || idSize != a.noCols())
       {
         std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; Matrix and ID not of similar sizes.\n";
         return -1;
       }
-    if(fact == 1.0)
-      {
-        for(int i= 0;i<idSize;i++)
-          {
-            const int row= id(i);
-            if(row <= size && row >= 0)
-              {
-                for(int j= 0;j<idSize;j++)
-                  {
-	            const int col= id(j);
-		    const double &value= m(i,j);
-	            if(col <= size && col >= 0 && (value!=0.0))
-                      tripletList.push_back(T(row,col,value));
-	          }// for j
-              }
-          }// for i
-      }
-    else if(fact == -1.0)
-      { // we save the product.
-        for(int i= 0;i<idSize;i++)
-          {
-            const int row= id(i);
-            if(row <= size && row >= 0)
-              {
-                for(int j= 0;j<idSize;j++)
-                  {
-	            const int col= id(j);
-	            if(col <= size && col >= 0 && (m(i,j)!= 0.0))
-                      tripletList.push_back(T(row,col,-m(i,j)));
-	          }// for j
-              }
-          }// for i
-      }
-    else
-      {
-        for(int i= 0;i<idSize;i++)
-          {
-            const int row = id(i);
-            if(row <= size && row >= 0)
-              {
-                for(int j= 0;j<idSize;j++)
-                  {
-                    const int col = id(j);
-	            if(col <= size && col >= 0 && (m(i,j)!= 0.0))
-                      tripletList.push_back(T(row,col,m(i,j)*fact));
-	          }  // for j
-              }
-          }  // for i
-      }
+    const ScatterMap::location_vector *locations= scatterMap.find(id);
+    if(!locations)
+      locations= &compute_locations(id);
+    ScatterMap::scatter(*locations, a, fact, A.valuePtr());
     return 0;
   }
 
-//! @brief Assemblies into A the matrix being passed as parameter
-//! multimplied by the fact parameter.
-int XC::SpectraSOE::addA(const Matrix &a, const ID &id, double fact)
-  { return addToMatrix(tripletListA,a,id,fact); }
-
-//! @brief Zeroes the matrix A.
+//! @brief Zeroes the matrix A (keeping its sparsity pattern).
 void XC::SpectraSOE::zeroA(void)
   {
-    A.setZero();
-    tripletListA.clear();
+    std::fill(A.valuePtr(), A.valuePtr()+A.nonZeros(), 0.0);
   }
 
 //! @brief Assemblies into M the matrix being passed as parameter
@@ -225,8 +233,7 @@ void XC::SpectraSOE::assembleMatrices(void)
   {
     M.setZero();
     M.setFromTriplets(tripletListM.begin(), tripletListM.end()); // mass matrix is ready to go!
-    A.setZero();
-    A.setFromTriplets(tripletListA.begin(), tripletListA.end()); // stiffness matrix is ready to go!
+    // stiffness matrix is assembled in place (see addA).
   }
  
 //! @brief Zeroes the matrix M.
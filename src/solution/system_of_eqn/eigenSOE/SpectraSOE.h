@@ -31,6 +31,7 @@
 #define SpectraSOE_h
 
 #include <solution/system_of_eqn/eigenSOE/EigenSOE.h>
+#include <solution/system_of_eqn/linearSOE/ScatterMap.h>
 #include <Eigen/Core>
 #include <Eigen/SparseCore>
 
@@ -45,13 +46,13 @@ class SpectraSOE: public EigenSOE
   {
   private:
     typedef Eigen::Triplet<double> T;
-    std::deque<T> tripletListA;
     std::deque<T> tripletListM;
     
-    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> A; //!< pattern set from the graph in setSize.
     Eigen::SparseMatrix<double> M;
+    ScatterMap scatterMap; //!< locations of the element matrices coefficients in A.
     
-    int addToMatrix(std::deque<T> &,const Matrix &, const ID &,const double &);
+    const ScatterMap::location_vector &compute_locations(const ID &);
     void store_mass_matrix(void);
   protected:
     bool setSolver(EigenSolver *);
@@ -0,0 +1,157 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnBlockLDLt.cc
+
+#include "solution/system_of_eqn/linearSOE/ColumnBlockLDLt.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+//! @brief Return the dot product of the coefficients of the columns
+//! j and i from row k0 to row k1 (not included).
+inline double column_dot(const int &k0, const int &k1, const double *colj, const double *coli)
+  {
+    double retval= 0.0;
+    const int n= k1-k0;
+    #pragma omp simd reduction(+:retval)
+    for(int k= 0;k<n;k++)
+      retval+= colj[k]*coli[k];
+    return retval;
+  }
+
+//! @brief Subtract from the coefficients of column i in the rows
+//! [r0,r1) the contributions of the previous rows.
+inline void update_column(const int &i, const int &r0, const int &r1, const int *rowTop, double *const *topRowPtr)
+  {
+    const int rowiTop= rowTop[i];
+    double *coli= topRowPtr[i];
+    for(int j= std::max(rowiTop,r0);j<r1;j++)
+      {
+	const int rowjTop= rowTop[j];
+	const double *colj= topRowPtr[j];
+	const int k0= std::max(rowiTop,rowjTop);
+	coli[j-rowiTop]-= column_dot(k0,j,colj+(k0-rowjTop),coli+(k0-rowiTop));
+      }
+  }
+
+//! @brief Factor the diagonal block formed by the columns [c0,c1).
+//! @return the index of the column with a zero pivot or -1.
+int factor_diagonal_block(const int &c0, const int &c1, const int *rowTop, double *const *topRowPtr, double *invD, const double &minDiagTol)
+  {
+    for(int i= c0;i<c1;i++)
+      {
+	update_column(i, c0, i, rowTop, topRowPtr);
+	// form i'th col of [U] and determine [dii]
+	const int rowiTop= rowTop[i];
+	double *aji= topRowPtr[i];
+	double aii= aji[i-rowiTop];
+	for(int j= rowiTop;j<i;j++,aji++)
+	  {
+	    const double lij= *aji*invD[j];
+	    aii-= lij * *aji;
+	    *aji= lij;
+	  }
+	// check that the diag > the tolerance specified
+	if((aii == 0.0) || (fabs(aii) <= minDiagTol))
+	  return i;
+	invD[i]= 1.0/aii;
+      }
+    return -1;
+  }
+} // end of anonymous namespace
+
+//! @brief Compute the \f$LDL^t\f$ factorization of the matrix.
+//!
+//! @param size: number of columns.
+//! @param rowTop: first stored row of each column.
+//! @param topRowPtr: address of the first stored coefficient of each column.
+//! @param invD: inverse of the diagonal terms (output).
+//! @param maxColHeight: maximum number of coefficients stored in a column.
+//! @param minDiagTol: minimum value allowed for the pivots.
+//! @param blockSize: number of columns of each block.
+//! @param numThreads: number of threads.
+//! @param failedRow: row of the first pivot smaller than minDiagTol (output).
+//! @return 0 if successful, -2 if a pivot is smaller than minDiagTol.
+int XC::ColumnBlockLDLt::factor(const int &size, const int *rowTop, double *const *topRowPtr, double *invD, const int &maxColHeight, const double &minDiagTol, const int &blockSize, const int &numThreads, int &failedRow)
+  {
+    failedRow= -1;
+    const int bs= std::max(blockSize,1);
+    const int nBlocks= (size+bs-1)/bs;
+#pragma omp parallel num_threads(numThreads)
+    for(int b= 0;b<nBlocks;b++)
+      {
+	const int startRow= b*bs;
+	const int endRow= std::min(startRow+bs,size);
+        #pragma omp single
+	failedRow= factor_diagonal_block(startRow, endRow, rowTop, topRowPtr, invD, minDiagTol);
+	// implicit barrier: all the threads read the same value.
+	if(failedRow>=0)
+	  break;
+	// columns that can reach the rows of this block.
+	const int lastCol= std::min(endRow+maxColHeight-1,size);
+        #pragma omp for schedule(dynamic,8)
+	for(int i= endRow;i<lastCol;i++)
+	  {
+	    if(rowTop[i]<endRow)
+	      update_column(i, startRow, endRow, rowTop, topRowPtr);
+	  }
+      }
+    return (failedRow<0 ? 0 : -2);
+  }
+
+//! @brief Solve the system using the factorization (forward
+//! substitution, diagonal scaling and back substitution).
+//!
+//! @param size: number of columns.
+//! @param rowTop: first stored row of each column.
+//! @param topRowPtr: address of the first stored coefficient of each column.
+//! @param invD: inverse of the diagonal terms.
+//! @param X: right hand side on entry, solution on exit.
+void XC::ColumnBlockLDLt::solve(const int &size, const int *rowTop, const double *const *topRowPtr, const double *invD, double *X)
+  {
+    // forward substitution
+    for(int i= 1;i<size;i++)
+      {
+	const int rowiTop= rowTop[i];
+	X[i]-= column_dot(rowiTop,i,topRowPtr[i],X+rowiTop);
+      }
+    // divide by diag term
+    for(int j= 0;j<size;j++)
+      X[j]*= invD[j];
+    // back substitution
+    for(int k= size-1;k>0;k--)
+      {
+	const int rowkTop= rowTop[k];
+	const double bk= X[k];
+	const double *ajk= topRowPtr[k];
+	double *xj= X+rowkTop;
+	const int n= k-rowkTop;
+        #pragma omp simd
+	for(int j= 0;j<n;j++)
+	  xj[j]-= ajk[j]*bk;
+      }
+  }
@@ -0,0 +1,62 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ColumnBlockLDLt.h
+                                                                        
+                                                                        
+#ifndef ColumnBlockLDLt_h
+#define ColumnBlockLDLt_h
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief \f$LDL^t\f$ factorization of a symmetric matrix stored
+//! by columns from the first non-zero row to the diagonal (profile or
+//! band storage) using threads.
+//!
+//! Each column i is described by the index of its first stored row
+//! (rowTop[i]) and the address of that coefficient (topRowPtr[i]); the
+//! coefficients of the column are contiguous in memory, the last one
+//! being the diagonal. The factorization overwrites the off-diagonal
+//! coefficients with \f$L^t\f$ and stores \f$D^{-1}\f$ in invD.
+//!
+//! The columns are grouped in blocks. The diagonal block of each block
+//! row is factored by one thread (left-looking); then the remaining
+//! columns that reach the block row are updated concurrently (they
+//! only depend on the columns of the block row and on their own
+//! coefficients). The operations on each coefficient are the same than
+//! those of the column by column algorithm (ProfileSPDLinDirectSolver).
+class ColumnBlockLDLt
+  {
+  public:
+    static int factor(const int &size, const int *rowTop, double *const *topRowPtr, double *invD, const int &maxColHeight, const double &minDiagTol, const int &blockSize, const int &numThreads, int &failedRow);
+    static void solve(const int &size, const int *rowTop, const double *const *topRowPtr, const double *invD, double *X);
+  };
+} // end of XC namespace
+
+#endif
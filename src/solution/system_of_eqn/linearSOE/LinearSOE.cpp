@@ -67,7 +67,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
-//#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/DomainSolver.h>
 
@@ -79,12 +79,13 @@
 
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinLapackSolver.h>
+#include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSubstrThreadSolver.h>
 
 //#include <solution/system_of_eqn/linearSOE/itpack/ItpackLinSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
@@ -97,10 +98,16 @@
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
 
 #include "solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h"
 #include "solution/system_of_eqn/linearSOE/mumps/MumpsSolver.h"
 #include "solution/system_of_eqn/linearSOE/mumps/MumpsParallelSolver.h"
+#ifdef USE_EIGEN
+#include "solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSolver.h"
+#endif
+#include "solution/system_of_eqn/linearSOE/krylov/PCGLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/krylov/MINRESLinSolver.h"
 
 //! @brief Constructor.
 //!
@@ -170,8 +177,8 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new BandGenLinLapackSolver());
     else if(type=="band_spd_lin_lapack_solver")
       setSolver(new BandSPDLinLapackSolver());
-//     else if(type=="band_spd_lin_thread_solver")
-//       setSolver(new BandSPDLinThreadSolver());
+    else if(type=="band_spd_lin_thread_solver")
+      setSolver(new BandSPDLinThreadSolver());
 //     else if(type=="conjugate_gradient_solver")
 //       setSolver(new ConjugateGradientSolver());
     else if(type=="diagonal_direct_solver")
@@ -180,6 +187,8 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new DistributedDiagonalSolver());
     else if(type=="full_gen_lin_lapack_solver")
       setSolver(new FullGenLinLapackSolver());
+    else if(type=="full_gen_lin_substr_thread_solver")
+      setSolver(new FullGenLinSubstrThreadSolver());
 //     else if(type=="itpack_lin_solver")
 //       setSolver(new ItpackLinSolver());
     else if(type=="profile_spd_lin_direct_solver")
@@ -188,8 +197,8 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new ProfileSPDLinDirectBlockSolver());
     else if(type=="profile_spd_lin_direct_skypack_solver")
      setSolver(new ProfileSPDLinDirectSkypackSolver());
-//     else if(type=="profile_spd_lin_direct_thread_solver")
-//       setSolver(new ProfileSPDLinDirectThreadSolver());
+    else if(type=="profile_spd_lin_direct_thread_solver")
+      setSolver(new ProfileSPDLinDirectThreadSolver());
 //     else if(type=="profile_spd_lin_substr_solver")
 //       setSolver(new ProfileSPDLinSubstrSolver());
     else if(type=="super_lu_solver")
@@ -198,6 +207,14 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new SymSparseLinSolver());
     else if(type=="umfpack_gen_lin_solver")
       setSolver(new UmfpackGenLinSolver());
+#ifdef USE_EIGEN
+    else if(type=="eigen_sparse_spd_lin_solver")
+      setSolver(new EigenSparseSPDLinSolver());
+#endif
+    else if(type=="pcg_lin_solver")
+      setSolver(new PCGLinSolver());
+    else if(type=="minres_lin_solver")
+      setSolver(new MINRESLinSolver());
     else if(type=="mumps_solver")
       setSolver(new MumpsSolver());
     else if(type=="mumps_parallel_solver")
@@ -224,6 +241,67 @@ XC::LinearSOE::~LinearSOE(void)
 int XC::LinearSOE::solve(void)
   { return (getSolver()->solve()); }
 
+//! @brief Solves the system for each of the columns of the
+//! right hand side matrix argument.
+//!
+//! The default implementation solves the columns one by one, so
+//! the solvers that keep the factorization of A (see FactoredSOEBase)
+//! factorize the matrix only once. The vector b is restored on exit.
+//!
+//! @param rhs: right hand side vectors (one per column).
+//! @param x: solution vectors (one per column).
+int XC::LinearSOE::solveMultipleRHS(const Matrix &rhs, Matrix &x)
+  {
+    const int n= getNumEqn();
+    const int nrhs= rhs.noCols();
+    if(rhs.noRows()!=n)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the right hand side: "
+		  << rhs.noRows() << " doesn't match the number of equations: "
+		  << n << std::endl;
+	return -1;
+      }
+    x.resize(n, nrhs);
+    x.Zero();
+    const Vector oldB(getB());
+    Vector b(n);
+    int retval= 0;
+    for(int j= 0; j<nrhs; j++)
+      {
+	for(int i= 0; i<n; i++)
+	  b(i)= rhs(i,j);
+	setB(b);
+	retval= solve();
+	if(retval<0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; failed to solve for right hand side: "
+		      << j << std::endl;
+	    break;
+	  }
+	const Vector &xj= getX();
+	for(int i= 0; i<n; i++)
+	  x(i,j)= xj(i);
+      }
+    setB(oldB);
+    return retval;
+  }
+
+//! @brief Return the solutions of the system for each of the columns
+//! of the right hand side matrix argument.
+//!
+//! @param rhs: right hand side vectors (one per column).
+XC::Matrix XC::LinearSOE::getMultipleRHSSolution(const Matrix &rhs)
+  {
+    Matrix retval(rhs.noRows(), rhs.noCols());
+    const int ok= solveMultipleRHS(rhs, retval);
+    if(ok<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; failed to solve the system." << std::endl;
+    return retval;
+  }
+
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
   { return getSolver()->getDeterminant(); }
@@ -105,6 +105,8 @@ class LinearSOE: public SystemOfEqn
     virtual ~LinearSOE(void);
 
     virtual int solve(void);    
+    virtual int solveMultipleRHS(const Matrix &, Matrix &);
+    Matrix getMultipleRHSSolution(const Matrix &);
 
     //! @brief Determines and sets the size of the system.
     //!
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScatterMap.cc
+
+#include "solution/system_of_eqn/linearSOE/ScatterMap.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+
+//! @brief Constructor.
+XC::ScatterMap::ScatterMap(void)
+  : entries() {}
+
+//! @brief Remove all the locations (must be called each time
+//! the sparsity pattern of the system matrix changes).
+void XC::ScatterMap::clear(void)
+  { entries.clear(); }
+
+//! @brief Return the locations corresponding to the ID argument
+//! or nullptr if they are not computed yet (or if the contents of the
+//! ID has changed since they were computed).
+const XC::ScatterMap::location_vector *XC::ScatterMap::find(const ID &id) const
+  {
+    const location_vector *retval= nullptr;
+    entries_map::const_iterator i= entries.find(&id);
+    if(i!=entries.end())
+      {
+	const Entry &e= i->second;
+	if(e.dofs==static_cast<const std::vector<int> &>(id))
+	  retval= &e.locations;
+      }
+    return retval;
+  }
+
+//! @brief Create (or reset) the locations corresponding to the ID
+//! argument. The returned vector has a -1 offset for each entry
+//! of the local matrix; it must be filled by the system of equations.
+XC::ScatterMap::location_vector &XC::ScatterMap::insert(const ID &id)
+  {
+    const size_t n= id.size();
+    Entry &e= entries[&id];
+    e.dofs.assign(id.begin(),id.end());
+    e.locations.assign(n*n,-1);
+    return e.locations;
+  }
+
+//! @brief Add fact*m to the coefficients whose locations are
+//! being passed as parameter.
+//!
+//! @param locations: offset of each (i,j) coefficient at j*n+i.
+//! @param m: matrix to assemble.
+//! @param fact: factor that multiplies the matrix.
+//! @param values: array that stores the coefficients of the system matrix.
+void XC::ScatterMap::scatter(const location_vector &locations, const Matrix &m, const double &fact, double *values)
+  {
+    const int n= m.noRows();
+    location_vector::const_iterator k= locations.begin();
+    if(fact == 1.0)
+      {
+	for(int j= 0; j<n; j++)
+	  for(int i= 0; i<n; i++, k++)
+	    if(*k>=0)
+	      values[*k]+= m(i,j);
+      }
+    else
+      {
+	for(int j= 0; j<n; j++)
+	  for(int i= 0; i<n; i++, k++)
+	    if(*k>=0)
+	      values[*k]+= fact*m(i,j);
+      }
+  }
@@ -0,0 +1,88 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScatterMap.h
+                                                                        
+                                                                        
+#ifndef ScatterMap_h
+#define ScatterMap_h
+
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+
+namespace XC {
+class ID;
+class Matrix;
+
+//! @ingroup LinearSOE
+//
+//! @brief Locations in the storage of a sparse matrix of the entries
+//! of the element (or DOF group) matrices assembled on it.
+//!
+//! For each ID (equation numbers of an FE_Element or DOF_Group)
+//! assembled on the system matrix, the object stores the offset
+//! (from the beginning of the array that stores the coefficients)
+//! of the coefficient that corresponds to each (i,j) entry of the
+//! local matrix. Once computed, the assembly of the local matrix
+//! becomes a straight indexed addition instead of a search of the
+//! row (or column) index in the compressed storage.
+//!
+//! The locations are indexed by the address of the ID object (the
+//! IDs of the FE_Element and DOF_Group objects live as long as the
+//! analysis model). The equation numbers are also stored, so if
+//! the ID contents change the locations are computed again. The
+//! offsets remain valid while the sparsity pattern of the system
+//! matrix doesn't change, so they must be removed (clear) each time
+//! the storage is rebuilt (setSize).
+class ScatterMap
+  {
+  public:
+    typedef std::vector<int> location_vector;
+  private:
+    //! @brief Locations corresponding to an ID.
+    struct Entry
+      {
+	std::vector<int> dofs; //!< equation numbers.
+	location_vector locations; //!< offset of the (i,j) coefficient at j*n+i (-1 if not assembled).
+      };
+    typedef std::unordered_map<const ID *, Entry> entries_map;
+    entries_map entries;
+  public:
+    ScatterMap(void);
+
+    void clear(void);
+    //! @brief Return the number of IDs stored.
+    inline size_t size(void) const
+      { return entries.size(); }
+    const location_vector *find(const ID &) const;
+    location_vector &insert(const ID &);
+    static void scatter(const location_vector &, const Matrix &, const double &, double *);
+  };
+} // end of XC namespace
+
+#endif
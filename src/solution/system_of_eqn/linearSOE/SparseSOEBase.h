@@ -32,6 +32,7 @@
 #define SparseSOEBase_h
 
 #include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
+#include <solution/system_of_eqn/linearSOE/ScatterMap.h>
 
 namespace XC {
 
@@ -42,6 +43,7 @@ class SparseSOEBase: public FactoredSOEBase
   {
   protected:
     int nnz; //! number of non-zeros in A
+    ScatterMap scatterMap; //!< locations of the element matrices coefficients in A.
 
     SparseSOEBase(SolutionStrategy *,int classTag,int N= 0, int NNZ= 0);
   public:
@@ -56,281 +56,158 @@
 // Revision: A
 //
 // Description: This file contains the class definition for 
-// BandSPDLinThreadSolver. It solves the XC::BandSPDLinSOE object by calling
-// Thread routines.
+// BandSPDLinThreadSolver. It solves the XC::BandSPDLinSOE object
+// using threads.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
-#include <glibmm/thread.h>
-#include <mysql/my_pthread.h>
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int n, kd;
-  int blockSize, currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_BandSPDLinThreadSolver;
-
-
-XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver()
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(1), 
- running(false), blockSize(1)
-{
-  
-}
-
-XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(int numProcessors, int blckSize)
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(numProcessors),
- running(false), blockSize(blckSize)
-{
-
-}
+#include "solution/system_of_eqn/linearSOE/ColumnBlockLDLt.h"
+#include <omp.h>
+
+//! @brief Default constructor (uses the number of threads given
+//! by the OpenMP runtime).
+XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(void)
+  :BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver),
+   numThreads(omp_get_max_threads()), blockSize(32), minDiagTol(1.0e-12) {}
+
+//! @brief Constructor.
+//!
+//! @param nThreads: number of threads to use.
+//! @param blckSize: number of columns of each block.
+//! @param tol: minimum value allowed for the pivots.
+XC::BandSPDLinThreadSolver::BandSPDLinThreadSolver(int nThreads, int blckSize, double tol)
+  :BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver),
+   numThreads(1), blockSize(32), minDiagTol(tol)
+  {
+    setNumThreads(nThreads);
+    setBlockSize(blckSize);
+  }
 
-extern "C" int dpbsv_(char *UPLO, int *N, int *KD, int *NRHS, 
-		      double *A, int *LDA, double *B, int *LDB, 
-		      int *INFO);
+//! @brief Return the number of threads used in the factorization.
+int XC::BandSPDLinThreadSolver::getNumThreads(void) const
+  { return numThreads; }
 
-extern "C" int dpbtrf_(char *UPLO, int *N, int *KD, double *A, 
-		       int *LDA, int *INFO);
+//! @brief Set the number of threads used in the factorization.
+void XC::BandSPDLinThreadSolver::setNumThreads(const int &n)
+  {
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING number of threads must be at least one."
+		  << " Using one thread." << std::endl;
+	numThreads= 1;
+      }
+    else
+      numThreads= n;
+  }
 
-extern "C" int dpbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
-		       double *A, int *LDA, double *B, int *LDB, 
-		       int *INFO);
-		       
+//! @brief Return the number of columns of each block.
+int XC::BandSPDLinThreadSolver::getBlockSize(void) const
+  { return blockSize; }
 
-void *BandSPDLinThreadSolver_Worker(void *arg);
+//! @brief Set the number of columns of each block.
+void XC::BandSPDLinThreadSolver::setBlockSize(const int &n)
+  {
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING block size must be at least one."
+		  << " Using one column per block." << std::endl;
+	blockSize= 1;
+      }
+    else
+      blockSize= n;
+  }
 
+//! @brief Compute the first row and the address of the first
+//! coefficient of each column in the band storage (column j stores
+//! rows max(0,j-kd) to j at the end of its kd+1 coefficients).
+void XC::BandSPDLinThreadSolver::set_columns(void)
+  {
+    const int n= theSOE->size;
+    const int kd= theSOE->half_band-1;
+    const int ldA= kd+1;
+    double *A= theSOE->A.getDataPtr();
+    if(rowTop.Size()!=n)
+      {
+        rowTop= ID(n);
+        topRowPtr= std::vector<double *>(n);
+        invD= Vector(n);
+      }
+    for(int j= 0;j<n;j++)
+      {
+	const int top= std::max(0,j-kd);
+	rowTop[j]= top;
+	topRowPtr[j]= A+j*ldA+kd-(j-top);
+      }
+  }
 
+//! @brief Compute solution.
+//!
+//! The solver first copies the B vector into X. If the matrix is not
+//! factored yet, it is factored using numThreads threads. Then the
+//! forward and back substitutions are performed.
+//! The solve process changes \f$A\f$ and \f$X\f$.   
 int XC::BandSPDLinThreadSolver::solve(void)
   {
-    if(theSOE == 0)
+    if(!theSOE)
       {
-	std::cerr << "XC::BandSPDLinThreadSolver::solve(void)- ";
-	std::cerr << " No XC::LinearSOE object has been set\n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set." << std::endl;
 	return -1;
       }
 
-    int n = theSOE->size;
-    int kd = theSOE->half_band -1;
-    int ldA = kd +1;
-    int nrhs = 1;
-    int ldB = n;
-    int info;
-    double *Aptr = theSOE->A;
-    double *Xptr = theSOE->X;
-    double *Bptr = theSOE->B;
+    const int n= theSOE->size;
+    if(n==0)
+      return 0;
+    double *Xptr= theSOE->getPtrX();
+    const double *Bptr= theSOE->getPtrB();
 
     // first copy B into X
-    for (int i=0; i<n; i++)
-	*(Xptr++) = *(Bptr++);
-    Xptr = theSOE->X;
-
-    // now solve AX = Y
-    if (theSOE->factored == false) {
+    for(int i=0; i<n; i++)
+      Xptr[i]= Bptr[i];
 
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_BandSPDLinThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_BandSPDLinThreadSolver.workToDo = 0;
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(nullptr,0, BandSPDLinThreadSolver_Worker, nullptr, 
-		     THR_BOUND|THR_DAEMON, nullptr);
-
-        running = true;
-      }
-      
-  
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-        // assign the global variables the threads will need
-        TCB_BandSPDLinThreadSolver.A = Aptr;
-	TCB_BandSPDLinThreadSolver.X = Xptr;
-	TCB_BandSPDLinThreadSolver.B = Bptr;
-	TCB_BandSPDLinThreadSolver.n = n;
-	TCB_BandSPDLinThreadSolver.kd = kd;
-	TCB_BandSPDLinThreadSolver.info = 0;
-        TCB_BandSPDLinThreadSolver.workToDo = NP;
-        TCB_BandSPDLinThreadSolver.blockSize = blockSize;
-        TCB_BandSPDLinThreadSolver.currentBlock = -1;
-	TCB_BandSPDLinThreadSolver.threadID = 0;
-	TCB_BandSPDLinThreadSolver.numThreads = NP;
-        TCB_BandSPDLinThreadSolver.threadsDone = 0;
-        TCB_BandSPDLinThreadSolver.threadsDoneBlock = NP;
-
-        // wake up the threads
-        cond_broadcast(&TCB_BandSPDLinThreadSolver.start_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-
-         while (TCB_BandSPDLinThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_BandSPDLinThreadSolver.end_cond, &TCB_BandSPDLinThreadSolver.end_mutex);
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    }
-
-    // solve using factored matrix
-    dpbtrs_("U",&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-    
-
-    // check if successful
-    if (info != 0)
+    if(theSOE->factored == false)
       {
-	return info;
-	this->setPyProp("info", boost::python::object(info));
+        set_columns();
+	int failedRow= -1;
+	const int maxColHeight= theSOE->half_band;
+	const int info= ColumnBlockLDLt::factor(n, rowTop.getDataPtr(), topRowPtr.data(), invD.getDataPtr(), maxColHeight, minDiagTol, blockSize, numThreads, failedRow);
+	if(info<0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; aii < minDiagTol in row: " << failedRow
+		      << std::endl;
+	    return info;
+	  }
+        theSOE->factored = true;
       }
-
-    theSOE->factored = true;
+    ColumnBlockLDLt::solve(n, rowTop.getDataPtr(), topRowPtr.data(), invD.getDataPtr(), Xptr);
     return 0;
   }
-    
-
 
-int XC::BandSPDLinThreadSolver::setSize()
-{
-    // nothing to do    
-    return 0;
-}
+//! @brief Returns the determinant.
+double XC::BandSPDLinThreadSolver::getDeterminant(void) 
+  {
+    const int n= invD.Size();
+    double determinant = 1.0;
+    for(int i=0; i<n; i++)
+      determinant *= invD[i];
+    determinant = 1.0/determinant;
+    return determinant;
+  }
 
+//! @brief Does nothing but return \f$0\f$ (the columns are
+//! located when the matrix is factored).
+int XC::BandSPDLinThreadSolver::setSize(void)
+  { return 0; }
 
+//! @brief Does nothing but return \f$0\f$.
 int XC::BandSPDLinThreadSolver::sendSelf(Communicator &comm)
-{
-    // nothing to do
-    return 0;
-}
+  { return 0; }
 
+//! @brief Does nothing but return \f$0\f$.
 int XC::BandSPDLinThreadSolver::recvSelf(const Communicator &comm)
-{
-    // nothing to do
-    return 0;
-}
-
-// Thread routine called from thr_create() as a Bound Daemon Thread
-void *BandSPDLinThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-        while (TCB_BandSPDLinThreadSolver.workToDo == 0)
-          cond_wait(&TCB_BandSPDLinThreadSolver.start_cond, &TCB_BandSPDLinThreadSolver.start_mutex);
-
-        TCB_BandSPDLinThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_BandSPDLinThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-      // do some initialization for the factorization
-      int currentBlock =0;
-      int n = TCB_BandSPDLinThreadSolver.n;
-      int kd = TCB_BandSPDLinThreadSolver.kd;
-      int blckSize = TCB_BandSPDLinThreadSolver.blockSize;
-      double *Aptr = TCB_BandSPDLinThreadSolver.A;
-      double *Bptr = TCB_BandSPDLinThreadSolver.B;
-      double *Xptr = TCB_BandSPDLinThreadSolver.X;
-      int numThreads = TCB_BandSPDLinThreadSolver.numThreads;
-    
-      int nBlocks = n/blckSize;
-
-      for (int i=0; i<nBlocks; i++) {
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // wait till last block row is done
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-            while(TCB_BandSPDLinThreadSolver.threadsDoneBlock < numThreads)
-	      cond_wait(&TCB_BandSPDLinThreadSolver.endBlock_cond, &TCB_BandSPDLinThreadSolver.endBlock_mutex);
-
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock = 0;
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);        
-
-          // FACTOR DIAG BLOCK
-       
-          // allow other threads to now proceed
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_BandSPDLinThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);        
-
-          
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                   
-	}
-        else {
-
-          // wait till diag i is done 
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-             while (TCB_BandSPDLinThreadSolver.currentBlock < i)
-                cond_wait(&TCB_BandSPDLinThreadSolver.startBlock_cond, 
-			  &TCB_BandSPDLinThreadSolver.startBlock_mutex); 
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                             
-	}
-      }
-
-      // signal the XC::main thread that this thread is done with the work
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-         TCB_BandSPDLinThreadSolver.threadsDone++;
-
-         cond_signal(&TCB_BandSPDLinThreadSolver.end_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    } 
-  return nullptr;
-}
-
-
-
-
-
-
-
+  { return 0; }
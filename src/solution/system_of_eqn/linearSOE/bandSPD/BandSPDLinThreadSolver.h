@@ -58,7 +58,7 @@
 //
 // Description: This file contains the class definition for 
 // BandSPDLinThreadSolver. It solves the BandSPDLinSOE in parallel
-// using solaris threads.
+// using threads.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
@@ -66,26 +66,49 @@
 #define BandSPDLinThreadSolver_h
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include <vector>
 
 namespace XC {
 //! @ingroup LinearSolver
 //
-//! @brief Solves the BandSPDLinSOE in parallel
-//! using solaris threads.
+//! @brief Solves the BandSPDLinSOE in parallel using threads.
+//!
+//! The band matrix is factored as \f$LDL^t\f$ one column block at
+//! a time: the diagonal block is factored by one thread, then the
+//! rest of the block row is computed by numThreads threads (see
+//! ColumnBlockLDLt). The factorization is stored in the coefficients of
+//! the band matrix and its inverse diagonal in invD, so no LAPACK
+//! routines are called for the factorization or subsequent
+//! substitution.
 class BandSPDLinThreadSolver: public BandSPDLinSolver
   {
   private:
-    int NP;
-    int running;
-    int blockSize;
+    int numThreads; //!< number of threads.
+    int blockSize; //!< number of columns of each block.
+    double minDiagTol; //!< minimum value allowed for the pivots.
+    ID rowTop; //!< first row stored in each column.
+    std::vector<double *> topRowPtr; //!< address of the first coefficient stored in each column.
+    Vector invD; //!< inverse of the diagonal terms.
 
+    void set_columns(void);
+  protected:
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
     BandSPDLinThreadSolver(void);    
-    BandSPDLinThreadSolver(int numProcessors, int blockSize);        
+    BandSPDLinThreadSolver(int numThreads, int blockSize, double tol= 1.0e-12);        
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     int solve(void);
     int setSize(void);
+    double getDeterminant(void);
+
+    int getNumThreads(void) const;
+    void setNumThreads(const int &);
+    int getBlockSize(void) const;
+    void setBlockSize(const int &);
     
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);  
@@ -98,4 +121,3 @@ inline LinearSOESolver *BandSPDLinThreadSolver::getCopy(void) const
 
 #endif
 
-
@@ -0,0 +1,238 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//EigenSparseSPDLinSOE.cc
+
+#include <solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSolver.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::EigenSparseSPDLinSOE::EigenSparseSPDLinSOE(SolutionStrategy *owr)
+  :FactoredSOEBase(owr,LinSOE_TAGS_EigenSparseSPDLinSOE), A(), patternChanged(true), scatterMap()
+  {}
+
+//! @brief Virtual constructor.
+XC::SystemOfEqn *XC::EigenSparseSPDLinSOE::getCopy(void) const
+  { return new EigenSparseSPDLinSOE(*this); }
+
+//! @brief Sets the solver to use.
+bool XC::EigenSparseSPDLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    EigenSparseSPDLinSolver *tmp= dynamic_cast<EigenSparseSPDLinSolver *>(newSolver);
+    if(tmp)
+      retval= FactoredSOEBase::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; solver not compatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Return true if the pattern of the argument is the same
+//! as the pattern of A.
+bool XC::EigenSparseSPDLinSOE::same_pattern(const sparse_matrix &other) const
+  {
+    bool retval= (A.cols()==other.cols()) && (A.nonZeros()==other.nonZeros());
+    if(retval)
+      {
+	const int n= A.cols();
+	retval= std::equal(A.outerIndexPtr(), A.outerIndexPtr()+n+1, other.outerIndexPtr());
+	if(retval)
+	  retval= std::equal(A.innerIndexPtr(), A.innerIndexPtr()+A.nonZeros(), other.innerIndexPtr());
+      }
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the number of vertices in the graph.
+//!
+//! The pattern of the lower triangle of A (the diagonal and the
+//! adjacency of each vertex of the graph with a greater index) is
+//! built from the compressed adjacency of the graph.
+int XC::EigenSparseSPDLinSOE::setSize(Graph &theGraph)
+  {
+    size= checkSize(theGraph);
+    if(size < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          <<"; size of soe < 0\n";
+	return -1;
+      }
+
+    const CSRGraph &g= theGraph.getCSR();
+    if(g.getNumVertex() != size)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: graph vertices not numbered from 0 to "
+		  << size-1 << " - size set to 0.\n";
+	size = 0;
+	return -1;
+      }
+
+    // count the entries of the lower triangle (diagonal included).
+    Eigen::VectorXi columnSizes(size);
+    for(int col= 0; col<size; col++)
+      {
+	const int *first= std::upper_bound(g.begin(col), g.end(col), col);
+	columnSizes[col]= 1+(g.end(col)-first);
+      }
+    sparse_matrix tmp(size,size);
+    tmp.reserve(columnSizes);
+    // the adjacency is sorted so the row indexes are inserted in
+    // ascending order.
+    for(int col= 0; col<size; col++)
+      {
+	tmp.insert(col,col)= 0.0; // diagonal.
+	for(const int *i= std::upper_bound(g.begin(col), g.end(col), col); i!=g.end(col); i++)
+	  tmp.insert(*i,col)= 0.0;
+      }
+    tmp.makeCompressed();
+    if(!same_pattern(tmp))
+      patternChanged= true;
+    A.swap(tmp);
+    
+    scatterMap.clear(); // A storage has changed.
+    factored= false;
+    B.resize(size);
+    B.Zero();
+    X.resize(size);
+    X.Zero();
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    if(the_Solver)
+      {
+	const int solverOK= the_Solver->setSize();
+	if(solverOK < 0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: solver failed setSize().\n";
+	    return solverOK;
+	  }
+      }
+    return 0;
+  }
+
+//! @brief Compute the locations in A of the coefficients that
+//! correspond to the equation numbers being passed as parameter.
+//!
+//! Only the coefficients of the lower triangle are located, the
+//! others are left as -1 (ignored when assembling).
+const XC::ScatterMap::location_vector &XC::EigenSparseSPDLinSOE::compute_locations(const ID &id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(id);
+    const int idSize= id.Size();
+    const int *outer= A.outerIndexPtr();
+    const int *inner= A.innerIndexPtr();
+    for(int j= 0; j<idSize; j++)
+      {
+	const int col= id(j);
+	if(col < size && col >= 0)
+	  {
+	    const int *colBegin= inner+outer[col];
+	    const int *colEnd= inner+outer[col+1];
+	    for(int i= 0; i<idSize; i++)
+	      {
+		const int row= id(i);
+		if(row < size && row >= col)
+		  {
+		    // row indexes are sorted in each column.
+		    const int *k= std::lower_bound(colBegin, colEnd, row);
+		    if((k!=colEnd) && (*k==row))
+		      retval[j*idSize+i]= k-inner;
+		  }
+	      }
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! The locations of the coefficients are computed the first time the
+//! ID is assembled and then reused until the size of the system changes.
+int XC::EigenSparseSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)  
+	return 0;
+
+    // check that m and id are of similar size
+    const int idSize = id.Size();
+    if(idSize != m.noRows() || idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+
+    const ScatterMap::location_vector *locations= scatterMap.find(id);
+    if(!locations)
+      locations= &compute_locations(id);
+    ScatterMap::scatter(*locations, m, fact, A.valuePtr());
+    factored= false; // A has changed.
+    return 0;
+  }
+
+//! @brief Zeroes the matrix (keeping its sparsity pattern) and marks
+//! the system as not factored.
+void XC::EigenSparseSPDLinSOE::zeroA(void)
+  {
+    std::fill(A.valuePtr(), A.valuePtr()+A.nonZeros(), 0.0);
+    factored= false;
+  }
+
+//! @brief Solves the system for each of the columns of the
+//! right hand side matrix argument, reusing the factorization of A.
+//!
+//! @param rhs: right hand side vectors (one per column).
+//! @param x: solution vectors (one per column).
+int XC::EigenSparseSPDLinSOE::solveMultipleRHS(const Matrix &rhs, Matrix &x)
+  {
+    int retval= -1;
+    EigenSparseSPDLinSolver *theEigenSolver= dynamic_cast<EigenSparseSPDLinSolver *>(getSolver());
+    if(theEigenSolver)
+      retval= theEigenSolver->solve(rhs, x);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; no solver has been set." << std::endl;
+    return retval;
+  }
+
+int XC::EigenSparseSPDLinSOE::sendSelf(Communicator &comm)
+  {
+    return 0;
+  }
+
+int XC::EigenSparseSPDLinSOE::recvSelf(const Communicator &comm)
+  {
+    return 0;
+  }
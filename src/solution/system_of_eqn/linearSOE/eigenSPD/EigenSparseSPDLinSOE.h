@@ -0,0 +1,96 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//EigenSparseSPDLinSOE.h
+
+#ifndef EigenSparseSPDLinSOE_h
+#define EigenSparseSPDLinSOE_h
+
+#include "solution/system_of_eqn/linearSOE/FactoredSOEBase.h"
+#include "solution/system_of_eqn/linearSOE/ScatterMap.h"
+#include "utility/matrix/Vector.h"
+#include <Eigen/SparseCore>
+
+namespace XC {
+class EigenSparseSPDLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Sparse symmetric positive definite system of equations
+//! to be solved with the <a href="https://eigen.tuxfamily.org/dox/group__SparseCholesky__Module.html" target="_new"> Eigen sparse Cholesky</a> solvers.
+//!
+//! Only the lower triangle of A is stored, in an Eigen compressed
+//! column (CSC) matrix whose pattern is built from the compressed
+//! adjacency of the DOF graph in setSize. The element matrices are
+//! added directly to the coefficients of that matrix (see ScatterMap).
+//! If the new pattern is the same as the previous one (i.e. the
+//! domain has changed but the connectivity has not) the solver
+//! keeps its symbolic analysis.
+class EigenSparseSPDLinSOE: public FactoredSOEBase
+  {
+  public:
+    typedef Eigen::SparseMatrix<double, Eigen::ColMajor, int> sparse_matrix;
+  private:
+    sparse_matrix A; //!< lower triangle of the system matrix.
+    bool patternChanged; //!< true if the pattern of A has changed since the last symbolic analysis.
+    ScatterMap scatterMap; //!< locations of the element matrices coefficients in A.
+
+    const ScatterMap::location_vector &compute_locations(const ID &);
+    bool same_pattern(const sparse_matrix &) const;
+  protected:
+    bool setSolver(LinearSOESolver *);
+
+    friend class SolutionStrategy;
+    friend class FEM_ObjectBroker;
+    EigenSparseSPDLinSOE(SolutionStrategy *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    
+    void zeroA(void);
+
+    int solveMultipleRHS(const Matrix &, Matrix &);
+
+    //! @brief Return the number of non-zero coefficients stored
+    //! (lower triangle of A).
+    inline int getNumNonZeros(void) const
+      { return A.nonZeros(); }
+    //! @brief Return true if the pattern of A has changed since the
+    //! last symbolic analysis.
+    inline bool getPatternChanged(void) const
+      { return patternChanged; }
+
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);
+
+    friend class EigenSparseSPDLinSolver;
+  };
+} // end of XC namespace
+
+
+#endif
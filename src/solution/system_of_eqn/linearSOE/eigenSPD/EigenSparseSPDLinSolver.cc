@@ -0,0 +1,224 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//EigenSparseSPDLinSolver.cc
+
+#include <solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSolver.h>
+#include "utility/matrix/Matrix.h"
+
+//! @brief Constructor.
+XC::EigenSparseSPDLinSolver::EigenSparseSPDLinSolver(void)
+ : LinearSOESolver(SOLVER_TAGS_EigenSparseSPDLinSolver),
+   ldlt(), analyzed(false), numSymbolicAnalysis(0), numFactorizations(0),
+   theSOE(nullptr)
+  {}
+
+//! @brief Copy constructor.
+//!
+//! The factorization is not shared between copies; the copy will
+//! compute its own one when setSize is called.
+XC::EigenSparseSPDLinSolver::EigenSparseSPDLinSolver(const EigenSparseSPDLinSolver &other)
+ : LinearSOESolver(other),
+   ldlt(), analyzed(false), numSymbolicAnalysis(0), numFactorizations(0),
+   theSOE(other.theSOE)
+  {}
+
+//! @brief Assignment operator (see copy constructor).
+XC::EigenSparseSPDLinSolver &XC::EigenSparseSPDLinSolver::operator=(const EigenSparseSPDLinSolver &other)
+  {
+    if(this!=&other)
+      {
+	LinearSOESolver::operator=(other);
+	analyzed= false;
+	theSOE= other.theSOE;
+      }
+    return *this;
+  }
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::EigenSparseSPDLinSolver::getCopy(void) const
+   { return new EigenSparseSPDLinSolver(*this); }
+
+//! @brief Computes the symbolic analysis (fill-reducing ordering and
+//! elimination tree) of the pattern of A.
+int XC::EigenSparseSPDLinSolver::analyze(void)
+  {
+    analyzed= false;
+    ldlt.analyzePattern(theSOE->A);
+    if(ldlt.info()!=Eigen::Success)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: symbolic analysis failed."
+		  << std::endl;
+	return -1;
+      }
+    analyzed= true;
+    numSymbolicAnalysis++;
+    theSOE->patternChanged= false;
+    return 0;
+  }
+
+//! @brief Computes the numeric factorization of A if the system
+//! is not marked as factored (i.e. A has changed since the last
+//! factorization).
+int XC::EigenSparseSPDLinSolver::factorize(void)
+  {
+    if(theSOE->factored)
+      return 0; // reuse the factorization.
+
+    if(!analyzed || theSOE->patternChanged)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: setSize has not been called.\n";
+	return -1;
+      }
+    ldlt.factorize(theSOE->A);
+    if(ldlt.info()!=Eigen::Success)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: numeric factorization failed"
+		  << " (zero pivot, the matrix is singular)."
+		  << std::endl;
+	return -2;
+      }
+    numFactorizations++;
+    theSOE->factored= true;
+    return 0;
+  }
+
+//! @brief Solves the system of equations.
+//!
+//! The numeric factorization is computed only if the system is not
+//! marked as factored, otherwise the previous one is reused (i.e.
+//! modified Newton iterations or linear analysis with constant A).
+int XC::EigenSparseSPDLinSolver::solve(void)
+  {
+    const int n= theSOE->X.Size();
+    if(n == 0)
+      return 0;
+    
+    const int ok= factorize();
+    if(ok<0)
+      return ok;
+
+    Eigen::Map<const Eigen::VectorXd> b(theSOE->B.getDataPtr(), n);
+    Eigen::Map<Eigen::VectorXd> x(theSOE->X.getDataPtr(), n);
+    x= ldlt.solve(b);
+    if(ldlt.info()!=Eigen::Success)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solution failed." << std::endl;
+	return -1;
+      }
+    return 0;
+  }
+
+//! @brief Solves the system for each column of the rhs matrix using
+//! a single numeric factorization of A.
+//!
+//! @param rhs: right hand side vectors (one per column).
+//! @param x: solution vectors (one per column).
+int XC::EigenSparseSPDLinSolver::solve(const Matrix &rhs, Matrix &x)
+  {
+    const int n= theSOE->X.Size();
+    const int nrhs= rhs.noCols();
+    if(rhs.noRows()!=n)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: the number of rows of the right hand side: "
+		  << rhs.noRows() << " doesn't match the number of equations: "
+		  << n << std::endl;
+	return -1;
+      }
+    x.resize(n, nrhs);
+    x.Zero();
+    if(n == 0 || nrhs==0)
+      return 0;
+    
+    const int ok= factorize();
+    if(ok<0)
+      return ok;
+
+    // Matrix stores its data column by column.
+    Eigen::Map<const Eigen::MatrixXd> B(rhs.getDataPtr(), n, nrhs);
+    Eigen::Map<Eigen::MatrixXd> X(x.getDataPtr(), n, nrhs);
+    X= ldlt.solve(B);
+    if(ldlt.info()!=Eigen::Success)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solution failed." << std::endl;
+	return -1;
+      }
+    return 0;
+  }
+
+//! @brief Computes the symbolic analysis of the system matrix if
+//! its pattern has changed since the last one.
+int XC::EigenSparseSPDLinSolver::setSize(void)
+  {
+    int retval= 0;
+    // the numeric factorization is no longer valid.
+    theSOE->factored= false;
+    if(theSOE->X.Size()>0)
+      {
+	if(!analyzed || theSOE->patternChanged)
+	  retval= analyze();
+      }
+    return retval;
+  }
+
+//! @brief Sets the system of equations to solve.
+bool XC::EigenSparseSPDLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    EigenSparseSPDLinSOE *tmp= dynamic_cast<EigenSparseSPDLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+	analyzed= false; // new system.
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< " not a suitable system of equations"
+		<< std::endl;
+    return retval;
+  }
+
+bool XC::EigenSparseSPDLinSolver::setLinearSOE(EigenSparseSPDLinSOE &theLinearSOE)
+  { return setLinearSOE(&theLinearSOE); }
+
+int XC::EigenSparseSPDLinSolver::sendSelf(Communicator &comm)
+  {
+    // nothing to do
+    return 0;
+  }
+
+int XC::EigenSparseSPDLinSolver::recvSelf(const Communicator &comm)
+  {
+    // nothing to do
+    return 0;
+  }
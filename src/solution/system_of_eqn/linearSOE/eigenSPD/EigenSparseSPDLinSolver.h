@@ -0,0 +1,90 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//EigenSparseSPDLinSolver.h
+
+#ifndef EigenSparseSPDLinSolver_h
+#define EigenSparseSPDLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSOE.h>
+#include <Eigen/SparseCholesky>
+
+namespace XC {
+
+//! @brief Solver for sparse symmetric positive definite systems
+//! based on the <a href="https://eigen.tuxfamily.org/dox/group__SparseCholesky__Module.html" target="_new"> Eigen</a> simplicial LDLT factorization
+//! (fill-reducing AMD ordering).
+//!
+//! The symbolic analysis (ordering and elimination tree) is computed
+//! only when the pattern of the system matrix changes and the numeric
+//! factorization only when the matrix is not marked as factored
+//! (see FactoredSOEBase).
+//! @ingroup Solver
+class EigenSparseSPDLinSolver: public LinearSOESolver
+  {
+  public:
+    typedef Eigen::SimplicialLDLT<EigenSparseSPDLinSOE::sparse_matrix, Eigen::Lower, Eigen::AMDOrdering<int> > ldlt_solver;
+  private:
+    ldlt_solver ldlt; //!< Eigen factorization.
+    bool analyzed; //!< true if the symbolic analysis is done.
+    size_t numSymbolicAnalysis; //!< number of symbolic analysis computed.
+    size_t numFactorizations; //!< number of numeric factorizations computed.
+    int analyze(void);
+    int factorize(void);
+
+  protected:    
+    EigenSparseSPDLinSOE *theSOE;
+
+    friend class FEM_ObjectBroker;
+    friend class LinearSOE;
+    EigenSparseSPDLinSolver(void);     
+    EigenSparseSPDLinSolver(const EigenSparseSPDLinSolver &);
+    EigenSparseSPDLinSolver &operator=(const EigenSparseSPDLinSolver &);
+    virtual LinearSOESolver *getCopy(void) const;
+    virtual bool setLinearSOE(LinearSOE *theSOE);
+  public:
+    int solve(void);
+    int solve(const Matrix &, Matrix &);
+    int setSize(void);
+
+    bool setLinearSOE(EigenSparseSPDLinSOE &theSOE);
+
+    //! @brief Return the number of symbolic analysis computed.
+    inline size_t getNumSymbolicAnalysis(void) const
+      { return numSymbolicAnalysis; }
+    //! @brief Return the number of numeric factorizations computed.
+    inline size_t getNumFactorizations(void) const
+      { return numFactorizations; }
+    
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);    
+  };
+
+} // end of XC namespace
+
+#endif
@@ -127,6 +127,7 @@ class FullGenLinSOE: public FactoredSOEBase
     void zeroA(void);
     
     friend class FullGenLinLapackSolver;    
+    friend class FullGenLinSubstrThreadSolver;
 
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
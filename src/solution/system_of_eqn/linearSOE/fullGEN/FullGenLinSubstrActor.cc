@@ -0,0 +1,178 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FullGenLinSubstrActor.cc
+
+#include "FullGenLinSubstrActor.h"
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);
+
+//! @brief Make the matrix argument have the given number of rows
+//! and columns (its data size must match them to be sent through
+//! a channel, so the matrix is not resized in place).
+static void set_matrix_size(XC::Matrix &m, const int &nRows, const int &nCols)
+  {
+    if((m.noRows()!=nRows) || (m.noCols()!=nCols) || (m.getDataSize()!=nRows*nCols))
+      m= XC::Matrix(nRows, nCols);
+  }
+
+//! @brief Constructor.
+//!
+//! @param theChannel: channel to communicate with the solver.
+//! @param theBroker: object broker of the actor thread.
+XC::FullGenLinSubstrActor::FullGenLinSubstrActor(Channel &theChannel, FEM_ObjectBroker &theBroker)
+  : Actor(theChannel, theBroker, 0) {}
+
+//! @brief Receive the blocks of the partition matrix, factor the
+//! internal block and send the contribution of the partition to the
+//! interface matrix (Kbi*Kii^-1*Kib). Before that, sends an ID with
+//! the value returned by the LAPACK factorization (0 if successful).
+//!
+//! @param ni: number of internal equations.
+//! @param nb: number of interface equations.
+int XC::FullGenLinSubstrActor::condense(const int &ni, const int &nb)
+  {
+    set_matrix_size(Kii, ni, ni);
+    recvMatrix(Kii);
+    if(nb>0)
+      {
+        set_matrix_size(W, ni, nb);
+        recvMatrix(W); // Kib, replaced by Kii^-1*Kib below.
+        set_matrix_size(Kbi, nb, ni);
+        recvMatrix(Kbi);
+      }
+    if(iPiv.Size()<ni)
+      iPiv.resize(ni);
+    int n= ni;
+    int ldA= ni;
+    int info= 0;
+    dgetrf_(&n, &n, Kii.getDataPtr(), &ldA, iPiv.getDataPtr(), &info);
+    ID status(1);
+    status(0)= info;
+    sendID(status);
+    if(info!=0)
+      {
+        std::cerr << "FullGenLinSubstrActor::" << __FUNCTION__
+                  << "; LAPACK factorization failed - " << info
+                  << " returned." << std::endl;
+        return -1;
+      }
+    if(nb>0)
+      {
+        char strN[]= "N";
+        int nrhs= nb;
+        int ldB= ni;
+        dgetrs_(strN, &n, &nrhs, Kii.getDataPtr(), &ldA, iPiv.getDataPtr(), W.getDataPtr(), &ldB, &info);
+        Matrix S(nb, nb);
+        S.addMatrixProduct(0.0, Kbi, W, 1.0);
+        sendMatrix(S);
+      }
+    return 0;
+  }
+
+//! @brief Receive the internal load and send the contribution of the
+//! partition to the interface load (Kbi*Kii^-1*Fi).
+//!
+//! @param ni: number of internal equations.
+//! @param nb: number of interface equations.
+int XC::FullGenLinSubstrActor::reduce(const int &ni, const int &nb)
+  {
+    if(y.Size()!=ni)
+      y.resize(ni);
+    recvVector(y);
+    char strN[]= "N";
+    int n= ni;
+    int nrhs= 1;
+    int ldA= ni;
+    int info= 0;
+    dgetrs_(strN, &n, &nrhs, Kii.getDataPtr(), &ldA, iPiv.getDataPtr(), y.getDataPtr(), &ldA, &info);
+    if(nb>0)
+      {
+        Vector g(nb);
+        g.addMatrixVector(0.0, Kbi, y, 1.0);
+        sendVector(g);
+      }
+    return info;
+  }
+
+//! @brief Receive the values of the interface unknowns and send the
+//! values of the internal ones (Kii^-1*(Fi-Kib*ub)).
+//!
+//! @param ni: number of internal equations.
+//! @param nb: number of interface equations.
+int XC::FullGenLinSubstrActor::recover(const int &ni, const int &nb)
+  {
+    Vector ui(y);
+    if(nb>0)
+      {
+        Vector ub(nb);
+        recvVector(ub);
+        ui.addMatrixVector(1.0, W, ub, -1.0);
+      }
+    sendVector(ui);
+    return 0;
+  }
+
+//! @brief Process the requests of the solver until receiving the
+//! finish command.
+int XC::FullGenLinSubstrActor::run(void)
+  {
+    ID header(3);
+    while(true)
+      {
+        if(recvID(header)<0)
+          {
+            std::cerr << "FullGenLinSubstrActor::" << __FUNCTION__
+                      << "; failed to receive the request." << std::endl;
+            return -1;
+          }
+        const int cmd= header(0);
+        const int ni= header(1);
+        const int nb= header(2);
+        switch(cmd)
+          {
+          case cmdFinish:
+            return 0;
+          case cmdCondense:
+            condense(ni, nb);
+            break;
+          case cmdReduce:
+            reduce(ni, nb);
+            break;
+          case cmdRecover:
+            recover(ni, nb);
+            break;
+          default:
+            std::cerr << "FullGenLinSubstrActor::" << __FUNCTION__
+                      << "; unknown command: " << cmd << std::endl;
+            return -1;
+          }
+      }
+    return 0;
+  }
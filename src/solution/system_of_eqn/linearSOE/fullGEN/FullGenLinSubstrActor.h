@@ -0,0 +1,79 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FullGenLinSubstrActor.h
+
+#ifndef FullGenLinSubstrActor_h
+#define FullGenLinSubstrActor_h
+
+#include "utility/actor/actor/Actor.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Actor that condenses the internal equations of one
+//! partition of a FullGenLinSOE (see FullGenLinSubstrThreadSolver).
+//!
+//! The actor receives the blocks of the partition matrix
+//! (internal-internal, internal-interface and interface-internal),
+//! factors the internal block and returns the contribution of the
+//! partition to the interface (Schur complement) matrix. Then, for
+//! each right hand side, returns the contribution of the partition to
+//! the interface load and, once the interface values are solved,
+//! the values of its internal unknowns.
+//!
+//! Each request starts with an ID containing the command (see the
+//! enum below), the number of internal equations and the number of
+//! interface equations of the partition.
+class FullGenLinSubstrActor: public Actor
+  {
+  private:
+    Matrix Kii; //!< internal-internal block (LU factored).
+    ID iPiv; //!< row permutation of the Kii factorization.
+    Matrix Kbi; //!< interface-internal block.
+    Matrix W; //!< inverse of Kii times the internal-interface block.
+    Vector y; //!< inverse of Kii times the internal load.
+
+    int condense(const int &, const int &);
+    int reduce(const int &, const int &);
+    int recover(const int &, const int &);
+  public:
+    //! @brief Commands sent to the actor.
+    enum Command {cmdFinish= 0, cmdCondense= 1, cmdReduce= 2, cmdRecover= 3};
+
+    FullGenLinSubstrActor(Channel &, FEM_ObjectBroker &);
+
+    virtual int run(void);
+  };
+
+} // end of XC namespace
+
+#endif
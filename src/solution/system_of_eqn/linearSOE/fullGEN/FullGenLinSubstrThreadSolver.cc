@@ -0,0 +1,357 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FullGenLinSubstrThreadSolver.cc
+
+#include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSubstrThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSubstrActor.h>
+#include "utility/actor/machineBroker/ThreadMachineBroker.h"
+#include "utility/actor/objectBroker/FEM_ObjectBroker.h"
+#include "utility/actor/channel/Channel.h"
+#include "utility/matrix/Vector.h"
+
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, 
+		       int *iPiv, double *B, int *LDB, int *INFO);
+
+//! @brief Constructor.
+//!
+//! @param nPartitions: number of partitions of the system of equations.
+XC::FullGenLinSubstrThreadSolver::FullGenLinSubstrThreadSolver(int nPartitions)
+  : FullGenLinSolver(SOLVER_TAGS_FullGenLinSubstrThreadSolver),
+    numPartitions(1), objectBroker(nullptr), machineBroker(nullptr)
+  { setNumPartitions(nPartitions); }
+
+//! @brief Copy constructor (the actor threads are not shared).
+XC::FullGenLinSubstrThreadSolver::FullGenLinSubstrThreadSolver(const FullGenLinSubstrThreadSolver &other)
+  : FullGenLinSolver(other), numPartitions(other.numPartitions),
+    objectBroker(nullptr), machineBroker(nullptr) {}
+
+//! @brief Destructor (stops the actor threads).
+XC::FullGenLinSubstrThreadSolver::~FullGenLinSubstrThreadSolver(void)
+  { free_actors(); }
+
+//! @brief Return the number of partitions of the system of equations.
+int XC::FullGenLinSubstrThreadSolver::getNumPartitions(void) const
+  { return numPartitions; }
+
+//! @brief Set the number of partitions of the system of equations.
+void XC::FullGenLinSubstrThreadSolver::setNumPartitions(const int &n)
+  {
+    int nPartitions= n;
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING number of partitions must be at least one."
+		  << " Using one partition." << std::endl;
+	nPartitions= 1;
+      }
+    if(nPartitions!=numPartitions)
+      {
+        free_actors();
+        numPartitions= nPartitions;
+        if(theSOE)
+          theSOE->factored= false;
+      }
+  }
+
+//! @brief Send the finish command to the actors and stop their threads.
+void XC::FullGenLinSubstrThreadSolver::free_actors(void)
+  {
+    for(std::vector<Channel *>::iterator i= actorChannels.begin(); i!=actorChannels.end(); i++)
+      send_header(**i, FullGenLinSubstrActor::cmdFinish, 0);
+    actorChannels.clear();
+    if(machineBroker)
+      {
+        delete machineBroker; // stops the threads.
+        machineBroker= nullptr;
+      }
+    if(objectBroker)
+      {
+        delete objectBroker;
+        objectBroker= nullptr;
+      }
+  }
+
+//! @brief Start actors until there are at least n of them.
+int XC::FullGenLinSubstrThreadSolver::start_actors(const size_t &n)
+  {
+    if(!machineBroker)
+      {
+        objectBroker= new FEM_ObjectBroker();
+        machineBroker= new ThreadMachineBroker(objectBroker, numPartitions);
+      }
+    while(actorChannels.size()<n)
+      {
+        Channel *theChannel= machineBroker->startActor(ACTOR_TAGS_SUBSTRUCTURE);
+        if(!theChannel)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; could not start the actor for the partition: "
+		      << actorChannels.size() << std::endl;
+            return -1;
+          }
+        actorChannels.push_back(theChannel);
+      }
+    return 0;
+  }
+
+//! @brief Send the header of a request to the actor.
+//!
+//! @param theChannel: channel to communicate with the actor.
+//! @param cmd: command (see FullGenLinSubstrActor::Command).
+//! @param ni: number of internal equations of the partition.
+int XC::FullGenLinSubstrThreadSolver::send_header(Channel &theChannel, const int &cmd, const int &ni)
+  {
+    ID header(3);
+    header(0)= cmd;
+    header(1)= ni;
+    header(2)= interfaceEqs.size();
+    return theChannel.sendID(0, 0, header);
+  }
+
+//! @brief Compute the internal equations of each partition and the
+//! interface equations.
+//!
+//! The equations are split in blocks of consecutive equations. For
+//! each non-zero coefficient that couples the equations of two
+//! different blocks, the one with the greater index is moved to
+//! the interface (unless one of them is already there). The blocks
+//! with no internal equations are ignored.
+void XC::FullGenLinSubstrThreadSolver::set_partitions(void)
+  {
+    const int n= theSOE->size;
+    const Vector &A= theSOE->A;
+    const int blockSize= (n+numPartitions-1)/numPartitions;
+    std::vector<bool> isInterface(n, false);
+    for(int j= 0; j<n; j++)
+      {
+        const int pj= j/blockSize;
+        for(int i= 0; i<n; i++)
+          if((A(j*n+i)!=0.0) && (i/blockSize!=pj) && !isInterface[i] && !isInterface[j])
+            isInterface[std::max(i,j)]= true;
+      }
+    internalEqs.clear();
+    interfaceEqs.clear();
+    for(int first= 0; first<n; first+= blockSize)
+      {
+        std::vector<int> internal;
+        const int last= std::min(first+blockSize, n);
+        for(int i= first; i<last; i++)
+          {
+            if(isInterface[i])
+              interfaceEqs.push_back(i);
+            else
+              internal.push_back(i);
+          }
+        if(!internal.empty())
+          internalEqs.push_back(internal);
+      }
+  }
+
+//! @brief Send the blocks of each partition to its actor, assemble
+//! the interface matrix with the contributions returned by the
+//! actors and factor it.
+int XC::FullGenLinSubstrThreadSolver::condense(void)
+  {
+    const size_t numParts= internalEqs.size();
+    if(start_actors(numParts)!=0)
+      return -1;
+    const int n= theSOE->size;
+    const Vector &A= theSOE->A;
+    const int nb= interfaceEqs.size();
+    // Send the partitions (the actors work while the next ones are sent).
+    for(size_t k= 0; k<numParts; k++)
+      {
+        const std::vector<int> &internal= internalEqs[k];
+        const int ni= internal.size();
+        Matrix Kii(ni, ni);
+        for(int b= 0; b<ni; b++)
+          for(int a= 0; a<ni; a++)
+            Kii(a,b)= A(internal[b]*n+internal[a]);
+        Channel &theChannel= *actorChannels[k];
+        send_header(theChannel, FullGenLinSubstrActor::cmdCondense, ni);
+        theChannel.sendMatrix(0, 0, Kii);
+        if(nb>0)
+          {
+            Matrix Kib(ni, nb);
+            Matrix Kbi(nb, ni);
+            for(int b= 0; b<nb; b++)
+              for(int a= 0; a<ni; a++)
+                {
+                  Kib(a,b)= A(interfaceEqs[b]*n+internal[a]);
+                  Kbi(b,a)= A(internal[a]*n+interfaceEqs[b]);
+                }
+            theChannel.sendMatrix(0, 0, Kib);
+            theChannel.sendMatrix(0, 0, Kbi);
+          }
+      }
+    // Interface matrix.
+    S= Matrix(nb, nb);
+    for(int b= 0; b<nb; b++)
+      for(int a= 0; a<nb; a++)
+        S(a,b)= A(interfaceEqs[b]*n+interfaceEqs[a]);
+    int retval= 0;
+    ID status(1);
+    Matrix Sk(nb, nb);
+    for(size_t k= 0; k<numParts; k++)
+      {
+        Channel &theChannel= *actorChannels[k];
+        theChannel.recvID(0, 0, status);
+        if(status(0)!=0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; LAPACK factorization of partition: " << k
+		      << " failed - " << status(0) << " returned.\n";
+            retval= -1;
+          }
+        else if(nb>0)
+          {
+            theChannel.recvMatrix(0, 0, Sk);
+            S.addMatrix(1.0, Sk, -1.0);
+          }
+      }
+    if((retval==0) && (nb>0))
+      {
+        if(iPiv.Size()<nb)
+          iPiv.resize(nb);
+        int nn= nb;
+        int ldA= nb;
+        int info= 0;
+        dgetrf_(&nn, &nn, S.getDataPtr(), &ldA, iPiv.getDataPtr(), &info);
+        if(info!=0)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+	              << "; LAPACK factorization of the interface matrix failed - "
+		      << info << " returned.\n";
+            this->setPyProp("info", boost::python::object(info));
+            retval= -info;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Computes the solution.
+//!
+//! If the system is not factored, computes the partitions and
+//! condenses them (see condense). Then the actors compute the
+//! contributions of their partitions to the interface load, the
+//! interface values are obtained by the calling thread and the
+//! actors compute the values of the internal unknowns. The matrix
+//! of the system is not modified.
+int XC::FullGenLinSubstrThreadSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING, no LinearSOE object has been set\n";
+	return -1;
+      }
+    
+    const int n= theSOE->size;
+    
+    // check for quick return
+    if(n == 0)
+      return 0;
+
+    if(!theSOE->factored)
+      {
+        set_partitions();
+        const int ok= condense();
+        if(ok!=0)
+          return ok;
+      }
+    const size_t numParts= internalEqs.size();
+    const int nb= interfaceEqs.size();
+    const double *Bptr= theSOE->getPtrB();
+    double *Xptr= theSOE->getPtrX();
+    // Contributions to the interface load.
+    for(size_t k= 0; k<numParts; k++)
+      {
+        const std::vector<int> &internal= internalEqs[k];
+        const int ni= internal.size();
+        Vector Fi(ni);
+        for(int a= 0; a<ni; a++)
+          Fi(a)= Bptr[internal[a]];
+        Channel &theChannel= *actorChannels[k];
+        send_header(theChannel, FullGenLinSubstrActor::cmdReduce, ni);
+        theChannel.sendVector(0, 0, Fi);
+      }
+    Vector ub(nb);
+    for(int b= 0; b<nb; b++)
+      ub(b)= Bptr[interfaceEqs[b]];
+    if(nb>0)
+      {
+        Vector gk(nb);
+        for(size_t k= 0; k<numParts; k++)
+          {
+            actorChannels[k]->recvVector(0, 0, gk);
+            ub.addVector(1.0, gk, -1.0);
+          }
+        // Interface values.
+        char strN[]= "N";
+        int nn= nb;
+        int nrhs= 1;
+        int info= 0;
+        dgetrs_(strN, &nn, &nrhs, S.getDataPtr(), &nn, iPiv.getDataPtr(), ub.getDataPtr(), &nn, &info);
+        for(int b= 0; b<nb; b++)
+          Xptr[interfaceEqs[b]]= ub(b);
+      }
+    // Internal values.
+    for(size_t k= 0; k<numParts; k++)
+      {
+        Channel &theChannel= *actorChannels[k];
+        send_header(theChannel, FullGenLinSubstrActor::cmdRecover, internalEqs[k].size());
+        if(nb>0)
+          theChannel.sendVector(0, 0, ub);
+      }
+    for(size_t k= 0; k<numParts; k++)
+      {
+        const std::vector<int> &internal= internalEqs[k];
+        const int ni= internal.size();
+        Vector ui(ni);
+        actorChannels[k]->recvVector(0, 0, ui);
+        for(int a= 0; a<ni; a++)
+          Xptr[internal[a]]= ui(a);
+      }
+    theSOE->factored= true;
+    return 0;
+  }
+
+//! @brief The partitions are computed when the system is factored,
+//! so there is nothing to do here.
+int XC::FullGenLinSubstrThreadSolver::setSize(void)
+  { return 0; }
+
+//! @brief Does nothing.
+int XC::FullGenLinSubstrThreadSolver::sendSelf(Communicator &)
+  { return 0; }
+
+//! @brief Does nothing.
+int XC::FullGenLinSubstrThreadSolver::recvSelf(const Communicator &)
+  { return 0; }
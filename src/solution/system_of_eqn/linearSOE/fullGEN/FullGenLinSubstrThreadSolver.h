@@ -0,0 +1,103 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FullGenLinSubstrThreadSolver.h
+
+#ifndef FullGenLinSubstrThreadSolver_h
+#define FullGenLinSubstrThreadSolver_h
+
+#include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include <vector>
+
+namespace XC {
+class Channel;
+class FEM_ObjectBroker;
+class ThreadMachineBroker;
+
+//! @ingroup Solver
+//
+//! @brief Dense general matrix SOE solver that condenses the
+//! partitions of the system in parallel using actor threads.
+//!
+//! The equations are split in numPartitions blocks of consecutive
+//! equations. The equations coupled with equations of other blocks
+//! are moved to the interface, so the internal equations of each
+//! block are not coupled with the internal equations of the others.
+//! Each block is sent through a ThreadChannel to an actor (see
+//! FullGenLinSubstrActor) that eliminates its internal equations and
+//! returns its contribution to the interface (Schur complement)
+//! matrix. The interface system is solved by the calling thread
+//! and then the actors recover the values of the internal unknowns.
+//!
+//! The actor threads are started when the system is first
+//! factored and they are reused until the number of partitions
+//! changes or the solver is destroyed.
+class FullGenLinSubstrThreadSolver: public FullGenLinSolver
+  {
+  private:
+    int numPartitions; //!< number of partitions of the system.
+    FEM_ObjectBroker *objectBroker; //!< object broker of the machine broker.
+    ThreadMachineBroker *machineBroker; //!< starts the actor threads.
+    std::vector<Channel *> actorChannels; //!< channels to communicate with the actors.
+    std::vector<std::vector<int> > internalEqs; //!< internal equations of each partition.
+    std::vector<int> interfaceEqs; //!< interface equations.
+    Matrix S; //!< interface (Schur complement) matrix (LU factored).
+    ID iPiv; //!< row permutation of the S factorization.
+
+    void free_actors(void);
+    int start_actors(const size_t &);
+    void set_partitions(void);
+    int send_header(Channel &, const int &, const int &);
+    int condense(void);
+
+    FullGenLinSubstrThreadSolver &operator=(const FullGenLinSubstrThreadSolver &);
+  protected:
+    friend class FEM_ObjectBroker;
+    friend class LinearSOE;
+    FullGenLinSubstrThreadSolver(int numPartitions= 2);
+    FullGenLinSubstrThreadSolver(const FullGenLinSubstrThreadSolver &);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    ~FullGenLinSubstrThreadSolver(void);
+
+    int solve(void);
+    int setSize(void);
+
+    int getNumPartitions(void) const;
+    void setNumPartitions(const int &);
+    
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);
+  };
+
+//! @brief Virtual constructor.
+inline LinearSOESolver *FullGenLinSubstrThreadSolver::getCopy(void) const
+   { return new FullGenLinSubstrThreadSolver(*this); }
+} // end of XC namespace
+
+#endif
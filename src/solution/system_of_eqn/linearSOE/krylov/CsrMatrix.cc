@@ -0,0 +1,226 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CsrMatrix.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+#include <algorithm>
+
+//! @brief Default constructor.
+XC::CsrMatrix::CsrMatrix(void)
+  : numRows(0), rowStart(1,0), colIndex(), values()
+  {}
+
+//! @brief Constructor.
+//!
+//! @param n: number of rows.
+//! @param rs: position of the first coefficient of each row.
+//! @param ci: column indexes (sorted in each row).
+XC::CsrMatrix::CsrMatrix(const int &n, const int_vector &rs, const int_vector &ci)
+  : numRows(0), rowStart(1,0), colIndex(), values()
+  { setPattern(n, rs, ci); }
+
+//! @brief Set the sparsity pattern of the matrix (all the
+//! coefficients are set to zero).
+//!
+//! @param n: number of rows.
+//! @param rs: position of the first coefficient of each row.
+//! @param ci: column indexes (sorted in each row).
+void XC::CsrMatrix::setPattern(const int &n, const int_vector &rs, const int_vector &ci)
+  {
+    numRows= n;
+    rowStart= rs;
+    colIndex= ci;
+    values.assign(colIndex.size(), 0.0);
+  }
+
+//! @brief Remove all the coefficients.
+void XC::CsrMatrix::clear(void)
+  {
+    numRows= 0;
+    rowStart.assign(1,0);
+    colIndex.clear();
+    values.clear();
+  }
+
+//! @brief Set all the coefficients to zero (the pattern doesn't change).
+void XC::CsrMatrix::zero(void)
+  { std::fill(values.begin(), values.end(), 0.0); }
+
+//! @brief Return true if the argument has the same sparsity pattern.
+bool XC::CsrMatrix::samePattern(const CsrMatrix &other) const
+  { return (numRows==other.numRows) && (rowStart==other.rowStart) && (colIndex==other.colIndex); }
+
+//! @brief Return the position of the (i,j) coefficient in the
+//! storage or -1 if it is not stored.
+int XC::CsrMatrix::find(const int &i, const int &j) const
+  {
+    int retval= -1;
+    const int *first= colIndex.data()+rowStart[i];
+    const int *last= colIndex.data()+rowStart[i+1];
+    const int *k= std::lower_bound(first, last, j);
+    if((k!=last) && (*k==j))
+      retval= k-colIndex.data();
+    return retval;
+  }
+
+//! @brief Return a pointer to the (i,j) coefficient or nullptr if
+//! it is not stored.
+double *XC::CsrMatrix::getPtr(const int &i, const int &j)
+  {
+    double *retval= nullptr;
+    const int k= find(i,j);
+    if(k>=0)
+      retval= values.data()+k;
+    return retval;
+  }
+
+//! @brief Return the diagonal of the matrix (zero if not stored).
+void XC::CsrMatrix::getDiagonal(double_vector &d) const
+  {
+    d.assign(numRows, 0.0);
+    for(int i= 0;i<numRows;i++)
+      {
+	const int k= find(i,i);
+	if(k>=0)
+	  d[i]= values[k];
+      }
+  }
+
+//! @brief Compute y= A*x.
+void XC::CsrMatrix::multiply(const double *x, double *y) const
+  {
+    const int *rs= rowStart.data();
+    const int *ci= colIndex.data();
+    const double *a= values.data();
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<numRows;i++)
+      {
+	double s= 0.0;
+	for(int k= rs[i];k<rs[i+1];k++)
+	  s+= a[k]*x[ci[k]];
+	y[i]= s;
+      }
+  }
+
+//! @brief Compute r= b-A*x.
+void XC::CsrMatrix::residual(const double *b, const double *x, double *r) const
+  {
+    const int *rs= rowStart.data();
+    const int *ci= colIndex.data();
+    const double *a= values.data();
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<numRows;i++)
+      {
+	double s= b[i];
+	for(int k= rs[i];k<rs[i+1];k++)
+	  s-= a[k]*x[ci[k]];
+	r[i]= s;
+      }
+  }
+
+//! @brief Return the transpose of a (not necessarily square) CSR
+//! matrix whose number of columns is computed from the column indexes.
+XC::CsrMatrix XC::CsrMatrix::getTranspose(void) const
+  {
+    int numCols= 0;
+    for(int j: colIndex)
+      numCols= std::max(numCols,j+1);
+    CsrMatrix retval;
+    retval.numRows= numCols;
+    retval.rowStart.assign(numCols+1, 0);
+    for(int j: colIndex)
+      retval.rowStart[j+1]++;
+    for(int j= 0;j<numCols;j++)
+      retval.rowStart[j+1]+= retval.rowStart[j];
+    const size_t nnz= colIndex.size();
+    retval.colIndex.resize(nnz);
+    retval.values.resize(nnz);
+    int_vector next(retval.rowStart.begin(), retval.rowStart.end()-1);
+    // rows are visited in ascending order so the column indexes
+    // of the transpose are sorted.
+    for(int i= 0;i<numRows;i++)
+      for(int k= rowStart[i];k<rowStart[i+1];k++)
+	{
+	  const int pos= next[colIndex[k]]++;
+	  retval.colIndex[pos]= i;
+	  retval.values[pos]= values[k];
+	}
+    return retval;
+  }
+
+//! @brief Return the product of this matrix by the argument (the
+//! matrices can be rectangular, the number of rows of the result is
+//! the number of rows of this matrix).
+XC::CsrMatrix XC::CsrMatrix::operator*(const CsrMatrix &other) const
+  {
+    int numCols= 0;
+    for(int j: other.colIndex)
+      numCols= std::max(numCols,j+1);
+    CsrMatrix retval;
+    retval.numRows= numRows;
+    retval.rowStart.assign(numRows+1, 0);
+    // row by row with a dense accumulator (Gustavson's algorithm).
+    int_vector marker(numCols, -1);
+    double_vector acc(numCols, 0.0);
+    int_vector rowCols;
+    for(int i= 0;i<numRows;i++)
+      {
+	rowCols.clear();
+	for(int k= rowStart[i];k<rowStart[i+1];k++)
+	  {
+	    const int l= colIndex[k];
+	    const double a= values[k];
+	    for(int m= other.rowStart[l];m<other.rowStart[l+1];m++)
+	      {
+		const int j= other.colIndex[m];
+		if(marker[j]!=i)
+		  {
+		    marker[j]= i;
+		    acc[j]= 0.0;
+		    rowCols.push_back(j);
+		  }
+		acc[j]+= a*other.values[m];
+	      }
+	  }
+	std::sort(rowCols.begin(), rowCols.end());
+	for(int j: rowCols)
+	  {
+	    retval.colIndex.push_back(j);
+	    retval.values.push_back(acc[j]);
+	  }
+	retval.rowStart[i+1]= retval.colIndex.size();
+      }
+    return retval;
+  }
+
+//! @brief Return the product P^T*A*P (coarse level matrix of a
+//! multigrid hierarchy with the prolongation P).
+XC::CsrMatrix XC::CsrMatrix::getGalerkinProduct(const CsrMatrix &P) const
+  {
+    const CsrMatrix AP= (*this)*P;
+    return P.getTranspose()*AP;
+  }
@@ -0,0 +1,95 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CsrMatrix.h
+
+#ifndef CsrMatrix_h
+#define CsrMatrix_h
+
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief Square sparse matrix in compressed sparse row (CSR) format.
+//!
+//! The column indexes of each row are sorted in ascending order. Used
+//! by the Krylov solvers and their preconditioners (matrix-vector
+//! products, incomplete factorizations and multigrid hierarchies).
+class CsrMatrix
+  {
+  public:
+    typedef std::vector<int> int_vector;
+    typedef std::vector<double> double_vector;
+  private:
+    int numRows; //!< number of rows (and columns).
+    int_vector rowStart; //!< position of the first coefficient of each row (numRows+1 values).
+    int_vector colIndex; //!< column index of each coefficient.
+    double_vector values; //!< coefficients.
+  public:
+    CsrMatrix(void);
+    CsrMatrix(const int &, const int_vector &, const int_vector &);
+
+    void setPattern(const int &, const int_vector &, const int_vector &);
+    void clear(void);
+    void zero(void);
+
+    //! @brief Return the number of rows.
+    inline int getNumRows(void) const
+      { return numRows; }
+    //! @brief Return the number of coefficients stored.
+    inline int getNumNonZeros(void) const
+      { return colIndex.size(); }
+    //! @brief Return the position of the first coefficient of each row.
+    inline const int_vector &getRowStart(void) const
+      { return rowStart; }
+    //! @brief Return the column indexes of the coefficients.
+    inline const int_vector &getColIndex(void) const
+      { return colIndex; }
+    //! @brief Return the coefficients.
+    inline const double_vector &getValues(void) const
+      { return values; }
+    //! @brief Return the coefficients.
+    inline double_vector &getValues(void)
+      { return values; }
+    
+    bool samePattern(const CsrMatrix &) const;
+    int find(const int &, const int &) const;
+    double *getPtr(const int &, const int &);
+    void getDiagonal(double_vector &) const;
+
+    void multiply(const double *, double *) const;
+    void residual(const double *, const double *, double *) const;
+    CsrMatrix getTranspose(void) const;
+    CsrMatrix operator*(const CsrMatrix &) const;
+    CsrMatrix getGalerkinProduct(const CsrMatrix &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,176 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CsrSPDLinSOE.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/CsrSPDLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/ID.h>
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
+
+//! @brief Constructor.
+XC::CsrSPDLinSOE::CsrSPDLinSOE(SolutionStrategy *owr)
+  :FactoredSOEBase(owr,LinSOE_TAGS_CsrSPDLinSOE), A(), scatterMap()
+  {}
+
+//! @brief Virtual constructor.
+XC::SystemOfEqn *XC::CsrSPDLinSOE::getCopy(void) const
+  { return new CsrSPDLinSOE(*this); }
+
+//! @brief Sets the solver to use.
+bool XC::CsrSPDLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    KrylovLinSolver *tmp= dynamic_cast<KrylovLinSolver *>(newSolver);
+    if(tmp)
+      retval= FactoredSOEBase::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; solver not compatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the number of vertices in the graph.
+//!
+//! The pattern of each row of A (the diagonal and the adjacency of
+//! the vertex) is built from the compressed adjacency of the graph.
+int XC::CsrSPDLinSOE::setSize(Graph &theGraph)
+  {
+    size= checkSize(theGraph);
+    if(size < 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          <<"; size of soe < 0\n";
+	return -1;
+      }
+
+    const CSRGraph &g= theGraph.getCSR();
+    if(g.getNumVertex() != size)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: graph vertices not numbered from 0 to "
+		  << size-1 << " - size set to 0.\n";
+	size = 0;
+	return -1;
+      }
+
+    CsrMatrix::int_vector rowStart(size+1, 0);
+    CsrMatrix::int_vector colIndex(g.getNumEntriesWithDiagonal());
+    for(int row= 0; row<size; row++)
+      rowStart[row+1]= rowStart[row]+g.copyWithDiagonal(row, colIndex.data()+rowStart[row]);
+    A.setPattern(size, rowStart, colIndex);
+    
+    scatterMap.clear(); // A storage has changed.
+    factored= false;
+    B.resize(size);
+    B.Zero();
+    X.resize(size);
+    X.Zero();
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    if(the_Solver)
+      {
+	const int solverOK= the_Solver->setSize();
+	if(solverOK < 0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: solver failed setSize().\n";
+	    return solverOK;
+	  }
+      }
+    return 0;
+  }
+
+//! @brief Compute the locations in A of the coefficients that
+//! correspond to the equation numbers being passed as parameter.
+const XC::ScatterMap::location_vector &XC::CsrSPDLinSOE::compute_locations(const ID &id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(id);
+    const int idSize= id.Size();
+    for(int j= 0; j<idSize; j++)
+      {
+	const int col= id(j);
+	if(col < size && col >= 0)
+	  {
+	    for(int i= 0; i<idSize; i++)
+	      {
+		const int row= id(i);
+		if(row < size && row >= 0)
+		  retval[j*idSize+i]= A.find(row, col);
+	      }
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! The locations of the coefficients are computed the first time the
+//! ID is assembled and then reused until the size of the system changes.
+int XC::CsrSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)  
+	return 0;
+
+    // check that m and id are of similar size
+    const int idSize = id.Size();
+    if(idSize != m.noRows() || idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+
+    const ScatterMap::location_vector *locations= scatterMap.find(id);
+    if(!locations)
+      locations= &compute_locations(id);
+    ScatterMap::scatter(*locations, m, fact, A.getValues().data());
+    factored= false; // A has changed.
+    return 0;
+  }
+
+//! @brief Zeroes the matrix (keeping its sparsity pattern) and marks
+//! the preconditioner as outdated.
+void XC::CsrSPDLinSOE::zeroA(void)
+  {
+    A.zero();
+    factored= false;
+  }
+
+int XC::CsrSPDLinSOE::sendSelf(Communicator &comm)
+  {
+    return 0;
+  }
+
+int XC::CsrSPDLinSOE::recvSelf(const Communicator &comm)
+  {
+    return 0;
+  }
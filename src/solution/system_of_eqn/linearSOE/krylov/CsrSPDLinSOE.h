@@ -0,0 +1,88 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CsrSPDLinSOE.h
+
+#ifndef CsrSPDLinSOE_h
+#define CsrSPDLinSOE_h
+
+#include "solution/system_of_eqn/linearSOE/FactoredSOEBase.h"
+#include "solution/system_of_eqn/linearSOE/ScatterMap.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+
+namespace XC {
+class KrylovLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Sparse symmetric positive definite system of equations
+//! stored in compressed sparse row (CSR) format, to be solved with
+//! the iterative (Krylov subspace) solvers.
+//!
+//! Both triangles of A are stored so the matrix-vector products can
+//! be computed row by row (concurrently). The pattern is built from
+//! the compressed adjacency of the DOF graph in setSize and the
+//! element matrices are added directly to the coefficients of A
+//! (see ScatterMap). The system is marked as "factored" when the
+//! preconditioner has been computed for the current coefficients
+//! of A.
+class CsrSPDLinSOE: public FactoredSOEBase
+  {
+  private:
+    CsrMatrix A; //!< system matrix.
+    ScatterMap scatterMap; //!< locations of the element matrices coefficients in A.
+
+    const ScatterMap::location_vector &compute_locations(const ID &);
+  protected:
+    bool setSolver(LinearSOESolver *);
+
+    friend class SolutionStrategy;
+    friend class FEM_ObjectBroker;
+    CsrSPDLinSOE(SolutionStrategy *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    
+    void zeroA(void);
+
+    //! @brief Return the system matrix.
+    inline const CsrMatrix &getA(void) const
+      { return A; }
+    //! @brief Return the number of non-zero coefficients stored.
+    inline int getNumNonZeros(void) const
+      { return A.getNumNonZeros(); }
+
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);
+
+    friend class KrylovLinSolver;
+  };
+} // end of XC namespace
+
+
+#endif
@@ -0,0 +1,156 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//IncompleteCholeskyPreconditioner.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/IncompleteCholeskyPreconditioner.h"
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param initShift: first diagonal shift tried when the factorization
+//!                   breaks down.
+XC::IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(const double &initShift)
+  : L(), initialShift(initShift), shift(0.0)
+  {}
+
+//! @brief Virtual constructor.
+XC::KrylovPreconditioner *XC::IncompleteCholeskyPreconditioner::getCopy(void) const
+  { return new IncompleteCholeskyPreconditioner(*this); }
+
+//! @brief Return the name of the preconditioner.
+std::string XC::IncompleteCholeskyPreconditioner::getName(void) const
+  { return "incomplete_cholesky"; }
+
+//! @brief Compute the incomplete factorization of A with its
+//! diagonal scaled by (1+alpha).
+//! @return false if a pivot is not positive.
+bool XC::IncompleteCholeskyPreconditioner::factorize(const CsrMatrix &A, const double &alpha)
+  {
+    const int n= A.getNumRows();
+    const CsrMatrix::int_vector &ars= A.getRowStart();
+    const CsrMatrix::double_vector &av= A.getValues();
+    const CsrMatrix::int_vector &rs= L.getRowStart();
+    const CsrMatrix::int_vector &ci= L.getColIndex();
+    CsrMatrix::double_vector &l= L.getValues();
+    for(int i= 0;i<n;i++)
+      {
+	const int diagPos= rs[i+1]-1;
+	// copy the lower triangle of row i.
+	for(int k= rs[i], m= ars[i];k<=diagPos;k++, m++)
+	  l[k]= av[m];
+	l[diagPos]*= (1.0+alpha);
+	// l_ik= (a_ik-sum_{j<k} l_ij*l_kj)/l_kk
+	for(int k= rs[i];k<diagPos;k++)
+	  {
+	    const int col= ci[k];
+	    const int rowkEnd= rs[col+1]-1; // diagonal of row col.
+	    double s= l[k];
+	    int p= rs[i]; // coefficients of row i.
+	    int q= rs[col]; // coefficients of row col.
+	    while((p<k) && (q<rowkEnd))
+	      {
+		if(ci[p]==ci[q])
+		  s-= l[p++]*l[q++];
+		else if(ci[p]<ci[q])
+		  p++;
+		else
+		  q++;
+	      }
+	    l[k]= s/l[rowkEnd];
+	  }
+	double d= l[diagPos];
+	for(int k= rs[i];k<diagPos;k++)
+	  d-= l[k]*l[k];
+	if(!(d>0.0))
+	  return false;
+	l[diagPos]= sqrt(d);
+      }
+    return true;
+  }
+
+//! @brief Compute the incomplete factorization of the matrix.
+//!
+//! The pattern of L is the lower triangle of A (the diagonal must
+//! be stored).
+//! @return -1 if the diagonal is not stored, -2 if the factorization
+//! breaks down even with the diagonal shift.
+int XC::IncompleteCholeskyPreconditioner::setup(const CsrMatrix &A)
+  {
+    const int n= A.getNumRows();
+    const CsrMatrix::int_vector &ars= A.getRowStart();
+    const CsrMatrix::int_vector &aci= A.getColIndex();
+    // pattern of the lower triangle.
+    CsrMatrix::int_vector rs(n+1, 0);
+    CsrMatrix::int_vector ci;
+    ci.reserve(A.getNumNonZeros()/2+n);
+    for(int i= 0;i<n;i++)
+      {
+	for(int k= ars[i];(k<ars[i+1]) && (aci[k]<=i);k++)
+	  ci.push_back(aci[k]);
+	if(ci.empty() || (ci.back()!=i))
+	  return -1; // diagonal not stored.
+	rs[i+1]= ci.size();
+      }
+    if(!L.samePattern(CsrMatrix(n, rs, ci)))
+      L.setPattern(n, rs, ci);
+    
+    shift= 0.0;
+    bool ok= factorize(A, shift);
+    for(int attempt= 0;!ok && (attempt<20);attempt++)
+      {
+	shift= (attempt==0) ? initialShift : 2.0*shift;
+	ok= factorize(A, shift);
+      }
+    return (ok ? 0 : -2);
+  }
+
+//! @brief Compute z= (L*L^T)^{-1}*r.
+void XC::IncompleteCholeskyPreconditioner::apply(const double *r, double *z) const
+  {
+    const int n= L.getNumRows();
+    const CsrMatrix::int_vector &rs= L.getRowStart();
+    const CsrMatrix::int_vector &ci= L.getColIndex();
+    const CsrMatrix::double_vector &l= L.getValues();
+    // forward substitution L*y= r
+    for(int i= 0;i<n;i++)
+      {
+	const int diagPos= rs[i+1]-1;
+	double s= r[i];
+	for(int k= rs[i];k<diagPos;k++)
+	  s-= l[k]*z[ci[k]];
+	z[i]= s/l[diagPos];
+      }
+    // back substitution L^T*z= y (by rows of L).
+    for(int i= n-1;i>=0;i--)
+      {
+	const int diagPos= rs[i+1]-1;
+	const double zi= z[i]/l[diagPos];
+	z[i]= zi;
+	for(int k= rs[i];k<diagPos;k++)
+	  z[ci[k]]-= l[k]*zi;
+      }
+  }
@@ -0,0 +1,71 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//IncompleteCholeskyPreconditioner.h
+
+#ifndef IncompleteCholeskyPreconditioner_h
+#define IncompleteCholeskyPreconditioner_h
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief Incomplete Cholesky factorization without fill-in (IC(0))
+//! preconditioner: \f$M= L L^T\f$ where L has the pattern of the
+//! lower triangle of A.
+//!
+//! If a pivot is not positive (the incomplete factorization of an
+//! SPD matrix can break down) the factorization is computed again
+//! with the diagonal of A scaled by (1+shift), doubling the shift
+//! each time (Manteuffel, T.A. "An incomplete factorization technique
+//! for positive definite linear systems". Mathematics of Computation,
+//! 1980).
+class IncompleteCholeskyPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    CsrMatrix L; //!< incomplete factor (the diagonal is the last coefficient of each row).
+    double initialShift; //!< first shift tried when the factorization breaks down.
+    double shift; //!< shift used in the last factorization.
+
+    bool factorize(const CsrMatrix &, const double &);
+  public:
+    IncompleteCholeskyPreconditioner(const double &initShift= 1e-3);
+    KrylovPreconditioner *getCopy(void) const;
+    std::string getName(void) const;
+    int setup(const CsrMatrix &);
+    void apply(const double *, double *) const;
+
+    //! @brief Return the diagonal shift used in the last factorization.
+    inline double getShift(void) const
+      { return shift; }
+  };
+} // end of XC namespace
+
+#endif
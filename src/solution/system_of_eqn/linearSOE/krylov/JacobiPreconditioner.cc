@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//JacobiPreconditioner.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/JacobiPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+
+//! @brief Virtual constructor.
+XC::KrylovPreconditioner *XC::JacobiPreconditioner::getCopy(void) const
+  { return new JacobiPreconditioner(*this); }
+
+//! @brief Return the name of the preconditioner.
+std::string XC::JacobiPreconditioner::getName(void) const
+  { return "jacobi"; }
+
+//! @brief Compute the inverse of the diagonal of the matrix.
+//! @return -1 if a diagonal coefficient is not positive.
+int XC::JacobiPreconditioner::setup(const CsrMatrix &A)
+  {
+    A.getDiagonal(invDiag);
+    for(double &d: invDiag)
+      {
+	if(d<=0.0)
+	  return -1;
+	d= 1.0/d;
+      }
+    return 0;
+  }
+
+//! @brief Compute z= D^{-1}*r.
+void XC::JacobiPreconditioner::apply(const double *r, double *z) const
+  {
+    const int n= invDiag.size();
+    #pragma omp parallel for schedule(static)
+    for(int i= 0;i<n;i++)
+      z[i]= invDiag[i]*r[i];
+  }
@@ -0,0 +1,53 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//JacobiPreconditioner.h
+
+#ifndef JacobiPreconditioner_h
+#define JacobiPreconditioner_h
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovPreconditioner.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief Jacobi (diagonal) preconditioner: \f$M= diag(A)\f$.
+class JacobiPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    std::vector<double> invDiag; //!< inverse of the diagonal of A.
+  public:
+    KrylovPreconditioner *getCopy(void) const;
+    std::string getName(void) const;
+    int setup(const CsrMatrix &);
+    void apply(const double *, double *) const;
+  };
+} // end of XC namespace
+
+#endif
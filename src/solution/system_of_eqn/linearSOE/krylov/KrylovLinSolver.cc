@@ -0,0 +1,314 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovLinSolver.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrSPDLinSOE.h"
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovPreconditioner.h"
+#include <algorithm>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! By default the system is preconditioned with an incomplete
+//! Cholesky factorization.
+XC::KrylovLinSolver::KrylovLinSolver(int classTag)
+ : LinearSOESolver(classTag),
+   preconditioner(KrylovPreconditioner::newPreconditioner("incomplete_cholesky")),
+   relTol(1e-10), absTol(0.0), maxNumIter(0), warmStart(false),
+   numSolves(0), numIterations(0), totalNumIterations(0),
+   numPreconditionerSetups(0), numFailures(0), residualNorm(0.0),
+   theSOE(nullptr)
+  {}
+
+//! @brief Copy constructor.
+XC::KrylovLinSolver::KrylovLinSolver(const KrylovLinSolver &other)
+ : LinearSOESolver(other),
+   preconditioner(nullptr),
+   relTol(other.relTol), absTol(other.absTol), maxNumIter(other.maxNumIter),
+   warmStart(other.warmStart),
+   numSolves(0), numIterations(0), totalNumIterations(0),
+   numPreconditionerSetups(0), numFailures(0), residualNorm(0.0),
+   theSOE(other.theSOE)
+  { copy_preconditioner(other.preconditioner); }
+
+//! @brief Assignment operator.
+XC::KrylovLinSolver &XC::KrylovLinSolver::operator=(const KrylovLinSolver &other)
+  {
+    if(this!=&other)
+      {
+	LinearSOESolver::operator=(other);
+	relTol= other.relTol;
+	absTol= other.absTol;
+	maxNumIter= other.maxNumIter;
+	warmStart= other.warmStart;
+	theSOE= other.theSOE;
+	copy_preconditioner(other.preconditioner);
+	resetStatistics();
+      }
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::KrylovLinSolver::~KrylovLinSolver(void)
+  { free_preconditioner(); }
+
+//! @brief Free memory.
+void XC::KrylovLinSolver::free_preconditioner(void)
+  {
+    if(preconditioner)
+      {
+	delete preconditioner;
+	preconditioner= nullptr;
+      }
+  }
+
+//! @brief Copy the preconditioner argument (the preconditioner must
+//! be computed again).
+void XC::KrylovLinSolver::copy_preconditioner(const KrylovPreconditioner *other)
+  {
+    free_preconditioner();
+    if(other)
+      preconditioner= other->getCopy();
+    if(theSOE)
+      theSOE->factored= false;
+  }
+
+//! @brief Set the preconditioner to use.
+//!
+//! @param type: preconditioner type ('jacobi', 'incomplete_cholesky',
+//!              'smoothed_aggregation_amg' or 'none').
+void XC::KrylovLinSolver::setPreconditioner(const std::string &type)
+  {
+    KrylovPreconditioner *tmp= nullptr;
+    if(type!="none")
+      {
+	tmp= KrylovPreconditioner::newPreconditioner(type);
+	if(!tmp)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; preconditioner type: '" << type
+		      << "' unknown. Available types: 'jacobi',"
+		      << " 'incomplete_cholesky', 'smoothed_aggregation_amg'"
+		      << " and 'none'." << std::endl;
+	    return;
+	  }
+      }
+    free_preconditioner();
+    preconditioner= tmp;
+    if(theSOE)
+      theSOE->factored= false;
+  }
+
+//! @brief Return the type of the preconditioner.
+std::string XC::KrylovLinSolver::getPreconditionerType(void) const
+  {
+    std::string retval= "none";
+    if(preconditioner)
+      retval= preconditioner->getName();
+    return retval;
+  }
+
+//! @brief Set the relative tolerance.
+void XC::KrylovLinSolver::setRelativeTolerance(const double &tol)
+  {
+    if(tol<0.0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; tolerance: " << tol << " must not be negative."
+		<< std::endl;
+    else
+      relTol= tol;
+  }
+
+//! @brief Set the absolute tolerance.
+void XC::KrylovLinSolver::setAbsoluteTolerance(const double &tol)
+  {
+    if(tol<0.0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; tolerance: " << tol << " must not be negative."
+		<< std::endl;
+    else
+      absTol= tol;
+  }
+
+//! @brief Return the average number of iterations per solution.
+double XC::KrylovLinSolver::getAverageNumIterations(void) const
+  {
+    double retval= 0.0;
+    if(numSolves>0)
+      retval= static_cast<double>(totalNumIterations)/numSolves;
+    return retval;
+  }
+
+//! @brief Reset the solution statistics.
+void XC::KrylovLinSolver::resetStatistics(void)
+  {
+    numSolves= 0;
+    numIterations= 0;
+    totalNumIterations= 0;
+    numPreconditionerSetups= 0;
+    numFailures= 0;
+    residualNorm= 0.0;
+  }
+
+//! @brief Compute z= M^{-1}*r (z= r if there is no preconditioner).
+void XC::KrylovLinSolver::apply_preconditioner(const double *r, double *z) const
+  {
+    if(preconditioner)
+      preconditioner->apply(r, z);
+    else
+      std::copy(r, r+theSOE->size, z);
+  }
+
+//! @brief Return the dot product of the vectors.
+double XC::KrylovLinSolver::dot(const int &n, const double *a, const double *b)
+  {
+    double retval= 0.0;
+    #pragma omp parallel for schedule(static) reduction(+:retval)
+    for(int i= 0;i<n;i++)
+      retval+= a[i]*b[i];
+    return retval;
+  }
+
+//! @brief Solves the system of equations.
+//!
+//! The preconditioner is computed only if A has changed since the
+//! last solution (the system is not marked as factored).
+int XC::KrylovLinSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set."
+		  << std::endl;
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n == 0)
+      return 0;
+    
+    const CsrMatrix &A= theSOE->A;
+    if(!theSOE->factored)
+      {
+	if(preconditioner)
+	  {
+	    const int info= preconditioner->setup(A);
+	    if(info<0)
+	      {
+		std::cerr << getClassName() << "::" << __FUNCTION__
+			  << "; WARNING: can't compute the "
+			  << preconditioner->getName()
+			  << " preconditioner (error code: " << info
+			  << "); is the matrix positive definite?"
+			  << std::endl;
+		return -2;
+	      }
+	    numPreconditionerSetups++;
+	  }
+	theSOE->factored= true;
+      }
+
+    const double *b= theSOE->B.getDataPtr();
+    double *x= theSOE->X.getDataPtr();
+    if(!warmStart)
+      theSOE->X.Zero();
+    const double bNorm= sqrt(dot(n, b, b));
+    numSolves++;
+    numIterations= 0;
+    residualNorm= 0.0;
+    if(bNorm==0.0)
+      {
+	theSOE->X.Zero();
+	return 0;
+      }
+    const double tol= std::max(relTol*bNorm, absTol);
+    numIterations= (maxNumIter>0) ? maxNumIter : n;
+    const int ok= iterate(A, b, x, tol, numIterations);
+    totalNumIterations+= numIterations;
+
+    // true residual.
+    std::vector<double> r(n);
+    A.residual(b, x, r.data());
+    residualNorm= sqrt(dot(n, r.data(), r.data()));
+    if(ok<0)
+      {
+	numFailures++;
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: ";
+	if(ok==-1)
+	  std::cerr << "no convergence after ";
+	else
+	  std::cerr << "breakdown after ";
+	std::cerr << numIterations << " iterations; residual norm: "
+		  << residualNorm << " (tolerance: " << tol << ")."
+		  << std::endl;
+	return -3;
+      }
+    return 0;
+  }
+
+//! @brief The preconditioner must be computed again after the
+//! system has changed its size.
+int XC::KrylovLinSolver::setSize(void)
+  {
+    if(theSOE)
+      theSOE->factored= false;
+    return 0;
+  }
+
+//! @brief Sets the system of equations to solve.
+bool XC::KrylovLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    CsrSPDLinSOE *tmp= dynamic_cast<CsrSPDLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+	theSOE->factored= false;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< " not a suitable system of equations"
+		<< std::endl;
+    return retval;
+  }
+
+bool XC::KrylovLinSolver::setLinearSOE(CsrSPDLinSOE &theLinearSOE)
+  { return setLinearSOE(&theLinearSOE); }
+
+int XC::KrylovLinSolver::sendSelf(Communicator &comm)
+  {
+    // nothing to do
+    return 0;
+  }
+
+int XC::KrylovLinSolver::recvSelf(const Communicator &comm)
+  {
+    // nothing to do
+    return 0;
+  }
@@ -0,0 +1,145 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovLinSolver.h
+
+#ifndef KrylovLinSolver_h
+#define KrylovLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <string>
+
+namespace XC {
+class CsrSPDLinSOE;
+class CsrMatrix;
+class KrylovPreconditioner;
+
+//! @ingroup LinearSolver
+//
+//! @brief Base class for the preconditioned Krylov subspace solvers
+//! of CsrSPDLinSOE systems.
+//!
+//! The iteration stops when the norm of the residual is less than
+//! max(relTol*|b|, absTol) or when the maximum number of iterations
+//! is reached (the solve fails in that case). The preconditioner is
+//! computed only when the coefficients of A have changed since the
+//! last solution (see FactoredSOEBase). If warmStart is true the
+//! iteration starts from the previous solution (i.e. the previous
+//! Newton increment) instead of from zero.
+class KrylovLinSolver: public LinearSOESolver
+  {
+  private:
+    KrylovPreconditioner *preconditioner; //!< preconditioner (nullptr: no preconditioning).
+    double relTol; //!< relative tolerance (with respect to the norm of b).
+    double absTol; //!< absolute tolerance.
+    int maxNumIter; //!< maximum number of iterations (if <=0 the number of equations).
+    bool warmStart; //!< if true start the iteration from the previous solution.
+    // statistics.
+    size_t numSolves; //!< number of systems solved.
+    int numIterations; //!< number of iterations of the last solution.
+    size_t totalNumIterations; //!< sum of the iterations of all the solutions.
+    size_t numPreconditionerSetups; //!< number of times the preconditioner has been computed.
+    size_t numFailures; //!< number of solutions that have not converged.
+    double residualNorm; //!< norm of the residual of the last solution.
+
+    void free_preconditioner(void);
+    void copy_preconditioner(const KrylovPreconditioner *);
+  protected:
+    CsrSPDLinSOE *theSOE;
+
+    void apply_preconditioner(const double *, double *) const;
+    static double dot(const int &, const double *, const double *);
+
+    //! @brief Iterate until the norm of the residual is less than tol.
+    //!
+    //! @param A: system matrix.
+    //! @param b: right hand side.
+    //! @param x: initial guess (input) and solution (output).
+    //! @param tol: tolerance for the norm of the residual.
+    //! @param numIter: maximum number of iterations (input) and
+    //!                 number of iterations done (output).
+    //! @return 0 if converged, -1 if not, -2 on breakdown.
+    virtual int iterate(const CsrMatrix &A, const double *b, double *x, const double &tol, int &numIter)= 0;
+
+    friend class FEM_ObjectBroker;
+    friend class LinearSOE;
+    KrylovLinSolver(int classTag);
+    KrylovLinSolver(const KrylovLinSolver &);
+    KrylovLinSolver &operator=(const KrylovLinSolver &);
+    virtual bool setLinearSOE(LinearSOE *theSOE);
+  public:
+    virtual ~KrylovLinSolver(void);
+    int solve(void);
+    int setSize(void);
+
+    bool setLinearSOE(CsrSPDLinSOE &theSOE);
+
+    void setPreconditioner(const std::string &);
+    std::string getPreconditionerType(void) const;
+    inline double getRelativeTolerance(void) const
+      { return relTol; }
+    void setRelativeTolerance(const double &);
+    inline double getAbsoluteTolerance(void) const
+      { return absTol; }
+    void setAbsoluteTolerance(const double &);
+    inline int getMaxNumIterations(void) const
+      { return maxNumIter; }
+    inline void setMaxNumIterations(const int &n)
+      { maxNumIter= n; }
+    inline bool getWarmStart(void) const
+      { return warmStart; }
+    inline void setWarmStart(const bool &b)
+      { warmStart= b; }
+
+    //! @brief Return the number of systems solved.
+    inline size_t getNumSolves(void) const
+      { return numSolves; }
+    //! @brief Return the number of iterations of the last solution.
+    inline int getNumIterations(void) const
+      { return numIterations; }
+    //! @brief Return the sum of the iterations of all the solutions.
+    inline size_t getTotalNumIterations(void) const
+      { return totalNumIterations; }
+    double getAverageNumIterations(void) const;
+    //! @brief Return the number of times the preconditioner has been computed.
+    inline size_t getNumPreconditionerSetups(void) const
+      { return numPreconditionerSetups; }
+    //! @brief Return the number of solutions that have not converged.
+    inline size_t getNumFailures(void) const
+      { return numFailures; }
+    //! @brief Return the norm of the residual of the last solution.
+    inline double getResidualNorm(void) const
+      { return residualNorm; }
+    void resetStatistics(void);
+    
+    int sendSelf(Communicator &);
+    int recvSelf(const Communicator &);    
+  };
+
+} // end of XC namespace
+
+#endif
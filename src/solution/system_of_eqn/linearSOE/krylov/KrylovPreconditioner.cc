@@ -0,0 +1,47 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/JacobiPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/IncompleteCholeskyPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/SmoothedAggregationPreconditioner.h"
+
+//! @brief Return a new preconditioner of the type being passed as
+//! parameter ('jacobi', 'incomplete_cholesky' or
+//! 'smoothed_aggregation_amg') or nullptr if the type is unknown.
+XC::KrylovPreconditioner *XC::KrylovPreconditioner::newPreconditioner(const std::string &type)
+  {
+    KrylovPreconditioner *retval= nullptr;
+    if(type=="jacobi")
+      retval= new JacobiPreconditioner();
+    else if((type=="incomplete_cholesky") || (type=="ic0"))
+      retval= new IncompleteCholeskyPreconditioner();
+    else if((type=="smoothed_aggregation_amg") || (type=="sa_amg"))
+      retval= new SmoothedAggregationPreconditioner();
+    return retval;
+  }
@@ -0,0 +1,66 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//KrylovPreconditioner.h
+
+#ifndef KrylovPreconditioner_h
+#define KrylovPreconditioner_h
+
+#include <string>
+
+namespace XC {
+class CsrMatrix;
+
+//! @ingroup LinearSOE
+//
+//! @brief Base class for the preconditioners of the Krylov subspace
+//! solvers (PCGLinSolver, MINRESLinSolver).
+//!
+//! A preconditioner approximates the inverse of a symmetric positive
+//! definite matrix: setup computes the approximation from the matrix
+//! coefficients and apply computes \f$z= M^{-1} r\f$. The operator
+//! \f$M^{-1}\f$ must be symmetric and positive definite.
+class KrylovPreconditioner
+  {
+  public:
+    virtual ~KrylovPreconditioner(void)
+      {}
+    //! @brief Virtual constructor.
+    virtual KrylovPreconditioner *getCopy(void) const= 0;
+    //! @brief Return the name of the preconditioner.
+    virtual std::string getName(void) const= 0;
+    //! @brief Compute the preconditioner of the matrix argument.
+    //! Return 0 if successful, a negative number if not.
+    virtual int setup(const CsrMatrix &)= 0;
+    //! @brief Compute z= M^{-1}*r.
+    virtual void apply(const double *r, double *z) const= 0;
+
+    static KrylovPreconditioner *newPreconditioner(const std::string &);
+  };
+} // end of XC namespace
+
+#endif
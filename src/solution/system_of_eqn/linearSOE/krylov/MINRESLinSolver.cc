@@ -0,0 +1,139 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MINRESLinSolver.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/MINRESLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//! @brief Constructor.
+XC::MINRESLinSolver::MINRESLinSolver(void)
+ : KrylovLinSolver(SOLVER_TAGS_MINRESLinSolver)
+  {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::MINRESLinSolver::getCopy(void) const
+   { return new MINRESLinSolver(*this); }
+
+//! @brief Preconditioned MINRES iterations.
+//!
+//! @param A: system matrix.
+//! @param b: right hand side.
+//! @param x: initial guess (input) and solution (output).
+//! @param tol: tolerance for the norm of the residual.
+//! @param numIter: maximum number of iterations (input) and
+//!                 number of iterations done (output).
+//! @return 0 if converged, -1 if not, -2 if the preconditioner is
+//! not positive definite.
+int XC::MINRESLinSolver::iterate(const CsrMatrix &A, const double *b, double *x, const double &tol, int &numIter)
+  {
+    const int n= A.getNumRows();
+    const int maxIter= numIter;
+    r1.resize(n); r2.resize(n); y.resize(n); v.resize(n);
+    w.assign(n, 0.0); w1.assign(n, 0.0); w2.assign(n, 0.0);
+    A.residual(b, x, r1.data());
+    numIter= 0;
+    const double r0Norm= sqrt(dot(n, r1.data(), r1.data()));
+    if(r0Norm<=tol)
+      return 0;
+    apply_preconditioner(r1.data(), y.data());
+    double beta1= dot(n, r1.data(), y.data());
+    if(!(beta1>0.0))
+      return -2;
+    beta1= sqrt(beta1);
+    // tolerance for the preconditioned residual norm estimate.
+    double phiTol= tol*beta1/r0Norm;
+    r2= r1;
+    double oldb= 0.0, beta= beta1, dbar= 0.0, epsln= 0.0;
+    double phibar= beta1, cs= -1.0, sn= 0.0;
+    const double eps= std::numeric_limits<double>::epsilon();
+    while(numIter<maxIter)
+      {
+	numIter++;
+	const double s= 1.0/beta;
+	#pragma omp parallel for schedule(static)
+	for(int i= 0;i<n;i++)
+	  v[i]= s*y[i];
+	A.multiply(v.data(), y.data());
+	if(numIter>=2)
+	  {
+	    const double f= beta/oldb;
+	    #pragma omp parallel for schedule(static)
+	    for(int i= 0;i<n;i++)
+	      y[i]-= f*r1[i];
+	  }
+	const double alfa= dot(n, v.data(), y.data());
+	const double f= alfa/beta;
+	#pragma omp parallel for schedule(static)
+	for(int i= 0;i<n;i++)
+	  y[i]-= f*r2[i];
+	// r1= r2; r2= y
+	r1.swap(r2);
+	r2.swap(y);
+	apply_preconditioner(r2.data(), y.data());
+	oldb= beta;
+	beta= dot(n, r2.data(), y.data());
+	if(beta<0.0)
+	  return -2;
+	beta= sqrt(beta);
+	// apply previous rotation and compute the new one.
+	const double oldeps= epsln;
+	const double delta= cs*dbar+sn*alfa;
+	const double gbar= sn*dbar-cs*alfa;
+	epsln= sn*beta;
+	dbar= -cs*beta;
+	const double gamma= std::max(sqrt(gbar*gbar+beta*beta), eps);
+	cs= gbar/gamma;
+	sn= beta/gamma;
+	const double phi= cs*phibar;
+	phibar= sn*phibar;
+	// update the solution: w1= w2; w2= w; w= (v-oldeps*w1-delta*w2)/gamma
+	w1.swap(w2);
+	w2.swap(w);
+	const double denom= 1.0/gamma;
+	#pragma omp parallel for schedule(static)
+	for(int i= 0;i<n;i++)
+	  {
+	    w[i]= (v[i]-oldeps*w1[i]-delta*w2[i])*denom;
+	    x[i]+= phi*w[i];
+	  }
+	if(phibar<=phiTol)
+	  {
+	    // check the true residual (w1 is not needed until the next iteration).
+	    A.residual(b, x, w1.data());
+	    const double rNorm= sqrt(dot(n, w1.data(), w1.data()));
+	    if(rNorm<=tol)
+	      return 0;
+	    phiTol*= tol/rNorm; // tighten the estimate tolerance.
+	  }
+	if(beta==0.0)
+	  return -1; // Krylov subspace exhausted.
+      }
+    return -1;
+  }
@@ -0,0 +1,66 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MINRESLinSolver.h
+
+#ifndef MINRESLinSolver_h
+#define MINRESLinSolver_h
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned minimum residual (MINRES) solver for
+//! symmetric systems.
+//!
+//! Unlike the conjugate gradient method, MINRES doesn't break down
+//! when the matrix is symmetric but indefinite (i.e. singular stiffness
+//! or Lagrange multipliers), the preconditioner must be positive
+//! definite. The iteration is controlled with the estimate of the
+//! preconditioned residual norm and, when it's small enough, the
+//! norm of the true residual is checked. See Paige, C.C. and
+//! Saunders, M.A. "Solution of sparse indefinite systems of linear
+//! equations". SIAM Journal on Numerical Analysis, 1975.
+class MINRESLinSolver: public KrylovLinSolver
+  {
+  private:
+    std::vector<double> r1, r2, y, v, w, w1, w2; //!< work vectors.
+  protected:
+    int iterate(const CsrMatrix &, const double *, double *, const double &, int &);
+
+    friend class FEM_ObjectBroker;
+    friend class LinearSOE;
+    MINRESLinSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
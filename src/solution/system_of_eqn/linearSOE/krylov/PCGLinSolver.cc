@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PCGLinSolver.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/PCGLinSolver.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+#include <cmath>
+
+//! @brief Constructor.
+XC::PCGLinSolver::PCGLinSolver(void)
+ : KrylovLinSolver(SOLVER_TAGS_PCGLinSolver)
+  {}
+
+//! @brief Virtual constructor.
+XC::LinearSOESolver *XC::PCGLinSolver::getCopy(void) const
+   { return new PCGLinSolver(*this); }
+
+//! @brief Preconditioned conjugate gradient iterations.
+//!
+//! @param A: system matrix.
+//! @param b: right hand side.
+//! @param x: initial guess (input) and solution (output).
+//! @param tol: tolerance for the norm of the residual.
+//! @param numIter: maximum number of iterations (input) and
+//!                 number of iterations done (output).
+//! @return 0 if converged, -1 if not, -2 if the matrix or the
+//! preconditioner are not positive definite.
+int XC::PCGLinSolver::iterate(const CsrMatrix &A, const double *b, double *x, const double &tol, int &numIter)
+  {
+    const int n= A.getNumRows();
+    const int maxIter= numIter;
+    r.resize(n); z.resize(n); p.resize(n); q.resize(n);
+    A.residual(b, x, r.data());
+    numIter= 0;
+    if(sqrt(dot(n, r.data(), r.data()))<=tol)
+      return 0;
+    apply_preconditioner(r.data(), z.data());
+    p= z;
+    double rz= dot(n, r.data(), z.data());
+    while(numIter<maxIter)
+      {
+	numIter++;
+	A.multiply(p.data(), q.data());
+	const double pq= dot(n, p.data(), q.data());
+	if(!(pq>0.0) || !(rz>0.0))
+	  return -2;
+	const double alpha= rz/pq;
+	#pragma omp parallel for schedule(static)
+	for(int i= 0;i<n;i++)
+	  {
+	    x[i]+= alpha*p[i];
+	    r[i]-= alpha*q[i];
+	  }
+	if(sqrt(dot(n, r.data(), r.data()))<=tol)
+	  return 0;
+	apply_preconditioner(r.data(), z.data());
+	const double rzNew= dot(n, r.data(), z.data());
+	const double beta= rzNew/rz;
+	rz= rzNew;
+	#pragma omp parallel for schedule(static)
+	for(int i= 0;i<n;i++)
+	  p[i]= z[i]+beta*p[i];
+      }
+    return -1;
+  }
@@ -0,0 +1,60 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PCGLinSolver.h
+
+#ifndef PCGLinSolver_h
+#define PCGLinSolver_h
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovLinSolver.h"
+#include <vector>
+
+namespace XC {
+
+//! @ingroup LinearSolver
+//
+//! @brief Preconditioned conjugate gradient solver for symmetric
+//! positive definite systems.
+//!
+//! See Saad, Y. "Iterative methods for sparse linear systems".
+//! SIAM, 2003 (algorithm 9.1).
+class PCGLinSolver: public KrylovLinSolver
+  {
+  private:
+    std::vector<double> r, z, p, q; //!< work vectors.
+  protected:
+    int iterate(const CsrMatrix &, const double *, double *, const double &, int &);
+
+    friend class FEM_ObjectBroker;
+    friend class LinearSOE;
+    PCGLinSolver(void);
+    virtual LinearSOESolver *getCopy(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,416 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SmoothedAggregationPreconditioner.cc
+
+#include "solution/system_of_eqn/linearSOE/krylov/SmoothedAggregationPreconditioner.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+typedef XC::CsrMatrix::int_vector int_vector;
+typedef XC::CsrMatrix::double_vector double_vector;
+
+//! @brief Gauss-Seidel sweep from the first row to the last one.
+void gauss_seidel_forward(const XC::CsrMatrix &A, const double_vector &diag, const double_vector &b, double_vector &x)
+  {
+    const int n= A.getNumRows();
+    const int_vector &rs= A.getRowStart();
+    const int_vector &ci= A.getColIndex();
+    const double_vector &a= A.getValues();
+    for(int i= 0;i<n;i++)
+      {
+	double s= b[i];
+	for(int k= rs[i];k<rs[i+1];k++)
+	  s-= a[k]*x[ci[k]];
+	x[i]+= s/diag[i];
+      }
+  }
+
+//! @brief Gauss-Seidel sweep from the last row to the first one.
+void gauss_seidel_backward(const XC::CsrMatrix &A, const double_vector &diag, const double_vector &b, double_vector &x)
+  {
+    const int n= A.getNumRows();
+    const int_vector &rs= A.getRowStart();
+    const int_vector &ci= A.getColIndex();
+    const double_vector &a= A.getValues();
+    for(int i= n-1;i>=0;i--)
+      {
+	double s= b[i];
+	for(int k= rs[i];k<rs[i+1];k++)
+	  s-= a[k]*x[ci[k]];
+	x[i]+= s/diag[i];
+      }
+  }
+
+//! @brief Estimate the spectral radius of D^{-1}*A with a few power
+//! iterations.
+double spectral_radius(const XC::CsrMatrix &A, const double_vector &diag)
+  {
+    const int n= A.getNumRows();
+    double_vector v(n), w(n);
+    // deterministic pseudo-random starting vector.
+    unsigned int seed= 12345;
+    for(int i= 0;i<n;i++)
+      {
+	seed= seed*1103515245+12345;
+	v[i]= static_cast<double>((seed>>16)&0x7fff)/32767.0-0.5;
+      }
+    double retval= 0.0;
+    for(int iter= 0;iter<15;iter++)
+      {
+	double vNorm= 0.0;
+	for(int i= 0;i<n;i++)
+	  vNorm+= v[i]*v[i];
+	vNorm= sqrt(vNorm);
+	if(vNorm==0.0)
+	  break;
+	A.multiply(v.data(), w.data());
+	double wNorm= 0.0;
+	for(int i= 0;i<n;i++)
+	  {
+	    w[i]/= diag[i];
+	    wNorm+= w[i]*w[i];
+	  }
+	wNorm= sqrt(wNorm);
+	retval= wNorm/vNorm;
+	v.swap(w);
+      }
+    return retval;
+  }
+} // end of anonymous namespace
+
+//! @brief Constructor.
+//!
+//! @param theta: threshold of the strength of connection.
+//! @param cSize: maximum size of the coarsest level.
+//! @param maxLevels: maximum number of levels.
+//! @param nSweeps: number of Gauss-Seidel sweeps before and after
+//!                 the coarse correction.
+XC::SmoothedAggregationPreconditioner::SmoothedAggregationPreconditioner(const double &theta, const int &cSize, const int &maxLevels, const int &nSweeps)
+  : levels(), coarseFactor(), strengthThreshold(theta), coarseSize(cSize),
+    maxNumLevels(maxLevels), numSweeps(nSweeps)
+  {}
+
+//! @brief Virtual constructor.
+XC::KrylovPreconditioner *XC::SmoothedAggregationPreconditioner::getCopy(void) const
+  { return new SmoothedAggregationPreconditioner(*this); }
+
+//! @brief Return the name of the preconditioner.
+std::string XC::SmoothedAggregationPreconditioner::getName(void) const
+  { return "smoothed_aggregation_amg"; }
+
+//! @brief Group the unknowns of the level in aggregates.
+//!
+//! The unknowns without strong connections are not aggregated (they
+//! are solved by the smoother).
+//! @param level: level to coarsen.
+//! @param agg: aggregate of each unknown (-1 if not aggregated).
+//! @return the number of aggregates.
+int XC::SmoothedAggregationPreconditioner::aggregate(const Level &level, int_vector &agg) const
+  {
+    const CsrMatrix &A= level.A;
+    const int n= A.getNumRows();
+    const int_vector &rs= A.getRowStart();
+    const int_vector &ci= A.getColIndex();
+    const double_vector &a= A.getValues();
+    const double_vector &d= level.diag;
+    const double theta2= strengthThreshold*strengthThreshold;
+    // strong connections.
+    int_vector strongStart(n+1, 0);
+    int_vector strong;
+    strong.reserve(A.getNumNonZeros());
+    for(int i= 0;i<n;i++)
+      {
+	for(int k= rs[i];k<rs[i+1];k++)
+	  {
+	    const int j= ci[k];
+	    if((j!=i) && (a[k]*a[k]>=theta2*d[i]*d[j]))
+	      strong.push_back(j);
+	  }
+	strongStart[i+1]= strong.size();
+      }
+    const int isolated= -2;
+    const int unaggregated= -1;
+    agg.assign(n, unaggregated);
+    int retval= 0;
+    // 1st pass: unknowns whose strong neighbours are all unaggregated.
+    for(int i= 0;i<n;i++)
+      {
+	if(strongStart[i]==strongStart[i+1])
+	  agg[i]= isolated;
+	if(agg[i]!=unaggregated)
+	  continue;
+	bool allFree= true;
+	for(int k= strongStart[i];allFree && (k<strongStart[i+1]);k++)
+	  allFree= (agg[strong[k]]==unaggregated);
+	if(allFree)
+	  {
+	    agg[i]= retval;
+	    for(int k= strongStart[i];k<strongStart[i+1];k++)
+	      agg[strong[k]]= retval;
+	    retval++;
+	  }
+      }
+    // 2nd pass: join the unaggregated unknowns to the aggregate of
+    // its strongest neighbour.
+    const int_vector firstPass(agg);
+    for(int i= 0;i<n;i++)
+      {
+	if(agg[i]!=unaggregated)
+	  continue;
+	double strongest= 0.0;
+	for(int k= rs[i];k<rs[i+1];k++)
+	  {
+	    const int j= ci[k];
+	    const double a2= a[k]*a[k];
+	    if((j!=i) && (firstPass[j]>=0) && (a2>=theta2*d[i]*d[j]) && (a2>strongest))
+	      {
+		strongest= a2;
+		agg[i]= firstPass[j];
+	      }
+	  }
+      }
+    // 3rd pass: new aggregates with the remaining unknowns.
+    for(int i= 0;i<n;i++)
+      {
+	if(agg[i]!=unaggregated)
+	  continue;
+	agg[i]= retval;
+	for(int k= strongStart[i];k<strongStart[i+1];k++)
+	  if(agg[strong[k]]==unaggregated)
+	    agg[strong[k]]= retval;
+	retval++;
+      }
+    for(int &g: agg)
+      if(g==isolated)
+	g= -1;
+    return retval;
+  }
+
+//! @brief Return the smoothed prolongation P= (I-omega*D^{-1}*A)*T.
+//!
+//! @param level: fine level.
+//! @param agg: aggregate of each unknown (-1 if not aggregated).
+//! @param numAggregates: number of aggregates.
+XC::CsrMatrix XC::SmoothedAggregationPreconditioner::get_prolongation(const Level &level, const int_vector &agg, const int &numAggregates) const
+  {
+    const int n= level.A.getNumRows();
+    // tentative prolongation (normalized columns).
+    int_vector aggSize(numAggregates, 0);
+    for(int g: agg)
+      if(g>=0)
+	aggSize[g]++;
+    int_vector rs(n+1, 0);
+    int_vector ci;
+    ci.reserve(n);
+    for(int i= 0;i<n;i++)
+      {
+	if(agg[i]>=0)
+	  ci.push_back(agg[i]);
+	rs[i+1]= ci.size();
+      }
+    CsrMatrix T(n, rs, ci);
+    double_vector &t= T.getValues();
+    for(size_t k= 0;k<ci.size();k++)
+      t[k]= 1.0/sqrt(static_cast<double>(aggSize[ci[k]]));
+    // smoothing.
+    const double omega= 4.0/3.0/spectral_radius(level.A, level.diag);
+    CsrMatrix retval= level.A*T;
+    const int_vector &prs= retval.getRowStart();
+    const int_vector &pci= retval.getColIndex();
+    double_vector &p= retval.getValues();
+    for(int i= 0;i<n;i++)
+      {
+	const double f= omega/level.diag[i];
+	for(int k= prs[i];k<prs[i+1];k++)
+	  {
+	    p[k]*= -f;
+	    if(pci[k]==agg[i])
+	      p[k]+= t[rs[i]];
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Compute the dense Cholesky factorization of the matrix
+//! of the coarsest level.
+//! @return false if the matrix is not positive definite.
+bool XC::SmoothedAggregationPreconditioner::factorize_coarsest(void)
+  {
+    const CsrMatrix &A= levels.back().A;
+    const int n= A.getNumRows();
+    const int_vector &rs= A.getRowStart();
+    const int_vector &ci= A.getColIndex();
+    const double_vector &a= A.getValues();
+    coarseFactor.assign(n*n, 0.0);
+    double *l= coarseFactor.data();
+    for(int i= 0;i<n;i++)
+      for(int k= rs[i];k<rs[i+1];k++)
+	l[i*n+ci[k]]= a[k];
+    for(int j= 0;j<n;j++)
+      {
+	double d= l[j*n+j];
+	for(int k= 0;k<j;k++)
+	  d-= l[j*n+k]*l[j*n+k];
+	if(!(d>0.0))
+	  {
+	    coarseFactor.clear();
+	    return false;
+	  }
+	d= sqrt(d);
+	l[j*n+j]= d;
+	for(int i= j+1;i<n;i++)
+	  {
+	    double s= l[i*n+j];
+	    for(int k= 0;k<j;k++)
+	      s-= l[i*n+k]*l[j*n+k];
+	    l[i*n+j]= s/d;
+	  }
+      }
+    return true;
+  }
+
+//! @brief Solve the system of the coarsest level (dense factorization
+//! or, if it's not available, symmetric Gauss-Seidel sweeps).
+void XC::SmoothedAggregationPreconditioner::solve_coarsest(void) const
+  {
+    const Level &level= levels.back();
+    double_vector &x= level.x;
+    const int n= x.size();
+    if(coarseFactor.empty())
+      {
+	std::fill(x.begin(), x.end(), 0.0);
+	for(int s= 0;s<numSweeps;s++)
+	  gauss_seidel_forward(level.A, level.diag, level.b, x);
+	for(int s= 0;s<numSweeps;s++)
+	  gauss_seidel_backward(level.A, level.diag, level.b, x);
+      }
+    else
+      {
+	const double *l= coarseFactor.data();
+	for(int i= 0;i<n;i++)
+	  {
+	    double s= level.b[i];
+	    for(int k= 0;k<i;k++)
+	      s-= l[i*n+k]*x[k];
+	    x[i]= s/l[i*n+i];
+	  }
+	for(int i= n-1;i>=0;i--)
+	  {
+	    double s= x[i];
+	    for(int k= i+1;k<n;k++)
+	      s-= l[k*n+i]*x[k];
+	    x[i]= s/l[i*n+i];
+	  }
+      }
+  }
+
+//! @brief Apply a V-cycle starting at the level argument (the right
+//! hand side is in levels[l].b, the solution is written in levels[l].x).
+void XC::SmoothedAggregationPreconditioner::vcycle(const size_t &l) const
+  {
+    if(l+1==levels.size())
+      solve_coarsest();
+    else
+      {
+	const Level &fine= levels[l];
+	const Level &coarse= levels[l+1];
+	std::fill(fine.x.begin(), fine.x.end(), 0.0);
+	for(int s= 0;s<numSweeps;s++)
+	  gauss_seidel_forward(fine.A, fine.diag, fine.b, fine.x);
+	fine.A.residual(fine.b.data(), fine.x.data(), fine.r.data());
+	fine.R.multiply(fine.r.data(), coarse.b.data());
+	vcycle(l+1);
+	fine.P.multiply(coarse.x.data(), fine.r.data());
+	const int n= fine.x.size();
+	for(int i= 0;i<n;i++)
+	  fine.x[i]+= fine.r[i];
+	for(int s= 0;s<numSweeps;s++)
+	  gauss_seidel_backward(fine.A, fine.diag, fine.b, fine.x);
+      }
+  }
+
+//! @brief Compute the multigrid hierarchy of the matrix.
+//! @return -1 if a diagonal coefficient is not positive.
+int XC::SmoothedAggregationPreconditioner::setup(const CsrMatrix &A)
+  {
+    levels.clear();
+    levels.push_back(Level());
+    levels.back().A= A;
+    while(true)
+      {
+	const size_t l= levels.size()-1;
+	Level &level= levels[l];
+	const int n= level.A.getNumRows();
+	level.A.getDiagonal(level.diag);
+	for(const double &d: level.diag)
+	  if(!(d>0.0))
+	    return -1;
+	level.b.assign(n, 0.0);
+	level.x.assign(n, 0.0);
+	level.r.assign(n, 0.0);
+	if((n<=coarseSize) || (static_cast<int>(levels.size())>=maxNumLevels))
+	  break;
+	int_vector agg;
+	const int numAggregates= aggregate(level, agg);
+	if((numAggregates==0) || (numAggregates>=n))
+	  break; // no coarsening.
+	level.P= get_prolongation(level, agg, numAggregates);
+	level.R= level.P.getTranspose();
+	Level coarse;
+	coarse.A= level.A.getGalerkinProduct(level.P);
+	levels.push_back(coarse); // level reference is invalid from here.
+      }
+    coarseFactor.clear();
+    if(levels.back().A.getNumRows()<=4*coarseSize)
+      factorize_coarsest();
+    return 0;
+  }
+
+//! @brief Compute z= M^{-1}*r applying one V-cycle.
+void XC::SmoothedAggregationPreconditioner::apply(const double *r, double *z) const
+  {
+    const Level &finest= levels.front();
+    std::copy(r, r+finest.b.size(), finest.b.begin());
+    vcycle(0);
+    std::copy(finest.x.begin(), finest.x.end(), z);
+  }
+
+//! @brief Return the operator complexity of the hierarchy (number of
+//! coefficients of all the levels divided by those of the finest one).
+double XC::SmoothedAggregationPreconditioner::getOperatorComplexity(void) const
+  {
+    double retval= 0.0;
+    if(!levels.empty())
+      {
+	double nnz= 0.0;
+	for(const Level &level: levels)
+	  nnz+= level.A.getNumNonZeros();
+	retval= nnz/levels.front().A.getNumNonZeros();
+      }
+    return retval;
+  }
@@ -0,0 +1,98 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SmoothedAggregationPreconditioner.h
+
+#ifndef SmoothedAggregationPreconditioner_h
+#define SmoothedAggregationPreconditioner_h
+
+#include "solution/system_of_eqn/linearSOE/krylov/KrylovPreconditioner.h"
+#include "solution/system_of_eqn/linearSOE/krylov/CsrMatrix.h"
+
+namespace XC {
+
+//! @ingroup LinearSOE
+//
+//! @brief Smoothed aggregation algebraic multigrid preconditioner
+//! (one V-cycle).
+//!
+//! The unknowns of each level are grouped in aggregates of strongly
+//! connected unknowns (\f$|a_{ij}| \geq \theta \sqrt{a_{ii} a_{jj}}\f$).
+//! The tentative prolongation T interpolates a constant in each
+//! aggregate and it's smoothed with one damped Jacobi step:
+//! \f$P= (I-\omega D^{-1} A) T\f$ with \f$\omega= 4/(3\rho(D^{-1}A))\f$.
+//! The coarse matrix is \f$P^T A P\f$. The smoother is Gauss-Seidel
+//! (forward before the coarse correction, backward after it, so the
+//! V-cycle is symmetric) and the coarsest level is solved with a
+//! dense Cholesky factorization. See Vaněk, P., Mandel, J. and Brezina,
+//! M. "Algebraic multigrid by smoothed aggregation for second and
+//! fourth order elliptic problems". Computing, 1996.
+//!
+//! Only one near null space vector (the constant) is used, so the
+//! convergence for elasticity problems is slower than with the rigid
+//! body modes but it doesn't need the coordinates of the nodes.
+class SmoothedAggregationPreconditioner: public KrylovPreconditioner
+  {
+  private:
+    //! @brief Level of the multigrid hierarchy.
+    struct Level
+      {
+	CsrMatrix A; //!< matrix of the level.
+	CsrMatrix P; //!< prolongation to this level from the next one.
+	CsrMatrix R; //!< restriction (transpose of P).
+	CsrMatrix::double_vector diag; //!< diagonal of A.
+	mutable CsrMatrix::double_vector b; //!< right hand side.
+	mutable CsrMatrix::double_vector x; //!< solution.
+	mutable CsrMatrix::double_vector r; //!< residual.
+      };
+    std::vector<Level> levels; //!< multigrid hierarchy.
+    CsrMatrix::double_vector coarseFactor; //!< dense Cholesky factor of the coarsest matrix.
+    double strengthThreshold; //!< threshold of the strength of connection (theta).
+    int coarseSize; //!< maximum size of the coarsest level.
+    int maxNumLevels; //!< maximum number of levels.
+    int numSweeps; //!< number of Gauss-Seidel sweeps before and after the coarse correction.
+
+    int aggregate(const Level &, CsrMatrix::int_vector &) const;
+    CsrMatrix get_prolongation(const Level &, const CsrMatrix::int_vector &, const int &) const;
+    bool factorize_coarsest(void);
+    void solve_coarsest(void) const;
+    void vcycle(const size_t &) const;
+  public:
+    SmoothedAggregationPreconditioner(const double &theta= 0.08, const int &cSize= 300, const int &maxLevels= 10, const int &nSweeps= 1);
+    KrylovPreconditioner *getCopy(void) const;
+    std::string getName(void) const;
+    int setup(const CsrMatrix &);
+    void apply(const double *, double *) const;
+
+    //! @brief Return the number of levels of the hierarchy.
+    inline int getNumLevels(void) const
+      { return levels.size(); }
+    double getOperatorComplexity(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -64,542 +64,181 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
-#include <cmath>
+#include "solution/system_of_eqn/linearSOE/ColumnBlockLDLt.h"
+#include <omp.h>
 
-#define _REENTRANT    /* basic 3-lines for threads */
-// #include <pthread.h>
-#include <thread.h>
-
-#include <utility/Timer.h>
-
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int *iDiagLoc;
-  int size;
-  int blockSize;
-  int  maxColHeight;
-  double minDiagTol;
-  int *RowTop;
-  double **topRowPtr, *invD;
-
-  int currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_ProfileSPDDirectThreadSolver;
-
-
-void *ProfileSPDLinDirectThreadSolver_Worker(void *arg);
-
-//! @brief Default constructor.
+//! @brief Default constructor (uses the number of threads given
+//! by the OpenMP runtime).
 XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(void)
   :ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,1.0e-12),
- NP(2), running(false), blockSize(4), maxColHeight(0) {}
+   numThreads(omp_get_max_threads()), blockSize(32), maxColHeight(0) {}
 
 //! @brief Constructor.
 //!
-//! @param numProcessors: number of processors to use.
-XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(int numProcessors, int blckSize, double tol) 
-:ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,tol),
- NP(numProcessors), running(false), blockSize(blckSize), maxColHeight(0)
-  {}
+//! @param nThreads: number of threads to use.
+//! @param blckSize: number of columns of each block.
+//! @param tol: minimum value allowed for the pivots.
+XC::ProfileSPDLinDirectThreadSolver::ProfileSPDLinDirectThreadSolver(int nThreads, int blckSize, double tol) 
+  :ProfileSPDLinDirectBase(SOLVER_TAGS_ProfileSPDLinDirectThreadSolver,tol),
+   numThreads(1), blockSize(32), maxColHeight(0)
+  {
+    setNumThreads(nThreads);
+    setBlockSize(blckSize);
+  }
+
+//! @brief Return the number of threads used in the factorization.
+int XC::ProfileSPDLinDirectThreadSolver::getNumThreads(void) const
+  { return numThreads; }
+
+//! @brief Set the number of threads used in the factorization.
+void XC::ProfileSPDLinDirectThreadSolver::setNumThreads(const int &n)
+  {
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING number of threads must be at least one."
+		  << " Using one thread." << std::endl;
+	numThreads= 1;
+      }
+    else
+      numThreads= n;
+  }
+
+//! @brief Return the number of columns of each block.
+int XC::ProfileSPDLinDirectThreadSolver::getBlockSize(void) const
+  { return blockSize; }
+
+//! @brief Set the number of columns of each block.
+void XC::ProfileSPDLinDirectThreadSolver::setBlockSize(const int &n)
+  {
+    if(n<1)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING block size must be at least one."
+		  << " Using one column per block." << std::endl;
+	blockSize= 1;
+      }
+    else
+      blockSize= n;
+  }
 
 //! @brief Set system size.    
 int XC::ProfileSPDLinDirectThreadSolver::setSize(void)
   {
     if(!theSOE)
       {
-	std::cerr << getClassName() << "::" << __FUNCTION__;
-	std::cerr << " No system has been set\n";
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set.\n";
 	return -1;
       }
 
-    // check for XC::quick return 
-    if (theSOE->size == 0)
-	return 0;
-    if(size != theSOE->size)
-      {    
-        size = theSOE->size;
-        RowTop= ID(size);
-        topRowPtr= std::vector<double *>(size);
-        invD= Vector(size); 
-      }
-
+    // check for quick return 
+    if(theSOE->size == 0)
+      return 0;
+    
+    size = theSOE->size;
+    
+    RowTop= ID(size);
+    topRowPtr= std::vector<double *>(size);
+    invD= Vector(size); 
 
     // set some pointers
     double *A = theSOE->A.getDataPtr();
     int *iDiagLoc = theSOE->iDiagLoc.getDataPtr();
 
     // set RowTop and topRowPtr info
-
-    maxColHeight = 0;
-    RowTop[0] = 0;
-    topRowPtr[0] = A;
-    for (int j=1; j<size; j++) {
+    maxColHeight= 1;
+    RowTop[0]= 0;
+    topRowPtr[0]= A;
+    for(int j=1; j<size; j++)
+      {
 	int icolsz = iDiagLoc[j] - iDiagLoc[j-1];
-        if (icolsz > maxColHeight) maxColHeight = icolsz;
+        if(icolsz > maxColHeight)
+	  maxColHeight= icolsz;
 	RowTop[j] = j - icolsz +  1;
 	topRowPtr[j] = &A[iDiagLoc[j-1]]; // FORTRAN array indexing in iDiagLoc
-    }
-
-    size = theSOE->size;
+      }
     return 0;
-}
-
+  }
 
-//! The solver first copies the B vector into X.
-//! FILL IN
+//! @brief Computes the solution.
+//!
+//! The solver first copies the B vector into X. If the matrix is not
+//! factored yet, it is factored using numThreads threads. Then the
+//! forward and back substitutions are performed.
 //! The solve process changes \f$A\f$ and \f$X\f$.   
 int XC::ProfileSPDLinDirectThreadSolver::solve(void)
   {
-    // check for XC::quick returns
-    if (theSOE == 0) {
-	std::cerr << getClassName() << "::" << __FUNCTION__;
-	std::cerr << " - No ProfileSPDSOE has been assigned\n";
+    // check for quick returns
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned\n";
 	return -1;
-    }
+      }
     
-    if (theSOE->size == 0)
-	return 0;
+    if(theSOE->size == 0)
+      return 0;
 
     // set some pointers
-    double *A = theSOE->A;
-    double *B = theSOE->B;
-    double *X = theSOE->X;
-    int *iDiagLoc = theSOE->iDiagLoc;
-    int size = theSOE->size;
-
+    double *B = theSOE->getPtrB();
+    double *X = theSOE->getPtrX();
+    const int theSize = theSOE->size;
     // copy B into X
-    for (int ii=0; ii<size; ii++)
-	X[ii] = B[ii];
-    
-    if (theSOE->isAfactored == false)  {
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_ProfileSPDDirectThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_ProfileSPDDirectThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_ProfileSPDDirectThreadSolver.workToDo = 0;
+    for(int ii=0; ii<theSize; ii++)
+      X[ii] = B[ii];
 
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(nullptr,0, ProfileSPDLinDirectThreadSolver_Worker, 
-		     nullptr, THR_BOUND|THR_DAEMON, nullptr);
-
-        running = true;
+    if(theSOE->factored == false)
+      {
+	int failedRow= -1;
+	const int info= ColumnBlockLDLt::factor(theSize, RowTop.getDataPtr(), topRowPtr.data(), invD.getDataPtr(), maxColHeight, minDiagTol, blockSize, numThreads, failedRow);
+	if(info<0)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; aii < minDiagTol in row: " << failedRow
+		      << std::endl;
+	    return info;
+	  }
+	theSOE->factored = true;
+	theSOE->numInt = 0;
       }
-      
-  
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.start_mutex); 
-
-	invD[0] = 1.0/A[0];	
-
-        // assign the global variables the threads will need
-        TCB_ProfileSPDDirectThreadSolver.A = A;
-	TCB_ProfileSPDDirectThreadSolver.X = X;
-	TCB_ProfileSPDDirectThreadSolver.B = B;
-	TCB_ProfileSPDDirectThreadSolver.size = size;
-	TCB_ProfileSPDDirectThreadSolver.minDiagTol = minDiagTol;
-	TCB_ProfileSPDDirectThreadSolver.maxColHeight = maxColHeight;
-	TCB_ProfileSPDDirectThreadSolver.RowTop = RowTop;
-	TCB_ProfileSPDDirectThreadSolver.topRowPtr = topRowPtr;
-	TCB_ProfileSPDDirectThreadSolver.invD = invD;
-        TCB_ProfileSPDDirectThreadSolver.blockSize = blockSize;
-        TCB_ProfileSPDDirectThreadSolver.iDiagLoc = iDiagLoc;
-	
-	TCB_ProfileSPDDirectThreadSolver.info = 0;
-        TCB_ProfileSPDDirectThreadSolver.workToDo = NP;
-        TCB_ProfileSPDDirectThreadSolver.currentBlock = -1;
-	TCB_ProfileSPDDirectThreadSolver.threadID = 0;
-	TCB_ProfileSPDDirectThreadSolver.numThreads = NP;
-        TCB_ProfileSPDDirectThreadSolver.threadsDone = 0;
-        TCB_ProfileSPDDirectThreadSolver.threadsDoneBlock = NP;
-
-        // wake up the threads
-        cond_broadcast(&TCB_ProfileSPDDirectThreadSolver.start_cond);
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.start_mutex); 
-
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-         while (TCB_ProfileSPDDirectThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_ProfileSPDDirectThreadSolver.end_cond, &TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-
+    ColumnBlockLDLt::solve(theSize, RowTop.getDataPtr(), topRowPtr.data(), invD.getDataPtr(), X);
+    return 0;
+  }
 
-      theSOE->isAfactored = true;
-	
-      // divide by diag term 
-      double *bjPtr = X; 
-      double *aiiPtr = invD;
-      for (int j=0; j<size; j++) 
-	*bjPtr++ = *aiiPtr++ * X[j];
+//! @brief Returns the determinant.
+double XC::ProfileSPDLinDirectThreadSolver::getDeterminant(void) 
+  {
+    const int theSize = theSOE->size;
+    double determinant = 1.0;
+    for(int i=0; i<theSize; i++)
+      determinant *= invD[i];
+    determinant = 1.0/determinant;
+    return determinant;
+  }
 
-    
-      // now do the back substitution storing result in X
-      for (int k=(size-1); k>0; k--) {
-      
-	int rowktop = RowTop[k];
-	double bk = X[k];
-	double *ajiPtr = topRowPtr[k]; 		
-      
-	for (int j=rowktop; j<k; j++) 
-	  X[j] -= *ajiPtr++ * bk;
-      }   	 
-    } else { // just do forward and back substitution
-      
-      // do forward substitution 
-      for (int i=1; i<size; i++) {
-	    
-	int rowitop = RowTop[i];	    
-	double *ajiPtr = topRowPtr[i];
-	double *bjPtr  = &X[rowitop];  
-	double tmp = 0;	    
-	    
-	for (int j=rowitop; j<i; j++) 
-	  tmp -= *ajiPtr++ * *bjPtr++; 
-	    
-	X[i] += tmp;
+//! @brief Sets the system of equations to solve.
+int XC::ProfileSPDLinDirectThreadSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
+  {
+    int retval= 0;
+    if(theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << ";  has already been called \n";	
+	retval= -1;
       }
-
-      // divide by diag term 
-      double *bjPtr = X; 
-      double *aiiPtr = invD;
-      for (int j=0; j<size; j++) 
-	*bjPtr++ = *aiiPtr++ * X[j];
-
-    
-      // now do the back substitution storing result in X
-      for (int k=(size-1); k>0; k--) {
-      
-	int rowktop = RowTop[k];
-	double bk = X[k];
-	double *ajiPtr = topRowPtr[k]; 		
-
-	for (int j=rowktop; j<k; j++) 
-	  X[j] -= *ajiPtr++ * bk;
-      }   	 
-    }    
-    return 0;
+    else
+      theSOE= &theNewSOE;
+    return retval;
   }
-
-int 
-XC::ProfileSPDLinDirectThreadSolver::setProfileSOE(ProfileSPDLinSOE &theNewSOE)
-{
-    if (theSOE != 0) {
-	std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-	std::cerr << " has already been called \n";	
-	return -1;
-    }
-    
-    theSOE = &theNewSOE;
-    return 0;
-}
 	
 int XC::ProfileSPDLinDirectThreadSolver::sendSelf(Communicator &comm)
-{
-    if (size != 0)
-	std::cerr << "XC::ProfileSPDLinDirectThreadSolver::sendSelf - does not send itself YET\n"; 
-    return 0;
-}
-
-
-int 
-XC::ProfileSPDLinDirectThreadSolver::recvSelf(const Communicator &comm)
-{
+  {
+    if(size != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; does not send itself YET\n"; 
     return 0;
-}
-
-
-
-void *ProfileSPDLinDirectThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-        while (TCB_ProfileSPDDirectThreadSolver.workToDo == 0)
-          cond_wait(&TCB_ProfileSPDDirectThreadSolver.start_cond, &TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-        TCB_ProfileSPDDirectThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_ProfileSPDDirectThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.start_mutex);
-
-      // do some initialization for the factorization
-      double *A = TCB_ProfileSPDDirectThreadSolver.A;
-      double *B = TCB_ProfileSPDDirectThreadSolver.B;
-      double *X = TCB_ProfileSPDDirectThreadSolver.X;
-      int *iDiagLoc = TCB_ProfileSPDDirectThreadSolver.iDiagLoc;
-      int size = TCB_ProfileSPDDirectThreadSolver.size;
-      double minDiagTol = TCB_ProfileSPDDirectThreadSolver.minDiagTol;
-      int maxColHeight = TCB_ProfileSPDDirectThreadSolver.maxColHeight;
-      int *RowTop = TCB_ProfileSPDDirectThreadSolver.RowTop;
-      double **topRowPtr = TCB_ProfileSPDDirectThreadSolver.topRowPtr;
-      double *invD = TCB_ProfileSPDDirectThreadSolver.invD;
-      int blockSize = TCB_ProfileSPDDirectThreadSolver.blockSize;
-
-      int currentBlock =0;
-      int numThreads = TCB_ProfileSPDDirectThreadSolver.numThreads;
-
-
-      // FACTOR 
-      int startRow = 0;
-      int lastRow = startRow+blockSize-1;
-      int lastColEffected = lastRow+maxColHeight -1;
-      int nBlck = size/blockSize;
-      if ((size % blockSize) != 0)
-	nBlck++;
-
-      // for every block across      
-      for (int i=0; i<nBlck; i++) {
-
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // first factor the diagonal block int Ui,i and Di
-          int j;
-	  for (j=0; j<blockSize; j++) {
-            int currentRow = startRow + j;
-
-	    if (currentRow < size) { // this is for case when size%blockSize != 0
-
-	      int rowjTop = RowTop[currentRow];
-	      //	      double *akjPtr = &A[iDiagLoc[currentRow-1]];
-	      double *akjPtr = topRowPtr[currentRow];
-	      int maxRowijTop;
-	      if (rowjTop < startRow) {
-		akjPtr += startRow-rowjTop; // pointer to start of block row
-		maxRowijTop = startRow;
-	      } else
-		maxRowijTop = rowjTop;
-
-	      int k;
-	      for (k=maxRowijTop; k<currentRow; k++) {
-		double tmp = *akjPtr;
-		int rowkTop = RowTop[k];
-		int maxRowkjTop;
-		double *alkPtr, *aljPtr;
-		if (rowkTop < rowjTop) {
-		  alkPtr = topRowPtr[k] + (rowjTop - rowkTop);
-		  aljPtr = topRowPtr[currentRow];
-		  maxRowkjTop = rowjTop;
-		} else {
-		  alkPtr = topRowPtr[k];
-		  aljPtr = topRowPtr[currentRow] + (rowkTop - rowjTop);
-		  maxRowkjTop = rowkTop;
-		}
-
-		for (int l = maxRowkjTop; l<k; l++) 
-		  tmp -= *alkPtr++ * *aljPtr++;
-		
-		*akjPtr++ = tmp;
-	      }
-
-	      double ajj = *akjPtr;
-	      akjPtr = topRowPtr[currentRow];
-	      //	      akjPtr = &A[iDiagLoc[currentRow-1]];
-	      double *bjPtr  = &X[rowjTop];  
-	      double tmp = 0;	    
-
-	      for (k=rowjTop; k<currentRow; k++){
-		double akj = *akjPtr;
-		double lkj = akj * invD[k];
-		tmp -= lkj * *bjPtr++; 		
-		*akjPtr++ = lkj;
-		ajj = ajj -lkj * akj;
-	      }
-
-	      X[currentRow] += tmp;
-
-	      // check that the diag > the tolerance specified
-	      if (ajj <= 0.0) {
-		std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-		std::cerr << " aii < 0 (i, aii): (" << currentRow << ", " << ajj << ")\n"; 
-		TCB_ProfileSPDDirectThreadSolver.info = -2;
-		return nullptr;
-	      }
-	      if (ajj <= minDiagTol) {
-		std::cerr << getClassName() << "::" << __FUNCTION__ << "; ";
-		std::cerr << " aii < minDiagTol (i, aii): (" << currentRow;
-		std::cerr << ", " << ajj << ")\n"; 
-		TCB_ProfileSPDDirectThreadSolver.info = -2;
-		return nullptr;
-	      }		
-	      invD[currentRow] = 1.0/ajj; 
-
-	    } else 
-	      j = blockSize;
-
-	  }
-
-          // allow other threads to now proceed
-          mutex_lock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-	    TCB_ProfileSPDDirectThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);        
-
-
-	  // now do rest of i'th block row belonging to thread
-	  // doing a block of columns at a time forming Ui,j*Di
-	  int currentCol = startRow + blockSize;
-	  for (j=i+1; j<nBlck; j++) {
-
-	    if (j%numThreads == myID) {
-
-	      for (int k=0; k<blockSize; k++) {
-
-		if (currentCol < size) { // this is for case when size%blockSize != 0
-
-		  int rowkTop = RowTop[currentCol];
-		  double *alkPtr = topRowPtr[currentCol];
-		  // double *alkPtr = &A[iDiagLoc[currentCol-1]];
-		  int maxRowikTop;
-		  if (rowkTop < startRow) {
-		    alkPtr += startRow-rowkTop; // pointer to start of block row
-		    maxRowikTop = startRow;
-		  } else
-		    maxRowikTop = rowkTop;
-
-		  for (int l=maxRowikTop; l<=lastRow; l++) {
-		    double tmp = *alkPtr;
-		    int rowlTop = RowTop[l];
-		    int maxRowklTop;
-		    double *amlPtr, *amkPtr;
-		    if (rowlTop < rowkTop) {
-		      amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
-		      amkPtr = topRowPtr[currentCol];
-		      maxRowklTop = rowkTop;
-		    } else {
-		      amlPtr = topRowPtr[l];
-		      amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
-		      maxRowklTop = rowlTop;
-		    }
-		  
-		    for (int m = maxRowklTop; m<l; m++) 
-		      tmp -= *amkPtr++ * *amlPtr++;
-		  
-		    *alkPtr++ = tmp;
-		  }
-		  currentCol++;
-		  if (currentCol > lastColEffected) {
-		    k = blockSize;
-		    j = nBlck;
-		  }
-		  
-		} else
-		  k = blockSize;
-	      }
-	    } else
-	      currentCol += blockSize;
-	  }
-	} else {
-          // wait till diag i is done 
-          mutex_lock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-             while (TCB_ProfileSPDDirectThreadSolver.currentBlock < i)
-                cond_wait(&TCB_ProfileSPDDirectThreadSolver.startBlock_cond, &TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-          mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-	  // now do rest of i'th block row belonging to thread
-	  // doing a block of columns at a time forming Ui,j*Di
-	  int currentCol = startRow + blockSize;
-	  for (int j=i+1; j<nBlck; j++) {
-
-	    if (j%numThreads == myID) {
-
-	      for (int k=0; k<blockSize; k++) {
-
-		if (currentCol < size) { // this is for case when size%blockSize != 0
-
-		  int rowkTop = RowTop[currentCol];
-		  double *alkPtr = topRowPtr[currentCol];
-		  // double *alkPtr = &A[iDiagLoc[currentCol-1]];
-		  int maxRowikTop;
-		  if (rowkTop < startRow) {
-		    alkPtr += startRow-rowkTop; // pointer to start of block row
-		    maxRowikTop = startRow;
-		  } else
-		    maxRowikTop = rowkTop;
-
-		  for (int l=maxRowikTop; l<=lastRow; l++) {
-		    double tmp = *alkPtr;
-		    int rowlTop = RowTop[l];
-		    int maxRowklTop;
-		    double *amlPtr, *amkPtr;
-		    if (rowlTop < rowkTop) {
-		      amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
-		      amkPtr = topRowPtr[currentCol];
-		      maxRowklTop = rowkTop;
-		    } else {
-		      amlPtr = topRowPtr[l];
-		      amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
-		      maxRowklTop = rowlTop;
-		    } 
-
-		    for (int m = maxRowklTop; m<l; m++) 
-		      tmp -= *amkPtr++ * *amlPtr++;
-		  
-		    *alkPtr++ = tmp;
-		  }
-		  currentCol++;
-		  if (currentCol > lastColEffected) {
-		    k = blockSize;
-		    j = nBlck;
-		  }
-		  
-		} else
-		  k = blockSize;
-	      }
-	    } else
-	      currentCol += blockSize;
-	  
-	  }
-
-	}
-
-	// update the data for the next block
-	startRow += blockSize;
-	lastRow = startRow + blockSize -1;
-	lastColEffected = lastRow + maxColHeight -1;
-      }
-
-      // signal the XC::main thread that this thread is done with the work
-      mutex_lock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-         TCB_ProfileSPDDirectThreadSolver.threadsDone++;
+  }
 
-         cond_signal(&TCB_ProfileSPDDirectThreadSolver.end_cond);
-      mutex_unlock(&TCB_ProfileSPDDirectThreadSolver.end_mutex);
-    } 
-}
+int XC::ProfileSPDLinDirectThreadSolver::recvSelf(const Communicator &comm)
+  { return 0; }
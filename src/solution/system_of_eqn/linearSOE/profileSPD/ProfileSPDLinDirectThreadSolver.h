@@ -59,7 +59,7 @@
 // Description: This file contains the class definition for 
 // ProfileSPDLinDirectThreadSolver. ProfileSPDLinDirectThreadSolver is a subclass 
 // of LinearSOESOlver. It solves a ProfileSPDLinSOE object using
-// the LDL^t factorization.
+// the LDL^t factorization (threaded version).
 
 // What: "@(#) ProfileSPDLinDirectThreadSolver.h, revA"
 
@@ -79,26 +79,33 @@ class ProfileSPDLinSOE;
 //! A ProfileSPDLinDirectThreadSolver object can be constructed to
 //! solve a ProfileSPDLinSOE object. It does this in parallel using
 //! threads by direct means, using the \f$LDL^t\f$ variation of the cholesky
-//! factorization. The matrx \f$A\f$ is factored one row block at a time using
-//! a left-looking approach. Within a row block the factorization is
-//! performed by \f$NP\f$ threads. No BLAS or LAPACK routines are called 
+//! factorization. The matrx \f$A\f$ is factored one column block at a time
+//! using a left-looking approach. The diagonal block is factored by one
+//! thread, then the rest of the block row is computed by \f$NP\f$
+//! threads (see ColumnBlockLDLt). No BLAS or LAPACK routines are called 
 //! for the factorization or subsequent substitution.
 class ProfileSPDLinDirectThreadSolver: public ProfileSPDLinDirectBase
   {
   protected:
-    int NP;
-    int running;
-    
-    int blockSize;
-    int maxColHeight;
+    int numThreads; //!< number of threads.
+    int blockSize; //!< number of columns of each block.
+    int maxColHeight; //!< maximum height of the columns.
 
-    ProfileSPDLinDirectThreadSolver();      
-    ProfileSPDLinDirectThreadSolver(int numProcessors, int blockSize, double tol);    
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    ProfileSPDLinDirectThreadSolver(void);
+    ProfileSPDLinDirectThreadSolver(int numThreads, int blockSize, double tol);    
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     virtual int solve(void);        
     virtual int setSize(void);    
+    double getDeterminant(void);
+
+    int getNumThreads(void) const;
+    void setNumThreads(const int &);
+    int getBlockSize(void) const;
+    void setBlockSize(const int &);
 
     virtual int setProfileSOE(ProfileSPDLinSOE &theSOE);
 
@@ -106,6 +113,9 @@ class ProfileSPDLinDirectThreadSolver: public ProfileSPDLinDirectBase
     int recvSelf(const Communicator &);
   };
 
+//! @brief Virtual constructor.
+inline LinearSOESolver *ProfileSPDLinDirectThreadSolver::getCopy(void) const
+   { return new ProfileSPDLinDirectThreadSolver(*this); }
 } // end of XC namespace
 
 
@@ -58,8 +58,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 
@@ -174,31 +173,17 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
     // now we go through the vertices to find the height of each col and
     // width of each row from the connectivity information.
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-
-    while ((vertexPtr = theVertices()) != 0)
-      {
-        int vertexNum = vertexPtr->getTag();
-        const std::set<int> &theAdjacency = vertexPtr->getAdjacency();
-        int iiDiagLoc = iDiagLoc(vertexNum);
-        int *iiDiagLocPtr = &(iDiagLoc(vertexNum));
-
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-          {
-            const int otherNum= *i;
-            const int diff= vertexNum-otherNum;
-            if(diff > 0)
-              {
-                if(iiDiagLoc < diff)
-                  {
-                    iiDiagLoc = diff;
-                    *iiDiagLocPtr = diff;
-                  }
-              } 
-          }
-      }
-
+    // the adjacency is sorted so the height of the column is given
+    // by the first adjacent vertex.
+    const CSRGraph &g= theGraph.getCSR();
+    const int numVertex= g.getNumVertex();
+    for(int vertexNum= 0; vertexNum<numVertex; vertexNum++)
+      if(g.getDegree(vertexNum)>0)
+        {
+          const int diff= vertexNum-*g.begin(vertexNum);
+          if(diff > 0)
+            iDiagLoc(vertexNum)= diff;
+        }
 
     // now go through iDiagLoc, adding 1 for the diagonal element
     // and then adding previous entry to give current location.
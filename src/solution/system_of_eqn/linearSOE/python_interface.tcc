@@ -22,16 +22,19 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-  .def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'umfpack_gen_lin_solver', 'mumps_solver'" )
+  .def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'full_gen_lin_substr_thread_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'profile_spd_lin_direct_thread_solver', 'band_spd_lin_thread_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'umfpack_gen_lin_solver', 'eigen_sparse_spd_lin_solver', 'pcg_lin_solver', 'minres_lin_solver', 'mumps_solver'" )
   .add_property("numEqn", &XC::LinearSOE::getNumEqn, "Return the number of equations.")
   .add_property("b", make_function(&XC::LinearSOE::getB, return_internal_reference<>() ), "Return the rigth hand side of the equation.")
   .add_property("x", make_function(&XC::LinearSOE::getX, return_internal_reference<>() ), "Return the vector of unknowns.")
   .add_property("solver", make_function(&XC::LinearSOE::getSolver, return_internal_reference<>() ), "Return a pointer to the solver.")
+  .def("solveMultipleRHS", &XC::LinearSOE::getMultipleRHSSolution, "solveMultipleRHS(B): return the solutions of the system for each of the columns of matrix B (the factorization of A is reused when the solver allows it).")
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
 
-class_<XC::FactoredSOEBase, bases<XC::LinearSOEData>, boost::noncopyable >("FactoredSOEBase", no_init);
+class_<XC::FactoredSOEBase, bases<XC::LinearSOEData>, boost::noncopyable >("FactoredSOEBase", no_init)
+  .add_property("factored", &XC::FactoredSOEBase::getFactored, &XC::FactoredSOEBase::setFactored, "True if the system matrix is factored.")
+  ;
 
 class_<XC::BandGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("BandGenLinSOE", no_init)
     ;
@@ -103,6 +106,17 @@ class_<XC::SymSparseLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SymS
 class_<XC::UmfpackGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("UmfpackGenLinSOE", no_init)
   ;
 
+#ifdef USE_EIGEN
+class_<XC::EigenSparseSPDLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("EigenSparseSPDLinSOE", no_init)
+  .add_property("numNonZeros", &XC::EigenSparseSPDLinSOE::getNumNonZeros, "Return the number of non-zero coefficients stored (lower triangle of A).")
+  .add_property("patternChanged", &XC::EigenSparseSPDLinSOE::getPatternChanged, "Return true if the sparsity pattern has changed since the last symbolic analysis.")
+  ;
+#endif
+
+class_<XC::CsrSPDLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("CsrSPDLinSOE", no_init)
+  .add_property("numNonZeros", &XC::CsrSPDLinSOE::getNumNonZeros, "Return the number of non-zero coefficients stored (both triangles of A).")
+  ;
+
 class_<XC::MumpsSOE, bases<XC::SparseGenSOEBase>, boost::noncopyable >("MumpsSOE", no_init)
   ;
 class_<XC::MumpsParallelSOE, bases<XC::MumpsSOE>, boost::noncopyable >("MumpsParallelSOE", no_init)
@@ -119,7 +133,10 @@ class_<XC::BandSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("B
 
 class_<XC::BandSPDLinLapackSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinLapackSolver", no_init);
 
-// class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init);
+class_<XC::BandSPDLinThreadSolver, bases<XC::BandSPDLinSolver>, boost::noncopyable >("BandSPDLinThreadSolver", no_init)
+  .add_property("numThreads", &XC::BandSPDLinThreadSolver::getNumThreads, &XC::BandSPDLinThreadSolver::setNumThreads, "Get/set the number of threads used in the factorization.")
+  .add_property("blockSize", &XC::BandSPDLinThreadSolver::getBlockSize, &XC::BandSPDLinThreadSolver::setBlockSize, "Get/set the number of columns of each block.")
+  ;
 
 class_<XC::ConjugateGradientSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ConjugateGradientSolver", no_init);
 
@@ -133,6 +150,10 @@ class_<XC::FullGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("F
 
 class_<XC::FullGenLinLapackSolver, bases<XC::FullGenLinSolver>, boost::noncopyable >("FullGenLinLapackSolver", no_init);
 
+class_<XC::FullGenLinSubstrThreadSolver, bases<XC::FullGenLinSolver>, boost::noncopyable >("FullGenLinSubstrThreadSolver", no_init)
+  .add_property("numPartitions", &XC::FullGenLinSubstrThreadSolver::getNumPartitions, &XC::FullGenLinSubstrThreadSolver::setNumPartitions, "Get/set the number of partitions of the system of equations (each one is condensed by its own thread).")
+  ;
+
 // class_<XC::ItPackLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ItPackLinSolver", no_init);
 
 class_<XC::ProfileSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("ProfileSPDLinSolver", no_init);
@@ -143,7 +164,10 @@ class_<XC::ProfileSPDLinDirectBlockSolver, bases<XC::ProfileSPDLinDirectBase>, b
 
 class_<XC::ProfileSPDLinDirectSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectSolver", no_init);
 
-// class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init);
+class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init)
+  .add_property("numThreads", &XC::ProfileSPDLinDirectThreadSolver::getNumThreads, &XC::ProfileSPDLinDirectThreadSolver::setNumThreads, "Get/set the number of threads used in the factorization.")
+  .add_property("blockSize", &XC::ProfileSPDLinDirectThreadSolver::getBlockSize, &XC::ProfileSPDLinDirectThreadSolver::setBlockSize, "Get/set the number of columns of each block.")
+  ;
 
 class_<XC::ProfileSPDLinSubstrSolver, bases<XC::ProfileSPDLinDirectBase,XC::DomainSolver>, boost::noncopyable >("ProfileSPDLinSubstrSolver", no_init);
 
@@ -162,6 +186,36 @@ class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >(
 class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init)
   ;
 
+#ifdef USE_EIGEN
+class_<XC::EigenSparseSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("EigenSparseSPDLinSolver", no_init)
+  .add_property("numSymbolicAnalysis", &XC::EigenSparseSPDLinSolver::getNumSymbolicAnalysis, "Return the number of symbolic analysis (ordering and elimination tree) computed.")
+  .add_property("numFactorizations", &XC::EigenSparseSPDLinSolver::getNumFactorizations, "Return the number of numeric factorizations computed.")
+  ;
+#endif
+
+class_<XC::KrylovLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("KrylovLinSolver", no_init)
+  .def("setPreconditioner", &XC::KrylovLinSolver::setPreconditioner, "setPreconditioner(type): set the preconditioner. Available types: 'jacobi', 'incomplete_cholesky', 'smoothed_aggregation_amg' and 'none'.")
+  .add_property("preconditionerType", &XC::KrylovLinSolver::getPreconditionerType, &XC::KrylovLinSolver::setPreconditioner, "Get/set the type of the preconditioner.")
+  .add_property("relativeTolerance", &XC::KrylovLinSolver::getRelativeTolerance, &XC::KrylovLinSolver::setRelativeTolerance, "Get/set the tolerance for the norm of the residual relative to the norm of the right hand side.")
+  .add_property("absoluteTolerance", &XC::KrylovLinSolver::getAbsoluteTolerance, &XC::KrylovLinSolver::setAbsoluteTolerance, "Get/set the tolerance for the norm of the residual.")
+  .add_property("maxNumIterations", &XC::KrylovLinSolver::getMaxNumIterations, &XC::KrylovLinSolver::setMaxNumIterations, "Get/set the maximum number of iterations (if not positive the number of equations is used).")
+  .add_property("warmStart", &XC::KrylovLinSolver::getWarmStart, &XC::KrylovLinSolver::setWarmStart, "Get/set the warm start flag; if true the iteration starts from the previous solution (i.e. the previous Newton increment).")
+  .add_property("numSolves", &XC::KrylovLinSolver::getNumSolves, "Return the number of systems solved.")
+  .add_property("numIterations", &XC::KrylovLinSolver::getNumIterations, "Return the number of iterations of the last solution.")
+  .add_property("totalNumIterations", &XC::KrylovLinSolver::getTotalNumIterations, "Return the sum of the iterations of all the solutions.")
+  .add_property("averageNumIterations", &XC::KrylovLinSolver::getAverageNumIterations, "Return the average number of iterations per solution.")
+  .add_property("numPreconditionerSetups", &XC::KrylovLinSolver::getNumPreconditionerSetups, "Return the number of times the preconditioner has been computed.")
+  .add_property("numFailures", &XC::KrylovLinSolver::getNumFailures, "Return the number of solutions that have not converged.")
+  .add_property("residualNorm", &XC::KrylovLinSolver::getResidualNorm, "Return the norm of the residual of the last solution.")
+  .def("resetStatistics", &XC::KrylovLinSolver::resetStatistics, "Reset the solution statistics.")
+  ;
+
+class_<XC::PCGLinSolver, bases<XC::KrylovLinSolver>, boost::noncopyable >("PCGLinSolver", no_init)
+  ;
+
+class_<XC::MINRESLinSolver, bases<XC::KrylovLinSolver>, boost::noncopyable >("MINRESLinSolver", no_init)
+  ;
+
 class_<XC::MumpsSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("MumpsSolver", no_init)
   ;
 
@@ -60,8 +60,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 //! @brief Constructor.
@@ -127,15 +126,18 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
     int result = 0;
     size= checkSize(theGraph);
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex= nullptr;
-    int newNNZ= 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while((theVertex = theVertices()) != nullptr)
+    // the number of non-zeros is given by the compressed adjacency
+    // of the graph (plus the diagonal).
+    const CSRGraph &g= theGraph.getCSR();
+    if(g.getNumVertex() != size)
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING : graph vertices not numbered"
+                  << " from 0 to " << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
+    const int newNNZ= g.getNumEntriesWithDiagonal();
     nnz = newNNZ;
 
     if(newNNZ > A.Size())
@@ -144,6 +146,7 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
         rowA.resize(newNNZ);
       }
     A.Zero();
+    scatterMap.clear(); // A storage has changed.
 	
     factored= false;
     
@@ -154,50 +157,15 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 	colStartA.resize(size+1);	
       }
 
-    // fill in colStartA and rowA
+    // fill in colStartA and rowA (the adjacency is already sorted).
     if(size != 0)
       {
         colStartA(0)= 0;
-        int startLoc = 0;
         int lastLoc = 0;
         for(int a=0;a<size;a++)
           {
-            theVertex = theGraph.getVertexPtr(a);
-	    if(theVertex == nullptr)
-              {
-	        std::cerr << getClassName() << "::" << __FUNCTION__
-			  << "; WARNING :"
-			  << " vertex " << a
-			  << " not in graph! - size set to 0.\n";
-	        size = 0;
-	        return -1;
-	      }
-            rowA(lastLoc++) = theVertex->getTag(); // place diag in first
-	    const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	    // now we have to place the entries in the ID into order in rowA
-            for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-              {
-                int row = *i;
-	        bool foundPlace = false;
-	        // find a place in rowA for current col
-	        for(int j=startLoc; j<lastLoc; j++)
-	          if(rowA(j) > row)
-                    { 
-	              // move the entries already there one further on
-	              // and place col in current location
-	              for(int k=lastLoc; k>j; k--)
-			rowA(k) = rowA(k-1);
-	              rowA(j) = row;
-	              foundPlace = true;
-	              j = lastLoc;
-	            }
-	        if(!foundPlace) // put in at the end
-	          rowA(lastLoc)= row;
-                lastLoc++;
-	      }
-	    colStartA(a+1)= lastLoc;;	    
-	    startLoc = lastLoc;
+            lastLoc+= g.copyWithDiagonal(a, rowA.getDataPtr()+lastLoc);
+	    colStartA(a+1)= lastLoc;
           }
       }
     // invoke setSize() on the Solver    
@@ -213,6 +181,43 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Compute the locations in A of the coefficients that
+//! correspond to the equation numbers being passed as parameter.
+//!
+//! The location of each coefficient is searched in the
+//! column using \f$rowA\f$. This is done once for each ID (normally
+//! one for each FE_Element) after the storage of A is set, the
+//! results are kept in the scatter map.
+const XC::ScatterMap::location_vector &XC::SparseGenColLinSOE::compute_locations(const ID &id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(id);
+    const int idSize= id.Size();
+    for(int j=0; j<idSize; j++)
+      {
+	const int col= id(j);
+	if(col < size && col >= 0)
+	  {
+	    const int startColLoc= colStartA(col);
+	    const int endColLoc= colStartA(col+1);
+	    for(int i=0; i<idSize; i++)
+	      {
+		const int row= id(i);
+		if(row <size && row >= 0)
+		  {
+		    // find place in A using rowA
+		    for(int k=startColLoc; k<endColLoc; k++)
+		      if(rowA(k) == row)
+			{
+			  retval[j*idSize+i]= k;
+			  break;
+			}
+		  }
+	      } // for i
+	  }
+      } // for j
+    return retval;
+  }
+
 //! @brief Assemblies the product fact*m into the system matrix.
 //!
 //! First tests that \p loc and \p M are of compatible sizes; if not
@@ -222,8 +227,9 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 //! locations given by the ID object \p loc, i.e. \f$a_{loc(i),loc(j)} +=
 //! fact * M(i,j)\f$. If the location specified is outside the range,
 //! i.e. \f$(-1,-1)\f$ the corrseponding entry in \p M is not added to
-//! \f$A\f$. If \p fact is equal to \f$0.0\f$ or \f$1.0\f$, more efficient steps
-//! are performed. Returns \f$0\f$.
+//! \f$A\f$. The positions in \f$A\f$ of the coefficients are computed
+//! the first time the ID is assembled and then reused until the
+//! size of the system changes. Returns \f$0\f$.
 int XC::SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
   {
     // check for a quick return 
@@ -233,67 +239,17 @@ int XC::SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
     const int idSize = id.Size();
     
     // check that m and id are of similar size
-    if(idSize != m.noRows() && idSize != m.noCols())
+    if(idSize != m.noRows() || idSize != m.noCols())
       {
 	std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; Matrix and ID not of similar sizes\n";
 	return -1;
       }
-    
-    if(fact == 1.0)
-      { // do not need to multiply 
-	for(int i=0; i<idSize; i++)
-	  {
-	    const int col= id(i);
-	    if(col < size && col >= 0)
-	      {
-		const int startColLoc= colStartA(col);
-		const int endColLoc= colStartA(col+1);
-		for(int j=0; j<idSize; j++)
-		  {
-		    const int row= id(j);
-		    if(row <size && row >= 0)
-		      {
-			// find place in A using rowA
-			for(int k=startColLoc; k<endColLoc; k++)
-			  {
-			    if(rowA(k) == row)
-			      {
-			        A[k]+= m(j,i);
-			        break; //k = endColLoc;
-			      }
-			  }
-		      }
-		  }  // for j		
-	      } 
-	  } // for i
-      }
-    else
-      {
-	for(int i=0; i<idSize; i++)
-	  {
-	    const int col = id(i);
-	    if(col < size && col >= 0)
-	      {
-		const int startColLoc = colStartA(col);
-		const int endColLoc = colStartA(col+1);
-		for(int j=0; j<idSize; j++)
-		  {
-		    const int row = id(j);
-		    if(row <size && row >= 0)
-		      {
-			// find place in A using rowA
-			for(int k= startColLoc; k<endColLoc; k++)
-			  if(rowA(k) == row)
-			    {
-			      A[k]+= fact * m(j,i);
-			      break; //k= endColLoc;
-			    }
-		      }
-		  }  // for j
-	      } 
-	  }  // for i
-      }
+
+    const ScatterMap::location_vector *locations= scatterMap.find(id);
+    if(!locations)
+      locations= &compute_locations(id);
+    ScatterMap::scatter(*locations, m, fact, A.getDataPtr());
     return 0;
   }
 
@@ -137,6 +137,8 @@ class SparseGenColLinSOE: public SparseGenSOEBase
   protected:
     ID rowA;
     ID colStartA; //!< int arrays containing info about coeficientss in A
+
+    const ScatterMap::location_vector &compute_locations(const ID &);
   protected:
     virtual bool setSolver(LinearSOESolver *);
 
@@ -58,8 +58,7 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 //! @brief Constructor.
@@ -87,15 +86,18 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
     int result = 0;
     size= checkSize(theGraph);
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0)
+    // the number of non-zeros is given by the compressed adjacency
+    // of the graph (plus the diagonal).
+    const CSRGraph &g= theGraph.getCSR();
+    if(g.getNumVertex() != size)
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING: graph vertices not numbered"
+                  << " from 0 to " << size-1 << " - size set to 0.\n";
+        size= 0;
+        return -1;
       }
+    const int newNNZ= g.getNumEntriesWithDiagonal();
     nnz = newNNZ;
 
     if(newNNZ > A.Size())
@@ -104,6 +106,7 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
 	colA.resize(newNNZ);
       }
     A.Zero();
+    scatterMap.clear(); // A storage has changed.
 	
     factored = false;
     
@@ -113,52 +116,15 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
 	rowStartA.resize(size+1); 
       }
 
-    // fill in rowStartA and colA
+    // fill in rowStartA and colA (the adjacency is already sorted).
     if(size != 0)
       {
         rowStartA(0) = 0;
-        int startLoc = 0;
         int lastLoc = 0;
         for(int a=0; a<size; a++)
           {
-            theVertex = theGraph.getVertexPtr(a);
-	    if(!theVertex)
-	      {
-		std::cerr << getClassName() << "::" << __FUNCTION__
-			  << "WARNING: vertex " << a
-			  << " not in graph! - size set to 0\n";
-		size = 0;
-		return -1;
-	      }
-
-  	    colA(lastLoc++) = theVertex->getTag(); // place diag in first
-	    const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	    // now we have to place the entries in the XC::ID into order in colA
-	    for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-	      {
-		const int row= *i;
-		bool foundPlace = false;
-		// find a place in colA for current col
-		for (int j=startLoc; j<lastLoc; j++)
-		  if (colA(j) > row)
-		    { 
-		    // move the entries already there one further on
-		    // and place col in current location
-		    for (int k=lastLoc; k>j; k--)
-
-		      colA(k) = colA(k-1);
-		    colA(j) = row;
-		    foundPlace = true;
-		    j = lastLoc;
-		    }
-		if(foundPlace == false) // put in at the end
-		  colA(lastLoc) = row;
-
-		lastLoc++;
-	      }
-		rowStartA(a+1)= lastLoc;;	    
-		startLoc = lastLoc;
+            lastLoc+= g.copyWithDiagonal(a, colA.getDataPtr()+lastLoc);
+	    rowStartA(a+1)= lastLoc;
 	  }
       }
     
@@ -174,63 +140,70 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Compute the locations in A of the coefficients that
+//! correspond to the equation numbers being passed as parameter.
+//!
+//! The location of each coefficient is searched in the
+//! row using \f$colA\f$. This is done once for each ID (normally
+//! one for each FE_Element) after the storage of A is set, the
+//! results are kept in the scatter map.
+const XC::ScatterMap::location_vector &XC::SparseGenRowLinSOE::compute_locations(const ID &id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(id);
+    const int idSize= id.Size();
+    for(int i=0; i<idSize; i++)
+      {
+	const int row= id(i);
+	if(row < size && row >= 0)
+	  {
+	    const int startRowLoc= rowStartA(row);
+	    const int endRowLoc= rowStartA(row+1);
+	    for(int j=0; j<idSize; j++)
+	      {
+		const int col= id(j);
+		if(col <size && col >= 0)
+		  {
+		    // find place in A using colA
+		    for(int k=startRowLoc; k<endRowLoc; k++)
+		      if(colA(k) == col)
+			{
+			  retval[j*idSize+i]= k;
+			  break;
+			}
+		  }
+	      } // for j
+	  }
+      } // for i
+    return retval;
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! The positions in \f$A\f$ of the coefficients are computed
+//! the first time the ID is assembled and then reused until the
+//! size of the system changes.
 int XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
-{
+  {
     // check for a quick return 
-    if (fact == 0.0)  
-	return 0;
+    if(fact == 0.0)  
+      return 0;
 
-    int idSize = id.Size();
+    const int idSize = id.Size();
     
     // check that m and id are of similar size
-    if(idSize != m.noRows() && idSize != m.noCols())
+    if(idSize != m.noRows() || idSize != m.noCols())
       {
 	std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; Matrix and ID not of similar sizes\n";
 	return -1;
       }
-    
-    if (fact == 1.0) { // do not need to multiply 
-	for (int i=0; i<idSize; i++) {
-	    int row = id(i);
-	    if (row < size && row >= 0) {
-	      int startRowLoc = rowStartA(row);
-	      int endRowLoc = rowStartA(row+1);
-		for (int j=0; j<idSize; j++) {
-		    int col = id(j);
-		    if (col <size && col >= 0) {
-			// find place in A using colA
-			for (int k=startRowLoc; k<endRowLoc; k++)
-			  if (colA(k) == col) {
-				A[k] += m(i,j);
-				k = endRowLoc;
-			    }
-		     }
-		}  // for j		
-	    } 
-	}  // for i
-    } else {
-	for (int i=0; i<idSize; i++) {
-	    int row = id(i);
-	    if (row < size && row >= 0) {
-	      int startRowLoc = rowStartA(row);
-	      int endRowLoc = rowStartA(row+1);
-		for (int j=0; j<idSize; j++) {
-		    int col = id(j);
-		    if (col <size && col >= 0) {
-			// find place in A using colA
-			for (int k=startRowLoc; k<endRowLoc; k++)
-			  if (colA(k) == col) {
-				A[k] += fact * m(i,j);
-				k = endRowLoc;
-			    }
-		     }
-		}  // for j		
-	    } 
-	}  // for i
-    }
+
+    const ScatterMap::location_vector *locations= scatterMap.find(id);
+    if(!locations)
+      locations= &compute_locations(id);
+    ScatterMap::scatter(*locations, m, fact, A.getDataPtr());
     return 0;
-}
+  }
 
     
 int XC::SparseGenRowLinSOE::sendSelf(Communicator &comm)
@@ -76,6 +76,8 @@ class SparseGenRowLinSOE: public SparseGenSOEBase
   private:
     ID colA;
     ID rowStartA; //!< int arrays containing info about coeficientss in A
+
+    const ScatterMap::location_vector &compute_locations(const ID &);
   protected:
     virtual bool setSolver(LinearSOESolver *);
 
@@ -49,9 +49,9 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
+#include <algorithm>
 
 
 XC::SymSparseLinSOE::SymSparseLinSOE(SolutionStrategy *owr,int lSparse)
@@ -75,27 +75,21 @@ bool XC::SymSparseLinSOE::setSolver(LinearSOESolver *newSolver)
   }
 
 /* A destructor for cleanning memory.
- * For diag and penv, it is rather straightforward to clean.
- * For row segments, since the memory of nz is allocated for each
- * row, the deallocated needs some special care.
+ * The diagonal, the diagonal blocks (penv) and the row segments (nz)
+ * share the memory block that begins at diag (see symFactorization).
  */
 XC::SymSparseLinSOE::~SymSparseLinSOE(void)
   {
-    // free the diagonal vector
+    // free the diagonal, the diagonal blocks and the row segments.
     if(diag != nullptr) free(diag);
 
-    // free the diagonal blocks
+    // free the pointers to the diagonal blocks
     if(penv != nullptr)
-      {
-	if(penv[0] != nullptr)
-          { free(penv[0]); }
-        free(penv);
-      }
+      free(penv);
 
-    // free the row segments.
+    // free the row segments descriptors.
     OFFDBLK *blkPtr = first;
     OFFDBLK *tempBlk;
-    int curRow = -1;
 
     while(1)
       {
@@ -107,12 +101,6 @@ XC::SymSparseLinSOE::~SymSparseLinSOE(void)
           }
 
         tempBlk = blkPtr->next;
-        if(blkPtr->row != curRow)
-          {
-	    if(blkPtr->nz != nullptr)
-              { free(blkPtr->nz); }
-            curRow = blkPtr->row;
-          }
         free(blkPtr);
         blkPtr = tempBlk;
       }
@@ -134,15 +122,18 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
     int result = 0;
     size= checkSize(theGraph);
 
-    // first iterarte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while((theVertex = theVertices()) != 0)
+    // the number of non-zeros is given by the compressed adjacency
+    // of the graph.
+    const CSRGraph &g= theGraph.getCSR();
+    if(g.getNumVertex() != size)
       {
-        const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.size(); 
+        std::cerr << "WARNING:XC::SymSparseLinSOE::setSize :";
+        std::cerr << " graph vertices not numbered from 0 to "
+                  << size-1 << " - size set to 0\n";
+        size = 0;
+        return -1;
       }
+    const int newNNZ = g.getAdjacency().size();
     nnz = newNNZ;
  
     colA= ID(newNNZ);	
@@ -163,204 +154,127 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
 	rowStartA= ID(size+1); 
       }
 
-    // fill in rowStartA and colA
+    // fill in rowStartA and colA (the adjacency is already sorted).
     if(size != 0)
       {
-        rowStartA(0) = 0;
-        int startLoc = 0;
-	int lastLoc = 0;
-
-	for (int a=0; a<size; a++) {
-	   theVertex = theGraph.getVertexPtr(a);
-	   if(theVertex == 0) {
-	        std::cerr << "WARNING:XC::SymSparseLinSOE::setSize :";
-	        std::cerr << " vertex " << a << " not in graph! - size set to 0\n";
-	        size = 0;
-	        return -1;
-	   }
-
-	   const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	
-	// now we have to place the entries in the ID into order in colA
-           for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-  	     {
-	      const int row= *i;
-	      bool foundPlace = false;
-	 
-	      for (int j=startLoc; j<lastLoc; j++)
-		if(colA(j) > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	              for (int k=lastLoc; k>j; k--)
-			colA(k)= colA(k-1);
-                      colA(j) = row;
-		      foundPlace = true;
-    	              j = lastLoc;
-		  }
-		  
-	      if(foundPlace == false) // put in at the end
-		colA(lastLoc) = row;
-
-	      lastLoc++;
-	   }
-	   rowStartA(a+1)= lastLoc;	    
-	   startLoc = lastLoc;
-	}
-    }
+        const CSRGraph::int_vector &rowStart= g.getRowStart();
+        const CSRGraph::int_vector &adjacency= g.getAdjacency();
+        for(int a=0; a<=size; a++)
+          rowStartA(a)= rowStart[a];
+        for(int k=0; k<newNNZ; k++)
+          colA(k)= adjacency[k];
+      }
     
     // call "C" function to form elimination tree and to do the symbolic factorization.
     nblks = symFactorization(rowStartA.getDataPtr(), colA.getDataPtr(), size, this->LSPARSE,
 			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+    scatterMap.clear(); // storage of A has changed.
 
     return result;
 }
 
 
-/* Perform the element stiffness assembly here.
- */
-int XC::SymSparseLinSOE::addA(const XC::Matrix &in_m, const XC::ID &in_id, double fact)
-{
-   // check for a quick return
-   if(fact == 0.0)  
-       return 0;
-
-   int idSize = in_id.Size();
-   if(idSize == 0)  return 0;
-
-   // check that m and id are of similar size
-   if(idSize != in_m.noRows() && idSize != in_m.noCols()) {
-       std::cerr << "XC::SymSparseLinSOE::addA() ";
-       std::cerr << " - Matrix and XC::ID not of similar sizes\n";
-       return -1;
-   }
-
-   // construct m and id based on non-negative id values.
-   int newPt = 0;
-   std::vector<int> id(idSize);
-   
-   for(int jj = 0; jj < idSize; jj++)
+//! @brief Compute the locations in the factor storage (diag, penv and
+//! row segments) of the coefficients that correspond to the
+//! equation numbers being passed as parameter.
+//!
+//! The three of them share the memory block that begins at diag, so
+//! the locations are stored as offsets from diag. Only the
+//! coefficients of the lower triangle of A are stored, so for each
+//! pair of equations only the location of the (i,j) entry of the
+//! local matrix with i<j is set (the (j,i) location is -1).
+const XC::ScatterMap::location_vector &XC::SymSparseLinSOE::compute_locations(const ID &in_id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(in_id);
+    const int in_idSize= in_id.Size();
+
+    // positions (in in_id) of the equations of the system and
+    // equation numbers after the reordering (invp).
+    std::vector<int> pos, newID;
+    pos.reserve(in_idSize);
+    newID.reserve(in_idSize);
+    for(int jj= 0; jj<in_idSize; jj++)
       {
-       if(in_id(jj) >= 0 && in_id(jj) < size) {
-	   id[newPt] = in_id(jj);
-	   newPt++;
-       }
-   }
-
-   idSize = newPt;
-   if(idSize == 0)  return 0;
-   std::vector<double> m(idSize*idSize);
-
-   int newII = 0;
-   for (int ii = 0; ii < in_id.Size(); ii++) {
-       if(in_id(ii) >= 0 && in_id(ii) < size) {
-
-	   int newJJ = 0;
-	   for (int jj = 0; jj < in_id.Size(); jj++) {
-	       if(in_id(jj) >= 0 && in_id(jj) < size) {
-		   m[newII*idSize + newJJ] = in_m(ii, jj);
-		   newJJ++;
-	       }
-	   }
-	   newII++;
-       }
-   }
-
-   // forming the new_ id based on invp.
-
-   std::vector<int> newID(idSize);
-   std::vector<int> isort(idSize);
-
-   for (int kk=0; kk<idSize; kk++) {
-       newID[kk] = id[kk];
-       if(newID[kk] >= 0)
-	   newID[kk] = invp[newID[kk]];
-   }
-   
-   long int  i_eq, j_eq;
-   int  i, j, nee, lnee;
-   int  k, ipos, jpos;
-   int  it, jt;
-   int  iblk;
-   OFFDBLK  *ptr;
-   OFFDBLK  *saveblk;
-   double  *fpt, *iloc, *loc;
-
-   nee = idSize;
-   lnee = nee;
-   
-   /* initialize isort */
-   for( i = 0, k = 0; i < lnee ; i++ )
-   {
-       if( newID[i] >= 0 ) {
-	   isort[k] = i;
-	   k++;
-       }
-   }
-      
-   lnee = k;
-
-   /* perform the sorting of isort here */
-   i = k - 1;
-   do
-   {
-       k = 0 ;
-       for (j = 0 ; j < i ; j++)
-       {  
-	   if( newID[isort[j]] > newID[isort[j+1]]) {  
-	       isort[j] ^= isort[j+1] ;
-	       isort[j+1] ^= isort[j] ;
-	       isort[j] ^= isort[j+1] ;
-	       k = j ;
-	   }
+	const int eq= in_id(jj);
+	if(eq >= 0 && eq < size)
+	  {
+	    pos.push_back(jj);
+	    newID.push_back(invp[eq]);
+	  }
       }
-      i = k ;
-   }  while ( k > 0) ;
+    const int lnee= pos.size();
+    if(lnee == 0)
+      return retval;
 
-      i = 0 ;
-      ipos = isort[i] ;
-      k = rowblks[newID[ipos]] ;
-      saveblk  = begblk[k] ;
+    // sort by new equation number.
+    std::vector<int> isort(lnee);
+    for(int i= 0; i<lnee; i++)
+      isort[i]= i;
+    std::stable_sort(isort.begin(), isort.end(), [&newID](const int &a, const int &b) { return newID[a]<newID[b]; });
 
-      /* iterate through the element stiffness matrix, assemble each entry */
-      for (i=0; i<lnee; i++)
-      { 
-	 ipos = isort[i] ;
-         i_eq = newID[ipos] ;
-	 iblk = rowblks[i_eq] ;
-	 iloc = penv[i_eq +1] - i_eq ;
-	 if(k < iblk)
-	    while (saveblk->row != i_eq) saveblk = saveblk->bnext ;
-	 
-	 ptr = saveblk ;
-	 for (j=0; j< i ; j++)
-	 {   
-	    jpos = isort[j] ;
-	    j_eq = newID[jpos] ;
-
-	    if(ipos > jpos) {
-	        jt = ipos;
-		it = jpos;
-	    } else {
-	        it = ipos;
-		jt = jpos;
-	    }
+    const int k= rowblks[newID[isort[0]]];
+    OFFDBLK *saveblk= begblk[k];
 
+    // iterate through the element stiffness matrix, locate each entry.
+    for(int i= 0; i<lnee; i++)
+      { 
+	const int ipos= isort[i];
+	const int i_eq= newID[ipos];
+	const int iblk= rowblks[i_eq];
+	double *iloc= penv[i_eq +1] - i_eq;
+	if(k < iblk)
+	  while(saveblk->row != i_eq) saveblk= saveblk->bnext;
+
+	OFFDBLK *ptr= saveblk;
+	for(int j= 0; j< i; j++)
+	  {   
+	    const int jpos= isort[j];
+	    const int j_eq= newID[jpos];
+	    const int it= std::min(ipos, jpos);
+	    const int jt= std::max(ipos, jpos);
+
+	    double *loc= nullptr;
 	    if(j_eq >= xblk[iblk]) /* diagonal block (profile) */
-	    {  
-	        loc = iloc + j_eq ;
-		*loc += m[it*idSize + jt] * fact;
-            } 
+	      loc= iloc + j_eq;
 	    else /* row segment */
-	    { 
-	        while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
-		    ptr = ptr->next ;
-		fpt = ptr->nz ;
-		fpt[j_eq - ptr->beg] += m[it*idSize + jt] * fact;
-            }
-         }
-	 diag[i_eq] += m[ipos*idSize + ipos] * fact; /* diagonal element */
+	      { 
+		while((j_eq >= (ptr->next)->beg) && ((ptr->next)->row == i_eq))
+		  ptr= ptr->next;
+		loc= ptr->nz + (j_eq - ptr->beg);
+	      }
+	    retval[pos[jt]*in_idSize+pos[it]]= loc-diag; // entry (it, jt)
+	  }
+	retval[pos[ipos]*in_idSize+pos[ipos]]= i_eq; /* diagonal element */
       }
-  	  
+    return retval;
+  }
+
+//! @brief Perform the element stiffness assembly here.
+//!
+//! The locations of the coefficients are computed the first time the
+//! ID is assembled and then reused until the size of the system changes.
+int XC::SymSparseLinSOE::addA(const XC::Matrix &in_m, const XC::ID &in_id, double fact)
+  {
+    // check for a quick return
+    if(fact == 0.0)  
+      return 0;
+
+    const int idSize= in_id.Size();
+    if(idSize == 0)
+      return 0;
+
+    // check that m and id are of similar size
+    if(idSize != in_m.noRows() || idSize != in_m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; matrix and ID not of similar sizes\n";
+	return -1;
+      }
+
+    const ScatterMap::location_vector *locations= scatterMap.find(in_id);
+    if(!locations)
+      locations= &compute_locations(in_id);
+    ScatterMap::scatter(*locations, in_m, fact, diag);
     return 0;
   }
 
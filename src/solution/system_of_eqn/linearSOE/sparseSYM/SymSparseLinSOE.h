@@ -70,6 +70,8 @@ class SymSparseLinSOE: public SparseSOEBase
     int      *rowblks;
     OFFDBLK  **begblk;
     OFFDBLK  *first;
+
+    const ScatterMap::location_vector &compute_locations(const ID &);
   protected:
     virtual bool setSolver(LinearSOESolver *);
 
@@ -108,6 +108,7 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
       {  
 	 p = (OFFDBLK *)malloc( sizeof(OFFDBLK));
 	 assert (p != NULL);
+         p->nz = NULL;
          p->row = node;
          p->beg = nbr;
 	 po->next = p;
@@ -133,19 +134,9 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
       }
       /* part of the diagonal envelop block */
       envlen[node] = node - nbr;
-/*    should now allocate space for row and set up pointers */
-      if (knz > 0) 
-      {  
-	 nbeg->nz = (double *)calloc(knz, sizeof(double));
-         assert(nbeg->nz != NULL);
-         if ( bcount < count) bcount++;
-         m = bcount;
-         while (bcount < count)
-         {  (nbeg->next)->nz = nbeg->nz + len[bcount - m];
-            nbeg = nbeg->next;
-            bcount++;
-         }
-      }
+/*    the space for the row segments is allocated by the caller
+      (see setoffdblk) */
+      bcount = count;
       cnz += knz;   
    }  /* end for node */
 
@@ -172,39 +163,88 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
 
    free(len);
    free(segprv);
-   return 0;
+   return cnz;
 }
 
 
 
+/************************************************************************
+ ************  envlpesize ..... size of the envelope   *********************
+ ************************************************************************
+
+    purpose - compute the number of nonzeros in the envelope structure.
+
+    input parameters
+        neqns - no of equations
+	envlen - an array with the lengths of each row.
+
+ ************************************************************************/
+
+int envlpesize(int neqns, int *envlen)
+  {
+     int knz= 0;
+     for(int i=1; i<neqns; i++)
+       knz+= envlen[i];
+     return knz;
+  }
+
 /************************************************************************
  ************  setenvlpe ..... set up envelope   ***************************
  ************************************************************************
  
-    purpose - allocate space for the envelope structure
-	      and setup pointers
+    purpose - setup the pointers of the envelope structure
+              in the space allocated by the caller.
 
     input parameters -penv
         neqns - no of equations
 	penv - array of pointers to be filled
 	envlen - an array with the lengths of each row.
+	env - space for the envelope (envlpesize(neqns,envlen)+1 values).
 
     output parameters -
-        penv - filled array of pointers pointing to allocated space
+        penv - filled array of pointers pointing to env.
         knz  - number of nonzeros in the envelope structure .
 
  
  ************************************************************************/
      
-int setenvlpe(int neqns, double **penv, int *envlen)
+int setenvlpe(int neqns, double **penv, int *envlen, double *env)
   {
-     int knz= 0;
-     for(int i=1; i<neqns; i++)
-       knz+= envlen[i];
-
-     penv[0] = (double *)calloc(knz+1,sizeof(double));
-     assert(penv[0] != NULL);
+     penv[0] = env;
      for(int i=0;i<neqns;i++)
        { penv[i+1] = penv[i] + envlen[i]; }
+     return penv[neqns]-penv[0];
+  }
+
+/************************************************************************
+ ************  setoffdblk ..... set up row segments   **********************
+ ************************************************************************
+ 
+    purpose - setup the pointers to the coefficients of the row
+              segments in the space allocated by the caller. The
+              segments are stored one after another in the order
+              of the linked list (row by row).
+
+    input parameters
+        first - first row segment (as returned by nodfac).
+        xblk - beginning row/column of each block.
+        rowblks - block of each row.
+        nz - space for the row segments (the value returned by nodfac).
+
+    output parameters -
+        knz  - number of nonzeros in the row segments.
+
+ ************************************************************************/
+
+int setoffdblk(OFFDBLK *first, int *xblk, int *rowblks, double *nz)
+  {
+     int knz= 0;
+     OFFDBLK *p= first;
+     while(p->next != p) /* the last one is the end mark */
+       {
+         p->nz= nz + knz;
+         knz+= xblk[rowblks[p->beg]+1] - p->beg;
+         p= p->next;
+       }
      return knz;
   }
@@ -77,7 +77,9 @@ extern "C" int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list,
 	   int nblks, int *xblk, int *envlen, OFFDBLK **segfirst, 
 	   OFFDBLK **first, int *rowblks );
 
-extern "C" int setenvlpe(int neqns, double **penv, int *envlen);
+extern "C" int envlpesize(int neqns, int *envlen);
+extern "C" int setenvlpe(int neqns, double **penv, int *envlen, double *env);
+extern "C" int setoffdblk(OFFDBLK *first, int *xblk, int *rowblks, double *nz);
 extern "C" void copyi( int n, int *, int * );
 
 
@@ -92,7 +94,7 @@ int XC::symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
   {
     int delta, maxint;
     int nofsub, kdx;
-    int ndnz;
+    int ndnz, cnz;
     int *marker;
     int *winvp, *wperm;
     int i;
@@ -224,8 +226,8 @@ int XC::symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
 	   -------------------------------------------------
   */  
 
-     nodfac(perm, invp, padj, parent, fchild , neq, nblks,
-	    xblk, marker, begblk, &first, rowblks) ;
+     cnz= nodfac(perm, invp, padj, parent, fchild , neq, nblks,
+		 xblk, marker, begblk, &first, rowblks) ;
 
      free(perm) ;
      free(parent) ;
@@ -233,10 +235,15 @@ int XC::symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
      free(padj[0]) ;
      free(padj);
 
+  /* the diagonal, the envelope and the row segments share a single
+     block of memory (diag points to its beginning) so the location
+     of any coefficient can be expressed as an offset from diag. */
+     ndnz = envlpesize(neq, marker) ;
      penv = (double **)calloc(neq + 1, sizeof(double *)) ;
-     diag = (double *)calloc(neq + 1,sizeof(double )) ;
+     diag = (double *)calloc((neq + 1) + (ndnz + 1) + cnz, sizeof(double )) ;
      assert ( penv && diag != NULL) ;
-     ndnz = setenvlpe(neq, penv, marker) ;
+     setenvlpe(neq, penv, marker, diag + (neq + 1)) ;
+     setoffdblk(first, xblk, rowblks, diag + (neq + 1) + (ndnz + 1)) ;
 
      free(marker);
 
@@ -66,13 +66,12 @@
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/Vector.h>
 #include "solution/graph/graph/Graph.h"
-#include <solution/graph/graph/Vertex.h>
-#include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 
 XC::UmfpackGenLinSOE::UmfpackGenLinSOE(SolutionStrategy *owr)
-  :LinearSOEData(owr,LinSOE_TAGS_UmfpackGenLinSOE), Ax(), Ap(), Ai()
+  :FactoredSOEBase(owr,LinSOE_TAGS_UmfpackGenLinSOE), Ax(), Ap(), Ai(), scatterMap()
   {}
 
 XC::SystemOfEqn *XC::UmfpackGenLinSOE::UmfpackGenLinSOE::getCopy(void) const
@@ -84,7 +83,7 @@ bool XC::UmfpackGenLinSOE::setSolver(LinearSOESolver *newSolver)
     UmfpackGenLinSolver *tmp= dynamic_cast<UmfpackGenLinSolver *>(newSolver);
     if(tmp)
       {
-	retval= LinearSOEData::setSolver(tmp);
+	retval= FactoredSOEBase::setSolver(tmp);
 	if(X.Size()!=0)
 	  {
 	    int solverOK= newSolver->setSize();
@@ -114,60 +113,34 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
 	return -1;
       }
 
-    // fist iterate through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int nnz= 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0)
+    // the number of non-zeros is given by the compressed adjacency
+    // of the graph (plus the diagonal).
+    const CSRGraph &g= theGraph.getCSR();
+    if(g.getNumVertex() != size)
       {
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	nnz += theAdjacency.size() +1; // the +1 is for the diag entry
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: graph vertices not numbered from 0 to "
+		  << size-1 << " - size set to 0.\n";
+	size = 0;
+	return -1;
       }
+    const int nnz= g.getNumEntriesWithDiagonal();
 
     // resize A, B, X
-    Ap.reserve(size+1);
-    Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    Ap.resize(size+1);
+    Ai.resize(nnz);
+    Ax.assign(nnz,0.0);
+    scatterMap.clear(); // Ax storage has changed.
+    factored= false;
     B.resize(size);
     B.Zero();
     X.resize(size);
     X.Zero();
     
-    // fill in Ai and Ap
-    Ap.push_back(0);
+    // fill in Ai and Ap (the adjacency is already sorted).
+    Ap[0]= 0;
     for(int a=0; a<size; a++)
-      {
-
-	theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0)
-	  {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; WARNING: vertex " << a
-		      << " not in graph! - size set to 0.\n";
-	    size = 0;
-	    return -1;
-	  }
-
-	const std::set<int> &theAdjacency = theVertex->getAdjacency();
-	std::set<int> col;
-
-	// diagonal
-	col.insert(theVertex->getTag());
-
-	// now we have to place the entries in the ID into order in Ai
-        for(std::set<int>::const_iterator i=theAdjacency.begin(); i!=theAdjacency.end(); i++)
-	  {
-	    const int row= *i;
-	    col.insert(row);
-	  }
-
-	// copy to Ai
-	for(std::set<int>::const_iterator i=col.begin(); i!=col.end(); i++)
-	  { Ai.push_back(*i); }
-
-	// set Ap
-	Ap.push_back(Ap[a]+col.size());
-      }
+      Ap[a+1]= Ap[a]+g.copyWithDiagonal(a, Ai.data()+Ap[a]);
 
     // invoke setSize() on the Solver
     LinearSOESolver *the_Solver = this->getSolver();
@@ -182,6 +155,42 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
   }
 
 
+//! @brief Compute the locations in Ax of the coefficients that
+//! correspond to the equation numbers being passed as parameter.
+const XC::ScatterMap::location_vector &XC::UmfpackGenLinSOE::compute_locations(const ID &id)
+  {
+    ScatterMap::location_vector &retval= scatterMap.insert(id);
+    const int idSize= id.Size();
+    for(int j=0; j<idSize; j++)
+      {
+	const int col= id(j);
+	if(col<0 || col>=size)
+	  { continue; }
+	for(int i=0; i<idSize; i++)
+	  {
+	    const int row= id(i);
+	    if(row<0 || row>=size)
+	      { continue; }
+
+	    // find place in A
+	    for(int k=Ap[col]; k<Ap[col+1]; k++)
+	      {
+		if(Ai[k] == row)
+		  {
+		    retval[j*idSize+i]= k;
+		    break;
+		  }
+	      }
+	  }
+      }
+    return retval;
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! The positions in Ax of the coefficients are computed
+//! the first time the ID is assembled and then reused until the
+//! size of the system changes.
 int XC::UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
   {
     // check for a quick return 
@@ -191,69 +200,44 @@ int XC::UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
     const int idSize = id.Size();
 
     // check that m and id are of similar size
-    if(idSize != m.noRows() && idSize != m.noCols())
+    if(idSize != m.noRows() || idSize != m.noCols())
       {
 	std::cerr << getClassName() << "::" << __FUNCTION__
 		  << "; Matrix and ID not of similar sizes\n";
 	return -1;
       }
-    
-    if(fact == 1.0) // do not need to multiply 
-      { 
-	for (int j=0; j<idSize; j++)
-	  {
-	    const int col = id(j);
-	    if (col<0 || col>=size)
-	      { continue; }
-	    for (int i=0; i<idSize; i++)
-	      {
-		const int row = id(i);
-		if (row<0 || row>=size)
-		  { continue; }
 
-		// find place in A
-		for (int k=Ap[col]; k<Ap[col+1]; k++)
-		  {
-		    if(Ai[k] == row)
-		      {
-			Ax[k] += m(i,j);
-			break;
-		      }
-		  }
-	      }
-	  }
-      }
-    else
-      {
-	for(int j=0; j<idSize; j++)
-	  {
-	    const int col = id(j);
-	    if (col<0 || col>=X.Size())
-	      { continue; }
-	    for(int i=0; i<idSize; i++)
-	      {
-		const int row = id(i);
-		if (row<0 || row>=X.Size())
-		  { continue; }
-		// find place in A
-		for (int k=Ap[col]; k<Ap[col+1]; k++)
-		  {
-		    if(Ai[k] == row)
-		      {
-			Ax[k] += fact*m(i,j);
-			break;
-		      }
-		  }
-	      }
-	  }
-      }
+    const ScatterMap::location_vector *locations= scatterMap.find(id);
+    if(!locations)
+      locations= &compute_locations(id);
+    ScatterMap::scatter(*locations, m, fact, Ax.data());
+    factored= false; // A has changed.
     return 0;
   }
 
     
+//! @brief Zeroes the matrix and marks the system as not factored.
 void XC::UmfpackGenLinSOE::zeroA(void)
   {
     Ax.assign(Ax.size(),0.0);
+    factored= false;
+  }
+
+//! @brief Solves the system for each of the columns of the
+//! right hand side matrix argument, reusing the factorization of A.
+//!
+//! @param rhs: right hand side vectors (one per column).
+//! @param x: solution vectors (one per column).
+int XC::UmfpackGenLinSOE::solveMultipleRHS(const Matrix &rhs, Matrix &x)
+  {
+    int retval= -1;
+    UmfpackGenLinSolver *theUmfSolver= dynamic_cast<UmfpackGenLinSolver *>(getSolver());
+    if(theUmfSolver)
+      retval= theUmfSolver->solve(rhs, x);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; no solver has been set." << std::endl;
+    return retval;
   }
 
 int XC::UmfpackGenLinSOE::sendSelf(Communicator &comm)
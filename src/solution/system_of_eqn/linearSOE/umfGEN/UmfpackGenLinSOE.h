@@ -66,7 +66,8 @@
 #ifndef UmfpackGenLinSOE_h
 #define UmfpackGenLinSOE_h
 
-#include "solution/system_of_eqn/linearSOE/LinearSOEData.h"
+#include "solution/system_of_eqn/linearSOE/FactoredSOEBase.h"
+#include "solution/system_of_eqn/linearSOE/ScatterMap.h"
 #include "utility/matrix/Vector.h"
 
 namespace XC {
@@ -75,11 +76,14 @@ class UmfpackGenLinSolver;
 //! @brief System of equations that can be used with the UMFPACK routines
 //! (Unsymmetric MultiFrontal Method). See <a href="http://faculty.cse.tamu.edu/davis/research.html" target="_new"> SuiteSparse</a>.
 //! @ingroup SOE
-class UmfpackGenLinSOE: public LinearSOEData
+class UmfpackGenLinSOE: public FactoredSOEBase
   {
   private:
     std::vector<double> Ax;
     std::vector<int> Ap, Ai;
+    ScatterMap scatterMap; //!< locations of the element matrices coefficients in Ax.
+
+    const ScatterMap::location_vector &compute_locations(const ID &);
   protected:
     bool setSolver(LinearSOESolver *);
 
@@ -92,6 +96,8 @@ class UmfpackGenLinSOE: public LinearSOEData
     
     void zeroA(void);
 
+    int solveMultipleRHS(const Matrix &, Matrix &);
+
     int sendSelf(Communicator &);
     int recvSelf(const Communicator &);
 
@@ -63,6 +63,7 @@
 
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
+#include "utility/matrix/Matrix.h"
 
 void XC::UmfpackGenLinSolver::free_symbolic(void)
   {
@@ -73,30 +74,60 @@ void XC::UmfpackGenLinSolver::free_symbolic(void)
       }
   }
 
+//! @brief Free the numeric factorization.
+void XC::UmfpackGenLinSolver::free_numeric(void)
+  {
+    if(Numeric)
+      {
+	umfpack_di_free_numeric(&Numeric);
+	Numeric= nullptr;
+      }
+  }
+
 XC::UmfpackGenLinSolver::UmfpackGenLinSolver()
  : LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver),
-   Symbolic(nullptr), theSOE(nullptr)
+   Symbolic(nullptr), Numeric(nullptr), theSOE(nullptr)
+  {}
+
+//! @brief Copy constructor.
+//!
+//! The UMFPACK objects are not shared between copies; the copy will
+//! compute its own ones when setSize is called.
+XC::UmfpackGenLinSolver::UmfpackGenLinSolver(const UmfpackGenLinSolver &other)
+ : LinearSOESolver(other),
+   Symbolic(nullptr), Numeric(nullptr), theSOE(other.theSOE)
   {}
 
+//! @brief Assignment operator (see copy constructor).
+XC::UmfpackGenLinSolver &XC::UmfpackGenLinSolver::operator=(const UmfpackGenLinSolver &other)
+  {
+    if(this!=&other)
+      {
+	LinearSOESolver::operator=(other);
+	free_numeric();
+	free_symbolic();
+	theSOE= other.theSOE;
+      }
+    return *this;
+  }
+
 XC::LinearSOESolver *XC::UmfpackGenLinSolver::getCopy(void) const
    { return new UmfpackGenLinSolver(*this); }
 
 //! @brief Destructor.
 XC::UmfpackGenLinSolver::~UmfpackGenLinSolver()
-  { free_symbolic(); }
+  {
+    free_numeric();
+    free_symbolic();
+  }
 
-int XC::UmfpackGenLinSolver::solve(void)
+//! @brief Computes the numeric factorization of A if the system
+//! is not marked as factored (i.e. A has changed since the last
+//! factorization).
+int XC::UmfpackGenLinSolver::factorize(void)
   {
-    const int n = theSOE->X.Size();
-    const int nnz = static_cast<int>(theSOE->Ai.size());
-    if(n == 0 || nnz==0)
-      return 0;
-    
-    int *Ap= &(theSOE->Ap[0]);
-    int *Ai= &(theSOE->Ai[0]);
-    double *Ax = &(theSOE->Ax[0]);
-    double *X = theSOE->X.getDataPtr();
-    double *B = theSOE->B.getDataPtr();
+    if(theSOE->factored && Numeric)
+      return 0; // reuse the factorization.
 
     // check if symbolic is done
     if(!Symbolic)
@@ -106,9 +137,13 @@ int XC::UmfpackGenLinSolver::solve(void)
 	return -1;
       }
     
+    int *Ap= &(theSOE->Ap[0]);
+    int *Ai= &(theSOE->Ai[0]);
+    double *Ax = &(theSOE->Ax[0]);
+
     // numerical analysis
-    void *Numeric= nullptr;
-    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+    free_numeric();
+    const int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
 
     // check error
     if(status!=UMFPACK_OK)
@@ -126,16 +161,37 @@ int XC::UmfpackGenLinSolver::solve(void)
 	  std::cerr << " Symbolic object provided as input is invalid." << std::endl;
 	if(status==UMFPACK_ERROR_different_pattern)
 	  std::cerr << " Different pattern." << std::endl;
+	free_numeric();
 	return -1;
       }
+    theSOE->factored= true;
+    return 0;
+  }
+
+//! @brief Solves the system of equations.
+//!
+//! The numeric factorization is computed only if the system is not
+//! marked as factored, otherwise the previous one is reused (i.e.
+//! modified Newton iterations or linear analysis with constant A).
+int XC::UmfpackGenLinSolver::solve(void)
+  {
+    const int n = theSOE->X.Size();
+    const int nnz = static_cast<int>(theSOE->Ai.size());
+    if(n == 0 || nnz==0)
+      return 0;
+    
+    if(factorize()<0)
+      return -1;
+
+    int *Ap= &(theSOE->Ap[0]);
+    int *Ai= &(theSOE->Ai[0]);
+    double *Ax = &(theSOE->Ax[0]);
+    double *X = theSOE->X.getDataPtr();
+    double *B = theSOE->B.getDataPtr();
 
     // solve
-    status= umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
+    const int status= umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
 
-    // delete Numeric
-    if(Numeric)
-      { umfpack_di_free_numeric(&Numeric); }
-    
     // check error
     if(status!=UMFPACK_OK)
       {
@@ -149,6 +205,54 @@ int XC::UmfpackGenLinSolver::solve(void)
     return 0;
   }
 
+//! @brief Solves the system for each column of the rhs matrix using
+//! a single numeric factorization of A.
+//!
+//! @param rhs: right hand side vectors (one per column).
+//! @param x: solution vectors (one per column).
+int XC::UmfpackGenLinSolver::solve(const Matrix &rhs, Matrix &x)
+  {
+    const int n = theSOE->X.Size();
+    const int nnz = static_cast<int>(theSOE->Ai.size());
+    const int nrhs= rhs.noCols();
+    if(rhs.noRows()!=n)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: the number of rows of the right hand side: "
+		  << rhs.noRows() << " doesn't match the number of equations: "
+		  << n << std::endl;
+	return -1;
+      }
+    x.resize(n, nrhs);
+    x.Zero();
+    if(n == 0 || nnz==0 || nrhs==0)
+      return 0;
+    
+    if(factorize()<0)
+      return -1;
+
+    int *Ap= &(theSOE->Ap[0]);
+    int *Ai= &(theSOE->Ai[0]);
+    double *Ax = &(theSOE->Ax[0]);
+    // Matrix stores its data column by column.
+    const double *B= rhs.getDataPtr();
+    double *X= x.getDataPtr();
+    for(int j= 0; j<nrhs; j++)
+      {
+	const int status= umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X+j*n,B+j*n,Numeric,Control,Info);
+	if(status!=UMFPACK_OK)
+	  {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: solving right hand side: " << j
+		      << " returns "<< status
+		      << std::endl;
+	    this->setPyProp("info", boost::python::object(status));
+	    return -1;
+	  }
+      }
+    return 0;
+  }
+
 
 int XC::UmfpackGenLinSolver::setSize()
   {
@@ -157,6 +261,10 @@ int XC::UmfpackGenLinSolver::setSize()
     Control[UMFPACK_PIVOT_TOLERANCE] = 1.0;
     Control[UMFPACK_STRATEGY] = UMFPACK_STRATEGY_SYMMETRIC;
 
+    // the numeric factorization is no longer valid.
+    free_numeric();
+    theSOE->factored= false;
+
     const int n = theSOE->X.Size();
     const int nnz = static_cast<int>(theSOE->Ai.size());
     if (n == 0 || nnz==0) return 0;
@@ -78,8 +78,11 @@ class UmfpackGenLinSolver: public LinearSOESolver
   {
   private:
     void *Symbolic;
+    void *Numeric; //!< numeric factorization (kept while the SOE is factored).
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     void free_symbolic(void);
+    void free_numeric(void);
+    int factorize(void);
 
   protected:    
     UmfpackGenLinSOE *theSOE;
@@ -87,6 +90,8 @@ class UmfpackGenLinSolver: public LinearSOESolver
     friend class FEM_ObjectBroker;
     friend class LinearSOE;
     UmfpackGenLinSolver(void);     
+    UmfpackGenLinSolver(const UmfpackGenLinSolver &);
+    UmfpackGenLinSolver &operator=(const UmfpackGenLinSolver &);
     virtual LinearSOESolver *getCopy(void) const;
     virtual bool setLinearSOE(LinearSOE *theSOE);
   public:
@@ -94,6 +99,7 @@ class UmfpackGenLinSolver: public LinearSOESolver
     ~UmfpackGenLinSolver(void);
 
     int solve(void);
+    int solve(const Matrix &, Matrix &);
     int setSize(void);
 
     bool setLinearSOE(UmfpackGenLinSOE &theSOE);
@@ -39,7 +39,7 @@
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSolver.h>
 #include "solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h"
-//#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/DistributedBandSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DiagonalSOE.h>
 #include <solution/system_of_eqn/linearSOE/diagonal/DistributedDiagonalSOE.h>
@@ -49,13 +49,14 @@
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSolver.h>
 #include "solution/system_of_eqn/linearSOE/fullGEN/FullGenLinLapackSolver.h"
+#include "solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSubstrThreadSolver.h"
 //#include <solution/system_of_eqn/linearSOE/itpack/ItpackLinSOE.h>
 //#include <solution/system_of_eqn/linearSOE/itpack/ItpackLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h"
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h"
@@ -115,6 +116,13 @@
 
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
+#ifdef USE_EIGEN
+#include <solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/eigenSPD/EigenSparseSPDLinSolver.h>
+#endif
+#include <solution/system_of_eqn/linearSOE/krylov/CsrSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/krylov/PCGLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/krylov/MINRESLinSolver.h>
 #ifdef _PARALLEL_PROCESSING
 #include "solution/system_of_eqn/linearSOE/bandSPD/DistributedBandSPDLinSOE.h"
 #include "solution/system_of_eqn/linearSOE/profileSPD/DistributedProfileSPDLinSOE.h"
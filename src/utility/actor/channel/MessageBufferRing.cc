@@ -0,0 +1,118 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MessageBufferRing.cc
+
+#include "MessageBufferRing.h"
+#include <cstring>
+#include <thread>
+#include <chrono>
+#include <iostream>
+
+//! @brief Constructor.
+//!
+//! @param capacity: maximum number of messages waiting to be read.
+XC::MessageBufferRing::MessageBufferRing(const size_t &capacity)
+  : slots(capacity), head(0), tail(0)
+  {}
+
+//! @brief Wait for the other end of the ring (spin first, then
+//! yield the processor and, if the wait is long, sleep).
+//!
+//! @param count: number of times the wait has been called.
+void XC::MessageBufferRing::wait(const size_t &count)
+  {
+    if(count<64)
+      return; // spin.
+    else if(count<4096)
+      std::this_thread::yield();
+    else
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+
+//! @brief Return the maximum number of messages waiting to be read.
+size_t XC::MessageBufferRing::capacity(void) const
+  { return slots.size(); }
+
+//! @brief Return the number of messages waiting to be read.
+size_t XC::MessageBufferRing::size(void) const
+  { return tail.load(std::memory_order_acquire)-head.load(std::memory_order_acquire); }
+
+//! @brief Return true if there is no message waiting to be read.
+bool XC::MessageBufferRing::empty(void) const
+  { return (size()==0); }
+
+//! @brief Copy the data in the next free slot (waits if the ring is
+//! full). Must be called only from the producer thread.
+//!
+//! @param data: pointer to the data to send.
+//! @param sz: size of the data in bytes.
+void XC::MessageBufferRing::push(const void *data, const size_t &sz)
+  {
+    const size_t t= tail.load(std::memory_order_relaxed);
+    const size_t n= slots.size();
+    size_t count= 0;
+    while((t-head.load(std::memory_order_acquire))>=n)
+      wait(count++);
+    buffer_type &buffer= slots[t%n];
+    buffer.resize(sz); // keeps the memory already allocated.
+    if(sz>0)
+      memcpy(buffer.data(), data, sz);
+    tail.store(t+1, std::memory_order_release);
+  }
+
+//! @brief Copy the data of the next message in the argument (waits
+//! if the ring is empty). Must be called only from the consumer thread.
+//!
+//! Returns 0 if the size of the message matches the given one, -1
+//! otherwise (the message is discarded anyway).
+//! @param data: pointer to the memory that will receive the data.
+//! @param sz: size of the data in bytes.
+int XC::MessageBufferRing::pop(void *data, const size_t &sz)
+  {
+    int retval= 0;
+    const size_t h= head.load(std::memory_order_relaxed);
+    const size_t n= slots.size();
+    size_t count= 0;
+    while(tail.load(std::memory_order_acquire)==h)
+      wait(count++);
+    const buffer_type &buffer= slots[h%n];
+    if(buffer.size()==sz)
+      {
+        if(sz>0)
+          memcpy(data, buffer.data(), sz);
+      }
+    else
+      {
+        std::cerr << "MessageBufferRing::" << __FUNCTION__
+                  << "; message size: " << buffer.size()
+                  << " bytes, expected: " << sz << " bytes."
+                  << std::endl;
+        retval= -1;
+      }
+    head.store(h+1, std::memory_order_release);
+    return retval;
+  }
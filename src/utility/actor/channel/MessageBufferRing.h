@@ -0,0 +1,73 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MessageBufferRing.h
+
+#ifndef MessageBufferRing_h
+#define MessageBufferRing_h
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+namespace XC {
+
+//! @ingroup IPComm
+//
+//! @brief Lock-free ring of message buffers with a single producer
+//! and a single consumer (the two ends of a ThreadChannel).
+//!
+//! The buffers of the slots are kept between messages so, once they
+//! have reached the size of the messages, sending a message doesn't
+//! allocate memory: the data is copied once into the slot buffer
+//! and once from it into the receiving object.
+class MessageBufferRing
+  {
+  public:
+    typedef std::vector<char> buffer_type;
+  private:
+    std::vector<buffer_type> slots; //!< message buffers.
+    alignas(64) std::atomic<size_t> head; //!< number of messages read (consumer).
+    alignas(64) std::atomic<size_t> tail; //!< number of messages written (producer).
+
+    static void wait(const size_t &);
+    MessageBufferRing(const MessageBufferRing &);
+    MessageBufferRing &operator=(const MessageBufferRing &);
+  public:
+    MessageBufferRing(const size_t &capacity= 32);
+
+    size_t capacity(void) const;
+    size_t size(void) const;
+    bool empty(void) const;
+
+    void push(const void *, const size_t &);
+    int pop(void *, const size_t &);
+  };
+
+} // end of XC namespace
+
+#endif
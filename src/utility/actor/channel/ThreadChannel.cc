@@ -0,0 +1,226 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadChannel.cc
+
+#include "utility/actor/channel/ThreadChannel.h"
+#include "utility/actor/channel/MessageBufferRing.h"
+#include "utility/actor/message/Message.h"
+#include "utility/actor/address/ChannelAddress.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+//! @brief Constructor (the channel must be connected to its peer
+//! before using it).
+XC::ThreadChannel::ThreadChannel(void)
+  : Channel() {}
+
+//! @brief Connect this channel with the argument.
+//!
+//! @param other: channel at the other end.
+//! @param capacity: maximum number of messages waiting to be read
+//!                  in each direction.
+int XC::ThreadChannel::connect(ThreadChannel &other, const size_t &capacity)
+  {
+    if(&other==this)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; a channel can't be connected with itself."
+                  << std::endl;
+        return -1;
+      }
+    inbox= std::make_shared<MessageBufferRing>(capacity);
+    outbox= std::make_shared<MessageBufferRing>(capacity);
+    other.inbox= outbox;
+    other.outbox= inbox;
+    return 0;
+  }
+
+//! @brief Return true if the channel is connected to its peer.
+bool XC::ThreadChannel::isConnected(void) const
+  { return (inbox && outbox); }
+
+//! @brief There is no program to start, the actors run on threads
+//! of the same process.
+std::string XC::ThreadChannel::addToProgram(void)
+  { return std::string(); }
+
+//! @brief The connection is established by connect.
+int XC::ThreadChannel::setUpConnection(void)
+  {
+    int retval= 0;
+    if(!isConnected())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; channel not connected." << std::endl;
+        retval= -1;
+      }
+    return retval;
+  }
+
+//! @brief The channel only communicates with its peer.
+int XC::ThreadChannel::setNextAddress(const ChannelAddress &theAddress)
+  {
+    check_address(&theAddress, __FUNCTION__);
+    return -1;
+  }
+
+//! @brief The channel only communicates with its peer.
+XC::ChannelAddress *XC::ThreadChannel::getLastSendersAddress(void)
+  { return nullptr; }
+
+//! @brief Return true if the address is null (the channel only
+//! communicates with its peer).
+bool XC::ThreadChannel::check_address(const ChannelAddress *theAddress, const std::string &methodName) const
+  {
+    bool retval= true;
+    if(theAddress)
+      {
+        std::cerr << getClassName() << "::" << methodName
+                  << "; a thread channel can only communicate"
+                  << " with the channel it is connected to." << std::endl;
+        retval= false;
+      }
+    return retval;
+  }
+
+//! @brief Send the data to the peer.
+//!
+//! @param data: pointer to the data to send.
+//! @param sz: size of the data in bytes.
+//! @param methodName: name of the calling method (for error messages).
+int XC::ThreadChannel::send_data(const void *data, const size_t &sz, const std::string &methodName)
+  {
+    if(!outbox)
+      {
+        std::cerr << getClassName() << "::" << methodName
+                  << "; channel not connected." << std::endl;
+        return -1;
+      }
+    outbox->push(data, sz);
+    return 0;
+  }
+
+//! @brief Receive the data from the peer.
+//!
+//! @param data: pointer to the memory that will receive the data.
+//! @param sz: size of the data in bytes.
+//! @param methodName: name of the calling method (for error messages).
+int XC::ThreadChannel::recv_data(void *data, const size_t &sz, const std::string &methodName)
+  {
+    if(!inbox)
+      {
+        std::cerr << getClassName() << "::" << methodName
+                  << "; channel not connected." << std::endl;
+        return -1;
+      }
+    const int retval= inbox->pop(data, sz);
+    if(retval!=0)
+      std::cerr << getClassName() << "::" << methodName
+                << "; incorrect size of the data received." << std::endl;
+    return retval;
+  }
+
+//! @brief Send the object.
+int XC::ThreadChannel::sendObj(int commitTag, MovableObject &theObject, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return sendMovable(commitTag, theObject);
+  }
+
+//! @brief Receive the object.
+int XC::ThreadChannel::recvObj(int commitTag, MovableObject &theObject, FEM_ObjectBroker &theBroker, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return receiveMovable(commitTag, theObject, theBroker);
+  }
+
+//! @brief Send the message.
+int XC::ThreadChannel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return send_data(msg.data, msg.length, __FUNCTION__);
+  }
+
+//! @brief Receive the message.
+int XC::ThreadChannel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return recv_data(msg.data, msg.length, __FUNCTION__);
+  }
+
+//! @brief Send the matrix.
+int XC::ThreadChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return send_data(theMatrix.getDataPtr(), theMatrix.getDataSize()*sizeof(double), __FUNCTION__);
+  }
+
+//! @brief Receive the matrix.
+int XC::ThreadChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return recv_data(theMatrix.getDataPtr(), theMatrix.getDataSize()*sizeof(double), __FUNCTION__);
+  }
+
+//! @brief Send the vector.
+int XC::ThreadChannel::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return send_data(theVector.getDataPtr(), theVector.Size()*sizeof(double), __FUNCTION__);
+  }
+
+//! @brief Receive the vector.
+int XC::ThreadChannel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return recv_data(theVector.getDataPtr(), theVector.Size()*sizeof(double), __FUNCTION__);
+  }
+
+//! @brief Send the ID.
+int XC::ThreadChannel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return send_data(theID.getDataPtr(), theID.Size()*sizeof(int), __FUNCTION__);
+  }
+
+//! @brief Receive the ID.
+int XC::ThreadChannel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+  {
+    if(!check_address(theAddress, __FUNCTION__))
+      return -1;
+    return recv_data(theID.getDataPtr(), theID.Size()*sizeof(int), __FUNCTION__);
+  }
@@ -0,0 +1,85 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadChannel.h
+
+#ifndef ThreadChannel_h
+#define ThreadChannel_h
+
+#include "utility/actor/channel/Channel.h"
+#include <memory>
+
+namespace XC {
+class MessageBufferRing;
+
+//! @ingroup IPComm
+//
+//! @brief Channel between two threads of the same process.
+//!
+//! The two ends of the channel are connected by means of two
+//! lock-free message rings (see MessageBufferRing), one for each
+//! direction. Each end must be used from one thread only. The
+//! channel is point to point so the channel addresses are not used.
+class ThreadChannel: public Channel
+  {
+  private:
+    std::shared_ptr<MessageBufferRing> inbox; //!< messages sent by the peer.
+    std::shared_ptr<MessageBufferRing> outbox; //!< messages sent to the peer.
+  protected:
+    bool check_address(const ChannelAddress *, const std::string &) const;
+    int send_data(const void *, const size_t &, const std::string &);
+    int recv_data(void *, const size_t &, const std::string &);
+  public:
+    ThreadChannel(void);
+
+    int connect(ThreadChannel &, const size_t &capacity= 32);
+    bool isConnected(void) const;
+
+    std::string addToProgram(void);
+    virtual int setUpConnection(void);
+
+    int setNextAddress(const ChannelAddress &);
+    virtual ChannelAddress *getLastSendersAddress(void);
+
+    int sendObj(int commitTag, MovableObject &, ChannelAddress *theAddress= nullptr);
+    int recvObj(int commitTag, MovableObject &, FEM_ObjectBroker &, ChannelAddress *theAddress= nullptr);
+
+    int sendMsg(int dbTag, int commitTag, const Message &, ChannelAddress *theAddress= nullptr);
+    int recvMsg(int dbTag, int commitTag, Message &, ChannelAddress *theAddress= nullptr);
+
+    int sendMatrix(int dbTag, int commitTag, const Matrix &, ChannelAddress *theAddress= nullptr);
+    int recvMatrix(int dbTag, int commitTag, Matrix &, ChannelAddress *theAddress= nullptr);
+
+    int sendVector(int dbTag, int commitTag, const Vector &, ChannelAddress *theAddress= nullptr);
+    int recvVector(int dbTag, int commitTag, Vector &, ChannelAddress *theAddress= nullptr);
+
+    int sendID(int dbTag, int commitTag, const ID &, ChannelAddress *theAddress= nullptr);
+    int recvID(int dbTag, int commitTag, ID &, ChannelAddress *theAddress= nullptr);
+  };
+} // end of XC namespace
+
+#endif
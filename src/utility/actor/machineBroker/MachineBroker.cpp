@@ -84,64 +84,96 @@ int XC::MachineBroker::shutdown(void)
         this->freeProcess(theChannel);
       }
 
-    if(!actorChannels.empty())
-      {
-        activeChannels.resize(0);
-        numActorChannels = 0;
-        numActiveChannels = 0;
-      }
+    clear_actor_channels();
     return 0;
   }
 
+//! @brief Forget the channels with the running actor processes.
+void XC::MachineBroker::clear_actor_channels(void)
+  {
+    actorChannels.clear();
+    activeChannels.resize(0);
+    numActorChannels = 0;
+    numActiveChannels = 0;
+  }
+
 
-int XC::MachineBroker::runActors(void)
+//! @brief Run the actors requested through the channel until
+//! receiving the termination notice (an ID with a zero value).
+//!
+//! @param theChannel: channel to communicate with the machine broker
+//!                    that requests the actors.
+//! @param theBroker: object broker used to create the actors.
+int XC::MachineBroker::run_actors(Channel &theChannel, FEM_ObjectBroker &theBroker)
   {
-    Channel *theChannel = this->getMyChannel();
     ID idData(1);
-    int done = 0;
-
     // loop until recv kill signal
-    while(done == 0)
+    while(true)
       {
-        if(theChannel->recvID(0, 0, idData) < 0)
-          { std::cerr << "MachineBroker::runActors(void) - failed to recv XC::ID\n"; }
+        if(theChannel.recvID(0, 0, idData) < 0)
+          {
+            std::cerr << "MachineBroker::" << __FUNCTION__
+                      << "; failed to recv ID." << std::endl;
+            return -1;
+          }
 
         const int actorType = idData(0);
     
         // switch on data type
-        if(idData(0) == 0)
+        if(actorType == 0)
           {
-            done = 1;
-            if(theChannel->sendID(0, 0, idData) < 0)
-              { std::cerr << "MachineBroker::run(void) - failed to send XC::ID\n"; }
+            if(theChannel.sendID(0, 0, idData) < 0)
+              std::cerr << "MachineBroker::" << __FUNCTION__
+                        << "; failed to send ID." << std::endl;
             return 0;
           }
         else
           {
             // create an actor of appropriate type
-            Actor *theActor= getObjectBrokerPtr()->getNewActor(actorType, theChannel);
+            Actor *theActor= theBroker.getNewActor(actorType, &theChannel);
             if(!theActor)
               {
-                std::cerr << "MachineBroker::run(void) - invalid actor type\n";
+                std::cerr << "MachineBroker::" << __FUNCTION__
+                          << "; invalid actor type: " << actorType
+                          << std::endl;
                 idData(0) = 1;
               }
             else
               idData(0) = 0;
 
             // send ID back indicating whether actor was created 
-            if(theChannel->sendID(0, 0, idData) < 0)
-              { std::cerr << "MachineBroker::run(void) - failed to send XC::ID\n"; }
-
-            // run the actor object
-            if(theActor->run() != 0)
-              { std::cerr << "MachineBroker::run(void) - actor failed while running\n"; }  
-            // destroying theActor
-            delete theActor;
+            if(theChannel.sendID(0, 0, idData) < 0)
+              std::cerr << "MachineBroker::" << __FUNCTION__
+                        << "; failed to send ID." << std::endl;
+
+            if(theActor)
+              {
+                // run the actor object
+                if(theActor->run() != 0)
+                  std::cerr << "MachineBroker::" << __FUNCTION__
+                            << "; actor failed while running." << std::endl;
+                // destroying theActor
+                delete theActor;
+              }
           }
-        done = 0;
       }
     return 0;
   }
+
+//! @brief Run the actors requested through the channel returned by
+//! getMyChannel.
+int XC::MachineBroker::runActors(void)
+  {
+    Channel *theChannel = this->getMyChannel();
+    if(!theChannel)
+      {
+        std::cerr << "MachineBroker::" << __FUNCTION__
+                  << "; channel not available." << std::endl;
+        return -1;
+      }
+    return run_actors(*theChannel, *getObjectBrokerPtr());
+  }
+
 //! @brief Invoked to start the program.
 //! 
 //! @brief Invoked to start the program, #actorProgram, on the parallel
@@ -165,9 +197,9 @@ XC::Channel *XC::MachineBroker::startActor(int actorType, int compDemand)
             if(activeChannels(i) == 0)
               {
                 theChannel = actorChannels[i];
-                i=numActorChannels;
                 numActiveChannels++;
                 activeChannels(i) = 1;
+                break;
               }
           }
       }
@@ -181,8 +213,9 @@ XC::Channel *XC::MachineBroker::startActor(int actorType, int compDemand)
             std::cerr << "MachineBroker::startActor() - no available channel available\n";
             return 0;
           }
-        actorChannels.resize(numActorChannels+1,nullptr);
+        actorChannels.push_back(theChannel);
         activeChannels.resize(numActorChannels+1);
+        activeChannels(numActorChannels) = 1;
 
         numActorChannels++;
         numActiveChannels++;    
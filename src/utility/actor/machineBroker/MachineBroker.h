@@ -84,6 +84,9 @@ class MachineBroker: public ObjectWithObjBroker
 
     MachineBroker(const MachineBroker &);
     MachineBroker &operator=(const MachineBroker &);
+  protected:
+    void clear_actor_channels(void);
+    static int run_actors(Channel &, FEM_ObjectBroker &);
   public:
     MachineBroker(FEM_ObjectBroker *);
     virtual ~MachineBroker();
@@ -0,0 +1,192 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadMachineBroker.cc
+
+#include "utility/actor/machineBroker/ThreadMachineBroker.h"
+#include "utility/matrix/ID.h"
+#include "domain/domain/Domain.h"
+#include "domain/mesh/Mesh.h"
+#include "classTags.h"
+
+//! @brief Constructor.
+//!
+//! @param theBroker: object broker of the main thread.
+//! @param maxThreads: maximum number of actor threads (if zero
+//!                    use the number of hardware threads).
+//! @param capacity: maximum number of messages waiting to be read
+//!                  in each direction of the channels.
+XC::ThreadMachineBroker::ThreadMachineBroker(FEM_ObjectBroker *theBroker, const size_t &maxThreads, const size_t &capacity)
+  : MachineBroker(theBroker), maxNumThreads(maxThreads), channelCapacity(capacity), theDomain(nullptr)
+  {
+    if(maxNumThreads==0)
+      maxNumThreads= std::max(1U, std::thread::hardware_concurrency());
+  }
+
+//! @brief Destructor (stops the actor threads).
+XC::ThreadMachineBroker::~ThreadMachineBroker(void)
+  { shutdown(); }
+
+//! @brief Return the identifier of the current process.
+int XC::ThreadMachineBroker::getPID(void)
+  { return 0; }
+
+//! @brief Return the number of processes (main thread and actor threads).
+int XC::ThreadMachineBroker::getNP(void)
+  { return maxNumThreads+1; }
+
+//! @brief Return the number of actor threads running.
+size_t XC::ThreadMachineBroker::getNumThreads(void) const
+  { return actorThreads.size(); }
+
+//! @brief Set the domain whose elements will be analyzed by the
+//! subdomain actors (see startActor).
+void XC::ThreadMachineBroker::setDomain(Domain *dom)
+  { theDomain= dom; }
+
+//! @brief Start an actor of the given type on one of the actor
+//! threads and return the channel to communicate with it.
+//!
+//! The subdomain actors determine the state of their elements while
+//! other threads do the same, so they are started only if all the
+//! elements of the domain allow it (see
+//! Element::allowsConcurrentStateDetermination).
+//!
+//! @param actorType: type of the actor (see classTags.h).
+//! @param compDemand: computational demand (ignored).
+XC::Channel *XC::ThreadMachineBroker::startActor(int actorType, int compDemand)
+  {
+    if(actorType==ACTOR_TAGS_SUBDOMAIN)
+      {
+        if(!theDomain)
+          {
+            std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+                      << "; domain not set, can't check that the elements"
+                      << " are reentrant. Subdomain actor not started."
+                      << std::endl;
+            return nullptr;
+          }
+        if(!theDomain->getMesh().allowsConcurrentStateDetermination())
+          {
+            std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+                      << "; some elements of the domain don't allow"
+                      << " concurrent state determination."
+                      << " Subdomain actor not started." << std::endl;
+            return nullptr;
+          }
+      }
+    return MachineBroker::startActor(actorType, compDemand);
+  }
+
+//! @brief Send the termination notice to the actor threads and wait
+//! for them to finish.
+int XC::ThreadMachineBroker::shutdown(void)
+  {
+    int retval= 0;
+    for(std::deque<ActorThread>::iterator i= actorThreads.begin(); i!=actorThreads.end(); i++)
+      {
+        ID idData(1);
+        idData(0)= 0;
+        if((*i).local.sendID(0, 0, idData) < 0)
+          {
+            std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+                      << "; failed to send ID." << std::endl;
+            retval= -1;
+          }
+        else if((*i).local.recvID(0, 0, idData) < 0)
+          {
+            std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+                      << "; failed to recv ID." << std::endl;
+            retval= -1;
+          }
+        if((*i).thread.joinable())
+          (*i).thread.join();
+      }
+    actorThreads.clear();
+    clear_actor_channels();
+    return retval;
+  }
+
+//! @brief The actors run on threads of the main process, so there is
+//! no channel to receive actor requests from.
+XC::Channel *XC::ThreadMachineBroker::getMyChannel(void)
+  {
+    std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+              << "; the actors are started by the main thread."
+              << std::endl;
+    return nullptr;
+  }
+
+//! @brief Start a new thread running actors and return the channel
+//! to communicate with it.
+//!
+//! The threads are reused by MachineBroker::startActor once the
+//! actor they run has finished (see finishedWithActor).
+XC::Channel *XC::ThreadMachineBroker::getRemoteProcess(void)
+  {
+    if(actorThreads.size()>=maxNumThreads)
+      {
+        std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+                  << "; maximum number of threads: " << maxNumThreads
+                  << " reached." << std::endl;
+        return nullptr;
+      }
+    actorThreads.emplace_back();
+    ActorThread &actorThread= actorThreads.back();
+    actorThread.local.connect(actorThread.remote, channelCapacity);
+    actorThread.thread= std::thread(&MachineBroker::run_actors, std::ref(actorThread.remote), std::ref(actorThread.objectBroker));
+    actorThread.used= true;
+    return &actorThread.local;
+  }
+
+//! @brief Return a pointer to the thread corresponding to the channel
+//! argument (nullptr if not found).
+XC::ThreadMachineBroker::ActorThread *XC::ThreadMachineBroker::find_thread(const Channel *theChannel)
+  {
+    ActorThread *retval= nullptr;
+    for(std::deque<ActorThread>::iterator i= actorThreads.begin(); i!=actorThreads.end(); i++)
+      if(&(*i).local==theChannel)
+        {
+          retval= &(*i);
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Mark the thread corresponding to the channel as free (the
+//! thread keeps running until shutdown is called).
+int XC::ThreadMachineBroker::freeProcess(Channel *theChannel)
+  {
+    ActorThread *actorThread= find_thread(theChannel);
+    if(!actorThread)
+      {
+        std::cerr << "ThreadMachineBroker::" << __FUNCTION__
+                  << "; channel not found." << std::endl;
+        return -1;
+      }
+    actorThread->used= false;
+    return 0;
+  }
@@ -0,0 +1,104 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadMachineBroker.h
+
+#ifndef ThreadMachineBroker_h
+#define ThreadMachineBroker_h
+
+#include "MachineBroker.h"
+#include "utility/actor/channel/ThreadChannel.h"
+#include "utility/actor/objectBroker/FEM_ObjectBroker.h"
+#include <deque>
+#include <thread>
+
+namespace XC {
+class Domain;
+
+//! @ingroup IPComm
+//
+//! @brief Machine broker that runs the actors on threads of the
+//! current process.
+//!
+//! Each actor thread runs its own copy of the actor loop (see
+//! MachineBroker::run_actors) with its own object broker and
+//! communicates with the main thread through a ThreadChannel, so
+//! the subdomains of a PartitionedDomain can be analyzed in
+//! parallel without MPI or sockets.
+//!
+//! The actor threads share the address space (and the static
+//! scratch objects) of the main process, so subdomain actors are
+//! started only if a domain has been set (see setDomain) and all its
+//! elements allow concurrent state determination (see
+//! Mesh::allowsConcurrentStateDetermination). Otherwise startActor
+//! refuses to start them and returns a null pointer.
+class ThreadMachineBroker: public MachineBroker
+  {
+  private:
+    //! @brief Thread running actors.
+    struct ActorThread
+      {
+        ThreadChannel local; //!< end of the channel used by the main thread.
+        ThreadChannel remote; //!< end of the channel used by the actor thread.
+        FEM_ObjectBroker objectBroker; //!< object broker of the actor thread.
+        std::thread thread; //!< thread running the actors.
+        bool used; //!< true if the thread has been assigned to an actor.
+        ActorThread(void)
+          : used(false) {}
+      };
+    std::deque<ActorThread> actorThreads; //!< threads running actors.
+    size_t maxNumThreads; //!< maximum number of actor threads.
+    size_t channelCapacity; //!< capacity of the message rings.
+    Domain *theDomain; //!< domain analyzed by the subdomain actors.
+
+    ThreadMachineBroker(const ThreadMachineBroker &);
+    ThreadMachineBroker &operator=(const ThreadMachineBroker &);
+  protected:
+    ActorThread *find_thread(const Channel *);
+  public:
+    ThreadMachineBroker(FEM_ObjectBroker *, const size_t &maxNumThreads= 0, const size_t &channelCapacity= 32);
+    ~ThreadMachineBroker(void);
+
+    // methods to return info about local process id and num processes
+    int getPID(void);
+    int getNP(void);
+    size_t getNumThreads(void) const;
+
+    void setDomain(Domain *);
+    int shutdown(void);
+
+    // methods to get and free Actors
+    Channel *startActor(int actorType, int compDemand = 0);
+
+    // methods to get and free Channels (processes)
+    Channel *getMyChannel(void);
+    Channel *getRemoteProcess(void);
+    int freeProcess(Channel *);
+  };
+} // end of XC namespace
+
+#endif
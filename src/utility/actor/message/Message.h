@@ -93,6 +93,7 @@ class Message
     friend class TCP_SocketNoDelay;
     friend class UDP_Socket;
     friend class MPI_Channel;
+    friend class ThreadChannel;
   };
 } // end of XC namespace
 
@@ -102,6 +102,8 @@ XC::Actor *XC::FEM_ObjectBroker::getNewActor(int classTag, Channel *theChannel)
   case ACTOR_TAGS_SUBDOMAIN:
     return new ActorSubdomain(*theChannel, *this,nullptr);
 #endif
+  case ACTOR_TAGS_SUBSTRUCTURE:
+    return new FullGenLinSubstrActor(*theChannel, *this);
 
   default:
     std::cerr << Color::red << "FEM_ObjectBroker::" << __FUNCTION__
@@ -144,6 +146,8 @@ XC::GraphNumberer *XC::FEM_ObjectBroker::getPtrNewGraphNumberer(int classTag)
         return new MyRCM();
       case GraphNUMBERER_TAG_SimpleNumberer:
         return new SimpleNumberer();
+      case GraphNUMBERER_TAG_NestedDissection:
+        return new NestedDissection();
       default:
         std::cerr << Color::red << "FEM_ObjectBroker::" << __FUNCTION__
 		  << "; no GraphNumberer type exists for class tag "
@@ -1424,6 +1428,14 @@ XC::LinearSOE *XC::FEM_ObjectBroker::getNewLinearSOE(int classTagSOE, int classT
             lastLinearSolver = theGenSolver;
             return theSOE;
           }
+        else if(classTagSolver == SOLVER_TAGS_FullGenLinSubstrThreadSolver)
+          {
+            theGenSolver = new FullGenLinSubstrThreadSolver();
+            theSOE = new FullGenLinSOE(nullptr);
+            theSOE->setSolver(theGenSolver);
+            lastLinearSolver = theGenSolver;
+            return theSOE;
+          }
         else
           {
             std::cerr << Color::red << "FEM_ObjectBroker::" << __FUNCTION__
@@ -1460,6 +1472,14 @@ XC::LinearSOE *XC::FEM_ObjectBroker::getNewLinearSOE(int classTagSOE, int classT
               lastLinearSolver = theBandSPDSolver;
               return theSOE;
             }
+          else if(classTagSolver == SOLVER_TAGS_BandSPDLinThreadSolver)
+            {
+              theBandSPDSolver = new BandSPDLinThreadSolver();
+              theSOE= new BandSPDLinSOE(nullptr);
+              theSOE->setSolver(theBandSPDSolver);
+              lastLinearSolver = theBandSPDSolver;
+              return theSOE;
+            }
           else
             {
               std::cerr << Color::red << "FEM_ObjectBroker::" << __FUNCTION__
@@ -1479,6 +1499,14 @@ XC::LinearSOE *XC::FEM_ObjectBroker::getNewLinearSOE(int classTagSOE, int classT
               lastLinearSolver = theProfileSPDSolver;
               return theSOE;
             }
+          else if(classTagSolver == SOLVER_TAGS_ProfileSPDLinDirectThreadSolver)
+            {
+              theProfileSPDSolver = new ProfileSPDLinDirectThreadSolver();
+              theSOE= new ProfileSPDLinSOE(nullptr);
+              theSOE->setSolver(theProfileSPDSolver);
+              lastLinearSolver = theProfileSPDSolver;
+              return theSOE;
+            }
           else if(classTagSolver == SOLVER_TAGS_ProfileSPDLinSubstrSolver)
             {
               theProfileSPDSolver = new ProfileSPDLinSubstrSolver();
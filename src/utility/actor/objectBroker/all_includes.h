@@ -4,6 +4,7 @@
 
 // ActorTypes
 #include "domain/domain/subdomain/ActorSubdomain.h"
+#include "solution/system_of_eqn/linearSOE/fullGEN/FullGenLinSubstrActor.h"
 
 // Convergence tests
 #include "solution/analysis/convergenceTest/convergence_tests.h"
@@ -14,6 +15,7 @@
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/MyRCM.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
+#include "solution/graph/numberer/NestedDissection.h"
 
 
 // uniaxial material model header files
@@ -541,5 +543,7 @@
 #include "utility/database/NEESData.h"
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/FileDatastore.h"
+#include "utility/database/ResultsStoreWriter.h"
+#include "utility/database/ResultsStoreReader.h"
 
 #endif
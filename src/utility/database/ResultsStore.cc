@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStore.cc
+
+#include "ResultsStore.h"
+#include "utility/kernel/python_utils.h"
+
+const char XC::ResultsStore::magic[8]= {'X','C','R','S','T','O','R','E'};
+
+//! @brief Constructor.
+XC::ResultsStore::ResultsStore(void)
+  : CommandEntity(), numCombinations(0), dataOffset(0) {}
+
+//! @brief Return the size in bytes of a combination block.
+size_t XC::ResultsStore::get_block_size(void) const
+  { return combNameSize+sizeof(double)*getNumEntities()*getNumComponents(); }
+
+//! @brief Return the offset in bytes of the block of the i-th combination.
+size_t XC::ResultsStore::get_block_offset(const size_t &i) const
+  { return dataOffset+i*get_block_size(); }
+
+//! @brief Return the index of the component with the given name
+//! (-1 if not found).
+int XC::ResultsStore::getComponentIndex(const std::string &name) const
+  {
+    int retval= -1;
+    for(size_t i= 0;i<componentNames.size();i++)
+      if(componentNames[i]==name)
+        {
+          retval= i;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Return the tags of the entities in a Python list.
+boost::python::list XC::ResultsStore::getTagsPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<int64_t>::const_iterator i= tags.begin();i!=tags.end();i++)
+      retval.append(int(*i));
+    return retval;
+  }
+
+//! @brief Return the names of the components in a Python list.
+boost::python::list XC::ResultsStore::getComponentNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= componentNames.begin();i!=componentNames.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Return the labels of the entities in a Python list.
+boost::python::list XC::ResultsStore::getLabelsPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= labels.begin();i!=labels.end();i++)
+      retval.append(*i);
+    return retval;
+  }
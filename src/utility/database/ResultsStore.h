@@ -0,0 +1,98 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStore.h
+
+#ifndef ResultsStore_h
+#define ResultsStore_h
+
+#include "utility/kernel/CommandEntity.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace XC {
+
+//! @brief Binary file that stores the results (internal forces,
+//! displacements, reactions,...) of a set of entities (elements,
+//! nodes,...) for a sequence of load combinations.
+//! @ingroup Database
+//!
+//! File layout (native byte order):
+//! - header: magic string, version, number of entities, number of
+//!   components, number of combinations and offset of the first
+//!   combination block (eight 64 bit words).
+//! - tags of the entities (64 bit integers).
+//! - names of the components and labels of the entities (32 bit
+//!   length followed by the characters), padded to 8 bytes.
+//! - one block per combination: name of the combination (fixed size
+//!   field) followed by the values of the components of each entity
+//!   (entity-major order).
+//!
+//! Since all the blocks have the same size, the values of any entity,
+//! component and combination are read without parsing the file.
+class ResultsStore: public CommandEntity
+  {
+  public:
+    static const char magic[8]; //!< file identifier.
+    static const uint64_t version= 1; //!< file format version.
+    static const size_t headerSize= 8*sizeof(uint64_t); //!< size of the fixed header.
+    static const size_t combNameSize= 128; //!< size of the combination name field.
+  protected:
+    std::string fileName; //!< name of the file.
+    std::vector<int64_t> tags; //!< tags of the entities.
+    std::vector<std::string> componentNames; //!< names of the components.
+    std::vector<std::string> labels; //!< labels of the entities (element type,...).
+    size_t numCombinations; //!< number of combinations in the file.
+    uint64_t dataOffset; //!< offset of the first combination block.
+
+    size_t get_block_size(void) const;
+    size_t get_block_offset(const size_t &) const;
+  public:
+    ResultsStore(void);
+
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+    inline size_t getNumEntities(void) const
+      { return tags.size(); }
+    inline size_t getNumComponents(void) const
+      { return componentNames.size(); }
+    inline size_t getNumCombinations(void) const
+      { return numCombinations; }
+    inline const std::vector<std::string> &getComponentNames(void) const
+      { return componentNames; }
+    inline const std::vector<std::string> &getLabels(void) const
+      { return labels; }
+    int getComponentIndex(const std::string &) const;
+    boost::python::list getTagsPy(void) const;
+    boost::python::list getComponentNamesPy(void) const;
+    boost::python::list getLabelsPy(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
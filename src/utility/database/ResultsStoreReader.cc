@@ -0,0 +1,317 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStoreReader.cc
+
+#include "ResultsStoreReader.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//! @brief Constructor.
+XC::ResultsStoreReader::ResultsStoreReader(void)
+  : ResultsStore(), mapped(nullptr), mappedSize(0) {}
+
+//! @brief Destructor.
+XC::ResultsStoreReader::~ResultsStoreReader(void)
+  { close(); }
+
+//! @brief Read the header of the mapped file.
+bool XC::ResultsStoreReader::read_header(void)
+  {
+    if((mappedSize<headerSize) || (memcmp(mapped, magic, sizeof(magic))!=0))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; file: '" << fileName
+                  << "' is not a results store." << std::endl;
+        return false;
+      }
+    uint64_t header[7];
+    memcpy(header, mapped+sizeof(magic), sizeof(header));
+    if(header[0]!=version)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; unknown version: " << header[0]
+                  << " of file: '" << fileName << "'." << std::endl;
+        return false;
+      }
+    const size_t numEntities= header[1];
+    const size_t numComponents= header[2];
+    numCombinations= header[3];
+    dataOffset= header[4];
+    // tags.
+    if(dataOffset>mappedSize)
+      return false;
+    const char *ptr= mapped+headerSize;
+    const char *end= mapped+dataOffset;
+    if(ptr+sizeof(int64_t)*numEntities>end)
+      return false;
+    tags.resize(numEntities);
+    memcpy(tags.data(), ptr, sizeof(int64_t)*numEntities);
+    ptr+= sizeof(int64_t)*numEntities;
+    // component names and entity labels.
+    std::vector<std::string> strings(numComponents+numEntities);
+    for(std::vector<std::string>::iterator i= strings.begin();i!=strings.end();i++)
+      {
+        uint32_t l= 0;
+        if(ptr+sizeof(l)>end)
+          return false;
+        memcpy(&l, ptr, sizeof(l));
+        ptr+= sizeof(l);
+        if(ptr+l>end)
+          return false;
+        i->assign(ptr, l);
+        ptr+= l;
+      }
+    componentNames.assign(strings.begin(), strings.begin()+numComponents);
+    labels.assign(strings.begin()+numComponents, strings.end());
+    // ignore incomplete blocks.
+    const size_t blockSize= get_block_size();
+    numCombinations= std::min(numCombinations, (mappedSize-dataOffset)/blockSize);
+    rows.clear();
+    rows.reserve(numEntities);
+    for(size_t i= 0;i<numEntities;i++)
+      rows[tags[i]]= i;
+    combNames.resize(numCombinations);
+    for(size_t i= 0;i<numCombinations;i++)
+      {
+        const char *name= mapped+get_block_offset(i);
+        combNames[i]= std::string(name, strnlen(name, combNameSize));
+      }
+    return true;
+  }
+
+//! @brief Open the file and map it in memory.
+bool XC::ResultsStoreReader::open(const std::string &fName)
+  {
+    close();
+    fileName= fName;
+    const int fd= ::open(fileName.c_str(), O_RDONLY);
+    if(fd<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'."
+                  << std::endl;
+        return false;
+      }
+    struct stat st;
+    bool retval= false;
+    if((fstat(fd, &st)==0) && (st.st_size>0))
+      {
+        void *ptr= mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if(ptr!=MAP_FAILED)
+          {
+            mapped= static_cast<const char *>(ptr);
+            mappedSize= st.st_size;
+            retval= read_header();
+          }
+      }
+    ::close(fd); // the mapping remains valid.
+    if(!retval)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't read file: '" << fileName << "'."
+                  << std::endl;
+        close();
+      }
+    return retval;
+  }
+
+//! @brief Unmap the file.
+void XC::ResultsStoreReader::close(void)
+  {
+    if(mapped)
+      munmap(const_cast<char *>(mapped), mappedSize);
+    mapped= nullptr;
+    mappedSize= 0;
+    tags.clear();
+    componentNames.clear();
+    labels.clear();
+    combNames.clear();
+    rows.clear();
+    numCombinations= 0;
+  }
+
+//! @brief Return a pointer to the values of the entity for the
+//! given combination (both zero-based indexes).
+const double *XC::ResultsStoreReader::get_values_ptr(const size_t &entityIdx, const size_t &combIdx) const
+  {
+    const char *ptr= mapped+get_block_offset(combIdx)+combNameSize+sizeof(double)*entityIdx*getNumComponents();
+    return reinterpret_cast<const double *>(ptr);
+  }
+
+//! @brief Return the names of the combinations in a Python list.
+boost::python::list XC::ResultsStoreReader::getCombinationNamesPy(void) const
+  {
+    boost::python::list retval;
+    for(std::vector<std::string>::const_iterator i= combNames.begin();i!=combNames.end();i++)
+      retval.append(*i);
+    return retval;
+  }
+
+//! @brief Return the index of the combination with the given name
+//! (-1 if not found).
+int XC::ResultsStoreReader::getCombinationIndex(const std::string &name) const
+  {
+    int retval= -1;
+    for(size_t i= 0;i<combNames.size();i++)
+      if(combNames[i]==name)
+        {
+          retval= i;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Return the position of the entity with the given tag
+//! (-1 if not found).
+int XC::ResultsStoreReader::getEntityIndex(const int &tag) const
+  {
+    int retval= -1;
+    tag_map::const_iterator i= rows.find(tag);
+    if(i!=rows.end())
+      retval= i->second;
+    return retval;
+  }
+
+//! @brief Return the value of a component of an entity for a combination.
+//!
+//! @param tag: tag of the entity.
+//! @param combIdx: index of the combination.
+//! @param compIdx: index of the component.
+double XC::ResultsStoreReader::getValue(const int &tag, const int &combIdx, const int &compIdx) const
+  {
+    double retval= 0.0;
+    const int entityIdx= getEntityIndex(tag);
+    if((entityIdx<0) || (combIdx<0) || (size_t(combIdx)>=numCombinations) || (compIdx<0) || (size_t(compIdx)>=getNumComponents()))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; index out of range (tag: " << tag
+                << " combination: " << combIdx
+                << " component: " << compIdx << ")." << std::endl;
+    else
+      memcpy(&retval, get_values_ptr(entityIdx, combIdx)+compIdx, sizeof(double));
+    return retval;
+  }
+
+//! @brief Return the values of the components of an entity for a combination.
+//!
+//! @param tag: tag of the entity.
+//! @param combIdx: index of the combination.
+XC::Vector XC::ResultsStoreReader::getEntityCombinationValues(const int &tag, const int &combIdx) const
+  {
+    const size_t numComponents= getNumComponents();
+    Vector retval(numComponents);
+    const int entityIdx= getEntityIndex(tag);
+    if((entityIdx<0) || (combIdx<0) || (size_t(combIdx)>=numCombinations))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; index out of range (tag: " << tag
+                << " combination: " << combIdx << ")." << std::endl;
+    else if(numComponents>0)
+      memcpy(retval.getDataPtr(), get_values_ptr(entityIdx, combIdx), sizeof(double)*numComponents);
+    return retval;
+  }
+
+//! @brief Return the values of an entity for all the combinations
+//! (a row for each combination).
+//!
+//! @param tag: tag of the entity.
+XC::Matrix XC::ResultsStoreReader::getEntityValues(const int &tag) const
+  {
+    const size_t numComponents= getNumComponents();
+    Matrix retval(numCombinations, numComponents);
+    const int entityIdx= getEntityIndex(tag);
+    if(entityIdx<0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; entity: " << tag << " not found." << std::endl;
+    else
+      for(size_t i= 0;i<numCombinations;i++)
+        {
+          const double *ptr= get_values_ptr(entityIdx, i);
+          for(size_t j= 0;j<numComponents;j++)
+            retval(i,j)= ptr[j];
+        }
+    return retval;
+  }
+
+//! @brief Return the values of all the entities for a combination
+//! (a row for each entity).
+//!
+//! @param combIdx: index of the combination.
+XC::Matrix XC::ResultsStoreReader::getCombinationValues(const int &combIdx) const
+  {
+    const size_t numEntities= getNumEntities();
+    const size_t numComponents= getNumComponents();
+    Matrix retval(numEntities, numComponents);
+    if((combIdx<0) || (size_t(combIdx)>=numCombinations))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; combination index: " << combIdx
+                << " out of range." << std::endl;
+    else
+      {
+        const double *ptr= get_values_ptr(0, combIdx);
+        for(size_t i= 0;i<numEntities;i++)
+          for(size_t j= 0;j<numComponents;j++)
+            retval(i,j)= *ptr++;
+      }
+    return retval;
+  }
+
+//! @brief Return the values of the given entities for a combination
+//! (a row for each entity, in the order of the argument).
+//!
+//! @param entityTags: tags of the entities.
+//! @param combIdx: index of the combination.
+XC::Matrix XC::ResultsStoreReader::getSubset(const ID &entityTags, const int &combIdx) const
+  {
+    const size_t numComponents= getNumComponents();
+    const size_t numRows= entityTags.Size();
+    Matrix retval(numRows, numComponents);
+    if((combIdx<0) || (size_t(combIdx)>=numCombinations))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; combination index: " << combIdx
+                << " out of range." << std::endl;
+    else
+      for(size_t i= 0;i<numRows;i++)
+        {
+          const int entityIdx= getEntityIndex(entityTags[i]);
+          if(entityIdx<0)
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; entity: " << entityTags[i]
+                      << " not found." << std::endl;
+          else
+            {
+              const double *ptr= get_values_ptr(entityIdx, combIdx);
+              for(size_t j= 0;j<numComponents;j++)
+                retval(i,j)= ptr[j];
+            }
+        }
+    return retval;
+  }
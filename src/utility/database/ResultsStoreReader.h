@@ -0,0 +1,83 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStoreReader.h
+
+#ifndef ResultsStoreReader_h
+#define ResultsStoreReader_h
+
+#include "ResultsStore.h"
+#include <unordered_map>
+
+namespace XC {
+class ID;
+class Vector;
+class Matrix;
+
+//! @brief Read the results stored in a results store file
+//! (see ResultsStore).
+//! @ingroup Database
+//!
+//! The file is mapped in memory, so only the pages that contain
+//! the requested values are read from disk.
+class ResultsStoreReader: public ResultsStore
+  {
+  private:
+    typedef std::unordered_map<int, size_t> tag_map;
+    const char *mapped; //!< start of the mapped file.
+    size_t mappedSize; //!< size of the mapped file.
+    tag_map rows; //!< position of each tag.
+    std::vector<std::string> combNames; //!< names of the combinations.
+
+    bool read_header(void);
+    const double *get_values_ptr(const size_t &, const size_t &) const;
+    size_t get_combination_index(const int &) const;
+  public:
+    ResultsStoreReader(void);
+    ~ResultsStoreReader(void);
+
+    bool open(const std::string &);
+    inline bool isOpen(void) const
+      { return (mapped!=nullptr); }
+    void close(void);
+
+    inline const std::vector<std::string> &getCombinationNames(void) const
+      { return combNames; }
+    boost::python::list getCombinationNamesPy(void) const;
+    int getCombinationIndex(const std::string &) const;
+    int getEntityIndex(const int &) const;
+
+    double getValue(const int &, const int &, const int &) const;
+    Vector getEntityCombinationValues(const int &, const int &) const;
+    Matrix getEntityValues(const int &) const;
+    Matrix getCombinationValues(const int &) const;
+    Matrix getSubset(const ID &, const int &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,181 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStoreWriter.cc
+
+#include "ResultsStoreWriter.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/kernel/python_utils.h"
+#include <cstring>
+
+//! @brief Constructor.
+XC::ResultsStoreWriter::ResultsStoreWriter(void)
+  : ResultsStore() {}
+
+//! @brief Destructor.
+XC::ResultsStoreWriter::~ResultsStoreWriter(void)
+  { close(); }
+
+//! @brief Write the header, the tags, the component names and the
+//! labels of the entities.
+void XC::ResultsStoreWriter::write_header(void)
+  {
+    // compute the offset of the first block.
+    uint64_t sz= headerSize+sizeof(int64_t)*tags.size();
+    for(std::vector<std::string>::const_iterator i= componentNames.begin();i!=componentNames.end();i++)
+      sz+= sizeof(uint32_t)+i->size();
+    for(std::vector<std::string>::const_iterator i= labels.begin();i!=labels.end();i++)
+      sz+= sizeof(uint32_t)+i->size();
+    dataOffset= ((sz+7)/8)*8;
+
+    const uint64_t header[7]= {version, tags.size(), componentNames.size(), 0, dataOffset, 0, 0};
+    out.write(magic, sizeof(magic));
+    out.write(reinterpret_cast<const char *>(header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(tags.data()), sizeof(int64_t)*tags.size());
+    for(std::vector<std::string>::const_iterator i= componentNames.begin();i!=componentNames.end();i++)
+      {
+        const uint32_t l= i->size();
+        out.write(reinterpret_cast<const char *>(&l), sizeof(l));
+        out.write(i->data(), l);
+      }
+    for(std::vector<std::string>::const_iterator i= labels.begin();i!=labels.end();i++)
+      {
+        const uint32_t l= i->size();
+        out.write(reinterpret_cast<const char *>(&l), sizeof(l));
+        out.write(i->data(), l);
+      }
+    const char padding[8]= {0,0,0,0,0,0,0,0};
+    out.write(padding, dataOffset-sz);
+  }
+
+//! @brief Update the number of combinations in the header.
+void XC::ResultsStoreWriter::write_num_combinations(void)
+  {
+    const uint64_t n= numCombinations;
+    out.seekp(sizeof(magic)+3*sizeof(uint64_t));
+    out.write(reinterpret_cast<const char *>(&n), sizeof(n));
+    out.seekp(0, std::ios::end);
+    out.flush();
+  }
+
+//! @brief Create the file (overwriting it if it already exists).
+//!
+//! @param fName: name of the file.
+//! @param entityTags: tags of the entities (elements, nodes,...).
+//! @param components: names of the components stored for each entity.
+//! @param entityLabels: labels of the entities (can be empty).
+bool XC::ResultsStoreWriter::open(const std::string &fName, const ID &entityTags, const std::vector<std::string> &components, const std::vector<std::string> &entityLabels)
+  {
+    close();
+    if(!entityLabels.empty() && (entityLabels.size()!=size_t(entityTags.Size())))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the number of labels: " << entityLabels.size()
+                  << " doesn't match the number of entities: "
+                  << entityTags.Size() << std::endl;
+        return false;
+      }
+    fileName= fName;
+    tags.assign(entityTags.begin(), entityTags.end());
+    componentNames= components;
+    labels= entityLabels;
+    if(labels.empty())
+      labels.resize(tags.size());
+    numCombinations= 0;
+    out.open(fileName.c_str(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!out)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'."
+                  << std::endl;
+        return false;
+      }
+    write_header();
+    out.flush();
+    return out.good();
+  }
+
+//! @brief Create the file (overwriting it if it already exists).
+//!
+//! @param fName: name of the file.
+//! @param entityTags: tags of the entities (elements, nodes,...).
+//! @param components: names of the components stored for each entity.
+//! @param entityLabels: labels of the entities (can be empty).
+bool XC::ResultsStoreWriter::openPy(const std::string &fName, const ID &entityTags, const boost::python::list &components, const boost::python::list &entityLabels)
+  { return open(fName, entityTags, vector_string_from_py_list(components), vector_string_from_py_list(entityLabels)); }
+
+//! @brief Append the results of a combination.
+//!
+//! @param combName: name of the combination (up to combNameSize-1 characters).
+//! @param values: matrix with a row for each entity (in the order of the
+//!                tags) and a column for each component.
+bool XC::ResultsStoreWriter::appendCombination(const std::string &combName, const Matrix &values)
+  {
+    if(!isOpen())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; file not open." << std::endl;
+        return false;
+      }
+    const size_t numEntities= getNumEntities();
+    const size_t numComponents= getNumComponents();
+    if((size_t(values.noRows())!=numEntities) || (size_t(values.noCols())!=numComponents))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; matrix dimensions: " << values.noRows()
+                  << "x" << values.noCols() << " don't match the store: "
+                  << numEntities << "x" << numComponents
+                  << std::endl;
+        return false;
+      }
+    if(combName.size()>=combNameSize)
+      std::clog << getClassName() << "::" << __FUNCTION__
+                << "; WARNING combination name: '" << combName
+                << "' too long, it will be truncated." << std::endl;
+    char name[combNameSize];
+    memset(name, 0, combNameSize);
+    strncpy(name, combName.c_str(), combNameSize-1);
+    out.write(name, combNameSize);
+    // entity-major order.
+    std::vector<double> row(numComponents);
+    for(size_t i= 0;i<numEntities;i++)
+      {
+        for(size_t j= 0;j<numComponents;j++)
+          row[j]= values(i,j);
+        out.write(reinterpret_cast<const char *>(row.data()), sizeof(double)*numComponents);
+      }
+    numCombinations++;
+    write_num_combinations();
+    return out.good();
+  }
+
+//! @brief Close the file.
+void XC::ResultsStoreWriter::close(void)
+  {
+    if(out.is_open())
+      out.close();
+  }
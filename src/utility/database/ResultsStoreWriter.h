@@ -0,0 +1,67 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultsStoreWriter.h
+
+#ifndef ResultsStoreWriter_h
+#define ResultsStoreWriter_h
+
+#include "ResultsStore.h"
+#include <fstream>
+
+namespace XC {
+class ID;
+class Matrix;
+
+//! @brief Write the results of a sequence of load combinations
+//! in a results store file (see ResultsStore).
+//! @ingroup Database
+//!
+//! The number of combinations in the header is updated after
+//! each block is written, so the file can be read at any time.
+class ResultsStoreWriter: public ResultsStore
+  {
+  private:
+    std::fstream out; //!< output stream.
+
+    void write_header(void);
+    void write_num_combinations(void);
+  public:
+    ResultsStoreWriter(void);
+    ~ResultsStoreWriter(void);
+
+    bool open(const std::string &, const ID &, const std::vector<std::string> &, const std::vector<std::string> &);
+    bool openPy(const std::string &, const ID &, const boost::python::list &, const boost::python::list &);
+    inline bool isOpen(void) const
+      { return out.is_open(); }
+    bool appendCombination(const std::string &, const Matrix &);
+    void close(void);
+  };
+
+} // end of XC namespace
+
+#endif
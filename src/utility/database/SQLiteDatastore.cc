@@ -27,14 +27,15 @@
 // SQLiteDatastore.cpp
 
 #include <utility/database/SQLiteDatastore.h>
-#include "utility/sqlite/SqLiteQuery.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/ID.h>
 #include "boost/lexical_cast.hpp"
+#include <zlib.h>
+#include <cstring>
 
 XC::SQLiteDatastore::SQLiteDatastore(const std::string &projectName, Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker, int run)
-  :DBDatastore(projectName, preprocessor, theObjectBroker), connection(false), db(projectName)
+  :DBDatastore(projectName, preprocessor, theObjectBroker), connection(false), db(projectName), dbQuery(db), matrices("Matrices"), vectors("Vectors"), ids("IDs"), compressionLevel(0), inTransaction(false)
   {
     if(this->createOpenSeesDatabase(projectName) == 0)
       connection= true;
@@ -42,6 +43,33 @@ XC::SQLiteDatastore::SQLiteDatastore(const std::string &projectName, Preprocesso
       std::cerr << "SQLiteDatastore::SQLiteDatastore() - could not open the database\n";
   }
 
+//! @brief Destructor.
+XC::SQLiteDatastore::~SQLiteDatastore(void)
+  {
+    if(inTransaction)
+      end_transaction(true);
+    finalize_statements(matrices);
+    finalize_statements(vectors);
+    finalize_statements(ids);
+  }
+
+//! @brief Return the zlib compression level of the BLOBs
+//! (0: no compression).
+int XC::SQLiteDatastore::getCompressionLevel(void) const
+  { return compressionLevel; }
+
+//! @brief Set the zlib compression level of the BLOBs
+//! (0: no compression, 1: best speed, 9: best compression).
+void XC::SQLiteDatastore::setCompressionLevel(const int &level)
+  {
+    if((level<0) || (level>9))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; compression level: " << level
+                << " out of range [0,9]; ignored." << std::endl;
+    else
+      compressionLevel= level;
+  }
+
 int XC::SQLiteDatastore::sendMsg(int dataTag, int commitTag,const XC::Message &,ChannelAddress *theAddress)
   {
     std::cerr << "SQLiteDatastore::sendMsg() - not yet implemented\n";
@@ -54,62 +82,186 @@ int XC::SQLiteDatastore::recvMsg(int dataTag, int commitTag, Message &, ChannelA
     return -1;
   }
 
-//! @brief Inserts data on a BLOB field.
-bool XC::SQLiteDatastore::insertData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &typeSize)
+//! @brief Return a prepared statement for the SQL argument.
+sqlite3_stmt *XC::SQLiteDatastore::prepare(const std::string &sql)
   {
-    const int numBytes= sz*typeSize;
-    query= "INSERT INTO " + tbName + " VALUES (" + boost::lexical_cast<std::string>(dbTag) + ",";
-    query+= boost::lexical_cast<std::string>(commitTag) + ",";
-    query+= boost::lexical_cast<std::string>(sz) + ",?)";
-    return db.getDefaultQuery()->insert_blob1(query,blobData,numBytes);
+    sqlite3_stmt *retval= nullptr;
+    sqlite3 *conn= dbQuery.getConnection();
+    if(conn)
+      {
+        if(sqlite3_prepare_v2(conn, sql.c_str(), -1, &retval, nullptr) != SQLITE_OK)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; can't prepare statement: " << sql
+                      << " error: " << sqlite3_errmsg(conn) << std::endl;
+            sqlite3_finalize(retval);
+            retval= nullptr;
+          }
+      }
+    return retval;
   }
 
-//! @brief Updates data o a BLOB field.
-bool XC::SQLiteDatastore::updateData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &typeSize)
+//! @brief Prepare the statements used to write and read the
+//! BLOBs of the table.
+bool XC::SQLiteDatastore::prepare_statements(BlobTable &table)
   {
-    const int numBytes= sz*typeSize;
-    query= "UPDATE " + tbName + " SET data= ? WHERE dbTag= " + boost::lexical_cast<std::string>(dbTag);
-    query+= " AND commitTag= " + boost::lexical_cast<std::string>(commitTag) + " AND size= ";
-    query+= boost::lexical_cast<std::string>(sz);
-    return db.getDefaultQuery()->insert_blob1(query,blobData,numBytes);
+    if(!table.insertStmt)
+      table.insertStmt= prepare("INSERT OR REPLACE INTO " + table.name + " (dbTag, commitTag, size, data) VALUES (?,?,?,?)");
+    if(!table.selectStmt)
+      table.selectStmt= prepare("SELECT data FROM " + table.name + " WHERE dbTag= ? AND commitTag= ? AND size= ?");
+    return (table.insertStmt && table.selectStmt);
   }
 
-const void *XC::SQLiteDatastore::retrieveData(const std::string &tbName,const int &dbTag,const int &commitTag,const int &sz)
+//! @brief Release the prepared statements of the table.
+void XC::SQLiteDatastore::finalize_statements(BlobTable &table)
   {
-    const void *retval= nullptr;
-    // check that we have a connection
-    if(connection)
-      {
-        // to receive the data the database we do the following:
-        // 1. use SELECT to receive the data from the database
-        // 2. fetch the results from the server and copy to the Matrices data area
-        // 3. clean up the SQLITE_RES datastructure
-
-        // form the SELECT query
-        query= "SELECT data FROM " + tbName + " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTag) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag) + " AND size= " + boost::lexical_cast<std::string>(sz);
+    sqlite3_finalize(table.insertStmt);
+    table.insertStmt= nullptr;
+    sqlite3_finalize(table.selectStmt);
+    table.selectStmt= nullptr;
+  }
 
-        sqlite3_stmt *result= db.getDefaultQuery()->get_result(query);
+//! @brief Write the data in a BLOB field (inserting the row or
+//! replacing the existing one).
+//!
+//! @param table: table to write into.
+//! @param dbTag: object identifier.
+//! @param commitTag: commit identifier.
+//! @param data: pointer to the data.
+//! @param sz: number of items.
+//! @param typeSize: size of each item.
+bool XC::SQLiteDatastore::write_blob(BlobTable &table,const int &dbTag,const int &commitTag,const void *data,const int &sz,const int &typeSize)
+  {
+    if(!connection || !prepare_statements(table))
+      return false;
+    const unsigned char *blobData= static_cast<const unsigned char *>(data);
+    uLongf numBytes= sz*typeSize;
+    if((compressionLevel>0) && (numBytes>0))
+      {
+        uLongf destLen= compressBound(numBytes);
+        buffer.resize(destLen);
+        // Store the compressed data only if they are smaller (so
+        // the size of the BLOB tells if it's compressed or not).
+        if((compress2(buffer.data(), &destLen, blobData, numBytes, compressionLevel) == Z_OK) && (destLen<numBytes))
+          {
+            blobData= buffer.data();
+            numBytes= destLen;
+          }
+      }
+    sqlite3_stmt *stmt= table.insertStmt;
+    sqlite3_bind_int(stmt, 1, dbTag);
+    sqlite3_bind_int(stmt, 2, commitTag);
+    sqlite3_bind_int(stmt, 3, sz);
+    sqlite3_bind_blob(stmt, 4, blobData, numBytes, SQLITE_STATIC);
+    const int rc= sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    const bool retval= (rc == SQLITE_DONE);
+    if(!retval)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; failed to write data in table= " << table.name
+                << " for object with dbTag= " << dbTag
+                << " commitTag= " << commitTag << " and size= " << sz
+                << " error: " << sqlite3_errmsg(dbQuery.getConnection())
+                << std::endl;
+    return retval;
+  }
 
-        // fetch the results from the database
-        if(!result)
+//! @brief Read the data from a BLOB field.
+//!
+//! @param table: table to read from.
+//! @param dbTag: object identifier.
+//! @param commitTag: commit identifier.
+//! @param data: pointer to the destination.
+//! @param sz: number of items.
+//! @param typeSize: size of each item.
+bool XC::SQLiteDatastore::read_blob(BlobTable &table,const int &dbTag,const int &commitTag,void *data,const int &sz,const int &typeSize)
+  {
+    if(!connection || !prepare_statements(table))
+      return false;
+    bool retval= false;
+    sqlite3_stmt *stmt= table.selectStmt;
+    sqlite3_bind_int(stmt, 1, dbTag);
+    sqlite3_bind_int(stmt, 2, commitTag);
+    sqlite3_bind_int(stmt, 3, sz);
+    if(sqlite3_step(stmt) == SQLITE_ROW)
+      {
+        const Bytef *blob= static_cast<const Bytef *>(sqlite3_column_blob(stmt, 0));
+        const uLongf blobBytes= sqlite3_column_bytes(stmt, 0);
+        const uLongf numBytes= sz*typeSize;
+        if(blobBytes == numBytes)
           {
-            // no data stored in db with these keys
-            std::cerr << "SQLiteDatastore::retrieveData - no data in table= " << tbName << " for object with dbTag= "
-                      << dbTag << " commitTag= " << commitTag << " and size= " << sz << " query= " << query << std::endl;
+            if(numBytes>0)
+              memcpy(data, blob, numBytes);
+            retval= true;
           }
         else
           {
-            db.getDefaultQuery()->fetch_row();
-            retval= db.getDefaultQuery()->getBlob("data");
+            uLongf destLen= numBytes;
+            retval= (uncompress(static_cast<Bytef *>(data), &destLen, blob, blobBytes) == Z_OK) && (destLen == numBytes);
             if(!retval)
-              {
-                // no vector stored in db with these keys
-                std::cerr << "SQLiteDatastore::retrieveData - no data in table= " << tbName << " for object with dbTag= "
-                      << dbTag << " and commitTag= " << commitTag << " and size= " << sz << " query= " << query << std::endl;
-                db.getDefaultQuery()->free_result();
-              }
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; corrupted data in table= " << table.name
+                        << " for object with dbTag= " << dbTag
+                        << " commitTag= " << commitTag << " and size= " << sz
+                        << std::endl;
           }
       }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; no data in table= " << table.name
+                << " for object with dbTag= " << dbTag
+                << " commitTag= " << commitTag << " and size= " << sz
+                << std::endl;
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    return retval;
+  }
+
+//! @brief Start a transaction if there is not one in progress.
+//! Return true if the transaction has been started.
+bool XC::SQLiteDatastore::begin_transaction(void)
+  {
+    bool retval= false;
+    if(connection && !inTransaction)
+      {
+        retval= (execute("BEGIN TRANSACTION") == 0);
+        inTransaction= retval;
+      }
+    return retval;
+  }
+
+//! @brief Commit (or roll back) the transaction in progress.
+//!
+//! @param commit: if true commit the changes, otherwise roll them back.
+bool XC::SQLiteDatastore::end_transaction(const bool &commit)
+  {
+    bool retval= false;
+    if(inTransaction)
+      {
+        retval= (execute(commit ? "COMMIT" : "ROLLBACK") == 0);
+        inTransaction= false;
+      }
+    return retval;
+  }
+
+//! @brief Save the model state inside a single transaction.
+int XC::SQLiteDatastore::save(const int &commitTag)
+  {
+    const bool ownTransaction= begin_transaction();
+    int retval= DBDatastore::save(commitTag);
+    if(ownTransaction && !end_transaction(retval>=0))
+      retval= -1;
+    return retval;
+  }
+
+//! @brief Restore the model state inside a single transaction.
+int XC::SQLiteDatastore::restore(const int &commitTag)
+  {
+    const bool ownTransaction= begin_transaction();
+    const int retval= DBDatastore::restore(commitTag);
+    if(ownTransaction)
+      end_transaction(true);
     return retval;
   }
 
@@ -118,18 +270,8 @@ int XC::SQLiteDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theM
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::sendMatrix." << std::endl;
     int retval= -1;
-    if(connection)
-      {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= insertData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
-        if(!ok)
-          ok= updateData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
-        if(ok)
-          retval= 0;
-      }
+    if(write_blob(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double)))
+      retval= 0;
     return retval;
   }
 
@@ -138,43 +280,18 @@ int XC::SQLiteDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix,
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::recvMatrix." << std::endl;
     int retval= -1;
-    if(connection)
-      {
-        const void *blob= retrieveData("Matrices",dbTag,commitTag,theMatrix.getDataSize());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const double *blobData = reinterpret_cast<const double *>(blob);
-            double *matrixData= theMatrix.getDataPtr();
-            for(int i=0; i<theMatrix.getDataSize(); i++)
-              matrixData[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
-      }
+    if(read_blob(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double)))
+      retval= 0;
     return retval;
   }
 
-
-
 int XC::SQLiteDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
   {
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::sendVector." << std::endl;
     int retval= -1;
-    if(connection)
-      {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= (insertData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double))!= SQLITE_OK);
-        if(!ok)
-          ok= updateData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
-        if(ok)
-          retval= 0;
-      }
+    if(write_blob(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double)))
+      retval= 0;
     return retval;
   }
 
@@ -183,41 +300,18 @@ int XC::SQLiteDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::recvVector." << std::endl;
     int retval= -1;
-    if(connection)
-      {
-        const void *blob= retrieveData("Vectors",dbTag,commitTag,theVector.Size());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const double *blobData = reinterpret_cast<const double *>(blob);
-            for(int i=0; i<theVector.Size(); i++)
-              theVector[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
-      }
+    if(read_blob(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double)))
+      retval= 0;
     return retval;
   }
 
-
 int XC::SQLiteDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
   {
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::sendID." << std::endl;
     int retval= -1;
-    if(connection)
-      {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= insertData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
-        if(!ok)
-          ok= updateData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
-        if(ok)
-          retval= 0;
-      }
+    if(write_blob(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int)))
+      retval= 0;
     return retval;
   }
 
@@ -226,20 +320,8 @@ int XC::SQLiteDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddres
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::recvID." << std::endl;
     int retval= -1;
-    if(connection)
-      {
-        const void *blob= retrieveData("IDs",dbTag,commitTag,theID.Size());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const int *blobData = reinterpret_cast<const int *>(blob);
-            for(int i=0; i<theID.Size(); i++)
-              theID[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
-      }
+    if(read_blob(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int)))
+      retval= 0;
     return retval;
   }
 
@@ -250,11 +332,11 @@ int XC::SQLiteDatastore::createTable(const std::string &tableName, const std::ve
     if(connection)
       {
         // create the sql query
-        query= "CREATE TABLE " + tableName + " (dbTag INT NOT nullptr, commitTag INT NOT nullptr, ";
+        query= "CREATE TABLE " + tableName + " (dbTag INT NOT NULL, commitTag INT NOT NULL, ";
         for(int j=0; j<numColumns; j++)
-          query+= columns[j] + " DOUBLE NOT nullptr, ";
+          query+= columns[j] + " DOUBLE NOT NULL, ";
         query+= "PRIMARY KEY (dbTag, commitTag) )";
-        db.getDefaultQuery()->execute(query);
+        dbQuery.execute(query);
         return 0;
       }
     else
@@ -276,7 +358,7 @@ int XC::SQLiteDatastore::insertData(const std::string &tableName,const std::vect
         query+= ")";
 
         // execute the query
-        if(db.getDefaultQuery()->execute(query) != SQLITE_OK)
+        if(dbQuery.execute(query) != SQLITE_OK)
           {
           
             // if INSERT fails we reformulate query and try an UPDATE
@@ -287,11 +369,11 @@ int XC::SQLiteDatastore::insertData(const std::string &tableName,const std::vect
             query+= " WHERE dbTag= " + boost::lexical_cast<std::string>(lastDbTag) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag);
 
             // invoke the query on the database
-            if(db.getDefaultQuery()->execute(query) != SQLITE_OK)
+            if(dbQuery.execute(query) != SQLITE_OK)
               {
                 std::cerr << "SQLiteDatastore::insertData() - failed to send the data to SQLite database";
                 std::cerr << query;
-                std::cerr << std::endl << db.getDefaultQuery()->getError() << std::endl;
+                std::cerr << std::endl << dbQuery.getError() << std::endl;
                 return -3;
               }
           }
@@ -319,7 +401,7 @@ int XC::SQLiteDatastore::getData(const std::string &tableName,const std::vector<
         // form the SELECT query
         query= "Select * FROM " + tableName + " WHERE dbTag= " + boost::lexical_cast<std::string>(lastDbTag) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag);
 
-        sqlite3_stmt *result= db.getDefaultQuery()->get_result(query);
+        sqlite3_stmt *result= dbQuery.get_result(query);
 
         // fetch the results from the database
         if(!result)
@@ -331,9 +413,9 @@ int XC::SQLiteDatastore::getData(const std::string &tableName,const std::vector<
         else
           {
             for(int i=0; i<data.Size(); i++)
-              data[i] = db.getDefaultQuery()->getDouble(i);
+              data[i] = dbQuery.getDouble(i);
           }
-        db.getDefaultQuery()->free_result();
+        dbQuery.free_result();
         return 0;
       }
     else
@@ -343,22 +425,24 @@ int XC::SQLiteDatastore::getData(const std::string &tableName,const std::vector<
 
 int XC::SQLiteDatastore::createOpenSeesDatabase(const std::string &projectName)
   {
+    if(!dbQuery.getConnection())
+      return -1;
 
-    const std::string campos= "(dbTag INTEGER NOT nullptr,commitTag INTEGER NOT nullptr, size INTEGER NOT nullptr, data BLOB, PRIMARY KEY (dbTag, commitTag, size) )";
+    const std::string campos= "(dbTag INTEGER NOT NULL,commitTag INTEGER NOT NULL, size INTEGER NOT NULL, data BLOB, PRIMARY KEY (dbTag, commitTag, size) )";
     // now create the tables in the database
 
-    query= "CREATE TABLE Messages " + campos;
+    query= "CREATE TABLE IF NOT EXISTS Messages " + campos;
     if(execute(query) != 0)
       std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Messagess table\n";
-    query= "CREATE TABLE Matrices " + campos;
+    query= "CREATE TABLE IF NOT EXISTS Matrices " + campos;
     if(execute(query) != 0)
       std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Matricess table\n";
 
-    query= "CREATE TABLE Vectors " + campos;
+    query= "CREATE TABLE IF NOT EXISTS Vectors " + campos;
     if(execute(query) != 0)
       std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Vectors table\n";
 
-    query= "CREATE TABLE IDs " + campos;
+    query= "CREATE TABLE IF NOT EXISTS IDs " + campos;
     if(execute(query) != 0)
        std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the ID's table\n";
     return 0;
@@ -366,11 +450,11 @@ int XC::SQLiteDatastore::createOpenSeesDatabase(const std::string &projectName)
 
 int XC::SQLiteDatastore::execute(const std::string &query)
   {
-    bool tmp= db.getDefaultQuery()->execute(query);
+    bool tmp= dbQuery.execute(query);
     if(!tmp)
       {
         std::cerr << "SQLiteDatastore::execute() - could not execute command: " << query;
-        std::cerr << std::endl << db.getDefaultQuery()->getError() << std::endl;
+        std::cerr << std::endl << dbQuery.getError() << std::endl;
         return -1;
       }
     else
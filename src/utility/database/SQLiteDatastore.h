@@ -32,6 +32,8 @@
 
 #include "DBDatastore.h"
 #include "utility/sqlite/SqLiteDatabase.h"
+#include "utility/sqlite/SqLiteQuery.h"
+#include <vector>
 
 namespace XC {
 //! @ingroup Utils
@@ -41,23 +43,58 @@ namespace XC {
 //! @ingroup Database
 //
 //! @brief Store model data in a <a href="https://en.wikipedia.org/wiki/SQLite">SQLite</a> database.
+//!
+//! The components of each matrix, vector or ID are stored as a single
+//! BLOB (compressed with zlib if the compression level is greater than
+//! zero) using prepared statements. The save and restore operations
+//! run inside a single transaction.
 class SQLiteDatastore: public DBDatastore
   {
   private:
+    //! @brief Prepared statements to write and read the BLOBs of a table.
+    struct BlobTable
+      {
+        std::string name; //!< table name.
+        sqlite3_stmt *insertStmt; //!< INSERT OR REPLACE statement.
+        sqlite3_stmt *selectStmt; //!< SELECT statement.
+        BlobTable(const std::string &nm)
+          : name(nm), insertStmt(nullptr), selectStmt(nullptr) {}
+      };
     bool connection;
     SqLiteDatabase db; //!< database SqLite.
+    SqLiteQuery dbQuery; //!< query object that owns the connection.
     std::string query;
-    bool insertData(const std::string &,const int &,const int &,const void *,const int &,const int &);
-    bool updateData(const std::string &,const int &,const int &,const void *,const int &,const int &);
-    const void *retrieveData(const std::string &tbName,const int &dbTag,const int &commitTag,const int &sz);
+    BlobTable matrices; //!< matrices table.
+    BlobTable vectors; //!< vectors table.
+    BlobTable ids; //!< IDs table.
+    int compressionLevel; //!< zlib compression level (0: no compression).
+    bool inTransaction; //!< true if a transaction is in progress.
+    std::vector<unsigned char> buffer; //!< (de)compression buffer.
+
+    SQLiteDatastore(const SQLiteDatastore &);
+    SQLiteDatastore &operator=(const SQLiteDatastore &);
   protected:
+    sqlite3_stmt *prepare(const std::string &);
+    bool prepare_statements(BlobTable &);
+    void finalize_statements(BlobTable &);
+    bool write_blob(BlobTable &,const int &,const int &,const void *,const int &,const int &);
+    bool read_blob(BlobTable &,const int &,const int &,void *,const int &,const int &);
+    bool begin_transaction(void);
+    bool end_transaction(const bool &);
     int createOpenSeesDatabase(const std::string &projectName);
     int execute(const std::string &query);
   public:
     SQLiteDatastore(const std::string &,Preprocessor &, FEM_ObjectBroker &,int dbRun = 0);    
+    ~SQLiteDatastore(void);
 
     std::string getTypeId(void) const
       { return "SQLite"; }
+
+    int getCompressionLevel(void) const;
+    void setCompressionLevel(const int &);
+
+    int save(const int &commitTag);
+    int restore(const int &commitTag);
     
     // methods for sending and receiving matrices, vectors and id's
     int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);    
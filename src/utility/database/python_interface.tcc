@@ -34,6 +34,7 @@ class_<XC::BerkeleyDbDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("B
   ;
 
 class_<XC::SQLiteDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("SQLiteDatastore", no_init)
+  .add_property("compressionLevel",&XC::SQLiteDatastore::getCompressionLevel,&XC::SQLiteDatastore::setCompressionLevel,"zlib compression level of the stored data (0: no compression, 9: best compression).")
   ;
 
 class_<XC::PyDictDatastore, bases<XC::DBDatastore>, boost::noncopyable  >("PyDictDatastore", no_init)
@@ -50,3 +51,35 @@ class_<XC::NEESData, bases<XC::FE_Datastore>, boost::noncopyable  >("NEESData",
 
 class_<XC::FileDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("FileDatastore", no_init)
   ;
+
+class_<XC::ResultsStore, bases<CommandEntity>, boost::noncopyable  >("ResultsStore", no_init)
+  .add_property("fileName",make_function(&XC::ResultsStore::getFileName, return_value_policy<copy_const_reference>()),"Return the name of the file.")
+  .add_property("numEntities",&XC::ResultsStore::getNumEntities,"Return the number of entities (elements, nodes,...).")
+  .add_property("numComponents",&XC::ResultsStore::getNumComponents,"Return the number of components stored for each entity.")
+  .add_property("numCombinations",&XC::ResultsStore::getNumCombinations,"Return the number of combinations.")
+  .def("getTags",&XC::ResultsStore::getTagsPy,"Return the tags of the entities.")
+  .def("getComponentNames",&XC::ResultsStore::getComponentNamesPy,"Return the names of the components.")
+  .def("getLabels",&XC::ResultsStore::getLabelsPy,"Return the labels of the entities.")
+  .def("getComponentIndex",&XC::ResultsStore::getComponentIndex,"getComponentIndex(name): return the index of the component (-1 if not found).")
+  ;
+
+class_<XC::ResultsStoreWriter, bases<XC::ResultsStore>, boost::noncopyable  >("ResultsStoreWriter")
+  .def("open",&XC::ResultsStoreWriter::openPy,"open(fileName, tags, componentNames, labels): create the file for the given entity tags (ID), component names and entity labels (can be an empty list).")
+  .def("appendCombination",&XC::ResultsStoreWriter::appendCombination,"appendCombination(name, values): append the results of a combination; values is a matrix with a row for each entity and a column for each component.")
+  .def("close",&XC::ResultsStoreWriter::close,"Close the file.")
+  .add_property("isOpen",&XC::ResultsStoreWriter::isOpen,"Return true if the file is open.")
+  ;
+
+class_<XC::ResultsStoreReader, bases<XC::ResultsStore>, boost::noncopyable  >("ResultsStoreReader")
+  .def("open",&XC::ResultsStoreReader::open,"open(fileName): map the file in memory.")
+  .def("close",&XC::ResultsStoreReader::close,"Unmap the file.")
+  .add_property("isOpen",&XC::ResultsStoreReader::isOpen,"Return true if the file is open.")
+  .def("getCombinationNames",&XC::ResultsStoreReader::getCombinationNamesPy,"Return the names of the combinations.")
+  .def("getCombinationIndex",&XC::ResultsStoreReader::getCombinationIndex,"getCombinationIndex(name): return the index of the combination (-1 if not found).")
+  .def("getEntityIndex",&XC::ResultsStoreReader::getEntityIndex,"getEntityIndex(tag): return the position of the entity (-1 if not found).")
+  .def("getValue",&XC::ResultsStoreReader::getValue,"getValue(tag, combinationIndex, componentIndex): return a value.")
+  .def("getEntityCombinationValues",&XC::ResultsStoreReader::getEntityCombinationValues,"getEntityCombinationValues(tag, combinationIndex): return the values of the components of the entity for the combination.")
+  .def("getEntityValues",&XC::ResultsStoreReader::getEntityValues,"getEntityValues(tag): return a matrix with the values of the entity for each combination (one row per combination).")
+  .def("getCombinationValues",&XC::ResultsStoreReader::getCombinationValues,"getCombinationValues(combinationIndex): return a matrix with the values of all the entities for the combination (one row per entity).")
+  .def("getSubset",&XC::ResultsStoreReader::getSubset,"getSubset(tags, combinationIndex): return a matrix with the values of the given entities (ID) for the combination (one row per entity).")
+  ;
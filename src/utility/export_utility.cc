@@ -23,6 +23,7 @@
 
 #include "FEProblem.h"
 #include "python_interface.h"
+#include "utility/matrix/python_buffer.h"
 
 void export_utility(void)
   {
@@ -112,7 +112,7 @@ class Matrix: public CommandEntity
   {
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static AuxMatrix auxMatrix;
+    static thread_local AuxMatrix auxMatrix;
 
     int numRows;
     int numCols;
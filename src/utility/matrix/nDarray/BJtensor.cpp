@@ -369,7 +369,9 @@ XC::BJtensor XC::BJtensor::operator*(const BJtensor &arg) const
 // the last one . . .
    //results_indices[uncontr_counter]= '\0';
 
-   BJtensor result(results_dims, 0.0);
+   // the rank of the result is the number of uncontracted indices.
+   const std::vector<int> result_tensor_dims(results_dims.begin(), results_dims.begin()+uncontr_counter);
+   BJtensor result(result_tensor_dims, 0.0);
    result(results_indices);  // initialize indices in result
 
 
@@ -476,6 +478,62 @@ XC::BJtensor XC::BJtensor::operator*(const BJtensor &arg) const
     return result;
   }
 
+//! @brief Return the product of this tensor and the argument, contracting
+//! the repeated indices (i.e. this(indices)*rval(rvalIndices)).
+//!
+//! Check the indices before calling operator*, so a wrong expression
+//! (i.e. coming from Python) is reported instead of aborting the program.
+//! @param indices: indices of this tensor (i.e. "ijkl").
+//! @param rval: the other tensor.
+//! @param rvalIndices: indices of the other tensor (i.e. "kl").
+XC::BJtensor XC::BJtensor::contract(const std::string &indices, const BJtensor &rval, const std::string &rvalIndices) const
+  {
+    BJtensor retval;
+    if(&rval==this) // operator* splits the indices of the same tensor.
+      {
+        const BJtensor tmp(rval);
+        return contract(indices, tmp, rvalIndices);
+      }
+    if((int(indices.size())!=rank()) || (int(rvalIndices.size())!=rval.rank()))
+      {
+        std::cerr << "BJtensor::" << __FUNCTION__
+                  << "; the number of indices doesn't match the rank:"
+                  << " (" << indices << ", rank: " << rank()
+                  << "), (" << rvalIndices << ", rank: " << rval.rank()
+                  << ")." << std::endl;
+        return retval;
+      }
+    int uncontracted= 0;
+    for(size_t i= 0;i<indices.size();i++)
+      {
+        const size_t j= rvalIndices.find(indices[i]);
+        if(j==std::string::npos)
+          uncontracted++;
+        else if(dim(i+1)!=rval.dim(j+1))
+          {
+            std::cerr << "BJtensor::" << __FUNCTION__
+                      << "; dimensions of index: '" << indices[i]
+                      << "' don't match." << std::endl;
+            return retval;
+          }
+      }
+    for(size_t j= 0;j<rvalIndices.size();j++)
+      if(indices.find(rvalIndices[j])==std::string::npos)
+        uncontracted++;
+    if(uncontracted>4)
+      {
+        std::cerr << "BJtensor::" << __FUNCTION__
+                  << "; the product has order: " << uncontracted
+                  << " (maximum is 4)." << std::endl;
+        return retval;
+      }
+    null_indices();
+    rval.null_indices();
+    retval= (*this)(indices)*rval(rvalIndices);
+    retval.null_indices();
+    return retval;
+  }
+
 
 
 //......//##############################################################################
@@ -140,6 +140,7 @@ class BJtensor: public nDarray
     BJtensor &operator*=(const double &rval);     // Added Zhao Oct2005
     BJtensor operator*(const double &rval) const; // scalar multiplication, Added const Zhao Oct2005
     BJtensor operator*(const BJtensor &rval) const;       // inner/outer product
+    BJtensor contract(const std::string &, const BJtensor &, const std::string &) const;
     BJtensor operator/(const BJtensor &rval) const;       // BJtensor division rval MUST BE BJtensor of
                                             // order 0 ( i.e. scalar in BJtensor form )
 
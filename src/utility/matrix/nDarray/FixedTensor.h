@@ -0,0 +1,394 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedTensor.h
+
+#ifndef FIXEDTENSOR_H
+#define FIXEDTENSOR_H
+
+#include <array>
+#include <vector>
+#include <iostream>
+#include "utility/matrix/nDarray/BJtensor.h"
+
+namespace XC {
+
+//! @ingroup Matrix
+//!
+//! @brief Tensor whose dimensions are known at compile time.
+//!
+//! Stack allocated counterpart of BJtensor intended for the Gauss point
+//! loops of the solid elements and the integration algorithms of the
+//! 3D material models. As in nDarray, the components are stored in
+//! row-major order and the subscripts of operator() are one-based, so
+//! the code written for BJtensor can be ported without renumbering.
+//! The contractions are written as free functions (see below) so the
+//! compiler knows the extent of every loop.
+template <size_t... Dims>
+class FixedTensor
+  {
+  public:
+    static constexpr size_t rank= sizeof...(Dims); //!< number of indices.
+    static constexpr size_t size= (Dims * ...); //!< number of components.
+  private:
+    std::array<double, size> values; //!< components (row-major order).
+
+    //! @brief Return the position of the component in the values array.
+    template <typename... Subscripts>
+    static constexpr size_t get_index(const Subscripts &... subscripts)
+      {
+        static_assert(sizeof...(Subscripts)==rank, "wrong number of subscripts.");
+        constexpr size_t dims[rank]= {Dims...};
+        size_t retval= 0;
+        size_t k= 0;
+        ((retval= retval*dims[k++]+static_cast<size_t>(subscripts-1)), ...);
+        return retval;
+      }
+  public:
+    //! @brief Constructor.
+    constexpr FixedTensor(const double &initval= 0.0)
+      : values{}
+      {
+        for(size_t i= 0;i<size;i++)
+          values[i]= initval;
+      }
+    //! @brief Constructor (values in row-major order).
+    constexpr explicit FixedTensor(const double *v)
+      : values{}
+      {
+        for(size_t i= 0;i<size;i++)
+          values[i]= v[i];
+      }
+    explicit FixedTensor(const nDarray &);
+
+    //! @brief Return the dimensions of the tensor.
+    static std::vector<int> getDimensions(void)
+      { return std::vector<int>{static_cast<int>(Dims)...}; }
+    //! @brief Return the equivalent BJtensor.
+    BJtensor getBJtensor(void) const
+      { return BJtensor(getDimensions(), values.data()); }
+
+    //! @brief Return a pointer to the components.
+    constexpr const double *data(void) const
+      { return values.data(); }
+    //! @brief Return a pointer to the components.
+    constexpr double *data(void)
+      { return values.data(); }
+    //! @brief Return the i-th component (zero-based, row-major order).
+    constexpr const double &operator[](const size_t &i) const
+      { return values[i]; }
+    //! @brief Return the i-th component (zero-based, row-major order).
+    constexpr double &operator[](const size_t &i)
+      { return values[i]; }
+    //! @brief Return the component with the given (one-based) subscripts.
+    template <typename... Subscripts>
+    constexpr const double &operator()(const Subscripts &... subscripts) const
+      { return values[get_index(subscripts...)]; }
+    //! @brief Return the component with the given (one-based) subscripts.
+    template <typename... Subscripts>
+    constexpr double &operator()(const Subscripts &... subscripts)
+      { return values[get_index(subscripts...)]; }
+
+    //! @brief Set all the components to zero.
+    constexpr void Zero(void)
+      {
+        for(size_t i= 0;i<size;i++)
+          values[i]= 0.0;
+      }
+    //! @brief Add the argument multiplied by the factor.
+    constexpr FixedTensor &addTensor(const FixedTensor &other, const double &factor)
+      {
+        for(size_t i= 0;i<size;i++)
+          values[i]+= factor*other.values[i];
+        return *this;
+      }
+    constexpr FixedTensor &operator+=(const FixedTensor &other)
+      { return addTensor(other, 1.0); }
+    constexpr FixedTensor &operator-=(const FixedTensor &other)
+      { return addTensor(other, -1.0); }
+    constexpr FixedTensor &operator*=(const double &factor)
+      {
+        for(size_t i= 0;i<size;i++)
+          values[i]*= factor;
+        return *this;
+      }
+    constexpr FixedTensor operator+(const FixedTensor &other) const
+      { FixedTensor retval(*this); retval+= other; return retval; }
+    constexpr FixedTensor operator-(const FixedTensor &other) const
+      { FixedTensor retval(*this); retval-= other; return retval; }
+    constexpr FixedTensor operator*(const double &factor) const
+      { FixedTensor retval(*this); retval*= factor; return retval; }
+  };
+
+//! @brief Constructor from a BJtensor (or any other nDarray) with the
+//! same dimensions.
+template <size_t... Dims>
+FixedTensor<Dims...>::FixedTensor(const nDarray &a)
+  : values{}
+  {
+    const std::vector<int> dims= getDimensions();
+    bool ok= (a.rank()==static_cast<int>(rank));
+    for(size_t k= 0;ok && (k<rank);k++)
+      ok= (a.dim(k+1)==dims[k]);
+    if(ok)
+      for(size_t i= 0;i<size;i++)
+        values[i]= a(static_cast<int>(i+1));
+    else
+      std::cerr << "FixedTensor::" << __FUNCTION__
+                << "; the dimensions of the argument don't match"
+                << " the ones of this tensor." << std::endl;
+  }
+
+typedef FixedTensor<3,3> FixedTensor2; //!< Second order tensor in 3D.
+typedef FixedTensor<3,3,3,3> FixedTensor4; //!< Fourth order tensor in 3D.
+
+//! @brief Return a*b (c_ik= a_ij*b_jk).
+template <size_t M, size_t N, size_t P>
+constexpr FixedTensor<M,P> mult(const FixedTensor<M,N> &a, const FixedTensor<N,P> &b)
+  {
+    FixedTensor<M,P> retval;
+    for(size_t i= 0;i<M;i++)
+      for(size_t j= 0;j<N;j++)
+        {
+          const double aij= a[i*N+j];
+          for(size_t k= 0;k<P;k++)
+            retval[i*P+k]+= aij*b[j*P+k];
+        }
+    return retval;
+  }
+
+//! @brief Return transpose(a)*b (c_jk= a_ij*b_ik).
+template <size_t M, size_t N, size_t P>
+constexpr FixedTensor<N,P> transposed_mult(const FixedTensor<M,N> &a, const FixedTensor<M,P> &b)
+  {
+    FixedTensor<N,P> retval;
+    for(size_t i= 0;i<M;i++)
+      for(size_t j= 0;j<N;j++)
+        {
+          const double aij= a[i*N+j];
+          for(size_t k= 0;k<P;k++)
+            retval[j*P+k]+= aij*b[i*P+k];
+        }
+    return retval;
+  }
+
+//! @brief Return a*transpose(b) (c_ik= a_ij*b_kj).
+template <size_t M, size_t N, size_t P>
+constexpr FixedTensor<M,P> mult_transposed(const FixedTensor<M,N> &a, const FixedTensor<P,N> &b)
+  {
+    FixedTensor<M,P> retval;
+    for(size_t i= 0;i<M;i++)
+      for(size_t k= 0;k<P;k++)
+        {
+          double s= 0.0;
+          for(size_t j= 0;j<N;j++)
+            s+= a[i*N+j]*b[k*N+j];
+          retval[i*P+k]= s;
+        }
+    return retval;
+  }
+
+//! @brief Return the transpose of a second order tensor.
+template <size_t M, size_t N>
+constexpr FixedTensor<N,M> transpose(const FixedTensor<M,N> &a)
+  {
+    FixedTensor<N,M> retval;
+    for(size_t i= 0;i<M;i++)
+      for(size_t j= 0;j<N;j++)
+        retval[j*M+i]= a[i*N+j];
+    return retval;
+  }
+
+//! @brief Return the determinant of a 3x3 tensor.
+constexpr double determinant(const FixedTensor2 &a)
+  {
+    return a[0]*(a[4]*a[8]-a[5]*a[7])
+          -a[1]*(a[3]*a[8]-a[5]*a[6])
+          +a[2]*(a[3]*a[7]-a[4]*a[6]);
+  }
+
+//! @brief Return the inverse of a 3x3 tensor (the zero tensor if
+//! it's singular).
+inline FixedTensor2 inverse(const FixedTensor2 &a)
+  {
+    FixedTensor2 retval;
+    const double det= determinant(a);
+    if(det!=0.0)
+      {
+        const double invDet= 1.0/det;
+        retval[0]= (a[4]*a[8]-a[5]*a[7])*invDet;
+        retval[1]= (a[2]*a[7]-a[1]*a[8])*invDet;
+        retval[2]= (a[1]*a[5]-a[2]*a[4])*invDet;
+        retval[3]= (a[5]*a[6]-a[3]*a[8])*invDet;
+        retval[4]= (a[0]*a[8]-a[2]*a[6])*invDet;
+        retval[5]= (a[2]*a[3]-a[0]*a[5])*invDet;
+        retval[6]= (a[3]*a[7]-a[4]*a[6])*invDet;
+        retval[7]= (a[1]*a[6]-a[0]*a[7])*invDet;
+        retval[8]= (a[0]*a[4]-a[1]*a[3])*invDet;
+      }
+    else
+      std::cerr << __FUNCTION__
+                << "; singular tensor, can't compute its inverse."
+                << std::endl;
+    return retval;
+  }
+
+//! @brief Return the trace of a 3x3 tensor.
+constexpr double trace(const FixedTensor2 &a)
+  { return a[0]+a[4]+a[8]; }
+
+//! @brief Return a_ij*b_ij.
+constexpr double double_contraction(const FixedTensor2 &a, const FixedTensor2 &b)
+  {
+    double retval= 0.0;
+    for(size_t i= 0;i<FixedTensor2::size;i++)
+      retval+= a[i]*b[i];
+    return retval;
+  }
+
+//! @brief Return c_ijkl*b_kl.
+constexpr FixedTensor2 double_contraction(const FixedTensor4 &c, const FixedTensor2 &b)
+  {
+    FixedTensor2 retval;
+    for(size_t ij= 0;ij<9;ij++)
+      {
+        double s= 0.0;
+        for(size_t kl= 0;kl<9;kl++)
+          s+= c[ij*9+kl]*b[kl];
+        retval[ij]= s;
+      }
+    return retval;
+  }
+
+//! @brief Return a_ij*c_ijkl.
+constexpr FixedTensor2 double_contraction(const FixedTensor2 &a, const FixedTensor4 &c)
+  {
+    FixedTensor2 retval;
+    for(size_t ij= 0;ij<9;ij++)
+      {
+        const double aij= a[ij];
+        for(size_t kl= 0;kl<9;kl++)
+          retval[kl]+= aij*c[ij*9+kl];
+      }
+    return retval;
+  }
+
+//! @brief Return the fourth order tensor a_ij*b_kl.
+constexpr FixedTensor4 outer_product(const FixedTensor2 &a, const FixedTensor2 &b)
+  {
+    FixedTensor4 retval;
+    for(size_t ij= 0;ij<9;ij++)
+      for(size_t kl= 0;kl<9;kl++)
+        retval[ij*9+kl]= a[ij]*b[kl];
+    return retval;
+  }
+
+//! @brief Return f_im*f_jn*c_mnrs*f_kr*f_ls (i.e. the transformation of
+//! a tangent stiffness tensor from the intermediate configuration to the
+//! reference one when f is the inverse of the plastic deformation
+//! gradient).
+//!
+//! The product is computed one index at a time, so the cost is
+//! 4*3^5 products instead of the 3^8 of the direct contraction.
+constexpr FixedTensor4 transform_indices(const FixedTensor2 &f, const FixedTensor4 &c)
+  {
+    FixedTensor4 a; // f_im*c_mnrs
+    for(size_t i= 0;i<3;i++)
+      for(size_t m= 0;m<3;m++)
+        {
+          const double fim= f[i*3+m];
+          for(size_t nrs= 0;nrs<27;nrs++)
+            a[i*27+nrs]+= fim*c[m*27+nrs];
+        }
+    FixedTensor4 b; // f_jn*a_inrs
+    for(size_t i= 0;i<3;i++)
+      for(size_t j= 0;j<3;j++)
+        for(size_t n= 0;n<3;n++)
+          {
+            const double fjn= f[j*3+n];
+            for(size_t rs= 0;rs<9;rs++)
+              b[(i*3+j)*9+rs]+= fjn*a[(i*3+n)*9+rs];
+          }
+    FixedTensor4 retval; // b_ijrs*f_kr*f_ls
+    for(size_t ij= 0;ij<9;ij++)
+      {
+        FixedTensor2 bij(b.data()+ij*9); // b_ijrs for fixed i,j.
+        const FixedTensor2 tmp= mult(f, mult_transposed(bij, f));
+        for(size_t kl= 0;kl<9;kl++)
+          retval[ij*9+kl]= tmp[kl];
+      }
+    return retval;
+  }
+
+//! @brief Compute the derivatives of the shape functions with respect
+//! to the global coordinates from the ones with respect to the natural
+//! coordinates (isoparametric elements) and return the determinant of
+//! the jacobian.
+//!
+//! @param dh: derivatives of the shape functions with respect to r, s and t.
+//! @param coords: nodal coordinates.
+//! @param dhGlobal: derivatives of the shape functions with respect to x, y and z.
+template <size_t N>
+inline double global_shape_derivatives(const FixedTensor<N,3> &dh, const FixedTensor<N,3> &coords, FixedTensor<N,3> &dhGlobal)
+  {
+    const FixedTensor2 jacobian= transposed_mult(dh, coords);
+    dhGlobal= mult_transposed(dh, inverse(jacobian));
+    return determinant(jacobian);
+  }
+
+//! @brief Add the contribution of a Gauss point to the stiffness tensor
+//! of an isoparametric element: K_nklm+= w*dhGlobal_nb*C_kbld*dhGlobal_md.
+//!
+//! @param K: stiffness tensor (node, dof, dof, node).
+//! @param dhGlobal: derivatives of the shape functions with respect to x, y and z.
+//! @param C: tangent constitutive tensor.
+//! @param w: weight of the Gauss point (including the jacobian determinant).
+template <size_t N>
+inline void add_stiffness_contribution(FixedTensor<N,3,3,N> &K, const FixedTensor<N,3> &dhGlobal, const FixedTensor4 &C, const double &w)
+  {
+    for(size_t n= 0;n<N;n++)
+      {
+        FixedTensor<3,3,3> tmp; // w*dhGlobal_nb*C_kbld
+        for(size_t b= 0;b<3;b++)
+          {
+            const double dnb= w*dhGlobal[n*3+b];
+            for(size_t k= 0;k<3;k++)
+              for(size_t ld= 0;ld<9;ld++)
+                tmp[k*9+ld]+= dnb*C[(k*3+b)*9+ld];
+          }
+        for(size_t kl= 0;kl<9;kl++)
+          {
+            double *Knkl= K.data()+(n*9+kl)*N;
+            for(size_t m= 0;m<N;m++)
+              Knkl[m]+= tmp[kl*3]*dhGlobal[m*3]+tmp[kl*3+1]*dhGlobal[m*3+1]+tmp[kl*3+2]*dhGlobal[m*3+2];
+          }
+      }
+  }
+
+} // end of XC namespace
+
+#endif
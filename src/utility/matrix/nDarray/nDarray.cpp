@@ -350,7 +350,7 @@ XC::nDarray::nDarray(const boost::python::list &ldim, const boost::python::list
     std::vector<int> pdim(sz);
     // store the dimensions.
     for(size_t i=0 ; i<sz; i++ )
-      pdim[i] =boost::python::extract<double>(lvalues[i]);
+      pdim[i]= boost::python::extract<int>(ldim[i]);
     
     // create the structure:
     pc_nDarray_rep.nDarray_rank= sz;  //rank_of_nDarray;
@@ -1590,3 +1590,95 @@ void XC::nDarray::set_dim(const std::vector<int> &pdim)
 
 int XC::nDarray::dim(int which) const
   { return this->pc_nDarray_rep.dim[which-1]; }
+
+//! @brief Return the dimensions of the array in a Python list.
+boost::python::list XC::nDarray::getDimPy(void) const
+  {
+    boost::python::list retval;
+    const int r= rank();
+    for(int i= 1;i<=r;i++)
+      retval.append(dim(i));
+    return retval;
+  }
+
+//! @brief Copy the subscripts in the list to the array argument (padded
+//! with ones up to four subscripts). Return false if the number of
+//! subscripts doesn't match the rank or if they are out of range.
+//! @param l: subscripts (1-based, as in the C++ interface).
+//! @param subscripts: array to store the subscripts.
+bool XC::nDarray::get_subscripts(const boost::python::list &l, int subscripts[4]) const
+  {
+    bool retval= true;
+    const int r= rank();
+    const int sz= boost::python::len(l);
+    if((sz!=r) || (r>4))
+      {
+        std::cerr << "nDarray::" << __FUNCTION__
+                  << "; the number of subscripts: " << sz
+                  << " doesn't match the rank of the array: " << r
+                  << std::endl;
+        retval= false;
+      }
+    else
+      {
+        for(int i= 0;i<4;i++)
+          subscripts[i]= 1;
+        for(int i= 0;i<sz;i++)
+          {
+            const int s= boost::python::extract<int>(l[i]);
+            if((s<1) || (s>dim(i+1)))
+              {
+                std::cerr << "nDarray::" << __FUNCTION__
+                          << "; subscript: " << s
+                          << " out of range [1," << dim(i+1)
+                          << "] in direction: " << i+1
+                          << std::endl;
+                retval= false;
+                break;
+              }
+            subscripts[i]= s;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Return the value that corresponds to the subscripts in the list
+//! (1-based, as in the C++ interface).
+double XC::nDarray::getValuePy(const boost::python::list &l) const
+  {
+    double retval= 0.0;
+    if(rank()==0)
+      retval= pc_nDarray_rep.val(0);
+    else
+      {
+        int s[4];
+        if(get_subscripts(l, s))
+          retval= (*this)(s[0], s[1], s[2], s[3]);
+      }
+    return retval;
+  }
+
+//! @brief Assign the value that corresponds to the subscripts in the list
+//! (1-based, as in the C++ interface).
+void XC::nDarray::setValuePy(const boost::python::list &l, const double &value)
+  {
+    if(rank()==0)
+      pc_nDarray_rep.val(0)= value;
+    else
+      {
+        int s[4];
+        if(get_subscripts(l, s))
+          (*this)(s[0], s[1], s[2], s[3])= value;
+      }
+  }
+
+//! @brief Return the values of the array in a Python list (last subscript
+//! varies fastest).
+boost::python::list XC::nDarray::getValuesPy(void) const
+  {
+    boost::python::list retval;
+    const size_t sz= total_number();
+    for(size_t i= 0;i<sz;i++)
+      retval.append(pc_nDarray_rep.val(i));
+    return retval;
+  }
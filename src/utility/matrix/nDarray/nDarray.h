@@ -151,10 +151,24 @@ class nDarray_rep
         //assert(nDarray_rank==3);
         return ((first - 1)*dim[1]+second - 1)*dim[2]+third - 1;
       }
+    //! @brief Return the index of the component. The BJtensor product
+    //! uses this overload for all the ranks (the unused subscripts are 1),
+    //! so the dimensions beyond the rank must not be read.
     inline size_t get_index(int first, int second, int third, int fourth) const
       {
-        //assert(nDarray_rank==4);
-        return (((first - 1)*dim[1]+second - 1)*dim[2]+third - 1)*dim[3]+fourth - 1;
+        switch(nDarray_rank)
+          {
+          case 0:
+            return 0;
+          case 1:
+            return first - 1;
+          case 2:
+            return get_index(first, second);
+          case 3:
+            return get_index(first, second, third);
+          default:
+            return (((first - 1)*dim[1]+second - 1)*dim[2]+third - 1)*dim[3]+fourth - 1;
+          }
       }
   public:
     void init_dim(const size_t &, const int &default_dim= 1);
@@ -243,6 +257,7 @@ class nDarray
   {
   private:
 //  int rank(void) const;
+    bool get_subscripts(const boost::python::list &, int [4]) const;
     size_t total_number(void) const;
     void total_number(size_t );
     void clear_dim(void);
@@ -293,28 +308,19 @@ class nDarray
       { return pc_nDarray_rep(first); }
     
     inline double &operator()(int first)
-      {
-	nDarray *this_no_const= const_cast<nDarray *>(this);
-	return this_no_const->operator()(first);
-      }
+      { return pc_nDarray_rep(first); }
     
     inline const double &operator()(int first, int second) const
       { return pc_nDarray_rep(first, second); }
 
     inline double &operator()(int first, int second)
-      {
-	nDarray *this_no_const= const_cast<nDarray *>(this);
-	return this_no_const->operator()(first, second);
-      }
+      { return pc_nDarray_rep(first, second); }
     
     inline const double &operator()(int first, int second, int third) const
       { return pc_nDarray_rep(first, second, third); }
 
     inline double &operator()(int first, int second, int third)
-      {
-	nDarray *this_no_const= const_cast<nDarray *>(this);
-	return this_no_const->operator()(first, second, third);
-      }
+      { return pc_nDarray_rep(first, second, third); }
     inline const double &operator()(int first, int second, int third, int fourth) const
       { return pc_nDarray_rep(first, second, third, fourth); }
     
@@ -368,6 +374,10 @@ class nDarray
   public:
     int rank(void) const;
     int dim(int which) const;
+    boost::python::list getDimPy(void) const;
+    double getValuePy(const boost::python::list &) const;
+    void setValuePy(const boost::python::list &, const double &);
+    boost::python::list getValuesPy(void) const;
     
     void output(std::ostream &os) const;
     void outputshort(std::ostream &os) const;
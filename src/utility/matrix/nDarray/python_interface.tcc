@@ -21,6 +21,8 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+int (XC::nDarray::*getNDArrayRank)(void) const= &XC::nDarray::rank;
+int (XC::nDarray::*getNDArrayDim)(int) const= &XC::nDarray::dim;
 class_<XC::nDarray>("nDarray")
   .def(init<list, list>())
   .def(init<int, double>())
@@ -30,6 +32,12 @@ class_<XC::nDarray>("nDarray")
   .def(self - self)
   .def("frobeniusNorm",&XC::nDarray::Frobenius_norm,"Returns the Frobenius norm.")
   .def("generalNorm",&XC::nDarray::General_norm,"Returns the general p-th norm.")
+  .add_property("rank", getNDArrayRank, "Return the rank (number of indices) of the array.")
+  .def("dim", getNDArrayDim, "Return the dimension in the direction argument (1-based).")
+  .def("getDim", &XC::nDarray::getDimPy, "Return the dimensions of the array in a list.")
+  .def("getValue", &XC::nDarray::getValuePy, "Return the value at the position given by the list of subscripts (1-based, as in the C++ interface).")
+  .def("setValue", &XC::nDarray::setValuePy, "Assign the value at the position given by the list of subscripts (1-based, as in the C++ interface).")
+  .def("getValues", &XC::nDarray::getValuesPy, "Return the values of the array in a list (last subscript varies fastest).")
   ;
 
 class_<XC::BJmatrix , bases<XC::nDarray>>("BJmatrix")
@@ -45,6 +53,7 @@ class_<XC::BJvector, bases<XC::BJmatrix>>("BJvector")
 
 class_<XC::BJtensor, bases<XC::nDarray> >("BJtensor")
   .def(init<list, list>())
+  .def("contract", &XC::BJtensor::contract, "contract(indices, other, otherIndices): return the product of this tensor and the other one contracting the repeated indices, i.e. a.contract('ijkl', b, 'kl').")
   ;
 
 class_<XC::Cosseratstraintensor , bases<XC::BJtensor> >("Cosseratstraintensor")
@@ -72,6 +81,8 @@ class_<XC::stressstraintensor , bases<XC::BJtensor> >("stressstraintensor")
   ;
 
 class_<XC::straintensor, XC::straintensor *, bases<XC::stressstraintensor> >("straintensor")
+  .def(init<double>())
+  .def(init<list>())
   ;
 
 class_<XC::stresstensor, XC::stresstensor *, bases<XC::stressstraintensor> >("stresstensor")
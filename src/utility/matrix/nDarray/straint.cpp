@@ -74,6 +74,10 @@ XC::straintensor::straintensor(const std::vector<double> &values)
   : stressstraintensor(values)
     {  }
 
+//! @brief Constructor
+XC::straintensor::straintensor(const boost::python::list &l)
+  : stressstraintensor(l) {  }
+
 //! @brief Constructor.
 XC::straintensor::straintensor( const straintensor & x )
   : stressstraintensor(x)
@@ -74,6 +74,7 @@ class straintensor: public stressstraintensor
 
     straintensor(const double *values);
     straintensor(const std::vector<double> &values);
+    straintensor(const boost::python::list &l);
     explicit straintensor(const Vector &);
 
     straintensor(const straintensor & x );
@@ -0,0 +1,150 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_buffer.cc
+
+#include "python_buffer.h"
+#include <boost/python/extract.hpp>
+#include "Vector.h"
+#include "Matrix.h"
+#include "ID.h"
+
+namespace {
+//! @brief Fill the buffer view with the given data.
+//!
+//! @param exporter: Python object that owns the data.
+//! @param view: buffer view to fill.
+//! @param data: pointer to the first item.
+//! @param itemsize: size of each item.
+//! @param format: struct module format of the items.
+//! @param shape: number of items in each dimension.
+//! @param strides: number of items between consecutive values of each index.
+//! @param ndim: number of dimensions.
+//! @param flags: flags requested by the consumer.
+int fill_buffer(PyObject *exporter, Py_buffer *view, void *data, const Py_ssize_t &itemsize, const char *format, const Py_ssize_t *shape, const Py_ssize_t *strides, const int &ndim, const int &flags)
+  {
+    const bool cContiguous= (ndim<2) || (shape[0]<2) || (shape[1]<2);
+    const bool fContiguous= (ndim<2) || (strides[0]==1);
+    if((((flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS) && !cContiguous) ||
+       (((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS) && !fContiguous))
+      {
+        PyErr_SetString(PyExc_BufferError, "the data are not contiguous in the requested order.");
+        return -1;
+      }
+    if(((flags & PyBUF_STRIDES) != PyBUF_STRIDES) && !cContiguous)
+      {
+        PyErr_SetString(PyExc_BufferError, "the data can only be exported with strides.");
+        return -1;
+      }
+    // Shape and strides (in bytes) live in view->internal
+    // until the buffer is released.
+    Py_ssize_t *dims= new Py_ssize_t[4];
+    Py_ssize_t len= 1;
+    for(int i= 0;i<ndim;i++)
+      {
+        dims[i]= shape[i];
+        dims[2+i]= strides[i]*itemsize;
+        len*= shape[i];
+      }
+    view->obj= exporter;
+    Py_INCREF(exporter);
+    view->buf= data;
+    view->len= len*itemsize;
+    view->readonly= 0;
+    view->itemsize= itemsize;
+    view->format= ((flags & PyBUF_FORMAT) == PyBUF_FORMAT) ? const_cast<char *>(format) : nullptr;
+    view->ndim= ndim;
+    view->shape= ((flags & PyBUF_ND) == PyBUF_ND) ? dims : nullptr;
+    view->strides= ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? dims+2 : nullptr;
+    view->suboffsets= nullptr;
+    view->internal= dims;
+    return 0;
+  }
+
+//! @brief Return a pointer to the C++ object wrapped by the exporter.
+template <class T>
+T *get_wrapped(PyObject *exporter)
+  {
+    boost::python::object obj(boost::python::handle<>(boost::python::borrowed(exporter)));
+    boost::python::extract<T &> x(obj);
+    T *retval= nullptr;
+    if(x.check())
+      retval= &x();
+    else
+      PyErr_SetString(PyExc_BufferError, "can't access the wrapped object.");
+    return retval;
+  }
+} // end of anonymous namespace
+
+//! @brief Export the vector components as a one-dimensional
+//! array of doubles.
+int XC::vector_get_buffer(PyObject *exporter, Py_buffer *view, int flags)
+  {
+    Vector *v= get_wrapped<Vector>(exporter);
+    if(!v)
+      return -1;
+    const Py_ssize_t shape[1]= {v->Size()};
+    const Py_ssize_t strides[1]= {1};
+    return fill_buffer(exporter, view, v->getDataPtr(), sizeof(double), "d", shape, strides, 1, flags);
+  }
+
+//! @brief Export the matrix components as a two-dimensional
+//! array of doubles (the data are stored by columns).
+int XC::matrix_get_buffer(PyObject *exporter, Py_buffer *view, int flags)
+  {
+    Matrix *m= get_wrapped<Matrix>(exporter);
+    if(!m)
+      return -1;
+    const Py_ssize_t shape[2]= {m->noRows(), m->noCols()};
+    const Py_ssize_t strides[2]= {1, m->noRows()};
+    return fill_buffer(exporter, view, m->getDataPtr(), sizeof(double), "d", shape, strides, 2, flags);
+  }
+
+//! @brief Export the identifiers as a one-dimensional array of ints.
+int XC::id_get_buffer(PyObject *exporter, Py_buffer *view, int flags)
+  {
+    ID *id= get_wrapped<ID>(exporter);
+    if(!id)
+      return -1;
+    const Py_ssize_t shape[1]= {static_cast<Py_ssize_t>(id->size())};
+    const Py_ssize_t strides[1]= {1};
+    return fill_buffer(exporter, view, id->getDataPtr(), sizeof(int), "i", shape, strides, 1, flags);
+  }
+
+//! @brief Free the shape and strides of the view.
+void XC::release_buffer(PyObject *, Py_buffer *view)
+  {
+    delete[] static_cast<Py_ssize_t *>(view->internal);
+    view->internal= nullptr;
+  }
+
+//! @brief Install the buffer procedures in the given Python class.
+void XC::set_buffer_procs(const boost::python::object &pyClass, PyBufferProcs *procs)
+  {
+    PyTypeObject *type= reinterpret_cast<PyTypeObject *>(pyClass.ptr());
+    type->tp_as_buffer= procs;
+    PyType_Modified(type);
+  }
@@ -0,0 +1,58 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_buffer.h
+
+#ifndef PYTHON_BUFFER_H
+#define PYTHON_BUFFER_H
+
+#include <boost/python/object.hpp>
+
+namespace XC {
+
+int vector_get_buffer(PyObject *, Py_buffer *, int);
+int matrix_get_buffer(PyObject *, Py_buffer *, int);
+int id_get_buffer(PyObject *, Py_buffer *, int);
+void release_buffer(PyObject *, Py_buffer *);
+void set_buffer_procs(const boost::python::object &, PyBufferProcs *);
+
+//! @ingroup Matrix
+//! @brief Buffer protocol procedures for the exported class T. Once
+//! installed in the Python type object, numpy.asarray(obj) and
+//! memoryview(obj) return views of the object data without copying it.
+//!
+//! The view is valid while the object is not resized.
+template <int (*GetBuffer)(PyObject *, Py_buffer *, int)>
+void enable_buffer_protocol(const boost::python::object &pyClass)
+  {
+    static PyBufferProcs procs= {GetBuffer, release_buffer};
+    set_buffer_procs(pyClass, &procs);
+  }
+
+} // end of XC namespace
+
+#endif
@@ -38,6 +38,8 @@ class_<XC::ID, bases<CommandEntity> >("ID")
   // .def(self *= int())
   ;
 
+XC::enable_buffer_protocol<XC::id_get_buffer>(scope().attr("ID"));
+
 implicitly_convertible<XC::ID,boost::python::list>();
 implicitly_convertible<boost::python::list,XC::ID>();
 
@@ -79,6 +81,8 @@ class_<XC::Vector, bases<CommandEntity> >("Vector")
   ;
 
 
+XC::enable_buffer_protocol<XC::vector_get_buffer>(scope().attr("Vector"));
+
 implicitly_convertible<XC::Vector,boost::python::list>();
 implicitly_convertible<boost::python::list,XC::Vector>();
 
@@ -119,6 +123,7 @@ class_<XC::Matrix, bases<CommandEntity> >("Matrix")
   .def("getInverse",&XC::Matrix::getInverse,"Return the inverse of the matrix.")
   .def("Zero", &XC::Matrix::Zero,"Set to zero all the elements of the matrix.")
    ;
+XC::enable_buffer_protocol<XC::matrix_get_buffer>(scope().attr("Matrix"));
 
 
 #include "nDarray/python_interface.tcc"
@@ -42,6 +42,10 @@ int SqLiteQuery::GetErrno(void)
 std::string SqLiteQuery::getError(void) const
   { return q.getError(); }
 
+//! @brief Return the database connection of the query.
+sqlite3 *SqLiteQuery::getConnection(void)
+  { return q.getConnection(); }
+
 bool SqLiteQuery::execute(const std::string &sql)
   { return q.execute(sql); }
 
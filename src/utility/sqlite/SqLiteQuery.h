@@ -43,6 +43,7 @@ class SqLiteQuery: public SqLiteObject
 
     int GetErrno(void);
     std::string getError(void) const;
+    sqlite3 *getConnection(void);
     bool execute(const std::string &sql);
     sqlite3_stmt *get_result(const std::string& sql);
     void free_result();
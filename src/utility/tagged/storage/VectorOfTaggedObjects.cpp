@@ -0,0 +1,231 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjects.cpp
+
+#include "VectorOfTaggedObjects.h"
+#include <utility/tagged/TaggedObject.h>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: object owner (this object is somewhat contained by).
+//! @param containerName: name of the container.
+XC::VectorOfTaggedObjects::VectorOfTaggedObjects(CommandEntity *owr,const std::string &containerName)
+  : TaggedObjectStorage(owr,containerName), sorted(true), numHoles(0), numConsolidations(0), myIter(*this) {}
+
+//! @brief Copy constructor.
+XC::VectorOfTaggedObjects::VectorOfTaggedObjects(const VectorOfTaggedObjects &other)
+  : TaggedObjectStorage(other), sorted(true), numHoles(0), numConsolidations(0), myIter(*this)
+  { copy(other); }
+
+//! @brief Assignment operator.
+XC::VectorOfTaggedObjects &XC::VectorOfTaggedObjects::operator=(const VectorOfTaggedObjects &other)
+  {
+    TaggedObjectStorage::operator=(other);
+    clearAll(true);
+    copy(other);
+    return *this;
+  }
+
+//! @brief Destructor.
+XC::VectorOfTaggedObjects::~VectorOfTaggedObjects(void)
+  { clearComponents(); }
+
+//! @brief Reserve memory for \p newSize components.
+int XC::VectorOfTaggedObjects::setSize(int newSize)
+  {
+    if(newSize<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; invalid size " << newSize << std::endl;
+        return -1;
+      }
+    theComponents.reserve(newSize);
+    slots.reserve(newSize);
+    return 0;
+  }
+
+//! @brief Adds a component to the container.
+//!
+//! Returns false (and does nothing) if there is already an object with
+//! the same tag. Otherwise the pointer is appended at the end of the
+//! array; if its tag is smaller than the tag of the last object the
+//! array is marked as unsorted.
+bool XC::VectorOfTaggedObjects::addComponent(TaggedObject *newComponent)
+  {
+    const int tag= newComponent->getTag();
+    const size_t pos= theComponents.size();
+    const std::pair<slot_map::iterator,bool> res= slots.insert(slot_map::value_type(tag,pos));
+    if(res.second==false) // tag occupied
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; not adding as one with similar tag exists, tag: "
+		  << tag << "\n";
+        return false;
+      }
+    if(sorted && (pos>0))
+      {
+        const TaggedObject *last= theComponents.back();
+        if(last && (last->getTag()>tag))
+          sorted= false;
+        else if(!last) // there are holes at the end.
+          sorted= false;
+      }
+    theComponents.push_back(newComponent);
+    newComponent->set_owner(this);
+    transmitIDs= true; //Component added.
+    return true;
+  }
+
+//! @brief Remove and delete the component whose tag is given by \p tag.
+//!
+//! The position of the object in the array is set to nullptr (it will
+//! be compacted the next time the iteration starts) unless it is the
+//! last one. Returns false if the object is not in the container.
+bool XC::VectorOfTaggedObjects::removeComponent(int tag)
+  {
+    bool retval= false;
+    slot_map::iterator i= slots.find(tag);
+    if(i!=slots.end())
+      {
+        const size_t pos= i->second;
+        delete theComponents[pos];
+        slots.erase(i);
+        if(pos==theComponents.size()-1)
+          theComponents.pop_back();
+        else
+          {
+            theComponents[pos]= nullptr;
+            numHoles++;
+          }
+        retval= true;
+        transmitIDs= true; //Component removed.
+      }
+    return retval;
+  }
+
+//! @brief Sort the array by tag and remove the holes left by
+//! the removed objects (if needed), updating the hash table.
+//!
+//! The objects change their position in the array, so the iters
+//! that are running over the container must find their position
+//! again (see VectorOfTaggedObjectsIter::relocate).
+void XC::VectorOfTaggedObjects::consolidate(void)
+  {
+    if(!sorted || (numHoles>0))
+      {
+        theComponents.erase(std::remove(theComponents.begin(), theComponents.end(), static_cast<TaggedObject *>(nullptr)), theComponents.end());
+        if(!sorted)
+          std::sort(theComponents.begin(), theComponents.end(),
+                    [](const TaggedObject *a, const TaggedObject *b)
+                    { return a->getTag()<b->getTag(); });
+        const size_t sz= theComponents.size();
+        for(size_t i= 0;i<sz;i++)
+          slots[theComponents[i]->getTag()]= i;
+        sorted= true;
+        numHoles= 0;
+        numConsolidations++;
+      }
+  }
+
+//! @brief Returns the number of components currently stored in the
+//! container.
+int XC::VectorOfTaggedObjects::getNumComponents(void) const
+  { return slots.size(); }
+
+//! @brief Return a pointer to the TaggedObject whose identifier is given by
+//! \p tag (nullptr if it's not in the container).
+XC::TaggedObject *XC::VectorOfTaggedObjects::getComponentPtr(int tag)
+  {
+    const VectorOfTaggedObjects *cthis= static_cast<const VectorOfTaggedObjects *>(this);
+    return const_cast<TaggedObject *>(cthis->getComponentPtr(tag));
+  }
+
+//! @brief Return a pointer to the TaggedObject whose identifier is given by
+//! \p tag (nullptr if it's not in the container). Const version of the method.
+const XC::TaggedObject *XC::VectorOfTaggedObjects::getComponentPtr(int tag) const
+  {
+    const TaggedObject *retval= nullptr;
+    slot_map::const_iterator i= slots.find(tag);
+    if(i!=slots.end())
+      retval= theComponents[i->second];
+    return retval;
+  }
+
+//! @brief Reset the iter of the container and return a reference to it.
+XC::TaggedObjectIter &XC::VectorOfTaggedObjects::getComponents(void)
+  {
+    myIter.reset();
+    return myIter;
+  }
+
+//! @brief Return a new iter to the components (needed if
+//! multiple iters must run in the same code segment).
+XC::VectorOfTaggedObjectsIter XC::VectorOfTaggedObjects::getIter(void)
+  {
+    VectorOfTaggedObjectsIter retval(*this);
+    retval.reset();
+    return retval;
+  }
+
+//! @brief Return an empty copy of the container. It is up to
+//! the caller to invoke the destructor on the new object.
+XC::TaggedObjectStorage *XC::VectorOfTaggedObjects::getEmptyCopy(void)
+  { return new VectorOfTaggedObjects(Owner(),containerName); }
+
+//! @brief Free memory reserved for components.
+void XC::VectorOfTaggedObjects::clearComponents(void)
+  {
+    for(iterator i= begin();i!=end();i++)
+      {
+        delete *i;
+        *i= nullptr;
+      }
+  }
+
+//! @brief Remove all objects from the container, invoking their
+//! destructor if \p invokeDestructor is true.
+void XC::VectorOfTaggedObjects::clearAll(bool invokeDestructor)
+  {
+    if(invokeDestructor)
+      clearComponents();
+    theComponents.clear();
+    slots.clear();
+    sorted= true;
+    numHoles= 0;
+    numConsolidations++;
+    transmitIDs= true; //All components removed.
+  }
+
+//! @brief Invoke Print on all the objects of the container.
+void XC::VectorOfTaggedObjects::Print(std::ostream &s, int flag) const
+  {
+    VectorOfTaggedObjects *this_no_const= const_cast<VectorOfTaggedObjects *>(this);
+    this_no_const->consolidate();
+    for(const_iterator i= theComponents.begin();i!=theComponents.end();i++)
+      (*i)->Print(s, flag);
+  }
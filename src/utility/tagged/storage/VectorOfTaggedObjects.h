@@ -0,0 +1,102 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjects.h
+
+#ifndef VectorOfTaggedObjects_h
+#define VectorOfTaggedObjects_h
+
+#include <utility/tagged/storage/TaggedObjectStorage.h>
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
+#include <vector>
+#include <unordered_map>
+
+namespace XC {
+//! @ingroup Tagged
+//
+//! @brief Dense storage of tagged objects.
+//!
+//! The pointers to the objects are stored in a contiguous array sorted
+//! by tag (so the iteration order is the same as the one of
+//! MapOfTaggedObjects) and a hash table gives the position of each
+//! tag, so the objects are retrieved in constant time. Iterating
+//! through the container only needs to walk the array.
+//!
+//! The objects are appended at the end of the array; if the new tag
+//! is smaller than the previous ones, or if some object is removed
+//! (its position is set to nullptr), the array is sorted and compacted
+//! the next time the iteration starts (see consolidate).
+class VectorOfTaggedObjects: public TaggedObjectStorage
+  {
+    typedef std::vector<TaggedObject *> tagged_vector;
+    typedef std::unordered_map<int, size_t> slot_map;
+  public:
+    typedef tagged_vector::iterator iterator;
+    typedef tagged_vector::const_iterator const_iterator;
+  private:
+    tagged_vector theComponents; //!< pointers to the objects (sorted by tag once consolidated).
+    slot_map slots; //!< position of each tag in the array.
+    bool sorted; //!< true if the array is sorted by tag.
+    size_t numHoles; //!< number of removed objects not compacted yet.
+    size_t numConsolidations; //!< number of times the objects have been moved in the array.
+    VectorOfTaggedObjectsIter myIter; //!< iter for this object.
+  protected:
+    inline iterator begin(void)
+      { return theComponents.begin(); }
+    inline iterator end(void)
+      { return theComponents.end(); }
+    void clearComponents(void);
+    void consolidate(void);
+
+  public:
+    VectorOfTaggedObjects(CommandEntity *owr,const std::string &containerName);
+    VectorOfTaggedObjects(const VectorOfTaggedObjects &);
+    VectorOfTaggedObjects &operator=(const VectorOfTaggedObjects &);
+    ~VectorOfTaggedObjects(void);
+
+    // public methods to populate a domain
+    int setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+
+    bool removeComponent(int tag);
+    int getNumComponents(void) const;
+
+    TaggedObject *getComponentPtr(int tag);
+    const TaggedObject *getComponentPtr(int tag) const;
+    TaggedObjectIter &getComponents(void);
+
+    VectorOfTaggedObjectsIter getIter(void);
+
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+
+    void Print(std::ostream &s, int flag =0) const;
+    friend class VectorOfTaggedObjectsIter;
+  };
+} // end of XC namespace
+
+#endif
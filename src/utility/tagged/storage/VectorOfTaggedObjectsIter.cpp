@@ -0,0 +1,86 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjectsIter.cpp
+
+#include <utility/tagged/storage/VectorOfTaggedObjectsIter.h>
+#include <utility/tagged/storage/VectorOfTaggedObjects.h>
+#include <utility/tagged/TaggedObject.h>
+
+//! @brief Constructor.
+XC::VectorOfTaggedObjectsIter::VectorOfTaggedObjectsIter(VectorOfTaggedObjects &theComponents)
+  : theContainer(theComponents), currentPosition(0),
+    numConsolidations(theComponents.numConsolidations), lastTag(0) {}
+
+//! @brief Sort and compact the container (if needed) and
+//! go to the first object.
+void XC::VectorOfTaggedObjectsIter::reset(void)
+  {
+    theContainer.consolidate();
+    currentPosition= 0;
+    numConsolidations= theContainer.numConsolidations;
+  }
+
+//! @brief Find the position that follows the last object returned
+//! after the container has been consolidated.
+void XC::VectorOfTaggedObjectsIter::relocate(void)
+  {
+    const std::vector<TaggedObject *> &components= theContainer.theComponents;
+    const size_t sz= components.size();
+    if(currentPosition>0)
+      {
+        VectorOfTaggedObjects::slot_map::const_iterator i= theContainer.slots.find(lastTag);
+        if(i!=theContainer.slots.end()) // still there.
+          currentPosition= i->second+1;
+        else // removed, go to the first one with a greater tag.
+          {
+            currentPosition= 0;
+            while((currentPosition<sz) && (!components[currentPosition] || (components[currentPosition]->getTag()<=lastTag)))
+              currentPosition++;
+          }
+      }
+    numConsolidations= theContainer.numConsolidations;
+  }
+
+//! @brief Return the next object (nullptr at the end).
+XC::TaggedObject *XC::VectorOfTaggedObjectsIter::operator()(void)
+  {
+    if(numConsolidations!=theContainer.numConsolidations) // objects moved.
+      relocate();
+    const std::vector<TaggedObject *> &components= theContainer.theComponents;
+    const size_t sz= components.size();
+    while(currentPosition<sz)
+      {
+        TaggedObject *result= components[currentPosition];
+        currentPosition++;
+        if(result) // not removed.
+          {
+            lastTag= result->getTag();
+            return result;
+          }
+      }
+    return nullptr;
+  }
@@ -0,0 +1,65 @@
+// -*-c++-*-
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis C. Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//VectorOfTaggedObjectsIter.h
+
+#ifndef VectorOfTaggedObjectsIter_h
+#define VectorOfTaggedObjectsIter_h
+
+#include <utility/tagged/storage/TaggedObjectIter.h>
+#include <cstddef>
+
+namespace XC {
+class VectorOfTaggedObjects;
+
+//! @ingroup Tagged
+//
+//! @brief Iter over the objects of a VectorOfTaggedObjects container.
+//!
+//! The iter keeps the position in the array (not a pointer) so
+//! the objects added while iterating don't invalidate it. The
+//! objects removed while iterating are skipped. If the array is
+//! consolidated while iterating (i.e. another iter over the same
+//! container is reset) the iter resumes after the tag of the last
+//! object returned, as an iter over a std::map would do.
+class VectorOfTaggedObjectsIter: public TaggedObjectIter
+  {
+  private:
+    VectorOfTaggedObjects &theContainer;
+    size_t currentPosition;
+    size_t numConsolidations; //!< consolidations of the container when the position was computed.
+    int lastTag; //!< tag of the last object returned.
+    void relocate(void);
+  public:
+    VectorOfTaggedObjectsIter(VectorOfTaggedObjects &theComponents);
+
+    virtual void reset(void);
+    virtual TaggedObject *operator()(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -565,6 +565,13 @@ int Query::GetErrno(void)
     return 0;
   }
 
+sqlite3 *Query::getConnection(void)
+  {
+    if(odb)
+      return odb->db;
+    return NULL;
+  }
+
 
 bool Query::Connected()
   { return odb ? true : false; }
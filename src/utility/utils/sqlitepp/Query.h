@@ -109,6 +109,9 @@ class Query
     std::string getError(void) const;
     /** Last error code. */
     int GetErrno();
+    /** Return the connection used by the query (to prepare
+        statements that must run in the same transaction). */
+    sqlite3 *getConnection(void);
 
     /** Execute query and return first result as a string. */
     const char *get_string(const std::string& sql);
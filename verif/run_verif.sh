@@ -47,6 +47,7 @@ echo "$BLEU" "Misc. tests." "$NORMAL"
 python tests/utility/test_evalPy.py
 python tests/utility/test_execPy.py
 python tests/utility/test_copy_properties.py
+python tests/utility/test_bjtensor_01.py
 python tests/utility/misc_utils/testStairCaseFunction.py
 python tests/utility/misc_utils/test_linear_interpolation.py
 python tests/utility/misc_utils/test_remove_accents.py
@@ -621,6 +622,7 @@ python tests/elements/volume/test_brick_05.py
 python tests/elements/volume/test_extrapolation_matrix.py
 python tests/elements/volume/test_brick_shape_functions.py
 python tests/elements/volume/test_extrapolate_values_brick.py
+python tests/elements/volume/test_n_node_bricks_01.py
 
 echo "$BLEU" "  Bridge bearing modelization tests." "$NORMAL"
 python tests/elements/bridge_bearings/test_elastomeric_bearing_01.py
@@ -656,6 +658,7 @@ python tests/elements/birth_and_death/test_awakening_in_hot_model_force_beam_col
 python tests/elements/birth_and_death/test_awakening_in_hot_model_shell_mitc4_01.py
 python tests/elements/birth_and_death/test_awakening_in_hot_model_four_node_quad.py
 python tests/elements/birth_and_death/test_awakening_in_hot_model_zero_length.py
+python tests/elements/birth_and_death/test_awakening_incremental_setup_truss.py
 
 echo "$BLEU" "Sample problem tests." "$NORMAL"
 echo "$BLEU" "  Strut-and-tie tests." "$NORMAL"
@@ -677,6 +680,15 @@ echo "$BLEU" "Solution tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
 python tests/solution/superlu_solver_test_02.py
 python tests/solution/umf_solver_test_01.py
+python tests/solution/umf_solver_test_02.py
+python tests/solution/linear_factor_once_test_01.py
+python tests/solution/eigen_sparse_spd_solver_test_01.py
+python tests/solution/profile_spd_thread_solver_test_01.py
+python tests/solution/full_gen_substr_thread_solver_test_01.py
+python tests/solution/krylov_solver_test_01.py
+python tests/solution/sparse_soe_scatter_map_test_01.py
+python tests/solution/nested_dissection_numbering_01.py
+python tests/solution/linear_combination_analysis_test_01.py
 python tests/solution/mumps_solver_test_01.py
 echo "$BLEU" "  Ill conditioning tests." "$NORMAL"
 python tests/solution/ill_conditioning/ill_conditioning_01.py
@@ -689,6 +701,11 @@ python tests/solution/integrator/test_penalty_newton_raphson_newmark_integrator.
 python tests/solution/integrator/test_transformation_newton_raphson_newmark_integrator.py
 python tests/solution/integrator/test_transformation_newton_raphson_trbdf2_integrator.py
 python tests/solution/integrator/test_transformation_newton_raphson_trbdf3_integrator.py
+python tests/solution/integrator/test_concurrent_assembly_01.py
+python tests/solution/integrator/test_concurrent_commit_01.py
+python tests/solution/integrator/test_nodal_state_arena_01.py
+python tests/solution/integrator/test_nodal_state_arena_02.py
+python tests/solution/integrator/test_concurrent_assembly_02.py
 
 echo "$BLEU" "  Geometric imperfections." "$NORMAL"
 python tests/solution/initial_imperfection/test_geometric_imperfection_00.py
@@ -915,6 +932,7 @@ echo "$BLEU" "    Bridge paremetric modeling." "$NORMAL"
 python tests/preprocessor/meshing/bridge_parametric_modeling/bridge_parametric_modeler_test_01.py
 python tests/preprocessor/meshing/bridge_parametric_modeling/bridge_parametric_modeler_test_02.py
 python tests/preprocessor/meshing/bridge_parametric_modeling/bridge_parametric_modeler_test_03.py
+python tests/preprocessor/mesh_storage_test_01.py
 
 echo "$BLEU" "  Sets handling tests." "$NORMAL"
 python tests/preprocessor/sets/test_exist_set.py
@@ -922,6 +940,7 @@ python tests/preprocessor/sets/test_set_01.py
 python tests/preprocessor/sets/une_sets.py
 python tests/preprocessor/sets/sets_boolean_operations_01.py
 python tests/preprocessor/sets/sets_boolean_operations_02.py
+python tests/preprocessor/sets/sets_boolean_operations_03.py
 python tests/preprocessor/sets/test_set_rename_01.py
 python tests/preprocessor/sets/test_set_rename_02.py
 python tests/preprocessor/sets/test_resisting_svd01.py
@@ -1264,6 +1283,7 @@ python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10_mater
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10_material_03.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10nl_material_01.py
 python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_mc10nl_material_02.py
+python tests/materials/xc_materials/uniaxial/concrete/test_tdconcrete_exponential_creep_01.py
 python tests/materials/xc_materials/uniaxial/concrete/test_HA25_01.py
 python tests/materials/xc_materials/uniaxial/concrete/test_HA25_02.py
 python tests/materials/xc_materials/uniaxial/concrete/test_HP45_01.py
@@ -1327,6 +1347,7 @@ echo "$BLEU" "      Template 3D elastoplastic materials." "$NORMAL"
 python tests/materials/xc_materials/nD/template_3d_ep/test_drucker-prager_material_01.py
 python tests/materials/xc_materials/nD/template_3d_ep/test_cam-clay_material_01.py
 python tests/materials/xc_materials/nD/template_3d_ep/test_von_mises_material_01.py
+python tests/materials/xc_materials/nD/template_3d_ep/test_von_mises_material_02.py
 echo "$BLEU" "      UW materials." "$NORMAL"
 python tests/materials/xc_materials/nD/uw_materials/test_drucker-prager_3d_01.py
 python tests/materials/xc_materials/nD/uw_materials/test_drucker-prager_3d_02.py
@@ -1414,6 +1435,7 @@ python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_06.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_07.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_08.py
 python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_09.py
+python tests/materials/xc_materials/sections/fiber_section/test_fiber3d_10.py
 echo "$BLEU" "        Beam fiber section tests." "$NORMAL"
 python tests/materials/xc_materials/sections/fiber_section/beam_fiber_sections/test_section_aggregator_01.py
 python tests/materials/xc_materials/sections/fiber_section/beam_fiber_sections/test_fiber_section_sign_convention01.py
@@ -1447,6 +1469,7 @@ python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/t
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram04.py
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram05.py
 python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram06.py
+python tests/materials/xc_materials/sections/fiber_section/interaction_diagram/test_interaction_diagram07.py
 python tests/materials/xc_materials/sections/fiber_section/plastic_hinge_on_IPE200.py
 echo "$BLEU" "        Membrane plate fiber section tests." "$NORMAL"
 python tests/materials/xc_materials/sections/fiber_section/membrane_plate/test_membrane_plate_fiber_material_01.py
@@ -1847,9 +1870,8 @@ python tests/geotechnics/earth_retaining/test_k_janssen_01.py
 
 #Database tests
 echo "$BLEU" "Database tests (MySQL, Berkeley db, sqlite,...)." "$NORMAL"
-# XXX sqlitepp is toooooo slooooow. Seek for another solution.
-# python tests/database/test_database_01.py
-# python tests/database/test_database_02.py
+python tests/database/test_database_01.py
+python tests/database/test_database_02.py
 python tests/database/test_database_03.py
 # python tests/database/test_database_04.py
 # python tests/database/test_database_05.py
@@ -1876,6 +1898,7 @@ python tests/utility/rcond_02.py
 python tests/utility/rcond_03.py
 python tests/utility/import_combinations.py
 python tests/utility/test_suitable_xzvector.py
+python tests/utility/test_numpy_views_01.py
 
 echo "$BLEU" "Verifiying routines for rough calculations,..." "$NORMAL"
 python tests/rough_calculations/test_min_dim_abut_support.py
@@ -1940,6 +1963,8 @@ python tests/rough_calculations/reinforced_concrete/test_hinge_design_02.py
 echo "$BLEU" "Verifiying routines for post processing." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
 python tests/postprocess/test_get_connected_constraints.py
+python tests/postprocess/test_results_store_01.py
+python tests/postprocess/test_results_store_02.py
 echo "$BLEU" "  limit state checking." "$NORMAL"
 echo "$BLEU" "    SIA 262 limit state checking." "$NORMAL"
 python tests/postprocess/limit_state_checking/sia262/test_shell_normal_stresses_uls_checking.py
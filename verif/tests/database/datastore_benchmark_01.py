@@ -0,0 +1,130 @@
+# -*- coding: utf-8 -*-
+''' Time needed to save and restore the state of a grillage model with
+    the File, BerkeleyDB and SQLite datastores (benchmark). The SQLite
+    datastore is checked with and without compression of the stored data.
+'''
+
+from __future__ import print_function
+
+import os
+import time
+import shutil
+import tempfile
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material and section properties.
+E= 30e9 # Elastic modulus (Pa)
+nu= 0.2 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+A= 0.25 # Cross section area (m2)
+Iy= 5.2e-3 # Cross section moment of inertia (m4)
+Iz= 5.2e-3 # Cross section moment of inertia (m4)
+J= 8.8e-3 # Cross section torsion constant (m4)
+F= 10e3 # Load (N)
+
+# Grillage.
+numDiv= 30
+spacing= 1.0
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+grid= list()
+for i in range(0, numDiv+1):
+    row= list()
+    for j in range(0, numDiv+1):
+        row.append(nodes.newNodeXYZ(i*spacing, j*spacing, 0.0))
+    grid.append(row)
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,0,1]))
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= scc.name
+for i in range(0, numDiv+1):
+    for j in range(0, numDiv+1):
+        if(i<numDiv):
+            elements.newElement("ElasticBeam3d",xc.ID([grid[i][j].tag, grid[i+1][j].tag]))
+        if(j<numDiv):
+            elements.newElement("ElasticBeam3d",xc.ID([grid[i][j].tag, grid[i][j+1].tag]))
+for row in [grid[0], grid[numDiv]]:
+    for n in row:
+        modelSpace.fixNode000_000(n.tag)
+lp0= modelSpace.newLoadPattern(name= '0')
+for row in grid[1:-1]:
+    for n in row:
+        lp0.newNodalLoad(n.tag, xc.Vector([0,0,-F,0,0,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+analysis= predefined_solutions.simple_static_linear(feProblem)
+result= analysis.analyze(1)
+
+centerTag= grid[numDiv//2][numDiv//2].tag
+refDisp= nodes.getNode(centerTag).getDisp[2]
+
+def directory_size(path):
+    ''' Return the size of the files in the path.'''
+    retval= 0
+    if(os.path.isfile(path)):
+        retval= os.path.getsize(path)
+    else:
+        for root, dirs, files in os.walk(path):
+            for f in files:
+                retval+= os.path.getsize(os.path.join(root, f))
+    return retval
+
+def benchmark(dbType, compressionLevel= None):
+    ''' Save and restore the model with the given datastore. Return the
+        elapsed times, the size of the stored data and the restored
+        displacement.'''
+    workDir= tempfile.mkdtemp()
+    if(dbType=='File'):
+        dbName= os.path.join(workDir, 'model')
+    else:
+        dbName= os.path.join(workDir, 'model.db')
+    db= feProblem.newDatabase(dbType, dbName)
+    if(compressionLevel is not None):
+        db.compressionLevel= compressionLevel
+    startTime= time.time()
+    db.save(100)
+    saveTime= time.time()-startTime
+    feProblem.clearAll()
+    feProblem.setVerbosityLevel(0) # Don't print warning messages about pointers to material.
+    startTime= time.time()
+    db.restore(100)
+    restoreTime= time.time()-startTime
+    feProblem.setVerbosityLevel(1)
+    disp= preprocessor.getNodeHandler.getNode(centerTag).getDisp[2]
+    size= directory_size(workDir)
+    shutil.rmtree(workDir)
+    return saveTime, restoreTime, size, disp
+
+results= dict()
+ok= True
+for (dbType, compressionLevel) in [('File', None), ('BerkeleyDB', None), ('SQLite', 0), ('SQLite', 6)]:
+    key= dbType if (compressionLevel is None) else dbType+'('+str(compressionLevel)+')'
+    results[key]= benchmark(dbType, compressionLevel)
+    ratio= abs(results[key][3]-refDisp)/abs(refDisp)
+    ok= ok and (ratio<1e-12)
+# Compression must reduce the size of the SQLite database.
+ok= ok and (results['SQLite(6)'][2]<results['SQLite(0)'][2])
+
+'''
+for key in results:
+    r= results[key]
+    print(key, ' save: ', r[0], 's restore: ', r[1], 's size: ', r[2]/1024, 'kB displacement: ', r[3], refDisp)
+'''
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
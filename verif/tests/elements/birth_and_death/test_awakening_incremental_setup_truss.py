@@ -0,0 +1,129 @@
+# -*- coding: utf-8 -*-
+''' Check the incremental setup of the static analysis: when the only
+    changes of the domain between two analyses are the node lockers created
+    or removed by the construction stages, the DOF numbering and the size of
+    the system of equations are reused (penalty constraint handler). The
+    test checks both the results and the number of times the analysis
+    model has been built from scratch.
+'''
+
+from __future__ import print_function
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+l= 10 # Bar length in inches
+F= 1000 # Force magnitude (pounds)
+A= 1 # Section area in square inches.
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+## Mesh
+### Nodes.
+n1= nodes.newNodeXY(0,0)
+n2= nodes.newNodeXY(l,0.0)
+n3= nodes.newNodeXY(2*l,0.0)
+
+### Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+### Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= elast.name
+elements.dimElem= 2 # Dimension of element space
+trussA= elements.newElement("Truss",xc.ID([n1.tag,n2.tag]))
+trussA.sectionArea= A
+trussB= elements.newElement("Truss",xc.ID([n2.tag,n3.tag]))
+trussB.sectionArea= A
+
+### Constraints
+modelSpace.fixNode("00", n1.tag)
+modelSpace.fixNode("F0", n2.tag)
+modelSpace.fixNode("F0", n3.tag)
+
+# Deactivate trussB element (node n3 is frozen).
+trussBSet= modelSpace.defSet(elements=[trussB])
+modelSpace.deactivateElements(trussBSet, freezeDeadNodes= True)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(n2.tag,xc.Vector([F,0]))
+## We add the load case to domain.
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+## Solution procedure (penalty constraint handler).
+solProc= predefined_solutions.SimpleStaticLinear(feProblem)
+solProc.setup()
+solProc.analysis.incrementalSetup= True
+incrementalSetup= solProc.analysis.incrementalSetup
+
+## Compute solution
+result= solProc.solve()
+numFullSetupsA= solProc.analysis.numFullSetups # DOF numbering and SOE sizing.
+## Check results.
+N1a= trussA.getN()
+ratio1= abs(N1a-F)/F
+Ux2a= n2.getDisp[0]
+Ux2aRef= F*l/E/A
+ratio2= abs(Ux2a-Ux2aRef)/Ux2aRef
+Ux3a= n3.getDisp[0]
+ratio3= abs(Ux3a)/Ux2aRef # frozen node.
+
+## Activate the second element (the node locker is removed).
+modelSpace.activateElements(trussBSet)
+
+# Define a new load on the released node.
+lp1= modelSpace.newLoadPattern(name= '1')
+lp1.newNodalLoad(n3.tag,xc.Vector([F,0]))
+## We add the load case to domain.
+modelSpace.addLoadCaseToDomain(lp1.name)
+
+# Solve again.
+result= solProc.solve()
+# The node locker has been removed but the DOF numbering and the size of
+# the system of equations must have been reused.
+numFullSetupsB= solProc.analysis.numFullSetups
+numIncrementalSetupsB= solProc.analysis.numIncrementalSetups
+
+## Check results.
+N1Ab= trussA.getN() # Axial force in the first element.
+ratio4= abs(N1Ab-2*F)/2/F
+N1Bb= trussB.getN() # Axial force in the awakened element.
+ratio5= abs(N1Bb-F)/F
+Ux2b= n2.getDisp[0] # Horizontal displacement.
+Ux2bRef= 2*Ux2aRef
+ratio6= abs(Ux2b-Ux2bRef)/Ux2bRef
+
+'''
+print('incrementalSetup= ', incrementalSetup)
+print('full setups: ', numFullSetupsA, numFullSetupsB, ' incremental setups: ', numIncrementalSetupsB)
+print('N1a= ', N1a, ' ratio1= ', ratio1)
+print('Ux2a= ', Ux2a, ' ratio2= ', ratio2)
+print('Ux3a= ', Ux3a, ' ratio3= ', ratio3)
+print('N1Ab= ', N1Ab, ' ratio4= ', ratio4)
+print('N1Bb= ', N1Bb, ' ratio5= ', ratio5)
+print('Ux2b= ', Ux2b, ' ratio6= ', ratio6)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if incrementalSetup and (numFullSetupsA==1) and (numFullSetupsB==1) and (numIncrementalSetupsB==1) and (abs(ratio1)<1e-5) & (abs(ratio2)<1e-5) & (abs(ratio3)<1e-5) & (abs(ratio4)<1e-5) & (abs(ratio5)<1e-5) & (abs(ratio6)<1e-5):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+''' Time needed to compute the tangent stiffness matrix and the resisting
+    forces of the EightNodeBrick, TwentyNodeBrick and TwentySevenNodeBrick
+    elements, and to integrate a plastic step of a von Mises material with
+    Template3Dep (forward Euler). The results of the repeated calls must
+    be the same (benchmark).
+'''
+
+from __future__ import print_function
+
+import math
+import time
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e3 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+numCalls= 200 # Number of calls to time.
+
+# Natural coordinates of the nodes (see dh_drst_at in the C++ code).
+corners= [(1,1,1), (-1,1,1), (-1,-1,1), (1,-1,1), (1,1,-1), (-1,1,-1), (-1,-1,-1), (1,-1,-1)]
+naturalCoordinates= {
+    'EightNodeBrick': corners,
+    'TwentyNodeBrick': corners+[(0,1,1), (-1,0,1), (0,-1,1), (1,0,1), (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1), (1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0)],
+    'TwentySevenNodeBrick': corners+[(1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0), (0,1,1), (-1,0,1), (0,-1,1), (1,0,1), (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1), (0,1,0), (-1,0,0), (0,-1,0), (1,0,0), (0,0,1), (0,0,-1), (0,0,0)]
+    }
+
+def createElement(elementType):
+    ''' Create a (distorted) element of the given type.'''
+    feProblem= xc.FEProblem()
+    preprocessor= feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodeHandler)
+    elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+    nodes= list()
+    for (r, s, t) in naturalCoordinates[elementType]:
+        nodes.append(nodeHandler.newNodeXYZ(1.0+r+0.1*s*t, 0.75*(1.0+s)+0.05*r+0.1*r*s*t, 0.5*(1.0+t)+0.08*r*s))
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast3d.name
+    elem= elements.newElement(elementType, xc.ID([n.tag for n in nodes]))
+    return feProblem, elem, nodes
+
+results= dict()
+ok= True
+for elementType in naturalCoordinates:
+    feProblem, elem, nodes= createElement(elementType)
+    for i, n in enumerate(nodes):
+        n.setTrialDisp(xc.Vector([1e-3*math.sin(1.0+0.7*(3*i+j)) for j in range(0,3)]))
+    elem.update()
+    # Tangent stiffness.
+    startTime= time.time()
+    for i in range(0, numCalls):
+        K= elem.getTangentStiff()
+    stiffnessTime= (time.time()-startTime)/numCalls
+    Knorm= K.Norm()
+    # Resisting force.
+    startTime= time.time()
+    for i in range(0, numCalls):
+        F= elem.getResistingForce()
+    forceTime= (time.time()-startTime)/numCalls
+    ok= ok and (Knorm>0.0) and (abs(elem.getTangentStiff().Norm()-Knorm)<1e-12*Knorm) and (F.Norm()>0.0)
+    results[elementType]= (stiffnessTime, forceTime)
+
+# Plastic step of a von Mises material.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+elasticMat= typical_materials.defElasticIsotropic3d(preprocessor, "elastIso3d", 3000.0, 0.25, 0.0)
+k= 20.0 # Yield surface parameter.
+mu= 3000.0/(2.0*1.25)
+gamma= 2.0*k/math.sqrt(3.0)/mu # twice the yield strain.
+strainIncrement= xc.straintensor([0.0, gamma/2.0, 0.0, gamma/2.0, 0.0, 0.0, 0.0, 0.0, 0.0])
+materials= list()
+for i in range(0, numCalls):
+    epState= xc.EPState()
+    epState.stress= xc.stresstensor([0, 0, 0, 0, 0, 0, 0, 0, 0])
+    epState.scalarVars= [k]
+    epState.tensorVars= []
+    materials.append(typical_materials.defTemplate3Dep(preprocessor, name= 'vm'+str(i), elasticMaterial= elasticMat, yieldSurface= xc.VonMisesYieldSurface(), potentialSurface= xc.VonMisesPotentialSurface(), elasticPlasticState= epState, scalarEvolutionLaws= [], tensorialEvolutionLaws= []))
+startTime= time.time()
+for m in materials:
+    m.setTrialStrainIncrTensor(strainIncrement)
+plasticStepTime= (time.time()-startTime)/numCalls
+tau= [m.getStressTensor().getValue([1,2]) for m in materials]
+ok= ok and (max(tau)-min(tau)<1e-12*max(tau))
+
+'''
+for elementType in results:
+    print(elementType, ' stiffness: ', results[elementType][0]*1e6, 'us resisting force: ', results[elementType][1]*1e6, 'us')
+print('plastic step: ', plasticStepTime*1e6, 'us')
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,209 @@
+# -*- coding: utf-8 -*-
+''' Check the tangent stiffness matrix and the nodal forces of the
+    EightNodeBrick, TwentyNodeBrick and TwentySevenNodeBrick elements
+    against a pure Python Gauss integration of the isoparametric
+    formulation. The elements are distorted (the Jacobian is not
+    constant) and the material is linear elastic, so:
+
+    - the stiffness matrix must be equal to the one obtained by the
+      Gauss integration (same number of Gauss points) of B^T D B.
+    - the resisting force for any nodal displacement u must be K*u.
+    - for a linear displacement field (constant stress) the nodal forces
+      must fulfill sum(f_a x_a^T)= sigma*V.
+'''
+
+from __future__ import print_function
+
+import math
+import itertools
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e3 # Young modulus.
+nu= 0.3 # Poisson's ratio.
+lmbda= E*nu/((1.0+nu)*(1.0-2.0*nu))
+mu= E/(2.0*(1.0+nu))
+
+# Natural coordinates of the nodes (see dh_drst_at in the C++ code).
+corners= [(1,1,1), (-1,1,1), (-1,-1,1), (1,-1,1), (1,1,-1), (-1,1,-1), (-1,-1,-1), (1,-1,-1)]
+naturalCoordinates= {
+    'EightNodeBrick': corners,
+    'TwentyNodeBrick': corners+[(0,1,1), (-1,0,1), (0,-1,1), (1,0,1), (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1), (1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0)],
+    'TwentySevenNodeBrick': corners+[(1,1,0), (-1,1,0), (-1,-1,0), (1,-1,0), (0,1,1), (-1,0,1), (0,-1,1), (1,0,1), (0,1,-1), (-1,0,-1), (0,-1,-1), (1,0,-1), (0,1,0), (-1,0,0), (0,-1,0), (1,0,0), (0,0,1), (0,0,-1), (0,0,0)]
+    }
+# Number of Gauss points in each direction.
+gaussOrder= {'EightNodeBrick': 2, 'TwentyNodeBrick': 3, 'TwentySevenNodeBrick': 3}
+gaussPoints= {2: [(-1.0/math.sqrt(3.0), 1.0), (1.0/math.sqrt(3.0), 1.0)],
+              3: [(-math.sqrt(0.6), 5.0/9.0), (0.0, 8.0/9.0), (math.sqrt(0.6), 5.0/9.0)]}
+
+def geometry(r, s, t):
+    ''' Trilinear (distorted) map from natural to cartesian coordinates.'''
+    return [1.0+r+0.1*s*t, 0.75*(1.0+s)+0.05*r+0.1*r*s*t, 0.5*(1.0+t)+0.08*r*s]
+
+def product(factors):
+    ''' Return the value and the gradient of the product of the factors
+        (each factor is a tuple (value, gradient)).'''
+    value= 1.0
+    gradient= [0.0, 0.0, 0.0]
+    for (v, g) in factors:
+        gradient= [gradient[k]*v+value*g[k] for k in range(0,3)]
+        value*= v
+    return value, gradient
+
+def linearFactor(k, x, a):
+    ''' Return the factor (1+x*a)/2 in the direction k.'''
+    g= [0.0, 0.0, 0.0]
+    g[k]= 0.5*a
+    return (0.5*(1.0+x*a), g)
+
+def quadraticFactor(k, x, a):
+    ''' Return the quadratic Lagrange polynomial of the node at a in
+        the direction k.'''
+    g= [0.0, 0.0, 0.0]
+    if(a==0):
+        g[k]= -2.0*x
+        return (1.0-x*x, g)
+    else:
+        g[k]= x+0.5*a
+        return (0.5*x*(x+a), g)
+
+def shapeFunction(elementType, nat, rst):
+    ''' Return the value and the gradient (with respect to the natural
+        coordinates) of the shape function of the node.'''
+    if(elementType=='EightNodeBrick'):
+        return product([linearFactor(k, rst[k], nat[k]) for k in range(0,3)])
+    elif(elementType=='TwentySevenNodeBrick'):
+        return product([quadraticFactor(k, rst[k], nat[k]) for k in range(0,3)])
+    else: # Serendipity.
+        if(0 in nat): # mid-side node.
+            factors= list()
+            for k in range(0,3):
+                if(nat[k]==0):
+                    factors.append(quadraticFactor(k, rst[k], 0))
+                else:
+                    factors.append(linearFactor(k, rst[k], nat[k]))
+            return product(factors)
+        else: # corner node.
+            factors= [linearFactor(k, rst[k], nat[k]) for k in range(0,3)]
+            factors.append((sum([rst[k]*nat[k] for k in range(0,3)])-2.0, list(nat)))
+            return product(factors)
+
+def inverse3x3(m):
+    ''' Return the determinant and the inverse of a 3x3 matrix.'''
+    det= m[0][0]*(m[1][1]*m[2][2]-m[1][2]*m[2][1])-m[0][1]*(m[1][0]*m[2][2]-m[1][2]*m[2][0])+m[0][2]*(m[1][0]*m[2][1]-m[1][1]*m[2][0])
+    inv= [[0.0]*3 for i in range(0,3)]
+    for i in range(0,3):
+        for j in range(0,3):
+            a= [[m[r][c] for c in range(0,3) if c!=i] for r in range(0,3) if r!=j]
+            inv[i][j]= ((-1)**(i+j))*(a[0][0]*a[1][1]-a[0][1]*a[1][0])/det
+    return det, inv
+
+def elasticity(i, j, k, l):
+    ''' Linear elastic isotropic tensor.'''
+    d= lambda a, b: 1.0 if a==b else 0.0
+    return lmbda*d(i,j)*d(k,l)+mu*(d(i,k)*d(j,l)+d(i,l)*d(j,k))
+
+def referenceStiffness(elementType, coords):
+    ''' Return the stiffness matrix and the volume computed by Gauss
+        integration.'''
+    nat= naturalCoordinates[elementType]
+    numNodes= len(nat)
+    K= [[0.0]*3*numNodes for i in range(0,3*numNodes)]
+    volume= 0.0
+    C= [[[[elasticity(i,j,k,l) for l in range(0,3)] for k in range(0,3)] for j in range(0,3)] for i in range(0,3)]
+    pts= gaussPoints[gaussOrder[elementType]]
+    for (r, rw), (s, sw), (t, tw) in itertools.product(pts, pts, pts):
+        dh= [shapeFunction(elementType, n, (r,s,t))[1] for n in nat]
+        # J[j][k]= dx_k/dr_j
+        J= [[sum([dh[a][j]*coords[a][k] for a in range(0,numNodes)]) for k in range(0,3)] for j in range(0,3)]
+        det, Jinv= inverse3x3(J)
+        # dN_a/dx_k= sum_j dN_a/dr_j*dr_j/dx_k
+        dN= [[sum([Jinv[k][j]*dh[a][j] for j in range(0,3)]) for k in range(0,3)] for a in range(0,numNodes)]
+        w= rw*sw*tw*det
+        volume+= w
+        for a in range(0,numNodes):
+            for b in range(0,numNodes):
+                for i in range(0,3):
+                    for k in range(0,3):
+                        v= 0.0
+                        for j in range(0,3):
+                            for l in range(0,3):
+                                v+= dN[a][j]*C[i][j][k][l]*dN[b][l]
+                        K[3*a+i][3*b+k]+= w*v
+    return K, volume
+
+def createElement(elementType):
+    ''' Create the element and return the model, the element, its nodes
+        and the coordinates of the nodes.'''
+    feProblem= xc.FEProblem()
+    preprocessor= feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodeHandler)
+    elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+    coords= [geometry(*n) for n in naturalCoordinates[elementType]]
+    nodes= [nodeHandler.newNodeXYZ(*x) for x in coords]
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast3d.name
+    elem= elements.newElement(elementType, xc.ID([n.tag for n in nodes]))
+    return feProblem, elem, nodes, coords
+
+def setDisplacements(elem, nodes, u):
+    ''' Impose the displacements on the nodes and update the element.'''
+    for i, n in enumerate(nodes):
+        n.setTrialDisp(xc.Vector(u[3*i:3*i+3]))
+    elem.update()
+    f= elem.getResistingForce()
+    return [f[i] for i in range(0, len(u))]
+
+errK= 0.0
+errF= 0.0
+errVirial= 0.0
+ok= True
+for elementType in ['EightNodeBrick', 'TwentyNodeBrick', 'TwentySevenNodeBrick']:
+    feProblem, elem, nodes, coords= createElement(elementType)
+    numDOF= 3*len(nodes)
+    ok= ok and (elem.getNumDOF()==numDOF)
+    # Stiffness matrix.
+    Kref, volume= referenceStiffness(elementType, coords)
+    Kmat= elem.getTangentStiff()
+    K= [[Kmat(i,j) for j in range(0,numDOF)] for i in range(0,numDOF)]
+    Kmax= max([max([abs(v) for v in row]) for row in Kref])
+    errK= max(errK, max([max([abs(K[i][j]-Kref[i][j]) for j in range(0,numDOF)]) for i in range(0,numDOF)])/Kmax)
+    # Nodal forces for an arbitrary displacement: f= K*u.
+    u= [1e-3*math.sin(1.0+0.7*i) for i in range(0,numDOF)]
+    f= setDisplacements(elem, nodes, u)
+    fRef= [sum([Kref[i][j]*u[j] for j in range(0,numDOF)]) for i in range(0,numDOF)]
+    fMax= max([abs(v) for v in fRef])
+    errF= max(errF, max([abs(a-b) for a, b in zip(f, fRef)])/fMax)
+    # Linear displacement field u= A*x (constant stress).
+    A= [[1e-3, 2e-4, -3e-4], [-1e-4, -5e-4, 4e-4], [2.5e-4, 1.5e-4, 7e-4]]
+    uLin= list()
+    for x in coords:
+        uLin.extend([sum([A[i][j]*x[j] for j in range(0,3)]) for i in range(0,3)])
+    f= setDisplacements(elem, nodes, uLin)
+    eps= [[0.5*(A[i][j]+A[j][i]) for j in range(0,3)] for i in range(0,3)]
+    trEps= eps[0][0]+eps[1][1]+eps[2][2]
+    sigma= [[lmbda*trEps*(1.0 if i==j else 0.0)+2.0*mu*eps[i][j] for j in range(0,3)] for i in range(0,3)]
+    sigmaMax= max([max([abs(v) for v in row]) for row in sigma])
+    for i in range(0,3):
+        for j in range(0,3):
+            virial= sum([f[3*a+i]*coords[a][j] for a in range(0,len(coords))])
+            errVirial= max(errVirial, abs(virial/volume-sigma[i][j])/sigmaMax)
+    '''
+    print(elementType, 'errK= ', errK, 'errF= ', errF, 'errVirial= ', errVirial)
+    '''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok and (errK<1e-10) and (errF<1e-10) and (errVirial<1e-10)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
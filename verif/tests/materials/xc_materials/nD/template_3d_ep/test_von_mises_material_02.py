@@ -0,0 +1,109 @@
+# -*- coding: utf-8 -*-
+''' Check the forward Euler integration (Template3Dep::ForwardEulerEPState)
+    of an elastic perfectly plastic von Mises material (no evolution laws)
+    against the analytical values:
+
+    - elastic step: sigma= lambda*tr(eps)*I+2*mu*eps and the tangent
+      stiffness is the elastic one.
+    - pure shear step beyond the yield point: the stress remains a pure
+      shear stress and its value is the yield stress k/sqrt(3) (the yield
+      function is f= 3/2*s:s-k^2), the shear component of the tangent
+      stiffness vanishes and the normal components are the elastic ones.
+'''
+
+from __future__ import print_function
+
+import math
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Define finite element problem.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+
+E= 3000.0 # Young modulus.
+nu= 0.25 # Poisson's ratio.
+k= 20.0 # Yield surface parameter.
+lmbda= E*nu/((1.0+nu)*(1.0-2.0*nu))
+mu= E/(2.0*(1.0+nu))
+tauY= k/math.sqrt(3.0) # Yield stress in pure shear.
+
+elasticMat= typical_materials.defElasticIsotropic3d(preprocessor, "elastIso3d",E,nu,0.0)
+
+def defVonMises(name):
+    ''' Define an elastic perfectly plastic von Mises material.'''
+    epState= xc.EPState()
+    epState.stress= xc.stresstensor([0, 0, 0, 0, 0, 0, 0, 0, 0]) # no initial stress.
+    epState.scalarVars= [k] # scalar variables.
+    epState.tensorVars= [] # tensorial variables.
+    return typical_materials.defTemplate3Dep(preprocessor, name= name, elasticMaterial= elasticMat, yieldSurface= xc.VonMisesYieldSurface(), potentialSurface= xc.VonMisesPotentialSurface(), elasticPlasticState= epState, scalarEvolutionLaws= [], tensorialEvolutionLaws= [])
+
+def getComponents(t):
+    ''' Return the components of the second order tensor argument.'''
+    return [[t.getValue([i+1, j+1]) for j in range(0,3)] for i in range(0,3)]
+
+def elasticity(i, j, p, q):
+    ''' Linear elastic isotropic tensor (0-based indices).'''
+    d= lambda a, b: 1.0 if a==b else 0.0
+    return lmbda*d(i,j)*d(p,q)+mu*(d(i,p)*d(j,q)+d(i,q)*d(j,p))
+
+# Elastic step.
+elasticStep= defVonMises("elasticStep")
+eps= [[1e-4, 2e-4, 0.0], [2e-4, -5e-5, 1e-4], [0.0, 1e-4, 3e-5]]
+elasticStep.setTrialStrainIncrTensor(xc.straintensor(eps[0]+eps[1]+eps[2]))
+sigma= getComponents(elasticStep.getStressTensor())
+trEps= eps[0][0]+eps[1][1]+eps[2][2]
+errElasticStress= 0.0
+for i in range(0,3):
+    for j in range(0,3):
+        sigmaRef= lmbda*trEps*(1.0 if i==j else 0.0)+2.0*mu*eps[i][j]
+        errElasticStress= max(errElasticStress, abs(sigma[i][j]-sigmaRef))
+errElasticStress/= (2.0*mu*2e-4)
+Eep= elasticStep.getTangentTensor()
+errElasticTangent= 0.0
+for i in range(0,3):
+    for j in range(0,3):
+        for p in range(0,3):
+            for q in range(0,3):
+                errElasticTangent= max(errElasticTangent, abs(Eep.getValue([i+1,j+1,p+1,q+1])-elasticity(i,j,p,q)))
+errElasticTangent/= (lmbda+2.0*mu)
+
+# Pure shear step beyond the yield point (twice the yield strain).
+plasticStep= defVonMises("plasticStep")
+gamma= 2.0*tauY/mu # engineering shear strain.
+plasticStep.setTrialStrainIncrTensor(xc.straintensor([0.0, gamma/2.0, 0.0, gamma/2.0, 0.0, 0.0, 0.0, 0.0, 0.0]))
+sigma= getComponents(plasticStep.getStressTensor())
+errTau= max(abs(sigma[0][1]-tauY), abs(sigma[1][0]-tauY))/tauY
+errPureShear= 0.0 # other components must remain zero.
+for i in range(0,3):
+    for j in range(0,3):
+        if((i,j) not in [(0,1),(1,0)]):
+            errPureShear= max(errPureShear, abs(sigma[i][j]))
+errPureShear/= tauY
+Eep= plasticStep.getTangentTensor()
+errEep1212= abs(Eep.getValue([1,2,1,2]))/mu
+errEep1111= abs(Eep.getValue([1,1,1,1])-(lmbda+2.0*mu))/(lmbda+2.0*mu)
+errEep1122= abs(Eep.getValue([1,1,2,2])-lmbda)/lmbda
+
+'''
+print('errElasticStress= ', errElasticStress)
+print('errElasticTangent= ', errElasticTangent)
+print('tau= ', sigma[0][1], ' tauY= ', tauY, ' errTau= ', errTau)
+print('errPureShear= ', errPureShear)
+print('Eep_1212= ', Eep.getValue([1,2,1,2]), ' errEep1212= ', errEep1212)
+print('errEep1111= ', errEep1111, ' errEep1122= ', errEep1122)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if (errElasticStress<1e-10) and (errElasticTangent<1e-12) and (errTau<1e-6) and (errPureShear<1e-6) and (errEep1212<1e-6) and (errEep1111<1e-10) and (errEep1122<1e-10):
+    print("test "+fname+": ok.")
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,160 @@
+# -*- coding: utf-8 -*-
+''' Check the capacity factors computed for a large number of internal
+    force triplets (N,My,Mz) and pairs (N,My) using the batch method
+    getCapacityFactors with one and several threads. Home made test. '''
+
+from __future__ import print_function
+from __future__ import division
+
+import math
+import geom
+import xc
+
+from materials.ehe import EHE_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+width= 0.2 # Section width expressed in meters.
+depth= 0.4 # Section width expressed in meters.
+cover= 0.05 # Concrete cover expressed in meters.
+areaFi16= 2.01e-4 # Rebar area expressed in square meters.
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Define materials
+concr= EHE_materials.HA25
+concr.alfacc=0.85    #f_maxd= 0.85*fcd concrete long term compressive strength factor (normally alfacc=1)
+concrMatTag25= concr.defDiagD(preprocessor)
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+
+# Concrete section geometry.
+geomSecHA= preprocessor.getMaterialHandler.newSectionGeometry("geomSecHA")
+regions= geomSecHA.getRegions
+concrete= regions.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+concrete.nDivIJ= 10 # number of divisions in the IJ direction.
+concrete.nDivJK= 10 # number of divisions in the JK direction.
+concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0) # lower left corner.
+concrete.pMax= geom.Pos2d(depth/2.0,width/2.0) # upper right corner.
+
+# Reinforcement.
+reinforcement= geomSecHA.getReinfLayers
+reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementInf.numReinfBars= 2 # number of bars.
+reinforcementInf.barArea= areaFi16 # bar area.
+reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementSup.numReinfBars= 2 # number of bars.
+reinforcementSup.barArea= areaFi16 # bar area.
+reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+materialHandler= preprocessor.getMaterialHandler
+secHA= materialHandler.newMaterial("fiber_section_3d","secHA")
+fiberSectionRepr= secHA.getFiberSectionRepr()
+fiberSectionRepr.setGeomNamed(geomSecHA.name)
+secHA.setupFibers()
+
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.reinforcementTag= EHE_materials.B500S.matTagD
+diagIntsecHA= materialHandler.calcInteractionDiagram(secHA.name,param)
+diagIntsecHA2d= materialHandler.calcInteractionDiagramNMy(secHA.name,param)
+
+# Internal forces distributed over the directions of the (N,My,Mz) space.
+N0= 1e6; M0= 1e5
+triplets= list()
+for i in range(0, 20):
+    theta= math.pi*(i+0.5)/20.0
+    for j in range(0, 40):
+        phi= 2.0*math.pi*j/40.0
+        r= 0.25+0.1*(j%10) # inside and outside the diagram.
+        triplets.append([r*N0*math.cos(theta), r*M0*math.sin(theta)*math.cos(phi), r*M0*math.sin(theta)*math.sin(phi)])
+pairs= [[t[0],t[1]] for t in triplets]
+
+# One by one.
+ref3d= [diagIntsecHA.getCapacityFactor(geom.Pos3d(t[0],t[1],t[2])) for t in triplets]
+ref2d= [diagIntsecHA2d.getCapacityFactor(geom.Pos2d(p[0],p[1])) for p in pairs]
+
+# Batch.
+m3d= xc.Matrix(triplets)
+m2d= xc.Matrix(pairs)
+ok= True
+for numThreads in [1, 4]:
+    cf3d= diagIntsecHA.getCapacityFactors(m3d, numThreads)
+    cf2d= diagIntsecHA2d.getCapacityFactors(m2d, numThreads= numThreads)
+    ok= ok and (len(cf3d)==len(triplets)) and (len(cf2d)==len(pairs))
+    ok= ok and ([cf3d[i] for i in range(0,len(cf3d))]==ref3d)
+    ok= ok and ([cf2d[i] for i in range(0,len(cf2d))]==ref2d)
+
+# The intersection of the half-line through the internal forces with the
+# diagram must be in the diagram boundary.
+err3d= 0.0
+for t, cf in zip(triplets, ref3d):
+    C= geom.Pos3d(t[0]/cf, t[1]/cf, t[2]/cf)
+    err3d= max(err3d, abs(diagIntsecHA.getCapacityFactor(C)-1.0))
+ok= ok and (err3d<1e-4)
+
+# Reference values for the 2D diagram computed intersecting the half-lines
+# with the edges of the polygon.
+def capacityFactor2d(vertices, p):
+    ''' Return the capacity factor for the internal forces p.'''
+    tMin= None
+    n= len(vertices)
+    for i in range(0,n):
+        A= vertices[i]; B= vertices[(i+1)%n]
+        ex= B.x-A.x; ey= B.y-A.y
+        denom= p[0]*ey-p[1]*ex
+        if(denom!=0.0):
+            t= (A.x*ey-A.y*ex)/denom
+            s= (A.x*p[1]-A.y*p[0])/denom
+            if((t>0.0) and (s>=-1e-9) and (s<=1.0+1e-9)):
+                if((tMin is None) or (t<tMin)):
+                    tMin= t
+    return 1.0/tMin
+
+vertices= diagIntsecHA2d.getVertexList()
+err2d= 0.0
+for p, cf in zip(pairs, ref2d):
+    err2d= max(err2d, abs(capacityFactor2d(vertices, p)-cf)/cf)
+ok= ok and (err2d<1e-9)
+
+# Move the 2D diagram (the origin remains inside it): the angular index
+# must be rebuilt from the new vertices.
+xMin= min(v.x for v in vertices); xMax= max(v.x for v in vertices)
+diagIntsecHA2d.move(geom.Vector2d(0.05*(xMax-xMin), 0.0))
+movedVertices= diagIntsecHA2d.getVertexList()
+cfMoved= diagIntsecHA2d.getCapacityFactors(m2d, numThreads= 2)
+errMoved= 0.0
+for i, p in enumerate(pairs):
+    cf= capacityFactor2d(movedVertices, p)
+    errMoved= max(errMoved, abs(cfMoved[i]-cf)/cf)
+    errMoved= max(errMoved, abs(diagIntsecHA2d.getCapacityFactor(geom.Pos2d(p[0],p[1]))-cf)/cf)
+ok= ok and (errMoved<1e-9)
+
+# Values from test_interaction_diagram01.py
+ratio1= diagIntsecHA.getCapacityFactor(geom.Pos3d(352877,0,0))-1
+ratio3= diagIntsecHA.getCapacityFactor(geom.Pos3d(-574457,41505.4,2.00089e-11))-1.0
+ratio4= diagIntsecHA.getCapacityFactor(geom.Pos3d(-978599,-10679.4,62804.3))-1.0
+ok= ok and (abs(ratio1)<1e-5) and (abs(ratio3)<1e-5) and (abs(ratio4)<1e-5)
+
+'''
+print('err3d= ', err3d)
+print('err2d= ', err2d)
+print('errMoved= ', errMoved)
+print("ratio1= ",(ratio1))
+print("ratio3= ",(ratio3))
+print("ratio4= ",(ratio4))
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+''' Check the stress resultants and the tangent stiffness of a fiber
+    section whose fibers use different material types (elastic, steel
+    and concrete) interleaved. The fibers are updated grouped by material
+    type, so the results must not depend on the order of the fibers.
+'''
+
+from __future__ import print_function
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Define materials
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", 2.1e9)
+steel01= typical_materials.defSteel01(preprocessor, "steel01", E= 200e9, fy= 500e6, b= 0.01)
+steel02= typical_materials.defSteel02(preprocessor, "steel02", E= 200e9, fy= 400e6, b= 0.02)
+concrete01= typical_materials.defConcrete01(preprocessor, "concrete01", epsc0= -2e-3, fpc= -25e6, fpcu= -20e6, epscu= -3.5e-3)
+concrete02= typical_materials.defConcrete02(preprocessor, "concrete02", epsc0= -2e-3, fpc= -30e6, fpcu= -25e6, epscu= -3.5e-3)
+materialNames= [elast.name, steel01.name, concrete01.name, steel02.name, concrete02.name]
+
+# Section with the fibers of different materials interleaved.
+fiberSectionTest= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d","fiberSectionTest")
+nDiv= 6
+for i in range(0,nDiv):
+    for j in range(0,nDiv):
+        y= -0.3+0.6*(i+0.5)/nDiv
+        z= -0.2+0.4*(j+0.5)/nDiv
+        matName= materialNames[(i*nDiv+j)%len(materialNames)]
+        area= 1e-3*(1.0+0.1*j)
+        fiberSectionTest.addFiber(matName, area, xc.Vector([y,z]))
+
+def checkSection(sectionDeformation):
+    ''' Impose the section deformation and compare the section
+        response with the one obtained from the fibers.'''
+    fiberSectionTest.setTrialSectionDeformation(xc.Vector(sectionDeformation))
+    R= fiberSectionTest.getStressResultant()
+    K= fiberSectionTest.getTangentStiffness()
+    N= 0.0; Mz= 0.0; My= 0.0; EA= 0.0
+    maxStrainErr= 0.0
+    for f in fiberSectionTest.getFibers():
+        y= f.getLocY()
+        z= f.getLocZ()
+        A= f.getArea()
+        mat= f.getMaterial()
+        strain= sectionDeformation[0]+sectionDeformation[1]*y+sectionDeformation[2]*z
+        maxStrainErr= max(maxStrainErr, abs(mat.getStrain()-strain))
+        s= mat.getStress()
+        N+= s*A
+        Mz+= s*A*y
+        My+= s*A*z
+        EA+= mat.getTangent()*A
+    scale= max(abs(N), abs(Mz), abs(My), 1.0)
+    err= max(abs(R[0]-N), abs(R[1]-Mz), abs(R[2]-My))/scale
+    errK= abs(K.at(1,1)-EA)/max(EA,1.0)
+    return maxStrainErr, err, errK
+
+# Deformation history (loading, unloading and reloading in the
+# opposite sense).
+deformations= [[-5e-4, 4e-3, -2e-3], [1e-4, -6e-3, 5e-3], [-1e-3, 8e-3, 1e-3]]
+results= list()
+for d in deformations:
+    results.append(checkSection(d))
+    fiberSectionTest.commitState()
+
+ok= True
+for (maxStrainErr, err, errK) in results:
+    ok= ok and (maxStrainErr<1e-12) and (err<1e-10) and (errK<1e-10)
+
+'''
+for r in results:
+    print('maxStrainErr= ', r[0], ' err= ', r[1], ' errK= ', r[2])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,78 @@
+# -*- coding: utf-8 -*-
+''' Time and memory needed by the TDConcrete material to compute the creep
+    strain as a function of the number of time steps. When the whole stress
+    history is integrated, the memory grows linearly and the time per step
+    grows linearly with the number of steps (quadratic total time). With the
+    Dirichlet series (Kelvin chain) approximation of the creep function
+    (exponentialCreep= True) both are constant per step (benchmark).
+'''
+
+from __future__ import print_function
+
+import time
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Units: kN, mm
+GPa = 1.0
+MPa = 0.001*GPa
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+domain= preprocessor.getDomain
+materialHandler= preprocessor.getMaterialHandler
+
+def newMaterial(name, exponentialCreep):
+    ''' Create a TDConcrete material.'''
+    retval= typical_materials.defTDConcrete(preprocessor= preprocessor, name= name, fpc= -28*MPa, ft= 3*MPa, Ec= 25*GPa, beta= 0.4, age= 14, epsshu= 0.0, epssha= 75.4218, tcr= 28, epscru= 3.0, epscra= 1.0, epscrd= 75.4218, tcast= 0)
+    retval.exponentialCreep= exponentialCreep
+    return retval
+
+def run(material, numSteps, dt= 1.0, t0= 28.0):
+    ''' Impose a constant strain and advance the time numSteps steps
+        (relaxation). Return the elapsed time, the size of the stress
+        history and the last stress.'''
+    strain= -3e-4
+    domain.currentTime= t0
+    material.setTrialStrain(strain, 0.0)
+    material.commitState()
+    materialHandler.setCreepOn()
+    startTime= time.time()
+    for i in range(0, numSteps):
+        domain.currentTime= t0+(i+1)*dt
+        material.setTrialStrain(strain, 0.0)
+        material.commitState()
+    lapse= time.time()-startTime
+    materialHandler.setCreepOff()
+    return lapse, material.getHistorySize(), material.getStress()
+
+stepCounts= [250, 500, 1000, 2000]
+results= list()
+ok= True
+for i, numSteps in enumerate(stepCounts):
+    history= newMaterial('history'+str(i), exponentialCreep= False)
+    exponential= newMaterial('exponential'+str(i), exponentialCreep= True)
+    rh= run(history, numSteps)
+    re= run(exponential, numSteps)
+    results.append((numSteps, rh, re))
+    stressErr= abs(rh[2]-re[2])/abs(rh[2])
+    ok= ok and (stressErr<5e-3) and (re[1]==results[0][2][1]) and (rh[1]>numSteps)
+
+'''
+for (numSteps, rh, re) in results:
+    print('steps: ', numSteps, ' history: ', rh[0], 's ', rh[1], ' values; exponential: ', re[0], 's ', re[1], ' values; stresses: ', rh[2], re[2])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
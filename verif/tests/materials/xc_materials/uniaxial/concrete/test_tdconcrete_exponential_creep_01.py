@@ -0,0 +1,126 @@
+# -*- coding: utf-8 -*-
+''' Compare the results of the TDConcrete, TDConcreteMC10 and
+    TDConcreteMC10NL materials
+    when the creep strain is computed integrating the whole stress history
+    and when it is computed using a Dirichlet series (Kelvin chain)
+    approximation of the creep function (exponentialCreep= True).
+
+Based on the example: https://portwooddigital.com/2023/05/28/minimal-creep-and-shrinkage-example/
+'''
+
+from __future__ import print_function
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc
+from materials import typical_materials
+from model import predefined_spaces
+from solution import predefined_solutions
+
+# Units: kN, mm
+kN = 1
+mm = 1
+GPa = kN/mm**2
+MPa = 0.001*GPa
+
+Es = 200*GPa # steel modulus of elasticity.
+Ec = 25*GPa # concrete modulus of elasticity
+fc = -28*MPa # concrete compressive strength (compression is negative)
+fcu = 0.85*fc # stress at ultimate (crushing) strain (TDConcreteMC10NL).
+epscu = -0.0035 # strain at crushing strength (TDConcreteMC10NL).
+ft = 3*MPa # concrete tensile strength (tension is positive)
+beta = 0.4 # tension softening parameter.
+tDry = 14 # days
+tcast = 0 # analysis time corresponding to concrete casting.
+Tcr = 28 # creep model age (in days)
+As = 1500*mm**2 # steel area.
+Ac = 300*mm*300*mm-As # concrete area.
+P= 1000*kN # axial load.
+
+def defConcrete(preprocessor, materialType):
+    ''' Define the time-dependent concrete material.'''
+    if(materialType=='TDConcrete'):
+        retval= typical_materials.defTDConcrete(preprocessor= preprocessor, name= 'tdConcrete',fpc= fc,ft= ft, Ec= Ec, beta= beta, age= tDry, epsshu= -600e-6, epssha= 75.4218, tcr= Tcr, epscru= 3.0, epscra= 1.0, epscrd= 75.4218, tcast= tcast)
+    elif(materialType=='TDConcreteMC10'):
+        retval= typical_materials.defTDConcreteMC10(preprocessor= preprocessor, name= 'tdConcrete', fcm= fc, ft= ft, Ec= Ec, Ecm= 30.303*GPa, beta= beta, age= tDry, epsba= -0.000034, epsbb= 1.0, epsda= -0.000853, epsdb= 787.50, phiba= 0.1747, phibb= 1.0, phida= 3.651, phidb= 504.5, tcast= tcast, cem= 1.0)
+    else:
+        retval= typical_materials.defTDConcreteMC10NL(preprocessor= preprocessor, name= 'tdConcrete', fcm= fc, fcu= fcu, epscu= epscu, ft= ft, Ec= Ec, Ecm= 30.303*GPa, beta= beta, age= tDry, epsba= -0.000034, epsbb= 1.0, epsda= -0.000853, epsdb= 787.50, phiba= 0.1747, phibb= 1.0, phida= 3.651, phidb= 504.5, tcast= tcast, cem= 1.0)
+    return retval
+
+def computeConcreteStresses(materialType, exponentialCreep, numSteps, dt= 10):
+    ''' Compute the stresses in the concrete of a column under constant
+        axial load.
+
+    :param materialType: type of the time-dependent concrete material.
+    :param exponentialCreep: if true use the exponential creep algorithm.
+    :param numSteps: number of time steps.
+    :param dt: time increment (days).
+    '''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast",Es)
+    tdConcrete= defConcrete(preprocessor, materialType)
+    tdConcrete.exponentialCreep= exponentialCreep
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    modelSpace.setCreepOff()
+    n1= modelSpace.newNode(0, 0)
+    n2= modelSpace.newNode(0, 0)
+    modelSpace.fixNode000(n1.tag)
+    modelSpace.fixNodeF00(n2.tag)
+    twoFibersSection= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d","twoFibersSection")
+    twoFibersSection.addFiber(elast.name, As, xc.Vector([0,0]))
+    concreteFiber= twoFibersSection.addFiber(tdConcrete.name, Ac, xc.Vector([0,0]))
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= twoFibersSection.name
+    elements.dimElem= 1
+    zl= elements.newElement("ZeroLengthSection",xc.ID([n1.tag, n2.tag]))
+    concreteFiber= zl.getMaterial().getFibers().findFiber(concreteFiber.tag)
+    modelSpace.newTimeSeries(name= "ts", tsType= "constant_ts")
+    lp0= modelSpace.newLoadPattern(name= 'lp0')
+    modelSpace.setCurrentLoadPattern(lp0.name)
+    lp0.newNodalLoad(n2.tag, xc.Vector([-P, 0, 0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    modelSpace.setCurrentTime(Tcr)
+    solProc= predefined_solutions.PlainNewtonRaphson(feProblem, printFlag= 0)
+    solProc.setup()
+    solProc.integrator.dLambda1= 0.0
+    solProc.analysis.analyze(1)
+    solProc.integrator.dLambda1= dt
+    solProc.integrator.setNumIncr(10)
+    modelSpace.setCreepOn()
+    stresses= list()
+    for i in range(0, numSteps):
+        solProc.analysis.analyze(1)
+        stresses.append(concreteFiber.getStress())
+    modelSpace.setCreepOff()
+    historySize= concreteFiber.getMaterial().getHistorySize()
+    return stresses, historySize
+
+numSteps= 1000
+ok= True
+results= list()
+for materialType in ['TDConcrete', 'TDConcreteMC10', 'TDConcreteMC10NL']:
+    refStresses, refHistorySize= computeConcreteStresses(materialType, exponentialCreep= False, numSteps= numSteps)
+    expStresses, expHistorySize= computeConcreteStresses(materialType, exponentialCreep= True, numSteps= numSteps)
+    maxStress= max([abs(s) for s in refStresses])
+    err= max([abs(a-b) for a, b in zip(refStresses, expStresses)])/maxStress
+    results.append((materialType, err, refHistorySize, expHistorySize))
+    ok= ok and (err<5e-3) and (expHistorySize<100) and (refHistorySize>numSteps)
+
+'''
+for r in results:
+    print(r[0], 'relative error: ', r[1], ' history size: ', r[2], '->', r[3])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
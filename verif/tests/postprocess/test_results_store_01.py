@@ -0,0 +1,83 @@
+# -*- coding: utf-8 -*-
+''' Write the internal forces of a large number of elements for several
+    load combinations in a binary results store and read back the results
+    of a subset of the elements.'''
+
+from __future__ import print_function
+
+import os
+import math
+import tempfile
+import xc
+from postprocess import results_store
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numElements= 2000
+combNames= ['ULS01', 'ULS02', 'ULS03', 'ULS04']
+
+# Synthetic results with the structure of the internal forces dictionaries.
+resultsDict= dict()
+for i, combName in enumerate(combNames):
+    combDict= dict()
+    for tag in range(1, numElements+1):
+        internalForces= dict()
+        for j in range(0, 2): # two integration points.
+            internalForces[j]= {'N': 10.0*i+tag+0.1*j, 'My': -2.0*tag+i, 'Mz': 0.5*tag*j}
+        elemType= 'ForceBeamColumn3d' if (tag%2) else 'ShellMITC4'
+        combDict[tag]= {'type': elemType, 'internalForces': internalForces}
+    resultsDict[combName]= combDict
+
+fName= os.path.join(tempfile.gettempdir(), 'test_results_store_01.xcrs')
+results_store.write_results_store(fName, resultsDict, labelKey= 'type')
+
+# Read back using the C++ reader.
+reader= xc.ResultsStoreReader()
+ok= reader.open(fName)
+ok= ok and (reader.numEntities==numElements) and (reader.numCombinations==len(combNames))
+ok= ok and (reader.numComponents==6) and (reader.getCombinationNames()==combNames)
+comp= reader.getComponentIndex('internalForces.1.N')
+comb= reader.getCombinationIndex('ULS03')
+ok= ok and (abs(reader.getValue(1500, comb, comp)-(10.0*2+1500+0.1))<1e-10)
+entityValues= reader.getEntityValues(77) # combinations x components.
+ok= ok and (entityValues.noRows==len(combNames)) and (entityValues.noCols==6)
+compMy= reader.getComponentIndex('internalForces.0.My')
+ok= ok and (abs(entityValues(3, compMy)-(-2.0*77+3))<1e-10)
+ok= ok and (reader.getLabels()[reader.getEntityIndex(8)]=='ShellMITC4')
+reader.close()
+
+# Read a subset of the elements.
+elementsOfInterest= [5, 1999, 733, 12345] # the last one doesn't exist.
+subset= results_store.read_results_subset(fName, tags= elementsOfInterest, labelKey= 'type')
+ok= ok and (list(subset.keys())==combNames)
+err= 0.0
+for combName in combNames:
+    combDict= subset[combName]
+    ok= ok and (len(combDict)==3) and ('12345' not in combDict)
+    for tag in elementsOfInterest[:-1]:
+        ref= resultsDict[combName][tag]
+        value= combDict[str(tag)]
+        ok= ok and (value['type']==ref['type'])
+        for j in range(0, 2):
+            for key in ['N', 'My', 'Mz']:
+                err+= (value['internalForces'][str(j)][key]-ref['internalForces'][j][key])**2
+err= math.sqrt(err)
+ok= ok and (err<1e-10)
+
+'''
+print(subset['ULS02']['733'])
+print('err= ', err)
+'''
+
+results_store.remove_results_store(fName)
+
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
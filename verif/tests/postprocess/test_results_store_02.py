@@ -0,0 +1,126 @@
+# -*- coding: utf-8 -*-
+''' Check that LimitStateData.getInternalForcesSubset reads the internal
+    forces from the binary results store once all the combinations have
+    been analyzed, and that the values are the same as the ones in the
+    JSON file. If the store is not complete (no completion stamp) the
+    values must be read from the JSON file.'''
+
+from __future__ import print_function
+
+import os
+import json
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from actions import combinations as combs
+from postprocess import limit_state_data as lsd
+from postprocess import results_store
+from postprocess.config import default_config
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Cantilever made of elastic beams.
+L= 5.0 # Length of the cantilever.
+numElements= 10
+section= typical_materials.defElasticSection3d(preprocessor, "section", A= 0.01, E= 210e9, G= 81e9, Iz= 1e-4, Iy= 2e-4, J= 1e-5)
+lin= modelSpace.newLinearCrdTransf("lin", xc.Vector([0,1,0]))
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= section.name
+nodeList= [nodes.newNodeXYZ(L*i/numElements, 0.0, 0.0) for i in range(0, numElements+1)]
+for n0, n1 in zip(nodeList[:-1], nodeList[1:]):
+    elements.newElement("ElasticBeam3d", xc.ID([n0.tag, n1.tag]))
+modelSpace.fixNode000_000(nodeList[0].tag)
+
+# Loads.
+lp0= modelSpace.newLoadPattern(name= 'lp0')
+lp0.newNodalLoad(nodeList[-1].tag, xc.Vector([1e3, 0.0, -10e3, 0.0, 0.0, 0.0]))
+lp1= modelSpace.newLoadPattern(name= 'lp1')
+lp1.newNodalLoad(nodeList[-1].tag, xc.Vector([0.0, 5e3, 0.0, 1e3, 0.0, 0.0]))
+
+# Load combinations.
+combContainer= combs.CombContainer()
+combContainer.ULS.perm.add('ULS01', '1.35*lp0')
+combContainer.ULS.perm.add('ULS02', '1.35*lp0+1.5*lp1')
+combContainer.ULS.perm.add('ULS03', '1.0*lp0-1.5*lp1')
+totalSet= preprocessor.getSets.getSet('total')
+
+cfg= default_config.get_temporary_env_config()
+lsd.LimitStateData.envConfig= cfg
+limitState= lsd.normalStressesResistance
+limitState.writeResultsStore= True
+limitState.analyzeLoadCombinations(combContainer, totalSet)
+
+# Count the reads of the results store.
+storeReads= [0]
+readResultsSubset= results_store.read_results_subset
+def countingReadResultsSubset(*args, **kwargs):
+    storeReads[0]+= 1
+    return readResultsSubset(*args, **kwargs)
+lsd.rs.read_results_subset= countingReadResultsSubset
+
+# Reference values from the JSON file.
+elementsOfInterest= [2, 5, 9]
+with open(limitState.getInternalForcesFileName()) as jsonFile:
+    jsonDict= json.load(jsonFile)
+
+def compare(subset):
+    ''' Return the maximum difference between the subset and the values
+        in the JSON file.'''
+    retval= 0.0
+    for combName in jsonDict:
+        combDict= subset[combName]
+        if(len(combDict)!=len(elementsOfInterest)):
+            return 1e6
+        for tag in elementsOfInterest:
+            ref= jsonDict[combName][str(tag)]
+            value= combDict[str(tag)]
+            if(value['type']!=ref['type']):
+                return 1e6
+            for j in ref['internalForces']:
+                refValues= ref['internalForces'][j]
+                for key in refValues:
+                    if(key in ['N', 'My', 'Mz', 'Vy', 'Vz', 'T']):
+                        retval= max(retval, abs(value['internalForces'][j][key]-refValues[key]))
+    return retval
+
+# The store is complete: the values are read from it.
+storeFileName= limitState.getInternalForcesStoreFileName()
+ok= results_store.is_complete(storeFileName)
+subset= limitState.getInternalForcesSubset(elementsOfInterest)
+ok= ok and (storeReads[0]==1) and (len(subset)==3)
+err= compare(subset)
+ok= ok and (err<1e-6)
+
+# Without completion stamp the values are read from the JSON file.
+os.remove(results_store.get_completion_stamp_file_name(storeFileName))
+subsetJSON= limitState.getInternalForcesSubset(elementsOfInterest)
+ok= ok and (storeReads[0]==1) and (len(subsetJSON)==3)
+errJSON= compare(subsetJSON)
+ok= ok and (errJSON<1e-6)
+
+'''
+print(subset['ULS02']['5'])
+print('err= ', err)
+print('errJSON= ', errJSON)
+'''
+
+lsd.rs.read_results_subset= readResultsSubset
+limitState.writeResultsStore= False
+cfg.cleandirs() # Clean after yourself.
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,86 @@
+# -*- coding: utf-8 -*-
+''' Time needed to commit, revert and update the state of the mesh and to
+    retrieve its nodes by tag as a function of the size of the model
+    (benchmark). With the dense storage of the nodes and elements the time
+    per object of the iteration and the retrieval time must be
+    (approximately) independent of the number of objects. Run this script
+    with previous versions of the library to compare the per-step overhead.
+'''
+
+from __future__ import print_function
+
+import time
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+def buildModel(numDiv):
+    ''' Create a square mesh of quad elements with numDiv divisions
+        per side. Node and element tags are not created in increasing
+        order.'''
+    feProblem= xc.FEProblem()
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+    elast2d= typical_materials.defElasticIsotropicPlaneStress(preprocessor, "elast2d", 30e6, 0.3, 0.0)
+    nodeTags= dict()
+    for i in reversed(range(0, numDiv+1)):
+        for j in range(0, numDiv+1):
+            tag= i*(numDiv+1)+j+1
+            nodes.newNodeIDXY(tag, float(i), float(j))
+            nodeTags[(i,j)]= tag
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast2d.name
+    for i in range(0, numDiv):
+        for j in reversed(range(0, numDiv)):
+            elements.defaultTag= i*numDiv+j+1
+            elements.newElement("FourNodeQuad", xc.ID([nodeTags[(i,j)], nodeTags[(i+1,j)], nodeTags[(i+1,j+1)], nodeTags[(i,j+1)]]))
+    return feProblem
+
+def measure(feProblem, numSteps= 10):
+    ''' Return the time per object spent in commit, revertToLastCommit
+        (which calls update) and getNode.'''
+    domain= feProblem.getDomain
+    mesh= domain.getMesh
+    numNodes= mesh.getNumNodes()
+    numObjects= numNodes+mesh.getNumElements()
+    startTime= time.time()
+    for i in range(0, numSteps):
+        domain.commit()
+        domain.revertToLastCommit()
+    stepTime= (time.time()-startTime)/numSteps/numObjects
+    startTime= time.time()
+    found= 0
+    for tag in range(1, numNodes+1):
+        if(mesh.getNode(tag).tag==tag):
+            found+= 1
+    lookupTime= (time.time()-startTime)/numNodes
+    return stepTime, lookupTime, found==numNodes
+
+results= list()
+ok= True
+for numDiv in [10, 20, 40, 80]:
+    feProblem= buildModel(numDiv)
+    stepTime, lookupTime, found= measure(feProblem)
+    mesh= feProblem.getDomain.getMesh
+    ok= ok and found and (mesh.getNumElements()==numDiv**2)
+    results.append((numDiv, mesh.getNumNodes(), stepTime, lookupTime))
+
+'''
+for (numDiv, numNodes, stepTime, lookupTime) in results:
+    print('nodes: ', numNodes, ' commit+revert time per object: ', stepTime*1e6, 'us; getNode time: ', lookupTime*1e6, 'us')
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+''' Check the storage of the nodes, elements and constraints of the mesh:
+    the iteration order must be the order of the tags, no matter the order
+    in which the objects were created or removed, and the objects must be
+    retrieved by its tag.'''
+
+from __future__ import print_function
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+mesh= preprocessor.getDomain.getMesh
+
+def getNodeTags():
+    ''' Return the tags of the nodes in iteration order.'''
+    retval= list()
+    nIter= mesh.getNodeIter
+    nod= nIter.next()
+    while not(nod is None):
+        retval.append(nod.tag)
+        nod= nIter.next()
+    return retval
+
+def getElementTags():
+    ''' Return the tags of the elements in iteration order.'''
+    retval= list()
+    eIter= mesh.getElementIter
+    elem= eIter.next()
+    while not(elem is None):
+        retval.append(elem.tag)
+        elem= eIter.next()
+    return retval
+
+# Nodes created in decreasing tag order.
+numNodes= 50
+for i in reversed(range(0, numNodes)):
+    nodes.defaultTag= 10*i+5
+    modelSpace.newNode(float(i), 0.0)
+nodeTags= [10*i+5 for i in range(0, numNodes)]
+ok= (getNodeTags()==nodeTags)
+ok= ok and (mesh.getNumNodes()==numNodes)
+# Retrieve the nodes by its tag.
+for i in range(0, numNodes):
+    n= mesh.getNode(10*i+5)
+    ok= ok and (n.tag==10*i+5) and (abs(n.getInitialPos3d.x-i)<1e-12)
+
+# Append new nodes with smaller and larger tags.
+nodes.defaultTag= 1
+modelSpace.newNode(-1.0, 0.0)
+nodes.defaultTag= 1000
+modelSpace.newNode(100.0, 0.0)
+nodeTags= [1]+nodeTags+[1000]
+ok= ok and (getNodeTags()==nodeTags)
+
+# Elements.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", 1e3)
+elements= preprocessor.getElementHandler
+elements.dimElem= 2
+elements.defaultMaterial= elast.name
+elementTags= list()
+for i in reversed(range(0, numNodes-1)):
+    elements.defaultTag= 3*i+1
+    elements.newElement("Truss", xc.ID([10*i+5, 10*(i+1)+5]))
+    elementTags.append(3*i+1)
+elementTags.sort()
+ok= ok and (getElementTags()==elementTags)
+
+# Remove some elements and nodes.
+removedElements= [elementTags[0], elementTags[10], elementTags[-1]]
+for tag in removedElements:
+    modelSpace.removeElement(tag)
+elementTags= [t for t in elementTags if t not in removedElements]
+ok= ok and (getElementTags()==elementTags) and (mesh.getNumElements()==len(elementTags))
+removedNodes= [1, 1000]
+for tag in removedNodes:
+    modelSpace.removeNode(tag)
+nodeTags= [t for t in nodeTags if t not in removedNodes]
+ok= ok and (getNodeTags()==nodeTags) and (mesh.getNumNodes()==len(nodeTags))
+ok= ok and (mesh.getElement(removedElements[1]) is None)
+ok= ok and (mesh.getNode(1) is None)
+ok= ok and (mesh.getNode(nodeTags[-1]).tag==nodeTags[-1])
+
+# Constraints.
+for i in reversed(range(0, 5)):
+    modelSpace.fixNode00(10*i+5)
+spTags= list()
+spIter= preprocessor.getDomain.getConstraints.getSPs
+sp= spIter.next()
+while not(sp is None):
+    spTags.append(sp.tag)
+    sp= spIter.next()
+ok= ok and (len(spTags)==10) and (spTags==sorted(spTags))
+
+'''
+print(getNodeTags())
+print(getElementTags())
+print(spTags)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,103 @@
+# -*- coding: utf-8 -*-
+''' Check the union, difference and intersection of sets with a large
+    number of nodes: the results must contain each object only once and
+    preserve the order of the first operand.'''
+
+from __future__ import print_function
+
+import geom
+import xc
+from model import predefined_spaces
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Grid of nodes.
+nDiv= 60
+grid= list()
+for i in range(0, nDiv):
+    row= list()
+    for j in range(0, nDiv):
+        row.append(modelSpace.newNode(float(i), float(j)))
+    grid.append(row)
+
+# Set A: nodes with i<40 (row by row).
+setA= preprocessor.getSets.defSet("A")
+for i in range(0, 40):
+    for j in range(0, nDiv):
+        setA.nodes.append(grid[i][j])
+# Set B: nodes with j<30 (in reverse order).
+setB= preprocessor.getSets.defSet("B")
+for i in reversed(range(0, nDiv)):
+    for j in reversed(range(0, 30)):
+        setB.nodes.append(grid[i][j])
+
+# Appending an object twice doesn't change the set.
+ok= not setA.nodes.append(grid[0][0])
+ok= ok and (setA.nodes.size==40*nDiv)
+ok= ok and (grid[0][0] in setA.nodes) and not (grid[50][0] in setA.nodes)
+
+tagsA= [n.tag for n in setA.nodes]
+tagsB= [n.tag for n in setB.nodes]
+tagSetB= set(tagsB)
+tagSetA= set(tagsA)
+
+# Union.
+union= preprocessor.getSets.defSet("AUB")
+union+= setA
+union+= setB
+refUnion= tagsA+[t for t in tagsB if t not in tagSetA]
+ok= ok and ([n.tag for n in union.nodes]==refUnion)
+
+# Difference.
+difference= preprocessor.getSets.defSet("A-B")
+difference+= setA
+difference-= setB
+refDifference= [t for t in tagsA if t not in tagSetB]
+ok= ok and ([n.tag for n in difference.nodes]==refDifference)
+ok= ok and not (grid[0][0] in difference.nodes) and (grid[0][30] in difference.nodes)
+
+# Intersection.
+intersection= preprocessor.getSets.defSet("A*B")
+intersection+= setA
+intersection*= setB
+refIntersection= [t for t in tagsA if t in tagSetB]
+ok= ok and ([n.tag for n in intersection.nodes]==refIntersection)
+ok= ok and (len(refIntersection)==40*30)
+
+# Intersection of geometric entities.
+points= preprocessor.getMultiBlockTopology.getPoints
+pt1= points.newPoint(geom.Pos3d(0.0,0.0,0.0))
+pt2= points.newPoint(geom.Pos3d(1.0,0.0,0.0))
+pt3= points.newPoint(geom.Pos3d(2.0,0.0,0.0))
+s1= preprocessor.getSets.defSet("S1")
+s1.getPoints.append(pt1)
+s1.getPoints.append(pt2)
+s2= preprocessor.getSets.defSet("S2")
+s2.getPoints.append(pt2)
+s2.getPoints.append(pt3)
+s1*= s2
+ok= ok and (s1.getPoints.size==1) and (s1.getPoints[0].tag==pt2.tag)
+
+'''
+print(len(refUnion), union.nodes.size)
+print(len(refDifference), difference.nodes.size)
+print(len(refIntersection), intersection.nodes.size)
+print(s1.getPoints.size)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,113 @@
+# -*- coding: utf-8 -*-
+''' Check that the results obtained with the different DOF numbering
+    algorithms (RCM, AMD and simple) and systems of equations, all of them
+    based on the compressed (CSR) adjacency of the model graph, are the
+    same. The test uses a generated mesh of Brick elements and measures the
+    time needed to number and solve it (benchmark). To reproduce the
+    1M DOF benchmark set NumDiv= 69.
+'''
+
+from __future__ import print_function
+
+import time
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDiv= 8
+L= 1.0 # Side of the cube.
+E= 30e9 # Elastic modulus.
+nu= 0.3 # Poisson's ratio
+F= 100e3 # Load on each of the top nodes.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Material definition
+elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+
+# Geometry.
+pt1= modelSpace.newKPoint(0,0,0)
+pt2= modelSpace.newKPoint(L,0,0)
+pt3= modelSpace.newKPoint(L,L,0)
+pt4= modelSpace.newKPoint(0,L,0)
+pt5= modelSpace.newKPoint(0,0,L)
+pt6= modelSpace.newKPoint(L,0,L)
+pt7= modelSpace.newKPoint(L,L,L)
+pt8= modelSpace.newKPoint(0,L,L)
+bodies= preprocessor.getMultiBlockTopology.getBodies
+b1= bodies.newBlockPts(pt1.tag, pt2.tag, pt3.tag, pt4.tag, pt5.tag, pt6.tag, pt7.tag, pt8.tag)
+b1.nDivI= NumDiv
+b1.nDivJ= NumDiv
+b1.nDivK= NumDiv
+
+# Mesh generation.
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= elast3d.name
+brick= seedElemHandler.newElement("Brick")
+b1.genMesh(xc.meshDir.I)
+
+# Constraints and loads.
+lp0= modelSpace.newLoadPattern(name= '0')
+topNodes= list()
+for n in b1.nodes:
+    z= n.getInitialPos3d.z
+    if(abs(z)<1e-6):
+        modelSpace.fixNode000(n.tag)
+    elif(abs(z-L)<1e-6):
+        topNodes.append(n)
+        lp0.newNodalLoad(n.tag, xc.Vector([F, 0.0, -F]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solve using different numberers and systems of equations.
+cases= [('rcm', predefined_solutions.SimpleStaticLinearUMF),
+        ('amd', predefined_solutions.SimpleStaticLinearUMF),
+        ('simple', predefined_solutions.SimpleStaticLinearUMF),
+        ('rcm', predefined_solutions.SimpleStaticLinear)] # banded.
+results= list()
+lapses= list()
+ok= True
+for (numberingMethod, solutionProcedureType) in cases:
+    feProblem.getDomain.revertToStart()
+    solProc= solutionProcedureType(feProblem, name= numberingMethod+'_'+str(len(results)), numberingMethod= numberingMethod)
+    startTime= time.time()
+    result= solProc.solve()
+    lapses.append(time.time()-startTime)
+    ok= ok and (result==0)
+    disp= list()
+    for n in topNodes:
+        disp.extend(n.getDisp)
+    results.append(disp)
+
+# Compare results.
+reference= results[0]
+refNorm= max([abs(x) for x in reference])
+err= 0.0
+for disp in results[1:]:
+    err= max(err, max([abs(a-b) for a, b in zip(disp, reference)])/refNorm)
+ok= ok and (err<1e-8) and (refNorm>0.0)
+
+'''
+print('number of DOFs: ', 3*b1.getNumNodes)
+print('err= ', err)
+for (numberingMethod, solutionProcedureType), lapse in zip(cases, lapses):
+    print(numberingMethod, solutionProcedureType.__name__, ' time: ', lapse, 's')
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,125 @@
+# -*- coding: utf-8 -*-
+''' Check the sparse LDLT solver (Eigen library) for symmetric positive
+    definite systems comparing its results with those obtained with the
+    UMFPACK solver. Check also that the symbolic analysis is reused when
+    the sparsity pattern of the stiffness matrix doesn't change (new
+    load case).
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDiv= 4
+L= 1.0 # Side of the cube.
+E= 30e9 # Elastic modulus.
+nu= 0.3 # Poisson's ratio
+F= 100e3 # Load on each of the top nodes.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Material definition
+elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+
+# Geometry.
+pt1= modelSpace.newKPoint(0,0,0)
+pt2= modelSpace.newKPoint(L,0,0)
+pt3= modelSpace.newKPoint(L,L,0)
+pt4= modelSpace.newKPoint(0,L,0)
+pt5= modelSpace.newKPoint(0,0,L)
+pt6= modelSpace.newKPoint(L,0,L)
+pt7= modelSpace.newKPoint(L,L,L)
+pt8= modelSpace.newKPoint(0,L,L)
+bodies= preprocessor.getMultiBlockTopology.getBodies
+b1= bodies.newBlockPts(pt1.tag, pt2.tag, pt3.tag, pt4.tag, pt5.tag, pt6.tag, pt7.tag, pt8.tag)
+b1.nDivI= NumDiv
+b1.nDivJ= NumDiv
+b1.nDivK= NumDiv
+
+# Mesh generation.
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= elast3d.name
+brick= seedElemHandler.newElement("Brick")
+b1.genMesh(xc.meshDir.I)
+
+# Constraints and loads.
+lp0= modelSpace.newLoadPattern(name= '0')
+lp1= modelSpace.newLoadPattern(name= '1')
+topNodes= list()
+for n in b1.nodes:
+    z= n.getInitialPos3d.z
+    if(abs(z)<1e-6):
+        modelSpace.fixNode000(n.tag)
+    elif(abs(z-L)<1e-6):
+        topNodes.append(n)
+        lp0.newNodalLoad(n.tag, xc.Vector([F, 0.0, -F]))
+        lp1.newNodalLoad(n.tag, xc.Vector([0.0, -2*F, -F]))
+
+def get_displacements():
+    retval= list()
+    for n in topNodes:
+        retval.extend(n.getDisp)
+    return retval
+
+# Reference solution (UMFPACK).
+refSolProc= predefined_solutions.SimpleStaticLinearUMF(feProblem, name= 'umf')
+references= list()
+for lp in [lp0, lp1]:
+    modelSpace.removeAllLoadPatternsFromDomain()
+    modelSpace.revertToStart()
+    modelSpace.addLoadCaseToDomain(lp.name)
+    ok= (refSolProc.solve()==0)
+    references.append(get_displacements())
+
+# Solution with the Eigen sparse LDLT solver.
+solProc= predefined_solutions.SimpleStaticLinearEigenSPD(feProblem, name= 'eigen_spd')
+results= list()
+for lp in [lp0, lp1]:
+    modelSpace.removeAllLoadPatternsFromDomain()
+    modelSpace.revertToStart()
+    modelSpace.addLoadCaseToDomain(lp.name)
+    ok= ok and (solProc.solve()==0)
+    results.append(get_displacements())
+
+# The sparsity pattern is the same for both load cases so the symbolic
+# analysis must be computed only once.
+numSymbolicAnalysis= solProc.solver.numSymbolicAnalysis
+numFactorizations= solProc.solver.numFactorizations
+
+# Compare results.
+err= 0.0
+for disp, reference in zip(results, references):
+    refNorm= max([abs(x) for x in reference])
+    ok= ok and (refNorm>0.0)
+    err= max(err, max([abs(a-b) for a, b in zip(disp, reference)])/refNorm)
+
+ok= ok and (err<1e-8) and (numSymbolicAnalysis==1) and (numFactorizations>=1)
+
+'''
+print('number of DOFs: ', 3*b1.getNumNodes)
+print('number of non-zeros: ', solProc.soe.numNonZeros)
+print('err= ', err)
+print('number of symbolic analysis: ', numSymbolicAnalysis)
+print('number of numeric factorizations: ', numFactorizations)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,126 @@
+# -*- coding: utf-8 -*-
+''' Check the full general substructuring solver comparing its results
+    with those obtained with the serial LAPACK solver. The partitions of
+    the system are condensed by actor threads that communicate with the
+    calling thread through thread channels. The results must not depend
+    on the number of partitions.
+'''
+
+from __future__ import print_function
+
+import time
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDiv= 4
+L= 1.0 # Side of the cube.
+E= 30e9 # Elastic modulus.
+nu= 0.3 # Poisson's ratio
+F= 100e3 # Load on each of the top nodes.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Material definition
+elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+
+# Geometry.
+pt1= modelSpace.newKPoint(0,0,0)
+pt2= modelSpace.newKPoint(L,0,0)
+pt3= modelSpace.newKPoint(L,L,0)
+pt4= modelSpace.newKPoint(0,L,0)
+pt5= modelSpace.newKPoint(0,0,L)
+pt6= modelSpace.newKPoint(L,0,L)
+pt7= modelSpace.newKPoint(L,L,L)
+pt8= modelSpace.newKPoint(0,L,L)
+bodies= preprocessor.getMultiBlockTopology.getBodies
+b1= bodies.newBlockPts(pt1.tag, pt2.tag, pt3.tag, pt4.tag, pt5.tag, pt6.tag, pt7.tag, pt8.tag)
+b1.nDivI= NumDiv
+b1.nDivJ= NumDiv
+b1.nDivK= NumDiv
+
+# Mesh generation.
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= elast3d.name
+brick= seedElemHandler.newElement("Brick")
+b1.genMesh(xc.meshDir.I)
+
+# Constraints and loads.
+lp0= modelSpace.newLoadPattern(name= '0')
+topNodes= list()
+for n in b1.nodes:
+    z= n.getInitialPos3d.z
+    if(abs(z)<1e-6):
+        modelSpace.fixNode000(n.tag)
+    elif(abs(z-L)<1e-6):
+        topNodes.append(n)
+        lp0.newNodalLoad(n.tag, xc.Vector([F, -F/2.0, -F]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+def solve(solverType, numPartitions= None):
+    ''' Solve the problem and return the displacements of the top nodes
+        and the time spent.
+
+    :param solverType: type of the solver.
+    :param numPartitions: number of partitions (substructuring solver only).
+    '''
+    modelSpace.revertToStart()
+    name= solverType+'_'+str(numPartitions)
+    solProc= predefined_solutions.SimpleStaticLinear(feProblem, name= name, soeType= 'full_gen_lin_soe', solverType= solverType)
+    solProc.setup()
+    if(numPartitions):
+        solProc.solver.numPartitions= numPartitions
+    start= time.time()
+    result= solProc.solve()
+    elapsed= time.time()-start
+    retval= list()
+    for n in topNodes:
+        retval.extend(n.getDisp)
+    return result, retval, elapsed
+
+# Reference solution (serial solver).
+okRef, reference, refTime= solve('full_gen_lin_lapack_solver')
+ok= (okRef==0)
+
+def relativeError(disp, reference):
+    ''' Return the maximum difference relative to the norm of the reference.'''
+    refNorm= max([abs(x) for x in reference])
+    return max([abs(a-b) for a, b in zip(disp, reference)])/refNorm
+
+# Substructuring solver.
+err= 0.0
+times= dict()
+for numPartitions in range(1, 9):
+    result, disp, elapsed= solve('full_gen_lin_substr_thread_solver', numPartitions)
+    ok= ok and (result==0)
+    err= max(err, relativeError(disp, reference))
+    times[numPartitions]= elapsed
+
+ok= ok and (err<1e-10)
+
+'''
+print('number of DOFs: ', 3*b1.getNumNodes)
+print('LAPACK solver time: ', refTime)
+for numPartitions in times:
+    print(numPartitions, ' partitions time: ', times[numPartitions])
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+''' Check that the results obtained when the element tangents and residuals
+    are computed using several threads (concurrent assembly) are the same
+    that those obtained with the serial assembly. The test uses a generated
+    mesh of ShellMITC4 elements and measures the time needed to solve it
+    with 1, 2, 4 and 8 threads (benchmark).
+'''
+
+from __future__ import print_function
+
+import time
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDivI= 60
+NumDivJ= 60
+CooMaxX= 10
+CooMaxY= 10
+E= 30e9 # Elastic modulus.
+nu= 0.3 # Poisson's ratio
+thickness= 0.25 # Slab thickness.
+unifLoad= 10e3 # Uniform load.
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Define materials
+memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,0.0,thickness)
+
+# Define template element.
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= memb1.name
+elem= seedElemHandler.newElement("ShellMITC4")
+
+# Generate the mesh.
+points= preprocessor.getMultiBlockTopology.getPoints
+pt1= points.newPoint(geom.Pos3d(0.0,0.0,0.0))
+pt2= points.newPoint(geom.Pos3d(CooMaxX,0.0,0.0))
+pt3= points.newPoint(geom.Pos3d(CooMaxX,CooMaxY,0.0))
+pt4= points.newPoint(geom.Pos3d(0.0,CooMaxY,0.0))
+surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+s= surfaces.newQuadSurfacePts(pt1.tag,pt2.tag,pt3.tag,pt4.tag)
+s.nDivI= NumDivI
+s.nDivJ= NumDivJ
+s.genMesh(xc.meshDir.I)
+
+# Constraints
+for l in s.getSides:
+    for i in l.getEdge.getNodeTags():
+        modelSpace.fixNode000_000(i)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+modelSpace.setCurrentLoadPattern(lp0.name)
+for e in s.elements:
+    e.vector3dUniformLoadGlobal(xc.Vector([0.0,0.0,-unifLoad]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solve using 1, 2, 4 and 8 threads.
+centralNode= s.getNodeIJK(1, int(NumDivI/2+1), int(NumDivJ/2+1))
+results= dict()
+lapses= dict()
+for numThreads in [1, 2, 4, 8]:
+    feProblem.getDomain.revertToStart()
+    solProc= predefined_solutions.PlainNewtonRaphson(feProblem, name= 'threads_'+str(numThreads), maxNumIter= 10, convergenceTestTol= 1e-6)
+    solProc.setup()
+    solProc.integrator.numThreads= numThreads
+    startTime= time.time()
+    result= solProc.solve()
+    lapses[numThreads]= time.time()-startTime
+    disp= list()
+    for n in s.nodes:
+        disp.extend(n.getDisp)
+    results[numThreads]= disp
+
+# Results must be the same (bitwise) whatever the number of threads.
+ok= (result==0)
+reference= results[1]
+for numThreads in results:
+    ok= ok and (results[numThreads]==reference)
+UZ= centralNode.getDisp[2]
+ok= ok and (UZ<0.0)
+
+'''
+print('number of elements: ', s.getNumElements)
+print('UZ= ', UZ)
+for numThreads in lapses:
+    print('threads: ', numThreads, ' time: ', lapses[numThreads], 's speedup: ', lapses[1]/lapses[numThreads])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
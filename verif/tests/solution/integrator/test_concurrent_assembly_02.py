@@ -0,0 +1,102 @@
+# -*- coding: utf-8 -*-
+''' Check that the results obtained when the element tangents and residuals
+    are computed using several threads (concurrent assembly) are the same
+    that those obtained with the serial assembly. The test uses a set of
+    cantilevers made of ElasticBeam3d, DispBeamColumn3d and ForceBeamColumn3d
+    elements with elastic sections and P-Delta coordinate transformation.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumColumns= 30 # Number of cantilevers of each element type.
+NumDiv= 10 # Number of elements in each cantilever.
+L= 3.0 # Cantilever length.
+E= 210e9 # Elastic modulus.
+G= E/(2*1.3) # Shear modulus.
+A= 53.8e-4 # Cross-section area.
+Iz= 3892e-8 # Moment of inertia.
+Iy= 1318e-8 # Moment of inertia.
+J= 0.2e-6 # Torsional constant.
+F= 10e3 # Horizontal load.
+P= -200e3 # Vertical load.
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Materials and coordinate transformation.
+section= typical_materials.defElasticSection3d(preprocessor, "section", A, E, G, Iz, Iy, J)
+pDelta= modelSpace.newPDeltaCrdTransf("pDelta",xc.Vector([1,0,0]))
+
+# Mesh.
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= pDelta.name
+elements.defaultMaterial= section.name
+topNodes= list()
+elementTypes= ['ElasticBeam3d', 'DispBeamColumn3d', 'ForceBeamColumn3d']
+for i, elementType in enumerate(elementTypes):
+    for j in range(0, NumColumns):
+        x= float(i); y= float(j)
+        nodeI= nodes.newNodeXYZ(x, y, 0.0)
+        modelSpace.fixNode000_000(nodeI.tag)
+        for k in range(1, NumDiv+1):
+            nodeJ= nodes.newNodeXYZ(x, y, k*L/NumDiv)
+            elem= elements.newElement(elementType, xc.ID([nodeI.tag, nodeJ.tag]))
+            nodeI= nodeJ
+        topNodes.append(nodeJ)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+for n in topNodes:
+    lp0.newNodalLoad(n.tag,xc.Vector([F, F, P, 0, 0, 0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solve using 1 and 4 threads.
+results= dict()
+for numThreads in [1, 4]:
+    feProblem.getDomain.revertToStart()
+    solProc= predefined_solutions.PlainNewtonRaphson(feProblem, name= 'threads_'+str(numThreads), maxNumIter= 20, convergenceTestTol= 1e-8)
+    solProc.setup()
+    solProc.integrator.numThreads= numThreads
+    result= solProc.solve()
+    disp= list()
+    for n in topNodes:
+        disp.extend(n.getDisp)
+    results[numThreads]= (result, disp)
+
+# Results must be the same (bitwise) whatever the number of threads.
+ok= True
+reference= results[1][1]
+for numThreads in results:
+    ok= ok and (results[numThreads][0]==0)
+    ok= ok and (results[numThreads][1]==reference)
+# P-Delta effect makes the displacement greater than the first order one.
+UX= topNodes[0].getDisp[0]
+UX1st= F*L**3/(3*E*Iy)
+ok= ok and (UX>UX1st)
+
+'''
+print('UX= ', UX, ' first order: ', UX1st)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
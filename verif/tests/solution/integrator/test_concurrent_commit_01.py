@@ -0,0 +1,116 @@
+# -*- coding: utf-8 -*-
+''' Check the commit, update and revert of the state of the nodes and
+    elements using several threads. A set of elastic-perfectly plastic
+    bars is loaded beyond yield (committed state), then a trial
+    displacement that reverses the plastic strain is imposed (update) and
+    the mesh is returned to its last committed state (revert). The state
+    of every element after the revert must be the committed one, and the
+    results must be the same whatever the number of threads.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+numBars= 200 # number of bar pairs.
+E= 200e9 # Young modulus (Pa).
+fy= 250e6 # Yield stress (Pa).
+A= 1e-4 # Bar area (m2).
+l= 1.0 # Bar length (m).
+F= 60e3 # Load on the first pair of bars (N).
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Materials.
+elast= typical_materials.defElasticMaterial(preprocessor, "elast", E)
+epp= typical_materials.defElasticPPMaterial(preprocessor, "epp", E, fy, -fy)
+
+# Mesh: each loaded node is supported by an elastic bar and an
+# elastic-perfectly plastic bar.
+elements= preprocessor.getElementHandler
+elements.dimElem= 2
+loadedNodes= list()
+plasticBars= list()
+for k in range(0, numBars):
+    nA= nodes.newNodeXY(0.0, k)
+    nB= nodes.newNodeXY(l, k)
+    modelSpace.fixNode("00", nA.tag)
+    modelSpace.fixNode("F0", nB.tag)
+    elements.defaultMaterial= elast.name
+    bar= elements.newElement("Truss", xc.ID([nA.tag, nB.tag]))
+    bar.sectionArea= A
+    elements.defaultMaterial= epp.name
+    bar= elements.newElement("Truss", xc.ID([nA.tag, nB.tag]))
+    bar.sectionArea= A
+    loadedNodes.append(nB)
+    plasticBars.append(bar)
+
+# Loads (all the plastic bars yield).
+lp0= modelSpace.newLoadPattern(name= '0')
+for k, n in enumerate(loadedNodes):
+    lp0.newNodalLoad(n.tag, xc.Vector([F*(1.0+k/numBars), 0.0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+def getState():
+    ''' Return the displacements of the loaded nodes and the axial
+        forces in the plastic bars.'''
+    return [n.getDisp[0] for n in loadedNodes]+[b.getN() for b in plasticBars]
+
+domain= feProblem.getDomain
+mesh= domain.getMesh
+results= dict()
+ok= True
+for numThreads in [1, 2, 4, 8]:
+    domain.numThreads= numThreads
+    ok= ok and (mesh.numThreads==numThreads)
+    ok= ok and (domain.revertToStart()==0)
+    solProc= predefined_solutions.PlainNewtonRaphson(feProblem, name= 'threads_'+str(numThreads), maxNumIter= 10, convergenceTestTol= 1e-6, numSteps= 4)
+    ok= ok and (solProc.solve()==0) # commits the state.
+    committedState= getState()
+    # All the plastic bars have yielded.
+    ok= ok and all(abs(N-fy*A)<1e-6*fy*A for N in committedState[numBars:])
+    # Reverse the displacements (trial state).
+    for n in loadedNodes:
+        n.setTrialDisp(xc.Vector([-n.getDisp[0], 0.0]))
+    ok= ok and (mesh.update()==0)
+    trialState= [b.getN() for b in plasticBars]
+    ok= ok and all(abs(N+fy*A)<1e-6*fy*A for N in trialState)
+    # Return to the committed state.
+    ok= ok and (mesh.revertToLastCommit()==0)
+    ok= ok and (getState()==committedState)
+    # Commit again (nothing must change).
+    ok= ok and (domain.commit()==0)
+    ok= ok and (getState()==committedState)
+    results[numThreads]= committedState
+
+# Results must be the same (bitwise) whatever the number of threads.
+reference= results[1]
+for numThreads in results:
+    ok= ok and (results[numThreads]==reference)
+
+'''
+print('ok= ', ok)
+print(reference[:3], reference[numBars:numBars+3])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,117 @@
+# -*- coding: utf-8 -*-
+''' Check that the results of a dynamic analysis don't change when the
+    nodal displacements, velocities and accelerations are stored in
+    contiguous arrays (nodal state arena) and that a snapshot of the
+    nodal state can be used to restore it.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+K= 1000.0 # Spring constant
+m= 2.0 # Nodal mass
+F= 10.0 # Force magnitude
+numSprings= 50 # Number of springs of the chain.
+dT= 0.01 # Time step.
+
+def buildModel(nodalStateArena):
+    ''' Build a chain of springs with lumped masses loaded at its
+        free end.
+
+    :param nodalStateArena: if true, store the nodal state in
+                            contiguous arrays.
+    '''
+    feProblem= xc.FEProblem()
+    feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+    preprocessor=  feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    nodeHandler.dimSpace= 1 # One coordinate for each node.
+    nodeHandler.numDOFs= 1 # One degree of freedom for each node.
+    nodes= list()
+    for i in range(0, numSprings+1):
+        n= nodeHandler.newNodeX(float(i))
+        n.mass= xc.Matrix([[m]])
+        nodes.append(n)
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast", K)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast.name
+    elements.dimElem= 1
+    for i in range(0, numSprings):
+        elements.newElement("ZeroLength",xc.ID([nodes[i].tag,nodes[i+1].tag]))
+    constraints= preprocessor.getBoundaryCondHandler
+    constraints.newSPConstraint(nodes[0].tag,0,0.0)
+    lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+    ts= lPatterns.newTimeSeries("constant_ts","ts")
+    lPatterns.currentTimeSeries= ts.name
+    lp0= lPatterns.newLoadPattern("default","0")
+    lp0.newNodalLoad(nodes[-1].tag,xc.Vector([F]))
+    lPatterns.addToDomain(lp0.name)
+    mesh= feProblem.getDomain.getMesh
+    mesh.nodalStateArena= nodalStateArena
+    solProc= predefined_solutions.PlainLinearNewmark(feProblem, timeStep= dT)
+    solProc.setup()
+    return feProblem, nodes, solProc
+
+def getNodalState(nodes):
+    ''' Return the displacements, velocities and accelerations of the
+        nodes.'''
+    retval= list()
+    for n in nodes:
+        retval.extend([n.getDisp[0], n.getVel[0], n.getAccel[0]])
+    return retval
+
+numSteps= 100
+# Without arena.
+feProblemA, nodesA, solProcA= buildModel(nodalStateArena= False)
+okA= (solProcA.analysis.analyze(numSteps)==0)
+stateA= getNodalState(nodesA)
+# With arena.
+feProblemB, nodesB, solProcB= buildModel(nodalStateArena= True)
+meshB= feProblemB.getDomain.getMesh
+okB= meshB.nodalStateArena
+okB= okB and (solProcB.analysis.analyze(numSteps)==0)
+stateB= getNodalState(nodesB)
+
+# Results must be the same (bitwise).
+ok= okA and okB and (stateA==stateB) and (abs(stateB[-3])>0.0)
+
+# Take a snapshot, go on and restore it.
+snapshot= meshB.getNodalStateSnapshot()
+# 4 vectors for displacement, 2 for velocity and 2 for acceleration.
+ok= ok and (len(snapshot)==8*(numSprings+1))
+ok= ok and (solProcB.analysis.analyze(10)==0)
+ok= ok and (getNodalState(nodesB)!=stateB)
+ok= ok and (meshB.setNodalStateSnapshot(snapshot)==0)
+ok= ok and (getNodalState(nodesB)==stateB)
+
+# Nodes added after packing the arena.
+preprocessorB= feProblemB.getPreprocessor
+newNode= preprocessorB.getNodeHandler.newNodeX(-1.0)
+ok= ok and (newNode.getDisp[0]==0.0)
+ok= ok and (meshB.setNodalStateSnapshot(snapshot)!=0) # mesh has changed.
+ok= ok and (meshB.commit()==0) # gathers the new node.
+ok= ok and (len(meshB.getNodalStateSnapshot())==8*(numSprings+2))
+ok= ok and (getNodalState(nodesB)==stateB)
+ok= ok and (newNode.getDisp[0]==0.0)
+
+'''
+print('tip displacement: ', stateA[-3], stateB[-3])
+print('snapshot size: ', len(snapshot))
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+''' Check that the results of a dynamic analysis don't change when the
+    nodal response is set directly in the nodal state arena, in a model
+    where some of the nodes are updated through transformation DOF
+    groups (multi-freedom constraints) and some nodes are added after
+    packing the arena.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+K= 1000.0 # Spring constant
+m= 2.0 # Nodal mass
+F= 10.0 # Force magnitude
+numSprings= 20 # Number of springs of each chain.
+dT= 0.01 # Time step.
+
+def buildModel(nodalStateArena):
+    ''' Build two parallel chains of springs with lumped masses, tied
+        at their free ends by an equal DOF constraint and loaded at
+        the free end of the first one.
+
+    :param nodalStateArena: if true, store the nodal state in
+                            contiguous arrays.
+    '''
+    feProblem= xc.FEProblem()
+    feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+    preprocessor=  feProblem.getPreprocessor
+    nodeHandler= preprocessor.getNodeHandler
+    nodeHandler.dimSpace= 1 # One coordinate for each node.
+    nodeHandler.numDOFs= 1 # One degree of freedom for each node.
+    elast= typical_materials.defElasticMaterial(preprocessor, "elast", K)
+    elements= preprocessor.getElementHandler
+    elements.defaultMaterial= elast.name
+    elements.dimElem= 1
+    constraints= preprocessor.getBoundaryCondHandler
+    chains= list()
+    for j in range(0, 2):
+        nodes= list()
+        for i in range(0, numSprings+1):
+            n= nodeHandler.newNodeX(float(i))
+            n.mass= xc.Matrix([[m]])
+            nodes.append(n)
+        for i in range(0, numSprings):
+            elements.newElement("ZeroLength",xc.ID([nodes[i].tag,nodes[i+1].tag]))
+        constraints.newSPConstraint(nodes[0].tag,0,0.0)
+        chains.append(nodes)
+    constraints.newEqualDOF(chains[0][-1].tag, chains[1][-1].tag, xc.ID([0]))
+    lPatterns= preprocessor.getLoadHandler.getLoadPatterns
+    ts= lPatterns.newTimeSeries("constant_ts","ts")
+    lPatterns.currentTimeSeries= ts.name
+    lp0= lPatterns.newLoadPattern("default","0")
+    lp0.newNodalLoad(chains[0][-1].tag,xc.Vector([F]))
+    lPatterns.addToDomain(lp0.name)
+    mesh= feProblem.getDomain.getMesh
+    mesh.nodalStateArena= nodalStateArena
+    solProc= predefined_solutions.TransformationNewmarkNewtonRaphson(feProblem, timeStep= dT)
+    solProc.setup()
+    return feProblem, chains[0]+chains[1], solProc
+
+def getNodalState(nodes):
+    ''' Return the displacements, velocities and accelerations of the
+        nodes.'''
+    retval= list()
+    for n in nodes:
+        retval.extend([n.getDisp[0], n.getVel[0], n.getAccel[0]])
+    return retval
+
+def addSpring(feProblem, nodes):
+    ''' Add a spring with a mass at the free end of the first chain.'''
+    preprocessor=  feProblem.getPreprocessor
+    newNode= preprocessor.getNodeHandler.newNodeX(float(numSprings+1))
+    newNode.mass= xc.Matrix([[m]])
+    preprocessor.getElementHandler.newElement("ZeroLength",xc.ID([nodes[numSprings].tag,newNode.tag]))
+    nodes.append(newNode)
+
+numSteps= 50
+# Without arena.
+feProblemA, nodesA, solProcA= buildModel(nodalStateArena= False)
+okA= (solProcA.analysis.analyze(numSteps)==0)
+addSpring(feProblemA, nodesA)
+okA= okA and (solProcA.analysis.analyze(numSteps)==0)
+stateA= getNodalState(nodesA)
+# With arena.
+feProblemB, nodesB, solProcB= buildModel(nodalStateArena= True)
+meshB= feProblemB.getDomain.getMesh
+okB= meshB.nodalStateArena
+okB= okB and (solProcB.analysis.analyze(numSteps)==0)
+addSpring(feProblemB, nodesB) # the new node is not in the arena yet.
+okB= okB and (solProcB.analysis.analyze(numSteps)==0)
+stateB= getNodalState(nodesB)
+
+# Results must be the same (bitwise).
+ok= okA and okB and (stateA==stateB)
+# Both chains move together at their free ends.
+ok= ok and (stateB[3*numSprings]==stateB[3*(2*numSprings+1)]) and (abs(stateB[3*numSprings])>0.0)
+# The added node moves.
+ok= ok and (abs(stateB[-3])>0.0)
+
+'''
+print('tip displacements: ', stateA[3*numSprings], stateB[3*numSprings], stateB[3*(2*numSprings+1)])
+print('new node displacement: ', stateA[-3], stateB[-3])
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
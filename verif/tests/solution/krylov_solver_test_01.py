@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+''' Check the iterative (Krylov subspace) solvers (preconditioned
+    conjugate gradient and MINRES) with the different preconditioners
+    comparing their results with those obtained with the UMFPACK solver.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDiv= 4
+L= 1.0 # Side of the cube.
+E= 30e9 # Elastic modulus.
+nu= 0.3 # Poisson's ratio
+F= 100e3 # Load on each of the top nodes.
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+# Material definition
+elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+
+# Geometry.
+pt1= modelSpace.newKPoint(0,0,0)
+pt2= modelSpace.newKPoint(L,0,0)
+pt3= modelSpace.newKPoint(L,L,0)
+pt4= modelSpace.newKPoint(0,L,0)
+pt5= modelSpace.newKPoint(0,0,L)
+pt6= modelSpace.newKPoint(L,0,L)
+pt7= modelSpace.newKPoint(L,L,L)
+pt8= modelSpace.newKPoint(0,L,L)
+bodies= preprocessor.getMultiBlockTopology.getBodies
+b1= bodies.newBlockPts(pt1.tag, pt2.tag, pt3.tag, pt4.tag, pt5.tag, pt6.tag, pt7.tag, pt8.tag)
+b1.nDivI= NumDiv
+b1.nDivJ= NumDiv
+b1.nDivK= NumDiv
+
+# Mesh generation.
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= elast3d.name
+brick= seedElemHandler.newElement("Brick")
+b1.genMesh(xc.meshDir.I)
+
+# Constraints and loads.
+lp0= modelSpace.newLoadPattern(name= '0')
+topNodes= list()
+for n in b1.nodes:
+    z= n.getInitialPos3d.z
+    if(abs(z)<1e-6):
+        modelSpace.fixNode000(n.tag)
+    elif(abs(z-L)<1e-6):
+        topNodes.append(n)
+        lp0.newNodalLoad(n.tag, xc.Vector([F, -F/2.0, -F]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+def get_displacements():
+    retval= list()
+    for n in topNodes:
+        retval.extend(n.getDisp)
+    return retval
+
+# Reference solution (UMFPACK).
+refSolProc= predefined_solutions.SimpleStaticLinearUMF(feProblem, name= 'umf')
+ok= (refSolProc.solve()==0)
+reference= get_displacements()
+refNorm= max([abs(x) for x in reference])
+ok= ok and (refNorm>0.0)
+
+def relativeError(disp):
+    ''' Return the maximum difference relative to the norm of the reference.'''
+    return max([abs(a-b) for a, b in zip(disp, reference)])/refNorm
+
+# Linear analysis with the iterative solvers.
+err= 0.0
+iterations= dict()
+# (without preconditioning the MINRES residual recurrence loses accuracy
+# with the large penalty factors, so this case is checked only with PCG).
+cases= [('pcg_lin_solver', ['none', 'jacobi', 'incomplete_cholesky', 'smoothed_aggregation_amg']),
+        ('minres_lin_solver', ['jacobi', 'incomplete_cholesky', 'smoothed_aggregation_amg'])]
+for (solverType, preconditioners) in cases:
+    for preconditioner in preconditioners:
+        modelSpace.revertToStart()
+        name= solverType+'_'+preconditioner
+        solProc= predefined_solutions.SimpleStaticLinearPCG(feProblem, name= name, solverType= solverType, preconditioner= preconditioner)
+        ok= ok and (solProc.solve()==0)
+        err= max(err, relativeError(get_displacements()))
+        solver= solProc.solver
+        ok= ok and (solver.preconditionerType==preconditioner) and (solver.numFailures==0)
+        ok= ok and (solver.numSolves>=1) and (solver.numIterations>0)
+        iterations[name]= solver.totalNumIterations
+# The preconditioners must reduce the number of iterations.
+ok= ok and (iterations['pcg_lin_solver_incomplete_cholesky']<iterations['pcg_lin_solver_none'])
+ok= ok and (iterations['pcg_lin_solver_jacobi']<iterations['pcg_lin_solver_none'])
+
+# Newton-Raphson with warm start.
+modelSpace.revertToStart()
+nrSolProc= predefined_solutions.PenaltyNewtonRaphsonPCG(feProblem, name= 'newton_pcg')
+ok= ok and (nrSolProc.solve()==0)
+err= max(err, relativeError(get_displacements()))
+nrSolver= nrSolProc.solver
+ok= ok and nrSolver.warmStart and (nrSolver.numSolves>=1) and (nrSolver.numPreconditionerSetups>=1)
+
+ok= ok and (err<1e-6)
+
+'''
+print('number of DOFs: ', 3*b1.getNumNodes)
+print('err= ', err)
+for key in iterations:
+    print(key, ' iterations: ', iterations[key])
+print('Newton-Raphson: ', nrSolver.numSolves, ' solutions; ', nrSolver.averageNumIterations, ' iterations per solution.')
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
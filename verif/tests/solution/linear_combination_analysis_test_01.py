@@ -0,0 +1,127 @@
+# -*- coding: utf-8 -*-
+''' Check that the results obtained for a set of load combinations by
+    superposition of the responses to each load pattern (one factorization
+    of the stiffness matrix) are the same that those obtained solving each
+    combination independently. The model is a portal frame with nodal and
+    element loads.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+H= 4.0 # Column height.
+L= 6.0 # Beam span.
+NumDiv= 4 # Number of elements in each member.
+E= 210e9 # Elastic modulus.
+A= 53.8e-4 # Cross-section area.
+I= 3892e-8 # Moment of inertia.
+qG= -15e3 # Dead load (N/m).
+qQ= -10e3 # Live load (N/m).
+W= 20e3 # Wind load (N).
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+
+# Materials and coordinate transformation.
+section= typical_materials.defElasticSection2d(preprocessor, "section", A, E, I)
+lin= modelSpace.newLinearCrdTransf("lin")
+
+# Mesh.
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= section.name
+allNodes= list()
+def newMember(nodeI, x0, y0, x1, y1):
+    ''' Create a member from nodeI (x0,y0) to (x1,y1).'''
+    retval= list()
+    for k in range(1, NumDiv+1):
+        f= k/NumDiv
+        nodeJ= nodes.newNodeXY(x0+f*(x1-x0), y0+f*(y1-y0))
+        allNodes.append(nodeJ)
+        retval.append(elements.newElement('ElasticBeam2d', xc.ID([nodeI.tag, nodeJ.tag])))
+        nodeI= nodeJ
+    return nodeI, retval
+n0= nodes.newNodeXY(0.0, 0.0)
+allNodes.append(n0)
+n1, leftColumn= newMember(n0, 0.0, 0.0, 0.0, H)
+n2, beam= newMember(n1, 0.0, H, L, H)
+nodeJ, rightColumn= newMember(n2, L, H, L, 0.0)
+modelSpace.fixNode000(n0.tag)
+modelSpace.fixNode000(nodeJ.tag)
+allElements= leftColumn+beam+rightColumn
+
+# Load definition.
+lpG= modelSpace.newLoadPattern(name= 'G')
+lpQ= modelSpace.newLoadPattern(name= 'Q')
+lpW= modelSpace.newLoadPattern(name= 'W')
+for lp, q in [(lpG, qG), (lpQ, qQ)]:
+    modelSpace.setCurrentLoadPattern(lp.name)
+    for e in beam:
+        e.vector2dUniformLoadGlobal(xc.Vector([0.0, q]))
+lpW.newNodalLoad(n1.tag, xc.Vector([W, 0, 0]))
+
+# Load combinations.
+combs= preprocessor.getLoadHandler.getLoadCombinations
+combs.newLoadCombination("ELU01","1.35*G+1.5*Q")
+combs.newLoadCombination("ELU02","1.00*G+1.5*W")
+combs.newLoadCombination("ELU03","1.35*G+1.05*Q+0.9*W")
+combs.newLoadCombination("ELU04","0.80*G-1.5*W")
+
+def getResults():
+    ''' Return the displacements and internal forces of the model.'''
+    retval= list()
+    for n in allNodes:
+        retval.extend(n.getDisp)
+    for e in allElements:
+        e.getResistingForce()
+        retval.extend([e.getN1, e.getN2, e.getV1, e.getV2, e.getM1, e.getM2])
+    return retval
+
+# Solve each combination independently.
+refSolProc= predefined_solutions.SimpleStaticLinear(feProblem, name= 'reference')
+refSolProc.setup()
+refResults= dict()
+for key in combs.getKeys():
+    refSolProc.solveComb(key)
+    refResults[key]= getResults()
+refSolProc.resetLoadCase()
+
+# Solve the combinations by superposition.
+solProc= predefined_solutions.LinearCombinationsStaticLinear(feProblem, name= 'superposition')
+solProc.setup()
+result= solProc.computePrimaryResponses(combs)
+ok= (result==0) and (solProc.analysis.numPrimaryResponses==3)
+err= 0.0
+for key in combs.getKeys():
+    result= solProc.solveComb(key)
+    ok= ok and (result==0)
+    res= getResults()
+    ref= refResults[key]
+    for v, vRef in zip(res, ref):
+        err= max(err, abs(v-vRef)/max(abs(vRef),1.0))
+
+'''
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok and (err<1e-6)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,87 @@
+# -*- coding: utf-8 -*-
+''' Check that the linear solution algorithm reuses the factorization
+    of the tangent in a linear transient analysis when factorOnce is
+    true (the tangent is formed only in the first step) and that the
+    results are the same as those obtained forming the tangent at each
+    step (UMFPACK solver).
+'''
+
+from __future__ import print_function
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 210e9 # Elastic modulus.
+A= 53.8e-4 # Cross-section area.
+I= 3892e-8 # Moment of inertia.
+L= 5.0 # Cantilever length.
+NumDiv= 10 # Number of elements.
+nodeMass= 100.0 # Mass of each node.
+F= 10e3 # Load.
+dT= 0.001 # Time step.
+numSteps= 50 # Number of steps.
+
+def computeTipDisplacements(factorOnce):
+    ''' Compute the displacements of the cantilever tip under a
+        suddenly applied load.
+
+    :param factorOnce: if true, form and factor the tangent only once.
+    '''
+    feProblem= xc.FEProblem()
+    feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+    section= typical_materials.defElasticSection2d(preprocessor, "section", A, E, I)
+    lin= modelSpace.newLinearCrdTransf("lin")
+    elements= preprocessor.getElementHandler
+    elements.defaultTransformation= lin.name
+    elements.defaultMaterial= section.name
+    nodeI= nodes.newNodeXY(0.0, 0.0)
+    modelSpace.fixNode000(nodeI.tag)
+    for k in range(1, NumDiv+1):
+        nodeJ= nodes.newNodeXY(k*L/NumDiv, 0.0)
+        nodeJ.mass= xc.Matrix([[nodeMass,0,0],[0,nodeMass,0],[0,0,0]])
+        elements.newElement('ElasticBeam2d', xc.ID([nodeI.tag, nodeJ.tag]))
+        nodeI= nodeJ
+    tipNode= nodeJ
+    modelSpace.newTimeSeries(name= "ts", tsType= "constant_ts")
+    lp0= modelSpace.newLoadPattern(name= '0')
+    lp0.newNodalLoad(tipNode.tag,xc.Vector([0, -F, 0]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+    solProc= predefined_solutions.NewmarkBase(prb= feProblem, timeStep= dT, name= None, constraintHandlerType= 'plain', maxNumIter= 1, convergenceTestTol= 1e-9, printFlag= 0, numSteps= 1, numberingMethod= 'rcm', convTestType= None, soeType= 'umfpack_gen_lin_soe', solverType= 'umfpack_gen_lin_solver', solutionAlgorithmType= 'linear_soln_algo')
+    solProc.setup()
+    solProc.solAlgo.factorOnce= factorOnce
+    retval= list()
+    for i in range(0, numSteps):
+        solProc.solve()
+        retval.append(tipNode.getDisp[1])
+    return retval, solProc.solAlgo.numTangentForms
+
+refDisp, refNumTangentForms= computeTipDisplacements(factorOnce= False)
+disp, numTangentForms= computeTipDisplacements(factorOnce= True)
+
+maxDisp= max([abs(v) for v in refDisp])
+err= max([abs(a-b) for a, b in zip(refDisp, disp)])/maxDisp
+
+'''
+print('maxDisp= ', maxDisp)
+print('err= ', err)
+print('number of tangent forms: ', refNumTangentForms, '->', numTangentForms)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((maxDisp>0.0) and (err<1e-10) and (refNumTangentForms==numSteps) and (numTangentForms==1)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+''' Check that the results obtained with the nested dissection DOF
+    numberer are the same as those obtained with the reverse Cuthill-McKee
+    one in a staged analysis (the elements of the upper half of the mesh
+    are deactivated and reactivated again, so the ordering computed
+    in the first stage is reused in the last one).
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDiv= 6
+L= 1.0 # Side of the cube.
+E= 30e9 # Elastic modulus.
+nu= 0.3 # Poisson's ratio
+F= 100e3 # Load on each of the top nodes.
+
+def solveStages(numberingMethod):
+    ''' Solve the model in three stages and return the displacements of
+        the top nodes at the end of each stage.
+
+    :param numberingMethod: DOF numbering method.
+    '''
+    feProblem= xc.FEProblem()
+    feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+    preprocessor=  feProblem.getPreprocessor
+    nodes= preprocessor.getNodeHandler
+    modelSpace= predefined_spaces.SolidMechanics3D(nodes)
+
+    # Material definition
+    elast3d= typical_materials.defElasticIsotropic3d(preprocessor, "elast3d", E, nu, 0.0)
+
+    # Geometry.
+    pt1= modelSpace.newKPoint(0,0,0)
+    pt2= modelSpace.newKPoint(L,0,0)
+    pt3= modelSpace.newKPoint(L,L,0)
+    pt4= modelSpace.newKPoint(0,L,0)
+    pt5= modelSpace.newKPoint(0,0,L)
+    pt6= modelSpace.newKPoint(L,0,L)
+    pt7= modelSpace.newKPoint(L,L,L)
+    pt8= modelSpace.newKPoint(0,L,L)
+    bodies= preprocessor.getMultiBlockTopology.getBodies
+    b1= bodies.newBlockPts(pt1.tag, pt2.tag, pt3.tag, pt4.tag, pt5.tag, pt6.tag, pt7.tag, pt8.tag)
+    b1.nDivI= NumDiv
+    b1.nDivJ= NumDiv
+    b1.nDivK= NumDiv
+
+    # Mesh generation.
+    seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+    seedElemHandler.defaultMaterial= elast3d.name
+    brick= seedElemHandler.newElement("Brick")
+    b1.genMesh(xc.meshDir.I)
+
+    # Constraints and loads.
+    lp0= modelSpace.newLoadPattern(name= '0')
+    checkNodes= list()
+    for n in b1.nodes:
+        z= n.getInitialPos3d.z
+        if(abs(z)<1e-6):
+            modelSpace.fixNode000(n.tag)
+        elif(abs(z-L/2.0)<1e-6):
+            checkNodes.append(n)
+            lp0.newNodalLoad(n.tag, xc.Vector([F, 0.0, -F]))
+    modelSpace.addLoadCaseToDomain(lp0.name)
+
+    # Elements of the upper half.
+    upperSet= modelSpace.defSet('upperSet')
+    for e in b1.elements:
+        if(e.getPosCentroid(True).z>L/2.0):
+            upperSet.elements.append(e)
+    upperSet.fillDownwards()
+
+    solProc= predefined_solutions.SimpleStaticLinearUMF(feProblem, numberingMethod= numberingMethod)
+    retval= list()
+    for stage in range(0,3):
+        if(stage==1):
+            modelSpace.deactivateElements(upperSet)
+        elif(stage==2):
+            modelSpace.activateElements(upperSet)
+        result= solProc.solve()
+        disp= list()
+        for n in checkNodes:
+            disp.extend(n.getDisp)
+        retval.append((result, disp))
+    return retval
+
+reference= solveStages('rcm')
+results= solveStages('nested_dissection')
+
+ok= True
+err= 0.0
+for (refResult, refDisp), (result, disp) in zip(reference, results):
+    refNorm= max([abs(x) for x in refDisp])
+    ok= ok and (refResult==0) and (result==0) and (refNorm>0.0)
+    if(refNorm>0.0):
+        err= max(err, max([abs(a-b) for a, b in zip(disp, refDisp)])/refNorm)
+ok= ok and (err<1e-8)
+
+'''
+print('err= ', err)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
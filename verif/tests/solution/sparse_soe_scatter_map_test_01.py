@@ -0,0 +1,102 @@
+# -*- coding: utf-8 -*-
+''' Check that the sparse systems of equations (that cache the locations
+    where the element matrices are assembled) give the same results
+    that the banded one. The model (a set of cantilevers with P-Delta
+    coordinate transformation) is solved in several steps, so the element
+    matrices are assembled many times with the same location arrays.
+'''
+
+from __future__ import print_function
+
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumColumns= 5 # Number of cantilevers.
+NumDiv= 8 # Number of elements in each cantilever.
+L= 3.0 # Cantilever length.
+E= 210e9 # Elastic modulus.
+G= E/(2*1.3) # Shear modulus.
+A= 53.8e-4 # Cross-section area.
+Iz= 3892e-8 # Moment of inertia.
+Iy= 1318e-8 # Moment of inertia.
+J= 0.2e-6 # Torsional constant.
+F= 10e3 # Horizontal load.
+P= -200e3 # Vertical load.
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+
+# Materials and coordinate transformation.
+section= typical_materials.defElasticSection3d(preprocessor, "section", A, E, G, Iz, Iy, J)
+pDelta= modelSpace.newPDeltaCrdTransf("pDelta",xc.Vector([1,0,0]))
+
+# Mesh.
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= pDelta.name
+elements.defaultMaterial= section.name
+topNodes= list()
+for j in range(0, NumColumns):
+    y= float(j)
+    nodeI= nodes.newNodeXYZ(0.0, y, 0.0)
+    modelSpace.fixNode000_000(nodeI.tag)
+    for k in range(1, NumDiv+1):
+        nodeJ= nodes.newNodeXYZ(0.0, y, k*L/NumDiv)
+        elem= elements.newElement('ElasticBeam3d', xc.ID([nodeI.tag, nodeJ.tag]))
+        nodeI= nodeJ
+    topNodes.append(nodeJ)
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+for j, n in enumerate(topNodes):
+    lp0.newNodalLoad(n.tag,xc.Vector([F, (j+1)*F, P, 0, 0, 0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solve using different systems of equations.
+soeSolverPairs= [('band_gen_lin_soe', 'band_gen_lin_lapack_solver'), # reference
+                 ('sparse_gen_col_lin_soe', 'super_lu_solver'),
+                 ('umfpack_gen_lin_soe', 'umfpack_gen_lin_solver'),
+                 ('sym_sparse_lin_soe', 'sym_sparse_lin_solver')]
+results= list()
+for soeType, solverType in soeSolverPairs:
+    feProblem.getDomain.revertToStart()
+    solProc= predefined_solutions.PenaltyNewtonRaphsonBase(feProblem, name= soeType, maxNumIter= 20, convergenceTestTol= 1e-9, printFlag= 0, numSteps= 4, numberingMethod= 'rcm', convTestType= 'norm_unbalance_conv_test', soeType= soeType, solverType= solverType)
+    solProc.setup()
+    result= solProc.solve()
+    disp= list()
+    for n in topNodes:
+        disp.extend(n.getDisp)
+    results.append((result, xc.Vector(disp)))
+
+ok= True
+reference= results[0][1]
+refNorm= reference.Norm()
+errors= list()
+for result, disp in results:
+    ok= ok and (result==0)
+    err= (disp-reference).Norm()/refNorm
+    errors.append(err)
+    ok= ok and (err<1e-8)
+
+'''
+print('errors: ', errors)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
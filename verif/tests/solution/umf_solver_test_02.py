@@ -0,0 +1,90 @@
+# -*- coding: utf-8 -*-
+''' Check the solution of several right hand sides using the same
+    factorization of the stiffness matrix (UMFPACK solver).
+'''
+
+from __future__ import print_function
+
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+from solution import predefined_solutions
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 210e9 # Elastic modulus.
+A= 53.8e-4 # Cross-section area.
+I= 3892e-8 # Moment of inertia.
+L= 5.0 # Cantilever length.
+NumDiv= 10 # Number of elements.
+F= 10e3 # Load.
+
+# Problem type
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/erase.log" # Ignore warning messages
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+
+# Materials and coordinate transformation.
+section= typical_materials.defElasticSection2d(preprocessor, "section", A, E, I)
+lin= modelSpace.newLinearCrdTransf("lin")
+
+# Mesh.
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= section.name
+nodeI= nodes.newNodeXY(0.0, 0.0)
+modelSpace.fixNode000(nodeI.tag)
+for k in range(1, NumDiv+1):
+    nodeJ= nodes.newNodeXY(k*L/NumDiv, 0.0)
+    elem= elements.newElement('ElasticBeam2d', xc.ID([nodeI.tag, nodeJ.tag]))
+    nodeI= nodeJ
+tipNode= nodeJ
+
+# Load definition.
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(tipNode.tag,xc.Vector([0, -F, 0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+
+# Solution.
+solProc= predefined_solutions.SimpleStaticLinearUMF(feProblem)
+result= solProc.solve()
+soe= solProc.soe
+factored= soe.factored # The factorization is kept after the solution.
+
+# Solve for b and 2*b using the previous factorization.
+b= soe.b
+x= soe.x
+numEqn= soe.numEqn
+rows= list()
+for i in range(0, numEqn):
+    rows.append([b[i], 2*b[i]])
+X= soe.solveMultipleRHS(xc.Matrix(rows))
+err= 0.0
+for i in range(0, numEqn):
+    err+= (X(i,0)-x[i])**2+(X(i,1)-2*x[i])**2
+err= err**0.5/x.Norm()
+
+# Analytical solution.
+vTip= tipNode.getDisp[1]
+vTipRef= -F*L**3/(3*E*I)
+ratio= abs(vTip-vTipRef)/abs(vTipRef)
+
+'''
+print('factored: ', factored)
+print('err= ', err)
+print('vTip= ', vTip, ' vTipRef= ', vTipRef, ' ratio= ', ratio)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if((result==0) and factored and (err<1e-12) and (ratio<1e-10)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
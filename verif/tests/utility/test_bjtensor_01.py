@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+''' Check the access to the components of BJtensor objects of rank 1 to 4
+    (nDarray_rep::get_index) and the rank and the values of the tensor
+    products (BJtensor::operator*) against pure Python loops. The
+    dimensions are not equal in all the directions so a wrong stride in
+    the index computation can't go unnoticed.'''
+
+from __future__ import print_function
+
+import math
+import itertools
+import xc
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+def getValues(dims, seed):
+    ''' Return a list of values for a tensor with the given dimensions.'''
+    n= 1
+    for d in dims:
+        n*= d
+    return [math.sin(seed+0.37*i) for i in range(0, n)]
+
+def getFlatIndex(dims, subscripts):
+    ''' Return the position of the component in the list of values
+        (last subscript varies fastest, subscripts are 1-based).'''
+    retval= 0
+    for d, s in zip(dims, subscripts):
+        retval= retval*d+s-1
+    return retval
+
+def getSubscripts(dims):
+    ''' Return the subscripts of all the components (1-based).'''
+    return itertools.product(*[range(1, d+1) for d in dims])
+
+def contract(aDims, aValues, aIndices, bDims, bValues, bIndices):
+    ''' Pure Python tensor product with contraction of the repeated
+        indices. The indices of the result are the uncontracted indices
+        of the first tensor followed by the uncontracted indices of the
+        second one (as in BJtensor::operator*).'''
+    indexDims= dict()
+    for i, d in zip(aIndices+bIndices, aDims+bDims):
+        indexDims[i]= d
+    resultIndices= [i for i in aIndices if i not in bIndices]+[i for i in bIndices if i not in aIndices]
+    contractedIndices= [i for i in aIndices if i in bIndices]
+    resultDims= [indexDims[i] for i in resultIndices]
+    retval= list()
+    for rs in getSubscripts(resultDims):
+        value= 0.0
+        for cs in getSubscripts([indexDims[i] for i in contractedIndices]):
+            sub= dict(zip(resultIndices, rs))
+            sub.update(dict(zip(contractedIndices, cs)))
+            aPos= getFlatIndex(aDims, [sub[i] for i in aIndices])
+            bPos= getFlatIndex(bDims, [sub[i] for i in bIndices])
+            value+= aValues[aPos]*bValues[bPos]
+        retval.append(value)
+    return resultDims, retval
+
+# Component access for ranks 1 to 4.
+err= 0.0
+ok= True
+for dims in [[5], [2,3], [2,3,4], [2,3,4,5]]:
+    values= getValues(dims, len(dims))
+    t= xc.BJtensor(dims, values)
+    ok= ok and (t.rank==len(dims)) and (t.getDim()==dims)
+    for s in getSubscripts(dims):
+        err= max(err, abs(t.getValue(list(s))-values[getFlatIndex(dims, s)]))
+    # Write each component and read the whole array.
+    for s in getSubscripts(dims):
+        t.setValue(list(s), 2.0*values[getFlatIndex(dims, s)])
+    err= max(err, max([abs(a-2.0*b) for a, b in zip(t.getValues(), values)]))
+
+# Tensor products.
+cases= [([2,3], 'ij', [3,4], 'jk'), # matrix product.
+        ([2,3,3,4], 'ijkl', [3,4], 'kl'), # double contraction.
+        ([3,3], 'ij', [3,3], 'kl'), # outer product (rank 4).
+        ([2,3], 'ij', [2,3], 'ij'), # full contraction (rank 0).
+        ([2,3,4], 'ijk', [4], 'k'), # rank 3 by rank 1.
+        ([4], 'i', [2,3,4], 'jki'), # rank 1 by rank 3.
+        ([2,3], 'ij', [4,2], 'ki')] # contracted index is not the last one.
+errProd= 0.0
+for (aDims, aIndices, bDims, bIndices) in cases:
+    aValues= getValues(aDims, 1.0)
+    bValues= getValues(bDims, 2.0)
+    a= xc.BJtensor(aDims, aValues)
+    b= xc.BJtensor(bDims, bValues)
+    c= a.contract(aIndices, b, bIndices)
+    refDims, refValues= contract(aDims, aValues, aIndices, bDims, bValues, bIndices)
+    ok= ok and (c.rank==len(refDims)) and (c.getDim()==refDims)
+    cValues= c.getValues()
+    if(len(refDims)==0):
+        cValues= [c.getValue([])]
+    ok= ok and (len(cValues)==len(refValues))
+    errProd= max(errProd, max([abs(x-y) for x, y in zip(cValues, refValues)]))
+
+# Contraction of a tensor with itself.
+aDims= [3,3]
+aValues= getValues(aDims, 3.0)
+a= xc.BJtensor(aDims, aValues)
+aa= a.contract('ij', a, 'jk')
+refDims, refValues= contract(aDims, aValues, 'ij', aDims, aValues, 'jk')
+ok= ok and (aa.getDim()==refDims)
+errProd= max(errProd, max([abs(x-y) for x, y in zip(aa.getValues(), refValues)]))
+
+'''
+print('err= ', err)
+print('errProd= ', errProd)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok and (err<1e-15) and (errProd<1e-12)):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')
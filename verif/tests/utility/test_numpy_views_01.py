@@ -0,0 +1,97 @@
+# -*- coding: utf-8 -*-
+''' Check the numpy views of Vector, Matrix and ID objects and the bulk
+    accessors to the nodal and element results of a set.'''
+
+from __future__ import print_function
+
+import numpy
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2026, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Views of vectors, matrices and identifiers.
+v= xc.Vector([1.0, 2.0, 3.0])
+a= numpy.asarray(v)
+a[0]= 5.0 # the view shares the vector data.
+ok= (a.shape==(3,)) and (v[0]==5.0) and (memoryview(v).format=='d')
+m= xc.Matrix([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+b= numpy.asarray(m)
+b[1,2]= 7.0
+ok= ok and (b.shape==(2,3)) and (m(1,2)==7.0) and (b[1,0]==4.0) and (b[0,2]==3.0)
+ids= numpy.asarray(xc.ID([4, 5, 6]))
+ok= ok and (list(ids)==[4, 5, 6])
+
+# Cantilever.
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+A= 7.64e-4 # Cross section area (m2)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+L= 1.5 # Bar length (m)
+F= 1.5e3 # Load magnitude (N)
+numDiv= 10
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics2D(nodes)
+nodeList= [nodes.newNodeXY(L*i/numDiv, 0.0) for i in range(0, numDiv+1)]
+lin= modelSpace.newLinearCrdTransf("lin")
+section= typical_materials.defElasticSection2d(preprocessor, "section", A= A, E= E, I= Iz)
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= lin.name
+elements.defaultMaterial= section.name
+for n0, n1 in zip(nodeList[:-1], nodeList[1:]):
+    elements.newElement("ElasticBeam2d",xc.ID([n0.tag, n1.tag]))
+modelSpace.fixNode000(nodeList[0].tag)
+lp0= modelSpace.newLoadPattern(name= '0')
+lp0.newNodalLoad(nodeList[-1].tag, xc.Vector([F/10.0,-F,0]))
+modelSpace.addLoadCaseToDomain(lp0.name)
+analysis= predefined_solutions.simple_static_linear(feProblem)
+result= analysis.analyze(1)
+modelSpace.calculateNodalReactions()
+
+xcTotalSet= modelSpace.getTotalSet()
+setNodes= xcTotalSet.nodes
+setElements= xcTotalSet.elements
+
+# Nodal results.
+nodeTags= list(setNodes.getTags())
+disp= numpy.asarray(setNodes.getDispMatrix())
+refDisp= numpy.array([setNodes.findTag(t).getDisp.getList() for t in nodeTags])
+reactions= numpy.asarray(setNodes.getReactionMatrix())
+refReactions= numpy.array([setNodes.findTag(t).getReaction.getList() for t in nodeTags])
+ok= ok and (disp.shape==(numDiv+1, 3)) and (numpy.linalg.norm(disp-refDisp)<1e-12)
+ok= ok and (numpy.linalg.norm(reactions-refReactions)<1e-9)
+totalReaction= reactions.sum(axis= 0)
+ok= ok and (abs(totalReaction[0]+F/10.0)<1e-6) and (abs(totalReaction[1]-F)<1e-6)
+vel= numpy.asarray(setNodes.getVelMatrix())
+ok= ok and (vel.shape==(numDiv+1, 3)) and (numpy.abs(vel).max()==0.0)
+
+# Element results.
+elementTags= list(setElements.getTags())
+forces= numpy.asarray(setElements.getResistingForceMatrix())
+refForces= numpy.array([setElements.findTag(t).getResistingForce().getList() for t in elementTags])
+ok= ok and (forces.shape==(numDiv, 6)) and (numpy.linalg.norm(forces-refForces)<1e-9)
+lengths= numpy.asarray(setElements.getValuesAtNodesMatrix('length'))
+ok= ok and (lengths.shape==(numDiv, 2)) and (numpy.abs(lengths-L/numDiv).max()<1e-12)
+
+'''
+print(disp)
+print(reactions)
+print(forces)
+print(lengths)
+'''
+
+import os
+from misc_utils import log_messages as lmsg
+fname= os.path.basename(__file__)
+if(ok):
+    print('test '+fname+': ok.')
+else:
+    lmsg.error(fname+' ERROR.')